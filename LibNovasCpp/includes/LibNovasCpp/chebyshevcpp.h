@@ -0,0 +1,366 @@
+/*
+  New file with Chebyshev approximations of NOVAS functions of time.
+  Royal Observatory of the Spanish Navy.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "novas.h"
+#include "solarsystem.h"
+
+namespace novas
+{
+
+// Piecewise Chebyshev approximation of a function of TT with 'Dim' components, fitted with error
+// control over a window [jd_begin, jd_end].
+//
+// The function is any callable 'short int fn(double jd_high, double jd_low, double* value)' that writes
+// 'Dim' values at the TT Julian date jd_high + jd_low and returns 0 on success (the NOVAS convention),
+// for example one of the adapters below. The date is split so that functions of the Earth rotation
+// are sampled with their full precision. The window
+// is halved recursively until the fit of each piece, checked against the function between the fitting
+// nodes, is within the tolerance. The pieces are found with a lookup table, so an evaluation costs a
+// multiplication, a table read and 'degree' Clenshaw steps per component, without any call to NOVAS.
+//
+// A fitted object is read-only: 'evaluate' can be called from several threads at once.
+template <std::size_t Dim>
+class ChebyshevFit
+{
+public:
+
+    static_assert(Dim > 0, "ChebyshevFit needs at least one component");
+
+    // Fits 'fn' over the window with polynomials of 'degree', down to pieces of the window divided by
+    // 2^max_depth. The tolerance is absolute, in the units of the function values; it should be above
+    // the noise of the function, or every piece is halved down to 'max_depth'.
+    // Returns 0 if the tolerance is met, 1 for invalid arguments, 2 if some pieces of the deepest level
+    // do not meet the tolerance (the fit is kept, see 'maxError'), or the error code of 'fn' plus 10.
+    template <typename Function>
+    short int fit(Function&& fn, double jd_begin, double jd_end, double tolerance,
+                  unsigned int degree = 12, unsigned int max_depth = 12)
+    {
+        this->clear();
+
+        if (!(jd_end > jd_begin) || !(tolerance > 0.0) || degree < 1 || degree > 32 || max_depth > 24)
+            return 1;
+
+        const std::size_t n_nodes = degree + 1;
+        std::vector<double> node_cos(n_nodes * n_nodes);
+        std::vector<double> values(Dim * n_nodes);
+        std::vector<double> coef(Dim * n_nodes);
+        std::vector<std::pair<double, unsigned int>> pending = {{jd_begin, 0U}};
+        std::array<double, Dim> value;
+        short int error = 0;
+
+        // cos(j * theta_k) at the Chebyshev nodes theta_k = pi * (k + 1/2) / (degree + 1).
+        for (std::size_t k = 0; k < n_nodes; k++)
+            for (std::size_t j = 0; j < n_nodes; j++)
+                node_cos[k * n_nodes + j] =
+                    std::cos(static_cast<double>(j) * kPi * (static_cast<double>(k) + 0.5) / n_nodes);
+
+        this->begin_ = jd_begin;
+        this->end_ = jd_end;
+        this->degree_ = degree;
+
+        // Depth-first bisection: the pieces are produced in order of time.
+        while (!pending.empty())
+        {
+            const double a = pending.back().first;
+            const unsigned int depth = pending.back().second;
+            const double width = (jd_end - jd_begin) / static_cast<double>(1UL << depth);
+            const double mid = a + 0.5 * width;
+            const double half = 0.5 * width;
+
+            pending.pop_back();
+
+            // Values at the nodes, and the coefficients of the interpolating polynomial.
+            for (std::size_t k = 0; k < n_nodes; k++)
+            {
+                if ((error = fn(mid, half * node_cos[k * n_nodes + 1], value.data())) != 0)
+                {
+                    this->clear();
+                    return static_cast<short int>(error + 10);
+                }
+                for (std::size_t d = 0; d < Dim; d++)
+                    values[d * n_nodes + k] = value[d];
+            }
+
+            for (std::size_t j = 0; j < n_nodes; j++)
+            {
+                for (std::size_t d = 0; d < Dim; d++)
+                {
+                    double sum = 0.0;
+                    for (std::size_t k = 0; k < n_nodes; k++)
+                        sum += values[d * n_nodes + k] * node_cos[k * n_nodes + j];
+                    coef[j * Dim + d] = sum * (j == 0 ? 1.0 : 2.0) / static_cast<double>(n_nodes);
+                }
+            }
+
+            // Error at the points halfway between the nodes, including both ends of the piece.
+            double piece_error = 0.0;
+            for (std::size_t k = 0; k <= n_nodes; k++)
+            {
+                const double x = std::cos(kPi * static_cast<double>(k) / static_cast<double>(n_nodes));
+                std::array<double, Dim> approx;
+                if ((error = fn(mid, half * x, value.data())) != 0)
+                {
+                    this->clear();
+                    return static_cast<short int>(error + 10);
+                }
+                clenshaw(coef.data(), degree, x, approx.data());
+                for (std::size_t d = 0; d < Dim; d++)
+                    piece_error = std::max(piece_error, std::fabs(approx[d] - value[d]));
+            }
+
+            if (piece_error > tolerance && depth < max_depth)
+            {
+                pending.push_back({mid, depth + 1});
+                pending.push_back({a, depth + 1});
+                continue;
+            }
+
+            this->pieces_.push_back({mid, 1.0 / half, depth});
+            this->coef_.insert(this->coef_.end(), coef.begin(), coef.end());
+            this->max_error_ = std::max(this->max_error_, piece_error);
+            this->depth_ = std::max(this->depth_, depth);
+        }
+
+        // Lookup table: the piece of each cell of the finest level.
+        const std::size_t cells = std::size_t(1) << this->depth_;
+        this->index_.reserve(cells);
+        for (std::size_t p = 0; p < this->pieces_.size(); p++)
+            this->index_.insert(this->index_.end(), cells >> this->pieces_[p].depth,
+                                static_cast<std::uint32_t>(p));
+        this->cell_scale_ = static_cast<double>(cells) / (jd_end - jd_begin);
+
+        return this->max_error_ > tolerance ? 2 : 0;
+    }
+
+    // Value of the fit at 'jd_tt'. Returns false (and leaves 'value' unchanged) outside the window.
+    bool evaluate(double jd_tt, double* value) const
+    {
+        return this->evaluate(jd_tt, 0.0, value);
+    }
+
+    // Value of the fit at the TT Julian date jd_high + jd_low, keeping the precision of the split date.
+    bool evaluate(double jd_high, double jd_low, double* value) const
+    {
+        const double t = ((jd_high - this->begin_) + jd_low) * this->cell_scale_;
+
+        if (this->index_.empty() || !(t >= 0.0) || t > static_cast<double>(this->index_.size()))
+            return false;
+
+        const std::size_t cell = std::min(static_cast<std::size_t>(t), this->index_.size() - 1);
+        const std::uint32_t p = this->index_[cell];
+        const Piece& piece = this->pieces_[p];
+        const double x = ((jd_high - piece.mid) + jd_low) * piece.inv_half;
+        clenshaw(&this->coef_[p * Dim * (this->degree_ + 1)], this->degree_, x, value);
+
+        return true;
+    }
+
+    std::array<double, Dim> operator()(double jd_tt) const
+    {
+        std::array<double, Dim> value{};
+        this->evaluate(jd_tt, value.data());
+        return value;
+    }
+
+    void clear()
+    {
+        this->pieces_.clear();
+        this->coef_.clear();
+        this->index_.clear();
+        this->begin_ = this->end_ = this->cell_scale_ = this->max_error_ = 0.0;
+        this->degree_ = 0;
+        this->depth_ = 0;
+    }
+
+    bool isFitted() const {return !this->index_.empty();}
+    double begin() const {return this->begin_;}
+    double end() const {return this->end_;}
+    unsigned int degree() const {return this->degree_;}
+    std::size_t pieceCount() const {return this->pieces_.size();}
+
+    // Largest difference between the fit and the function found at the check points.
+    double maxError() const {return this->max_error_;}
+
+private:
+
+    static constexpr double kPi = 3.14159265358979323846;
+
+    struct Piece
+    {
+        double mid;
+        double inv_half;
+        unsigned int depth;
+    };
+
+    // Sums of coef[j * Dim + d] * T_j(x), j = 0 to degree, for each component 'd'. The components
+    // are advanced together, so that their recurrences overlap in the pipeline.
+    static void clenshaw(const double* coef, unsigned int degree, double x, double* value)
+    {
+        const double x2 = 2.0 * x;
+        double b1[Dim] = {};
+        double b2[Dim] = {};
+        unsigned int j = degree;
+
+        // Two steps per pass, swapping the roles of b1 and b2 instead of copying them.
+        for (; j > 1; j -= 2)
+        {
+            for (std::size_t d = 0; d < Dim; d++)
+            {
+                b2[d] = coef[j * Dim + d] + x2 * b1[d] - b2[d];
+                b1[d] = coef[(j - 1) * Dim + d] + x2 * b2[d] - b1[d];
+            }
+        }
+
+        if (j == 1)
+        {
+            for (std::size_t d = 0; d < Dim; d++)
+            {
+                const double b0 = coef[Dim + d] + x2 * b1[d] - b2[d];
+                b2[d] = b1[d];
+                b1[d] = b0;
+            }
+        }
+
+        for (std::size_t d = 0; d < Dim; d++)
+            value[d] = coef[d] + x * b1[d] - b2[d];
+    }
+
+    std::vector<Piece> pieces_;
+    std::vector<double> coef_;
+    std::vector<std::uint32_t> index_;
+    double begin_ = 0.0;
+    double end_ = 0.0;
+    double cell_scale_ = 0.0;
+    double max_error_ = 0.0;
+    unsigned int degree_ = 0;
+    unsigned int depth_ = 0;
+};
+
+// =====================================================================================================================
+// Adapters of NOVAS functions for 'ChebyshevFit'. Angles that wrap around (right ascensions, sidereal
+// time) are fitted as rectangular vectors or unwrapped, since the fit needs continuous functions.
+
+// Apparent place of a solar system body ('app_planet') as a rectangular vector in AU, for
+// ChebyshevFit<3>. Use 'vector2radec' on the fitted vector to get the right ascension and declination.
+struct AppPlanetFunction
+{
+    object body;
+    short int accuracy = 0;
+
+    short int operator()(double jd_high, double jd_low, double* value) const
+    {
+        double ra, dec, dis;
+        object target = this->body;
+        short int error = app_planet(jd_high + jd_low, &target, this->accuracy, &ra, &dec, &dis);
+        if (error == 0)
+            radec2vector(ra, dec, dis, value);
+        return error;
+    }
+};
+
+// Topocentric place of a solar system body ('topo_planet') as a rectangular vector in AU, for
+// ChebyshevFit<3>. 'delta_t' (TT - UT1, seconds) is constant over the window.
+struct TopoPlanetFunction
+{
+    object body;
+    on_surface location;
+    double delta_t = 0.0;
+    short int accuracy = 0;
+
+    short int operator()(double jd_high, double jd_low, double* value) const
+    {
+        double ra, dec, dis;
+        object target = this->body;
+        on_surface place = this->location;
+        short int error = topo_planet(jd_high + jd_low, &target, this->delta_t, &place, this->accuracy,
+                                      &ra, &dec, &dis);
+        if (error == 0)
+            radec2vector(ra, dec, dis, value);
+        return error;
+    }
+};
+
+// Position and velocity of the Earth or the Sun from the analytic theory ('solarsystem_analytic'),
+// for ChebyshevFit<6>: the position in AU, then the velocity in AU/day.
+struct AnalyticSolarSystemFunction
+{
+    short int body = 3;
+    short int origin = 0;
+
+    short int operator()(double jd_high, double jd_low, double* value) const
+    {
+        double tt, secdiff;
+        tdb2tt(jd_high + jd_low, &tt, &secdiff);
+        return solarsystem_analytic(jd_high + (jd_low + secdiff / 86400.0), this->body, this->origin, value, value + 3);
+    }
+};
+
+// Greenwich sidereal time ('sidereal_time') in hours, for ChebyshevFit<1>. The value is not reduced
+// to 0-24 hours: it grows continuously from the sidereal time at 'jd_reference' (the beginning of the
+// window). Reduce the fitted value with 'SiderealTimeFunction::hours'. 'delta_t' is constant.
+struct SiderealTimeFunction
+{
+    double jd_reference = 0.0;
+    double delta_t = 0.0;
+    short int gst_type = 1;
+    short int method = 0;
+    short int accuracy = 0;
+
+    short int operator()(double jd_high, double jd_low, double* value) const
+    {
+        const double ut1_low = jd_low - this->delta_t / 86400.0;
+        double gst;
+        short int error = sidereal_time(jd_high, ut1_low, this->delta_t, this->gst_type, this->method,
+                                        this->accuracy, &gst);
+        if (error == 0)
+        {
+            // Whole turns taken from a linear mean sidereal time, counted from the reference date.
+            const double reference = mean_hours(this->jd_reference, -this->delta_t / 86400.0);
+            const double target = mean_hours(jd_high, ut1_low) - 24.0 * std::floor(reference / 24.0);
+            value[0] = gst + 24.0 * std::floor((target - gst) / 24.0 + 0.5);
+        }
+        return error;
+    }
+
+    // Linear approximation of the mean sidereal time in hours, good to a fraction of a second.
+    static double mean_hours(double ut1_high, double ut1_low)
+    {
+        return 18.697374558 + 24.06570982441908 * ((ut1_high - 2451545.0) + ut1_low);
+    }
+
+    // Reduces a fitted value to 0-24 hours.
+    static double hours(double value)
+    {
+        double gst = std::fmod(value, 24.0);
+        return gst < 0.0 ? gst + 24.0 : gst;
+    }
+};
+
+// Right ascension of the CIO ('cio_location') in hours, for ChebyshevFit<1>. The reference system
+// of the value is the one reported by 'cio_location', which does not change during a run.
+struct CioLocationFunction
+{
+    short int accuracy = 0;
+
+    short int operator()(double jd_high, double jd_low, double* value) const
+    {
+        double tt, secdiff;
+        short int ref_sys;
+        tdb2tt(jd_high + jd_low, &tt, &secdiff);
+        return cio_location(jd_high + (jd_low + secdiff / 86400.0), this->accuracy, value, &ref_sys);
+    }
+};
+
+} // END NAMESPACE NOVAS.
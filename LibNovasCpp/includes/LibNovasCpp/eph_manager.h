@@ -19,38 +19,158 @@
 
 #include <stdio.h>
 
+#include "libnovascpp_global.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+   Access modes for 'ephem_open_mode'.
+
+   EPH_MODE_READ  = records are read with 'fread' into 'BUFFER'.
+   EPH_MODE_MMAP  = the file is memory-mapped read-only and 'BUFFER'
+                    points directly into the mapping (no copy).
+*/
+
+#define EPH_MODE_READ 0
+#define EPH_MODE_MMAP 1
+
+/*
+   Access pattern hints for 'ephem_advise' (memory-mapped mode only).
+*/
+
+#define EPH_ADVISE_WILLNEED   0
+#define EPH_ADVISE_SEQUENTIAL 1
+#define EPH_ADVISE_RANDOM     2
+#define EPH_ADVISE_DONTNEED   3
+
+/*
+   Compact files written by 'Util_RefitEphemeris -f'.  A constant named
+   EPH_F32_NAME in the header marks a file whose records keep the first
+   EPH_F32_LEADING coefficients of each component as doubles and the
+   others as floats (see notes of 'ephem_open_mode').
+*/
+
+#define EPH_F32_NAME "CHBF32"
+#define EPH_F32_LEADING 2
+
+/*
+   Opaque handle of an open JPL ephemeris file, used by the re-entrant
+   functions with the '_r' suffix.  The functions without the suffix
+   share a single default handle whose state is mirrored in the
+   external variables below.
+*/
+
+typedef struct ephem_handle ephem_handle;
+
 /*
    External variables
 */
 
-extern short int KM;
+LIBNOVASCPP_EXPORT extern short int KM;
+
+LIBNOVASCPP_EXPORT extern int IPT[3][12], LPT[3];
 
-extern int IPT[3][12], LPT[3];
+LIBNOVASCPP_EXPORT extern long int  NRL, NP, NV;
+LIBNOVASCPP_EXPORT extern long int RECORD_LENGTH;
 
-extern long int  NRL, NP, NV;
-extern long int RECORD_LENGTH;
+LIBNOVASCPP_EXPORT extern double SS[3], JPLAU, PC[18], VC[18], TWOT, EM_RATIO;
+LIBNOVASCPP_EXPORT extern double *BUFFER;
 
-extern double SS[3], JPLAU, PC[18], VC[18], TWOT, EM_RATIO;
-extern double *BUFFER;
+LIBNOVASCPP_EXPORT extern FILE *EPHFILE;
 
-extern FILE *EPHFILE;
+LIBNOVASCPP_EXPORT extern double *EPHMAP;
+LIBNOVASCPP_EXPORT extern size_t EPHMAP_SIZE;
 
 /*
    Function prototypes
 */
 
-short int ephem_open (char *ephem_name, double *jd_begin, double *jd_end, short int *de_number);
+LIBNOVASCPP_EXPORT short int ephem_open (char *ephem_name, double *jd_begin, double *jd_end,
+                                         short int *de_number);
+
+LIBNOVASCPP_EXPORT short int ephem_open_mode (char *ephem_name, short int mode, double *jd_begin,
+                                              double *jd_end, short int *de_number);
+
+LIBNOVASCPP_EXPORT short int ephem_advise (double jd_begin, double jd_end, short int advice);
 
-short int ephem_close (void);
+LIBNOVASCPP_EXPORT short int ephem_close (void);
 
-short int planet_ephemeris (double tjd[2], short int target, short int center,
-                            double *position, double *velocity);
+LIBNOVASCPP_EXPORT short int planet_ephemeris (double tjd[2], short int target, short int center,
+                                               double *position, double *velocity);
 
-short int state (double *jed, short int target, double *target_pos, double *target_vel);
+LIBNOVASCPP_EXPORT short int planet_ephemeris_multi (double tjd[2], short int n_bodies, short int *targets,
+                                                     short int center, double *position, double *velocity);
 
-void interpolate (double *buf, double *t, long int ncm, long int na,
-                  double *position, double *velocity);
+LIBNOVASCPP_EXPORT short int planet_ephemeris_batch (long int n_epochs, double *tjd_high, double *tjd_low,
+                                                     short int target, short int center,
+                                                     double *position, double *velocity);
 
-void split (double tt, double *fr);
+LIBNOVASCPP_EXPORT short int planet_ephemeris_span (double tjd_start[2], double step, long int n_epochs,
+                                                    short int target, short int center,
+                                                    double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT short int state (double *jed, short int target, double *target_pos, double *target_vel);
+
+LIBNOVASCPP_EXPORT short int ephem_nutation (double tjd[2], double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void interpolate (double *buf, double *t, long int ncm, long int na,
+                                     double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT void split (double tt, double *fr);
+
+LIBNOVASCPP_EXPORT short int ephem_open_r (char *ephem_name, short int mode, ephem_handle **eph,
+                                           double *jd_begin, double *jd_end, short int *de_number);
+
+LIBNOVASCPP_EXPORT short int ephem_reopen_r (ephem_handle *eph, ephem_handle **copy);
+
+LIBNOVASCPP_EXPORT short int ephem_close_r (ephem_handle *eph);
+
+LIBNOVASCPP_EXPORT short int ephem_advise_r (ephem_handle *eph, double jd_begin, double jd_end,
+                                             short int advice);
+
+LIBNOVASCPP_EXPORT short int planet_ephemeris_r (ephem_handle *eph, double tjd[2], short int target,
+                                                 short int center, double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT short int planet_ephemeris_multi_r (ephem_handle *eph, double tjd[2], short int n_bodies,
+                                                       short int *targets, short int center,
+                                                       double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT short int planet_ephemeris_batch_r (ephem_handle *eph, long int n_epochs,
+                                                       double *tjd_high, double *tjd_low,
+                                                       short int target, short int center,
+                                                       double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT short int planet_ephemeris_span_r (ephem_handle *eph, double tjd_start[2], double step,
+                                                      long int n_epochs, short int target,
+                                                      short int center, double *position,
+                                                      double *velocity);
+
+LIBNOVASCPP_EXPORT short int state_r (ephem_handle *eph, double *jed, short int target,
+                                      double *target_pos, double *target_vel);
+
+LIBNOVASCPP_EXPORT short int ephem_nutation_r (ephem_handle *eph, double tjd[2], double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void interpolate_r (ephem_handle *eph, double *buf, double *t, long int ncf,
+                                       long int na, double *position, double *velocity);
+
+LIBNOVASCPP_EXPORT short int ephem_set_cache (long int n_records);
+
+LIBNOVASCPP_EXPORT short int ephem_set_cache_r (ephem_handle *eph, long int n_records);
+
+LIBNOVASCPP_EXPORT void ephem_cache_stats (short int reset, unsigned long int *hits, unsigned long int *misses);
+
+LIBNOVASCPP_EXPORT void ephem_cache_stats_r (ephem_handle *eph, short int reset, unsigned long int *hits,
+                                             unsigned long int *misses);
+
+LIBNOVASCPP_EXPORT void ephem_set_kernels (short int enable);
+
+LIBNOVASCPP_EXPORT void ephem_set_kernels_r (ephem_handle *eph, short int enable);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
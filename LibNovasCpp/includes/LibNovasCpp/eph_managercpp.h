@@ -0,0 +1,161 @@
+/*
+  New file for work with the JPL ephemeris manager from C++.
+  Royal Observatory of the Spanish Navy.
+*/
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "eph_manager.h"
+
+namespace novas
+{
+
+// RAII owner of a re-entrant JPL ephemeris handle (see 'ephem_open_r' in eph_manager.h).
+// Each object owns its own header data and record buffer, so several ephemeris files (or several
+// copies of the same file) can be used at once, one object per thread. A single object must not be
+// used from two threads at the same time. The object is movable but not copyable.
+class Ephemeris
+{
+public:
+
+    Ephemeris() = default;
+
+    Ephemeris(const Ephemeris&) = delete;
+    Ephemeris& operator=(const Ephemeris&) = delete;
+
+    Ephemeris(Ephemeris&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    Ephemeris& operator=(Ephemeris&& other) noexcept
+    {
+        if (this != &other)
+        {
+            this->close();
+            this->handle_ = other.handle_;
+            this->jd_begin_ = other.jd_begin_;
+            this->jd_end_ = other.jd_end_;
+            this->de_number_ = other.de_number_;
+            other.handle_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~Ephemeris()
+    {
+        this->close();
+    }
+
+    // Opens the file, closing the previous one if any. Returns the 'ephem_open_r' error code.
+    short int open(const std::string& path, short int mode = EPH_MODE_READ)
+    {
+        this->close();
+        std::vector<char> name(path.c_str(), path.c_str() + path.size() + 1);
+        return ephem_open_r(name.data(), mode, &this->handle_, &this->jd_begin_, &this->jd_end_,
+                            &this->de_number_);
+    }
+
+    // Closes the file. Returns the 'ephem_close_r' error code.
+    short int close()
+    {
+        short int error = ephem_close_r(this->handle_);
+        this->handle_ = nullptr;
+        return error;
+    }
+
+    bool isOpen() const
+    {
+        return this->handle_ != nullptr;
+    }
+
+    // Position and velocity of 'target' with respect to 'center' (see 'planet_ephemeris').
+    short int planetEphemeris(double tjd[2], short int target, short int center,
+                              double* position, double* velocity)
+    {
+        return planet_ephemeris_r(this->handle_, tjd, target, center, position, velocity);
+    }
+
+    // Positions and velocities of several bodies at one epoch (see 'planet_ephemeris_multi'). The
+    // vector of target 'i' is at position[3 * i].
+    short int planetEphemerisMulti(double tjd[2], const std::vector<short int>& targets, short int center,
+                                   std::vector<double>& position, std::vector<double>& velocity)
+    {
+        position.resize(3 * targets.size());
+        velocity.resize(3 * targets.size());
+        return planet_ephemeris_multi_r(this->handle_, tjd, static_cast<short int>(targets.size()),
+                                        const_cast<short int*>(targets.data()), center,
+                                        position.data(), velocity.data());
+    }
+
+    // Positions and velocities at many epochs (see 'planet_ephemeris_batch'). The outputs are
+    // structures of arrays: the x components of all the epochs, then the y and the z components.
+    short int planetEphemerisBatch(const std::vector<double>& tjd_high, const std::vector<double>& tjd_low,
+                                   short int target, short int center,
+                                   std::vector<double>& position, std::vector<double>& velocity)
+    {
+        long int n = static_cast<long int>(tjd_high.size());
+        position.resize(3 * tjd_high.size());
+        velocity.resize(3 * tjd_high.size());
+        double* low = tjd_low.empty() ? nullptr : const_cast<double*>(tjd_low.data());
+        return planet_ephemeris_batch_r(this->handle_, n, const_cast<double*>(tjd_high.data()), low,
+                                        target, center, position.data(), velocity.data());
+    }
+
+    // Positions and velocities at equally spaced epochs (see 'planet_ephemeris_span').
+    short int planetEphemerisSpan(double tjd_start[2], double step, long int n_epochs, short int target,
+                                  short int center, std::vector<double>& position,
+                                  std::vector<double>& velocity)
+    {
+        position.resize(3 * static_cast<size_t>(n_epochs));
+        velocity.resize(3 * static_cast<size_t>(n_epochs));
+        return planet_ephemeris_span_r(this->handle_, tjd_start, step, n_epochs, target, center,
+                                       position.data(), velocity.data());
+    }
+
+    // Barycentric state of a body straight from the file (see 'state').
+    short int state(double* jed, short int target, double* target_pos, double* target_vel)
+    {
+        return state_r(this->handle_, jed, target, target_pos, target_vel);
+    }
+
+    // Access pattern hint for a memory-mapped file (see 'ephem_advise').
+    short int advise(double jd_begin, double jd_end, short int advice)
+    {
+        return ephem_advise_r(this->handle_, jd_begin, jd_end, advice);
+    }
+
+    // Capacity of the record cache, in records (see 'ephem_set_cache').
+    short int setCache(long int n_records)
+    {
+        return ephem_set_cache_r(this->handle_, n_records);
+    }
+
+    // Record cache hit and miss counters (see 'ephem_cache_stats').
+    void cacheStats(unsigned long int& hits, unsigned long int& misses, bool reset = false)
+    {
+        ephem_cache_stats_r(this->handle_, reset ? 1 : 0, &hits, &misses);
+    }
+
+    double jdBegin() const {return this->jd_begin_;}
+
+    double jdEnd() const {return this->jd_end_;}
+
+    short int deNumber() const {return this->de_number_;}
+
+    // Underlying handle, for the C functions with the '_r' suffix.
+    ephem_handle* handle() const {return this->handle_;}
+
+private:
+
+    ephem_handle* handle_ = nullptr;
+    double jd_begin_ = 0.0;
+    double jd_end_ = 0.0;
+    short int de_number_ = 0;
+};
+
+} // END NAMESPACE NOVAS.
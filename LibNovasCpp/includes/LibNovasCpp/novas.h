@@ -31,6 +31,8 @@ extern "C"
     #define SIZE_OF_CAT_NAME 4
     #define BARYC  0
     #define HELIOC 1
+    #define NUTATION_SERIES    0
+    #define NUTATION_EPHEMERIS 1
 
 // Structures
 
@@ -192,12 +194,105 @@ extern "C"
       double ra_cio;
    } ra_of_cio;
 
+/*
+   struct novas_frame: quantities of 'place' that depend only on the
+                       date, the observer, the output coordinate system
+                       and the accuracy (see 'make_frame').
+
+   jd_tdb             = TDB Julian date
+   coord_sys          = output coordinate system, as in 'place'
+   accuracy           = selection for accuracy, as in 'place'
+   loc                = 1 if the observer is not at the geocenter (the
+                        deflection by the Earth is included), 0
+                        otherwise
+   peb[3], veb[3]     = barycentric position (AU) and velocity (AU/day)
+                        of the Earth
+   psb[3]             = barycentric position of the Sun (AU)
+   pog[3]             = geocentric position of the observer (AU)
+   pob[3], vob[3]     = barycentric position (AU) and velocity (AU/day)
+                        of the observer
+   d_obs_geo          = distance observer-geocenter (AU)
+   d_obs_sun          = distance observer-Sun (AU)
+   nbodies            = number of deflecting bodies besides the Earth
+   body_num[3]        = body numbers of the deflecting bodies, as in
+                        'solarsystem'
+   pbody[3][3],
+   vbody[3][3]        = barycentric positions (AU) and velocities
+                        (AU/day) of the deflecting bodies
+   pbodyo[3][3]       = positions of the deflecting bodies with respect
+                        to the observer (AU)
+   rot[3][3]          = rotation from the GCRS (ICRS for coord_sys = 3)
+                        to the output system; row i gives component i
+*/
+   typedef struct
+   {
+      double jd_tdb;
+      short int coord_sys;
+      short int accuracy;
+      short int loc;
+      double peb[3];
+      double veb[3];
+      double psb[3];
+      double pog[3];
+      double pob[3];
+      double vob[3];
+      double d_obs_geo;
+      double d_obs_sun;
+      short int nbodies;
+      short int body_num[3];
+      double pbody[3][3];
+      double vbody[3][3];
+      double pbodyo[3][3];
+      double rot[3][3];
+   } novas_frame;
+
+/*
+   struct star_table: catalog data of many stars, one array per
+                      quantity (see 'frame_place_batch').  The arrays
+                      hold the members of 'cat_entry' of the same
+                      names, in the same units.
+
+   ra                 = ICRS right ascensions (hours)
+   dec                = ICRS declinations (degrees)
+   promora            = ICRS proper motions in right ascension
+                        (milliarcseconds/year)
+   promodec           = ICRS proper motions in declination
+                        (milliarcseconds/year)
+   parallax           = parallaxes (milliarcseconds)
+   radialvelocity     = radial velocities (km/s)
+*/
+   typedef struct
+   {
+      const double *ra;
+      const double *dec;
+      const double *promora;
+      const double *promodec;
+      const double *parallax;
+      const double *radialvelocity;
+   } star_table;
+
+/*
+   struct novas_context: values saved between calls by the NOVAS
+                         functions, and celestial pole offsets.  The
+                         members are private (see novas.c); a context
+                         is made with 'novas_context_create' and used
+                         with the functions with the '_ctx' suffix.
+*/
+   typedef struct novas_context novas_context;
+
+/*
+   struct ephem_handle: JPL ephemeris file (eph_manager.h).
+*/
+   struct ephem_handle;
+
 
 
 // Function prototypes
 
 LIBNOVASCPP_EXPORT double *readeph (int mp, char *name, double jd, int *err);
 
+LIBNOVASCPP_EXPORT int readeph_pv (int mp, char *name, double jd, double *pv);
+
 LIBNOVASCPP_EXPORT short int app_star (double jd_tt, cat_entry *star, short int accuracy, double *ra, double *dec);
 
 LIBNOVASCPP_EXPORT short int virtual_star (double jd_tt, cat_entry *star, short int accuracy,
@@ -264,6 +359,12 @@ LIBNOVASCPP_EXPORT short int cel2ter (double jd_ut_high, double jd_ut_low, doubl
                                       short int accuracy, short int option, double xp, double yp,
                                       double *vec1, double *vec2);
 
+LIBNOVASCPP_EXPORT short int ter2cel_matrix (double jd_ut_high, double jd_ut_low, double delta_t,
+                                             short int method, short int accuracy, short int option, double xp,
+                                             double yp, double mat[3][3]);
+
+LIBNOVASCPP_EXPORT void ter2cel_apply (double mat[3][3], short int direction, double *vec1, double *vec2);
+
 LIBNOVASCPP_EXPORT void spin (double angle, double *pos1, double *pos2);
 
 LIBNOVASCPP_EXPORT void wobble (double tjd, short int direction, double xp, double yp,
@@ -281,6 +382,14 @@ LIBNOVASCPP_EXPORT void e_tilt (double jd_tdb, short int accuracy,
 LIBNOVASCPP_EXPORT short int cel_pole (double tjd, short int type, double dpole1,
                        double dpole2);
 
+LIBNOVASCPP_EXPORT short int set_nutation_source (short int source);
+
+LIBNOVASCPP_EXPORT short int set_nutation_tolerance (double tolerance);
+
+LIBNOVASCPP_EXPORT short int get_nutation_source (void);
+
+LIBNOVASCPP_EXPORT double get_nutation_tolerance (void);
+
 LIBNOVASCPP_EXPORT double ee_ct (double jd_high, double jd_low, short int accuracy);
 
 LIBNOVASCPP_EXPORT void frame_tie (double *pos1, short int direction,
@@ -348,6 +457,28 @@ LIBNOVASCPP_EXPORT void fund_args (double t,
 
 LIBNOVASCPP_EXPORT double mean_obliq (double jd_tdb);
 
+LIBNOVASCPP_EXPORT short int nutation_angles_batch (long int n, const double *t,
+                       short int accuracy, short int n_threads,
+
+                       double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT short int e_tilt_batch (long int n, const double *jd_tdb,
+                       short int accuracy, short int n_threads,
+
+                       double *mobl, double *tobl, double *ee, double *dpsi,
+                       double *deps);
+
+LIBNOVASCPP_EXPORT short int ee_ct_batch (long int n, const double *jd_high,
+                       const double *jd_low, short int accuracy,
+                       short int n_threads,
+
+                       double *ee);
+
+LIBNOVASCPP_EXPORT short int mean_obliq_batch (long int n, const double *jd_tdb,
+                       short int n_threads,
+
+                       double *mobl);
+
 LIBNOVASCPP_EXPORT short int vector2radec (double *pos,
 
                            double *ra, double *dec);
@@ -428,6 +559,164 @@ LIBNOVASCPP_EXPORT void make_on_surface (double latitude, double longitude, doub
 
 LIBNOVASCPP_EXPORT void make_in_space (double sc_pos[3], double sc_vel[3], in_space *obs_space);
 
+LIBNOVASCPP_EXPORT short int make_frame (double jd_tt, double delta_t, observer *location, short int coord_sys,
+                                         short int accuracy, novas_frame *frame);
+
+LIBNOVASCPP_EXPORT void frame_place (novas_frame *frame, cat_entry *star, sky_pos *output);
+
+LIBNOVASCPP_EXPORT short int frame_place_batch (novas_frame *frame, long int n, star_table *stars,
+                                                short int n_threads, double *ra, double *dec, double *rv);
+
+LIBNOVASCPP_EXPORT short int app_star_batch (double jd_tt, long int n, star_table *stars, short int accuracy,
+                                             short int n_threads, double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int topo_star_batch (double jd_tt, double delta_t, long int n, star_table *stars,
+                                              on_surface *position, short int accuracy, short int n_threads,
+                                              double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int place_grid (long int n_targets, object *targets, long int n_epochs, double *jd_tt,
+                                         double *delta_t, long int n_stations, observer *stations,
+                                         short int coord_sys, short int accuracy, char *ephem_name,
+                                         short int n_threads, sky_pos *output, short int *errors);
+
+LIBNOVASCPP_EXPORT novas_context *novas_context_create (void);
+
+LIBNOVASCPP_EXPORT void novas_context_free (novas_context *ctx);
+
+LIBNOVASCPP_EXPORT short int novas_context_set_ephemeris (novas_context *ctx, struct ephem_handle *eph);
+
+LIBNOVASCPP_EXPORT short int app_star_ctx (novas_context *ctx, double jd_tt, cat_entry *star,
+                                           short int accuracy, double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int virtual_star_ctx (novas_context *ctx, double jd_tt, cat_entry *star,
+                                               short int accuracy, double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int astro_star_ctx (novas_context *ctx, double jd_tt, cat_entry *star,
+                                             short int accuracy, double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int app_planet_ctx (novas_context *ctx, double jd_tt, object *ss_body,
+                                             short int accuracy, double *ra, double *dec, double *dis);
+
+LIBNOVASCPP_EXPORT short int virtual_planet_ctx (novas_context *ctx, double jd_tt, object *ss_body,
+                                                 short int accuracy, double *ra, double *dec, double *dis);
+
+LIBNOVASCPP_EXPORT short int astro_planet_ctx (novas_context *ctx, double jd_tt, object *ss_body,
+                                               short int accuracy, double *ra, double *dec, double *dis);
+
+LIBNOVASCPP_EXPORT short int topo_star_ctx (novas_context *ctx, double jd_tt, double delta_t, cat_entry *star,
+                                            on_surface *position, short int accuracy, double *ra,
+                                            double *dec);
+
+LIBNOVASCPP_EXPORT short int local_star_ctx (novas_context *ctx, double jd_tt, double delta_t,
+                                             cat_entry *star, on_surface *position, short int accuracy,
+                                             double *ra, double *dec);
+
+LIBNOVASCPP_EXPORT short int topo_planet_ctx (novas_context *ctx, double jd_tt, object *ss_body,
+                                              double delta_t, on_surface *position, short int accuracy,
+                                              double *ra, double *dec, double *dis);
+
+LIBNOVASCPP_EXPORT short int local_planet_ctx (novas_context *ctx, double jd_tt, object *ss_body,
+                                               double delta_t, on_surface *position, short int accuracy,
+                                               double *ra, double *dec, double *dis);
+
+LIBNOVASCPP_EXPORT short int mean_star_ctx (novas_context *ctx, double jd_tt, double ra, double dec,
+                                            short int accuracy, double *ira, double *idec);
+
+LIBNOVASCPP_EXPORT short int place_ctx (novas_context *ctx, double jd_tt, object *cel_object,
+                                        observer *location, double delta_t, short int coord_sys,
+                                        short int accuracy, sky_pos *output);
+
+LIBNOVASCPP_EXPORT short int make_frame_ctx (novas_context *ctx, double jd_tt, double delta_t, observer *location,
+                                             short int coord_sys, short int accuracy, novas_frame *frame);
+
+LIBNOVASCPP_EXPORT short int equ2ecl_ctx (novas_context *ctx, double jd_tt, short int coord_sys,
+                                          short int accuracy, double ra, double dec, double *elon,
+                                          double *elat);
+
+LIBNOVASCPP_EXPORT short int equ2ecl_vec_ctx (novas_context *ctx, double jd_tt, short int coord_sys,
+                                              short int accuracy, double *pos1, double *pos2);
+
+LIBNOVASCPP_EXPORT short int ecl2equ_vec_ctx (novas_context *ctx, double jd_tt, short int coord_sys,
+                                              short int accuracy, double *pos1, double *pos2);
+
+LIBNOVASCPP_EXPORT void equ2hor_ctx (novas_context *ctx, double jd_ut1, double delta_t, short int accuracy,
+                                     double xp, double yp, on_surface *location, double ra, double dec,
+                                     short int ref_option, double *zd, double *az, double *rar, double *decr);
+
+LIBNOVASCPP_EXPORT short int gcrs2equ_ctx (novas_context *ctx, double jd_tt, short int coord_sys,
+                                           short int accuracy, double rag, double decg, double *ra,
+                                           double *dec);
+
+LIBNOVASCPP_EXPORT short int sidereal_time_ctx (novas_context *ctx, double jd_high, double jd_low,
+                                                double delta_t, short int gst_type, short int method,
+                                                short int accuracy, double *gst);
+
+LIBNOVASCPP_EXPORT short int ter2cel_ctx (novas_context *ctx, double jd_ut_high, double jd_ut_low,
+                                          double delta_t, short int method, short int accuracy,
+                                          short int option, double xp, double yp, double *vec1, double *vec2);
+
+LIBNOVASCPP_EXPORT short int cel2ter_ctx (novas_context *ctx, double jd_ut_high, double jd_ut_low,
+                                          double delta_t, short int method, short int accuracy,
+                                          short int option, double xp, double yp, double *vec1, double *vec2);
+
+LIBNOVASCPP_EXPORT short int ter2cel_matrix_ctx (novas_context *ctx, double jd_ut_high, double jd_ut_low,
+                                                 double delta_t, short int method, short int accuracy,
+                                                 short int option, double xp, double yp, double mat[3][3]);
+
+LIBNOVASCPP_EXPORT void spin_ctx (novas_context *ctx, double angle, double *pos1, double *pos2);
+
+LIBNOVASCPP_EXPORT void e_tilt_ctx (novas_context *ctx, double jd_tdb, short int accuracy, double *mobl,
+                                    double *tobl, double *ee, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT short int cel_pole_ctx (novas_context *ctx, double tjd, short int type, double dpole1,
+                                           double dpole2);
+
+LIBNOVASCPP_EXPORT void frame_tie_ctx (novas_context *ctx, double *pos1, short int direction, double *pos2);
+
+LIBNOVASCPP_EXPORT short int geo_posvel_ctx (novas_context *ctx, double jd_tt, double delta_t,
+                                             short int accuracy, observer *obs, double *pos, double *vel);
+
+LIBNOVASCPP_EXPORT short int light_time_ctx (novas_context *ctx, double jd_tdb, object *ss_object,
+                                             double pos_obs[3], double tlight0, short int accuracy,
+                                             double pos[3], double *tlight);
+
+LIBNOVASCPP_EXPORT short int grav_def_ctx (novas_context *ctx, double jd_tdb, short int loc_code,
+                                           short int accuracy, double *pos1, double *pos_obs, double *pos2);
+
+LIBNOVASCPP_EXPORT short int precession_ctx (novas_context *ctx, double jd_tdb1, double *pos1, double jd_tdb2,
+                                             double *pos2);
+
+LIBNOVASCPP_EXPORT void nutation_ctx (novas_context *ctx, double jd_tdb, short int direction,
+                                      short int accuracy, double *pos, double *pos2);
+
+LIBNOVASCPP_EXPORT void nutation_angles_ctx (novas_context *ctx, double t, short int accuracy, double *dpsi,
+                                             double *deps);
+
+LIBNOVASCPP_EXPORT short int cio_ra_ctx (novas_context *ctx, double jd_tt, short int accuracy,
+                                         double *ra_cio);
+
+LIBNOVASCPP_EXPORT short int cio_location_ctx (novas_context *ctx, double jd_tdb, short int accuracy,
+                                               double *ra_cio, short int *ref_sys);
+
+LIBNOVASCPP_EXPORT short int cio_basis_ctx (novas_context *ctx, double jd_tdb, double ra_cio,
+                                            short int ref_sys, short int accuracy, double *x, double *y,
+                                            double *z);
+
+LIBNOVASCPP_EXPORT short int cio_array_ctx (novas_context *ctx, double jd_tdb, long int n_pts,
+                                            ra_of_cio *cio);
+
+LIBNOVASCPP_EXPORT double ira_equinox_ctx (novas_context *ctx, double jd_tdb, short int equinox,
+                                           short int accuracy);
+
+LIBNOVASCPP_EXPORT short int ephemeris_ctx (novas_context *ctx, double jd[2], object *cel_obj,
+                                            short int origin, short int accuracy, double *pos, double *vel);
+
+LIBNOVASCPP_EXPORT void transform_hip_ctx (novas_context *ctx, cat_entry *hipparcos, cat_entry *hip_2000);
+
+LIBNOVASCPP_EXPORT short int transform_cat_ctx (novas_context *ctx, short int option, double date_incat,
+                                                cat_entry *incat, double date_newcat, char *newcat_id,
+                                                cat_entry *newcat);
+
 #ifdef __cplusplus
 }
 #endif
@@ -13,10 +13,74 @@
 #ifndef NUTATION_H
 #define NUTATION_H
 
-void iau2000a (double jd_high, double jd_low, double *dpsi, double *deps);
+#include "libnovascpp_global.h"
 
-void iau2000b (double jd_high, double jd_low, double *dpsi, double *deps);
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+   Evaluation kernels of the nutation series (see 'set_nutation_kernel').
+
+   NUTATION_KERNEL_SCALAR = term by term, with 'sin' and 'cos'.
+   NUTATION_KERNEL_VECTOR = structure-of-arrays tables and vectorized
+                            sine and cosine (nutation_fast.c).
+*/
+
+#define NUTATION_KERNEL_SCALAR 0
+#define NUTATION_KERNEL_VECTOR 1
+
+LIBNOVASCPP_EXPORT void iau2000a (double jd_high, double jd_low, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void iau2000b (double jd_high, double jd_low, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void nu2000k (double jd_high, double jd_low, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT short int set_nutation_kernel (short int kernel);
+
+LIBNOVASCPP_EXPORT short int get_nutation_kernel (void);
+
+LIBNOVASCPP_EXPORT void iau2000a_fast (double jd_high, double jd_low,
+                                   double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void iau2000b_fast (double jd_high, double jd_low,
+                                   double *dpsi, double *deps);
 
-void nu2000k (double jd_high, double jd_low, double *dpsi, double *deps);
+LIBNOVASCPP_EXPORT void nu2000k_fast (double jd_high, double jd_low,
+                                   double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void iau2000a_batch (long int n, double jd_high, const double *jd_low,
+                                        short int kernel, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void iau2000b_batch (long int n, double jd_high, const double *jd_low,
+                                        short int kernel, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void nu2000k_batch (long int n, double jd_high, const double *jd_low,
+                                       short int kernel, double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void iau2000a_trunc (double jd_high, double jd_low, double tolerance,
+                                        double *dpsi, double *deps);
+
+LIBNOVASCPP_EXPORT void sincos_array (long int n, const double *x, double *s, double *c);
+
+LIBNOVASCPP_EXPORT void mean_obliq_array (long int n, const double *jd_tdb, double *mobl);
+
+LIBNOVASCPP_EXPORT short int nutation_table_make (double jd_begin, double jd_end, short int accuracy,
+                                                  double tolerance, double *error);
+
+LIBNOVASCPP_EXPORT short int nutation_table_save (const char *file_name);
+
+LIBNOVASCPP_EXPORT short int nutation_table_load (const char *file_name);
+
+LIBNOVASCPP_EXPORT void nutation_table_free (void);
+
+LIBNOVASCPP_EXPORT short int nutation_table_eval (double jd_tdb, short int accuracy,
+                                                  double *dpsi, double *deps, double *mobl,
+                                                  double *c_terms);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
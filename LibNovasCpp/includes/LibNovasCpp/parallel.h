@@ -0,0 +1,49 @@
+/*
+   Naval Observatory Vector Astrometry Software (NOVAS)
+   C Edition, Version 3.1
+
+   parallel.h: Header file for parallel.cpp
+
+   Royal Observatory of the Spanish Navy
+*/
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "libnovascpp_global.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+   Work done on the items 'begin' to 'end' - 1 of a batch; 'arg' points
+   to the data of the batch.
+*/
+
+typedef void (*novas_range_fn) (long int begin, long int end, void *arg);
+
+/*
+   Task 'task' of a batch done by worker 'worker' (0 to the number of
+   workers - 1; a worker runs in one thread, so it can own state such as
+   a 'novas_context'); 'arg' points to the data of the batch.
+*/
+
+typedef void (*novas_task_fn) (long int task, short int worker, void *arg);
+
+LIBNOVASCPP_EXPORT short int novas_thread_count (short int n_threads, long int n);
+
+LIBNOVASCPP_EXPORT short int novas_worker_count (short int n_threads, long int n_tasks);
+
+LIBNOVASCPP_EXPORT void novas_parallel_for (long int n, short int n_threads,
+                                            novas_range_fn fn, void *arg);
+
+LIBNOVASCPP_EXPORT void novas_parallel_tasks (long int n_tasks, short int n_workers,
+                                              novas_task_fn fn, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
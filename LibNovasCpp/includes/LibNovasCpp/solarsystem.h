@@ -2,7 +2,8 @@
   Naval Observatory Vector Astrometry Software (NOVAS)
   C Edition, Version 3.1
 
-  solarsystem.h: Header file for solsys1.c, solsys2.c, & solsys3.c
+  solarsystem.h: Header file for solsys.c, solsys1.c, solsys2.c, &
+                 solsys3.c
 
   U. S. Naval Observatory
   Astronomical Applications Dept.
@@ -13,16 +14,120 @@
 #ifndef SOLARSYSTEM_H
 #define SOLARSYSTEM_H
 
+#include "libnovascpp_global.h"
+#include "eph_manager.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*
+   Solar system backends (see 'set_solsys_backend').
+
+   SOLSYS_JPL      = JPL binary ephemeris through eph_manager
+                     (solsys1.c).
+   SOLSYS_FORTRAN  = JPL Fortran software through jplint.f (solsys2.c);
+                     registered only when built with NOVAS_SOLSYS2.
+   SOLSYS_ANALYTIC = closed-form Sun-Earth theory, no file (solsys3.c).
+
+   Identifiers 4 to SOLSYS_MAX_BACKENDS - 1 are free for backends
+   registered with 'register_solsys_backend'.
+*/
+
+#define SOLSYS_JPL 1
+#define SOLSYS_FORTRAN 2
+#define SOLSYS_ANALYTIC 3
+#define SOLSYS_MAX_BACKENDS 8
+
+/*
+   Function of a backend: position and velocity of 'body' with respect
+   to 'origin' at the TDB Julian date tjd[0] + tjd[1], as
+   'solarsystem_hp'.  'state' is the state pointer of the backend.
+*/
+
+typedef short int (*solsys_function) (void *state, double tjd[2],
+                                      short int body, short int origin,
+                                      double *position, double *velocity);
+
+/*
+   struct solsys_backend: a solar system ephemeris.
+
+   name               = short description
+   low                = function used for reduced accuracy
+   high               = function used for full accuracy
+   state              = data passed to 'low' and 'high' (for example an
+                        'ephem_handle'), owned by the caller
+*/
+
+typedef struct
+{
+   const char *name;
+   solsys_function low;
+   solsys_function high;
+   void *state;
+} solsys_backend;
+
 /*
    Function prototypes
 */
 
-   short int solarsystem (double tjd, short int body, short int origin,
+   LIBNOVASCPP_EXPORT short int solarsystem (double tjd, short int body, short int origin,
 
                           double *position, double *velocity);
 
-   short int solarsystem_hp (double tjd[2], short body, short origin,
+   LIBNOVASCPP_EXPORT short int solarsystem_hp (double tjd[2], short body, short origin,
 
                              double *position, double *velocity);
 
+   LIBNOVASCPP_EXPORT short int solarsystem_backend (short int backend, short int accuracy,
+                                  double tjd[2], short int body, short int origin,
+
+                                  double *position, double *velocity);
+
+   LIBNOVASCPP_EXPORT short int register_solsys_backend (short int backend,
+                                      const solsys_backend *functions);
+
+   LIBNOVASCPP_EXPORT short int set_solsys_state (short int backend, void *state);
+
+   LIBNOVASCPP_EXPORT short int set_solsys_backend (short int accuracy, short int backend);
+
+   LIBNOVASCPP_EXPORT short int get_solsys_backend (short int accuracy);
+
+   LIBNOVASCPP_EXPORT short int solarsystem_jpl (double tjd, short int body, short int origin,
+
+                              double *position, double *velocity);
+
+   LIBNOVASCPP_EXPORT short int solarsystem_hp_jpl (ephem_handle *eph, double tjd[2],
+                                 short int body, short int origin,
+
+                                 double *position, double *velocity);
+
+   LIBNOVASCPP_EXPORT short int solarsystem_analytic (double tjd, short int body, short int origin,
+
+                                   double *position, double *velocity);
+
+   LIBNOVASCPP_EXPORT short int solarsystem_hp_analytic (double tjd[2], short int body,
+                                      short int origin,
+
+                                      double *position, double *velocity);
+
+   LIBNOVASCPP_EXPORT short int solarsystem_analytic_batch (long int n, const double *tjd,
+                                         short int body, short int origin,
+                                         short int n_threads,
+
+                                         double *position, double *velocity);
+
+   short int solarsystem_fortran (double tjd, short int body, short int origin,
+
+                                  double *position, double *velocity);
+
+   short int solarsystem_hp_fortran (double tjd[2], short int body, short int origin,
+
+                                     double *position, double *velocity);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
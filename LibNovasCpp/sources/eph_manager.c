@@ -12,9 +12,102 @@
 
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+   #include <windows.h>
+   #include <io.h>
+#else
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
 
 #include "eph_manager.h"
 
+/*
+   Type of the Chebyshev evaluators specialized for a fixed number of
+   coefficients (see 'chebyshev_N').
+*/
+
+typedef void (*chebyshev_kernel) (double *buf, double tc, double vfac,
+
+                                  double *position, double *velocity);
+
+/*
+   struct ephem_handle: state of one open JPL ephemeris file.  Each
+                        handle owns the header data of its file, its
+                        record buffer (or mapping) and the Chebyshev
+                        polynomial scratch arrays, so different handles
+                        can be used concurrently from different threads.
+
+   km                 = physical units of the output states (see notes
+                        of 'ephem_open_mode')
+   ipt, lpt           = coefficient pointers of the bodies, nutations
+                        and librations
+   nrl                = number of the record in memory (0 = none)
+   np, nv             = number of position and velocity polynomials
+                        already evaluated in 'pc' and 'vc'
+   record_length      = length of a record in memory, in bytes
+   file_record_length = length of a record on the file, in bytes; the
+                        same as 'record_length' except for compact
+                        files (see notes of 'ephem_open_mode')
+   ss                 = first and last Julian date of the file and
+                        length of the interval covered by a record
+   jplau              = astronomical unit in kilometers
+   pc, vc             = position and velocity Chebyshev polynomials
+   twot               = twice the last normalized Chebyshev time
+   em_ratio           = Earth-Moon mass ratio
+   kernel             = specialized Chebyshev evaluator of each body, or
+                        NULL for the generic one
+   buffer             = record in memory
+   ephfile            = ephemeris file
+   map, map_size      = base and size of the mapping in EPH_MODE_MMAP
+   cache_size         = capacity of the record cache, in records
+   cache_rec          = record number held by each cache slot (0 = none)
+   cache_used         = value of 'cache_clock' at the last use of each
+                        cache slot
+   cache              = the cache slots, 'cache_size' records
+   cache_clock        = number of record lookups, used to find the least
+                        recently used slot
+   cache_hits         = number of records found in memory
+   cache_misses       = number of records that had to be read
+   f32                = storage class of each double of a record of a
+                        compact file (0 = double, 1 = float, 2 = not
+                        stored), or NULL for the other files
+   f32_doubles        = number of doubles on a record of a compact file
+   raw                = record of a compact file as read, before it is
+                        expanded into the cache
+   name               = name of the file, to open it again (see
+                        'ephem_reopen_r')
+*/
+
+struct ephem_handle
+{
+   short int km;
+   int ipt[3][12], lpt[3];
+   long int nrl, np, nv;
+   long int record_length, file_record_length;
+   double ss[3], jplau, pc[18], vc[18], twot, em_ratio;
+   chebyshev_kernel kernel[11];
+   double *buffer;
+   FILE *ephfile;
+   double *map;
+   size_t map_size;
+#if defined(_WIN32)
+   HANDLE map_handle;
+#endif
+   long int cache_size;
+   long int *cache_rec;
+   unsigned long int *cache_used;
+   double *cache;
+   unsigned long int cache_clock, cache_hits, cache_misses;
+   unsigned char *f32;
+   long int f32_doubles;
+   double *raw;
+   char *name;
+};
+
 /*
    Define global variables
 */
@@ -35,6 +128,111 @@ double *BUFFER;
 
 FILE *EPHFILE = NULL;
 
+/*
+   'EPHMAP' is the base of the read-only mapping of the whole
+   ephemeris file when it was opened in EPH_MODE_MMAP, and NULL
+   otherwise.  'EPHMAP_SIZE' is the size of the mapping in bytes.
+*/
+
+double *EPHMAP = NULL;
+size_t EPHMAP_SIZE = 0;
+
+/*
+   'DEFAULT_EPH' is the handle used by the functions without the '_r'
+   suffix.  Its contents are mirrored in the global variables above
+   by 'publish_default'.
+*/
+
+static ephem_handle DEFAULT_EPH;
+
+/*
+   Number of epochs evaluated together by the batch functions.  The
+   scratch arrays of one block live on the stack.
+*/
+
+#define EPH_BATCH 128
+
+/*
+   Prototypes of the functions private to this file.
+*/
+
+static short int open_handle (ephem_handle *eph, char *ephem_name,
+                              short int mode,
+
+                              double *jd_begin, double *jd_end,
+                              short int *de_number);
+
+static short int close_handle (ephem_handle *eph);
+
+static void publish_default (void);
+
+static void chebyshev (double *buf, double *t, long int ncf, long int na,
+                       double *pc, double *vc, long int *np,
+                       long int *nv, double *twot,
+
+                       double *position, double *velocity);
+
+static chebyshev_kernel select_kernel (long int ncf);
+
+static long int series_end (int *pointer, long int n_components);
+
+static void interpolate_body (ephem_handle *eph, short int body, double *t,
+
+                              double *position, double *velocity);
+
+static short int alloc_cache (ephem_handle *eph);
+
+static void free_cache (ephem_handle *eph);
+
+static short int fetch_record (ephem_handle *eph, long int nr);
+
+static short int compact_layout (ephem_handle *eph, int xpt[2][3],
+                                 long int header_words);
+
+static void expand_record (ephem_handle *eph);
+
+static void free_compact (ephem_handle *eph);
+
+static void relative_state (ephem_handle *eph, short int target,
+                            short int center, double *target_bary_pos,
+                            double *target_bary_vel,
+                            double *center_bary_pos,
+                            double *center_bary_vel, double *pos_earth,
+                            double *vel_earth, double *pos_moon,
+                            double *vel_moon,
+
+                            double *position, double *velocity);
+
+static short int locate_epoch (ephem_handle *eph, double *jed,
+
+                               long int *nr, double *t);
+
+static short int load_record (ephem_handle *eph, long int nr);
+
+static short int state_block (ephem_handle *eph, long int n_epochs,
+                              double *jd_high, double *jd_low,
+                              short int target,
+
+                              double pos[3][EPH_BATCH],
+                              double vel[3][EPH_BATCH]);
+
+static void chebyshev_block (double *buf, long int ncf, long int na,
+                             double t1, long int first, long int last,
+                             double *t0,
+
+                             double pos[3][EPH_BATCH],
+                             double vel[3][EPH_BATCH]);
+
+static short int planet_block (ephem_handle *eph, long int n_epochs,
+                               double *jd_high, double *jd_low,
+                               short int target, short int center,
+                               long int stride,
+
+                               double *position, double *velocity);
+
+static short int map_ephemeris (ephem_handle *eph);
+
+static void unmap_ephemeris (ephem_handle *eph);
 /********ephem_open */
 
 short int ephem_open (char *ephem_name,
@@ -74,33 +272,119 @@ short int ephem_open (char *ephem_name,
           1   ...file does not exist/not found.
           2-10...error reading from file header.
           11  ...unable to set record length; ephemeris (DE number)
-                 not in look-up table.
+                 not in look-up table and no coefficient pointers
+                 in the header.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_open_mode   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/06-90/JAB (USNO/NA)
+      V1.1/06-92/JAB (USNO/AA): Restructure and add initializations.
+      V1.2/07-98/WTH (USNO/AA): Modified to open files for different
+                                ephemeris types. (200,403,404,405,406)
+      V1.3/11-07/WKP (USNO/AA): Updated prolog.
+      V1.4/09-10/WKP (USNO/AA): Changed ncon and denum variables and
+                                sizeof ipt array to type 'int' for
+                                64-bit system compatibility.
+      V1.5/09-10/WTH (USNO/AA): Added support for DE421, default case
+                                for switch, close file on error.
+      V1.6/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+      V1.7/10-26/ROA:           Now a wrapper of 'ephem_open_mode'.
+
+   NOTES:
+      1. The file is opened in mode EPH_MODE_READ, so records are read
+         into 'BUFFER' as needed.  Use function 'ephem_open_mode' to
+         memory-map the file instead.
+
+------------------------------------------------------------------------
+*/
+{
+   return ephem_open_mode (ephem_name, EPH_MODE_READ, jd_begin, jd_end,
+      de_number);
+}
+/********ephem_open_mode */
+
+short int ephem_open_mode (char *ephem_name, short int mode,
+
+                           double *jd_begin, double *jd_end,
+                           short int *de_number)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function opens a JPL planetary ephemeris file using the
+      requested access mode and sets initial values.  Either this
+      function or 'ephem_open' must be called prior to calls to the
+      other JPL ephemeris functions.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *ephem_name (char)
+         Name of the direct-access ephemeris file.
+      mode (short int)
+         File access mode.
+            = EPH_MODE_READ ... records are read with 'fread' into
+                                'BUFFER' whenever the requested epoch
+                                leaves the record in memory.
+            = EPH_MODE_MMAP ... the whole file is memory-mapped
+                                read-only and shared, and 'BUFFER'
+                                points directly into the mapping.
+
+   OUTPUT
+   ARGUMENTS:
+      *jd_begin (double)
+         Beginning Julian date of the ephemeris file.
+      *jd_end (double)
+         Ending Julian date of the ephemeris file.
+      *de_number (short int)
+         DE number of the ephemeris file opened.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0   ...file exists and is opened correctly.
+          1   ...file does not exist/not found.
+          2-10...error reading from file header.
+          11  ...unable to set record length; ephemeris (DE number)
+                 not in look-up table and no coefficient pointers
+                 in the header.
+          12  ...unable to memory-map the file.
+          13  ...invalid value of 'mode'.
+          14  ...unable to allocate the record cache or the buffers
+                 of a compact file.
 
    GLOBALS
    USED:
       SS                eph_manager.h
       JPLAU             eph_manager.h
-      PC                eph_manager.h
-      VC                eph_manager.h
-      TWOT              eph_manager.h
       EM_RATIO          eph_manager.h
       BUFFER            eph_manager.h
       IPT               eph_manager.h
       LPT               eph_manager.h
       NRL               eph_manager.h
       KM                eph_manager.h
-      NP                eph_manager.h
-      NV                eph_manager.h
       RECORD_LENGTH     eph_manager.h
       EPHFILE           eph_manager.h
+      EPHMAP            eph_manager.h
+      EPHMAP_SIZE       eph_manager.h
 
    FUNCTIONS
    CALLED:
-      fclose            stdio.h
-      free              stdlib.h
-      fopen             stdio.h
-      fread             stdio.h
-      calloc            stdlib.h
+      ephem_close       eph_manager.c
+      open_handle       eph_manager.c
+      publish_default   eph_manager.c
 
    VER./DATE/
    PROGRAMMER:
@@ -116,6 +400,13 @@ short int ephem_open (char *ephem_name,
                                 for switch, close file on error.
       V1.6/10-10/WKP (USNO/AA): Renamed function to lowercase to
                                 comply with coding standards.
+      V1.7/10-26/ROA:           Split out of 'ephem_open' and added the
+                                memory-mapped access mode.
+      V1.8/10-26/ROA:           Open the file through the default
+                                'ephem_handle'.
+      V1.9/10-26/ROA:           Accept files with fewer series and DE
+                                numbers not in the look-up table.
+      V2.0/10-26/ROA:           Accept compact files.
 
    NOTES:
       KM...flag defining physical units of the output states.
@@ -123,165 +414,4279 @@ short int ephem_open (char *ephem_name,
          = 0, AU and AU/day
       Default value is 0 (KM determines time unit for nutations.
                           Angle unit is always radians.)
+      In EPH_MODE_MMAP the mapping is shared, so several processes
+      using the same file share the same page-cache pages.  Records
+      are never copied and 'BUFFER' must be treated as read-only.
+      Use 'ephem_advise' to announce the time span about to be used.
+      The file is opened on the handle shared by all the functions
+      without the '_r' suffix; use 'ephem_open_r' to get a private
+      handle.
+      Compact files, written by 'Util_RefitEphemeris -f', are marked
+      by a constant named EPH_F32_NAME.  Their records keep the first
+      EPH_F32_LEADING coefficients of each component as doubles and
+      the others as floats; they are expanded into doubles when read,
+      so EPH_MODE_MMAP falls back to EPH_MODE_READ for them and
+      'RECORD_LENGTH' is the length of a record in memory.
 
 ------------------------------------------------------------------------
 */
 {
-   char ttl[252], cnam[2400];
-
-   short int i, j;
+   short int error;
 
-   int ncon, denum;
+   if ((mode != EPH_MODE_READ) && (mode != EPH_MODE_MMAP))
+      return 13;
 
    if (EPHFILE)
-   {
-      fclose (EPHFILE);
-      free (BUFFER);
-   }
+      ephem_close ();
+
+   error = open_handle (&DEFAULT_EPH, ephem_name, mode, jd_begin, jd_end,
+      de_number);
+   publish_default ();
+
+   return error;
+}
+
+/********ephem_open_r */
 
+short int ephem_open_r (char *ephem_name, short int mode,
+
+                        ephem_handle **eph, double *jd_begin,
+                        double *jd_end, short int *de_number)
 /*
-   Open file ephem_name.
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function opens a JPL planetary ephemeris file on a new,
+      private handle.  It is the re-entrant counterpart of function
+      'ephem_open_mode': any number of files (or the same file several
+      times) may be open at once, and each handle may be used from a
+      different thread.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *ephem_name (char)
+         Name of the direct-access ephemeris file.
+      mode (short int)
+         File access mode, EPH_MODE_READ or EPH_MODE_MMAP (see function
+         'ephem_open_mode').
+
+   OUTPUT
+   ARGUMENTS:
+      **eph (ephem_handle)
+         New handle of the open file, or NULL on error.  It must be
+         released with function 'ephem_close_r'.
+      *jd_begin (double)
+         Beginning Julian date of the ephemeris file.
+      *jd_end (double)
+         Ending Julian date of the ephemeris file.
+      *de_number (short int)
+         DE number of the ephemeris file opened.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0   ...file exists and is opened correctly.
+          1-14...see function 'ephem_open_mode'; 14 is also returned
+                 if the handle itself cannot be allocated.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      open_handle       eph_manager.c
+      calloc            stdlib.h
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. A handle is not itself thread-safe: a given handle must not be
+      used by two threads at the same time.
+
+------------------------------------------------------------------------
 */
+{
+   short int error;
+
+   *eph = NULL;
 
-   if ((EPHFILE = fopen (ephem_name, "rb")) == NULL)
+   if ((mode != EPH_MODE_READ) && (mode != EPH_MODE_MMAP))
+      return 13;
+
+   if ((*eph = (ephem_handle *) calloc (1, sizeof (ephem_handle))) == NULL)
+      return 14;
+
+   if ((error = open_handle (*eph, ephem_name, mode, jd_begin, jd_end,
+      de_number)) != 0)
    {
-      return 1;
+      free (*eph);
+      *eph = NULL;
    }
-    else
-   {
 
+   return error;
+}
+
+/********ephem_reopen_r */
+
+short int ephem_reopen_r (ephem_handle *eph,
+
+                          ephem_handle **copy)
 /*
-   File found. Set initializations and default values.
-*/
+------------------------------------------------------------------------
 
-      KM = 0;
+   PURPOSE:
+      This function opens the file of a handle again, on a new private
+      handle, so that another thread can read the same file.
 
-      NRL = 0;
+   REFERENCES:
+      None.
 
-      NP = 2;
-      NV = 3;
-      TWOT = 0.0;
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the file to open again, or NULL for the file opened
+         with 'ephem_open'.
 
-      for (i = 0; i < 18; i++)
-      {
-         PC[i] = 0.0;
-         VC[i] = 0.0;
-      }
+   OUTPUT
+   ARGUMENTS:
+      **copy (ephem_handle)
+         New handle of the file, or NULL on error.  It must be released
+         with function 'ephem_close_r'.
 
-      PC[0] = 1.0;
-      VC[1] = 1.0;
+   RETURNED
+   VALUE:
+      (short int)
+          0   ...file opened correctly.
+          1-14...see function 'ephem_open_r'; 14 is also returned if
+                 the name of the file was not kept.
+          15  ...no file is open on 'eph'.
 
-/*
-   Read in values from the first record, aka the header.
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_open_r      eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The new handle has the access mode of 'eph' (EPH_MODE_MMAP if
+      the file is mapped) and its own record cache.  'eph' itself is
+      only read, but must not be closed during the call.
+
+------------------------------------------------------------------------
 */
+{
+   short int de_number;
 
-      if (fread (ttl, sizeof ttl, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 2;
-      }
-      if (fread (cnam, sizeof cnam, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 3;
-      }
-      if (fread (SS, sizeof SS, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 4;
-      }
-      if (fread (&ncon, sizeof ncon, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 5;
-      }
-      if (fread (&JPLAU, sizeof JPLAU, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 6;
-      }
-      if (fread (&EM_RATIO, sizeof EM_RATIO, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 7;
-      }
-      for (i = 0; i < 12; i++)
-         for (j = 0; j < 3; j++)
-            if (fread (&IPT[j][i], sizeof(int), 1, EPHFILE) != 1)
-            {
-               fclose (EPHFILE);
-               return 8;
-            }
-      if (fread (&denum, sizeof denum, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 9;
-      }
-      if (fread (LPT, sizeof LPT, 1, EPHFILE) != 1)
-      {
-         fclose (EPHFILE);
-         return 10;
-      }
+   double jd_begin, jd_end;
 
-/*
-   Set the value of the record length according to what JPL ephemeris is
-   being opened.
+   *copy = NULL;
+
+   if (eph == NULL)
+      eph = &DEFAULT_EPH;
+
+   if (!eph->ephfile)
+      return 15;
+
+   if (eph->name == NULL)
+      return 14;
+
+   return ephem_open_r (eph->name, (eph->map != NULL) ? EPH_MODE_MMAP :
+      EPH_MODE_READ, copy, &jd_begin, &jd_end, &de_number);
+}
+
+/********ephem_close */
+
+short int ephem_close (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function closes a JPL planetary ephemeris file and frees the
+      memory.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0  ...file was already closed or closed correctly.
+          EOF...error closing file.
+
+   GLOBALS
+   USED:
+      BUFFER            eph_manager.h
+      EPHFILE           eph_manager.h
+      EPHMAP            eph_manager.h
+      NRL               eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      close_handle      eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/11-07/WKP (USNO/AA)
+      V1.1/09-10/WKP (USNO/AA): Explicitly cast fclose return value to
+                                type 'short int'.
+      V1.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+      V1.3/10-26/ROA:           Release the mapping of a memory-mapped
+                                file and reset 'EPHFILE'.
+      V1.4/10-26/ROA:           Close the file of the default
+                                'ephem_handle'.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   error = close_handle (&DEFAULT_EPH);
+   publish_default ();
+
+   return error;
+}
+
+/********ephem_close_r */
+
+short int ephem_close_r (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function closes the JPL planetary ephemeris file of a handle
+      opened with 'ephem_open_r' and frees the handle.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle to close.  May be NULL.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0  ...file was already closed or closed correctly.
+          EOF...error closing file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      close_handle      eph_manager.c
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   if (!eph)
+      return 0;
+
+   error = close_handle (eph);
+   free (eph);
+
+   return error;
+}
+
+/********ephem_advise */
+
+short int ephem_advise (double jd_begin, double jd_end, short int advice)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function passes an access pattern hint to the operating
+      system for the records of a memory-mapped ephemeris file that
+      cover a span of time, for example to prefetch the span about to
+      be used by a tracking session.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_begin (double)
+         Beginning TDB Julian date of the span.
+      jd_end (double)
+         Ending TDB Julian date of the span.
+      advice (short int)
+         Access pattern hint.
+            = EPH_ADVISE_WILLNEED   ... the span will be needed soon.
+            = EPH_ADVISE_SEQUENTIAL ... the span will be read in order.
+            = EPH_ADVISE_RANDOM     ... the span will be read randomly.
+            = EPH_ADVISE_DONTNEED   ... the span will not be needed.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...no ephemeris file is open in EPH_MODE_MMAP.
+         2...span does not overlap the span of the file.
+         3...invalid value of 'advice'.
+         4...hint rejected by the operating system.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_advise_r    eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The span is clipped to the span of the file and extended to
+         whole records and memory pages.
+      2. On Windows hints are accepted but ignored.
+      3. This function applies to the file opened with 'ephem_open' or
+         'ephem_open_mode'; see 'ephem_advise_r' for private handles.
+
+------------------------------------------------------------------------
+*/
+{
+   return ephem_advise_r (&DEFAULT_EPH, jd_begin, jd_end, advice);
+}
+
+/********ephem_advise_r */
+
+short int ephem_advise_r (ephem_handle *eph, double jd_begin,
+                          double jd_end, short int advice)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the re-entrant counterpart of 'ephem_advise'.
+      It passes an access pattern hint to the operating
+      system for the records of a memory-mapped ephemeris file that
+      cover a span of time, for example to prefetch the span about to
+      be used by a tracking session.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      jd_begin (double)
+         Beginning TDB Julian date of the span.
+      jd_end (double)
+         Ending TDB Julian date of the span.
+      advice (short int)
+         Access pattern hint.
+            = EPH_ADVISE_WILLNEED   ... the span will be needed soon.
+            = EPH_ADVISE_SEQUENTIAL ... the span will be read in order.
+            = EPH_ADVISE_RANDOM     ... the span will be read randomly.
+            = EPH_ADVISE_DONTNEED   ... the span will not be needed.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...no ephemeris file is open in EPH_MODE_MMAP.
+         2...span does not overlap the span of the file.
+         3...invalid value of 'advice'.
+         4...hint rejected by the operating system.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      madvise           sys/mman.h
+      sysconf           unistd.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The span is clipped to the span of the file and extended to
+         whole records and memory pages.
+      2. On Windows hints are accepted but ignored.
+
+------------------------------------------------------------------------
+*/
+{
+   long int rec_first, rec_last;
+
+   size_t page, offset_begin, offset_end;
+
+   if (!eph->map)
+      return 1;
+
+   if ((advice < EPH_ADVISE_WILLNEED) || (advice > EPH_ADVISE_DONTNEED))
+      return 3;
+
+   if ((jd_end < eph->ss[0]) || (jd_begin > eph->ss[1]) || (jd_begin > jd_end))
+      return 2;
+
+/*
+   Find the first and last records covering the span (record 1 is the
+   header and record 2 holds the constants).
+*/
+
+   if (jd_begin < eph->ss[0])
+      jd_begin = eph->ss[0];
+   if (jd_end > eph->ss[1])
+      jd_end = eph->ss[1];
+
+   rec_first = (long int) ((jd_begin - eph->ss[0]) / eph->ss[2]) + 3;
+   rec_last = (long int) ((jd_end - eph->ss[0]) / eph->ss[2]) + 3;
+
+   offset_begin = (size_t) (rec_first - 1) * (size_t) eph->record_length;
+   offset_end = (size_t) rec_last * (size_t) eph->record_length;
+   if (offset_end > eph->map_size)
+      offset_end = eph->map_size;
+   if (offset_begin >= offset_end)
+      return 2;
+
+#if defined(_WIN32)
+
+/*
+   Windows has no equivalent of these hints; accept and ignore them.
+*/
+
+   (void) page;
+   return 0;
+
+#else
+
+/*
+   Align the beginning of the region to a page boundary.
+*/
+
+   page = (size_t) sysconf (_SC_PAGESIZE);
+   offset_begin -= offset_begin % page;
+
+   switch (advice)
+   {
+      case EPH_ADVISE_WILLNEED:
+         advice = MADV_WILLNEED;
+         break;
+      case EPH_ADVISE_SEQUENTIAL:
+         advice = MADV_SEQUENTIAL;
+         break;
+      case EPH_ADVISE_RANDOM:
+         advice = MADV_RANDOM;
+         break;
+      default:
+         advice = MADV_DONTNEED;
+   }
+
+   if (madvise ((char *) eph->map + offset_begin, offset_end - offset_begin,
+      advice) != 0)
+      return 4;
+
+   return 0;
+
+#endif
+}
+
+/********planet_ephemeris */
+
+short int planet_ephemeris (double tjd[2], short int target,
+                            short int center,
+
+                            double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function accesses the JPL planetary ephemeris to give the
+      position and velocity of the target object with respect to the
+      center object.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      tjd[2] (double)
+         Two-element array containing the Julian date, which may be
+         split any way (although the first element is usually the
+         "integer" part, and the second element is the "fractional"
+         part).  Julian date is in the TDB or "T_eph" time scale.
+      target (short int)
+         Number of 'target' point.
+      center (short int)
+         Number of 'center' (origin) point.
+         The numbering convention for 'target' and'center' is:
+            0 = Mercury           7 = Neptune
+            1 = Venus             8 = Pluto
+            2 = Earth             9 = Moon
+            3 = Mars             10 = Sun
+            4 = Jupiter          11 = Solar system bary.
+            5 = Saturn           12 = Earth-Moon bary.
+            6 = Uranus
+            (Nutations are given by 'ephem_nutation'.)
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position vector array of target relative to center, measured
+         in AU.
+      *velocity (double)
+         Velocity vector array of target relative to center, measured
+         in AU/day, or NULL if only the position is wanted.  The
+         derivative polynomials are then not evaluated.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from State.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      planet_ephemeris_r eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
+      V1.1/07-93/WTH (USNO/AA): Update to C standards.
+      V2.0/07-98/WTH (USNO/AA): Modified for ease of use and linearity.
+      V3.0/11-06/JAB (USNO/AA): Allowed for use of input 'split' Julian
+                                date for higher precision.
+      V3.1/11-07/WKP (USNO/AA): Updated prolog and error codes.
+      V3.1/12-07/WKP (USNO/AA): Removed unreferenced variables.
+      V3.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+      V3.3/10-26/ROA:           Use the default 'ephem_handle'.
+      V3.4/10-26/ROA:           Position only if 'velocity' is NULL.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   DEFAULT_EPH.km = KM;
+   error = planet_ephemeris_r (&DEFAULT_EPH, tjd, target, center, position,
+      velocity);
+   publish_default ();
+
+   return error;
+}
+
+/********planet_ephemeris_r */
+
+short int planet_ephemeris_r (ephem_handle *eph, double tjd[2],
+                              short int target, short int center,
+
+                              double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the re-entrant counterpart of function
+      'planet_ephemeris'.  It accesses the JPL planetary ephemeris
+      open on handle 'eph' to give the
+      position and velocity of the target object with respect to the
+      center object.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      tjd[2] (double)
+         Two-element array containing the Julian date, which may be
+         split any way (although the first element is usually the
+         "integer" part, and the second element is the "fractional"
+         part).  Julian date is in the TDB or "T_eph" time scale.
+      target (short int)
+         Number of 'target' point.
+      center (short int)
+         Number of 'center' (origin) point.
+         The numbering convention for 'target' and'center' is:
+            0 = Mercury           7 = Neptune
+            1 = Venus             8 = Pluto
+            2 = Earth             9 = Moon
+            3 = Mars             10 = Sun
+            4 = Jupiter          11 = Solar system bary.
+            5 = Saturn           12 = Earth-Moon bary.
+            6 = Uranus
+            (Nutations are given by 'ephem_nutation'.)
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position vector array of target relative to center, measured
+         in AU.
+      *velocity (double)
+         Velocity vector array of target relative to center, measured
+         in AU/day, or NULL if only the position is wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from State.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      state_r           eph_manager.c
+      relative_state    eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Re-entrant version of
+                                \'planet_ephemeris\' V3.2.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, error = 0, earth = 2, moon = 9;
+   short int do_earth = 0, do_moon = 0;
+
+   double jed[2];
+   double pos_moon[3] = {0.0,0.0,0.0}, vel_moon[3] = {0.0,0.0,0.0},
+          pos_earth[3] = {0.0,0.0,0.0}, vel_earth[3] = {0.0,0.0,0.0};
+   double target_pos[3] = {0.0,0.0,0.0}, target_vel[3] = {0.0,0.0,0.0},
+          center_pos[3] = {0.0,0.0,0.0}, center_vel[3] = {0.0,0.0,0.0};
+
+/*
+   Check the body numbers before they index the pointer tables.
+*/
+
+   if ((target < 0) || (target > 12) || (center < 0) || (center > 12))
+      return 3;
+
+/*
+   Initialize 'jed' for 'state' and set up component count.
+*/
+
+   jed[0] = tjd[0];
+   jed[1] = tjd[1];
+
+/*
+   Check for target point = center point.
+*/
+
+   if (target == center)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         position[i] = 0.0;
+         if (velocity)
+            velocity[i] = 0.0;
+      }
+      return 0;
+   }
+
+/*
+   Check for instances of target or center being Earth or Moon,
+   and for target or center being the Earth-Moon barycenter.
+*/
+
+   if ((target == earth) || (center == earth))
+      do_moon = 1;
+   if ((target == moon) || (center == moon))
+      do_earth = 1;
+   if ((target == 12) || (center == 12))
+      do_earth = 1;
+
+   if (do_earth)
+   {
+      error = state_r (eph, jed,2, pos_earth,
+         velocity ? vel_earth : NULL);
+      if (error)
+         return error;
+   }
+
+   if (do_moon)
+   {
+      error = state_r (eph, jed,9, pos_moon,
+         velocity ? vel_moon : NULL);
+      if (error)
+         return error;
+   }
+
+/*
+   Make call to State for target object.
+*/
+
+   if (target == 11)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         target_pos[i] = 0.0;
+         target_vel[i] = 0.0;
+      }
+   }
+    else if (target == 12)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         target_pos[i] = pos_earth[i];
+         target_vel[i] = vel_earth[i];
+      }
+   }
+    else
+      error = state_r (eph, jed,target, target_pos,
+         velocity ? target_vel : NULL);
+
+   if (error)
+      return error;
+
+/*
+   Make call to State for center object.
+*/
+
+/*
+   If the requested center is the Solar System barycenter,
+   then don't bother with a second call to State.
+*/
+
+   if (center == 11)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         center_pos[i] = 0.0;
+         center_vel[i] = 0.0;
+      }
+   }
+
+/*
+   Center is Earth-Moon barycenter, which was already computed above.
+*/
+
+    else if (center == 12)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         center_pos[i] = pos_earth[i];
+         center_vel[i] = vel_earth[i];
+      }
+   }
+    else
+      error = state_r (eph, jed,center, center_pos,
+         velocity ? center_vel : NULL);
+
+   if (error)
+      return error;
+
+   relative_state (eph, target, center, target_pos, target_vel, center_pos,
+      center_vel, pos_earth, vel_earth, pos_moon, vel_moon, position,
+      velocity);
+
+   return 0;
+}
+
+/********state */
+
+short int state (double *jed, short int target,
+
+                 double *target_pos, double *target_vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function reads and interpolates the JPL planetary
+      ephemeris file.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *jed (double)
+         2-element Julian date (TDB) at which interpolation is wanted.
+         Any combination of jed[0]+jed[1] which falls within the time
+         span on the file is a permissible epoch.  See Note 1 below.
+      target (short int)
+         The requested body to get data for from the ephemeris file.
+         The designation of the astronomical bodies is:
+                 0 = Mercury                    6 = Uranus
+                 1 = Venus                      7 = Neptune
+                 2 = Earth-Moon barycenter      8 = Pluto
+                 3 = Mars                       9 = geocentric Moon
+                 4 = Jupiter                   10 = Sun
+                 5 = Saturn
+
+   OUTPUT
+   ARGUMENTS:
+      *target_pos (double)
+         The barycentric position vector array of the requested object,
+         in AU.
+         (If target object is the Moon, then the vector is geocentric.)
+      *target_vel (double)
+         The barycentric velocity vector array of the requested object,
+         in AU/Day, or NULL if only the position is wanted.
+
+         Both vectors are referenced to the Earth mean equator and
+         equinox of epoch.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...error reading ephemeris file.
+         2...epoch out of range.
+         3...invalid value of 'target', or requested body not on the
+             file.
+
+   GLOBALS
+   USED:
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      state_r           eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
+      V1.1/07-93/WTH (USNO/AA): Update to C standards.
+      V2.0/07-98/WTH (USNO/AA): Modify to make position and velocity
+                                two distinct vector arrays.  Routine set
+                                to compute one state per call.
+      V2.1/11-07/WKP (USNO/AA): Updated prolog.
+      V2.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+      V2.3/10-26/ROA:           Read records straight from the mapping
+                                of a memory-mapped file.
+      V2.4/10-26/ROA:           Use the default 'ephem_handle'.
+      V2.5/10-26/ROA:           Position only if 'target_vel' is NULL.
+
+   NOTES:
+      1. For ease in programming, the user may put the entire epoch in
+         jed[0] and set jed[1] = 0. For maximum interpolation accuracy,
+         set jed[0] = the most recent midnight at or before
+         interpolation epoch, and set jed[1] = fractional part of a day
+         elapsed between jed[0] and epoch. As an alternative, it may
+         prove convenient to set jed[0] = some fixed epoch, such as
+         start of the integration and jed[1] = elapsed interval between
+         then and epoch.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   DEFAULT_EPH.km = KM;
+   error = state_r (&DEFAULT_EPH, jed, target, target_pos, target_vel);
+   publish_default ();
+
+   return error;
+}
+
+/********state_r */
+
+short int state_r (ephem_handle *eph, double *jed, short int target,
+
+                   double *target_pos, double *target_vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the re-entrant counterpart of function 'state'.
+      It reads and interpolates the JPL planetary ephemeris file open
+      on handle 'eph'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      *jed (double)
+         2-element Julian date (TDB) at which interpolation is wanted.
+         Any combination of jed[0]+jed[1] which falls within the time
+         span on the file is a permissible epoch.  See Note 1 below.
+      target (short int)
+         The requested body to get data for from the ephemeris file.
+         The designation of the astronomical bodies is:
+                 0 = Mercury                    6 = Uranus
+                 1 = Venus                      7 = Neptune
+                 2 = Earth-Moon barycenter      8 = Pluto
+                 3 = Mars                       9 = geocentric Moon
+                 4 = Jupiter                   10 = Sun
+                 5 = Saturn
+
+   OUTPUT
+   ARGUMENTS:
+      *target_pos (double)
+         The barycentric position vector array of the requested object,
+         in AU.
+         (If target object is the Moon, then the vector is geocentric.)
+      *target_vel (double)
+         The barycentric velocity vector array of the requested object,
+         in AU/Day, or NULL if only the position is wanted.
+
+         Both vectors are referenced to the Earth mean equator and
+         equinox of epoch.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...error reading ephemeris file.
+         2...epoch out of range.
+         3...invalid value of 'target', or requested body not on the
+             file (see 'Util_SubsetEphemeris').
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      locate_epoch      eph_manager.c
+      load_record       eph_manager.c
+      interpolate_body  eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Re-entrant version of 'state' V2.3.
+      V1.1/10-26/ROA:           Return error 3 for bodies left out of a
+                                reduced file.
+
+   NOTES:
+      1. For ease in programming, the user may put the entire epoch in
+         jed[0] and set jed[1] = 0. For maximum interpolation accuracy,
+         set jed[0] = the most recent midnight at or before
+         interpolation epoch, and set jed[1] = fractional part of a day
+         elapsed between jed[0] and epoch. As an alternative, it may
+         prove convenient to set jed[0] = some fixed epoch, such as
+         start of the integration and jed[1] = elapsed interval between
+         then and epoch.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, error;
+
+   long int nr;
+
+   double t[2], aufac = 1.0;
+
+/*
+   Check the body number before it indexes the pointer tables.
+*/
+
+   if ((target < 0) || (target > 10))
+      return 3;
+
+/*
+   Set units based on value of the 'km' flag.
+*/
+
+   if (eph->km)
+      t[1] = eph->ss[2] * 86400.0;
+    else
+   {
+      t[1] = eph->ss[2];
+      aufac = 1.0 / eph->jplau;
+   }
+
+/*
+   Check epoch, and calculate record number and relative time interval.
+*/
+
+   if ((error = locate_epoch (eph, jed, &nr, &t[0])) != 0)
+      return error;
+
+   if (eph->ipt[1][target] == 0)
+      return 3;
+
+/*
+   Read correct record if it is not already in memory.
+*/
+
+   if ((error = load_record (eph, nr)) != 0)
+      return error;
+
+/*
+   Check and interpolate for requested body.
+*/
+
+   interpolate_body (eph, target, t, target_pos, target_vel);
+
+   for (i = 0; i < 3; i++)
+      target_pos[i] *= aufac;
+   if (target_vel)
+      for (i = 0; i < 3; i++)
+         target_vel[i] *= aufac;
+
+   return 0;
+}
+
+/********ephem_nutation */
+
+short int ephem_nutation (double tjd[2],
+
+                          double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function interpolates the nutation angles stored in the JPL
+      planetary ephemeris file opened by 'ephem_open'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      tjd[2] (double)
+         2-element Julian date (TDB), split as for 'state'.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation in longitude, in radians.
+      *deps (double)
+         Nutation in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...no file open, or error reading ephemeris file.
+         2...epoch out of range.
+         3...no nutations on the file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_nutation_r  eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   error = ephem_nutation_r (&DEFAULT_EPH, tjd, dpsi, deps);
+   publish_default ();
+
+   return error;
+}
+
+/********ephem_nutation_r */
+
+short int ephem_nutation_r (ephem_handle *eph, double tjd[2],
+
+                            double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the re-entrant counterpart of function
+      'ephem_nutation'.  It interpolates the nutation angles stored in
+      the JPL planetary ephemeris file open on handle 'eph'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      tjd[2] (double)
+         2-element Julian date (TDB), split as for 'state'.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation in longitude, in radians.
+      *deps (double)
+         Nutation in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...no file open, or error reading ephemeris file.
+         2...epoch out of range.
+         3...no nutations on the file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      locate_epoch      eph_manager.c
+      load_record       eph_manager.c
+      fmod              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The series is the 12th entry of the coefficient pointers, with
+      two components per sub-interval.  The DE4xx files carry the IAU
+      1980 nutation model, which differs from IAU 2000A by up to a few
+      tens of milliarcseconds.
+      2. The angles are independent of the 'km' units flag.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   long int i, j, l, nr, ncf, na;
+
+   double t, tc, twot, dna, dt1, temp, pc[18], *buf, angle[2];
+
+   if (!eph->ephfile)
+      return 1;
+
+   ncf = eph->ipt[1][11];
+   na = eph->ipt[2][11];
+   if ((ncf < 1) || (ncf > 18) || (na < 1))
+      return 3;
+
+/*
+   Check epoch, and read the record if it is not already in memory.
+*/
+
+   if ((error = locate_epoch (eph, tjd, &nr, &t)) != 0)
+      return error;
+
+   if ((error = load_record (eph, nr)) != 0)
+      return error;
+
+/*
+   Find the sub-interval and the normalized Chebyshev time as in
+   'chebyshev', and sum the two components.
+*/
+
+   dna = (double) na;
+   dt1 = (double) ((long int) t);
+   temp = dna * t;
+   l = (long int) (temp - dt1);
+   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+
+   pc[0] = 1.0;
+   pc[1] = tc;
+   twot = tc + tc;
+   for (j = 2; j < ncf; j++)
+      pc[j] = twot * pc[j-1] - pc[j-2];
+
+   buf = &eph->buffer[eph->ipt[0][11] - 1 + l * (2 * ncf)];
+   for (i = 0; i < 2; i++)
+   {
+      angle[i] = 0.0;
+      for (j = ncf - 1; j >= 0; j--)
+         angle[i] += pc[j] * buf[j + i * ncf];
+   }
+
+   *dpsi = angle[0];
+   *deps = angle[1];
+
+   return 0;
+}
+
+/********interpolate */
+
+void interpolate (double *buf, double *t, long int ncf, long int na,
+
+                  double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function differentiates and interpolates a set of
+      Chebyshev coefficients to give position and velocity.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *buf (double)
+         Array of Chebyshev coefficients of position.
+      *t (double)
+         t[0] is fractional time interval covered by coefficients at
+         which interpolation is desired (0 <= t[0] <= 1).
+         t[1] is length of whole interval in input time units.
+      ncf (long int)
+         Number of coefficients per component.
+      na (long int)
+         Number of sets of coefficients in full array
+         (i.e., number of sub-intervals in full interval).
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position array of requested object.
+      *velocity (double)
+         Velocity array of requested object, or NULL if only the
+         position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      NP                eph_manager.h
+      NV                eph_manager.h
+      PC                eph_manager.h
+      VC                eph_manager.h
+      TWOT              eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      chebyshev         eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
+      V1.1/07-93/WTH (USNO/AA): Update to C standards.
+      V1.2/07-98/WTH (USNO/AA): Modify to make position and velocity
+                                two distinct vector arrays.
+      V1.3/11-07/WKP (USNO/AA): Updated prolog.
+      V1.4/12-07/WKP (USNO/AA): Changed ncf and na arguments from short
+                                int to long int.
+      V1.5/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+      V1.6/10-26/ROA:           Moved the evaluation to 'chebyshev'.
+      V1.7/10-26/ROA:           Position only if 'velocity' is NULL.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   chebyshev (buf, t, ncf, na, PC, VC, &NP, &NV, &TWOT, position,
+      velocity);
+
+   return;
+}
+
+/********interpolate_r */
+
+void interpolate_r (ephem_handle *eph, double *buf, double *t,
+                    long int ncf, long int na,
+
+                    double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the re-entrant counterpart of function
+      'interpolate'.  It differentiates and interpolates a set of
+      Chebyshev coefficients to give position and velocity, using the
+      polynomial arrays of handle 'eph'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle whose polynomial arrays are used.
+      *buf (double)
+         Array of Chebyshev coefficients of position.
+      *t (double)
+         t[0] is fractional time interval covered by coefficients at
+         which interpolation is desired (0 <= t[0] <= 1).
+         t[1] is length of whole interval in input time units.
+      ncf (long int)
+         Number of coefficients per component.
+      na (long int)
+         Number of sets of coefficients in full array
+         (i.e., number of sub-intervals in full interval).
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position array of requested object.
+      *velocity (double)
+         Velocity array of requested object, or NULL if only the
+         position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      chebyshev         eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Re-entrant version of 'interpolate'
+                                V1.5.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   chebyshev (buf, t, ncf, na, eph->pc, eph->vc, &eph->np, &eph->nv,
+      &eph->twot, position, velocity);
+
+   return;
+}
+
+/********ephem_set_cache */
+
+short int ephem_set_cache (long int n_records)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sets the number of decoded records of the
+      ephemeris file kept in memory by the functions without the '_r'
+      suffix.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      n_records (long int)
+         Capacity of the record cache, in records (1 = only the last
+         record used, the classic behavior).
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...invalid value of 'n_records'.
+         2...unable to allocate the record cache; the file is closed.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_set_cache_r eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See function 'ephem_set_cache_r'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   error = ephem_set_cache_r (&DEFAULT_EPH, n_records);
+   publish_default ();
+
+   return error;
+}
+
+/********ephem_set_cache_r */
+
+short int ephem_set_cache_r (ephem_handle *eph, long int n_records)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sets the number of decoded records of the
+      ephemeris file kept in memory by a handle.  Workloads that
+      alternate between epochs in a few different records (e.g. two
+      dates of 'transform_cat', light-time iterations near a record
+      boundary, or schedules interleaving different nights) find those
+      records in memory instead of reading them again.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file.
+      n_records (long int)
+         Capacity of the record cache, in records (1 = only the last
+         record used, the classic behavior).
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...invalid value of 'n_records'.
+         2...unable to allocate the record cache; the file is closed.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      free_cache        eph_manager.c
+      alloc_cache       eph_manager.c
+      close_handle      eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The contents of the cache and the hit/miss counters are reset.
+      2. The least recently used record is replaced when the cache is
+      full.
+      3. Files opened in EPH_MODE_MMAP do not use the cache; the new
+      capacity applies when a file is next opened in EPH_MODE_READ.
+
+------------------------------------------------------------------------
+*/
+{
+   if (n_records < 1)
+      return 1;
+
+   eph->cache_size = n_records;
+   eph->cache_hits = eph->cache_misses = 0;
+
+   if (eph->ephfile && !eph->map)
+   {
+      free_cache (eph);
+      eph->nrl = 0;
+      eph->buffer = NULL;
+      if (alloc_cache (eph))
+      {
+         close_handle (eph);
+         return 2;
+      }
+   }
+
+   return 0;
+}
+
+/********ephem_cache_stats */
+
+void ephem_cache_stats (short int reset,
+
+                        unsigned long int *hits,
+                        unsigned long int *misses)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the record cache counters of the functions
+      without the '_r' suffix.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      reset (short int)
+         If nonzero, the counters are set to zero after being read.
+
+   OUTPUT
+   ARGUMENTS:
+      *hits (unsigned long int)
+         Number of requests whose record was already in memory.
+      *misses (unsigned long int)
+         Number of requests whose record had to be read.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_cache_stats_r eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See function 'ephem_cache_stats_r'.
+
+------------------------------------------------------------------------
+*/
+{
+   ephem_cache_stats_r (&DEFAULT_EPH, reset, hits, misses);
+
+   return;
+}
+
+/********ephem_cache_stats_r */
+
+void ephem_cache_stats_r (ephem_handle *eph, short int reset,
+
+                          unsigned long int *hits,
+                          unsigned long int *misses)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the record cache counters of a handle.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file.
+      reset (short int)
+         If nonzero, the counters are set to zero after being read.
+
+   OUTPUT
+   ARGUMENTS:
+      *hits (unsigned long int)
+         Number of requests whose record was already in memory.
+      *misses (unsigned long int)
+         Number of requests whose record had to be read.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Every call to 'state_r' (directly or through
+      'planet_ephemeris_r') counts as one request.
+      2. In EPH_MODE_MMAP nothing is read, but every change of record
+      counts as a miss.
+
+------------------------------------------------------------------------
+*/
+{
+   *hits = eph->cache_hits;
+   *misses = eph->cache_misses;
+
+   if (reset)
+      eph->cache_hits = eph->cache_misses = 0;
+
+   return;
+}
+
+/********ephem_set_kernels */
+
+void ephem_set_kernels (short int enable)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function turns the specialized Chebyshev kernels of the
+      default ephemeris on or off.  The reentrant version is the
+      function with the '_r' suffix.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      enable (short int)
+         If nonzero, the specialized kernels are used; otherwise every
+         body is evaluated with the generic 'chebyshev'.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephem_set_kernels_r eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See function 'ephem_set_kernels_r'.
+
+------------------------------------------------------------------------
+*/
+{
+   ephem_set_kernels_r (&DEFAULT_EPH, enable);
+
+   return;
+}
+
+/********ephem_set_kernels_r */
+
+void ephem_set_kernels_r (ephem_handle *eph, short int enable)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function turns the specialized Chebyshev kernels of a handle
+      on or off.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file.
+      enable (short int)
+         If nonzero, the specialized kernels are used; otherwise every
+         body is evaluated with the generic 'chebyshev'.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      select_kernel     eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The kernels are on after 'ephem_open_r'.  Both paths give the
+      same results; turning the kernels off is only meant for timing
+      them against the generic evaluator (see 'Util_BenchEphemeris').
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   for (i = 0; i < 11; i++)
+      eph->kernel[i] = enable ? select_kernel (eph->ipt[1][i]) : NULL;
+
+   return;
+}
+
+/********planet_ephemeris_multi */
+
+short int planet_ephemeris_multi (double tjd[2], short int n_bodies,
+                                  short int *targets, short int center,
+
+                                  double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the several-bodies version of
+      'planet_ephemeris' for the file opened with 'ephem_open' or
+      'ephem_open_mode'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_multi_r'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_multi_r'.
+
+   RETURNED
+   VALUE:
+      See function 'planet_ephemeris_multi_r'.
+
+   GLOBALS
+   USED:
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      planet_ephemeris_multi_r eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   DEFAULT_EPH.km = KM;
+   error = planet_ephemeris_multi_r (&DEFAULT_EPH, tjd, n_bodies, targets,
+      center, position, velocity);
+   publish_default ();
+
+   return error;
+}
+
+/********planet_ephemeris_multi_r */
+
+short int planet_ephemeris_multi_r (ephem_handle *eph, double tjd[2],
+                                    short int n_bodies, short int *targets,
+                                    short int center,
+
+                                    double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function gives the positions and velocities of several
+      target objects with respect to one center object at one epoch.
+      It returns the same values as calling 'planet_ephemeris_r' once
+      per target, but the epoch is split, the record is fetched, each
+      body is interpolated and each Chebyshev basis is computed only
+      once for all the targets.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      tjd[2] (double)
+         Two-element array containing the Julian date (TDB), split
+         any way.
+      n_bodies (short int)
+         Number of target objects.
+      *targets (short int)
+         'n_bodies' numbers of 'target' points, 0 to 12 (see
+         'planet_ephemeris'); a body may appear more than once.
+      center (short int)
+         Number of 'center' (origin) point, 0 to 12.
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         3 * 'n_bodies' position components: the position vector of
+         target 'i' relative to center, in AU, is at position[3 * i].
+      *velocity (double)
+         3 * 'n_bodies' velocity components in AU/day, laid out as
+         'position'; NULL if only the positions are wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1,2...error returned from State.
+         3  ...invalid target or center number, or body not on the
+               file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      locate_epoch      eph_manager.c
+      load_record       eph_manager.c
+      interpolate_body  eph_manager.c
+      chebyshev         eph_manager.c
+      relative_state    eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA:           Use the specialized Chebyshev kernels.
+
+   NOTES:
+      1. Each body is evaluated with the same specialized Chebyshev
+      kernel as in 'state_r'.  Bodies without a kernel whose
+      coefficients have the same number of sub-intervals share the
+      Chebyshev polynomials, since they have the same normalized
+      Chebyshev time.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error, i, k, body, slot, n_basis = 0, earth = 2, moon = 9;
+   short int need[13] = {0};
+
+   long int nr, na[13], np[13], nv[13];
+
+   double t[2], aufac = 1.0;
+   double pc[13][18], vc[13][18], twot[13];
+   double bary_pos[13][3], bary_vel[13][3] = {{0.0}};
+
+/*
+   Check the body numbers, and find which states have to be read from
+   the file.  Earth and Moon need both the Earth-Moon barycenter and the
+   geocentric Moon; the Solar System barycenter needs nothing.
+*/
+
+   if ((center < 0) || (center > 12))
+      return 3;
+   for (i = 0; i <= n_bodies; i++)
+   {
+      body = (i < n_bodies) ? targets[i] : center;
+      if ((body < 0) || (body > 12))
+         return 3;
+      if ((body == earth) || (body == moon))
+         need[earth] = need[moon] = 1;
+       else if (body == 12)
+         need[earth] = 1;
+       else if (body != 11)
+         need[body] = 1;
+   }
+   for (body = 0; body < 11; body++)
+      if (need[body] && (eph->ipt[1][body] == 0))
+         return 3;
+
+/*
+   Set units based on value of the 'km' flag.
+*/
+
+   if (eph->km)
+      t[1] = eph->ss[2] * 86400.0;
+    else
+   {
+      t[1] = eph->ss[2];
+      aufac = 1.0 / eph->jplau;
+   }
+
+/*
+   Split the epoch and read the record, once for all the bodies.
+*/
+
+   if ((error = locate_epoch (eph, tjd, &nr, &t[0])) != 0)
+      return error;
+   if ((error = load_record (eph, nr)) != 0)
+      return error;
+
+/*
+   Interpolate each needed body with its specialized kernel, as
+   'state_r' does.  Bodies without one share the polynomials of the
+   generic 'chebyshev' with the bodies with the same number of
+   sub-intervals.  A 'pc[1]' outside [-1,1] makes 'chebyshev' compute
+   the polynomials on first use.
+*/
+
+   for (body = 0; body <= 10; body++)
+   {
+      if (!need[body])
+         continue;
+
+      if (eph->kernel[body])
+         interpolate_body (eph, body, t, bary_pos[body],
+            velocity ? bary_vel[body] : NULL);
+       else
+      {
+         for (slot = 0; slot < n_basis; slot++)
+            if (na[slot] == eph->ipt[2][body])
+               break;
+         if (slot == n_basis)
+         {
+            n_basis++;
+            na[slot] = eph->ipt[2][body];
+            pc[slot][0] = 1.0;
+            pc[slot][1] = 2.0;
+            vc[slot][0] = 0.0;
+            vc[slot][1] = 1.0;
+            np[slot] = 2;
+            nv[slot] = 3;
+            twot[slot] = 0.0;
+         }
+
+         chebyshev (&eph->buffer[eph->ipt[0][body]-1], t,
+            eph->ipt[1][body], na[slot], pc[slot], vc[slot], &np[slot],
+            &nv[slot], &twot[slot], bary_pos[body],
+            velocity ? bary_vel[body] : NULL);
+      }
+
+      for (k = 0; k < 3; k++)
+      {
+         bary_pos[body][k] *= aufac;
+         bary_vel[body][k] *= aufac;
+      }
+   }
+
+   for (k = 0; k < 3; k++)
+   {
+      bary_pos[11][k] = bary_vel[11][k] = 0.0;
+      bary_pos[12][k] = need[earth] ? bary_pos[earth][k] : 0.0;
+      bary_vel[12][k] = need[earth] ? bary_vel[earth][k] : 0.0;
+   }
+
+/*
+   Form the state of each target relative to the center.
+*/
+
+   for (i = 0; i < n_bodies; i++)
+   {
+      if (targets[i] == center)
+      {
+         for (k = 0; k < 3; k++)
+         {
+            position[3 * i + k] = 0.0;
+            if (velocity)
+               velocity[3 * i + k] = 0.0;
+         }
+         continue;
+      }
+
+      relative_state (eph, targets[i], center, bary_pos[targets[i]],
+         bary_vel[targets[i]], bary_pos[center], bary_vel[center],
+         bary_pos[earth], bary_vel[earth], bary_pos[moon], bary_vel[moon],
+         &position[3 * i], velocity ? &velocity[3 * i] : NULL);
+   }
+
+   return 0;
+}
+
+/********planet_ephemeris_batch */
+
+short int planet_ephemeris_batch (long int n_epochs, double *tjd_high,
+                                  double *tjd_low, short int target,
+                                  short int center,
+
+                                  double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the multi-epoch version of 'planet_ephemeris'
+      for the file opened with 'ephem_open' or 'ephem_open_mode'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_batch_r'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_batch_r'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from 'state_r'.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      planet_ephemeris_batch_r eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   DEFAULT_EPH.km = KM;
+   error = planet_ephemeris_batch_r (&DEFAULT_EPH, n_epochs, tjd_high,
+      tjd_low, target, center, position, velocity);
+   publish_default ();
+
+   return error;
+}
+
+/********planet_ephemeris_batch_r */
+
+short int planet_ephemeris_batch_r (ephem_handle *eph, long int n_epochs,
+                                    double *tjd_high, double *tjd_low,
+                                    short int target, short int center,
+
+                                    double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function gives the position and velocity of the target
+      object with respect to the center object at many epochs.  It
+      returns the same values as calling 'planet_ephemeris_r' once per
+      epoch, but the epochs falling in the same record share the record
+      lookup, and the Chebyshev series are evaluated across epochs.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      n_epochs (long int)
+         Number of epochs.
+      *tjd_high (double)
+         'n_epochs' high-order parts of the TDB Julian dates.
+      *tjd_low (double)
+         'n_epochs' low-order parts of the TDB Julian dates, or NULL if
+         the whole dates are in 'tjd_high'.
+      target (short int)
+         Number of 'target' point (see 'planet_ephemeris'; nutations
+         are not supported).
+      center (short int)
+         Number of 'center' (origin) point (see 'planet_ephemeris').
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position vectors of target relative to center, measured in AU,
+         as a structure of arrays of 3 * 'n_epochs' elements: the x
+         components of all the epochs, then the y and the z components.
+      *velocity (double)
+         Velocity vectors of target relative to center, measured in
+         AU/day, laid out as 'position'; NULL if only the positions
+         are wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from 'state_r'.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      planet_block      eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The epochs may be in any order, but runs of consecutive epochs
+      in the same record are what shares the record lookups, so
+      sorted epochs work best.
+      2. On error the vectors of the epochs before the failing one are
+      already filled in.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   long int i, j, n;
+
+   double zero[EPH_BATCH] = {0.0};
+
+/*
+   Check the body numbers before they index the pointer tables.
+*/
+
+   if ((target < 0) || (target > 12) || (center < 0) || (center > 12))
+      return 3;
+
+/*
+   Check for target point = center point.
+*/
+
+   if (target == center)
+   {
+      for (i = 0; i < 3 * n_epochs; i++)
+      {
+         position[i] = 0.0;
+         if (velocity)
+            velocity[i] = 0.0;
+      }
+      return 0;
+   }
+
+/*
+   Process the epochs in blocks of EPH_BATCH.
+*/
+
+   for (j = 0; j < n_epochs; j += EPH_BATCH)
+   {
+      n = n_epochs - j;
+      if (n > EPH_BATCH)
+         n = EPH_BATCH;
+
+      if ((error = planet_block (eph, n, &tjd_high[j],
+         tjd_low ? &tjd_low[j] : zero, target, center, n_epochs,
+         &position[j], velocity ? &velocity[j] : NULL)) != 0)
+         return error;
+   }
+
+   return 0;
+}
+
+/********planet_ephemeris_span */
+
+short int planet_ephemeris_span (double tjd_start[2], double step,
+                                 long int n_epochs, short int target,
+                                 short int center,
+
+                                 double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the equally-spaced-epochs version of
+      'planet_ephemeris_batch' for the file opened with 'ephem_open'
+      or 'ephem_open_mode'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_span_r'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'planet_ephemeris_span_r'.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from 'state_r'.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      KM                eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      planet_ephemeris_span_r eph_manager.c
+      publish_default   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   DEFAULT_EPH.km = KM;
+   error = planet_ephemeris_span_r (&DEFAULT_EPH, tjd_start, step,
+      n_epochs, target, center, position, velocity);
+   publish_default ();
+
+   return error;
+}
+
+/********planet_ephemeris_span_r */
+
+short int planet_ephemeris_span_r (ephem_handle *eph, double tjd_start[2],
+                                   double step, long int n_epochs,
+                                   short int target, short int center,
+
+                                   double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function gives the position and velocity of the target
+      object with respect to the center object at 'n_epochs' equally
+      spaced epochs, as function 'planet_ephemeris_batch_r' does for an
+      array of epochs.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      tjd_start[2] (double)
+         First epoch, as a split TDB Julian date.
+      step (double)
+         Interval between epochs, in days.  Epoch 'i' is
+         tjd_start[0] + (tjd_start[1] + i * step).
+      n_epochs (long int)
+         Number of epochs.
+      target (short int)
+         Number of 'target' point (see 'planet_ephemeris').
+      center (short int)
+         Number of 'center' (origin) point (see 'planet_ephemeris').
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         3 * 'n_epochs' position components, laid out as in function
+         'planet_ephemeris_batch_r'.
+      *velocity (double)
+         3 * 'n_epochs' velocity components, laid out as 'position';
+         NULL if only the positions are wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0  ...everything OK.
+         1-3...error returned from 'state_r'.
+         3  ...invalid value of 'target' or 'center'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      planet_block      eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error;
+
+   long int i, j, n;
+
+   double jd_high[EPH_BATCH], jd_low[EPH_BATCH];
+
+/*
+   Check the body numbers before they index the pointer tables.
+*/
+
+   if ((target < 0) || (target > 12) || (center < 0) || (center > 12))
+      return 3;
+
+/*
+   Check for target point = center point.
+*/
+
+   if (target == center)
+   {
+      for (i = 0; i < 3 * n_epochs; i++)
+      {
+         position[i] = 0.0;
+         if (velocity)
+            velocity[i] = 0.0;
+      }
+      return 0;
+   }
+
+/*
+   Generate the epochs one block at a time and evaluate each block in
+   place in the output arrays.
+*/
+
+   for (j = 0; j < n_epochs; j += EPH_BATCH)
+   {
+      n = n_epochs - j;
+      if (n > EPH_BATCH)
+         n = EPH_BATCH;
+
+      for (i = 0; i < n; i++)
+      {
+         jd_high[i] = tjd_start[0];
+         jd_low[i] = tjd_start[1] + (double) (j + i) * step;
+      }
+
+      if ((error = planet_block (eph, n, jd_high, jd_low, target, center,
+         n_epochs, &position[j], velocity ? &velocity[j] : NULL)) != 0)
+         return error;
+   }
+
+   return 0;
+}
+
+/********split */
+
+void split (double tt,
+
+            double *fr)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function breaks up a double number into a double integer
+      part and a fractional part.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      tt (double)
+         Input number.
+
+   OUTPUT
+   ARGUMENTS:
+      *fr (double)
+         2-element output array;
+            fr[0] contains integer part,
+            fr[1] contains fractional part.
+         For negative input numbers,
+            fr[0] contains the next more negative integer;
+            fr[1] contains a positive fraction.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/06-90/JAB (USNO/NA): CA coding standards
+      V1.1/03-93/WTH (USNO/AA): Convert to C.
+      V1.2/07-93/WTH (USNO/AA): Update to C standards.
+      V1.3/10-10/WKP (USNO/AA): Renamed function to lowercase to
+                                comply with coding standards.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+
+/*
+   Get integer and fractional parts.
+*/
+
+   fr[0] = (double)((long int) tt);
+   fr[1] = tt - fr[0];
+
+/*
+   Make adjustments for negative input number.
+*/
+
+   if ((tt >= 0.0) || (fr[1] == 0.0))
+      return;
+    else
+   {
+      fr[0] = fr[0] - 1.0;
+      fr[1] = fr[1] + 1.0;
+   }
+
+   return;
+}
+
+/********open_handle */
+
+static short int open_handle (ephem_handle *eph, char *ephem_name,
+                              short int mode,
+
+                              double *jd_begin, double *jd_end,
+                              short int *de_number)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function opens a JPL planetary ephemeris file on a handle
+      and sets its initial values.  It does the work of functions
+      'ephem_open_mode' and 'ephem_open_r'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Closed handle to open the file on.
+      *ephem_name (char)
+         Name of the direct-access ephemeris file.
+      mode (short int)
+         File access mode, EPH_MODE_READ or EPH_MODE_MMAP.
+
+   OUTPUT
+   ARGUMENTS:
+      *jd_begin (double)
+         Beginning Julian date of the ephemeris file.
+      *jd_end (double)
+         Ending Julian date of the ephemeris file.
+      *de_number (short int)
+         DE number of the ephemeris file opened.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0   ...file exists and is opened correctly.
+          1-12...see function 'ephem_open_mode'.
+          14  ...unable to allocate the record cache or the buffers
+                 of a compact file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      map_ephemeris     eph_manager.c
+      map_ephemeris     eph_manager.c
+      select_kernel     eph_manager.c
+      series_end        eph_manager.c
+      compact_layout    eph_manager.c
+      free_compact      eph_manager.c
+      fclose            stdio.h
+      fopen             stdio.h
+      fread             stdio.h
+      strncmp           string.h
+      malloc            stdlib.h
+      strcpy            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'ephem_open_mode' V1.7.
+      V1.1/10-26/ROA:           Derive the record length from the
+                                coefficient pointers for DE numbers
+                                not in the look-up table and for
+                                reduced files.
+      V1.2/10-26/ROA:           Recognize compact files.
+      V1.3/10-26/ROA:           Records hold all the constants.
+      V1.4/10-26/ROA:           Keep the name of the file.
+
+   NOTES:
+      1. The record length is the larger of the space taken by the
+      series on the file and the size of the header records (the
+      second one holds one double per constant).  For the
+      files distributed by JPL it is the value of the look-up table;
+      files with fewer series (see 'Util_SubsetEphemeris') or with DE
+      numbers not in the table get the length implied by their
+      header.
+      2. For a compact file this is the length of a record once
+      expanded in memory; the length on the file is set by
+      'compact_layout'.  Compact files are always read into the record
+      cache, whatever the value of 'mode'.
+
+------------------------------------------------------------------------
+*/
+{
+   char ttl[252], cnam[2400], name[6];
+
+   short int i, j, compact, ok;
+
+   int ncon, denum, pointer[3], xpt[2][3];
+
+   long int words, header_words, end, k;
+
+/*
+   Open file ephem_name.
+*/
+
+   if ((eph->ephfile = fopen (ephem_name, "rb")) == NULL)
+   {
+      return 1;
+   }
+    else
+   {
+
+/*
+   File found. Set initializations and default values.
+*/
+
+      eph->km = 0;
+
+      eph->nrl = 0;
+
+      eph->np = 2;
+      eph->nv = 3;
+      eph->twot = 0.0;
+
+      for (i = 0; i < 18; i++)
+      {
+         eph->pc[i] = 0.0;
+         eph->vc[i] = 0.0;
+      }
+
+      eph->pc[0] = 1.0;
+      eph->vc[1] = 1.0;
+
+/*
+   Read in values from the first record, aka the header.
+*/
+
+      if (fread (ttl, sizeof ttl, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 2;
+      }
+      if (fread (cnam, sizeof cnam, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 3;
+      }
+      if (fread (eph->ss, sizeof eph->ss, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 4;
+      }
+      if (fread (&ncon, sizeof ncon, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 5;
+      }
+      if (fread (&eph->jplau, sizeof eph->jplau, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 6;
+      }
+      if (fread (&eph->em_ratio, sizeof eph->em_ratio, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 7;
+      }
+      for (i = 0; i < 12; i++)
+         for (j = 0; j < 3; j++)
+            if (fread (&eph->ipt[j][i], sizeof(int), 1, eph->ephfile) != 1)
+            {
+               fclose (eph->ephfile);
+               eph->ephfile = NULL;
+               return 8;
+            }
+      if (fread (&denum, sizeof denum, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 9;
+      }
+      if (fread (eph->lpt, sizeof eph->lpt, 1, eph->ephfile) != 1)
+      {
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 10;
+      }
+
+/*
+   Read the pointers of the lunar mantle angular velocity and of TT-TDB
+   that newer files store after the names of the constants beyond the
+   400th.  Older files have nothing (or zeros) there.  On the way, look
+   for the name that marks a compact file.
+*/
+
+      for (i = 0; i < 3; i++)
+         xpt[0][i] = xpt[1][i] = 0;
+      compact = 0;
+      for (k = 0; (k < ncon) && (k < 400); k++)
+         if (strncmp (&cnam[6 * k], EPH_F32_NAME, 6) == 0)
+            compact = 1;
+      for (k = 400, ok = 1; ok && (k < ncon); k++)
+      {
+         if (fread (name, sizeof name, 1, eph->ephfile) != 1)
+            ok = 0;
+          else if (strncmp (name, EPH_F32_NAME, 6) == 0)
+            compact = 1;
+      }
+      if (ok)
+         if (fread (xpt, sizeof xpt, 1, eph->ephfile) != 1)
+            for (i = 0; i < 3; i++)
+               xpt[0][i] = xpt[1][i] = 0;
+
+/*
+   Find the number of doubles per record implied by the header: the
+   last coefficient of any series (3 components for the bodies, the
+   librations and the mantle, 2 for the nutations, 1 for TT-TDB), but
+   never less than the header records themselves: the first holds the
+   names and the pointers, the second the values of the 'ncon'
+   constants.
+*/
+
+      words = 0;
+      for (i = 0; i < 12; i++)
+      {
+         for (j = 0; j < 3; j++)
+            pointer[j] = eph->ipt[j][i];
+         if ((end = series_end (pointer, (i == 11) ? 2L : 3L)) > words)
+            words = end;
+      }
+      if ((end = series_end (eph->lpt, 3L)) > words)
+         words = end;
+      if ((end = series_end (xpt[0], 3L)) > words)
+         words = end;
+      if ((end = series_end (xpt[1], 1L)) > words)
+         words = end;
+
+      header_words = (long int) (sizeof ttl + sizeof cnam + sizeof eph->ss
+         + sizeof ncon + sizeof eph->jplau + sizeof eph->em_ratio
+         + sizeof eph->ipt + sizeof denum + sizeof eph->lpt + sizeof xpt
+         + 7) / 8;
+      if (ncon > 400)
+         header_words += ((long int) (ncon - 400) * 6L + 7) / 8;
+      if (header_words < (long int) ncon)
+         header_words = (long int) ncon;
+      if ((words > 0) && (words < header_words))
+         words = header_words;
+
+/*
+   Set the value of the record length according to what JPL ephemeris is
+   being opened.
+*/
+
+      switch (denum)
+      {
+         case 200:
+            eph->record_length = 6608;
+            break;
+         case 403: case 405:
+         case 421:
+            eph->record_length = 8144;
+            break;
+         case 404: case 406:
+            eph->record_length = 5824;
+            break;
+         default:
+            eph->record_length = 0;
+            break;
+      }
+
+/*
+   A reduced file, or a DE number not in the table: use the length
+   implied by the header.  If there is none, close the file and return
+   an error code.
+*/
+
+      if ((words > 0) && ((eph->record_length == 0) ||
+         (words * 8 < eph->record_length)))
+         eph->record_length = words * 8;
+
+      if (eph->record_length == 0)
+      {
+         *jd_begin = 0.0;
+         *jd_end = 0.0;
+         *de_number = 0;
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 11;
+      }
+
+/*
+   The records of a compact file are expanded into doubles as they are
+   read, so the file is never mapped.
+*/
+
+      eph->file_record_length = eph->record_length;
+      eph->f32 = NULL;
+      eph->raw = NULL;
+      if (compact)
+      {
+         if (compact_layout (eph, xpt, header_words))
+         {
+            free_compact (eph);
+            fclose (eph->ephfile);
+            eph->ephfile = NULL;
+            return 14;
+         }
+         mode = EPH_MODE_READ;
+      }
+
+/*
+   Select the Chebyshev evaluator of each body.
+*/
+
+      for (i = 0; i < 11; i++)
+         eph->kernel[i] = select_kernel (eph->ipt[1][i]);
+
+/*
+   In memory-mapped mode the record buffer is pointed at the proper
+   record of the mapping by 'state_r'; otherwise allocate the record
+   cache.
+*/
+
+      eph->buffer = NULL;
+      eph->cache_hits = eph->cache_misses = 0;
+
+      if (mode == EPH_MODE_MMAP)
+      {
+         if (map_ephemeris (eph))
+         {
+            fclose (eph->ephfile);
+            eph->ephfile = NULL;
+            return 12;
+         }
+      }
+       else if (alloc_cache (eph))
+      {
+         free_compact (eph);
+         fclose (eph->ephfile);
+         eph->ephfile = NULL;
+         return 14;
+      }
+
+/*
+   Keep the name of the file for 'ephem_reopen_r'; without it the file
+   is still usable, but cannot be opened again.
+*/
+
+      eph->name = (char *) malloc (strlen (ephem_name) + 1);
+      if (eph->name != NULL)
+         strcpy (eph->name, ephem_name);
+
+      *de_number = (short int) denum;
+      *jd_begin = eph->ss[0];
+      *jd_end = eph->ss[1];
+   }
+
+   return 0;
+}
+
+/********close_handle */
+
+static short int close_handle (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function closes the JPL planetary ephemeris file of a handle
+      and frees its record cache or mapping.  The handle itself is not
+      freed, and keeps the configured capacity of the record cache.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle to close.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          0  ...file was already closed or closed correctly.
+          EOF...error closing file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      unmap_ephemeris   eph_manager.c
+      free_cache        eph_manager.c
+      free_compact      eph_manager.c
+      fclose            stdio.h
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'ephem_close' V1.3.
+      V1.1/10-26/ROA:           Free the buffers of compact files.
+      V1.2/10-26/ROA:           Free the name of the file.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   if (eph->ephfile)
+   {
+      if (eph->map)
+         unmap_ephemeris (eph);
+       else
+         free_cache (eph);
+      free_compact (eph);
+      error =  (short int) fclose (eph->ephfile);
+      eph->ephfile = NULL;
+      eph->buffer = NULL;
+      eph->nrl = 0;
+      free (eph->name);
+      eph->name = NULL;
+   }
+   return error;
+}
+
+/********publish_default */
+
+static void publish_default (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function copies the state of the default handle to the
+      global variables declared in 'eph_manager.h', so that code
+      reading them directly keeps working.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      KM, IPT, LPT, NRL, RECORD_LENGTH, SS, JPLAU, EM_RATIO, BUFFER,
+      EPHFILE, EPHMAP, EPHMAP_SIZE   eph_manager.h
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The header data are only copied when the file of the default
+      handle has changed.  Only the record number and the record
+      pointer change between calls to 'state'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, j;
+
+   if ((EPHFILE != DEFAULT_EPH.ephfile) || (EPHMAP != DEFAULT_EPH.map))
+   {
+      KM = DEFAULT_EPH.km;
+      for (i = 0; i < 3; i++)
+      {
+         for (j = 0; j < 12; j++)
+            IPT[i][j] = DEFAULT_EPH.ipt[i][j];
+         LPT[i] = DEFAULT_EPH.lpt[i];
+         SS[i] = DEFAULT_EPH.ss[i];
+      }
+      RECORD_LENGTH = DEFAULT_EPH.record_length;
+      JPLAU = DEFAULT_EPH.jplau;
+      EM_RATIO = DEFAULT_EPH.em_ratio;
+      EPHFILE = DEFAULT_EPH.ephfile;
+      EPHMAP = DEFAULT_EPH.map;
+      EPHMAP_SIZE = DEFAULT_EPH.map_size;
+   }
+
+   NRL = DEFAULT_EPH.nrl;
+   BUFFER = DEFAULT_EPH.buffer;
+
+   return;
+}
+
+/********chebyshev */
+
+static void chebyshev (double *buf, double *t, long int ncf, long int na,
+                       double *pc, double *vc, long int *np,
+                       long int *nv, double *twot,
+
+                       double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function differentiates and interpolates a set of
+      Chebyshev coefficients to give position and velocity, keeping
+      the polynomial values in caller-supplied arrays.  It does the
+      work of functions 'interpolate' and 'interpolate_r'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *buf (double)
+         Array of Chebyshev coefficients of position.
+      *t (double)
+         t[0] is fractional time interval covered by coefficients at
+         which interpolation is desired (0 <= t[0] <= 1).
+         t[1] is length of whole interval in input time units.
+      ncf (long int)
+         Number of coefficients per component.
+      na (long int)
+         Number of sets of coefficients in full array
+         (i.e., number of sub-intervals in full interval).
+      *pc, *vc (double)
+         18-element position and velocity polynomial arrays.
+      *np, *nv (long int)
+         Number of polynomials already evaluated in 'pc' and 'vc'.
+      *twot (double)
+         Twice the normalized Chebyshev time of the previous call.
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position array of requested object.
+      *velocity (double)
+         Velocity array of requested object, or NULL if only the
+         position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      fmod              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'interpolate' V1.5.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i, j, k, l;
+
+   double dna, dt1, temp, tc, vfac;
+
+/*
+   Get correct sub-interval number for this set of coefficients and
+   then get normalized Chebyshev time within that subinterval.
+*/
+
+   dna = (double) na;
+   dt1 = (double) ((long int) t[0]);
+   temp = dna * t[0];
+   l = (long int) (temp - dt1);
+
+/*
+   'tc' is the normalized Chebyshev time (-1 <= tc <= 1).
+*/
+
+   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+
+/*
+   Check to see whether Chebyshev time has changed, and compute new
+   polynomial values if it has.  (The element pc[1] is the value of
+   t1[tc] and hence contains the value of 'tc' on the previous call.)
+*/
+
+   if (tc != pc[1])
+   {
+      *np = 2;
+      *nv = 3;
+      pc[1] = tc;
+      *twot = tc + tc;
+   }
+
+/*
+   Be sure that at least 'ncf' polynomials have been evaluated and
+   are stored in the array 'pc'.
+*/
+
+   if (*np < ncf)
+   {
+      for (i = *np; i < ncf; i++)
+         pc[i] = *twot * pc[i-1] - pc[i-2];
+      *np = ncf;
+   }
+
+/*
+   Interpolate to get position for each component.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      position[i] = 0.0;
+      for (j = ncf-1; j >= 0; j--)
+      {
+         k = j + (i * ncf) + (l * (3 * ncf));
+         position[i] += pc[j] * buf[k];
+      }
+   }
+
+/*
+   If velocity interpolation is desired, be sure enough derivative
+   polynomials have been generated and stored.
+*/
+
+   if (!velocity)
+      return;
+
+   vfac = (2.0 * dna) / t[1];
+   vc[2] = 2.0 * *twot;
+   if (*nv < ncf)
+   {
+      for (i = *nv; i < ncf; i++)
+         vc[i] = *twot * vc[i-1] + pc[i-1] + pc[i-1] - vc[i-2];
+      *nv = ncf;
+   }
+
+/*
+   Interpolate to get velocity for each component.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      velocity[i] = 0.0;
+      for (j = ncf-1; j > 0; j--)
+      {
+         k = j + (i * ncf) + (l * (3 * ncf));
+         velocity[i] += vc[j] * buf[k];
+      }
+      velocity[i] *= vfac;
+   }
+
+   return;
+}
+
+/********chebyshev_N */
+
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      The macro CHEBYSHEV_KERNEL(N) defines function 'chebyshev_N', a
+      version of 'chebyshev' for exactly N coefficients per component
+      and one sub-interval already selected.  With N fixed at compile
+      time the loops are fully unrolled by the compiler.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *buf (double)
+         Chebyshev coefficients of position of the sub-interval.
+      tc (double)
+         Normalized Chebyshev time (-1 <= tc <= 1).
+      vfac (double)
+         Velocity scale factor, 2 * na / (length of whole interval).
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position array of requested object.
+      *velocity (double)
+         Velocity array of requested object, or NULL if only the
+         position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The polynomials and the sums are formed exactly as in
+      'chebyshev', so the results are identical.
+      2. N must be at least 3.
+
+------------------------------------------------------------------------
+*/
+
+#define CHEBYSHEV_KERNEL(N)                                             \
+static void chebyshev_##N (double *buf, double tc, double vfac,         \
+                           double *position, double *velocity)          \
+{                                                                       \
+   long int i, j;                                                       \
+                                                                        \
+   double twot, pc[N], vc[N];                                           \
+                                                                        \
+   pc[0] = 1.0;                                                         \
+   pc[1] = tc;                                                          \
+   twot = tc + tc;                                                      \
+   for (i = 2; i < N; i++)                                              \
+      pc[i] = twot * pc[i-1] - pc[i-2];                                 \
+                                                                        \
+   for (i = 0; i < 3; i++)                                              \
+   {                                                                    \
+      position[i] = 0.0;                                                \
+      for (j = N-1; j >= 0; j--)                                        \
+         position[i] += pc[j] * buf[j + i * N];                         \
+   }                                                                    \
+                                                                        \
+   if (!velocity)                                                       \
+      return;                                                           \
+                                                                        \
+   vc[0] = 0.0;                                                         \
+   vc[1] = 1.0;                                                         \
+   vc[2] = 2.0 * twot;                                                  \
+   for (i = 3; i < N; i++)                                              \
+      vc[i] = twot * vc[i-1] + pc[i-1] + pc[i-1] - vc[i-2];             \
+                                                                        \
+   for (i = 0; i < 3; i++)                                              \
+   {                                                                    \
+      velocity[i] = 0.0;                                                \
+      for (j = N-1; j > 0; j--)                                         \
+         velocity[i] += vc[j] * buf[j + i * N];                         \
+      velocity[i] *= vfac;                                              \
+   }                                                                    \
+                                                                        \
+   return;                                                              \
+}
+
+/*
+   Coefficient counts of the bodies in DE200 and DE403 to DE441, and
+   the shorter counts left by 'Util_RefitEphemeris'.
+*/
+
+CHEBYSHEV_KERNEL(3)
+CHEBYSHEV_KERNEL(4)
+CHEBYSHEV_KERNEL(5)
+CHEBYSHEV_KERNEL(6)
+CHEBYSHEV_KERNEL(7)
+CHEBYSHEV_KERNEL(8)
+CHEBYSHEV_KERNEL(9)
+CHEBYSHEV_KERNEL(10)
+CHEBYSHEV_KERNEL(11)
+CHEBYSHEV_KERNEL(12)
+CHEBYSHEV_KERNEL(13)
+CHEBYSHEV_KERNEL(14)
+CHEBYSHEV_KERNEL(15)
+
+/*
+   Dispatch table of the specialized kernels, searched by
+   'select_kernel'.
+*/
+
+static const struct
+{
+   long int ncf;
+   chebyshev_kernel kernel;
+} KERNELS[] =
+{
+   { 3, chebyshev_3},
+   { 4, chebyshev_4},
+   { 5, chebyshev_5},
+   { 6, chebyshev_6},
+   { 7, chebyshev_7},
+   { 8, chebyshev_8},
+   { 9, chebyshev_9},
+   {10, chebyshev_10},
+   {11, chebyshev_11},
+   {12, chebyshev_12},
+   {13, chebyshev_13},
+   {14, chebyshev_14},
+   {15, chebyshev_15}
+};
+
+/********select_kernel */
+
+static chebyshev_kernel select_kernel (long int ncf)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the specialized Chebyshev kernel for 'ncf'
+      coefficients per component, if there is one.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      ncf (long int)
+         Number of coefficients per component.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (chebyshev_kernel)
+         The kernel, or NULL if the generic 'chebyshev' has to be used.
+
+   GLOBALS
+   USED:
+      KERNELS           eph_manager.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   size_t i;
+
+   for (i = 0; i < sizeof (KERNELS) / sizeof (KERNELS[0]); i++)
+      if (KERNELS[i].ncf == ncf)
+         return KERNELS[i].kernel;
+
+   return NULL;
+}
+
+/********series_end */
+
+static long int series_end (int *pointer, long int n_components)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the position in a record of the last
+      coefficient of a series, from its pointer triple.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *pointer (int)
+         3-element pointer of the series: starting position (1 = first
+         double of the record), coefficients per component and number
+         of sub-intervals.
+      n_components (long int)
+         Number of components of the series.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (long int)
+         Position of the last coefficient (1 = first double of the
+         record), or 0 if the series is not on the file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Pointers out of the ranges used by JPL (as found in the unused
+      part of the header record of old files) are treated as absent.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((pointer[0] < 3) || (pointer[1] < 1) || (pointer[1] > 18) ||
+      (pointer[2] < 1) || (pointer[2] > 64))
+      return 0;
+
+   return (long int) pointer[0] - 1 +
+      (long int) pointer[1] * (long int) pointer[2] * n_components;
+}
+
+/********interpolate_body */
+
+static void interpolate_body (ephem_handle *eph, short int body, double *t,
+
+                              double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function interpolates the coefficients of one body in the
+      record in memory, with the specialized kernel selected for the
+      body when the file was opened, or with 'interpolate_r' otherwise.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      body (short int)
+         Body, 0 to 10 (see 'state').
+      *t (double)
+         t[0] is fractional time interval covered by coefficients at
+         which interpolation is desired (0 <= t[0] <= 1).
+         t[1] is length of whole interval in input time units.
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position array of requested object.
+      *velocity (double)
+         Velocity array of requested object, or NULL if only the
+         position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      interpolate_r     eph_manager.c
+      fmod              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The sub-interval and the normalized Chebyshev time are found as
+      in 'chebyshev'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int l, ncf, na;
+
+   double *buf, dna, dt1, temp, tc;
+
+   ncf = eph->ipt[1][body];
+   na = eph->ipt[2][body];
+   buf = &eph->buffer[eph->ipt[0][body]-1];
+
+   if (!eph->kernel[body])
+   {
+      interpolate_r (eph, buf, t, ncf, na, position, velocity);
+      return;
+   }
+
+   dna = (double) na;
+   dt1 = (double) ((long int) t[0]);
+   temp = dna * t[0];
+   l = (long int) (temp - dt1);
+   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+
+   eph->kernel[body] (&buf[l * (3 * ncf)], tc, (2.0 * dna) / t[1],
+      position, velocity);
+
+   return;
+}
+
+/********alloc_cache */
+
+static short int alloc_cache (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function allocates the empty record cache of a handle.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...unable to allocate the cache.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      calloc            stdlib.h
+      free_cache        eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. A capacity of zero (handle never configured) means one record.
+
+------------------------------------------------------------------------
+*/
+{
+   if (eph->cache_size < 1)
+      eph->cache_size = 1;
+
+   eph->cache_clock = 0;
+   eph->cache_rec = (long int *) calloc ((size_t) eph->cache_size,
+      sizeof (long int));
+   eph->cache_used = (unsigned long int *) calloc ((size_t) eph->cache_size,
+      sizeof (unsigned long int));
+   eph->cache = (double *) calloc ((size_t) eph->cache_size *
+      (size_t) (eph->record_length / 8), sizeof (double));
+
+   if (!eph->cache_rec || !eph->cache_used || !eph->cache)
+   {
+      free_cache (eph);
+      return 1;
+   }
+
+   return 0;
+}
+
+/********free_cache */
+
+static void free_cache (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function frees the record cache of a handle.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   free (eph->cache_rec);
+   free (eph->cache_used);
+   free (eph->cache);
+
+   eph->cache_rec = NULL;
+   eph->cache_used = NULL;
+   eph->cache = NULL;
+
+   return;
+}
+
+/********fetch_record */
+
+static short int fetch_record (ephem_handle *eph, long int nr)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function points the record buffer of a handle at record
+      'nr', taking it from the record cache if it is there, or reading
+      it into the least recently used cache slot otherwise.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file, opened in EPH_MODE_READ.
+      nr (long int)
+         Number of the record (1 = header).
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...error reading ephemeris file.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      expand_record     eph_manager.c
+      fseek             stdio.h
+      fread             stdio.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA:           Read compact files.
+
+   NOTES:
+      1. The records of a compact file are read into 'raw' and expanded
+      into the cache slot.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i, slot = 0, ndoubles;
+
+   ndoubles = eph->record_length / 8;
+   eph->cache_clock++;
+
+/*
+   Look for the record in the cache, and for the least recently used
+   slot at the same time.  Empty slots have a zero time of last use.
+*/
+
+   for (i = 0; i < eph->cache_size; i++)
+   {
+      if (eph->cache_rec[i] == nr)
+      {
+         eph->cache_used[i] = eph->cache_clock;
+         eph->buffer = eph->cache + i * ndoubles;
+         eph->cache_hits++;
+         return 0;
+      }
+      if (eph->cache_used[i] < eph->cache_used[slot])
+         slot = i;
+   }
+
+/*
+   Not found: read the record into the least recently used slot.
+*/
+
+   eph->cache_misses++;
+   eph->buffer = eph->cache + slot * ndoubles;
+   eph->cache_rec[slot] = 0;
+
+   fseek (eph->ephfile, (nr - 1) * eph->file_record_length, SEEK_SET);
+   if (eph->f32)
+   {
+      if (!fread (eph->raw, eph->file_record_length, 1, eph->ephfile))
+         return 1;
+      expand_record (eph);
+   }
+    else if (!fread (eph->buffer, eph->record_length, 1, eph->ephfile))
+      return 1;
+
+   eph->cache_rec[slot] = nr;
+   eph->cache_used[slot] = eph->cache_clock;
+
+   return 0;
+}
+
+/********compact_layout */
+
+static short int compact_layout (ephem_handle *eph, int xpt[2][3],
+                                 long int header_words)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sets up a handle for a compact file: the storage
+      class of each double of a record, the length of a record on the
+      file and the buffer the records are read into.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file, with the coefficient pointers and
+         the record length in memory already set.
+      xpt[2][3] (int)
+         Pointers of the lunar mantle angular velocity and of TT-TDB.
+      header_words (long int)
+         Size of the header records, in doubles.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...unable to allocate the buffers.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      series_end        eph_manager.c
+      malloc            stdlib.h
+      memset            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. On the file each record holds first the doubles, in the order
+      they have in memory, and then the floats, in the same order.  The
+      dates of the record and the first EPH_F32_LEADING coefficients of
+      each component are doubles.  The record is padded to a multiple
+      of 8 bytes, and is never shorter than the header records.
+
+------------------------------------------------------------------------
+*/
+{
+   int pointer[3];
+
+   long int i, j, k, n, ncf, end, words, floats;
+
+   words = eph->record_length / 8;
+   if ((eph->f32 = (unsigned char *) malloc ((size_t) words)) == NULL)
+      return 1;
+   memset (eph->f32, 2, (size_t) words);
+   eph->f32[0] = eph->f32[1] = 0;
+
+/*
+   Mark the coefficients of every series on the file: the 12 of 'ipt',
+   the librations, the lunar mantle and TT-TDB.
+*/
+
+   for (i = 0; i < 15; i++)
+   {
+      for (j = 0; j < 3; j++)
+      {
+         if (i < 12)
+            pointer[j] = eph->ipt[j][i];
+          else if (i == 12)
+            pointer[j] = eph->lpt[j];
+          else
+            pointer[j] = xpt[i - 13][j];
+      }
+      n = (i == 11) ? 2L : ((i == 14) ? 1L : 3L);
+      end = series_end (pointer, n);
+      if ((end == 0) || (end > words))
+         continue;
+
+      ncf = pointer[1];
+      n = end - pointer[0] + 1;
+      for (k = 0; k < n; k++)
+         eph->f32[pointer[0] - 1 + k] =
+            (unsigned char) ((k % ncf < EPH_F32_LEADING) ? 0 : 1);
+   }
+
+/*
+   Length of a record on the file.
+*/
+
+   eph->f32_doubles = floats = 0;
+   for (k = 0; k < words; k++)
+   {
+      if (eph->f32[k] == 0)
+         eph->f32_doubles++;
+       else if (eph->f32[k] == 1)
+         floats++;
+   }
+
+   eph->file_record_length = 8 * (eph->f32_doubles + (floats + 1) / 2);
+   if (eph->file_record_length < 8 * header_words)
+      eph->file_record_length = 8 * header_words;
+
+   if ((eph->raw = (double *) malloc ((size_t) eph->file_record_length))
+      == NULL)
+      return 1;
+
+   return 0;
+}
+
+/********expand_record */
+
+static void expand_record (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function expands the record of a compact file just read into
+      'raw' into the record buffer of the handle.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the compact ephemeris file, with 'buffer' pointing at
+         the cache slot to fill.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      memcpy            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See 'compact_layout' for the layout of the record on the file.
+      The doubles not stored on the file are set to zero.
+
+------------------------------------------------------------------------
+*/
+{
+   const unsigned char *floats;
+
+   long int k, words, nd = 0, nf = 0;
+
+   float value;
+
+   words = eph->record_length / 8;
+   floats = (const unsigned char *) (eph->raw + eph->f32_doubles);
+
+   for (k = 0; k < words; k++)
+   {
+      if (eph->f32[k] == 0)
+      {
+         eph->buffer[k] = eph->raw[nd++];
+      }
+       else if (eph->f32[k] == 1)
+      {
+         memcpy (&value, floats + 4 * nf++, sizeof value);
+         eph->buffer[k] = (double) value;
+      }
+       else
+      {
+         eph->buffer[k] = 0.0;
+      }
+   }
+
+   return;
+}
+
+/********free_compact */
+
+static void free_compact (ephem_handle *eph)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function frees the buffers of a handle used for a compact
+      file.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the ephemeris file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      free              stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   free (eph->f32);
+   free (eph->raw);
+
+   eph->f32 = NULL;
+   eph->raw = NULL;
+
+   return;
+}
+
+/********relative_state */
+
+static void relative_state (ephem_handle *eph, short int target,
+                            short int center, double *target_bary_pos,
+                            double *target_bary_vel,
+                            double *center_bary_pos,
+                            double *center_bary_vel, double *pos_earth,
+                            double *vel_earth, double *pos_moon,
+                            double *vel_moon,
+
+                            double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function forms the state of the target object with respect
+      to the center object from the states read from the file,
+      converting the Earth-Moon barycenter and geocentric Moon of the
+      file into Earth and Moon states when needed.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      target (short int)
+         Number of 'target' point (see 'planet_ephemeris').
+      center (short int)
+         Number of 'center' point, different from 'target'.
+      *target_bary_pos, *target_bary_vel (double)
+         State of the target as given by 'state_r' (for the Earth, the
+         Earth-Moon barycenter; for the Moon, the geocentric Moon).
+      *center_bary_pos, *center_bary_vel (double)
+         State of the center, as for the target.
+      *pos_earth, *vel_earth (double)
+         State of the Earth-Moon barycenter; used when the target or
+         the center is the Moon.
+      *pos_moon, *vel_moon (double)
+         State of the geocentric Moon; used when the target or the
+         center is the Earth.
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position vector array of target relative to center.
+      *velocity (double)
+         Velocity vector array of target relative to center, or NULL
+         if only the position is wanted.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'planet_ephemeris_r'.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, earth = 2, moon = 9;
+
+   double target_pos[3], target_vel[3], center_pos[3], center_vel[3];
+
+   for (i = 0; i < 3; i++)
+   {
+      target_pos[i] = target_bary_pos[i];
+      target_vel[i] = target_bary_vel[i];
+      center_pos[i] = center_bary_pos[i];
+      center_vel[i] = center_bary_vel[i];
+   }
+
+/*
+   Check for cases of Earth as target and Moon as center or vice versa.
+*/
+
+   if ((target == earth) && (center == moon))
+   {
+      for (i = 0; i < 3; i++)
+      {
+         position[i] = -center_pos[i];
+         if (velocity)
+            velocity[i] = -center_vel[i];
+      }
+      return;
+   }
+    else if ((target == moon) && (center == earth))
+   {
+      for (i = 0; i < 3; i++)
+      {
+         position[i] = target_pos[i];
+         if (velocity)
+            velocity[i] = target_vel[i];
+      }
+      return;
+   }
+
+/*
+   Check for Earth as target, or as center.
+*/
+
+    else if (target == earth)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         target_pos[i] = target_pos[i] - (pos_moon[i] /
+            (1.0 + eph->em_ratio));
+         target_vel[i] = target_vel[i] - (vel_moon[i] /
+            (1.0 + eph->em_ratio));
+      }
+   }
+    else if (center == earth)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         center_pos[i] = center_pos[i] - (pos_moon[i] /
+            (1.0 + eph->em_ratio));
+         center_vel[i] = center_vel[i] - (vel_moon[i] /
+            (1.0 + eph->em_ratio));
+      }
+   }
+
+/*
+   Check for Moon as target, or as center.
+*/
+
+    else if (target == moon)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         target_pos[i] = (pos_earth[i] - (target_pos[i] /
+            (1.0 + eph->em_ratio))) + target_pos[i];
+         target_vel[i] = (vel_earth[i] - (target_vel[i] /
+            (1.0 + eph->em_ratio))) + target_vel[i];
+      }
+   }
+    else if (center == moon)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         center_pos[i] = (pos_earth[i] - (center_pos[i] /
+            (1.0 + eph->em_ratio))) + center_pos[i];
+         center_vel[i] = (vel_earth[i] - (center_vel[i] /
+            (1.0 + eph->em_ratio))) + center_vel[i];
+      }
+   }
+
+/*
+   Compute position and velocity vectors.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      position[i] = target_pos[i] - center_pos[i];
+      if (velocity)
+         velocity[i] = target_vel[i] - center_vel[i];
+   }
+
+   return;
+}
+
+/********locate_epoch */
+
+static short int locate_epoch (ephem_handle *eph, double *jed,
+
+                               long int *nr, double *t)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function finds the record of the ephemeris file covering a
+      given epoch, and the fractional time of the epoch in the record.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      *jed (double)
+         2-element Julian date (TDB) at which interpolation is wanted.
+
+   OUTPUT
+   ARGUMENTS:
+      *nr (long int)
+         Number of the record (1 = header).
+      *t (double)
+         Fractional time interval of the epoch in the record
+         (0 <= t <= 1).
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         2...epoch out of range.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      split             eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'state_r'.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   double jd[4], s;
+
+/*
+   Check epoch.
 */
 
-      switch (denum)
-      {
-         case 200:
-            RECORD_LENGTH = 6608;
-            break;
-         case 403: case 405:
-         case 421:
-            RECORD_LENGTH = 8144;
-            break;
-         case 404: case 406:
-            RECORD_LENGTH = 5824;
-            break;
+   s = jed[0] - 0.5;
+   split (s, &jd[0]);
+   split (jed[1], &jd[2]);
+   jd[0] += jd[2] + 0.5;
+   jd[1] += jd[3];
+   split (jd[1], &jd[2]);
+   jd[0] += jd[2];
 
 /*
-   An unknown DE file was opened. Close the file and return an error
-   code.
+   Return error code if date is out of range.
 */
 
-         default:
-            *jd_begin = 0.0;
-            *jd_end = 0.0;
-            *de_number = 0;
-            fclose (EPHFILE);
-            return 11;
-            break;
-      }
+   if ((jd[0] < eph->ss[0]) || ((jd[0] + jd[3]) > eph->ss[1]))
+      return 2;
 
-      BUFFER = (double *) calloc (RECORD_LENGTH / 8, sizeof(double));
+/*
+   Calculate record number and relative time interval.
+*/
 
-      *de_number = (short int) denum;
-      *jd_begin = SS[0];
-      *jd_end = SS[1];
-   }
+   *nr = (long int) ((jd[0] - eph->ss[0]) / eph->ss[2]) + 3;
+   if (jd[0] == eph->ss[1])
+      *nr -= 2;
+   *t = ((jd[0] - ((double) (*nr-3) * eph->ss[2] + eph->ss[0])) + jd[3]) /
+      eph->ss[2];
 
    return 0;
 }
 
-/********ephem_close */
+/********load_record */
 
-short int ephem_close (void)
+static short int load_record (ephem_handle *eph, long int nr)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function closes a JPL planetary ephemeris file and frees the
-      memory.
+      This function makes the record buffer of a handle point at
+      record 'nr', if it does not already.
 
    REFERENCES:
-      Standish, E.M. and Newhall, X X (1988). "The JPL Export
-         Planetary Ephemeris"; JPL document dated 17 June 1988.
+      None.
 
    INPUT
    ARGUMENTS:
-      None.
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      nr (long int)
+         Number of the record (1 = header).
 
    OUTPUT
    ARGUMENTS:
@@ -290,26 +4695,21 @@ short int ephem_close (void)
    RETURNED
    VALUE:
       (short int)
-          0  ...file was already closed or closed correctly.
-          EOF...error closing file.
+         0...everything OK.
+         1...error reading ephemeris file (the file is closed).
 
    GLOBALS
    USED:
-      BUFFER            eph_manager.h
-      EPHFILE           eph_manager.h
+      None.
 
    FUNCTIONS
    CALLED:
-      fclose            stdio.h
-      free              stdlib.h
+      fetch_record      eph_manager.c
+      close_handle      eph_manager.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/11-07/WKP (USNO/AA)
-      V1.1/09-10/WKP (USNO/AA): Explicitly cast fclose return value to
-                                type 'short int'.
-      V1.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
-                                comply with coding standards.
+      V1.0/10-26/ROA:           Moved out of 'state_r'.
 
    NOTES:
       None.
@@ -317,29 +4717,55 @@ short int ephem_close (void)
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
+   long int rec;
 
-   if (EPHFILE)
+   if (nr == eph->nrl)
    {
-      error =  (short int) fclose (EPHFILE);
-      free (BUFFER);
+      eph->cache_hits++;
+      return 0;
    }
-   return error;
+
+   eph->nrl = nr;
+   rec = (nr - 1) * eph->record_length;
+
+/*
+   In memory-mapped mode just point the record buffer at the record.
+   Otherwise take it from the record cache, reading it if needed.
+*/
+
+   if (eph->map)
+   {
+      if ((size_t) rec + (size_t) eph->record_length > eph->map_size)
+      {
+         close_handle (eph);
+         return 1;
+      }
+      eph->buffer = eph->map + (rec / 8);
+      eph->cache_misses++;
+   }
+    else if (fetch_record (eph, nr))
+   {
+      close_handle (eph);
+      return 1;
+   }
+
+   return 0;
 }
 
-/********planet_ephemeris */
+/********planet_block */
 
-short int planet_ephemeris (double tjd[2], short int target,
-                            short int center,
+static short int planet_block (ephem_handle *eph, long int n_epochs,
+                               double *jd_high, double *jd_low,
+                               short int target, short int center,
+                               long int stride,
 
-                            double *position, double *velocity)
+                               double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function accesses the JPL planetary ephemeris to give the
-      position and velocity of the target object with respect to the
-      center object.
+      This function does the work of 'planet_ephemeris_batch_r' for one
+      block of at most EPH_BATCH epochs.
 
    REFERENCES:
       Standish, E.M. and Newhall, X X (1988). "The JPL Export
@@ -347,96 +4773,74 @@ short int planet_ephemeris (double tjd[2], short int target,
 
    INPUT
    ARGUMENTS:
-      tjd[2] (double)
-         Two-element array containing the Julian date, which may be
-         split any way (although the first element is usually the
-         "integer" part, and the second element is the "fractional"
-         part).  Julian date is in the TDB or "T_eph" time scale.
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      n_epochs (long int)
+         Number of epochs (1 <= n_epochs <= EPH_BATCH).
+      *jd_high, *jd_low (double)
+         High- and low-order parts of the TDB Julian dates.
       target (short int)
-         Number of 'target' point.
+         Number of 'target' point, different from 'center'.
       center (short int)
          Number of 'center' (origin) point.
-         The numbering convention for 'target' and'center' is:
-            0 = Mercury           7 = Neptune
-            1 = Venus             8 = Pluto
-            2 = Earth             9 = Moon
-            3 = Mars             10 = Sun
-            4 = Jupiter          11 = Solar system bary.
-            5 = Saturn           12 = Earth-Moon bary.
-            6 = Uranus           13 = Nutations (long int. and obliq.)
-            (If nutations are desired, set 'target' = 13;
-             'center' will be ignored on that call.)
+      stride (long int)
+         Distance between the x, y and z components in the output
+         arrays.
 
    OUTPUT
    ARGUMENTS:
       *position (double)
-         Position vector array of target relative to center, measured
-         in AU.
+         Position components, at position[k * stride + i] for
+         component 'k' of epoch 'i'.
       *velocity (double)
-         Velocity vector array of target relative to center, measured
-         in AU/day.
+         Velocity components, laid out as 'position', or NULL.
 
    RETURNED
    VALUE:
       (short int)
          0  ...everything OK.
-         1,2...error returned from State.
+         1-3...error returned from 'state_block'.
 
    GLOBALS
    USED:
-      EM_RATIO          eph_manager.h
+      None.
 
    FUNCTIONS
    CALLED:
-      state             eph_manager.h
+      state_block       eph_manager.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
-      V1.1/07-93/WTH (USNO/AA): Update to C standards.
-      V2.0/07-98/WTH (USNO/AA): Modified for ease of use and linearity.
-      V3.0/11-06/JAB (USNO/AA): Allowed for use of input 'split' Julian
-                                date for higher precision.
-      V3.1/11-07/WKP (USNO/AA): Updated prolog and error codes.
-      V3.1/12-07/WKP (USNO/AA): Removed unreferenced variables.
-      V3.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
-                                comply with coding standards.
+      V1.0/10-26/ROA
 
    NOTES:
-      None.
+      1. Same computation as 'planet_ephemeris_r', component by
+      component, so the results are identical.
 
 ------------------------------------------------------------------------
 */
 {
-   short int i, error = 0, earth = 2, moon = 9;
+   short int error, k, earth = 2, moon = 9;
    short int do_earth = 0, do_moon = 0;
 
-   double jed[2];
-   double pos_moon[3] = {0.0,0.0,0.0}, vel_moon[3] = {0.0,0.0,0.0},
-          pos_earth[3] = {0.0,0.0,0.0}, vel_earth[3] = {0.0,0.0,0.0};
-   double target_pos[3] = {0.0,0.0,0.0}, target_vel[3] = {0.0,0.0,0.0},
-          center_pos[3] = {0.0,0.0,0.0}, center_vel[3] = {0.0,0.0,0.0};
-
-/*
-   Initialize 'jed' for 'state' and set up component count.
-*/
+   long int i;
 
-   jed[0] = tjd[0];
-   jed[1] = tjd[1];
+   double pos_earth[3][EPH_BATCH], vel_earth[3][EPH_BATCH],
+          pos_moon[3][EPH_BATCH], vel_moon[3][EPH_BATCH],
+          target_pos[3][EPH_BATCH], target_vel[3][EPH_BATCH],
+          center_pos[3][EPH_BATCH], center_vel[3][EPH_BATCH];
+   double (*vel_e)[EPH_BATCH], (*vel_m)[EPH_BATCH], (*vel_t)[EPH_BATCH],
+          (*vel_c)[EPH_BATCH];
+   double *px, *vx;
 
 /*
-   Check for target point = center point.
+   Without an output velocity array no velocities are interpolated.
 */
 
-   if (target == center)
-   {
-      for (i = 0; i < 3; i++)
-      {
-         position[i] = 0.0;
-         velocity[i] = 0.0;
-      }
-      return 0;
-   }
+   vel_e = velocity ? vel_earth : NULL;
+   vel_m = velocity ? vel_moon : NULL;
+   vel_t = velocity ? target_vel : NULL;
+   vel_c = velocity ? center_vel : NULL;
 
 /*
    Check for instances of target or center being Earth or Moon,
@@ -452,211 +4856,186 @@ short int planet_ephemeris (double tjd[2], short int target,
 
    if (do_earth)
    {
-      error = state (jed,2, pos_earth,vel_earth);
+      error = state_block (eph, n_epochs, jd_high, jd_low, 2,
+         pos_earth, vel_e);
       if (error)
          return error;
    }
 
    if (do_moon)
    {
-      error = state (jed,9, pos_moon,vel_moon);
+      error = state_block (eph, n_epochs, jd_high, jd_low, 9,
+         pos_moon, vel_m);
       if (error)
          return error;
    }
 
 /*
-   Make call to State for target object.
+   Barycentric states of target and center.  The Earth-Moon
+   barycenter was already computed above.
 */
 
-   if (target == 11)
-   {
-      for (i = 0; i < 3; i++)
-      {
-         target_pos[i] = 0.0;
-         target_vel[i] = 0.0;
-      }
-   }
-    else if (target == 12)
+   if ((target == 11) || (target == 12))
    {
-      for (i = 0; i < 3; i++)
-      {
-         target_pos[i] = pos_earth[i];
-         target_vel[i] = vel_earth[i];
-      }
+      for (k = 0; k < 3; k++)
+         for (i = 0; i < n_epochs; i++)
+         {
+            target_pos[k][i] = (target == 12) ? pos_earth[k][i] : 0.0;
+            if (velocity)
+               target_vel[k][i] = (target == 12) ? vel_earth[k][i] : 0.0;
+         }
    }
     else
-      error = state (jed,target, target_pos,target_vel);
-
-   if (error)
-      return error;
-
-/*
-   Make call to State for center object.
-*/
-
-/*
-   If the requested center is the Solar System barycenter,
-   then don't bother with a second call to State.
-*/
-
-   if (center == 11)
    {
-      for (i = 0; i < 3; i++)
-      {
-         center_pos[i] = 0.0;
-         center_vel[i] = 0.0;
-      }
+      error = state_block (eph, n_epochs, jd_high, jd_low, target,
+         target_pos, vel_t);
+      if (error)
+         return error;
    }
 
-/*
-   Center is Earth-Moon barycenter, which was already computed above.
-*/
-
-    else if (center == 12)
+   if ((center == 11) || (center == 12))
    {
-      for (i = 0; i < 3; i++)
-      {
-         center_pos[i] = pos_earth[i];
-         center_vel[i] = vel_earth[i];
-      }
+      for (k = 0; k < 3; k++)
+         for (i = 0; i < n_epochs; i++)
+         {
+            center_pos[k][i] = (center == 12) ? pos_earth[k][i] : 0.0;
+            if (velocity)
+               center_vel[k][i] = (center == 12) ? vel_earth[k][i] : 0.0;
+         }
    }
     else
-      error = state (jed,center, center_pos,center_vel);
-
-   if (error)
-      return error;
+   {
+      error = state_block (eph, n_epochs, jd_high, jd_low, center,
+         center_pos, vel_c);
+      if (error)
+         return error;
+   }
 
 /*
-   Check for cases of Earth as target and Moon as center or vice versa.
+   Correct for Earth or Moon as target or center, then compute the
+   position and velocity vectors.
 */
 
-   if ((target == earth) && (center == moon))
+   for (k = 0; k < 3; k++)
    {
-      for (i = 0; i < 3; i++)
+      px = &position[k * stride];
+      vx = velocity ? &velocity[k * stride] : NULL;
+
+      if ((target == earth) && (center == moon))
       {
-         position[i] = -center_pos[i];
-         velocity[i] = -center_vel[i];
+         for (i = 0; i < n_epochs; i++)
+         {
+            px[i] = -center_pos[k][i];
+            if (vx)
+               vx[i] = -center_vel[k][i];
+         }
+         continue;
       }
-      return 0;
-   }
-    else if ((target == moon) && (center == earth))
-   {
-      for (i = 0; i < 3; i++)
+       else if ((target == moon) && (center == earth))
       {
-         position[i] = target_pos[i];
-         velocity[i] = target_vel[i];
+         for (i = 0; i < n_epochs; i++)
+         {
+            px[i] = target_pos[k][i];
+            if (vx)
+               vx[i] = target_vel[k][i];
+         }
+         continue;
       }
-      return 0;
-   }
-
-/*
-   Check for Earth as target, or as center.
-*/
-
-    else if (target == earth)
-   {
-      for (i = 0; i < 3; i++)
+       else if (target == earth)
       {
-         target_pos[i] = target_pos[i] - (pos_moon[i] /
-            (1.0 + EM_RATIO));
-         target_vel[i] = target_vel[i] - (vel_moon[i] /
-            (1.0 + EM_RATIO));
+         for (i = 0; i < n_epochs; i++)
+         {
+            target_pos[k][i] = target_pos[k][i] - (pos_moon[k][i] /
+               (1.0 + eph->em_ratio));
+            if (vx)
+               target_vel[k][i] = target_vel[k][i] - (vel_moon[k][i] /
+                  (1.0 + eph->em_ratio));
+         }
       }
-   }
-    else if (center == earth)
-   {
-      for (i = 0; i < 3; i++)
+       else if (center == earth)
       {
-         center_pos[i] = center_pos[i] - (pos_moon[i] /
-            (1.0 + EM_RATIO));
-         center_vel[i] = center_vel[i] - (vel_moon[i] /
-            (1.0 + EM_RATIO));
+         for (i = 0; i < n_epochs; i++)
+         {
+            center_pos[k][i] = center_pos[k][i] - (pos_moon[k][i] /
+               (1.0 + eph->em_ratio));
+            if (vx)
+               center_vel[k][i] = center_vel[k][i] - (vel_moon[k][i] /
+                  (1.0 + eph->em_ratio));
+         }
       }
-   }
-
-/*
-   Check for Moon as target, or as center.
-*/
-
-    else if (target == moon)
-   {
-      for (i = 0; i < 3; i++)
+       else if (target == moon)
       {
-         target_pos[i] = (pos_earth[i] - (target_pos[i] /
-            (1.0 + EM_RATIO))) + target_pos[i];
-         target_vel[i] = (vel_earth[i] - (target_vel[i] /
-            (1.0 + EM_RATIO))) + target_vel[i];
+         for (i = 0; i < n_epochs; i++)
+         {
+            target_pos[k][i] = (pos_earth[k][i] - (target_pos[k][i] /
+               (1.0 + eph->em_ratio))) + target_pos[k][i];
+            if (vx)
+               target_vel[k][i] = (vel_earth[k][i] - (target_vel[k][i] /
+                  (1.0 + eph->em_ratio))) + target_vel[k][i];
+         }
       }
-   }
-    else if (center == moon)
-   {
-      for (i = 0; i < 3; i++)
+       else if (center == moon)
       {
-         center_pos[i] = (pos_earth[i] - (center_pos[i] /
-            (1.0 + EM_RATIO))) + center_pos[i];
-         center_vel[i] = (vel_earth[i] - (center_vel[i] /
-            (1.0 + EM_RATIO))) + center_vel[i];
+         for (i = 0; i < n_epochs; i++)
+         {
+            center_pos[k][i] = (pos_earth[k][i] - (center_pos[k][i] /
+               (1.0 + eph->em_ratio))) + center_pos[k][i];
+            if (vx)
+               center_vel[k][i] = (vel_earth[k][i] - (center_vel[k][i] /
+                  (1.0 + eph->em_ratio))) + center_vel[k][i];
+         }
       }
-   }
 
-/*
-   Compute position and velocity vectors.
-*/
-
-   for (i = 0; i < 3; i++)
-   {
-      position[i] = target_pos[i] - center_pos[i];
-      velocity[i] = target_vel[i] - center_vel[i];
+      for (i = 0; i < n_epochs; i++)
+      {
+         px[i] = target_pos[k][i] - center_pos[k][i];
+         if (vx)
+            vx[i] = target_vel[k][i] - center_vel[k][i];
+      }
    }
 
    return 0;
 }
 
+/********state_block */
 
-/********state */
-
-short int state (double *jed, short int target,
+static short int state_block (ephem_handle *eph, long int n_epochs,
+                              double *jd_high, double *jd_low,
+                              short int target,
 
-                 double *target_pos, double *target_vel)
+                              double pos[3][EPH_BATCH],
+                              double vel[3][EPH_BATCH])
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function reads and interpolates the JPL planetary
-      ephemeris file.
+      This function does the work of 'state_r' for one block of at
+      most EPH_BATCH epochs.  Each run of consecutive epochs in the same
+      record is interpolated with a single record lookup.
 
    REFERENCES:
       Standish, E.M. and Newhall, X X (1988). "The JPL Export
-         Planetary Ephemeris"; JPL document dated 17 June 1988.
-
-   INPUT
-   ARGUMENTS:
-      *jed (double)
-         2-element Julian date (TDB) at which interpolation is wanted.
-         Any combination of jed[0]+jed[1] which falls within the time
-         span on the file is a permissible epoch.  See Note 1 below.
-      target (short int)
-         The requested body to get data for from the ephemeris file.
-         The designation of the astronomical bodies is:
-                 0 = Mercury                    6 = Uranus
-                 1 = Venus                      7 = Neptune
-                 2 = Earth-Moon barycenter      8 = Pluto
-                 3 = Mars                       9 = geocentric Moon
-                 4 = Jupiter                   10 = Sun
-                 5 = Saturn
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
 
-   OUTPUT
+   INPUT
    ARGUMENTS:
-      *target_pos (double)
-         The barycentric position vector array of the requested object,
-         in AU.
-         (If target object is the Moon, then the vector is geocentric.)
-      *target_vel (double)
-         The barycentric velocity vector array of the requested object,
-         in AU/Day.
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+      n_epochs (long int)
+         Number of epochs (1 <= n_epochs <= EPH_BATCH).
+      *jd_high, *jd_low (double)
+         High- and low-order parts of the TDB Julian dates.
+      target (short int)
+         Solar system body (see 'state').
 
-         Both vectors are referenced to the Earth mean equator and
-         equinox of epoch.
+   OUTPUT
+   ARGUMENTS:
+      pos[3][EPH_BATCH] (double)
+         Barycentric positions, pos[k][i] for component 'k' of epoch
+         'i', in AU or km as 'state_r'.
+      vel[3][EPH_BATCH] (double)
+         Barycentric velocities, laid out as 'pos'; NULL if only the
+         positions are wanted.
 
    RETURNED
    VALUE:
@@ -664,139 +5043,107 @@ short int state (double *jed, short int target,
          0...everything OK.
          1...error reading ephemeris file.
          2...epoch out of range.
+         3...requested body not on the file.
 
    GLOBALS
    USED:
-      KM                eph_manager.h
-      EPHFILE           eph_manager.h
-      IPT               eph_manager.h
-      BUFFER            eph_manager.h
-      NRL               eph_manager.h
-      RECORD_LENGTH     eph_manager.h
-      SS                eph_manager.h
-      JPLAU             eph_manager.h
+      None.
 
    FUNCTIONS
    CALLED:
-      split             eph_manager.h
-      fseek             stdio.h
-      fread             stdio.h
-      interpolate       eph_manager.h
-      ephem_close       eph_manager.h
+      locate_epoch      eph_manager.c
+      load_record       eph_manager.c
+      chebyshev_block   eph_manager.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
-      V1.1/07-93/WTH (USNO/AA): Update to C standards.
-      V2.0/07-98/WTH (USNO/AA): Modify to make position and velocity
-                                two distinct vector arrays.  Routine set
-                                to compute one state per call.
-      V2.1/11-07/WKP (USNO/AA): Updated prolog.
-      V2.2/10-10/WKP (USNO/AA): Renamed function to lowercase to
-                                comply with coding standards.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. For ease in programming, the user may put the entire epoch in
-         jed[0] and set jed[1] = 0. For maximum interpolation accuracy,
-         set jed[0] = the most recent midnight at or before
-         interpolation epoch, and set jed[1] = fractional part of a day
-         elapsed between jed[0] and epoch. As an alternative, it may
-         prove convenient to set jed[0] = some fixed epoch, such as
-         start of the integration and jed[1] = elapsed interval between
-         then and epoch.
+      1. The cache counters advance as if 'state_r' were called once
+      per epoch.
 
 ------------------------------------------------------------------------
 */
 {
-   short int i;
+   short int error, k;
 
-   long int nr, rec;
+   long int i, first, nr[EPH_BATCH];
 
-   double t[2], aufac = 1.0, jd[4], s;
+   double jed[2], t0[EPH_BATCH], t1, aufac = 1.0;
 
 /*
-   Set units based on value of the 'KM' flag.
+   Set units based on value of the 'km' flag.
 */
 
-   if (KM)
-      t[1] = SS[2] * 86400.0;
+   if (eph->km)
+      t1 = eph->ss[2] * 86400.0;
     else
    {
-      t[1] = SS[2];
-      aufac = 1.0 / JPLAU;
+      t1 = eph->ss[2];
+      aufac = 1.0 / eph->jplau;
    }
 
 /*
-   Check epoch.
-*/
-
-   s = jed[0] - 0.5;
-   split (s, &jd[0]);
-   split (jed[1], &jd[2]);
-   jd[0] += jd[2] + 0.5;
-   jd[1] += jd[3];
-   split (jd[1], &jd[2]);
-   jd[0] += jd[2];
-
-/*
-   Return error code if date is out of range.
+   Check all the epochs before touching the file.
 */
 
-   if ((jd[0] < SS[0]) || ((jd[0] + jd[3]) > SS[1]))
-      return 2;
-
-/*
-   Calculate record number and relative time interval.
-*/
+   for (i = 0; i < n_epochs; i++)
+   {
+      jed[0] = jd_high[i];
+      jed[1] = jd_low[i];
+      if ((error = locate_epoch (eph, jed, &nr[i], &t0[i])) != 0)
+         return error;
+   }
 
-   nr = (long int) ((jd[0] - SS[0]) / SS[2]) + 3;
-   if (jd[0] == SS[1])
-      nr -= 2;
-   t[0] = ((jd[0] - ((double) (nr-3) * SS[2] + SS[0])) + jd[3]) / SS[2];
+   if (eph->ipt[1][target] == 0)
+      return 3;
 
 /*
-   Read correct record if it is not already in memory.
+   Interpolate each run of epochs sharing a record.
 */
 
-   if (nr != NRL)
+   for (first = 0; first < n_epochs; first = i)
    {
-      NRL = nr;
-      rec = (nr - 1) * RECORD_LENGTH;
-      fseek (EPHFILE, rec, SEEK_SET);
-      if (!fread (BUFFER, RECORD_LENGTH, 1, EPHFILE))
-      {
-         ephem_close ();
-         return 1;
-      }
-   }
-
-/*
-   Check and interpolate for requested body.
-*/
+      if ((error = load_record (eph, nr[first])) != 0)
+         return error;
 
-   interpolate (&BUFFER[IPT[0][target]-1],t,IPT[1][target],
-      IPT[2][target], target_pos,target_vel);
+      for (i = first + 1; (i < n_epochs) && (nr[i] == nr[first]); i++)
+         ;
+      eph->cache_hits += (unsigned long int) (i - first - 1);
 
-   for (i = 0; i < 3; i++)
-   {
-      target_pos[i] *= aufac;
-      target_vel[i] *= aufac;
+      chebyshev_block (&eph->buffer[eph->ipt[0][target]-1],
+         eph->ipt[1][target], eph->ipt[2][target], t1, first, i, t0,
+         pos, vel);
    }
 
+   for (k = 0; k < 3; k++)
+      for (i = 0; i < n_epochs; i++)
+         pos[k][i] *= aufac;
+   if (vel)
+      for (k = 0; k < 3; k++)
+         for (i = 0; i < n_epochs; i++)
+            vel[k][i] *= aufac;
+
    return 0;
 }
 
-/********interpolate */
+/********chebyshev_block */
 
-void interpolate (double *buf, double *t, long int ncf, long int na,
+static void chebyshev_block (double *buf, long int ncf, long int na,
+                             double t1, long int first, long int last,
+                             double *t0,
 
-                  double *position, double *velocity)
+                             double pos[3][EPH_BATCH],
+                             double vel[3][EPH_BATCH])
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function differentiates and interpolates a set of
-      Chebyshev coefficients to give position and velocity.
+      This function is the multi-epoch version of 'chebyshev'.  The
+      polynomial values are kept as a structure of arrays with one
+      column per epoch, so the inner loops run over the epochs and
+      the compiler can vectorize them.
 
    REFERENCES:
       Standish, E.M. and Newhall, X X (1988). "The JPL Export
@@ -806,22 +5153,25 @@ void interpolate (double *buf, double *t, long int ncf, long int na,
    ARGUMENTS:
       *buf (double)
          Array of Chebyshev coefficients of position.
-      *t (double)
-         t[0] is fractional time interval covered by coefficients at
-         which interpolation is desired (0 <= t[0] <= 1).
-         t[1] is length of whole interval in input time units.
       ncf (long int)
          Number of coefficients per component.
       na (long int)
-         Number of sets of coefficients in full array
-         (i.e., number of sub-intervals in full interval).
+         Number of sets of coefficients in full array.
+      t1 (double)
+         Length of whole interval in input time units.
+      first, last (long int)
+         Range of epochs to evaluate, 'first' included and 'last'
+         excluded (0 <= first < last <= EPH_BATCH).
+      *t0 (double)
+         Fractional time intervals of the epochs (0 <= t0 <= 1).
 
    OUTPUT
    ARGUMENTS:
-      *position (double)
-         Position array of requested object.
-      *velocity (double)
-         Velocity array of requested object.
+      pos[3][EPH_BATCH] (double)
+         Positions, pos[k][i] for component 'k' of epoch 'i'; only
+         the columns from 'first' to 'last' are set.
+      vel[3][EPH_BATCH] (double)
+         Velocities, laid out as 'pos'; NULL if not wanted.
 
    RETURNED
    VALUE:
@@ -829,156 +5179,262 @@ void interpolate (double *buf, double *t, long int ncf, long int na,
 
    GLOBALS
    USED:
-      NP                eph_manager.h
-      NV                eph_manager.h
-      PC                eph_manager.h
-      VC                eph_manager.h
-      TWOT              eph_manager.h
+      None.
 
    FUNCTIONS
    CALLED:
-      fmod              math.h
+      None.
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-93/WTH (USNO/AA): Convert FORTRAN to C.
-      V1.1/07-93/WTH (USNO/AA): Update to C standards.
-      V1.2/07-98/WTH (USNO/AA): Modify to make position and velocity
-                                two distinct vector arrays.
-      V1.3/11-07/WKP (USNO/AA): Updated prolog.
-      V1.4/12-07/WKP (USNO/AA): Changed ncf and na arguments from short
-                                int to long int.
-      V1.5/10-10/WKP (USNO/AA): Renamed function to lowercase to
-                                comply with coding standards.
+      V1.0/10-26/ROA
 
    NOTES:
-      None.
+      1. The arithmetic, including the order of the sums, is that of
+      'chebyshev', so the results are identical to 'state_r'.  The
+      fractional part of 'temp' is taken without 'fmod', which gives
+      the same value for the non-negative 'temp' used here and lets
+      the loop vectorize.
 
 ------------------------------------------------------------------------
 */
 {
-   long int i, j, k, l;
+   short int same;
 
-   double dna, dt1, temp, tc, vfac;
+   long int i, j, k, e, l[EPH_BATCH];
+
+   double dna, dt1, temp, vfac, c;
+   double pc[18][EPH_BATCH], vc[18][EPH_BATCH], twot[EPH_BATCH];
 
 /*
-   Get correct sub-interval number for this set of coefficients and
-   then get normalized Chebyshev time within that subinterval.
+   Sub-interval number and normalized Chebyshev time of each epoch.
 */
 
    dna = (double) na;
-   dt1 = (double) ((long int) t[0]);
-   temp = dna * t[0];
-   l = (long int) (temp - dt1);
+   for (e = first; e < last; e++)
+   {
+      dt1 = (double) ((long int) t0[e]);
+      temp = dna * t0[e];
+      l[e] = (long int) (temp - dt1) * 3 * ncf;
+      pc[0][e] = 1.0;
+      pc[1][e] = 2.0 * ((temp - (double) ((long int) temp)) + dt1) - 1.0;
+      twot[e] = pc[1][e] + pc[1][e];
+      vc[0][e] = 0.0;
+      vc[1][e] = 1.0;
+      vc[2][e] = 2.0 * twot[e];
+   }
 
 /*
-   'tc' is the normalized Chebyshev time (-1 <= tc <= 1).
+   Polynomial values and their derivatives, one degree at a time.
 */
 
-   tc = 2.0 * (fmod (temp, 1.0) + dt1) - 1.0;
+   for (i = 2; i < ncf; i++)
+      for (e = first; e < last; e++)
+         pc[i][e] = twot[e] * pc[i-1][e] - pc[i-2][e];
+
+   for (i = 3; (i < ncf) && vel; i++)
+      for (e = first; e < last; e++)
+         vc[i][e] = twot[e] * vc[i-1][e] + pc[i-1][e] + pc[i-1][e] -
+            vc[i-2][e];
 
 /*
-   Check to see whether Chebyshev time has changed, and compute new
-   polynomial values if it has.  (The element PC[1] is the value of
-   t1[tc] and hence contains the value of 'tc' on the previous call.)
+   Interpolate position for each component.
 */
 
-   if (tc != PC[1])
+   vfac = (2.0 * dna) / t1;
+   same = 1;
+   for (e = first + 1; e < last; e++)
+      if (l[e] != l[first])
+         same = 0;
+
+   for (i = 0; i < 3; i++)
    {
-      NP = 2;
-      NV = 3;
-      PC[1] = tc;
-      TWOT = tc + tc;
-   }
+      for (e = first; e < last; e++)
+         pos[i][e] = 0.0;
 
 /*
-   Be sure that at least 'ncf' polynomials have been evaluated and
-   are stored in the array 'PC'.
+   When all the epochs are in the same sub-interval, which is the usual
+   case, each coefficient is shared by all of them.
 */
 
-   if (NP < ncf)
-   {
-      for (i = NP; i < ncf; i++)
-         PC[i] = TWOT * PC[i-1] - PC[i-2];
-      NP = ncf;
+      if (same)
+      {
+         for (j = ncf-1; j >= 0; j--)
+         {
+            c = buf[j + (i * ncf) + l[first]];
+            for (e = first; e < last; e++)
+               pos[i][e] += pc[j][e] * c;
+         }
+      }
+       else
+      {
+         for (j = ncf-1; j >= 0; j--)
+         {
+            k = j + (i * ncf);
+            for (e = first; e < last; e++)
+               pos[i][e] += pc[j][e] * buf[k + l[e]];
+         }
+      }
    }
 
 /*
-   Interpolate to get position for each component.
+   Same for the velocity, if it is wanted.
 */
 
+   if (!vel)
+      return;
+
    for (i = 0; i < 3; i++)
    {
-      position[i] = 0.0;
-      for (j = ncf-1; j >= 0; j--)
+      for (e = first; e < last; e++)
+         vel[i][e] = 0.0;
+
+      if (same)
       {
-         k = j + (i * ncf) + (l * (3 * ncf));
-         position[i] += PC[j] * buf[k];
+         for (j = ncf-1; j > 0; j--)
+         {
+            c = buf[j + (i * ncf) + l[first]];
+            for (e = first; e < last; e++)
+               vel[i][e] += vc[j][e] * c;
+         }
       }
+       else
+      {
+         for (j = ncf-1; j > 0; j--)
+         {
+            k = j + (i * ncf);
+            for (e = first; e < last; e++)
+               vel[i][e] += vc[j][e] * buf[k + l[e]];
+         }
+      }
+
+      for (e = first; e < last; e++)
+         vel[i][e] *= vfac;
    }
 
-/*
-   If velocity interpolation is desired, be sure enough derivative
-   polynomials have been generated and stored.
-*/
+   return;
+}
 
-   vfac = (2.0 * dna) / t[1];
-   VC[2] = 2.0 * TWOT;
-   if (NV < ncf)
-   {
-      for (i = NV; i < ncf; i++)
-         VC[i] = TWOT * VC[i-1] + PC[i-1] + PC[i-1] - VC[i-2];
-      NV = ncf;
-   }
+/********map_ephemeris */
 
+static short int map_ephemeris (ephem_handle *eph)
 /*
-   Interpolate to get velocity for each component.
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function maps the whole open ephemeris file read-only into
+      memory, shared with any other process mapping the same file.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...everything OK.
+         1...the file could not be mapped or is too short.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      fstat             sys/stat.h
+      mmap              sys/mman.h
+      CreateFileMapping windows.h
+      MapViewOfFile     windows.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
 */
+{
+   void *addr;
 
-   for (i = 0; i < 3; i++)
+#if defined(_WIN32)
+
+   HANDLE file;
+   LARGE_INTEGER size;
+
+   file = (HANDLE) _get_osfhandle (_fileno (eph->ephfile));
+   if ((file == INVALID_HANDLE_VALUE) || !GetFileSizeEx (file, &size))
+      return 1;
+   if (size.QuadPart < 2 * (LONGLONG) eph->record_length)
+      return 1;
+
+   eph->map_handle = CreateFileMapping (file, NULL, PAGE_READONLY, 0, 0,
+      NULL);
+   if (eph->map_handle == NULL)
+      return 1;
+
+   addr = MapViewOfFile (eph->map_handle, FILE_MAP_READ, 0, 0, 0);
+   if (addr == NULL)
    {
-      velocity[i] = 0.0;
-      for (j = ncf-1; j > 0; j--)
-      {
-         k = j + (i * ncf) + (l * (3 * ncf));
-         velocity[i] += VC[j] * buf[k];
-      }
-      velocity[i] *= vfac;
+      CloseHandle (eph->map_handle);
+      eph->map_handle = NULL;
+      return 1;
    }
 
-   return;
-}
+   eph->map_size = (size_t) size.QuadPart;
 
-/********split */
+#else
 
-void split (double tt,
+   struct stat st;
 
-            double *fr)
+   if (fstat (fileno (eph->ephfile), &st) != 0)
+      return 1;
+   if (st.st_size < 2 * (off_t) eph->record_length)
+      return 1;
+
+   addr = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED,
+      fileno (eph->ephfile), 0);
+   if (addr == MAP_FAILED)
+      return 1;
+
+   eph->map_size = (size_t) st.st_size;
+
+#endif
+
+   eph->map = (double *) addr;
+
+   return 0;
+}
+
+/********unmap_ephemeris */
+
+static void unmap_ephemeris (ephem_handle *eph)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function breaks up a double number into a double integer
-      part and a fractional part.
+      This function releases the mapping created by 'map_ephemeris'.
 
    REFERENCES:
-      Standish, E.M. and Newhall, X X (1988). "The JPL Export
-         Planetary Ephemeris"; JPL document dated 17 June 1988.
+      None.
 
    INPUT
    ARGUMENTS:
-      tt (double)
-         Input number.
+      *eph (ephem_handle)
+         Handle of the open ephemeris file.
 
    OUTPUT
    ARGUMENTS:
-      *fr (double)
-         2-element output array;
-            fr[0] contains integer part,
-            fr[1] contains fractional part.
-         For negative input numbers,
-            fr[0] contains the next more negative integer;
-            fr[1] contains a positive fraction.
+      None.
 
    RETURNED
    VALUE:
@@ -990,15 +5446,12 @@ void split (double tt,
 
    FUNCTIONS
    CALLED:
-      None.
+      munmap            sys/mman.h
+      UnmapViewOfFile   windows.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-90/JAB (USNO/NA): CA coding standards
-      V1.1/03-93/WTH (USNO/AA): Convert to C.
-      V1.2/07-93/WTH (USNO/AA): Update to C standards.
-      V1.3/10-10/WKP (USNO/AA): Renamed function to lowercase to
-                                comply with coding standards.
+      V1.0/10-26/ROA
 
    NOTES:
       None.
@@ -1006,25 +5459,20 @@ void split (double tt,
 ------------------------------------------------------------------------
 */
 {
+#if defined(_WIN32)
 
-/*
-   Get integer and fractional parts.
-*/
+   UnmapViewOfFile (eph->map);
+   CloseHandle (eph->map_handle);
+   eph->map_handle = NULL;
 
-   fr[0] = (double)((long int) tt);
-   fr[1] = tt - fr[0];
+#else
 
-/*
-   Make adjustments for negative input number.
-*/
+   munmap (eph->map, eph->map_size);
 
-   if ((tt >= 0.0) || (fr[1] == 0.0))
-      return;
-    else
-   {
-      fr[0] = fr[0] - 1.0;
-      fr[1] = fr[1] + 1.0;
-   }
+#endif
+
+   eph->map = NULL;
+   eph->map_size = 0;
 
    return;
 }
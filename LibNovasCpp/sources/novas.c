@@ -20,16 +20,358 @@
 #include "novascon.h"
 #include "nutation.h"
 #include "solarsystem.h"
+#include "eph_manager.h"
+#include "parallel.h"
 
 /*
    Global variables.
 
-   'PSI_COR' and 'EPS_COR' are celestial pole offsets for high-
-   precision applications.  See function 'cel_pole' for more details.
+   Values saved between calls by the functions of this file, so that
+   they are not recomputed for the same date, are kept in a
+   'novas_context' (see 'novas_context_create').  There is one struct
+   per function; each member has the name of the static variable of the
+   function it replaces.
 */
 
-static double PSI_COR = 0.0;
-static double EPS_COR = 0.0;
+typedef struct
+{
+   short int first_time;
+   double tlast1;
+   double tlast2;
+   double jd_tdb;
+   double peb[3];
+   double veb[3];
+   double psb[3];
+   double px[3];
+   double py[3];
+   double pz[3];
+   object earth;
+   object sun;
+} place_saved;
+
+typedef struct
+{
+   double t_last;
+   double ob2000;
+   double oblm;
+   double oblt;
+} equ2ecl_vec_saved;
+
+typedef equ2ecl_vec_saved ecl2equ_vec_saved;
+
+typedef struct
+{
+   double ee;
+   double jd_last;
+} sidereal_time_saved;
+
+typedef struct
+{
+   double ang_last;
+   double xx, yx, zx, xy, yy, zy, xz, yz, zz;
+} spin_saved;
+
+typedef struct
+{
+   short int accuracy_last;
+   short int source_last;
+   short int tabulated;
+   double tolerance_last;
+   double jd_last;
+   double dp;
+   double de;
+   double c_terms;
+   double mean_tab;
+} e_tilt_saved;
+
+typedef struct
+{
+   short int compute_matrix;
+   double xx, yx, zx, xy, yy, zy, xz, yz, zz;
+} frame_tie_saved;
+
+typedef struct
+{
+   double t_last;
+   double gast;
+   double fac;
+   short int first_time;
+} geo_posvel_saved;
+
+typedef struct
+{
+   short int first_time;
+   short int nbodies_last;
+   object body[7];
+   object earth;
+} grav_def_saved;
+
+typedef struct
+{
+   short int first_time;
+   double t_last;
+   double xx, yx, zx, xy, yy, zy, xz, yz, zz;
+} precession_saved;
+
+typedef struct
+{
+   short int first_call;
+   short int ref_sys_last;
+   short int use_file;
+   double t_last;
+   double ra_last;
+   ra_of_cio *cio;
+} cio_location_saved;
+
+typedef struct
+{
+   short int ref_sys_last;
+   double t_last;
+   double xx[3];
+   double yy[3];
+   double zz[3];
+} cio_basis_saved;
+
+typedef struct
+{
+   short int first_call;
+   long int last_index_rec;
+   long int last_n_pts;
+   long int n_recs;
+   double jd_beg;
+   double jd_end;
+   double t_int;
+   double *t;
+   double *ra;
+   FILE *cio_file;
+} cio_array_saved;
+
+typedef struct
+{
+   short int acc_last;
+   double t_last;
+   double eq_eq;
+} ira_equinox_saved;
+
+typedef struct
+{
+   short int valid;
+   short int method_last;
+   short int acc_last;
+   short int option_last;
+   short int source_last;
+   double jd_high_last;
+   double jd_low_last;
+   double delta_t_last;
+   double xp_last;
+   double yp_last;
+   double psi_cor_last;
+   double eps_cor_last;
+   double tolerance_last;
+   double mat[3][3];
+} ter2cel_matrix_saved;
+
+/*
+   struct novas_context: state of a thread of computation (declared in
+                         novas.h).
+
+   psi_cor, eps_cor   = celestial pole offsets for high-precision
+                        applications (see function 'cel_pole').
+   eph                = JPL ephemeris file of the context, or NULL if
+                        none is set (see function
+                        'novas_context_set_ephemeris'); the default
+                        context reads the file opened with
+                        'ephem_open'.
+   private_solsys     = 0 for the default context, which calls
+                        'solarsystem' and 'solarsystem_hp' as before;
+                        1 for the contexts of 'novas_context_create',
+                        which call only re-entrant ephemeris functions.
+   place, ...         = values saved between calls, one member per
+                        function.
+*/
+
+struct novas_context
+{
+   double psi_cor;
+   double eps_cor;
+   ephem_handle *eph;
+   short int private_solsys;
+   place_saved place;
+   equ2ecl_vec_saved equ2ecl_vec;
+   ecl2equ_vec_saved ecl2equ_vec;
+   sidereal_time_saved sidereal_time;
+   spin_saved spin;
+   e_tilt_saved e_tilt;
+   frame_tie_saved frame_tie;
+   geo_posvel_saved geo_posvel;
+   grav_def_saved grav_def;
+   precession_saved precession;
+   cio_location_saved cio_location;
+   cio_basis_saved cio_basis;
+   cio_array_saved cio_array;
+   ira_equinox_saved ira_equinox;
+   ter2cel_matrix_saved ter2cel_matrix;
+};
+
+/*
+   'CONTEXT_INITIAL' is the initializer of a context: the initial values
+   of the former static variables, no pole offsets and no ephemeris file
+   (members not named are zero).
+*/
+
+#define CONTEXT_INITIAL                                                 \
+   {                                                                    \
+      .place.first_time = 1,                                            \
+      .sidereal_time.jd_last = -99.0,                                   \
+      .spin.ang_last = -999.0,                                          \
+      .e_tilt.source_last = NUTATION_SERIES,                            \
+      .frame_tie.compute_matrix = 1,                                    \
+      .geo_posvel.first_time = 1,                                       \
+      .grav_def.first_time = 1,                                         \
+      .precession.first_time = 1,                                       \
+      .cio_location.first_call = 1,                                     \
+      .cio_array.first_call = 1,                                        \
+      .cio_array.last_index_rec = -50L,                                 \
+      .ira_equinox.acc_last = 99                                        \
+   }
+
+/*
+   'DEFAULT_CTX' is the context of the functions without the '_ctx'
+   suffix (see function 'default_context').  It is initialized at
+   compile time, so that no thread ever sees it half initialized.
+*/
+
+static novas_context DEFAULT_CTX = CONTEXT_INITIAL;
+
+/*
+   'NUT_SOURCE' selects the source of the nutation angles.  See
+   function 'set_nutation_source' for more details.
+*/
+
+static short int NUT_SOURCE = NUTATION_SERIES;
+
+/*
+   'NUT_TOLERANCE' is the accuracy, in microarcseconds, to which the
+   IAU 2000A series is truncated; 0 selects the models of
+   'nutation_angles'.  See function 'set_nutation_tolerance'.
+*/
+
+static double NUT_TOLERANCE = 0.0;
+
+/*
+   struct batch_data: arrays of a call to one of the batch functions
+                      ('e_tilt_batch', etc.), shared by its threads.
+                      Each function uses only the members it needs.
+
+   t                  = TDB times in Julian centuries since J2000.0
+   jd_high, jd_low    = Julian dates (TDB, or TT split in two parts)
+   accuracy           = selection for accuracy
+   mobl, tobl, ee,
+   dpsi, deps         = outputs, as in 'e_tilt'
+   ctx                = context of the pole offsets and of the
+                        ephemeris file (the default context, or a
+                        copy of it per worker; see 'batch_run')
+   n, n_tasks, range,
+   worker_ctx         = dates of the batch, number of ranges they are
+                        cut in, work on a range and context of each
+                        worker, for 'batch_task'
+*/
+
+typedef struct
+{
+   const double *t;
+   const double *jd_high;
+   const double *jd_low;
+   short int accuracy;
+   double *mobl;
+   double *tobl;
+   double *ee;
+   double *dpsi;
+   double *deps;
+   novas_context *ctx;
+   long int n;
+   long int n_tasks;
+   novas_range_fn range;
+   novas_context **worker_ctx;
+} batch_data;
+
+/*
+   struct grid_data: arguments of a call to 'place_grid', shared by its
+                     workers.
+
+   n_targets, targets = targets of the grid
+   jd_tt, delta_t     = epochs of the grid
+   n_stations,
+   stations           = observers of the grid
+   n_blocks           = number of tiles per epoch and observer
+   coord_sys,
+   accuracy           = as in 'place'
+   ctx                = context of each worker
+   output, errors     = outputs, as in 'place_grid'
+   tile_error         = first error of each tile, 0 if none
+*/
+
+typedef struct
+{
+   long int n_targets;
+   object *targets;
+   const double *jd_tt;
+   const double *delta_t;
+   long int n_stations;
+   observer *stations;
+   long int n_blocks;
+   short int coord_sys;
+   short int accuracy;
+   novas_context **ctx;
+   sky_pos *output;
+   short int *errors;
+   short int *tile_error;
+} grid_data;
+
+/*
+   GRID_TILE is the largest number of targets of a tile of 'place_grid'.
+*/
+
+#define GRID_TILE 256
+
+/*
+   BATCH_BLOCK is the number of dates that the batch functions pass
+   together to the nutation series.
+*/
+
+#define BATCH_BLOCK 256
+
+static void batch_run (long int n, short int n_threads,
+                       novas_range_fn range, batch_data *data);
+
+static void batch_task (long int task, short int worker, void *arg);
+
+static void batch_nutation (long int begin, long int end, void *arg);
+
+static void batch_e_tilt (long int begin, long int end, void *arg);
+
+static void batch_ee_ct (long int begin, long int end, void *arg);
+
+static void batch_mean_obliq (long int begin, long int end, void *arg);
+
+static void nutation_block (novas_context *ctx, long int m,
+                            const double *t, short int accuracy,
+
+                            double *dpsi, double *deps);
+
+static void grid_tile (long int task, short int worker, void *arg);
+
+static void context_init (novas_context *ctx);
+
+static void context_release (novas_context *ctx);
+
+static novas_context *default_context (void);
+
+static short int context_solarsystem (novas_context *ctx,
+                                      short int accuracy, double jd[2],
+                                      short int body, short int origin,
+
+                                      double *pos, double *vel);
 
 /********app_star */
 
@@ -78,13 +420,12 @@ short int app_star (double jd_tt, cat_entry *star, short int accuracy,
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      make_object        novas.c
-      place              novas.c
-      strcpy             string.h
+      default_context    novas.c
+      app_star_ctx       novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -92,12 +433,69 @@ short int app_star (double jd_tt, cat_entry *star, short int accuracy,
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.3/05-10/JAB (USNO/AA): Fix bug in set-up of 'obj_name'.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'apstar'.
       2. SIZE_OF_OBJ_NAME is defined in novas.h
 
+------------------------------------------------------------------------
+*/
+{
+   return app_star_ctx (default_context (), jd_tt,star,accuracy,
+      ra,dec);
+}
+
+/********app_star_ctx */
+
+short int app_star_ctx (novas_context *ctx, double jd_tt,
+                        cat_entry *star, short int accuracy,
+
+                        double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'app_star' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'app_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'app_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'app_star'.
+
+   RETURNED
+   VALUE:
+      See function 'app_star'.
+
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+
+   FUNCTIONS
+   CALLED:
+      make_object        novas.c
+      place_ctx          novas.c
+      strcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'app_star' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -141,8 +539,8 @@ short int app_star (double jd_tt, cat_entry *star, short int accuracy,
    location.where = 0;   /* Geocenter */
    coord_sys = 1;        /* True equator and equinox of date */
 
-   if ((error = place (jd_tt,&cel_obj,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,&cel_obj,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -202,14 +600,13 @@ short int virtual_star (double jd_tt, cat_entry *star,
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
+      None.
 
 
    FUNCTIONS
    CALLED:
-      make_object        novas.c
-      place              novas.c
-      strcpy             string.h
+      default_context    novas.c
+      virtual_star_ctx   novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -217,12 +614,68 @@ short int virtual_star (double jd_tt, cat_entry *star,
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.3/05-10/JAB (USNO/AA): Fix bug in set-up of 'obj_name'.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'vpstar'.
       2. SIZE_OF_OBJ_NAME is defined in novas.h
 
+------------------------------------------------------------------------
+*/
+{
+   return virtual_star_ctx (default_context (),
+      jd_tt,star,accuracy,ra,dec);
+}
+
+/********virtual_star_ctx */
+
+short int virtual_star_ctx (novas_context *ctx, double jd_tt,
+                            cat_entry *star, short int accuracy,
+                            double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'virtual_star' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
+
+   REFERENCES:
+      See function 'virtual_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'virtual_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'virtual_star'.
+
+   RETURNED
+   VALUE:
+      See function 'virtual_star'.
+
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+
+   FUNCTIONS
+   CALLED:
+      make_object        novas.c
+      place_ctx          novas.c
+      strcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'virtual_star' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -266,8 +719,8 @@ short int virtual_star (double jd_tt, cat_entry *star,
    location.where = 0;   /* Geocenter */
    coord_sys = 0;        /* GCRS */
 
-   if ((error = place (jd_tt,&cel_obj,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,&cel_obj,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -329,13 +782,12 @@ short int astro_star (double jd_tt, cat_entry *star, short int accuracy,
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      make_object        novas.c
-      place              novas.c
-      strcpy             string.h
+      default_context    novas.c
+      astro_star_ctx     novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -343,12 +795,68 @@ short int astro_star (double jd_tt, cat_entry *star, short int accuracy,
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.3/05-10/JAB (USNO/AA): Fix bug in set-up of 'obj_name'.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'asstar'.
       2. SIZE_OF_OBJ_NAME is defined in novas.h
 
+------------------------------------------------------------------------
+*/
+{
+   return astro_star_ctx (default_context (),
+      jd_tt,star,accuracy,ra,dec);
+}
+
+/********astro_star_ctx */
+
+short int astro_star_ctx (novas_context *ctx, double jd_tt,
+                          cat_entry *star, short int accuracy,
+                          double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'astro_star' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'astro_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'astro_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'astro_star'.
+
+   RETURNED
+   VALUE:
+      See function 'astro_star'.
+
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+
+   FUNCTIONS
+   CALLED:
+      make_object        novas.c
+      place_ctx          novas.c
+      strcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'astro_star' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -392,8 +900,8 @@ short int astro_star (double jd_tt, cat_entry *star, short int accuracy,
    location.where = 0;   /* Geocenter */
    coord_sys = 3;        /* ICRS astrometric coordinates */
 
-   if ((error = place (jd_tt,&cel_obj,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,&cel_obj,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -460,18 +968,74 @@ short int app_planet (double jd_tt, object *ss_body, short int accuracy,
 
    FUNCTIONS
    CALLED:
-      place              novas.c
+      default_context    novas.c
+      app_planet_ctx     novas.c
 
    VER./DATE/
    PROGRAMMER:
       V1.0/12-05/JAB (USNO/AA)
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
+      V1.3/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'applan'.
 
+------------------------------------------------------------------------
+*/
+{
+   return app_planet_ctx (default_context (), jd_tt,ss_body,accuracy,
+      ra,dec,dis);
+}
+
+/********app_planet_ctx */
+
+short int app_planet_ctx (novas_context *ctx, double jd_tt,
+                          object *ss_body, short int accuracy,
+
+                          double *ra, double *dec, double *dis)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'app_planet' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'app_planet'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'app_planet'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'app_planet'.
+
+   RETURNED
+   VALUE:
+      See function 'app_planet'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      place_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'app_planet' V1.2.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -501,8 +1065,8 @@ short int app_planet (double jd_tt, object *ss_body, short int accuracy,
    location.where = 0;   /* Geocenter */
    coord_sys = 1;        /* True equator and equinox of date */
 
-   if ((error = place (jd_tt,ss_body,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,ss_body,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -570,13 +1134,15 @@ short int virtual_planet (double jd_tt, object *ss_body,
 
    FUNCTIONS
    CALLED:
-      place              novas.c
+      default_context    novas.c
+      virtual_planet_ctx novas.c
 
    VER./DATE/
    PROGRAMMER:
       V1.0/12-05/JAB (USNO/AA)
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
+      V1.3/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
@@ -585,34 +1151,88 @@ short int virtual_planet (double jd_tt, object *ss_body,
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int coord_sys;
-
-   double delta_t = 0.0;
+   return virtual_planet_ctx (default_context (),
+      jd_tt,ss_body,accuracy, ra,dec,dis);
+}
 
-   observer location;
+/********virtual_planet_ctx */
 
-   sky_pos output;
+short int virtual_planet_ctx (novas_context *ctx, double jd_tt,
+                              object *ss_body, short int accuracy,
 
+                              double *ra, double *dec, double *dis)
 /*
-   Check for a valid value of 'type' in structure 'ss_body'.
-*/
-
-   if ((ss_body->type < 0) || (ss_body->type > 1))
-   {
-      error = 1;
-      return (error);
-   }
+------------------------------------------------------------------------
 
-/*
-   Compute the virtual place with a call to function 'place'.
-*/
+   PURPOSE:
+      This function is the version of 'virtual_planet' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
 
-   location.where = 0;   /* Geocenter */
-   coord_sys = 0;        /* GCRS */
+   REFERENCES:
+      See function 'virtual_planet'.
 
-   if ((error = place (jd_tt,ss_body,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'virtual_planet'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'virtual_planet'.
+
+   RETURNED
+   VALUE:
+      See function 'virtual_planet'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      place_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'virtual_planet' V1.2.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+   short int coord_sys;
+
+   double delta_t = 0.0;
+
+   observer location;
+
+   sky_pos output;
+
+/*
+   Check for a valid value of 'type' in structure 'ss_body'.
+*/
+
+   if ((ss_body->type < 0) || (ss_body->type > 1))
+   {
+      error = 1;
+      return (error);
+   }
+
+/*
+   Compute the virtual place with a call to function 'place'.
+*/
+
+   location.where = 0;   /* Geocenter */
+   coord_sys = 0;        /* GCRS */
+
+   if ((error = place_ctx (ctx,jd_tt,ss_body,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -682,18 +1302,74 @@ short int astro_planet (double jd_tt, object *ss_body,
 
    FUNCTIONS
    CALLED:
-      place              novas.c
+      default_context    novas.c
+      astro_planet_ctx   novas.c
 
    VER./DATE/
    PROGRAMMER:
       V1.0/12-05/JAB (USNO/AA)
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
+      V1.3/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'asplan'.
 
+------------------------------------------------------------------------
+*/
+{
+   return astro_planet_ctx (default_context (), jd_tt,ss_body,accuracy,
+      ra,dec,dis);
+}
+
+/********astro_planet_ctx */
+
+short int astro_planet_ctx (novas_context *ctx, double jd_tt,
+                            object *ss_body, short int accuracy,
+
+                            double *ra, double *dec, double *dis)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'astro_planet' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
+
+   REFERENCES:
+      See function 'astro_planet'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'astro_planet'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'astro_planet'.
+
+   RETURNED
+   VALUE:
+      See function 'astro_planet'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      place_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'astro_planet' V1.2.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -723,8 +1399,8 @@ short int astro_planet (double jd_tt, object *ss_body,
    location.where = 0;   /* Geocenter */
    coord_sys = 3;        /* ICRS astrometric coordinates */
 
-   if ((error = place (jd_tt,ss_body,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,ss_body,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -795,14 +1471,12 @@ short int topo_star (double jd_tt, double delta_t, cat_entry *star,
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      make_observer      novas.c
-      make_object        novas.c
-      place              novas.c
-      strcpy             string.h
+      default_context    novas.c
+      topo_star_ctx      novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -811,12 +1485,71 @@ short int topo_star (double jd_tt, double delta_t, cat_entry *star,
       V1.2/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.3/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.4/05-10/JAB (USNO/AA): Fix bug in set-up of 'obj_name'.
+      V1.5/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'tpstar'.
       2. SIZE_OF_OBJ_NAME is defined in novas.h
 
+------------------------------------------------------------------------
+*/
+{
+   return topo_star_ctx (default_context (),
+      jd_tt,delta_t,star,position,accuracy, ra,dec);
+}
+
+/********topo_star_ctx */
+
+short int topo_star_ctx (novas_context *ctx, double jd_tt,
+                         double delta_t, cat_entry *star,
+                         on_surface *position, short int accuracy,
+
+                         double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'topo_star' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'topo_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'topo_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'topo_star'.
+
+   RETURNED
+   VALUE:
+      See function 'topo_star'.
+
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+
+   FUNCTIONS
+   CALLED:
+      make_observer      novas.c
+      make_object        novas.c
+      place_ctx          novas.c
+      strcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'topo_star' V1.4.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -877,8 +1610,8 @@ short int topo_star (double jd_tt, double delta_t, cat_entry *star,
 
    coord_sys = 1;        /* True equator and equinox of date */
 
-   if ((error = place (jd_tt,&cel_obj,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,&cel_obj,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -945,14 +1678,12 @@ short int local_star (double jd_tt, double delta_t, cat_entry *star,
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      make_observer      novas.c
-      make_object        novas.c
-      place              novas.c
-      strcpy             string.h
+      default_context    novas.c
+      local_star_ctx     novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -960,12 +1691,71 @@ short int local_star (double jd_tt, double delta_t, cat_entry *star,
       V1.1/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.3/05-10/JAB (USNO/AA): Fix bug in set-up of 'obj_name'.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'lpstar'.
       2. SIZE_OF_OBJ_NAME is defined in novas.h
 
+------------------------------------------------------------------------
+*/
+{
+   return local_star_ctx (default_context (),
+      jd_tt,delta_t,star,position,accuracy, ra,dec);
+}
+
+/********local_star_ctx */
+
+short int local_star_ctx (novas_context *ctx, double jd_tt,
+                          double delta_t, cat_entry *star,
+                          on_surface *position, short int accuracy,
+
+                          double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'local_star' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'local_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'local_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'local_star'.
+
+   RETURNED
+   VALUE:
+      See function 'local_star'.
+
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+
+   FUNCTIONS
+   CALLED:
+      make_observer      novas.c
+      make_object        novas.c
+      place_ctx          novas.c
+      strcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'local_star' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -1026,8 +1816,8 @@ short int local_star (double jd_tt, double delta_t, cat_entry *star,
 
    coord_sys = 0;        /* "Local GCRS" */
 
-   if ((error = place (jd_tt,&cel_obj,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,&cel_obj,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -1100,8 +1890,8 @@ short int topo_planet (double jd_tt, object *ss_body, double delta_t,
 
    FUNCTIONS
    CALLED:
-      make_observer      novas.c
-      place              novas.c
+      default_context    novas.c
+      topo_planet_ctx    novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -1110,11 +1900,68 @@ short int topo_planet (double jd_tt, object *ss_body, double delta_t,
       V1.2/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.3/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.4/07-10/JLB (USNO/AA): Fixed minor documentation error in prolog
+      V1.5/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'tpplan'.
 
+------------------------------------------------------------------------
+*/
+{
+   return topo_planet_ctx (default_context (),
+      jd_tt,ss_body,delta_t,position,accuracy, ra,dec,dis);
+}
+
+/********topo_planet_ctx */
+
+short int topo_planet_ctx (novas_context *ctx, double jd_tt,
+                           object *ss_body, double delta_t,
+                           on_surface *position, short int accuracy,
+
+                           double *ra, double *dec, double *dis)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'topo_planet' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'topo_planet'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'topo_planet'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'topo_planet'.
+
+   RETURNED
+   VALUE:
+      See function 'topo_planet'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      make_observer      novas.c
+      place_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'topo_planet' V1.4.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -1151,8 +1998,8 @@ short int topo_planet (double jd_tt, object *ss_body, double delta_t,
 
    coord_sys = 1;        /* True equator and equinox of date */
 
-   if ((error = place (jd_tt,ss_body,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,ss_body,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -1226,8 +2073,8 @@ short int local_planet (double jd_tt, object *ss_body,
 
    FUNCTIONS
    CALLED:
-      make_observer      novas.c
-      place              novas.c
+      default_context    novas.c
+      local_planet_ctx   novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -1235,11 +2082,68 @@ short int local_planet (double jd_tt, object *ss_body,
       V1.1/01-06/WKP (USNO/AA): Fixed minor syntax problem.
       V1.2/10-06/JAB (USNO/AA): Incorporate 'output' structure.
       V1.3/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'lpplan'.
 
+------------------------------------------------------------------------
+*/
+{
+   return local_planet_ctx (default_context (),
+      jd_tt,ss_body,delta_t,position,accuracy, ra,dec,dis);
+}
+
+/********local_planet_ctx */
+
+short int local_planet_ctx (novas_context *ctx, double jd_tt,
+                            object *ss_body, double delta_t,
+                            on_surface *position, short int accuracy,
+
+                            double *ra, double *dec, double *dis)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'local_planet' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
+
+   REFERENCES:
+      See function 'local_planet'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'local_planet'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'local_planet'.
+
+   RETURNED
+   VALUE:
+      See function 'local_planet'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      make_observer      novas.c
+      place_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'local_planet' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -1276,8 +2180,8 @@ short int local_planet (double jd_tt, object *ss_body,
 
    coord_sys = 0;        /* "Local GCRS" */
 
-   if ((error = place (jd_tt,ss_body,&location,delta_t,coord_sys,
-      accuracy, &output)) != 0)
+   if ((error = place_ctx (ctx,jd_tt,ss_body,&location,delta_t,
+      coord_sys, accuracy, &output)) != 0)
    {
       *ra = 0.0;
       *dec = 0.0;
@@ -1347,16 +2251,12 @@ short int mean_star (double jd_tt, double ra, double dec,
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      make_cat_entry     novas.c
-      starvectors        novas.c
-      precession         novas.c
-      app_star           novas.c
-      vector2radec       novas.c
-      fabs               math.h
+      default_context    novas.c
+      mean_star_ctx      novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -1366,11 +2266,71 @@ short int mean_star (double jd_tt, double ra, double dec,
       V1.2/10-08/JAB (USNO/AA): Add 'accuracy' option to input.
       V1.3/05-10/JAB (USNO/AA): Use 'make_cat_entry' to set up
                                 local structure 'tempstar'.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'mpstar'.
 
+------------------------------------------------------------------------
+*/
+{
+   return mean_star_ctx (default_context (), jd_tt,ra,dec,accuracy,
+      ira,idec);
+}
+
+/********mean_star_ctx */
+
+short int mean_star_ctx (novas_context *ctx, double jd_tt, double ra,
+                         double dec, short int accuracy,
+
+                         double *ira, double *idec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'mean_star' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'mean_star'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'mean_star'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'mean_star'.
+
+   RETURNED
+   VALUE:
+      See function 'mean_star'.
+
+   GLOBALS
+   USED:
+      T0                 novascon.c
+
+   FUNCTIONS
+   CALLED:
+      make_cat_entry     novas.c
+      starvectors        novas.c
+      precession_ctx     novas.c
+      app_star_ctx       novas.c
+      vector2radec       novas.c
+      fabs               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'mean_star' V1.3.
+
+   NOTES:
+      None.
+
 ------------------------------------------------------------------------
 */
 {
@@ -1400,7 +2360,7 @@ short int mean_star (double jd_tt, double ra, double dec,
    to its position at J2000.0.
 */
 
-   precession (jd_tt,pos,T0, pos2);
+   precession_ctx (ctx,jd_tt,pos,T0, pos2);
    if ((error = vector2radec (pos2, &newira,&newidec)) != 0)
    {
       return (error + 10);
@@ -1417,7 +2377,8 @@ short int mean_star (double jd_tt, double ra, double dec,
       oldidec = newidec;
       tempstar.ra = oldira;
       tempstar.dec = oldidec;
-      if ((error = app_star (jd_tt,&tempstar,accuracy, &ra2,&dec2)) != 0)
+      if ((error = app_star_ctx (ctx,jd_tt,&tempstar,accuracy, &ra2,
+         &dec2)) != 0)
       {
          *ira = 0.0;
          *idec = 0.0;
@@ -1524,32 +2485,12 @@ short int place (double jd_tt, object *cel_object,
 
    GLOBALS
    USED:
-      T0, C_AUDAY        novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      make_cat_entry     novas.c
-      make_object        novas.c
-      tdb2tt             novas.c
-      ephemeris          novas.c
-      geo_posvel         novas.c
-      starvectors        novas.c
-      d_light            novas.c
-      proper_motion      novas.c
-      bary2obs           novas.c
-      light_time         novas.c
-      limb_angle         novas.c
-      grav_def           novas.c
-      aberration         novas.c
-      frame_tie          novas.c
-      precession         novas.c
-      nutation           novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      rad_vel            novas.c
-      vector2radec       novas.c
-      fabs               math.h
-      sqrt               math.h
+      default_context    novas.c
+      place_ctx          novas.c
 
    VER./DATE/
    PROGRAMMER:
@@ -1568,6 +2509,9 @@ short int place (double jd_tt, object *cel_object,
       V1.7/10-08/JAB (USNO/AA) Modify calls to 'ephemeris' to support
                                two-part input Julian date.
       V1.8/07-10/JLB (USNO/AA) Corrected citation to Kaplan et al.
+      V1.9/10-26/ROA           Ask 'ephemeris' for the position only
+                               of the Sun.
+      V2.0/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
       1. Values of 'location->where' and 'coord_sys' dictate the various
@@ -1585,14 +2529,88 @@ short int place (double jd_tt, object *cel_object,
 ------------------------------------------------------------------------
 */
 {
-   static short int first_time = 1;
+   return place_ctx (default_context (),
+      jd_tt,cel_object,location,delta_t,coord_sys,accuracy, output);
+}
+
+/********place_ctx */
+
+short int place_ctx (novas_context *ctx, double jd_tt,
+                     object *cel_object, observer *location,
+                     double delta_t, short int coord_sys,
+                     short int accuracy,
+
+                     sky_pos *output)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'place' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'place'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'place'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'place'.
+
+   RETURNED
+   VALUE:
+      See function 'place'.
+
+   GLOBALS
+   USED:
+      T0, C_AUDAY        novascon.c
+
+   FUNCTIONS
+   CALLED:
+      make_cat_entry     novas.c
+      make_object        novas.c
+      tdb2tt             novas.c
+      ephemeris_ctx      novas.c
+      geo_posvel_ctx     novas.c
+      starvectors        novas.c
+      d_light            novas.c
+      proper_motion      novas.c
+      bary2obs           novas.c
+      light_time_ctx     novas.c
+      limb_angle         novas.c
+      grav_def_ctx       novas.c
+      aberration         novas.c
+      frame_tie_ctx      novas.c
+      precession_ctx     novas.c
+      nutation_ctx       novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      rad_vel            novas.c
+      vector2radec       novas.c
+      fabs               math.h
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'place' V1.9.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   place_saved *sv = &ctx->place;
+
    short int error = 0;
    short int loc, rs, i;
 
-   static double tlast1 = 0.0;
-   static double tlast2 = 0.0;
-   static double jd_tdb, peb[3], veb[3], psb[3], vsb[3], px[3], py[3],
-      pz[3];
    double x, secdif, jd[2], pog[3], vog[3], pob[3], vob[3], pos1[3],
       vel1[3], dt, pos2[3], pos3[3], t_light, t_light0, pos4[3], frlimb,
       pos5[3], pos6[3], pos7[3], pos8[3], r_cio, d_obs_geo, d_obs_sun,
@@ -1600,7 +2618,6 @@ short int place (double jd_tt, object *cel_object,
 
    cat_entry null_star;
 
-   static object earth, sun;
 
 /*
    Check for invalid value of 'coord_sys' or 'accuracy'.
@@ -1616,15 +2633,15 @@ short int place (double jd_tt, object *cel_object,
    Create a null star 'cat_entry' and  Earth and Sun 'object's.
 */
 
-   if (first_time)
+   if (sv->first_time)
    {
       make_cat_entry ("NULL_STAR","   ",0L,0.0,0.0,0.0,0.0,0.0,0.0,
          &null_star);
 
-      make_object (0,3,"Earth",&null_star, &earth);
-      make_object (0,10,"Sun",&null_star, &sun);
+      make_object (0,3,"Earth",&null_star, &sv->earth);
+      make_object (0,10,"Sun",&null_star, &sv->sun);
 
-      first_time = 0;
+      sv->first_time = 0;
    }
 
 /*
@@ -1644,37 +2661,37 @@ short int place (double jd_tt, object *cel_object,
    ---------------------------------------------------------------------
 */
 
-   if (fabs (jd_tt - tlast1) > 1.0e-8)
+   if (fabs (jd_tt - sv->tlast1) > 1.0e-8)
    {
 
 /*
    Compute 'jd_tdb', the TDB Julian date corresponding to 'jd_tt'.
 */
 
-      jd_tdb = jd_tt;
-      tdb2tt (jd_tdb, &x,&secdif);
-      jd_tdb = jd_tt + secdif / 86400.0;
+      sv->jd_tdb = jd_tt;
+      tdb2tt (sv->jd_tdb, &x,&secdif);
+      sv->jd_tdb = jd_tt + secdif / 86400.0;
 
 /*
    Get position and velocity of Earth wrt barycenter of solar system,
    in ICRS.
 */
 
-      jd[0] = jd_tdb;
+      jd[0] = sv->jd_tdb;
       jd[1] = 0.0;
 
-      if ((error = ephemeris (jd,&earth,0,accuracy, peb,veb)) != 0)
-         return (error += 10);
+      if ((error = ephemeris_ctx (ctx,jd,&sv->earth,0,accuracy, sv->peb,
+         sv->veb)) != 0) return (error += 10);
 
 /*
    Get position and velocity of Sun wrt barycenter of solar system,
    in ICRS.
 */
 
-      if ((error = ephemeris (jd,&sun,0,accuracy, psb,vsb)) != 0)
-         return (error += 10);
+      if ((error = ephemeris_ctx (ctx,jd,&sv->sun,0,accuracy, sv->psb,
+         NULL)) != 0) return (error += 10);
 
-      tlast1 = jd_tt;
+      sv->tlast1 = jd_tt;
    }
 
 /*
@@ -1692,8 +2709,8 @@ short int place (double jd_tt, object *cel_object,
    satellite).
 */
 
-      if ((error = geo_posvel (jd_tt,delta_t,accuracy,location, pog,vog))
-         != 0)
+      if ((error = geo_posvel_ctx (ctx,jd_tt,delta_t,accuracy,location,
+         pog,vog)) != 0)
          return (error += 40);
 
       loc = 1;
@@ -1722,8 +2739,8 @@ short int place (double jd_tt, object *cel_object,
 
     for (i = 0; i < 3; i++)
     {
-       pob[i] = peb[i] + pog[i];
-       vob[i] = veb[i] + vog[i];
+       pob[i] = sv->peb[i] + pog[i];
+       vob[i] = sv->veb[i] + vog[i];
     }
 
 /*
@@ -1741,7 +2758,7 @@ short int place (double jd_tt, object *cel_object,
 
       starvectors (&cel_object->star, pos1,vel1);
       dt = d_light (pos1,pob);
-      proper_motion (T0,pos1,vel1,(jd_tdb + dt), pos2);
+      proper_motion (T0,pos1,vel1,(sv->jd_tdb + dt), pos2);
 
 /*
    Get position of star wrt observer (corrected for parallax).
@@ -1758,11 +2775,11 @@ short int place (double jd_tt, object *cel_object,
    Get position of body wrt barycenter of solar system.
 */
 
-      jd[0] = jd_tdb;
+      jd[0] = sv->jd_tdb;
       jd[1] = 0.0;
 
-      if ((error = ephemeris (jd,cel_object,0,accuracy, pos1,vel1)) != 0)
-         return (error += 10);
+      if ((error = ephemeris_ctx (ctx,jd,cel_object,0,accuracy, pos1,
+         vel1)) != 0) return (error += 10);
 
 /*
    Get position of body wrt observer, and true (Euclidian) distance.
@@ -1775,8 +2792,8 @@ short int place (double jd_tt, object *cel_object,
    Get position of body wrt observer, antedated for light-time.
 */
 
-      if ((error = light_time (jd_tdb,cel_object,pob,t_light0,accuracy,
-           pos3,&t_light)) != 0)
+      if ((error = light_time_ctx (ctx,sv->jd_tdb,cel_object,pob,
+           t_light0,accuracy, pos3,&t_light)) != 0)
          return (error += 50);
    }
 
@@ -1817,8 +2834,8 @@ short int place (double jd_tt, object *cel_object,
    Compute gravitational deflection and aberration.
 */
 
-      if ((error = grav_def (jd_tdb,loc,accuracy,pos3,pob, pos4)) != 0)
-         return (error += 70);
+      if ((error = grav_def_ctx (ctx,sv->jd_tdb,loc,accuracy,pos3,pob,
+         pos4)) != 0) return (error += 70);
 
       aberration (pos4,vob,t_light, pos5);
    }
@@ -1833,14 +2850,14 @@ short int place (double jd_tt, object *cel_object,
    {
       case (1):    /* Transform to equator and equinox of date. */
 
-         frame_tie (pos5,1, pos6);
-         precession (T0,pos6,jd_tdb, pos7);
-         nutation (jd_tdb,0,accuracy,pos7, pos8);
+         frame_tie_ctx (ctx,pos5,1, pos6);
+         precession_ctx (ctx,T0,pos6,sv->jd_tdb, pos7);
+         nutation_ctx (ctx,sv->jd_tdb,0,accuracy,pos7, pos8);
          break;
 
       case (2):    /* Transform to equator and CIO of date. */
 
-         if (fabs (jd_tdb - tlast2) > 1.0e-8 )
+         if (fabs (sv->jd_tdb - sv->tlast2) > 1.0e-8 )
          {
 
 /*
@@ -1848,23 +2865,26 @@ short int place (double jd_tt, object *cel_object,
    system.
 */
 
-            if ((error = cio_location (jd_tdb,accuracy, &r_cio,
-               &rs)) != 0)
+            if ((error = cio_location_ctx (ctx,sv->jd_tdb,accuracy,
+               &r_cio,&rs)) != 0)
                return (error += 80);
-            if ((error = cio_basis (jd_tdb,r_cio,rs,accuracy,
-               px,py,pz)) != 0)
+            if ((error = cio_basis_ctx (ctx,sv->jd_tdb,r_cio,rs,
+               accuracy, sv->px,sv->py,sv->pz)) != 0)
                return (error += 90);
 
-            tlast2 = jd_tdb;
+            sv->tlast2 = sv->jd_tdb;
          }
 
 /*
    Transform position vector to celestial intermediate system.
 */
 
-         pos8[0] = px[0] * pos5[0] + px[1] * pos5[1] + px[2] * pos5[2];
-         pos8[1] = py[0] * pos5[0] + py[1] * pos5[1] + py[2] * pos5[2];
-         pos8[2] = pz[0] * pos5[0] + pz[1] * pos5[1] + pz[2] * pos5[2];
+         pos8[0] = sv->px[0] * pos5[0] + sv->px[1] * pos5[1] +
+                   sv->px[2] * pos5[2];
+         pos8[1] = sv->py[0] * pos5[0] + sv->py[1] * pos5[1] +
+                   sv->py[2] * pos5[2];
+         pos8[2] = sv->pz[0] * pos5[0] + sv->pz[1] * pos5[1] +
+                   sv->pz[2] * pos5[2];
          break;
 
       default:     /* No transformation -- keep coordinates in GCRS, */
@@ -1885,17 +2905,17 @@ short int place (double jd_tt, object *cel_object,
    Compute distances: observer-geocenter, observer-Sun, object-Sun.
 */
 
-   d_obs_geo = sqrt ((pob[0] - peb[0]) * (pob[0] - peb[0]) +
-                    ( pob[1] - peb[1]) * (pob[1] - peb[1]) +
-                    ( pob[2] - peb[2]) * (pob[2] - peb[2]));
+   d_obs_geo = sqrt ((pob[0] - sv->peb[0]) * (pob[0] - sv->peb[0]) +
+                    ( pob[1] - sv->peb[1]) * (pob[1] - sv->peb[1]) +
+                    ( pob[2] - sv->peb[2]) * (pob[2] - sv->peb[2]));
 
-   d_obs_sun = sqrt ((pob[0] - psb[0]) * (pob[0] - psb[0]) +
-                    ( pob[1] - psb[1]) * (pob[1] - psb[1]) +
-                    ( pob[2] - psb[2]) * (pob[2] - psb[2]));
+   d_obs_sun = sqrt ((pob[0] - sv->psb[0]) * (pob[0] - sv->psb[0]) +
+                    ( pob[1] - sv->psb[1]) * (pob[1] - sv->psb[1]) +
+                    ( pob[2] - sv->psb[2]) * (pob[2] - sv->psb[2]));
 
-   d_obj_sun = sqrt ((pos1[0] - psb[0]) * (pos1[0] - psb[0]) +
-                    ( pos1[1] - psb[1]) * (pos1[1] - psb[1]) +
-                    ( pos1[2] - psb[2]) * (pos1[2] - psb[2]));
+   d_obj_sun = sqrt ((pos1[0] - sv->psb[0]) * (pos1[0] - sv->psb[0]) +
+                    ( pos1[1] - sv->psb[1]) * (pos1[1] - sv->psb[1]) +
+                    ( pos1[2] - sv->psb[2]) * (pos1[2] - sv->psb[2]));
 
    rad_vel (cel_object,pos3,vel1,vob,d_obs_geo,d_obs_sun,d_obj_sun,
       &output->rv);
@@ -1918,624 +2938,748 @@ short int place (double jd_tt, object *cel_object,
    return (error);
 }
 
-/********equ2gal */
+/********make_frame */
 
-void equ2gal (double rai, double deci,
+short int make_frame (double jd_tt, double delta_t, observer *location,
+                      short int coord_sys, short int accuracy,
 
-              double *glon, double *glat)
+                      novas_frame *frame)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To convert ICRS right ascension and declination to galactic
-      longitude and latitude.
+      This function computes the quantities of 'place' that depend only
+      on the date, the observer, the output coordinate system and the
+      accuracy: the Earth, Sun and observer vectors, the deflecting
+      bodies and the rotation to the output system.  The places of any
+      number of stars are then computed with 'frame_place'.
 
    REFERENCES:
-      Hipparcos and Tycho Catalogues, Vol. 1, Section 1.5.3.
+      See function 'place'.
 
    INPUT
    ARGUMENTS:
-      rai (double)
-         ICRS right ascension in hours.
-      deci (double)
-         ICRS declination in degrees.
+      jd_tt (double)
+         TT Julian date for place.
+      delta_t (double)
+         Difference TT-UT1 at 'jd_tt', in seconds of time.
+      *location (struct observer)
+         Pointer to structure containing the position of the observer
+         (defined in novas.h).
+      coord_sys (short int)
+         Code specifying coordinate system of the output position, as
+         in 'place'.
+            = 0 ... GCRS or "local GCRS"
+            = 1 ... true equator and equinox of date
+            = 2 ... true equator and CIO of date
+            = 3 ... astrometric coordinates, i.e., without light
+                    deflection or aberration.
+      accuracy (short int)
+         Code specifying the relative accuracy of the output position.
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
    OUTPUT
    ARGUMENTS:
-      *glon (double)
-         Galactic longitude in degrees.
-      *glat (double)
-         Galactic latitude in degrees.
+      *frame (struct novas_frame)
+         The frame (defined in novas.h).
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         = 0         ... No problems.
+         = 1         ... invalid value of 'coord_sys'
+         = 2         ... invalid value of 'accuracy'
+         > 10, < 40  ... 10 + error from function 'ephemeris'
+         > 40, < 50  ... 40 + error from function 'geo_posvel'
+         > 70, < 80  ... 70 + error from function 'ephemeris' for a
+                         deflecting body
+         > 80, < 90  ... 80 + error from function 'cio_location'
+         > 90, < 100 ... 90 + error from function 'cio_basis'
 
    GLOBALS
    USED:
-      DEG2RAD, RAD2DEG   novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sin                math.h
-      cos                math.h
-      sqrt               math.h
-      atan2              math.h
+      default_context    novas.c
+      make_frame_ctx     novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/11-03/JAB (USNO/AA)
-      V1.1/03-06/JAB (USNO/AA): Fixed initialization of 'ag'.
-      V1.2/03-11/WKP (USNO/AA): Added braces to 2-D array initialization
-                                to quiet gcc warnings.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. This function uses the coordinate transformation specified
-      in the reference.
-      2. This function is the C version of NOVAS Fortran routine
-      'eqgal'.
+      1. The frame uses the default 'novas_context', like 'place'.
 
 ------------------------------------------------------------------------
 */
 {
-   double r, d, pos1[3], pos2[3], xyproj, g;
+   return make_frame_ctx (default_context (), jd_tt,delta_t,location,
+      coord_sys,accuracy, frame);
+}
 
-/*
-   Rotation matrix A_g from Hipparcos documentation eq. 1.5.11.
-*/
+/********make_frame_ctx */
 
-   double ag[3][3] = {
-      {-0.0548755604, +0.4941094279, -0.8676661490},
-      {-0.8734370902, -0.4448296300, -0.1980763734},
-      {-0.4838350155, +0.7469822445, +0.4559837762}};
+short int make_frame_ctx (novas_context *ctx, double jd_tt,
+                          double delta_t, observer *location,
+                          short int coord_sys, short int accuracy,
 
+                          novas_frame *frame)
 /*
-   Form position vector in equatorial system from input coordinates.
-*/
+------------------------------------------------------------------------
 
-   r = rai * 15.0 * DEG2RAD;
-   d = deci * DEG2RAD;
-   pos1[0] = cos (d) * cos (r);
-   pos1[1] = cos (d) * sin (r);
-   pos1[2] = sin (d);
+   PURPOSE:
+      This function is the version of 'make_frame' that keeps the
+      values saved between calls in the computation context 'ctx', so
+      that different contexts can be used concurrently from different
+      threads.
 
-/*
-   Rotate position vector to galactic system, using Hipparcos
-   documentation eq. 1.5.13.
-*/
+   REFERENCES:
+      See function 'place'.
 
-   pos2[0] = ag[0][0] * pos1[0] + ag[1][0] * pos1[1] +
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'make_frame'.
 
-             ag[2][0] * pos1[2];
+   OUTPUT
+   ARGUMENTS:
+      See function 'make_frame'.
 
-   pos2[1] = ag[0][1] * pos1[0] + ag[1][1] * pos1[1] +
+   RETURNED
+   VALUE:
+      See function 'make_frame'.
 
-             ag[2][1] * pos1[2];
+   GLOBALS
+   USED:
+      T0                 novascon.c
 
-   pos2[2] = ag[0][2] * pos1[0] + ag[1][2] * pos1[1] +
+   FUNCTIONS
+   CALLED:
+      make_cat_entry     novas.c
+      make_object        novas.c
+      tdb2tt             novas.c
+      ephemeris_ctx      novas.c
+      geo_posvel_ctx     novas.c
+      bary2obs           novas.c
+      frame_tie_ctx      novas.c
+      precession_ctx     novas.c
+      nutation_ctx       novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      sqrt               math.h
 
-             ag[2][2] * pos1[2];
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
 
-/*
-   Decompose galactic vector into longitude and latitude.
+   NOTES:
+      1. The steps are those of 'place' for the same arguments.  The
+      deflecting bodies are those of 'grav_def': the Sun, Jupiter and
+      Saturn at full accuracy, the Sun only at reduced accuracy.
+      2. For coord_sys = 1 the frame tie, precession and nutation are
+      combined into one matrix.
+
+------------------------------------------------------------------------
 */
+{
+   char body_name[3][8] = {"Sun", "Jupiter", "Saturn"};
 
-   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
+   const short int body_num[3] = {10, 5, 6};
 
-   if (xyproj > 0.0)
-      g = atan2 (pos2[1], pos2[0]);
-    else
-      g = 0.0;
+   short int error = 0;
+   short int rs, i, j;
 
-   *glon = g * RAD2DEG;
-   if (*glon < 0.0)
-      *glon += 360.0;
+   double x, secdif, jd[2], vog[3], pos1[3], pos2[3], pos3[3], r_cio;
 
-   g = atan2 (pos2[2], xyproj);
-   *glat = g * RAD2DEG;
+   cat_entry null_star;
 
-   return;
-}
+   object earth, sun, body;
 
-/********equ2ecl */
+/*
+   Check for invalid value of 'coord_sys' or 'accuracy'.
+*/
 
-short int equ2ecl (double jd_tt, short int coord_sys,
-                   short int accuracy, double ra, double dec,
+   if ((coord_sys < 0) || (coord_sys > 3))
+      return (error = 1);
+
+   if ((accuracy < 0) || (accuracy > 1))
+      return (error = 2);
+
+   frame->coord_sys = coord_sys;
+   frame->accuracy = accuracy;
+
+   make_cat_entry ("NULL_STAR","   ",0L,0.0,0.0,0.0,0.0,0.0,0.0,
+      &null_star);
+
+   make_object (0,3,"Earth",&null_star, &earth);
+   make_object (0,10,"Sun",&null_star, &sun);
 
-                   double *elon, double *elat)
 /*
-------------------------------------------------------------------------
+   Compute 'jd_tdb', the TDB Julian date corresponding to 'jd_tt', and
+   get the barycentric position and velocity of the Earth and the
+   position of the Sun.
+*/
 
-   PURPOSE:
-      To convert right ascension and declination to ecliptic longitude
-      and latitude.
+   frame->jd_tdb = jd_tt;
+   tdb2tt (frame->jd_tdb, &x,&secdif);
+   frame->jd_tdb = jd_tt + secdif / 86400.0;
 
-   REFERENCES:
-      None.
+   jd[0] = frame->jd_tdb;
+   jd[1] = 0.0;
 
-   INPUT
-   ARGUMENTS:
-      jd_tt (double)
-         TT Julian date of equator, equinox, and ecliptic used for
-         coordinates.
-      coord_sys (short int)
-         Coordinate system selection.
-            = 0 ... mean equator and equinox of date 'jd_tt'
-            = 1 ... true equator and equinox of date 'jd_tt'
-            = 2 ... ICRS
-            (ecliptic is always the mean plane)
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      ra (double)
-         Right ascension in hours, referred to specified equator and
-         equinox of date.
-      dec (double)
-         Declination in degrees, referred to specified equator and
-         equinox of date.
+   if ((error = ephemeris_ctx (ctx,jd,&earth,0,accuracy, frame->peb,
+      frame->veb)) != 0)
+      return (error += 10);
 
-   OUTPUT
-   ARGUMENTS:
-      *elon (double)
-         Ecliptic longitude in degrees, referred to specified ecliptic
-         and equinox of date.
-      *elat (double)
-         Ecliptic latitude in degrees, referred to specified ecliptic
-         and equinox of date.
+   if ((error = ephemeris_ctx (ctx,jd,&sun,0,accuracy, frame->psb,
+      NULL)) != 0)
+      return (error += 10);
 
-   RETURNED
-   VALUE:
-      (short int)
-         = 0 ... everything OK
-         = 1 ... invalid value of 'coord_sys'
+/*
+   Get the position and velocity of the observer.
+*/
 
-   GLOBALS
-   USED:
-      DEG2RAD, RAD2DEG   novascon.c
+   if ((location->where == 1) || (location->where == 2))
+   {
+      if ((error = geo_posvel_ctx (ctx,jd_tt,delta_t,accuracy,location,
+         frame->pog,vog)) != 0)
+         return (error += 40);
 
-   FUNCTIONS
-   CALLED:
-      equ2ecl_vec        novas.c
-      sin                math.h
-      cos                math.h
-      sqrt               math.h
-      atan2              math.h
+      frame->loc = 1;
+   }
+    else
+   {
+      for (i = 0; i < 3; i++)
+      {
+         frame->pog[i] = 0.0;
+         vog[i] = 0.0;
+      }
 
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/11-03/JAB (USNO/AA)
-      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V1.2/05-06/JAB (USNO/AA) Use vector transformation function.
-      V1.3/05-08/WKP (USNO/AA) Changed values of coord_sys to be
-                               more consistent with gcrs2equ.
+      frame->loc = 0;
+   }
 
-   NOTES:
-      1. To convert ICRS RA and dec to ecliptic coordinates (mean
-      ecliptic and equinox of J2000.0), set 'coord_sys' = 2; the value
-      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
-      Except for the input to this case, all input coordinates
-      are dynamical.
-      2. This function is the C version of NOVAS Fortran routine
-      'eqecl'.
+   for (i = 0; i < 3; i++)
+   {
+      frame->pob[i] = frame->peb[i] + frame->pog[i];
+      frame->vob[i] = frame->veb[i] + vog[i];
+   }
 
-------------------------------------------------------------------------
+/*
+   Distances observer-geocenter and observer-Sun, for 'rad_vel'.
 */
-{
-   short int error = 0;
 
-   double r, d, pos1[3], pos2[3], xyproj, e;
+   frame->d_obs_geo = 0.0;
+   frame->d_obs_sun = 0.0;
 
-/*
-   Form position vector in equatorial system from input coordinates.
-*/
+   for (i = 0; i < 3; i++)
+   {
+      pos1[i] = frame->pob[i] - frame->peb[i];
+      pos2[i] = frame->pob[i] - frame->psb[i];
+      frame->d_obs_geo += pos1[i] * pos1[i];
+      frame->d_obs_sun += pos2[i] * pos2[i];
+   }
 
-   r = ra * 15.0 * DEG2RAD;
-   d = dec * DEG2RAD;
-   pos1[0] = cos (d) * cos (r);
-   pos1[1] = cos (d) * sin (r);
-   pos1[2] = sin (d);
+   frame->d_obs_geo = sqrt (frame->d_obs_geo);
+   frame->d_obs_sun = sqrt (frame->d_obs_sun);
 
 /*
-   Convert the vector from equatorial to ecliptic system.
+   Positions and velocities of the deflecting bodies at 'jd_tdb'.
 */
 
-   if ((error = equ2ecl_vec (jd_tt,coord_sys,accuracy,pos1, pos2)) != 0)
-      return (error);
+   frame->nbodies = (accuracy == 0) ? 3 : 1;
+
+   for (i = 0; i < frame->nbodies; i++)
+   {
+      make_object (0,body_num[i],body_name[i],&null_star, &body);
+
+      frame->body_num[i] = body_num[i];
+      if ((error = ephemeris_ctx (ctx,jd,&body,0,accuracy,
+         frame->pbody[i],frame->vbody[i])) != 0)
+         return (error += 70);
+
+      bary2obs (frame->pbody[i],frame->pob, frame->pbodyo[i],&x);
+   }
 
 /*
-   Decompose ecliptic vector into ecliptic longitude and latitude.
+   Rotation from the GCRS to the output system.
 */
 
-   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
+   switch (coord_sys)
+   {
+      case (1):    /* Equator and equinox of date. */
 
-   if (xyproj > 0.0)
-      e = atan2 (pos2[1], pos2[0]);
-    else
-      e = 0.0;
+         for (j = 0; j < 3; j++)
+         {
+            for (i = 0; i < 3; i++)
+               pos1[i] = (i == j) ? 1.0 : 0.0;
 
-   *elon = e * RAD2DEG;
-   if (*elon < 0.0)
-      *elon += 360.0;
+            frame_tie_ctx (ctx,pos1,1, pos2);
+            precession_ctx (ctx,T0,pos2,frame->jd_tdb, pos3);
+            nutation_ctx (ctx,frame->jd_tdb,0,accuracy,pos3, pos1);
 
-   e = atan2 (pos2[2], xyproj);
-   *elat = e * RAD2DEG;
+            for (i = 0; i < 3; i++)
+               frame->rot[i][j] = pos1[i];
+         }
+         break;
+
+      case (2):    /* Equator and CIO of date. */
+
+         if ((error = cio_location_ctx (ctx,frame->jd_tdb,accuracy,
+            &r_cio,&rs)) != 0)
+            return (error += 80);
+         if ((error = cio_basis_ctx (ctx,frame->jd_tdb,r_cio,rs,
+            accuracy, frame->rot[0],frame->rot[1],frame->rot[2])) != 0)
+            return (error += 90);
+         break;
+
+      default:     /* GCRS, or ICRS for astrometric coordinates. */
+
+         for (i = 0; i < 3; i++)
+         {
+            for (j = 0; j < 3; j++)
+               frame->rot[i][j] = (i == j) ? 1.0 : 0.0;
+         }
+   }
 
    return (error);
 }
 
-/********equ2ecl_vec */
+/********frame_place */
 
-short int equ2ecl_vec (double jd_tt, short int coord_sys,
-                       short int accuracy, double *pos1,
+void frame_place (novas_frame *frame, cat_entry *star,
 
-                       double *pos2)
+                  sky_pos *output)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Converts an equatorial position vector to an ecliptic position
-      vector.
+      This function computes the place of a star in a frame made with
+      'make_frame': the result of 'place' for the date, observer,
+      coordinate system and accuracy of the frame.
 
    REFERENCES:
-      None.
+      See function 'place'.
 
    INPUT
    ARGUMENTS:
-      jd_tt (double)
-         TT Julian date of equator, equinox, and ecliptic used for
-         coordinates.
-      coord_sys (short int)
-         Coordinate system selection.
-            = 0 ... mean equator and equinox of date 'jd_tt'
-            = 1 ... true equator and equinox of date 'jd_tt'
-            = 2 ... ICRS
-            (ecliptic is always the mean plane)
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      pos1[3] (double)
-         Position vector, referred to specified equator and equinox of
-         date.
+      *frame (struct novas_frame)
+         Frame of the date and observer (not modified).
+      *star (struct cat_entry)
+         Pointer to catalog entry structure containing catalog data for
+         the star in the ICRS (defined in novas.h).
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, referred to specified ecliptic and equinox
-         of date.
+      *output (struct sky_pos)
+         Output data specifying the star's place on the sky at time
+         'jd_tt', with respect to the specified output coordinate
+         system (defined in novas.h).
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK
-         = 1 ... invalid value of 'coord_sys'
+      None.
 
    GLOBALS
    USED:
-      T0, DEG2RAD        novascon.c
+      T0, C_AUDAY        novascon.c
+      RMASS              novascon.c
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      e_tilt             novas.c
-      frame_tie          novas.c
-      fabs               math.h
-      sin                math.h
-      cos                math.h
+      starvectors        novas.c
+      d_light            novas.c
+      proper_motion      novas.c
+      bary2obs           novas.c
+      limb_angle         novas.c
+      grav_vec           novas.c
+      aberration         novas.c
+      rad_vel            novas.c
+      vector2radec       novas.c
+      sqrt               math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/05-06/JAB (USNO/AA)
-      V1.1/05-08/WKP (USNO/AA) Changed values of coord_sys to be
-                               more consistent with gcrs2equ.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. To convert an ICRS vector to an ecliptic vector (mean ecliptic
-      and equinox of J2000.0 only), set 'coord_sys' = 2; the value
-      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
-      Except for the input to this case, all vectors are assumed
-      to be with respect to a dynamical system.
-      2. This function is the C version of NOVAS Fortran routine
-      'eqec'.
+      1. Only the steps of 'place' that depend on the star are done:
+      space motion, parallax, deflection, aberration, one rotation and
+      the radial velocity.  The function keeps no static data, so it
+      can be called from several threads with the same frame.
+      2. As in 'grav_def', each deflecting body is taken at the time
+      the light passed closest to it; here its position is extrapolated
+      from 'jd_tdb' with its velocity instead of being read again from
+      the ephemeris.  For the Sun, Jupiter and Saturn the difference
+      in the deflection is below 1 microarcsecond.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
+   short int loc, i;
 
-   static double t_last = 0.0;
-   static double ob2000 = 0.0;
-   static double oblm, oblt;
-   double t, secdiff, jd_tdb, pos0[3], w, x, y, z, obl;
+   double pos1[3], vel1[3], pos2[3], pos3[3], pos4[3], pos5[3],
+      pos8[3], pbody[3], dt, t_light, x, frlimb, tlt, dlt, tclose;
+
+   object cel_obj;
 
 /*
-   'jd_tdb' is the TDB Julian date corresponding to 'jd_tt'.
+   Only 'type' and 'star' are used by 'rad_vel'.
 */
 
-   tdb2tt (jd_tt, &t,&secdiff);
-   jd_tdb = jd_tt + secdiff / 86400.0;
+   cel_obj.type = 2;
+   cel_obj.number = 0;
+   cel_obj.name[0] = '\0';
+   cel_obj.star = *star;
 
 /*
-   Get obliquity, depending upon the "system" of the input coordinates.
+   Get position of star updated for its space motion, and position of
+   star wrt observer (corrected for parallax).
 */
 
-   switch (coord_sys)
+   starvectors (star, pos1,vel1);
+   dt = d_light (pos1,frame->pob);
+   proper_motion (T0,pos1,vel1,(frame->jd_tdb + dt), pos2);
+
+   bary2obs (pos2,frame->pob, pos3,&t_light);
+   output->dis = 0.0;
+
+/*
+   Apply gravitational deflection of light and aberration, except for
+   astrometric place.
+*/
+
+   if (frame->coord_sys == 3)
    {
-      case 0:             /* Input: mean equator and equinox of date */
-      case 1:             /* Input: true equator and equinox of date */
-         pos0[0] = pos1[0];
-         pos0[1] = pos1[1];
-         pos0[2] = pos1[2];
-         if (fabs (jd_tt - t_last) > 1.0e-8)
-         {
-            e_tilt (jd_tdb,accuracy, &oblm,&oblt,&x,&y,&z);
-            t_last = jd_tt;
-         }
+      for (i = 0; i < 3; i++)
+      {
+         pos5[i] = pos3[i];
+      }
+   }
+    else
+   {
+      loc = frame->loc;
+      if (loc == 1)
+      {
+         limb_angle (pos3,frame->pog, &x,&frlimb);
+         if (frlimb < 0.8)
+            loc = 0;
+      }
 
-         switch (coord_sys)
-         {
-            case 0:       /* Use mean obliquity of date */
-               obl = oblm * DEG2RAD;
-               break;
-            case 1:       /* Use true obliquity of date */
-               obl = oblt * DEG2RAD;
-               break;
-         }
-         break;
+      for (i = 0; i < 3; i++)
+      {
+         pos4[i] = pos3[i];
+      }
 
-    case 2:             /* Input: ICRS */
-        frame_tie (pos1,1, pos0);
+      tlt = sqrt (pos3[0] * pos3[0] + pos3[1] * pos3[1] +
+         pos3[2] * pos3[2]) / C_AUDAY;
 
-        if (ob2000 == 0.0)
-        {
-        e_tilt (T0,accuracy, &oblm,&w,&x,&y,&z);
-        ob2000 = oblm;
-        }
-        obl = ob2000 * DEG2RAD;
-        break;
+      for (i = 0; i < frame->nbodies; i++)
+      {
+         dlt = d_light (pos4,frame->pbodyo[i]);
 
-    default:
-        error = 1;
-        return (error);
+         tclose = frame->jd_tdb;
+
+         if (dlt > 0.0)
+            tclose = frame->jd_tdb - dlt;
+
+         if (tlt < dlt)
+            tclose = frame->jd_tdb - tlt;
+
+         dt = tclose - frame->jd_tdb;
+         pbody[0] = frame->pbody[i][0] + frame->vbody[i][0] * dt;
+         pbody[1] = frame->pbody[i][1] + frame->vbody[i][1] * dt;
+         pbody[2] = frame->pbody[i][2] + frame->vbody[i][2] * dt;
+
+         grav_vec (pos4,frame->pob,pbody,RMASS[frame->body_num[i]],
+            pos4);
+      }
+
+      if (loc != 0)
+         grav_vec (pos4,frame->pob,frame->peb,RMASS[3], pos4);
+
+      aberration (pos4,frame->vob,t_light, pos5);
    }
 
 /*
-   Rotate position vector to ecliptic system.
+   Rotate to the output system.
 */
 
-   pos2[0] =  pos0[0];
-   pos2[1] =  pos0[1] * cos (obl) + pos0[2] * sin (obl);
-   pos2[2] = -pos0[1] * sin (obl) + pos0[2] * cos (obl);
+   for (i = 0; i < 3; i++)
+   {
+      pos8[i] = frame->rot[i][0] * pos5[0] +
+                frame->rot[i][1] * pos5[1] +
+                frame->rot[i][2] * pos5[2];
+   }
 
-   return (error);
-}
+/*
+   Radial velocity ('d_obj_sun' is not used for stars) and spherical
+   coordinates.
+*/
 
-/********ecl2equ_vec */
+   rad_vel (&cel_obj,pos3,vel1,frame->vob,frame->d_obs_geo,
+      frame->d_obs_sun,0.0, &output->rv);
 
-short int ecl2equ_vec (double jd_tt, short int coord_sys,
-                       short int accuracy, double *pos1,
+   vector2radec (pos8, &output->ra,&output->dec);
 
-                       double *pos2)
+   x = sqrt (pos8[0] * pos8[0] + pos8[1] * pos8[1] + pos8[2] * pos8[2]);
+
+   for (i = 0; i < 3; i++)
+   {
+      output->r_hat[i] = pos8[i] / x;
+   }
+
+   return;
+}
+
+/********place_grid */
+
+short int place_grid (long int n_targets, object *targets,
+                      long int n_epochs, double *jd_tt, double *delta_t,
+                      long int n_stations, observer *stations,
+                      short int coord_sys, short int accuracy,
+                      char *ephem_name, short int n_threads,
+
+                      sky_pos *output, short int *errors)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Converts an ecliptic position vector to an equatorial position
-      vector.
+      This function computes the places of several targets, at several
+      epochs, for several observers: the result of 'place' for each
+      combination, with the work shared among several threads.
 
    REFERENCES:
-      None.
+      See function 'place'.
 
    INPUT
    ARGUMENTS:
-      jd_tt (double)
-         TT Julian date of equator, equinox, and ecliptic used for
-         coordinates.
+      n_targets (long int)
+         Number of targets.
+      *targets (struct object)
+         Targets: stars or solar system bodies ('n_targets' values,
+         defined in novas.h).
+      n_epochs (long int)
+         Number of epochs.
+      *jd_tt (double)
+         TT Julian dates of the epochs ('n_epochs' values).
+      *delta_t (double)
+         Difference TT-UT1 at each epoch, in seconds of time
+         ('n_epochs' values).
+      n_stations (long int)
+         Number of observers.
+      *stations (struct observer)
+         Observers ('n_stations' values, defined in novas.h).
       coord_sys (short int)
-         Coordinate system selection.
-            = 0 ... mean equator and equinox of date
-            = 1 ... true equator and equinox of date
-            = 2 ... ICRS
-            (ecliptic is always the mean plane)
+         Code specifying coordinate system of the output position, as
+         in 'place'.
       accuracy (short int)
-         Selection for accuracy
+         Code specifying the relative accuracy of the output position.
             = 0 ... full accuracy
             = 1 ... reduced accuracy
-      pos1[3] (double)
-         Position vector, referred to specified ecliptic and equinox of
-         date.  If 'coord_sys' = 2, 'pos1' must be on mean ecliptic and
-         equinox of J2000.0; see Note 1 below.
+      *ephem_name (char)
+         Name of the JPL ephemeris file, opened by each thread with
+         'ephem_open_r' (see note 3); NULL if no file is needed.
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
 
    OUTPUT
    ARGUMENTS:
-      POS2[3] (double)
-         Position vector, referred to specified equator and equinox
-         of date.
+      *output (struct sky_pos)
+         Places, 'n_targets' * 'n_epochs' * 'n_stations' values.  The
+         place of target 'm' at epoch 't' for observer 's' is
+         output[(t * n_stations + s) * n_targets + m].
+      *errors (short int)
+         Error code of 'place' for each place, in the same order as
+         'output'.  May be NULL.
 
    RETURNED
    VALUE:
       (short int)
-         = 0 ... everything OK
-         = 1 ... invalid value of 'coord_sys'
+         = 0 ... Everything OK.
+         = 1 ... 'n_targets', 'n_epochs' or 'n_stations' < 0.
+         = 2 ... Not enough memory.
+         > 10, < 100 ... 10 + error from function 'ephem_open_r'.
+         > 100 ... 100 + error from function 'place' for the first
+                   place, in the order of 'output', that failed.
 
    GLOBALS
    USED:
-      T0, DEG2RAD        novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      e_tilt             novas.c
-      frame_tie          novas.c
-      fabs               math.h
-      sin                math.h
-      cos                math.h
+      novas_worker_count         parallel.cpp
+      novas_context_create       novas.c
+      novas_context_set_ephemeris novas.c
+      novas_context_free         novas.c
+      ephem_open_r               eph_manager.c
+      ephem_close_r              eph_manager.c
+      novas_parallel_tasks       parallel.cpp
+      grid_tile                  novas.c
+      calloc                     stdlib.h
+      free                       stdlib.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/05-06/JAB (USNO/AA)
-      V1.1/05-08/WKP (USNO/AA) Changed values of coord_sys to be
-                               more consistent with gcrs2equ.
-      V1.2/09-10/WKP (USNO/AA) Initialized 'obl' variable to silence
-                               compiler warning.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. To convert an ecliptic vector (mean ecliptic and equinox of
-      J2000.0 only) to an ICRS vector, set 'coord_sys' = 2; the value
-      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
-      Except for the output from this case, all vectors are assumed to
-      be with respect to a dynamical system.
-      2. This function is the C version of NOVAS Fortran routine
-      'eceq'.
+      1. The grid is cut in tiles of one epoch, one observer and up to
+      GRID_TILE targets, numbered epoch by epoch, and the tiles are
+      distributed among the threads by 'novas_parallel_tasks': each
+      thread takes a run of consecutive tiles, so that the values saved
+      for an epoch are reused, and takes tiles from the other threads
+      when it has finished its own.
+      2. Each thread has its own 'novas_context'.  In each tile the
+      quantities of the epoch and observer are computed once with
+      'make_frame_ctx', and the places of the stars are given by
+      'frame_place' (they agree with 'place' to a few
+      nanoarcseconds); the solar system bodies go through 'place_ctx'.
+      The results do not depend on the number of threads or on the
+      order in which the tiles are done.
+      3. With the JPL backend ('set_solsys_backend'), 'ephem_name' must
+      name the file, since the file opened by 'ephem_open' cannot be
+      read from several threads.  The settings of the library (backend,
+      nutation source, ...) must not be changed during the call.
 
 ------------------------------------------------------------------------
 */
 {
    short int error = 0;
+   short int n_workers, w, de_num;
 
-   static double t_last = 0.0;
-   static double ob2000 = 0.0;
-   static double oblm, oblt;
-   double t, secdiff, jd_tdb, pos0[3], w, x, y, z, obl = 0.0;
+   long int n_blocks, n_tiles, i;
+
+   double jd_beg, jd_end;
+
+   grid_data data;
+
+   novas_context **ctx = NULL;
+
+   ephem_handle **eph = NULL;
+
+   if ((n_targets < 0) || (n_epochs < 0) || (n_stations < 0))
+      return (error = 1);
+
+   n_blocks = (n_targets + GRID_TILE - 1) / GRID_TILE;
+   n_tiles = n_epochs * n_stations * n_blocks;
+   if (n_tiles == 0)
+      return (error = 0);
+
+   n_workers = novas_worker_count (n_threads,n_tiles);
 
 /*
-   'jd_tdb' is the TDB Julian date.
+   Context, and ephemeris file, of each worker.
 */
 
-   tdb2tt (jd_tt, &t,&secdiff);
-   jd_tdb = jd_tt + secdiff / 86400.0;
+   data.tile_error = (short int *) calloc ((size_t) n_tiles,
+      sizeof (short int));
+   ctx = (novas_context **) calloc ((size_t) n_workers,
+      sizeof (novas_context *));
+   eph = (ephem_handle **) calloc ((size_t) n_workers,
+      sizeof (ephem_handle *));
+
+   if ((data.tile_error == NULL) || (ctx == NULL) || (eph == NULL))
+      error = 2;
+
+   for (w = 0; (error == 0) && (w < n_workers); w++)
+   {
+      if ((ctx[w] = novas_context_create ()) == NULL)
+      {
+         error = 2;
+      }
+       else if (ephem_name != NULL)
+      {
+         if ((error = ephem_open_r (ephem_name,EPH_MODE_MMAP,&eph[w],
+            &jd_beg,&jd_end,&de_num)) != 0)
+            error += 10;
+          else
+            novas_context_set_ephemeris (ctx[w],eph[w]);
+      }
+   }
 
 /*
-   Get obliquity, depending upon the "system" of the input coordinates.
+   Compute the tiles.
 */
 
-   switch (coord_sys)
+   if (error == 0)
    {
-      case 0:             /* Output: mean equator and equinox of date */
-      case 1:             /* Output: true equator and equinox of date */
-         if (fabs (jd_tt - t_last) > 1.0e-8)
-         {
-            e_tilt (jd_tdb,accuracy, &oblm,&oblt,&x,&y,&z);
-            t_last = jd_tt;
-         }
+      data.n_targets = n_targets;
+      data.targets = targets;
+      data.jd_tt = jd_tt;
+      data.delta_t = delta_t;
+      data.n_stations = n_stations;
+      data.stations = stations;
+      data.n_blocks = n_blocks;
+      data.coord_sys = coord_sys;
+      data.accuracy = accuracy;
+      data.ctx = ctx;
+      data.output = output;
+      data.errors = errors;
 
-         switch (coord_sys)
-         {
-            case 0:       /* Use mean obliquity of date */
-               obl = oblm * DEG2RAD;
-               break;
-            case 1:       /* Use true obliquity of date */
-               obl = oblt * DEG2RAD;
-               break;
-         }
-         break;
+      novas_parallel_tasks (n_tiles,n_workers,grid_tile,&data);
 
-      case 2:             /* Output: ICRS */
-         if (ob2000 == 0.0)
+      for (i = 0; i < n_tiles; i++)
+      {
+         if (data.tile_error[i] != 0)
          {
-            e_tilt (T0,accuracy, &oblm,&w,&x,&y,&z);
-            ob2000 = oblm;
+            error = 100 + data.tile_error[i];
+            break;
          }
-         obl = ob2000 * DEG2RAD;
-         break;
-
-      default:
-         return (error = 1);
+      }
    }
 
 /*
-   Rotate position vector to ecliptic system.
+   Release the contexts and files.
 */
 
-   pos2[0] = pos1[0];
-   pos2[1] = pos1[1] * cos (obl) - pos1[2] * sin (obl);
-   pos2[2] = pos1[1] * sin (obl) + pos1[2] * cos (obl);
+   for (w = 0; (ctx != NULL) && (w < n_workers); w++)
+      if (ctx[w] != NULL)
+         novas_context_free (ctx[w]);
 
-/*
-   Case where output vector is to be in ICRS, rotate from dynamical
-   system to ICRS.
-*/
+   for (w = 0; (eph != NULL) && (w < n_workers); w++)
+      if (eph[w] != NULL)
+         ephem_close_r (eph[w]);
 
-   if (coord_sys == 2)
-   {
-      pos0[0] = pos2[0];
-      pos0[1] = pos2[1];
-      pos0[2] = pos2[2];
-      frame_tie (pos0,-1, pos2);
-   }
+   free (eph);
+   free (ctx);
+   free (data.tile_error);
 
    return (error);
 }
 
-/********equ2hor */
+/********equ2gal */
 
-void equ2hor (double jd_ut1, double delta_t, short int accuracy,
-              double xp, double yp, on_surface *location, double ra,
-              double dec, short int ref_option,
+void equ2gal (double rai, double deci,
 
-              double *zd, double *az, double *rar, double *decr)
+              double *glon, double *glat)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function transforms topocentric right ascension and
-      declination to zenith distance and azimuth.  It uses a method
-      that properly accounts for polar motion, which is significant at
-      the sub-arcsecond level.  This function can also adjust
-      coordinates for atmospheric refraction.
+      To convert ICRS right ascension and declination to galactic
+      longitude and latitude.
 
    REFERENCES:
-      Kaplan, G. (2008). USNO/AA Technical Note of 28 Apr 2008,
-         "Refraction as a Vector."
+      Hipparcos and Tycho Catalogues, Vol. 1, Section 1.5.3.
 
    INPUT
    ARGUMENTS:
-      jd_ut1 (double)
-         UT1 Julian date.
-      delta_t (double)
-         Difference TT-UT1 at 'jd_ut1', in seconds.
-      accuracy (short int)
-         Selection for method and accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      xp (double)
-         Conventionally-defined x coordinate of celestial intermediate
-         pole with respect to ITRS reference pole, in arcseconds.
-      yp (double)
-         Conventionally-defined y coordinate of celestial intermediate
-         pole with respect to ITRS reference pole, in arcseconds.
-      *location (struct on_surface)
-         Pointer to structure containing observer's location (defined
-         in novas.h).
-      ra (double)
-         Topocentric right ascension of object of interest, in hours,
-         referred to true equator and equinox of date.
-      dec (double)
-         Topocentric declination of object of interest, in degrees,
-         referred to true equator and equinox of date.
-      ref_option (short int)
-         = 0 ... no refraction
-         = 1 ... include refraction, using 'standard' atmospheric
-                 conditions.
-         = 2 ... include refraction, using atmospheric parameters
-                 input in the 'location' structure.
+      rai (double)
+         ICRS right ascension in hours.
+      deci (double)
+         ICRS declination in degrees.
 
    OUTPUT
    ARGUMENTS:
-      *zd (double)
-         Topocentric zenith distance in degrees, affected by
-         refraction if 'ref_option' is non-zero.
-      *az (double)
-         Topocentric azimuth (measured east from north) in degrees.
-      *rar (double)
-         Topocentric right ascension of object of interest, in hours,
-         referred to true equator and equinox of date, affected by
-         refraction if 'ref_option' is non-zero.
-      *decr (double)
-         Topocentric declination of object of interest, in degrees,
-         referred to true equator and equinox of date, affected by
-         refraction if 'ref_option' is non-zero.
+      *glon (double)
+         Galactic longitude in degrees.
+      *glat (double)
+         Galactic latitude in degrees.
 
    RETURNED
    VALUE:
@@ -2547,1612 +3691,1307 @@ void equ2hor (double jd_ut1, double delta_t, short int accuracy,
 
    FUNCTIONS
    CALLED:
-      ter2cel            novas.c
-      refract            novas.c
       sin                math.h
       cos                math.h
       sqrt               math.h
       atan2              math.h
-      fabs               math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-98/JAB (USNO/AA)
-      V2.0/01-06/JAB (USNO/AA)
-      V2.1/01-06/WKP (USNO/AA): Changed 'mode' to 'accuracy'.
-      V2.2/11-07/JAB (USNO/AA): Cosmetic changes.
-      V2.2/05-08/WKP (USNO/AA): Updated the refraction algorithm.
-      V2.3/06-08/WKP (USNO/AA): Tweaked convergence criteria.
-      V2.4/03-09/JAB (USNO/AA): Conformed input variables to IERS
-                                conventions.
+      V1.0/11-03/JAB (USNO/AA)
+      V1.1/03-06/JAB (USNO/AA): Fixed initialization of 'ag'.
+      V1.2/03-11/WKP (USNO/AA): Added braces to 2-D array initialization
+                                to quiet gcc warnings.
 
    NOTES:
-      1. 'xp' and 'yp' can be set to zero if sub-arcsecond accuracy is
-      not needed.  'ra' and 'dec' can be obtained from functions
-      'tpstar' or 'tpplan'.
-      2. The directions 'zd'= 0 (zenith) and 'az'= 0 (north) are here
-      considered fixed in the terrestrial system.  Specifically, the
-      zenith is along the geodetic normal, and north is toward
-      the ITRS pole.
-      3. If 'ref_option'= 0, then 'rar'='ra' and 'decr'='dec'.
-      4. This function is the C version of NOVAS Fortran routine
-      'zdaz'.
+      1. This function uses the coordinate transformation specified
+      in the reference.
+      2. This function is the C version of NOVAS Fortran routine
+      'eqgal'.
 
 ------------------------------------------------------------------------
 */
 {
-   short int j;
-
-   double sinlat, coslat, sinlon, coslon, sindc, cosdc, sinra, cosra,
-      uze[3], une[3], uwe[3], uz[3], un[3], uw[3], p[3], pz, pn, pw,
-      proj, zd0, zd1, refr, sinzd, coszd, sinzd0, coszd0, pr[3];
+   double r, d, pos1[3], pos2[3], xyproj, g;
 
 /*
-   Preliminaries.
+   Rotation matrix A_g from Hipparcos documentation eq. 1.5.11.
 */
 
-   *rar = ra;
-   *decr = dec;
-
-   sinlat = sin (location->latitude * DEG2RAD);
-   coslat = cos (location->latitude * DEG2RAD);
-   sinlon = sin (location->longitude * DEG2RAD);
-   coslon = cos (location->longitude * DEG2RAD);
-   sindc = sin (dec * DEG2RAD);
-   cosdc = cos (dec * DEG2RAD);
-   sinra = sin (ra * 15.0 * DEG2RAD);
-   cosra = cos (ra * 15.0 * DEG2RAD);
-
-/*
-   Set up orthonormal basis vectors in local Earth-fixed system.
-
-   Define vector toward local zenith in Earth-fixed system (z axis).
-*/
-   uze[0] = coslat * coslon;
-   uze[1] = coslat * sinlon;
-   uze[2] = sinlat;
+   double ag[3][3] = {
+      {-0.0548755604, +0.4941094279, -0.8676661490},
+      {-0.8734370902, -0.4448296300, -0.1980763734},
+      {-0.4838350155, +0.7469822445, +0.4559837762}};
 
 /*
-   Define vector toward local north in Earth-fixed system (x axis).
+   Form position vector in equatorial system from input coordinates.
 */
 
-   une[0] = -sinlat * coslon;
-   une[1] = -sinlat * sinlon;
-   une[2] = coslat;
+   r = rai * 15.0 * DEG2RAD;
+   d = deci * DEG2RAD;
+   pos1[0] = cos (d) * cos (r);
+   pos1[1] = cos (d) * sin (r);
+   pos1[2] = sin (d);
 
 /*
-   Define vector toward local west in Earth-fixed system (y axis).
+   Rotate position vector to galactic system, using Hipparcos
+   documentation eq. 1.5.13.
 */
 
-   uwe[0] = sinlon;
-   uwe[1] = -coslon;
-   uwe[2] = 0.0;
-
-/*
-   Obtain vectors in celestial system.
-
-   Rotate Earth-fixed orthonormal basis vectors to celestial system
-   (wrt equator and equinox of date).
-*/
-
-   ter2cel (jd_ut1,0.0,delta_t,1,accuracy,1,xp,yp,uze, uz);
-   ter2cel (jd_ut1,0.0,delta_t,1,accuracy,1,xp,yp,une, un);
-   ter2cel (jd_ut1,0.0,delta_t,1,accuracy,1,xp,yp,uwe, uw);
+   pos2[0] = ag[0][0] * pos1[0] + ag[1][0] * pos1[1] +
 
-/*
-   Define unit vector 'p' toward object in celestial system
-   (wrt equator and equinox of date).
-*/
+             ag[2][0] * pos1[2];
 
-   p[0] = cosdc * cosra;
-   p[1] = cosdc * sinra;
-   p[2] = sindc;
+   pos2[1] = ag[0][1] * pos1[0] + ag[1][1] * pos1[1] +
 
-/*
-   Compute coordinates of object wrt orthonormal basis.
+             ag[2][1] * pos1[2];
 
-   Compute components of 'p' - projections of 'p' onto rotated
-   Earth-fixed basis vectors.
-*/
+   pos2[2] = ag[0][2] * pos1[0] + ag[1][2] * pos1[1] +
 
-   pz = p[0] * uz[0] + p[1] * uz[1] + p[2] * uz[2];
-   pn = p[0] * un[0] + p[1] * un[1] + p[2] * un[2];
-   pw = p[0] * uw[0] + p[1] * uw[1] + p[2] * uw[2];
+             ag[2][2] * pos1[2];
 
 /*
-   Compute azimuth and zenith distance.
+   Decompose galactic vector into longitude and latitude.
 */
 
-   proj = sqrt (pn * pn + pw * pw);
+   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
 
-   if (proj > 0.0)
-      *az = -atan2 (pw, pn) * RAD2DEG;
+   if (xyproj > 0.0)
+      g = atan2 (pos2[1], pos2[0]);
+    else
+      g = 0.0;
 
-   if (*az < 0.0)
-      *az += 360.0;
+   *glon = g * RAD2DEG;
+   if (*glon < 0.0)
+      *glon += 360.0;
 
-   if (*az >= 360.0)
-      *az -= 360.0;
+   g = atan2 (pos2[2], xyproj);
+   *glat = g * RAD2DEG;
 
-   *zd = atan2 (proj, pz) * RAD2DEG;
+   return;
+}
 
-/*
-   Apply atmospheric refraction if requested.
-*/
+/********equ2ecl */
 
-   if (ref_option != 0)
-   {
+short int equ2ecl (double jd_tt, short int coord_sys,
+                   short int accuracy, double ra, double dec,
 
+                   double *elon, double *elat)
 /*
-   Get refraction in zenith distance.
+------------------------------------------------------------------------
 
-   Iterative process is required because refraction algorithms are
-   always a function of observed (not computed) zenith distance.
-   Require convergence to 0.1 arcsec (actual accuracy less).
-*/
+   PURPOSE:
+      To convert right ascension and declination to ecliptic longitude
+      and latitude.
 
-      zd0 = *zd;
+   REFERENCES:
+      None.
 
-      do
-      {
-         zd1 = *zd;
-         refr = refract (location,ref_option,*zd);
-         *zd = zd0 - refr;
-      } while (fabs (*zd - zd1) > 3.0e-5);
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date of equator, equinox, and ecliptic used for
+         coordinates.
+      coord_sys (short int)
+         Coordinate system selection.
+            = 0 ... mean equator and equinox of date 'jd_tt'
+            = 1 ... true equator and equinox of date 'jd_tt'
+            = 2 ... ICRS
+            (ecliptic is always the mean plane)
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      ra (double)
+         Right ascension in hours, referred to specified equator and
+         equinox of date.
+      dec (double)
+         Declination in degrees, referred to specified equator and
+         equinox of date.
 
-/*
-   Apply refraction to celestial coordinates of object.
-*/
+   OUTPUT
+   ARGUMENTS:
+      *elon (double)
+         Ecliptic longitude in degrees, referred to specified ecliptic
+         and equinox of date.
+      *elat (double)
+         Ecliptic latitude in degrees, referred to specified ecliptic
+         and equinox of date.
 
-      if ((refr > 0.0) && (*zd > 3.0e-4))
-      {
+   RETURNED
+   VALUE:
+      (short int)
+         = 0 ... everything OK
+         = 1 ... invalid value of 'coord_sys'
 
-/*
-   Shift position vector of object in celestial system to account
-   for refraction (see USNO/AA Technical Note 1998-09).
-*/
+   GLOBALS
+   USED:
+      None.
 
-         sinzd = sin (*zd * DEG2RAD);
-         coszd = cos (*zd * DEG2RAD);
-         sinzd0 = sin (zd0 * DEG2RAD);
-         coszd0 = cos (zd0 * DEG2RAD);
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      equ2ecl_ctx        novas.c
 
-/*
-   Compute refracted position vector.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/11-03/JAB (USNO/AA)
+      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.2/05-06/JAB (USNO/AA) Use vector transformation function.
+      V1.3/05-08/WKP (USNO/AA) Changed values of coord_sys to be
+                               more consistent with gcrs2equ.
+      V1.4/10-26/ROA           Use the default 'novas_context'.
 
-         for (j = 0; j < 3; j++)
-            pr[j] = ((p[j] - coszd0 * uz[j]) / sinzd0) * sinzd + uz[j] *
-               coszd;
+   NOTES:
+      1. To convert ICRS RA and dec to ecliptic coordinates (mean
+      ecliptic and equinox of J2000.0), set 'coord_sys' = 2; the value
+      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
+      Except for the input to this case, all input coordinates
+      are dynamical.
+      2. This function is the C version of NOVAS Fortran routine
+      'eqecl'.
 
-/*
-   Compute refracted right ascension and declination.
+------------------------------------------------------------------------
 */
-
-         proj = sqrt (pr[0] * pr[0] + pr[1] * pr[1]);
-
-         if (proj > 0.0)
-           *rar = atan2 (pr[1],pr[0]) * RAD2DEG / 15.0;
-
-         if (*rar < 0.0)
-           *rar += 24.0;
-
-         if (*rar >= 24.0)
-           *rar -= 24.0;
-
-         *decr = atan2 (pr[2],proj) * RAD2DEG;
-      }
-   }
-   return;
+{
+   return equ2ecl_ctx (default_context (),
+      jd_tt,coord_sys,accuracy,ra,dec, elon,elat);
 }
 
-/********gcrs2equ */
+/********equ2ecl_ctx */
 
-short int gcrs2equ (double jd_tt, short int coord_sys,
-                    short int accuracy, double rag, double decg,
+short int equ2ecl_ctx (novas_context *ctx, double jd_tt,
+                       short int coord_sys, short int accuracy,
+                       double ra, double dec,
 
-                    double *ra, double *dec)
+                       double *elon, double *elat)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function converts GCRS right ascension and declination
-      to coordinates with respect to the equator of date (mean or true).
-      For coordinates with respect to the true equator of date, the
-      origin of right ascension can be either the true equinox or the
-      celestial intermediate origin (CIO).
+      This function is the version of 'equ2ecl' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      None.
+      See function 'equ2ecl'.
 
    INPUT
    ARGUMENTS:
-      jd_tt (double)
-         TT Julian date of equator to be used for output coordinates.
-      coord_sys (short int)
-         Coordinate system selection for output coordinates.
-            = 0 ... mean equator and equinox of date
-            = 1 ... true equator and equinox of date
-            = 2 ... true equator and CIO of date
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      rag (double)
-         GCRS right ascension in hours.
-      decg (double)
-         GCRS declination in degrees.
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'equ2ecl'.
 
    OUTPUT
    ARGUMENTS:
-      ra (double)
-         Right ascension in hours, referred to specified equator and
-         right ascension origin of date.
-      dec (double)
-         Declination in degrees, referred to specified equator of date.
-
+      See function 'equ2ecl'.
 
    RETURNED
    VALUE:
-      (short int)
-         =  0 ... everything OK.
-         <  0 ... error from function 'vector2radec'
-         > 10 ... 10 + error from function 'cio_location'
-         > 20 ... 20 + error from function 'cio_basis'
+      See function 'equ2ecl'.
 
    GLOBALS
    USED:
-      DEG2RAD, T0        novascon.c
+      DEG2RAD, RAD2DEG   novascon.c
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      frame_tie          novas.c
-      precession         novas.c
-      nutation           novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      vector2radec       novas.c
+      equ2ecl_vec_ctx    novas.c
       sin                math.h
       cos                math.h
+      sqrt               math.h
+      atan2              math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-04/JAB (USNO/AA)
-      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V1.2/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
-      V1.3/04-08/WKP (USNO/AA) Updated variable names.
+      V1.0/10-26/ROA:           Moved out of 'equ2ecl' V1.3.
 
    NOTES:
-      1. Set input value of 'accuracy' equal to any short int if
-      'coord_sys' equals 0 or 1.  It is not used in these cases.
-      2. This function only supports the CIO-based method.
-      3. This function is the C version of NOVAS Fortran routine
-      'gcrseq'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
    short int error = 0;
-   short int rs;
-
-   double t1, t, secdiff, r, d, pos1[3], pos2[3], pos3[3], pos4[3],
-      r_cio, x[3], y[3], z[3];
-
-/*
-   't1' is the TDB Julian date.
-*/
 
-   tdb2tt (jd_tt, &t,&secdiff);
-   t1 = jd_tt + secdiff / 86400.0;
+   double r, d, pos1[3], pos2[3], xyproj, e;
 
 /*
    Form position vector in equatorial system from input coordinates.
 */
 
-   r = rag * 15.0 * DEG2RAD;
-   d = decg * DEG2RAD;
-
+   r = ra * 15.0 * DEG2RAD;
+   d = dec * DEG2RAD;
    pos1[0] = cos (d) * cos (r);
    pos1[1] = cos (d) * sin (r);
    pos1[2] = sin (d);
 
 /*
-   Transform the position vector based on the value of 'coord_sys'.
+   Convert the vector from equatorial to ecliptic system.
 */
 
-   if (coord_sys <= 1 )
-   {
+   if ((error = equ2ecl_vec_ctx (ctx,jd_tt,coord_sys,accuracy,pos1,
+      pos2)) != 0) return (error);
 
 /*
-   Transform the position vector from GCRS to mean equator and equinox
-   of date.
+   Decompose ecliptic vector into ecliptic longitude and latitude.
 */
 
-      frame_tie (pos1,1, pos2);
-      precession (T0,pos2,t1, pos3);
-
-/*
-   If requested, transform further to true equator and equinox of date.
-*/
+   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
 
-          if (coord_sys == 1)
-          {
-             nutation (t1,0,accuracy,pos3, pos4);
-          }
-           else
-          {
-             pos4[0] = pos3[0];
-             pos4[1] = pos3[1];
-             pos4[2] = pos3[2];
-          }
-    }
-     else
-
-    {
-
-/*
-   Obtain the basis vectors, in the GCRS, of the celestial intermediate
-   system.
-*/
-
-      if ((error = cio_location (t1,accuracy, &r_cio,&rs)) != 0)
-         return (error += 10);
-
-      if ((error = cio_basis (t1,r_cio,rs,accuracy, x,y,z)) != 0)
-         return (error += 20);
-
-/*
-   Transform position vector to the celestial intermediate system
-   (which has the CIO as its origin of right ascension).
-*/
-
-      pos4[0] = x[0] * pos1[0] + x[1] * pos1[1] + x[2] * pos1[2];
-      pos4[1] = y[0] * pos1[0] + y[1] * pos1[1] + y[2] * pos1[2];
-      pos4[2] = z[0] * pos1[0] + z[1] * pos1[1] + z[2] * pos1[2];
-   }
+   if (xyproj > 0.0)
+      e = atan2 (pos2[1], pos2[0]);
+    else
+      e = 0.0;
 
-/*
-   Convert the position vector to equatorial spherical coordinates.
-*/
+   *elon = e * RAD2DEG;
+   if (*elon < 0.0)
+      *elon += 360.0;
 
-   if ((error = vector2radec (pos4, ra,dec)) != 0)
-   {
-      *ra = 0.0;
-      *dec = 0.0;
-      return (-1 * error);
-   }
+   e = atan2 (pos2[2], xyproj);
+   *elat = e * RAD2DEG;
 
    return (error);
 }
 
-/********sidereal_time */
+/********equ2ecl_vec */
 
-short int sidereal_time (double jd_high, double jd_low,
-                         double delta_t,short int gst_type,
-                         short int method, short int accuracy,
+short int equ2ecl_vec (double jd_tt, short int coord_sys,
+                       short int accuracy, double *pos1,
 
-                         double *gst)
+                       double *pos2)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Computes the Greenwich sidereal time, either mean or apparent, at
-      Julian date 'jd_high' + 'jd_low'.
+      Converts an equatorial position vector to an ecliptic position
+      vector.
 
    REFERENCES:
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      None.
 
    INPUT
    ARGUMENTS:
-      jd_high (double)
-         High-order part of UT1 Julian date.
-      jd_low (double)
-         Low-order part of UT1 Julian date.
-      delta_t (double)
-         Difference TT-UT1 at 'jd_high'+'jd_low', in seconds
-         of time.
-      gst_type (short int)
-         = 0 ... compute Greenwich mean sidereal time
-         = 1 ... compute Greenwich apparent sidereal time
-      method (short int)
-         Selection for method
-            = 0 ... CIO-based method
-            = 1 ... equinox-based method
+      jd_tt (double)
+         TT Julian date of equator, equinox, and ecliptic used for
+         coordinates.
+      coord_sys (short int)
+         Coordinate system selection.
+            = 0 ... mean equator and equinox of date 'jd_tt'
+            = 1 ... true equator and equinox of date 'jd_tt'
+            = 2 ... ICRS
+            (ecliptic is always the mean plane)
       accuracy (short int)
          Selection for accuracy
             = 0 ... full accuracy
             = 1 ... reduced accuracy
+      pos1[3] (double)
+         Position vector, referred to specified equator and equinox of
+         date.
 
    OUTPUT
    ARGUMENTS:
-      *gst (double)
-         Greenwich (mean or apparent) sidereal time, in hours.
+      pos2[3] (double)
+         Position vector, referred to specified ecliptic and equinox
+         of date.
 
    RETURNED
    VALUE:
       (short int)
-         = 0         ... everything OK
-         = 1         ... invalid value of 'accuracy'
-         = 2         ... invalid value of 'method'
-         > 10, < 30  ... 10 + error from function 'cio_rai'
+         = 0 ... everything OK
+         = 1 ... invalid value of 'coord_sys'
 
    GLOBALS
    USED:
-      T0, RAD2DEG        novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      era                novas.c
-      e_tilt             novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
-      fabs               math.h
-      atan2              math.h
-      fmod               math.h
+      default_context    novas.c
+      equ2ecl_vec_ctx    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C programing standards.
-      V1.2/03-98/JAB (USNO/AA) Expand documentation.
-      V1.3/08-98/JAB (USNO/AA) Match flow of the Fortran counterpart.
-      V2.0/09-03/JAB (USNO/AA) Incorporate the 2nd-reference changes.
-      V2.1/08-04/JAB (USNO/AA) Incorporate the 1st-reference changes.
-      V2.2/12-05/WKP (USNO/AA) Updated error handling.
-      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'method' and 'accuracy'.
-      V2.4/04-06/JAB (USNO/AA) Use precession-in-RA terms in mean
-                               sidereal time from third reference.
-      V2.5/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
-      V2.6/06-08/WKP (USNO/AA) Changed value of direction argument in
-                               call to 'nutation' from 1 to -1 for
-                               consistency.
-      V2.7/03-11/WKP (USNO/AA) Updated prolog description to clarify
-                               this function computes either mean or
-                               apparent sidereal time, and removed
-                               Note 1 for consistency with Fortran.
+      V1.0/05-06/JAB (USNO/AA)
+      V1.1/05-08/WKP (USNO/AA) Changed values of coord_sys to be
+                               more consistent with gcrs2equ.
+      V1.2/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. The Julian date may be split at any point, but for highest
-      precision, set 'jd_high' to be the integral part of the Julian
-      date, and set 'jd_low' to be the fractional part.
+      1. To convert an ICRS vector to an ecliptic vector (mean ecliptic
+      and equinox of J2000.0 only), set 'coord_sys' = 2; the value
+      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
+      Except for the input to this case, all vectors are assumed
+      to be with respect to a dynamical system.
       2. This function is the C version of NOVAS Fortran routine
-      'sidtim'.
+      'eqec'.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int ref_sys;
+   return equ2ecl_vec_ctx (default_context (),
+      jd_tt,coord_sys,accuracy,pos1, pos2);
+}
 
-   static double ee;
-   static double jd_last = -99.0;
-   double unitx[3] = {1.0, 0.0, 0.0};
-   double jd_ut, jd_tt, jd_tdb, tt_temp, t, theta, a, b, c, d,
-      ra_cio, x[3], y[3], z[3], w1[3], w2[3], eq[3], ha_eq, st,
-      secdiff, eqeq;
+/********equ2ecl_vec_ctx */
 
+short int equ2ecl_vec_ctx (novas_context *ctx, double jd_tt,
+                           short int coord_sys, short int accuracy,
+                           double *pos1,
+
+                           double *pos2)
 /*
-   Invalid value of 'accuracy'.
-*/
+------------------------------------------------------------------------
 
-   if ((accuracy < 0) || (accuracy > 1))
-      return (error = 1);
+   PURPOSE:
+      This function is the version of 'equ2ecl_vec' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
-/*
-   Time argument for precession and nutation components of sidereal
-   time is TDB.  First approximation is TDB = TT, then refine.
-*/
+   REFERENCES:
+      See function 'equ2ecl_vec'.
 
-   jd_ut = jd_high + jd_low;
-   jd_tt = jd_ut + (delta_t / 86400.0);
-   jd_tdb = jd_tt;
-   tdb2tt (jd_tdb, &tt_temp,&secdiff);
-   jd_tdb = jd_tt + (secdiff / 86400.0);
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'equ2ecl_vec'.
 
-   t = (jd_tdb - T0) / 36525.0;
+   OUTPUT
+   ARGUMENTS:
+      See function 'equ2ecl_vec'.
 
-/*
-   Compute the Earth Rotation Angle.  Time argument is UT1.
-*/
+   RETURNED
+   VALUE:
+      See function 'equ2ecl_vec'.
 
-   theta = era (jd_high, jd_low);
+   GLOBALS
+   USED:
+      T0, DEG2RAD        novascon.c
 
-/*
-   Compute the equation of the equinoxes if needed, depending upon the
-   input values of 'gst_type' and 'method'.  If not needed, set to zero.
-*/
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      e_tilt_ctx         novas.c
+      frame_tie_ctx      novas.c
+      fabs               math.h
+      sin                math.h
+      cos                math.h
 
-   if (((gst_type == 0) && (method == 0)) ||       /* GMST; CIO-TIO */
-       ((gst_type == 1) && (method == 1)))         /* GAST; equinox */
-   {
-      if (fabs (jd_tdb - jd_last) > 1.0e-8)
-      {
-         e_tilt (jd_tdb,accuracy, &a,&b,&ee,&c,&d);
-         jd_last = jd_tdb;
-      }
-      eqeq = ee * 15.0;
-   }
-    else
-   {
-      eqeq = 0.0;
-   }
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'equ2ecl_vec' V1.1.
 
-/*
-   Compute Greenwich sidereal time depending upon input values of
-   'method' and 'gst_type'.
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
 */
+{
+   equ2ecl_vec_saved *sv = &ctx->equ2ecl_vec;
 
-   switch (method)
-   {
-      case (0):
+   short int error = 0;
+
+   double t, secdiff, jd_tdb, pos0[3], w, x, y, z, obl;
 
 /*
-   Use 'CIO-TIO-theta' method.  See Circular 179, Section 6.5.4.
+   'jd_tdb' is the TDB Julian date corresponding to 'jd_tt'.
 */
 
+   tdb2tt (jd_tt, &t,&secdiff);
+   jd_tdb = jd_tt + secdiff / 86400.0;
+
 /*
-   Obtain the basis vectors, in the GCRS, of the celestial intermediate
-   system.
+   Get obliquity, depending upon the "system" of the input coordinates.
 */
 
-         if ((error = cio_location (jd_tdb,accuracy, &ra_cio,
-            &ref_sys)) != 0)
+   switch (coord_sys)
+   {
+      case 0:             /* Input: mean equator and equinox of date */
+      case 1:             /* Input: true equator and equinox of date */
+         pos0[0] = pos1[0];
+         pos0[1] = pos1[1];
+         pos0[2] = pos1[2];
+         if (fabs (jd_tt - sv->t_last) > 1.0e-8)
          {
-            *gst = 99.0;
-            return (error += 10);
+            e_tilt_ctx (ctx,jd_tdb,accuracy, &sv->oblm,&sv->oblt,&x,&y,
+               &z);
+            sv->t_last = jd_tt;
          }
 
-         cio_basis (jd_tdb,ra_cio,ref_sys,accuracy, x,y,z);
+         switch (coord_sys)
+         {
+            case 0:       /* Use mean obliquity of date */
+               obl = sv->oblm * DEG2RAD;
+               break;
+            case 1:       /* Use true obliquity of date */
+               obl = sv->oblt * DEG2RAD;
+               break;
+         }
+         break;
 
-/*
-   Compute the direction of the true equinox in the GCRS.
-*/
+    case 2:             /* Input: ICRS */
+        frame_tie_ctx (ctx,pos1,1, pos0);
+
+        if (sv->ob2000 == 0.0)
+        {
+        e_tilt_ctx (ctx,T0,accuracy, &sv->oblm,&w,&x,&y,&z);
+        sv->ob2000 = sv->oblm;
+        }
+        obl = sv->ob2000 * DEG2RAD;
+        break;
 
-         nutation (jd_tdb,-1,accuracy,unitx, w1);
-         precession (jd_tdb,w1,T0, w2);
-         frame_tie (w2,-1, eq);
+    default:
+        error = 1;
+        return (error);
+   }
 
 /*
-   Compute the hour angle of the equinox wrt the TIO meridian
-   (near Greenwich, but passes through the CIP and TIO).
+   Rotate position vector to ecliptic system.
 */
 
-         ha_eq = theta - atan2 ((eq[0] * y[0] + eq[1] * y[1] +
-            eq[2] * y[2]), (eq[0] * x[0] + eq[1] * x[1] +
-            eq[2] * x[2])) * RAD2DEG;
-
-/*
-   For mean sidereal time, subtract the equation of the equinoxes.
-*/
-
-         ha_eq -= (eqeq / 240.0);
-
-         ha_eq = fmod (ha_eq, 360.0) / 15.0;
-         if (ha_eq < 0.0)
-            ha_eq += 24.0;
-         *gst = ha_eq;
-         break;
-
-      case (1):
-
-/*
-   Use equinox method.  See Circular 179, Section 2.6.2.
-*/
-
-/*
-   Precession-in-RA terms in mean sidereal time taken from third
-   reference, eq. (42), with coefficients in arcseconds.
-*/
-
-         st = eqeq + 0.014506 +
-               (((( -    0.0000000368   * t
-                    -    0.000029956  ) * t
-                    -    0.00000044   ) * t
-                    +    1.3915817    ) * t
-                    + 4612.156534     ) * t;
-
-/*
-   Form the Greenwich sidereal time.
-*/
-
-         *gst = fmod ((st / 3600.0 + theta), 360.0) / 15.0;
-
-         if (*gst < 0.0)
-            *gst += 24.0;
-         break;
-
-/*
-   Invalid value of 'method'.
-*/
-
-      default:
-         *gst = 99.0;
-         error = 2;
-         break;
-   }
+   pos2[0] =  pos0[0];
+   pos2[1] =  pos0[1] * cos (obl) + pos0[2] * sin (obl);
+   pos2[2] = -pos0[1] * sin (obl) + pos0[2] * cos (obl);
 
    return (error);
 }
 
-/********era */
+/********ecl2equ_vec */
 
-double era (double jd_high, double jd_low)
+short int ecl2equ_vec (double jd_tt, short int coord_sys,
+                       short int accuracy, double *pos1,
+
+                       double *pos2)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function returns the value of the Earth Rotation Angle
-      (theta) for a given UT1 Julian date.  The expression used is
-      taken from the note to IAU Resolution B1.8 of 2000.
+      Converts an ecliptic position vector to an equatorial position
+      vector.
 
    REFERENCES:
-      IAU Resolution B1.8, adopted at the 2000 IAU General Assembly,
-         Manchester, UK.
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      None.
 
    INPUT
    ARGUMENTS:
-      jd_high (double)
-         High-order part of UT1 Julian date.
-      jd_low (double)
-         Low-order part of UT1 Julian date.
+      jd_tt (double)
+         TT Julian date of equator, equinox, and ecliptic used for
+         coordinates.
+      coord_sys (short int)
+         Coordinate system selection.
+            = 0 ... mean equator and equinox of date
+            = 1 ... true equator and equinox of date
+            = 2 ... ICRS
+            (ecliptic is always the mean plane)
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      pos1[3] (double)
+         Position vector, referred to specified ecliptic and equinox of
+         date.  If 'coord_sys' = 2, 'pos1' must be on mean ecliptic and
+         equinox of J2000.0; see Note 1 below.
 
    OUTPUT
    ARGUMENTS:
-      None.
+      POS2[3] (double)
+         Position vector, referred to specified equator and equinox
+         of date.
 
    RETURNED
    VALUE:
-      (double)
-         The Earth Rotation Angle (theta) in degrees.
+      (short int)
+         = 0 ... everything OK
+         = 1 ... invalid value of 'coord_sys'
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      fmod               math.h
+      default_context    novas.c
+      ecl2equ_vec_ctx    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-03/JAB (USNO/AA)
+      V1.0/05-06/JAB (USNO/AA)
+      V1.1/05-08/WKP (USNO/AA) Changed values of coord_sys to be
+                               more consistent with gcrs2equ.
+      V1.2/09-10/WKP (USNO/AA) Initialized 'obl' variable to silence
+                               compiler warning.
+      V1.3/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. The algorithm used here is equivalent to the canonical
-      theta = 0.7790572732640 + 1.00273781191135448 * t,
-      where t is the time in days from J2000 (t = jd_high +
-      jd_low - T0), but it avoids many two-PI 'wraps' that decrease
-      precision (adopted from SOFA Fortran routine iau_era00; see
-      also expression at top of page 35 of IERS Conventions (1996)).
+      1. To convert an ecliptic vector (mean ecliptic and equinox of
+      J2000.0 only) to an ICRS vector, set 'coord_sys' = 2; the value
+      of 'jd_tt' can be set to anything, since J2000.0 is assumed.
+      Except for the output from this case, all vectors are assumed to
+      be with respect to a dynamical system.
       2. This function is the C version of NOVAS Fortran routine
-      'erot'.
+      'eceq'.
 
 ------------------------------------------------------------------------
 */
-
 {
-   double theta, thet1, thet2, thet3;
-
-   thet1 = 0.7790572732640 + 0.00273781191135448 * (jd_high - T0);
-   thet2 = 0.00273781191135448 * jd_low;
-   thet3 = fmod (jd_high, 1.0) + fmod (jd_low, 1.0);
-
-   theta = fmod (thet1 + thet2 + thet3, 1.0) * 360.0;
-   if (theta < 0.0)
-      theta += 360.0;
-
-   return theta;
+   return ecl2equ_vec_ctx (default_context (),
+      jd_tt,coord_sys,accuracy,pos1, pos2);
 }
 
-/********ter2cel */
+/********ecl2equ_vec_ctx */
 
-short int ter2cel (double jd_ut_high, double jd_ut_low, double delta_t,
-                   short int method, short int accuracy, short int option,
-                   double xp, double yp, double *vec1,
+short int ecl2equ_vec_ctx (novas_context *ctx, double jd_tt,
+                           short int coord_sys, short int accuracy,
+                           double *pos1,
 
-                   double *vec2)
+                           double *pos2)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function rotates a vector from the terrestrial to the
-      celestial system.  Specifically, it transforms a vector in the
-      ITRS (rotating earth-fixed system) to the GCRS (a local space-
-      fixed system) by applying rotations for polar motion, Earth
-      rotation, nutation, precession, and the dynamical-to-GCRS
-      frame tie.
+      This function is the version of 'ecl2equ_vec' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
-      Kaplan, G. H. (2003), 'Another Look at Non-Rotating Origins',
-         Proceedings of IAU XXV Joint Discussion 16.
+      See function 'ecl2equ_vec'.
 
    INPUT
    ARGUMENTS:
-      jd_ut_high (double)
-         High-order part of UT1 Julian date.
-      jd_ut_low (double)
-         Low-order part of UT1 Julian date.
-      delta_t (double)
-         Value of Delta T (= TT - UT1) at the input UT1 Julian date.
-      method (short int)
-         Selection for method
-            = 0 ... CIO-based method
-            = 1 ... equinox-based method
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      option (short int)
-            = 0 ... The output vector is referred to GCRS axes.
-            = 1 ... The output vector is produced with respect to the
-                    equator and equinox of date.
-                    See Note 2 below.
-      xp (double)
-         Conventionally-defined X coordinate of celestial intermediate
-         pole with respect to ITRS pole, in arcseconds.
-      yp (double)
-         Conventionally-defined Y coordinate of celestial intermediate
-         pole with respect to ITRS pole, in arcseconds.
-      vec1[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to ITRS axes (terrestrial system) in the normal case
-         where 'option' = 0.
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'ecl2equ_vec'.
 
    OUTPUT
    ARGUMENTS:
-      vec2[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to GCRS axes (celestial system) or with respect to
-         the equator and equinox of date, depending on 'option'.
+      See function 'ecl2equ_vec'.
 
    RETURNED
    VALUE:
-      =  0  ... everything is ok.
-      =  1  ... invalid value of 'accuracy'
-      =  2  ... invalid value of 'method'
-      > 10 ... 10 + error from function 'cio_location'
-      > 20 ... 20 + error from function 'cio_basis'
+      See function 'ecl2equ_vec'.
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      T0, DEG2RAD        novascon.c
 
    FUNCTIONS
    CALLED:
       tdb2tt             novas.c
-      wobble             novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      era                novas.c
-      spin               novas.c
-      sidereal_time      novas.c
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
+      e_tilt_ctx         novas.c
+      frame_tie_ctx      novas.c
+      fabs               math.h
+      sin                math.h
+      cos                math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
-      V2.0/10-03/JAB (USNO/AA) Formerly function 'pnsw.'  Update
-                               for IAU 2000 resolutions.
-      V2.1/01-05/JAB (USNO/AA) Update to include 'mode' flexibility.
-      V2.2/12-05/WKP (USNO/AA) Check error codes.
-      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'method' and 'accuracy'.
-      V2.4/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
-      V2.5/06-08/WKP (USNO/AA) Corrected sign of direction argument in
-                               'frame_tie' call and changed value of
-                               direction argument in call to 'nutation'
-                               for consistency.
-      V2.6/10-08/WKP (USNO/AA) Renamed input JD variables to include
-                               time system.
-      V2.7/03-09/JAB (USNO/AA) Conformed input variables to IERS
-                               conventions.
-      V2.8/12-10/JAB (USNO/AA) Cosmetic changes for consistency with
-                               Fortran.
+      V1.0/10-26/ROA:           Moved out of 'ecl2equ_vec' V1.2.
 
    NOTES:
-      1. 'xp' = 'yp' = 0 means no polar motion transformation.
-      2. The 'option' flag only works for the equinox-based method.
-      3. This function is the C version of NOVAS Fortran routine
-      'tercel'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
+   ecl2equ_vec_saved *sv = &ctx->ecl2equ_vec;
+
    short int error = 0;
-   short int rs, j;
 
-   double jd_ut1, jd_tt, dummy, secdiff, jd_tdb, gast, r_cio, theta,
-   v1[3], v2[3], v3[3], v4[3], x[3], y[3], z[3];
+   double t, secdiff, jd_tdb, pos0[3], w, x, y, z, obl = 0.0;
 
 /*
-   Invalid value of 'accuracy'.
+   'jd_tdb' is the TDB Julian date.
 */
 
-   if ((accuracy < 0) || (accuracy > 1))
-      return (error = 1);
+   tdb2tt (jd_tt, &t,&secdiff);
+   jd_tdb = jd_tt + secdiff / 86400.0;
 
 /*
-   Compute the TT Julian date corresponding to the input UT1 Julian
-   date.
+   Get obliquity, depending upon the "system" of the input coordinates.
 */
 
-   jd_ut1 = jd_ut_high + jd_ut_low;
-   jd_tt = jd_ut1 + (delta_t / 86400.0);
+   switch (coord_sys)
+   {
+      case 0:             /* Output: mean equator and equinox of date */
+      case 1:             /* Output: true equator and equinox of date */
+         if (fabs (jd_tt - sv->t_last) > 1.0e-8)
+         {
+            e_tilt_ctx (ctx,jd_tdb,accuracy, &sv->oblm,&sv->oblt,&x,&y,
+               &z);
+            sv->t_last = jd_tt;
+         }
+
+         switch (coord_sys)
+         {
+            case 0:       /* Use mean obliquity of date */
+               obl = sv->oblm * DEG2RAD;
+               break;
+            case 1:       /* Use true obliquity of date */
+               obl = sv->oblt * DEG2RAD;
+               break;
+         }
+         break;
+
+      case 2:             /* Output: ICRS */
+         if (sv->ob2000 == 0.0)
+         {
+            e_tilt_ctx (ctx,T0,accuracy, &sv->oblm,&w,&x,&y,&z);
+            sv->ob2000 = sv->oblm;
+         }
+         obl = sv->ob2000 * DEG2RAD;
+         break;
+
+      default:
+         return (error = 1);
+   }
 
 /*
-   Compute the TDB Julian date corresponding to the input UT1 Julian
-   date.
+   Rotate position vector to ecliptic system.
 */
 
-   jd_tdb = jd_tt;
-   tdb2tt (jd_tdb, &dummy,&secdiff);
-   jd_tdb = jd_tt + secdiff / 86400.0;
-
-   switch (method)
-   {
-      case (0):
-
-/*
-   'CIO-TIO-THETA' method.
-
-   See second reference, eq. (3) and (4).
-
-   Apply polar motion, transforming the vector to the terrestrial
-   intermediate system.
-*/
-
-         if ((xp == 0.0) && (yp == 0.0))
-         {
-            v1[0] = vec1[0];
-            v1[1] = vec1[1];
-            v1[2] = vec1[2];
-         }
-          else
-            wobble (jd_tdb,0,xp,yp,vec1, v1);
-
-/*
-   Obtain the basis vectors, in the GCRS, of the celestial intermediate
-   system.
-*/
-
-      if ((error = cio_location (jd_tdb,accuracy, &r_cio,&rs)) != 0)
-         return (error += 10);
-
-      if ((error = cio_basis (jd_tdb,r_cio,rs,accuracy, x,y,z)) != 0)
-         return (error += 20);
-
-/*
-   Compute and apply the Earth rotation angle, 'theta', transforming the
-   vector to the celestial intermediate system.
-*/
-
-         theta = era (jd_ut_high,jd_ut_low);
-         spin (-theta,v1, v2);
-
-/*
-   Transform the vector from the celestial intermediate system to the
-   GCRS.
-*/
-
-         vec2[0] = x[0] * v2[0] + y[0] * v2[1] + z[0] * v2[2];
-         vec2[1] = x[1] * v2[0] + y[1] * v2[1] + z[1] * v2[2];
-         vec2[2] = x[2] * v2[0] + y[2] * v2[1] + z[2] * v2[2];
-         break;
-
-      case (1):
-
-/*
-   Equinox mode.
-
-   Apply polar motion.
-*/
-
-         if ((xp == 0.0) && (yp == 0.0))
-         {
-            for (j = 0; j < 3; j++)
-            {
-               v1[j] = vec1[j];
-            }
-         }
-          else
-            wobble (jd_tdb,0,xp,yp,vec1, v1);
-
-/*
-   Apply Earth rotation.
-*/
-
-         sidereal_time (jd_ut_high,jd_ut_low,delta_t,1,1,accuracy, &gast);
-         spin (-gast * 15.0,v1, v2);
-
-/*
-   'option' = 1 skips remaining transformations.
-*/
-
-         if (option == 1)
-         {
-            vec2[0] = v2[0];
-            vec2[1] = v2[1];
-            vec2[2] = v2[2];
-         }
-          else
-         {
-
-/*
-   Apply precession, nutation, and frame tie.
-*/
-
-            nutation (jd_tdb,-1,accuracy,v2, v3);
-            precession (jd_tdb,v3,T0, v4);
-            frame_tie (v4,-1, vec2);
-         }
-         break;
+   pos2[0] = pos1[0];
+   pos2[1] = pos1[1] * cos (obl) - pos1[2] * sin (obl);
+   pos2[2] = pos1[1] * sin (obl) + pos1[2] * cos (obl);
 
 /*
-   Invalid value of 'method'.
+   Case where output vector is to be in ICRS, rotate from dynamical
+   system to ICRS.
 */
 
-      default:
-         error = 2;
-         break;
+   if (coord_sys == 2)
+   {
+      pos0[0] = pos2[0];
+      pos0[1] = pos2[1];
+      pos0[2] = pos2[2];
+      frame_tie_ctx (ctx,pos0,-1, pos2);
    }
 
    return (error);
 }
 
-/********cel2ter */
+/********equ2hor */
 
-short int cel2ter (double jd_ut_high, double jd_ut_low, double delta_t,
-                   short int method, short int accuracy, short int option,
-                   double xp, double yp, double *vec1,
+void equ2hor (double jd_ut1, double delta_t, short int accuracy,
+              double xp, double yp, on_surface *location, double ra,
+              double dec, short int ref_option,
 
-                   double *vec2)
+              double *zd, double *az, double *rar, double *decr)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function rotates a vector from the celestial to the
-      terrestrial system.  Specifically, it transforms a vector in the
-      GCRS (a local space-fixed system) to the ITRS (a rotating earth-
-      fixed system) by applying rotations for the GCRS-to-dynamical
-      frame tie, precession, nutation, Earth rotation, and polar motion.
+      This function transforms topocentric right ascension and
+      declination to zenith distance and azimuth.  It uses a method
+      that properly accounts for polar motion, which is significant at
+      the sub-arcsecond level.  This function can also adjust
+      coordinates for atmospheric refraction.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
-      Kaplan, G. H. (2003), 'Another Look at Non-Rotating Origins',
-         Proceedings of IAU XXV Joint Discussion 16.
+      Kaplan, G. (2008). USNO/AA Technical Note of 28 Apr 2008,
+         "Refraction as a Vector."
 
    INPUT
    ARGUMENTS:
-      jd_ut_high (double)
-         High-order part of UT1 Julian date.
-      jd_ut_low (double)
-         Low-order part of UT1 Julian date.
+      jd_ut1 (double)
+         UT1 Julian date.
       delta_t (double)
-         Value of Delta T (= TT - UT1) at the input UT1 Julian date.
-      method (short int)
-         Selection for method
-            = 0 ... CIO-based method
-            = 1 ... equinox-based method
+         Difference TT-UT1 at 'jd_ut1', in seconds.
       accuracy (short int)
-         Selection for accuracy
+         Selection for method and accuracy
             = 0 ... full accuracy
             = 1 ... reduced accuracy
-      option (short int)
-            = 0 ... The input vector is referred to GCRS axes.
-            = 1 ... The input vector is produced with respect to the
-                    equator and equinox of date.
-                    See Note 2 below.
       xp (double)
-         Conventionally-defined X coordinate of celestial intermediate
-         pole with respect to ITRS pole, in arcseconds.
+         Conventionally-defined x coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds.
       yp (double)
-         Conventionally-defined Y coordinate of celestial intermediate
-         pole with respect to ITRS pole, in arcseconds.
-      vec1[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to GCRS axes (celestial system) or with respect to
-         the equator and equinox of date, depending on 'option'.
+         Conventionally-defined y coordinate of celestial intermediate
+         pole with respect to ITRS reference pole, in arcseconds.
+      *location (struct on_surface)
+         Pointer to structure containing observer's location (defined
+         in novas.h).
+      ra (double)
+         Topocentric right ascension of object of interest, in hours,
+         referred to true equator and equinox of date.
+      dec (double)
+         Topocentric declination of object of interest, in degrees,
+         referred to true equator and equinox of date.
+      ref_option (short int)
+         = 0 ... no refraction
+         = 1 ... include refraction, using 'standard' atmospheric
+                 conditions.
+         = 2 ... include refraction, using atmospheric parameters
+                 input in the 'location' structure.
 
    OUTPUT
    ARGUMENTS:
-      vec2[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to ITRS axes (terrestrial system).
+      *zd (double)
+         Topocentric zenith distance in degrees, affected by
+         refraction if 'ref_option' is non-zero.
+      *az (double)
+         Topocentric azimuth (measured east from north) in degrees.
+      *rar (double)
+         Topocentric right ascension of object of interest, in hours,
+         referred to true equator and equinox of date, affected by
+         refraction if 'ref_option' is non-zero.
+      *decr (double)
+         Topocentric declination of object of interest, in degrees,
+         referred to true equator and equinox of date, affected by
+         refraction if 'ref_option' is non-zero.
 
    RETURNED
    VALUE:
-      =  0  ... everything is ok.
-      =  1  ... invalid value of 'accuracy'
-      =  2  ... invalid value of 'method'
-      > 10 ... 10 + error from function 'cio_location'
-      > 20 ... 20 + error from function 'cio_basis'
+      None.
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      wobble             novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      era                novas.c
-      spin               novas.c
-      sidereal_time      novas.c
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
+      default_context    novas.c
+      equ2hor_ctx        novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-09/JAB (USNO/AA)
-      V1.1/12-10/JAB (USNO/AA) Fix confusion with input/output vectors;
-                               cosmetic changes to better match Fortran.
+      V1.0/06-98/JAB (USNO/AA)
+      V2.0/01-06/JAB (USNO/AA)
+      V2.1/01-06/WKP (USNO/AA): Changed 'mode' to 'accuracy'.
+      V2.2/11-07/JAB (USNO/AA): Cosmetic changes.
+      V2.2/05-08/WKP (USNO/AA): Updated the refraction algorithm.
+      V2.3/06-08/WKP (USNO/AA): Tweaked convergence criteria.
+      V2.4/03-09/JAB (USNO/AA): Conformed input variables to IERS
+                                conventions.
+      V2.5/10-26/ROA:           Use the default 'novas_context'.
 
    NOTES:
-      1. 'xp' = 'yp' = 0 means no polar motion transformation.
-      2. 'option' = 1 only works for the equinox-based method
-      ('method' = 1).
-      3. This function is the C version of NOVAS Fortran routine
-      'celter'.
+      1. 'xp' and 'yp' can be set to zero if sub-arcsecond accuracy is
+      not needed.  'ra' and 'dec' can be obtained from functions
+      'tpstar' or 'tpplan'.
+      2. The directions 'zd'= 0 (zenith) and 'az'= 0 (north) are here
+      considered fixed in the terrestrial system.  Specifically, the
+      zenith is along the geodetic normal, and north is toward
+      the ITRS pole.
+      3. If 'ref_option'= 0, then 'rar'='ra' and 'decr'='dec'.
+      4. This function is the C version of NOVAS Fortran routine
+      'zdaz'.
+      5. The rotation of the Earth-fixed basis vectors is computed once
+      per instant (see 'ter2cel_matrix'), so converting many objects at
+      the same 'jd_ut1' costs little more than the trigonometry.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int rs, j;
-
-   double jd_ut1, jd_tt, dummy, secdiff, jd_tdb, gast, r_cio, theta,
-   v1[3], v2[3], v3[3], v4[3], x[3], y[3], z[3];
+   equ2hor_ctx (default_context (),
+      jd_ut1,delta_t,accuracy,xp,yp,location,ra,dec,ref_option,
+      zd,az,rar,decr);
+   return;
+}
 
-/*
-   Invalid value of 'accuracy'.
-*/
+/********equ2hor_ctx */
 
-   if ((accuracy < 0) || (accuracy > 1))
-      return (error = 1);
+void equ2hor_ctx (novas_context *ctx, double jd_ut1, double delta_t,
+                  short int accuracy, double xp, double yp,
+                  on_surface *location, double ra, double dec,
+                  short int ref_option,
 
+                  double *zd, double *az, double *rar, double *decr)
 /*
-   Compute the TT Julian date corresponding to the input UT1 Julian
-   date.
-*/
+------------------------------------------------------------------------
 
-   jd_ut1 = jd_ut_high + jd_ut_low;
-   jd_tt = jd_ut1 + (delta_t / 86400.0);
+   PURPOSE:
+      This function is the version of 'equ2hor' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
-/*
-   Compute the TDB Julian date corresponding to the input UT1 Julian
-   date.
-*/
+   REFERENCES:
+      See function 'equ2hor'.
 
-   jd_tdb = jd_tt;
-   tdb2tt (jd_tdb, &dummy,&secdiff);
-   jd_tdb = jd_tt + secdiff / 86400.0;
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'equ2hor'.
 
-   switch (method)
-   {
-      case (0):
+   OUTPUT
+   ARGUMENTS:
+      See function 'equ2hor'.
 
-/*
-   'CIO-TIO-THETA' method.
+   RETURNED
+   VALUE:
+      None.
 
-   See second reference, eq. (3) and (4).
+   GLOBALS
+   USED:
+      DEG2RAD, RAD2DEG   novascon.c
 
-   Obtain the basis vectors, in the GCRS, of the celestial intermediate
-   system.
-*/
+   FUNCTIONS
+   CALLED:
+      ter2cel_matrix_ctx novas.c
+      ter2cel_apply      novas.c
+      refract            novas.c
+      sin                math.h
+      cos                math.h
+      sqrt               math.h
+      atan2              math.h
+      fabs               math.h
 
-         if ((error = cio_location (jd_tdb,accuracy, &r_cio,&rs)) != 0)
-            return (error += 10);
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'equ2hor' V2.4.
+      V1.1/10-26/ROA:           Rotate the basis vectors with one
+                                matrix, kept in 'ctx'.
 
-         if ((error = cio_basis (jd_tdb,r_cio,rs,accuracy, x,y,z)) != 0)
-            return (error += 20);
+   NOTES:
+      1. The rotation matrix of 'ter2cel_matrix_ctx' is computed once
+      for each set of 'jd_ut1', 'delta_t', 'accuracy', 'xp' and 'yp';
+      for other objects at the same instant, only the basis vectors
+      are rotated with it.
 
-/*
-   Transform the vector from the GCRS to the celestial intermediate
-   system.
+------------------------------------------------------------------------
 */
+{
+   short int j;
 
-         v1[0] = x[0] * vec1[0] + x[1] * vec1[1] + x[2] * vec1[2];
-         v1[1] = y[0] * vec1[0] + y[1] * vec1[1] + y[2] * vec1[2];
-         v1[2] = z[0] * vec1[0] + z[1] * vec1[1] + z[2] * vec1[2];
+   double sinlat, coslat, sinlon, coslon, sindc, cosdc, sinra, cosra,
+      uze[3], une[3], uwe[3], uz[3], un[3], uw[3], p[3], pz, pn, pw,
+      proj, zd0, zd1, refr, sinzd, coszd, sinzd0, coszd0, pr[3],
+      mat[3][3];
 
 /*
-   Compute and apply the Earth rotation angle, 'theta', transforming the
-   vector to the terrestrial intermediate system.
+   Preliminaries.
 */
 
-         theta = era (jd_ut_high,jd_ut_low);
-         spin (theta,v1, v2);
+   *rar = ra;
+   *decr = dec;
+
+   sinlat = sin (location->latitude * DEG2RAD);
+   coslat = cos (location->latitude * DEG2RAD);
+   sinlon = sin (location->longitude * DEG2RAD);
+   coslon = cos (location->longitude * DEG2RAD);
+   sindc = sin (dec * DEG2RAD);
+   cosdc = cos (dec * DEG2RAD);
+   sinra = sin (ra * 15.0 * DEG2RAD);
+   cosra = cos (ra * 15.0 * DEG2RAD);
 
 /*
-   Apply polar motion, transforming the vector to the ITRS.
-*/
+   Set up orthonormal basis vectors in local Earth-fixed system.
 
-         if ((xp == 0.0) && (yp == 0.0))
-         {
-            vec2[0] = v2[0];
-            vec2[1] = v2[1];
-            vec2[2] = v2[2];
-         }
-          else
-            wobble (jd_tdb,1,xp,yp,v2, vec2);
+   Define vector toward local zenith in Earth-fixed system (z axis).
+*/
+   uze[0] = coslat * coslon;
+   uze[1] = coslat * sinlon;
+   uze[2] = sinlat;
 
-         break;
+/*
+   Define vector toward local north in Earth-fixed system (x axis).
+*/
 
-      case (1):
+   une[0] = -sinlat * coslon;
+   une[1] = -sinlat * sinlon;
+   une[2] = coslat;
 
 /*
-   Equinox mode.
-
-   'option' = 1 skips initial transformations.
+   Define vector toward local west in Earth-fixed system (y axis).
 */
 
-         if (option == 1)
-         {
-            v3[0] = vec1[0];
-            v3[1] = vec1[1];
-            v3[2] = vec1[2];
-         }
-          else
-         {
+   uwe[0] = sinlon;
+   uwe[1] = -coslon;
+   uwe[2] = 0.0;
 
 /*
-   Apply frame tie, nutation, and precession.
+   Obtain vectors in celestial system.
+
+   Rotate Earth-fixed orthonormal basis vectors to celestial system
+   (wrt equator and equinox of date).
 */
 
-            frame_tie (vec1,1, v1);
-            precession (T0,v1,jd_tdb, v2);
-            nutation (jd_tdb,0,accuracy,v2, v3);
-         }
+   ter2cel_matrix_ctx (ctx,jd_ut1,0.0,delta_t,1,accuracy,1,xp,yp, mat);
+   ter2cel_apply (mat,0,uze, uz);
+   ter2cel_apply (mat,0,une, un);
+   ter2cel_apply (mat,0,uwe, uw);
 
 /*
-   Apply Earth rotation.
+   Define unit vector 'p' toward object in celestial system
+   (wrt equator and equinox of date).
 */
 
-         sidereal_time (jd_ut_high,jd_ut_low,delta_t,1,1,accuracy, &gast);
-         spin (gast * 15.0,v3, v4);
+   p[0] = cosdc * cosra;
+   p[1] = cosdc * sinra;
+   p[2] = sindc;
 
 /*
-   Apply polar motion.
-*/
+   Compute coordinates of object wrt orthonormal basis.
 
-         if ((xp == 0.0) && (yp == 0.0))
-         {
-            for (j = 0; j < 3; j++)
-            {
-               vec2[j] = v4[j];
-            }
-         }
-          else
-            wobble (jd_tdb,1,xp,yp,v4, vec2);
+   Compute components of 'p' - projections of 'p' onto rotated
+   Earth-fixed basis vectors.
+*/
 
-         break;
+   pz = p[0] * uz[0] + p[1] * uz[1] + p[2] * uz[2];
+   pn = p[0] * un[0] + p[1] * un[1] + p[2] * un[2];
+   pw = p[0] * uw[0] + p[1] * uw[1] + p[2] * uw[2];
 
 /*
-   Invalid value of 'method'.
+   Compute azimuth and zenith distance.
 */
 
-      default:
-         error = 2;
-         break;
-   }
+   proj = sqrt (pn * pn + pw * pw);
 
-   return (error);
-}
+   if (proj > 0.0)
+      *az = -atan2 (pw, pn) * RAD2DEG;
 
-/********spin */
+   if (*az < 0.0)
+      *az += 360.0;
 
-void spin (double angle, double *pos1,
+   if (*az >= 360.0)
+      *az -= 360.0;
+
+   *zd = atan2 (proj, pz) * RAD2DEG;
 
-           double *pos2)
 /*
-------------------------------------------------------------------------
+   Apply atmospheric refraction if requested.
+*/
 
-   PURPOSE:
-      This function transforms a vector from one coordinate system
-      to another with same origin and axes rotated about the z-axis.
+   if (ref_option != 0)
+   {
 
-   REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+/*
+   Get refraction in zenith distance.
 
-   INPUT
-   ARGUMENTS:
-      angle (double)
-         Angle of coordinate system rotation, positive counterclockwise
-         when viewed from +z, in degrees.
-      pos1[3] (double)
-         Position vector.
+   Iterative process is required because refraction algorithms are
+   always a function of observed (not computed) zenith distance.
+   Require convergence to 0.1 arcsec (actual accuracy less).
+*/
 
-   OUTPUT
-   ARGUMENTS:
-      pos2[3] (double)
-         Position vector expressed in new coordinate system rotated
-         about z by 'angle'.
+      zd0 = *zd;
 
-   RETURNED
-   VALUE:
-      None.
+      do
+      {
+         zd1 = *zd;
+         refr = refract (location,ref_option,*zd);
+         *zd = zd0 - refr;
+      } while (fabs (*zd - zd1) > 3.0e-5);
 
-   GLOBALS
-   USED:
-      DEG2RAD            novascon.c
+/*
+   Apply refraction to celestial coordinates of object.
+*/
 
-   FUNCTIONS
-   CALLED:
-      sin                math.h
-      cos                math.h
+      if ((refr > 0.0) && (*zd > 3.0e-4))
+      {
 
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
-      V2.0/10-03/JAB (USNO/AA) Update for IAU 2000 resolutions.
-      V2.1/01-05/JAB (USNO/AA) Generalize the function.
+/*
+   Shift position vector of object in celestial system to account
+   for refraction (see USNO/AA Technical Note 1998-09).
+*/
 
-   NOTES:
-      1. This function is the C version of NOVAS Fortran routine 'spin'.
+         sinzd = sin (*zd * DEG2RAD);
+         coszd = cos (*zd * DEG2RAD);
+         sinzd0 = sin (zd0 * DEG2RAD);
+         coszd0 = cos (zd0 * DEG2RAD);
 
-------------------------------------------------------------------------
+/*
+   Compute refracted position vector.
 */
-{
-   static double ang_last = -999.0;
-   static double xx, yx, zx, xy, yy, zy, xz, yz, zz;
-   double angr, cosang, sinang;
 
-   if (fabs (angle - ang_last) >= 1.0e-12)
-   {
-      angr = angle * DEG2RAD;
-      cosang = cos (angr);
-      sinang = sin (angr);
+         for (j = 0; j < 3; j++)
+            pr[j] = ((p[j] - coszd0 * uz[j]) / sinzd0) * sinzd + uz[j] *
+               coszd;
 
 /*
-   Rotation matrix follows.
+   Compute refracted right ascension and declination.
 */
 
-      xx =  cosang;
-      yx =  sinang;
-      zx =  0.0;
-      xy =  -sinang;
-      yy =  cosang;
-      zy =  0.0;
-      xz =  0.0;
-      yz =  0.0;
-      zz =  1.0;
+         proj = sqrt (pr[0] * pr[0] + pr[1] * pr[1]);
 
-      ang_last = angle;
-   }
+         if (proj > 0.0)
+           *rar = atan2 (pr[1],pr[0]) * RAD2DEG / 15.0;
 
-/*
-   Perform rotation.
-*/
+         if (*rar < 0.0)
+           *rar += 24.0;
 
-   pos2[0] = xx * pos1[0] + yx * pos1[1] + zx * pos1[2];
-   pos2[1] = xy * pos1[0] + yy * pos1[1] + zy * pos1[2];
-   pos2[2] = xz * pos1[0] + yz * pos1[1] + zz * pos1[2];
+         if (*rar >= 24.0)
+           *rar -= 24.0;
 
+         *decr = atan2 (pr[2],proj) * RAD2DEG;
+      }
+   }
    return;
 }
 
-/********wobble */
+/********gcrs2equ */
 
-void wobble (double tjd, short int direction, double xp, double yp,
-             double *pos1,
+short int gcrs2equ (double jd_tt, short int coord_sys,
+                    short int accuracy, double rag, double decg,
 
-             double *pos2)
+                    double *ra, double *dec)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Corrects a vector in the ITRS (rotating Earth-fixed system)
-      for polar motion, and also corrects the longitude origin
-      (by a tiny amount) to the Terrestrial Intermediate Origin
-      (TIO).  The ITRS vector is thereby transformed to the terrestrial
-      intermediate system, based on the true (rotational) equator and
-      TIO.  Because the true equator is the plane orthogonal to the
-      direction of the Celestial Intermediate Pole (CIP), the components
-      of the output vector are referred to z and x axes toward the CIP
-      and TIO, respectively.
+      This function converts GCRS right ascension and declination
+      to coordinates with respect to the equator of date (mean or true).
+      For coordinates with respect to the true equator of date, the
+      origin of right ascension can be either the true equinox or the
+      celestial intermediate origin (CIO).
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
-      Lambert & Bizouard (2002), Astronomy and Astrophysics 394,
-         317-321.
+      None.
+
    INPUT
    ARGUMENTS:
-      tjd (double)
-         TT or UT1 Julian date.
-      direction (short int)
-         Flag determining 'direction' of transformation;
-            direction  = 0 transformation applied, ITRS to terrestrial
-                           intermediate system
-            direction != 0 inverse transformation applied, terrestrial
-                           intermediate system to ITRS
-      xp (double)
-         Conventionally-defined X coordinate of Celestial Intermediate
-         Pole with respect to ITRS pole, in arcseconds.
-      yp (double)
-         Conventionally-defined Y coordinate of Celestial Intermediate
-         Pole with respect to ITRS pole, in arcseconds.
-      pos1[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to ITRS axes.
+      jd_tt (double)
+         TT Julian date of equator to be used for output coordinates.
+      coord_sys (short int)
+         Coordinate system selection for output coordinates.
+            = 0 ... mean equator and equinox of date
+            = 1 ... true equator and equinox of date
+            = 2 ... true equator and CIO of date
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      rag (double)
+         GCRS right ascension in hours.
+      decg (double)
+         GCRS declination in degrees.
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to true equator and TIO.
+      ra (double)
+         Right ascension in hours, referred to specified equator and
+         right ascension origin of date.
+      dec (double)
+         Declination in degrees, referred to specified equator of date.
+
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         =  0 ... everything OK.
+         <  0 ... error from function 'vector2radec'
+         > 10 ... 10 + error from function 'cio_location'
+         > 20 ... 20 + error from function 'cio_basis'
 
    GLOBALS
    USED:
-      T0, ASEC2RAD       novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sin                math.h
-      cos                math.h
+      default_context    novas.c
+      gcrs2equ_ctx       novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
-      V2.0/10-03/JAB (USNO/AA) Update for IAU 2000 resolutions.
-      V2.1/01-05/JAB (USNO/AA) Include higher-order terms in the
-                               rotation.
-      V2.2/06-05/JAB (USNO/AA) Corrected sign of first term in
-                               expression for 'yy' (should be -).
-      V2.3/03-09/JAB (USNO/AA) Add 'direction' flag and inverse
-                               transformation; conformed input
-                               variables to IERS conventions.
+      V1.0/09-04/JAB (USNO/AA)
+      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.2/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
+      V1.3/04-08/WKP (USNO/AA) Updated variable names.
+      V1.4/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'wobble'.
+      1. Set input value of 'accuracy' equal to any short int if
+      'coord_sys' equals 0 or 1.  It is not used in these cases.
+      2. This function only supports the CIO-based method.
+      3. This function is the C version of NOVAS Fortran routine
+      'gcrseq'.
 
 ------------------------------------------------------------------------
 */
 {
-   double xpole, ypole, t, sprime, tiolon, sinx, cosx, siny, cosy, sinl,
-      cosl, xx, yx, zx, xy, yy, zy, xz, yz, zz;
-
-   xpole = xp * ASEC2RAD;
-   ypole = yp * ASEC2RAD;
-
-/*
-   Compute approximate longitude of TIO, using eq. (10) of the second
-   reference.
-
-   Note that 'tiolon,' the longitude correction, is negligible for
-   most astronomical purposes.
-*/
-
-   t = (tjd - T0) / 36525.0;
-
-   sprime = -47.0e-6 * t;
-   tiolon = -sprime * ASEC2RAD;
-
-/*
-   Compute elements of rotation matrix.
-   Equivalent to R3(-s')R2(x)R1(y) as per IERS Conventions (2003).
-*/
-
-   sinx = sin (xpole);
-   cosx = cos (xpole);
-   siny = sin (ypole);
-   cosy = cos (ypole);
-   sinl = sin (tiolon);
-   cosl = cos (tiolon);
-
-   xx =  cosx * cosl;
-   yx =  sinx * siny * cosl + cosy * sinl;
-   zx = -sinx * cosy * cosl + siny * sinl;
-   xy = -cosx * sinl;
-   yy = -sinx * siny * sinl + cosy * cosl;
-   zy =  sinx * cosy * sinl + siny * cosl;
-   xz =  sinx;
-   yz = -cosx * siny;
-   zz =  cosx * cosy;
-
-/*
-   Perform rotation from ITRS to terrestrial intermediate system.
-*/
-
-   if (direction == 0)
-   {
-      pos2[0] = xx * pos1[0] + yx * pos1[1] + zx * pos1[2];
-      pos2[1] = xy * pos1[0] + yy * pos1[1] + zy * pos1[2];
-      pos2[2] = xz * pos1[0] + yz * pos1[1] + zz * pos1[2];
-   }
-    else
-
-/*
-   Perform rotation from terrestrial intermediate system to ITRS.
-*/
-
-   {
-      pos2[0] = xx * pos1[0] + xy * pos1[1] + xz * pos1[2];
-      pos2[1] = yx * pos1[0] + yy * pos1[1] + yz * pos1[2];
-      pos2[2] = zx * pos1[0] + zy * pos1[1] + zz * pos1[2];
-   }
-
-   return;
+   return gcrs2equ_ctx (default_context (),
+      jd_tt,coord_sys,accuracy,rag,decg, ra,dec);
 }
 
-/********terra */
+/********gcrs2equ_ctx */
 
-void terra (on_surface *location, double st,
+short int gcrs2equ_ctx (novas_context *ctx, double jd_tt,
+                        short int coord_sys, short int accuracy,
+                        double rag, double decg,
 
-            double *pos, double *vel)
+                        double *ra, double *dec)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Computes the position and velocity vectors of a terrestrial
-      observer with respect to the center of the Earth.
+      This function is the version of 'gcrs2equ' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      See function 'gcrs2equ'.
 
    INPUT
    ARGUMENTS:
-      *location (struct on_surface)
-         Pointer to structure containing observer's location (defined
-         in novas.h).
-      st (double)
-         Local apparent sidereal time at reference meridian in hours.
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'gcrs2equ'.
 
    OUTPUT
    ARGUMENTS:
-      pos[3] (double)
-         Position vector of observer with respect to center of Earth,
-         equatorial rectangular coordinates, referred to true equator
-         and equinox of date, components in AU.
-      vel[3] (double)
-         Velocity vector of observer with respect to center of Earth,
-         equatorial rectangular coordinates, referred to true equator
-         and equinox of date, components in AU/day.
+      See function 'gcrs2equ'.
 
    RETURNED
    VALUE:
-      None.
+      See function 'gcrs2equ'.
 
    GLOBALS
    USED:
-      AU_KM, ERAD, F     novascon.c
-      ANGVEL, DEG2RAD    novascon.c
+      DEG2RAD, T0        novascon.c
 
    FUNCTIONS
    CALLED:
+      tdb2tt             novas.c
+      frame_tie_ctx      novas.c
+      precession_ctx     novas.c
+      nutation_ctx       novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      vector2radec       novas.c
       sin                math.h
       cos                math.h
-      sqrt               math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/04-93/WTH (USNO/AA):  Translate Fortran.
-      V1.1/06-98/JAB (USNO/AA):  Move constants 'f' and 'omega' to
-                                 file 'novascon.c'.
-      V1.2/10-03/JAB (USNO/AA):  Updates Notes; removed call to 'pow'.
-      V1.3/12-04/JAB (USNO/AA):  Update to use 'on_surface" structure.
-      V1.4/09-09/WKP (USNO/AA):  Moved ht_km calculation from first_entry
-                                 block.
+      V1.0/10-26/ROA:           Moved out of 'gcrs2equ' V1.3.
 
    NOTES:
-      1. If reference meridian is Greenwich and st=0, 'pos' is
-      effectively referred to equator and Greenwich.
-      2. This function ignores polar motion, unless the
-      observer's longitude and latitude have been corrected for it,
-      and variation in the length of day (angular velocity of earth).
-      3. The true equator and equinox of date do not form an
-      inertial system.  Therefore, with respect to an inertial system,
-      the very small velocity component (several meters/day) due to
-      the precession and nutation of the Earth's axis is not accounted
-      for here.
-      4. This function is the C version of NOVAS Fortran routine
-      'terra'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_entry = 1;
-   short int j;
-
-   static double erad_km, ht_km;
-   double df, df2, phi, sinphi, cosphi, c, s, ach, ash, stlocl, sinst,
-      cosst;
+   short int error = 0;
+   short int rs;
 
-   if (first_entry)
-   {
-      erad_km = ERAD / 1000.0;
-      first_entry = 0;
-   }
+   double t1, t, secdiff, r, d, pos1[3], pos2[3], pos3[3], pos4[3],
+      r_cio, x[3], y[3], z[3];
 
 /*
-   Compute parameters relating to geodetic to geocentric conversion.
+   't1' is the TDB Julian date.
 */
 
-   df = 1.0 - F;
-   df2 = df * df;
-
-   phi = location->latitude * DEG2RAD;
-   sinphi = sin (phi);
-   cosphi = cos (phi);
-   c = 1.0 / sqrt (cosphi * cosphi + df2 * sinphi * sinphi);
-   s = df2 * c;
-   ht_km = location->height / 1000.0;
-   ach = erad_km * c + ht_km;
-   ash = erad_km * s + ht_km;
+   tdb2tt (jd_tt, &t,&secdiff);
+   t1 = jd_tt + secdiff / 86400.0;
 
 /*
-   Compute local sidereal time factors at the observer's longitude.
+   Form position vector in equatorial system from input coordinates.
 */
 
-   stlocl = (st * 15.0 + location->longitude) * DEG2RAD;
-   sinst = sin (stlocl);
-   cosst = cos (stlocl);
+   r = rag * 15.0 * DEG2RAD;
+   d = decg * DEG2RAD;
+
+   pos1[0] = cos (d) * cos (r);
+   pos1[1] = cos (d) * sin (r);
+   pos1[2] = sin (d);
 
 /*
-   Compute position vector components in kilometers.
+   Transform the position vector based on the value of 'coord_sys'.
 */
 
-   pos[0] = ach * cosphi * cosst;
-   pos[1] = ach * cosphi * sinst;
-   pos[2] = ash * sinphi;
+   if (coord_sys <= 1 )
+   {
 
 /*
-   Compute velocity vector components in kilometers/sec.
+   Transform the position vector from GCRS to mean equator and equinox
+   of date.
 */
 
-   vel[0] = -ANGVEL * ach * cosphi * sinst;
-   vel[1] =  ANGVEL * ach * cosphi * cosst;
-   vel[2] =  0.0;
+      frame_tie_ctx (ctx,pos1,1, pos2);
+      precession_ctx (ctx,T0,pos2,t1, pos3);
 
 /*
-   Convert position and velocity components to AU and AU/DAY.
+   If requested, transform further to true equator and equinox of date.
 */
 
-   for (j = 0; j < 3; j++)
-   {
-      pos[j] /= AU_KM;
-      vel[j] /= AU_KM;
-      vel[j] *= 86400.0;
-   }
-
-   return;
-}
-
-/********e_tilt */
-
-void e_tilt (double jd_tdb, short int accuracy,
+          if (coord_sys == 1)
+          {
+             nutation_ctx (ctx,t1,0,accuracy,pos3, pos4);
+          }
+           else
+          {
+             pos4[0] = pos3[0];
+             pos4[1] = pos3[1];
+             pos4[2] = pos3[2];
+          }
+    }
+     else
 
-             double *mobl, double *tobl, double *ee, double *dpsi,
-             double *deps)
+    {
+
+/*
+   Obtain the basis vectors, in the GCRS, of the celestial intermediate
+   system.
+*/
+
+      if ((error = cio_location_ctx (ctx,t1,accuracy, &r_cio,&rs)) != 0)
+         return (error += 10);
+
+      if ((error = cio_basis_ctx (ctx,t1,r_cio,rs,accuracy, x,y,
+         z)) != 0) return (error += 20);
+
+/*
+   Transform position vector to the celestial intermediate system
+   (which has the CIO as its origin of right ascension).
+*/
+
+      pos4[0] = x[0] * pos1[0] + x[1] * pos1[1] + x[2] * pos1[2];
+      pos4[1] = y[0] * pos1[0] + y[1] * pos1[1] + y[2] * pos1[2];
+      pos4[2] = z[0] * pos1[0] + z[1] * pos1[1] + z[2] * pos1[2];
+   }
+
+/*
+   Convert the position vector to equatorial spherical coordinates.
+*/
+
+   if ((error = vector2radec (pos4, ra,dec)) != 0)
+   {
+      *ra = 0.0;
+      *dec = 0.0;
+      return (-1 * error);
+   }
+
+   return (error);
+}
+
+/********sidereal_time */
+
+short int sidereal_time (double jd_high, double jd_low,
+                         double delta_t,short int gst_type,
+                         short int method, short int accuracy,
+
+                         double *gst)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Computes quantities related to the orientation of the Earth's
-      rotation axis at Julian date 'jd_tdb'.
+      Computes the Greenwich sidereal time, either mean or apparent, at
+      Julian date 'jd_high' + 'jd_low'.
 
    REFERENCES:
-      None.
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
 
    INPUT
    ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian Date.
+      jd_high (double)
+         High-order part of UT1 Julian date.
+      jd_low (double)
+         Low-order part of UT1 Julian date.
+      delta_t (double)
+         Difference TT-UT1 at 'jd_high'+'jd_low', in seconds
+         of time.
+      gst_type (short int)
+         = 0 ... compute Greenwich mean sidereal time
+         = 1 ... compute Greenwich apparent sidereal time
+      method (short int)
+         Selection for method
+            = 0 ... CIO-based method
+            = 1 ... equinox-based method
       accuracy (short int)
          Selection for accuracy
             = 0 ... full accuracy
@@ -4160,418 +4999,2491 @@ void e_tilt (double jd_tdb, short int accuracy,
 
    OUTPUT
    ARGUMENTS:
-      *mobl (double)
-         Mean obliquity of the ecliptic in degrees at 'jd_tdb'.
-      *tobl (double)
-         True obliquity of the ecliptic in degrees at 'jd_tdb'.
-      *ee (double)
-         Equation of the equinoxes in seconds of time at 'jd_tdb'.
-      *dpsi (double)
-         Nutation in longitude in arcseconds at 'jd_tdb'.
-      *deps (double)
-         Nutation in obliquity in arcseconds at 'jd_tdb'.
+      *gst (double)
+         Greenwich (mean or apparent) sidereal time, in hours.
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         = 0         ... everything OK
+         = 1         ... invalid value of 'accuracy'
+         = 2         ... invalid value of 'method'
+         > 10, < 30  ... 10 + error from function 'cio_rai'
 
    GLOBALS
    USED:
-      PSI_COR, EPS_COR   novas.c
-      T0, ASEC2RAD       novascon.c
-      DEG2RAD            novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      nutation_angles    novas.c
-      ee_ct              novas.c
-      mean_obliq         novas.c
-      fabs               math.h
-      cos                math.h
+      default_context    novas.c
+      sidereal_time_ctx  novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
-      V1.1/06-97/JAB (USNO/AA) Incorporate IAU (1994) and IERS (1996)
-                               adjustment to the "equation of the
-                               equinoxes".
-      V1.2/10-97/JAB (USNO/AA) Implement function that computes
-                               arguments of the nutation series.
-      V1.3/07-98/JAB (USNO/AA) Use global variables 'PSI_COR' and
-                               'EPS_COR' to apply celestial pole offsets
-                               for high-precision applications.
-      V2.0/10-03/JAB (USNO/AA) Update function for IAU 2000 resolutions.
-      V2.1/12-04/JAB (USNO/AA) Add 'mode' argument.
-      V2.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.0/06-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C programing standards.
+      V1.2/03-98/JAB (USNO/AA) Expand documentation.
+      V1.3/08-98/JAB (USNO/AA) Match flow of the Fortran counterpart.
+      V2.0/09-03/JAB (USNO/AA) Incorporate the 2nd-reference changes.
+      V2.1/08-04/JAB (USNO/AA) Incorporate the 1st-reference changes.
+      V2.2/12-05/WKP (USNO/AA) Updated error handling.
+      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'method' and 'accuracy'.
+      V2.4/04-06/JAB (USNO/AA) Use precession-in-RA terms in mean
+                               sidereal time from third reference.
+      V2.5/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
+      V2.6/06-08/WKP (USNO/AA) Changed value of direction argument in
+                               call to 'nutation' from 1 to -1 for
+                               consistency.
+      V2.7/03-11/WKP (USNO/AA) Updated prolog description to clarify
+                               this function computes either mean or
+                               apparent sidereal time, and removed
+                               Note 1 for consistency with Fortran.
+      V2.8/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. Values of the celestial pole offsets 'PSI_COR' and 'EPS_COR'
-      are set using function 'cel_pole', if desired.  See the prolog
-      of 'cel_pole' for details.
+      1. The Julian date may be split at any point, but for highest
+      precision, set 'jd_high' to be the integral part of the Julian
+      date, and set 'jd_low' to be the fractional part.
       2. This function is the C version of NOVAS Fortran routine
-      'etilt'.
+      'sidtim'.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int accuracy_last = 0;
-   short int acc_diff;
+   return sidereal_time_ctx (default_context (),
+      jd_high,jd_low,delta_t,gst_type,method,accuracy, gst);
+}
 
-   static double jd_last = 0.0;
-   static double dp, de, c_terms;
-   double t, d_psi, d_eps, mean_ob, true_ob, eq_eq;
+/********sidereal_time_ctx */
 
+short int sidereal_time_ctx (novas_context *ctx, double jd_high,
+                             double jd_low, double delta_t,
+                             short int gst_type, short int method,
+                             short int accuracy,
+
+                             double *gst)
 /*
-   Compute time in Julian centuries from epoch J2000.0.
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'sidereal_time' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
+
+   REFERENCES:
+      See function 'sidereal_time'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'sidereal_time'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'sidereal_time'.
+
+   RETURNED
+   VALUE:
+      See function 'sidereal_time'.
+
+   GLOBALS
+   USED:
+      T0, RAD2DEG        novascon.c
+
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      era                novas.c
+      e_tilt_ctx         novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+      fabs               math.h
+      atan2              math.h
+      fmod               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'sidereal_time' V2.7.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
 */
+{
+   sidereal_time_saved *sv = &ctx->sidereal_time;
 
-   t = (jd_tdb - T0) / 36525.0;
+   short int error = 0;
+   short int ref_sys;
+
+   double unitx[3] = {1.0, 0.0, 0.0};
+   double jd_ut, jd_tt, jd_tdb, tt_temp, t, theta, a, b, c, d,
+      ra_cio, x[3], y[3], z[3], w1[3], w2[3], eq[3], ha_eq, st,
+      secdiff, eqeq;
 
 /*
-   Check for difference in accuracy mode from last call.
+   Invalid value of 'accuracy'.
 */
 
-   acc_diff = accuracy - accuracy_last;
+   if ((accuracy < 0) || (accuracy > 1))
+      return (error = 1);
 
 /*
-   Compute the nutation angles (arcseconds) if the input Julian date
-   is significantly different from the last Julian date, or the
-   accuracy mode has changed from the last call.
+   Time argument for precession and nutation components of sidereal
+   time is TDB.  First approximation is TDB = TT, then refine.
 */
 
-   if (((fabs (jd_tdb - jd_last)) > 1.0e-8) || (acc_diff != 0))
-   {
-      nutation_angles (t,accuracy, &dp,&de);
+   jd_ut = jd_high + jd_low;
+   jd_tt = jd_ut + (delta_t / 86400.0);
+   jd_tdb = jd_tt;
+   tdb2tt (jd_tdb, &tt_temp,&secdiff);
+   jd_tdb = jd_tt + (secdiff / 86400.0);
+
+   t = (jd_tdb - T0) / 36525.0;
 
 /*
-   Obtain complementary terms for equation of the equinoxes in
-   arcseconds.
+   Compute the Earth Rotation Angle.  Time argument is UT1.
 */
 
-      c_terms = ee_ct (jd_tdb,0.0,accuracy) / ASEC2RAD;
+   theta = era (jd_high, jd_low);
 
 /*
-   Reset the values of the last Julian date and last mode.
+   Compute the equation of the equinoxes if needed, depending upon the
+   input values of 'gst_type' and 'method'.  If not needed, set to zero.
 */
 
-      jd_last = jd_tdb;
-      accuracy_last = accuracy;
+   if (((gst_type == 0) && (method == 0)) ||       /* GMST; CIO-TIO */
+       ((gst_type == 1) && (method == 1)))         /* GAST; equinox */
+   {
+      if (fabs (jd_tdb - sv->jd_last) > 1.0e-8)
+      {
+         e_tilt_ctx (ctx,jd_tdb,accuracy, &a,&b,&sv->ee,&c,&d);
+         sv->jd_last = jd_tdb;
+      }
+      eqeq = sv->ee * 15.0;
+   }
+    else
+   {
+      eqeq = 0.0;
    }
 
 /*
-   Apply observed celestial pole offsets.
+   Compute Greenwich sidereal time depending upon input values of
+   'method' and 'gst_type'.
 */
 
-   d_psi = dp + PSI_COR;
-   d_eps = de + EPS_COR;
+   switch (method)
+   {
+      case (0):
 
 /*
-   Compute mean obliquity of the ecliptic in arcseconds.
+   Use 'CIO-TIO-theta' method.  See Circular 179, Section 6.5.4.
 */
 
-   mean_ob = mean_obliq (jd_tdb);
-
 /*
-   Compute true obliquity of the ecliptic in arcseconds.
+   Obtain the basis vectors, in the GCRS, of the celestial intermediate
+   system.
 */
 
-   true_ob = mean_ob + d_eps;
+         if ((error = cio_location_ctx (ctx,jd_tdb,accuracy, &ra_cio,
+            &ref_sys)) != 0)
+         {
+            *gst = 99.0;
+            return (error += 10);
+         }
+
+         cio_basis_ctx (ctx,jd_tdb,ra_cio,ref_sys,accuracy, x,y,z);
 
 /*
-   Convert obliquity values to degrees.
+   Compute the direction of the true equinox in the GCRS.
 */
 
-   mean_ob /= 3600.0;
-   true_ob /= 3600.0;
+         nutation_ctx (ctx,jd_tdb,-1,accuracy,unitx, w1);
+         precession_ctx (ctx,jd_tdb,w1,T0, w2);
+         frame_tie_ctx (ctx,w2,-1, eq);
 
 /*
-   Compute equation of the equinoxes in seconds of time.
+   Compute the hour angle of the equinox wrt the TIO meridian
+   (near Greenwich, but passes through the CIP and TIO).
 */
 
-   eq_eq = d_psi * cos (mean_ob * DEG2RAD) + c_terms;
-   eq_eq /= 15.0;
+         ha_eq = theta - atan2 ((eq[0] * y[0] + eq[1] * y[1] +
+            eq[2] * y[2]), (eq[0] * x[0] + eq[1] * x[1] +
+            eq[2] * x[2])) * RAD2DEG;
 
 /*
-   Set output values.
+   For mean sidereal time, subtract the equation of the equinoxes.
 */
 
-   *dpsi = d_psi;
-   *deps = d_eps;
-   *ee   = eq_eq;
-   *mobl = mean_ob;
-   *tobl = true_ob;
+         ha_eq -= (eqeq / 240.0);
 
-   return;
-}
-
-/********cel_pole */
-
-short int cel_pole (double tjd, short int type, double dpole1,
-                    double dpole2)
-/*
-------------------------------------------------------------------------
-
-   PURPOSE:
-      This function allows for the specification of celestial pole
-      offsets for high-precision applications.  Each set of offsets is
-      a correction to the modeled position of the pole for a specific
-      date, derived from observations and published by the IERS.
-
-   REFERENCES:
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
-      Kaplan, G. (2003), USNO/AA Technical Note 2003-03.
-
-   INPUT
-   ARGUMENTS:
-      tjd (double)
-         TDB or TT Julian date for pole offsets.
-      type (short int)
-         Type of pole offset
-            = 1 for corrections to angular coordinates of modeled pole
-                referred to mean ecliptic of date, that is,
-                delta-delta-psi and delta-delta-epsilon.
-            = 2 for corrections to components of modeled pole unit
-                vector referred to GCRS axes, that is, dx and dy.
-      dpole1 (double)
-         Value of celestial pole offset in first coordinate,
-         (delta-delta-psi or dx) in milliarcseconds.
-      dpole2 (double)
-         Value of celestial pole offset in second coordinate,
-         (delta-delta-epsilon or dy) in milliarcseconds.
-
-   OUTPUT
-   ARGUMENTS:
-      None.
-
-   RETURNED
-   VALUE:
-      (short int)
-          = 0 ... Everything OK.
-          = 1 ... Invalid value of 'type'.
-
-   GLOBALS
-   USED:
-      PSI_COR, EPS_COR   novas.c
-      T0, ASEC2RAD       novascon.c
-
-   FUNCTIONS
-   CALLED:
-      frame_tie          novas.c
-      precession         novas.c
-      mean_obliq         novas.c
-      sin                math.h
-
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
-
-   NOTES:
-      1. This function sets the values of global variables 'PSI_COR'
-      and 'EPS_COR' declared at the top of file 'novas.c'.  These
-      global variables are used only in NOVAS function 'e_tilt'.
-      2. This function, if used, should be called before any other
-      NOVAS functions for a given date.  Values of the pole offsets
-      specified via a call to this function will be used until
-      explicitly changed.
-      3. 'tjd' is used only for 'type' = 2, to transform dx and dy to
-      the equivalent delta-delta-psi and delta-delta-epsilon values.
-      4. For 'type' = 2, dx and dy are unit vector component
-      corrections, but are expressed in milliarcseconds simply by
-      multiplying by 206264806, the number of milliarcseconds in one
-      radian.
-      5. This function is the C version of NOVAS Fortran routine
-      'celpol'.
-
-------------------------------------------------------------------------
-*/
-{
-   short int error = 0;
-
-   double dx, dy, t, mean_ob, sin_e, x, dz, dp1[3], dp2[3], dp3[3];
+         ha_eq = fmod (ha_eq, 360.0) / 15.0;
+         if (ha_eq < 0.0)
+            ha_eq += 24.0;
+         *gst = ha_eq;
+         break;
 
-   switch (type)
-   {
       case (1):
 
 /*
-   Angular coordinates of modeled pole referred to mean ecliptic of
-   date, that is,delta-delta-psi and delta-delta-epsilon.
-*/
-
-          PSI_COR = dpole1 * 1.0e-3;
-          EPS_COR = dpole2 * 1.0e-3;
-          break;
-
-      case (2):
-
-/*
-   Components of modeled pole unit vector referred to GCRS axes, that
-   is, dx and dy.
-*/
-
-          dx = dpole1;
-          dy = dpole2;
-
-          t = (tjd - T0) / 36525.0;
-
-/*
-   Compute sin_e of mean obliquity of date.
+   Use equinox method.  See Circular 179, Section 2.6.2.
 */
 
-          mean_ob = mean_obliq (tjd);
-          sin_e = sin (mean_ob * ASEC2RAD);
-
 /*
-   The following algorithm, to transform dx and dy to
-   delta-delta-psi and delta-delta-epsilon, is from eqs. (7)-(9) of the
-   second reference.
-
-   Trivial model of pole trajectory in GCRS allows computation of dz.
+   Precession-in-RA terms in mean sidereal time taken from third
+   reference, eq. (42), with coefficients in arcseconds.
 */
 
-          x = (2004.190 * t) * ASEC2RAD;
-          dz = - (x + 0.5 * x * x * x) * dx;
+         st = eqeq + 0.014506 +
+               (((( -    0.0000000368   * t
+                    -    0.000029956  ) * t
+                    -    0.00000044   ) * t
+                    +    1.3915817    ) * t
+                    + 4612.156534     ) * t;
 
 /*
-   Form pole offset vector (observed - modeled) in GCRS.
+   Form the Greenwich sidereal time.
 */
 
-          dp1[0] = dx * 1.0e-3 * ASEC2RAD;
-          dp1[1] = dy * 1.0e-3 * ASEC2RAD;
-          dp1[2] = dz * 1.0e-3 * ASEC2RAD;
-
-/*
-   Precess pole offset vector to mean equator and equinox of date.
-*/
+         *gst = fmod ((st / 3600.0 + theta), 360.0) / 15.0;
 
-          frame_tie (dp1,1, dp2);
-          precession (T0,dp2,tjd, dp3);
+         if (*gst < 0.0)
+            *gst += 24.0;
+         break;
 
 /*
-   Compute delta-delta-psi and delta-delta-epsilon in arcseconds.
+   Invalid value of 'method'.
 */
 
-          PSI_COR = (dp3[0] / sin_e) / ASEC2RAD;
-          EPS_COR = dp3[1] / ASEC2RAD;
-          break;
-
       default:
-
-/*
-   Invalid value of 'type'.
-*/
-         error = 1;
+         *gst = 99.0;
+         error = 2;
          break;
    }
 
    return (error);
 }
 
-/********ee_ct */
+/********era */
 
-double ee_ct (double jd_high, double jd_low, short int accuracy)
+double era (double jd_high, double jd_low)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To compute the "complementary terms" of the equation of the
-      equinoxes.
+      This function returns the value of the Earth Rotation Angle
+      (theta) for a given UT1 Julian date.  The expression used is
+      taken from the note to IAU Resolution B1.8 of 2000.
 
    REFERENCES:
-      Capitaine, N., Wallace, P.T., and McCarthy, D.D. (2003). Astron. &
-         Astrophys. 406, p. 1135-1149. Table 3.
-      IERS Conventions (2010), Chapter 5, p. 60, Table 5.2e.
-         (Table 5.2e presented in the printed publication is a truncated
-         series. The full series, which is used in NOVAS, is available
-         on the IERS Conventions Center website in file tab5.2e.txt.)
-         ftp://tai.bipm.org/iers/conv2010/chapter5/
+      IAU Resolution B1.8, adopted at the 2000 IAU General Assembly,
+         Manchester, UK.
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
 
    INPUT
    ARGUMENTS:
       jd_high (double)
-         High-order part of TT Julian date.
+         High-order part of UT1 Julian date.
       jd_low (double)
-         Low-order part of TT Julian date.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+         Low-order part of UT1 Julian date.
 
    OUTPUT
    ARGUMENTS:
-      None
+      None.
 
    RETURNED
    VALUE:
       (double)
-         Complementary terms, in radians.
+         The Earth Rotation Angle (theta) in degrees.
 
    GLOBALS
    USED:
-      T0, ASEC2RAD       novascon.c
-      TWOPI              novascon.c
+      T0                 novascon.c
 
    FUNCTIONS
    CALLED:
-      norm_ang           novas.c
-      fund_args          novas.c
       fmod               math.h
-      sin                math.h
-      cos                math.h
 
    VER./DATE/
    PROGRAMMER:
       V1.0/09-03/JAB (USNO/AA)
-      V1.1/12-04/JAB (USNO/AA) Added low-accuracy formula.
-      V1.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V1.3/11-10/JAB (USNO/AA) Updated reference and notes.
-      V1.4/03-11/WKP (USNO/AA) Added braces to 2-D array initialization
-                               to quiet gcc warnings.
 
    NOTES:
-      1. The series used in this function was derived from the first
-      reference.  This same series was also adopted for use in the IAU's
-      Standards of Fundamental Astronomy (SOFA) software (i.e.,
-      subroutine eect00.for and function eect00.c).
-      2. The low-accuracy series used in this function is a simple
-      implementation derived from the first reference, in which terms
-      smaller than 2 microarcseconds have been omitted.
-      3. This function is based on NOVAS Fortran routine 'eect2000',
-      with the low-accuracy formula taken from NOVAS Fortran routine
-      'etilt'.
+      1. The algorithm used here is equivalent to the canonical
+      theta = 0.7790572732640 + 1.00273781191135448 * t,
+      where t is the time in days from J2000 (t = jd_high +
+      jd_low - T0), but it avoids many two-PI 'wraps' that decrease
+      precision (adopted from SOFA Fortran routine iau_era00; see
+      also expression at top of page 35 of IERS Conventions (1996)).
+      2. This function is the C version of NOVAS Fortran routine
+      'erot'.
 
 ------------------------------------------------------------------------
 */
+
 {
-   short int i, j;
+   double theta, thet1, thet2, thet3;
 
-   double t, fa[14], fa2[5], s0, s1, a, c_terms;
+   thet1 = 0.7790572732640 + 0.00273781191135448 * (jd_high - T0);
+   thet2 = 0.00273781191135448 * jd_low;
+   thet3 = fmod (jd_high, 1.0) + fmod (jd_low, 1.0);
+
+   theta = fmod (thet1 + thet2 + thet3, 1.0) * 360.0;
+   if (theta < 0.0)
+      theta += 360.0;
+
+   return theta;
+}
+
+/********ter2cel */
+
+short int ter2cel (double jd_ut_high, double jd_ut_low, double delta_t,
+                   short int method, short int accuracy, short int option,
+                   double xp, double yp, double *vec1,
 
+                   double *vec2)
 /*
-   Argument coefficients for t^0.
-*/
+------------------------------------------------------------------------
 
-   const short int ke0_t[33][14] = {
-      {0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  1,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  1,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  4, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  1, -1,  1,  0, -8, 12,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {0,  0,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {1,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
-      {1,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   PURPOSE:
+      This function rotates a vector from the terrestrial to the
+      celestial system.  Specifically, it transforms a vector in the
+      ITRS (rotating earth-fixed system) to the GCRS (a local space-
+      fixed system) by applying rotations for polar motion, Earth
+      rotation, nutation, precession, and the dynamical-to-GCRS
+      frame tie.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      Kaplan, G. H. (2003), 'Another Look at Non-Rotating Origins',
+         Proceedings of IAU XXV Joint Discussion 16.
+
+   INPUT
+   ARGUMENTS:
+      jd_ut_high (double)
+         High-order part of UT1 Julian date.
+      jd_ut_low (double)
+         Low-order part of UT1 Julian date.
+      delta_t (double)
+         Value of Delta T (= TT - UT1) at the input UT1 Julian date.
+      method (short int)
+         Selection for method
+            = 0 ... CIO-based method
+            = 1 ... equinox-based method
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      option (short int)
+            = 0 ... The output vector is referred to GCRS axes.
+            = 1 ... The output vector is produced with respect to the
+                    equator and equinox of date.
+                    See Note 2 below.
+      xp (double)
+         Conventionally-defined X coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+      yp (double)
+         Conventionally-defined Y coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+      vec1[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to ITRS axes (terrestrial system) in the normal case
+         where 'option' = 0.
+
+   OUTPUT
+   ARGUMENTS:
+      vec2[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to GCRS axes (celestial system) or with respect to
+         the equator and equinox of date, depending on 'option'.
+
+   RETURNED
+   VALUE:
+      =  0  ... everything is ok.
+      =  1  ... invalid value of 'accuracy'
+      =  2  ... invalid value of 'method'
+      > 10 ... 10 + error from function 'cio_location'
+      > 20 ... 20 + error from function 'cio_basis'
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      ter2cel_ctx        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
+      V2.0/10-03/JAB (USNO/AA) Formerly function 'pnsw.'  Update
+                               for IAU 2000 resolutions.
+      V2.1/01-05/JAB (USNO/AA) Update to include 'mode' flexibility.
+      V2.2/12-05/WKP (USNO/AA) Check error codes.
+      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'method' and 'accuracy'.
+      V2.4/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
+      V2.5/06-08/WKP (USNO/AA) Corrected sign of direction argument in
+                               'frame_tie' call and changed value of
+                               direction argument in call to 'nutation'
+                               for consistency.
+      V2.6/10-08/WKP (USNO/AA) Renamed input JD variables to include
+                               time system.
+      V2.7/03-09/JAB (USNO/AA) Conformed input variables to IERS
+                               conventions.
+      V2.8/12-10/JAB (USNO/AA) Cosmetic changes for consistency with
+                               Fortran.
+      V2.9/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. 'xp' = 'yp' = 0 means no polar motion transformation.
+      2. The 'option' flag only works for the equinox-based method.
+      3. This function is the C version of NOVAS Fortran routine
+      'tercel'.
+
+------------------------------------------------------------------------
+*/
+{
+   return ter2cel_ctx (default_context (),
+      jd_ut_high,jd_ut_low,delta_t,method,accuracy,option,xp,yp,vec1,
+      vec2);
+}
+
+/********ter2cel_ctx */
+
+short int ter2cel_ctx (novas_context *ctx, double jd_ut_high,
+                       double jd_ut_low, double delta_t,
+                       short int method, short int accuracy,
+                       short int option, double xp, double yp,
+                       double *vec1,
+
+                       double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'ter2cel' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'ter2cel'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'ter2cel'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'ter2cel'.
+
+   RETURNED
+   VALUE:
+      See function 'ter2cel'.
+
+   GLOBALS
+   USED:
+      T0                 novascon.c
+
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      wobble             novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      era                novas.c
+      spin_ctx           novas.c
+      sidereal_time_ctx  novas.c
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'ter2cel' V2.8.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+   short int rs, j;
+
+   double jd_ut1, jd_tt, dummy, secdiff, jd_tdb, gast, r_cio, theta,
+   v1[3], v2[3], v3[3], v4[3], x[3], y[3], z[3];
+
+/*
+   Invalid value of 'accuracy'.
+*/
+
+   if ((accuracy < 0) || (accuracy > 1))
+      return (error = 1);
+
+/*
+   Compute the TT Julian date corresponding to the input UT1 Julian
+   date.
+*/
+
+   jd_ut1 = jd_ut_high + jd_ut_low;
+   jd_tt = jd_ut1 + (delta_t / 86400.0);
+
+/*
+   Compute the TDB Julian date corresponding to the input UT1 Julian
+   date.
+*/
+
+   jd_tdb = jd_tt;
+   tdb2tt (jd_tdb, &dummy,&secdiff);
+   jd_tdb = jd_tt + secdiff / 86400.0;
+
+   switch (method)
+   {
+      case (0):
+
+/*
+   'CIO-TIO-THETA' method.
+
+   See second reference, eq. (3) and (4).
+
+   Apply polar motion, transforming the vector to the terrestrial
+   intermediate system.
+*/
+
+         if ((xp == 0.0) && (yp == 0.0))
+         {
+            v1[0] = vec1[0];
+            v1[1] = vec1[1];
+            v1[2] = vec1[2];
+         }
+          else
+            wobble (jd_tdb,0,xp,yp,vec1, v1);
+
+/*
+   Obtain the basis vectors, in the GCRS, of the celestial intermediate
+   system.
+*/
+
+      if ((error = cio_location_ctx (ctx,jd_tdb,accuracy, &r_cio,
+         &rs)) != 0) return (error += 10);
+
+      if ((error = cio_basis_ctx (ctx,jd_tdb,r_cio,rs,accuracy, x,y,
+         z)) != 0) return (error += 20);
+
+/*
+   Compute and apply the Earth rotation angle, 'theta', transforming the
+   vector to the celestial intermediate system.
+*/
+
+         theta = era (jd_ut_high,jd_ut_low);
+         spin_ctx (ctx,-theta,v1, v2);
+
+/*
+   Transform the vector from the celestial intermediate system to the
+   GCRS.
+*/
+
+         vec2[0] = x[0] * v2[0] + y[0] * v2[1] + z[0] * v2[2];
+         vec2[1] = x[1] * v2[0] + y[1] * v2[1] + z[1] * v2[2];
+         vec2[2] = x[2] * v2[0] + y[2] * v2[1] + z[2] * v2[2];
+         break;
+
+      case (1):
+
+/*
+   Equinox mode.
+
+   Apply polar motion.
+*/
+
+         if ((xp == 0.0) && (yp == 0.0))
+         {
+            for (j = 0; j < 3; j++)
+            {
+               v1[j] = vec1[j];
+            }
+         }
+          else
+            wobble (jd_tdb,0,xp,yp,vec1, v1);
+
+/*
+   Apply Earth rotation.
+*/
+
+         sidereal_time_ctx (ctx,jd_ut_high,jd_ut_low,delta_t,1,1,
+            accuracy, &gast);
+         spin_ctx (ctx,-gast * 15.0,v1, v2);
+
+/*
+   'option' = 1 skips remaining transformations.
+*/
+
+         if (option == 1)
+         {
+            vec2[0] = v2[0];
+            vec2[1] = v2[1];
+            vec2[2] = v2[2];
+         }
+          else
+         {
+
+/*
+   Apply precession, nutation, and frame tie.
+*/
+
+            nutation_ctx (ctx,jd_tdb,-1,accuracy,v2, v3);
+            precession_ctx (ctx,jd_tdb,v3,T0, v4);
+            frame_tie_ctx (ctx,v4,-1, vec2);
+         }
+         break;
+
+/*
+   Invalid value of 'method'.
+*/
+
+      default:
+         error = 2;
+         break;
+   }
+
+   return (error);
+}
+
+/********cel2ter */
+
+short int cel2ter (double jd_ut_high, double jd_ut_low, double delta_t,
+                   short int method, short int accuracy, short int option,
+                   double xp, double yp, double *vec1,
+
+                   double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function rotates a vector from the celestial to the
+      terrestrial system.  Specifically, it transforms a vector in the
+      GCRS (a local space-fixed system) to the ITRS (a rotating earth-
+      fixed system) by applying rotations for the GCRS-to-dynamical
+      frame tie, precession, nutation, Earth rotation, and polar motion.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      Kaplan, G. H. (2003), 'Another Look at Non-Rotating Origins',
+         Proceedings of IAU XXV Joint Discussion 16.
+
+   INPUT
+   ARGUMENTS:
+      jd_ut_high (double)
+         High-order part of UT1 Julian date.
+      jd_ut_low (double)
+         Low-order part of UT1 Julian date.
+      delta_t (double)
+         Value of Delta T (= TT - UT1) at the input UT1 Julian date.
+      method (short int)
+         Selection for method
+            = 0 ... CIO-based method
+            = 1 ... equinox-based method
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      option (short int)
+            = 0 ... The input vector is referred to GCRS axes.
+            = 1 ... The input vector is produced with respect to the
+                    equator and equinox of date.
+                    See Note 2 below.
+      xp (double)
+         Conventionally-defined X coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+      yp (double)
+         Conventionally-defined Y coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+      vec1[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to GCRS axes (celestial system) or with respect to
+         the equator and equinox of date, depending on 'option'.
+
+   OUTPUT
+   ARGUMENTS:
+      vec2[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to ITRS axes (terrestrial system).
+
+   RETURNED
+   VALUE:
+      =  0  ... everything is ok.
+      =  1  ... invalid value of 'accuracy'
+      =  2  ... invalid value of 'method'
+      > 10 ... 10 + error from function 'cio_location'
+      > 20 ... 20 + error from function 'cio_basis'
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      cel2ter_ctx        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-09/JAB (USNO/AA)
+      V1.1/12-10/JAB (USNO/AA) Fix confusion with input/output vectors;
+                               cosmetic changes to better match Fortran.
+      V1.2/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. 'xp' = 'yp' = 0 means no polar motion transformation.
+      2. 'option' = 1 only works for the equinox-based method
+      ('method' = 1).
+      3. This function is the C version of NOVAS Fortran routine
+      'celter'.
+
+------------------------------------------------------------------------
+*/
+{
+   return cel2ter_ctx (default_context (),
+      jd_ut_high,jd_ut_low,delta_t,method,accuracy,option,xp,yp,vec1,
+      vec2);
+}
+
+/********cel2ter_ctx */
+
+short int cel2ter_ctx (novas_context *ctx, double jd_ut_high,
+                       double jd_ut_low, double delta_t,
+                       short int method, short int accuracy,
+                       short int option, double xp, double yp,
+                       double *vec1,
+
+                       double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'cel2ter' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'cel2ter'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cel2ter'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'cel2ter'.
+
+   RETURNED
+   VALUE:
+      See function 'cel2ter'.
+
+   GLOBALS
+   USED:
+      T0                 novascon.c
+
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      wobble             novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      era                novas.c
+      spin_ctx           novas.c
+      sidereal_time_ctx  novas.c
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'cel2ter' V1.1.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+   short int rs, j;
+
+   double jd_ut1, jd_tt, dummy, secdiff, jd_tdb, gast, r_cio, theta,
+   v1[3], v2[3], v3[3], v4[3], x[3], y[3], z[3];
+
+/*
+   Invalid value of 'accuracy'.
+*/
+
+   if ((accuracy < 0) || (accuracy > 1))
+      return (error = 1);
+
+/*
+   Compute the TT Julian date corresponding to the input UT1 Julian
+   date.
+*/
+
+   jd_ut1 = jd_ut_high + jd_ut_low;
+   jd_tt = jd_ut1 + (delta_t / 86400.0);
+
+/*
+   Compute the TDB Julian date corresponding to the input UT1 Julian
+   date.
+*/
+
+   jd_tdb = jd_tt;
+   tdb2tt (jd_tdb, &dummy,&secdiff);
+   jd_tdb = jd_tt + secdiff / 86400.0;
+
+   switch (method)
+   {
+      case (0):
+
+/*
+   'CIO-TIO-THETA' method.
+
+   See second reference, eq. (3) and (4).
+
+   Obtain the basis vectors, in the GCRS, of the celestial intermediate
+   system.
+*/
+
+         if ((error = cio_location_ctx (ctx,jd_tdb,accuracy, &r_cio,
+            &rs)) != 0) return (error += 10);
+
+         if ((error = cio_basis_ctx (ctx,jd_tdb,r_cio,rs,accuracy, x,y,
+            z)) != 0) return (error += 20);
+
+/*
+   Transform the vector from the GCRS to the celestial intermediate
+   system.
+*/
+
+         v1[0] = x[0] * vec1[0] + x[1] * vec1[1] + x[2] * vec1[2];
+         v1[1] = y[0] * vec1[0] + y[1] * vec1[1] + y[2] * vec1[2];
+         v1[2] = z[0] * vec1[0] + z[1] * vec1[1] + z[2] * vec1[2];
+
+/*
+   Compute and apply the Earth rotation angle, 'theta', transforming the
+   vector to the terrestrial intermediate system.
+*/
+
+         theta = era (jd_ut_high,jd_ut_low);
+         spin_ctx (ctx,theta,v1, v2);
+
+/*
+   Apply polar motion, transforming the vector to the ITRS.
+*/
+
+         if ((xp == 0.0) && (yp == 0.0))
+         {
+            vec2[0] = v2[0];
+            vec2[1] = v2[1];
+            vec2[2] = v2[2];
+         }
+          else
+            wobble (jd_tdb,1,xp,yp,v2, vec2);
+
+         break;
+
+      case (1):
+
+/*
+   Equinox mode.
+
+   'option' = 1 skips initial transformations.
+*/
+
+         if (option == 1)
+         {
+            v3[0] = vec1[0];
+            v3[1] = vec1[1];
+            v3[2] = vec1[2];
+         }
+          else
+         {
+
+/*
+   Apply frame tie, nutation, and precession.
+*/
+
+            frame_tie_ctx (ctx,vec1,1, v1);
+            precession_ctx (ctx,T0,v1,jd_tdb, v2);
+            nutation_ctx (ctx,jd_tdb,0,accuracy,v2, v3);
+         }
+
+/*
+   Apply Earth rotation.
+*/
+
+         sidereal_time_ctx (ctx,jd_ut_high,jd_ut_low,delta_t,1,1,
+            accuracy, &gast);
+         spin_ctx (ctx,gast * 15.0,v3, v4);
+
+/*
+   Apply polar motion.
+*/
+
+         if ((xp == 0.0) && (yp == 0.0))
+         {
+            for (j = 0; j < 3; j++)
+            {
+               vec2[j] = v4[j];
+            }
+         }
+          else
+            wobble (jd_tdb,1,xp,yp,v4, vec2);
+
+         break;
+
+/*
+   Invalid value of 'method'.
+*/
+
+      default:
+         error = 2;
+         break;
+   }
+
+   return (error);
+}
+
+/********ter2cel_matrix */
+
+short int ter2cel_matrix (double jd_ut_high, double jd_ut_low,
+                          double delta_t, short int method,
+                          short int accuracy, short int option,
+                          double xp, double yp,
+
+                          double mat[3][3])
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the matrix of the rotation of function
+      'ter2cel', from the ITRS to the GCRS (or to the equator and
+      equinox of date), so that many vectors can be rotated at the same
+      instant with one product each (see 'ter2cel_apply').
+
+   REFERENCES:
+      See function 'ter2cel'.
+
+   INPUT
+   ARGUMENTS:
+      jd_ut_high (double)
+         High-order part of UT1 Julian date.
+      jd_ut_low (double)
+         Low-order part of UT1 Julian date.
+      delta_t (double)
+         Value of Delta T (= TT - UT1) at the input UT1 Julian date.
+      method (short int)
+         Selection for method
+            = 0 ... CIO-based method
+            = 1 ... equinox-based method
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      option (short int)
+            = 0 ... The matrix gives GCRS vectors.
+            = 1 ... The matrix gives vectors referred to the equator
+                    and equinox of date (equinox-based method only).
+      xp (double)
+         Conventionally-defined X coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+      yp (double)
+         Conventionally-defined Y coordinate of celestial intermediate
+         pole with respect to ITRS pole, in arcseconds.
+
+   OUTPUT
+   ARGUMENTS:
+      mat[3][3] (double)
+         Rotation matrix: 'ter2cel' gives, for an ITRS vector 'v',
+         the vector with components mat[i][0] * v[0] + mat[i][1] * v[1]
+         + mat[i][2] * v[2].  Its transpose is the rotation of
+         'cel2ter'.
+
+   RETURNED
+   VALUE:
+      See function 'ter2cel'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      ter2cel_matrix_ctx novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The matrix of the last call is kept (see
+      'ter2cel_matrix_ctx'), so that calling the function again for the
+      same instant costs only a comparison of the arguments.
+
+------------------------------------------------------------------------
+*/
+{
+   return ter2cel_matrix_ctx (default_context (), jd_ut_high,jd_ut_low,
+      delta_t,method,accuracy,option,xp,yp, mat);
+}
+
+/********ter2cel_matrix_ctx */
+
+short int ter2cel_matrix_ctx (novas_context *ctx, double jd_ut_high,
+                              double jd_ut_low, double delta_t,
+                              short int method, short int accuracy,
+                              short int option, double xp, double yp,
+
+                              double mat[3][3])
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'ter2cel_matrix' that keeps the
+      matrix of the last call in the computation context 'ctx', so that
+      different contexts can be used concurrently from different
+      threads.
+
+   REFERENCES:
+      See function 'ter2cel'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'ter2cel_matrix'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'ter2cel_matrix'.
+
+   RETURNED
+   VALUE:
+      See function 'ter2cel'.
+
+   GLOBALS
+   USED:
+      NUT_SOURCE         novas.c
+      NUT_TOLERANCE      novas.c
+
+   FUNCTIONS
+   CALLED:
+      ter2cel_ctx        novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The columns of the matrix are the rotations by 'ter2cel_ctx'
+      of the ITRS unit vectors, so a product with the matrix agrees with
+      'ter2cel_ctx' to the rounding errors (about 1.0e-16).
+      2. The matrix is computed again when any argument, the celestial
+      pole offsets of 'ctx' or the nutation settings change.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+   short int i, j;
+
+   double e[3], v[3];
+
+   ter2cel_matrix_saved *sv = &ctx->ter2cel_matrix;
+
+   if ((sv->valid) && (jd_ut_high == sv->jd_high_last) &&
+      (jd_ut_low == sv->jd_low_last) && (delta_t == sv->delta_t_last) &&
+      (method == sv->method_last) && (accuracy == sv->acc_last) &&
+      (option == sv->option_last) && (xp == sv->xp_last) &&
+      (yp == sv->yp_last) && (ctx->psi_cor == sv->psi_cor_last) &&
+      (ctx->eps_cor == sv->eps_cor_last) &&
+      (NUT_SOURCE == sv->source_last) &&
+      (NUT_TOLERANCE == sv->tolerance_last))
+   {
+      for (i = 0; i < 3; i++)
+      {
+         for (j = 0; j < 3; j++)
+            mat[i][j] = sv->mat[i][j];
+      }
+
+      return (error);
+   }
+
+/*
+   Rotate the ITRS unit vectors; they are the columns of the matrix.
+*/
+
+   sv->valid = 0;
+
+   for (j = 0; j < 3; j++)
+   {
+      for (i = 0; i < 3; i++)
+         e[i] = (i == j) ? 1.0 : 0.0;
+
+      if ((error = ter2cel_ctx (ctx,jd_ut_high,jd_ut_low,delta_t,method,
+         accuracy,option,xp,yp,e, v)) != 0)
+         return (error);
+
+      for (i = 0; i < 3; i++)
+      {
+         mat[i][j] = v[i];
+         sv->mat[i][j] = v[i];
+      }
+   }
+
+   sv->jd_high_last = jd_ut_high;
+   sv->jd_low_last = jd_ut_low;
+   sv->delta_t_last = delta_t;
+   sv->method_last = method;
+   sv->acc_last = accuracy;
+   sv->option_last = option;
+   sv->xp_last = xp;
+   sv->yp_last = yp;
+   sv->psi_cor_last = ctx->psi_cor;
+   sv->eps_cor_last = ctx->eps_cor;
+   sv->source_last = NUT_SOURCE;
+   sv->tolerance_last = NUT_TOLERANCE;
+   sv->valid = 1;
+
+   return (error);
+}
+
+/********ter2cel_apply */
+
+void ter2cel_apply (double mat[3][3], short int direction, double *vec1,
+
+                    double *vec2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function rotates a vector with a matrix of 'ter2cel_matrix':
+      from the terrestrial to the celestial system, as 'ter2cel', or
+      back, as 'cel2ter'.
+
+   REFERENCES:
+      See function 'ter2cel'.
+
+   INPUT
+   ARGUMENTS:
+      mat[3][3] (double)
+         Rotation matrix from 'ter2cel_matrix'.
+      direction (short int)
+         Set 'direction' = 0 for the terrestrial-to-celestial rotation
+         ('ter2cel'); set 'direction' < 0 for the
+         celestial-to-terrestrial rotation ('cel2ter', the transpose of
+         the matrix).
+      vec1[3] (double)
+         Position vector in the system of origin.
+
+   OUTPUT
+   ARGUMENTS:
+      vec2[3] (double)
+         Position vector in the other system.  May be the same array as
+         'vec1'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. For the rotation back, the matrix must be built with the
+      arguments of the 'cel2ter' call that it replaces.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   double v[3];
+
+   for (i = 0; i < 3; i++)
+   {
+      if (direction < 0)
+         v[i] = mat[0][i] * vec1[0] + mat[1][i] * vec1[1] +
+                mat[2][i] * vec1[2];
+       else
+         v[i] = mat[i][0] * vec1[0] + mat[i][1] * vec1[1] +
+                mat[i][2] * vec1[2];
+   }
+
+   for (i = 0; i < 3; i++)
+      vec2[i] = v[i];
+
+   return;
+}
+
+/********spin */
+
+void spin (double angle, double *pos1,
+
+           double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function transforms a vector from one coordinate system
+      to another with same origin and axes rotated about the z-axis.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+
+   INPUT
+   ARGUMENTS:
+      angle (double)
+         Angle of coordinate system rotation, positive counterclockwise
+         when viewed from +z, in degrees.
+      pos1[3] (double)
+         Position vector.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector expressed in new coordinate system rotated
+         about z by 'angle'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      spin_ctx           novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
+      V2.0/10-03/JAB (USNO/AA) Update for IAU 2000 resolutions.
+      V2.1/01-05/JAB (USNO/AA) Generalize the function.
+      V2.2/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine 'spin'.
+
+------------------------------------------------------------------------
+*/
+{
+   spin_ctx (default_context (), angle,pos1, pos2);
+   return;
+}
+
+/********spin_ctx */
+
+void spin_ctx (novas_context *ctx, double angle, double *pos1,
+
+               double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'spin' that keeps the values
+      saved between calls in the computation context 'ctx', so
+      that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'spin'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'spin'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'spin'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      DEG2RAD            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sin                math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'spin' V2.1.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   spin_saved *sv = &ctx->spin;
+
+   double angr, cosang, sinang;
+
+   if (fabs (angle - sv->ang_last) >= 1.0e-12)
+   {
+      angr = angle * DEG2RAD;
+      cosang = cos (angr);
+      sinang = sin (angr);
+
+/*
+   Rotation matrix follows.
+*/
+
+      sv->xx =  cosang;
+      sv->yx =  sinang;
+      sv->zx =  0.0;
+      sv->xy =  -sinang;
+      sv->yy =  cosang;
+      sv->zy =  0.0;
+      sv->xz =  0.0;
+      sv->yz =  0.0;
+      sv->zz =  1.0;
+
+      sv->ang_last = angle;
+   }
+
+/*
+   Perform rotation.
+*/
+
+   pos2[0] = sv->xx * pos1[0] + sv->yx * pos1[1] + sv->zx * pos1[2];
+   pos2[1] = sv->xy * pos1[0] + sv->yy * pos1[1] + sv->zy * pos1[2];
+   pos2[2] = sv->xz * pos1[0] + sv->yz * pos1[1] + sv->zz * pos1[2];
+
+   return;
+}
+
+/********wobble */
+
+void wobble (double tjd, short int direction, double xp, double yp,
+             double *pos1,
+
+             double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Corrects a vector in the ITRS (rotating Earth-fixed system)
+      for polar motion, and also corrects the longitude origin
+      (by a tiny amount) to the Terrestrial Intermediate Origin
+      (TIO).  The ITRS vector is thereby transformed to the terrestrial
+      intermediate system, based on the true (rotational) equator and
+      TIO.  Because the true equator is the plane orthogonal to the
+      direction of the Celestial Intermediate Pole (CIP), the components
+      of the output vector are referred to z and x axes toward the CIP
+      and TIO, respectively.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      Lambert & Bizouard (2002), Astronomy and Astrophysics 394,
+         317-321.
+   INPUT
+   ARGUMENTS:
+      tjd (double)
+         TT or UT1 Julian date.
+      direction (short int)
+         Flag determining 'direction' of transformation;
+            direction  = 0 transformation applied, ITRS to terrestrial
+                           intermediate system
+            direction != 0 inverse transformation applied, terrestrial
+                           intermediate system to ITRS
+      xp (double)
+         Conventionally-defined X coordinate of Celestial Intermediate
+         Pole with respect to ITRS pole, in arcseconds.
+      yp (double)
+         Conventionally-defined Y coordinate of Celestial Intermediate
+         Pole with respect to ITRS pole, in arcseconds.
+      pos1[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to ITRS axes.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to true equator and TIO.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sin                math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
+      V2.0/10-03/JAB (USNO/AA) Update for IAU 2000 resolutions.
+      V2.1/01-05/JAB (USNO/AA) Include higher-order terms in the
+                               rotation.
+      V2.2/06-05/JAB (USNO/AA) Corrected sign of first term in
+                               expression for 'yy' (should be -).
+      V2.3/03-09/JAB (USNO/AA) Add 'direction' flag and inverse
+                               transformation; conformed input
+                               variables to IERS conventions.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'wobble'.
+
+------------------------------------------------------------------------
+*/
+{
+   double xpole, ypole, t, sprime, tiolon, sinx, cosx, siny, cosy, sinl,
+      cosl, xx, yx, zx, xy, yy, zy, xz, yz, zz;
+
+   xpole = xp * ASEC2RAD;
+   ypole = yp * ASEC2RAD;
+
+/*
+   Compute approximate longitude of TIO, using eq. (10) of the second
+   reference.
+
+   Note that 'tiolon,' the longitude correction, is negligible for
+   most astronomical purposes.
+*/
+
+   t = (tjd - T0) / 36525.0;
+
+   sprime = -47.0e-6 * t;
+   tiolon = -sprime * ASEC2RAD;
+
+/*
+   Compute elements of rotation matrix.
+   Equivalent to R3(-s')R2(x)R1(y) as per IERS Conventions (2003).
+*/
+
+   sinx = sin (xpole);
+   cosx = cos (xpole);
+   siny = sin (ypole);
+   cosy = cos (ypole);
+   sinl = sin (tiolon);
+   cosl = cos (tiolon);
+
+   xx =  cosx * cosl;
+   yx =  sinx * siny * cosl + cosy * sinl;
+   zx = -sinx * cosy * cosl + siny * sinl;
+   xy = -cosx * sinl;
+   yy = -sinx * siny * sinl + cosy * cosl;
+   zy =  sinx * cosy * sinl + siny * cosl;
+   xz =  sinx;
+   yz = -cosx * siny;
+   zz =  cosx * cosy;
+
+/*
+   Perform rotation from ITRS to terrestrial intermediate system.
+*/
+
+   if (direction == 0)
+   {
+      pos2[0] = xx * pos1[0] + yx * pos1[1] + zx * pos1[2];
+      pos2[1] = xy * pos1[0] + yy * pos1[1] + zy * pos1[2];
+      pos2[2] = xz * pos1[0] + yz * pos1[1] + zz * pos1[2];
+   }
+    else
+
+/*
+   Perform rotation from terrestrial intermediate system to ITRS.
+*/
+
+   {
+      pos2[0] = xx * pos1[0] + xy * pos1[1] + xz * pos1[2];
+      pos2[1] = yx * pos1[0] + yy * pos1[1] + yz * pos1[2];
+      pos2[2] = zx * pos1[0] + zy * pos1[1] + zz * pos1[2];
+   }
+
+   return;
+}
+
+/********terra */
+
+void terra (on_surface *location, double st,
+
+            double *pos, double *vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the position and velocity vectors of a terrestrial
+      observer with respect to the center of the Earth.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+
+   INPUT
+   ARGUMENTS:
+      *location (struct on_surface)
+         Pointer to structure containing observer's location (defined
+         in novas.h).
+      st (double)
+         Local apparent sidereal time at reference meridian in hours.
+
+   OUTPUT
+   ARGUMENTS:
+      pos[3] (double)
+         Position vector of observer with respect to center of Earth,
+         equatorial rectangular coordinates, referred to true equator
+         and equinox of date, components in AU.
+      vel[3] (double)
+         Velocity vector of observer with respect to center of Earth,
+         equatorial rectangular coordinates, referred to true equator
+         and equinox of date, components in AU/day.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      AU_KM, ERAD, F     novascon.c
+      ANGVEL, DEG2RAD    novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sin                math.h
+      cos                math.h
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/04-93/WTH (USNO/AA):  Translate Fortran.
+      V1.1/06-98/JAB (USNO/AA):  Move constants 'f' and 'omega' to
+                                 file 'novascon.c'.
+      V1.2/10-03/JAB (USNO/AA):  Updates Notes; removed call to 'pow'.
+      V1.3/12-04/JAB (USNO/AA):  Update to use 'on_surface" structure.
+      V1.4/09-09/WKP (USNO/AA):  Moved ht_km calculation from first_entry
+                                 block.
+      V1.5/10-26/ROA:            No static variables, so that the
+                                 function is re-entrant.
+
+   NOTES:
+      1. If reference meridian is Greenwich and st=0, 'pos' is
+      effectively referred to equator and Greenwich.
+      2. This function ignores polar motion, unless the
+      observer's longitude and latitude have been corrected for it,
+      and variation in the length of day (angular velocity of earth).
+      3. The true equator and equinox of date do not form an
+      inertial system.  Therefore, with respect to an inertial system,
+      the very small velocity component (several meters/day) due to
+      the precession and nutation of the Earth's axis is not accounted
+      for here.
+      4. This function is the C version of NOVAS Fortran routine
+      'terra'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int j;
+
+   double erad_km, ht_km, df, df2, phi, sinphi, cosphi, c, s, ach, ash,
+      stlocl, sinst, cosst;
+
+   erad_km = ERAD / 1000.0;
+
+/*
+   Compute parameters relating to geodetic to geocentric conversion.
+*/
+
+   df = 1.0 - F;
+   df2 = df * df;
+
+   phi = location->latitude * DEG2RAD;
+   sinphi = sin (phi);
+   cosphi = cos (phi);
+   c = 1.0 / sqrt (cosphi * cosphi + df2 * sinphi * sinphi);
+   s = df2 * c;
+   ht_km = location->height / 1000.0;
+   ach = erad_km * c + ht_km;
+   ash = erad_km * s + ht_km;
+
+/*
+   Compute local sidereal time factors at the observer's longitude.
+*/
+
+   stlocl = (st * 15.0 + location->longitude) * DEG2RAD;
+   sinst = sin (stlocl);
+   cosst = cos (stlocl);
+
+/*
+   Compute position vector components in kilometers.
+*/
+
+   pos[0] = ach * cosphi * cosst;
+   pos[1] = ach * cosphi * sinst;
+   pos[2] = ash * sinphi;
+
+/*
+   Compute velocity vector components in kilometers/sec.
+*/
+
+   vel[0] = -ANGVEL * ach * cosphi * sinst;
+   vel[1] =  ANGVEL * ach * cosphi * cosst;
+   vel[2] =  0.0;
+
+/*
+   Convert position and velocity components to AU and AU/DAY.
+*/
+
+   for (j = 0; j < 3; j++)
+   {
+      pos[j] /= AU_KM;
+      vel[j] /= AU_KM;
+      vel[j] *= 86400.0;
+   }
+
+   return;
+}
+
+/********e_tilt */
+
+void e_tilt (double jd_tdb, short int accuracy,
+
+             double *mobl, double *tobl, double *ee, double *dpsi,
+             double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes quantities related to the orientation of the Earth's
+      rotation axis at Julian date 'jd_tdb'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian Date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      *mobl (double)
+         Mean obliquity of the ecliptic in degrees at 'jd_tdb'.
+      *tobl (double)
+         True obliquity of the ecliptic in degrees at 'jd_tdb'.
+      *ee (double)
+         Equation of the equinoxes in seconds of time at 'jd_tdb'.
+      *dpsi (double)
+         Nutation in longitude in arcseconds at 'jd_tdb'.
+      *deps (double)
+         Nutation in obliquity in arcseconds at 'jd_tdb'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context     novas.c
+      e_tilt_ctx          novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/08-93/WTH (USNO/AA) Translate Fortran.
+      V1.1/06-97/JAB (USNO/AA) Incorporate IAU (1994) and IERS (1996)
+                               adjustment to the "equation of the
+                               equinoxes".
+      V1.2/10-97/JAB (USNO/AA) Implement function that computes
+                               arguments of the nutation series.
+      V1.3/07-98/JAB (USNO/AA) Use global variables 'PSI_COR' and
+                               'EPS_COR' to apply celestial pole offsets
+                               for high-precision applications.
+      V2.0/10-03/JAB (USNO/AA) Update function for IAU 2000 resolutions.
+      V2.1/12-04/JAB (USNO/AA) Add 'mode' argument.
+      V2.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V2.3/10-26/ROA           Recompute the angles when the nutation
+                               source changes.
+      V2.4/10-26/ROA           Recompute the angles when the nutation
+                               tolerance changes.
+      V2.5/10-26/ROA           Interpolate the nutation table, if any.
+      V2.6/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. Values of the celestial pole offsets of the default
+      'novas_context' are set using function 'cel_pole', if desired.
+      See the prolog of 'cel_pole' for details.
+      2. If a table made with 'nutation_table_make' or read with
+      'nutation_table_load' covers 'jd_tdb' and was made for the same
+      'accuracy', the nutation angles, the mean obliquity and the
+      complementary terms are interpolated from it instead of being
+      evaluated.
+      3. This function is the C version of NOVAS Fortran routine
+      'etilt'.
+
+------------------------------------------------------------------------
+*/
+{
+   e_tilt_ctx (default_context (), jd_tdb,accuracy,
+      mobl,tobl,ee,dpsi,deps);
+   return;
+}
+
+/********e_tilt_ctx */
+
+void e_tilt_ctx (novas_context *ctx, double jd_tdb, short int accuracy,
+
+                 double *mobl, double *tobl, double *ee, double *dpsi,
+                 double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'e_tilt' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'e_tilt'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'e_tilt'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'e_tilt'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      NUT_SOURCE         novas.c
+      NUT_TOLERANCE      novas.c
+      T0, ASEC2RAD       novascon.c
+      DEG2RAD            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      nutation_table_eval nutation_table.c
+      nutation_angles_ctx novas.c
+      ee_ct              novas.c
+      mean_obliq         novas.c
+      fabs               math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'e_tilt' V2.5.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   e_tilt_saved *sv = &ctx->e_tilt;
+
+   short int acc_diff;
+
+   double t, d_psi, d_eps, mean_ob, true_ob, eq_eq;
+
+/*
+   Compute time in Julian centuries from epoch J2000.0.
+*/
+
+   t = (jd_tdb - T0) / 36525.0;
+
+/*
+   Check for difference in accuracy mode from last call.
+*/
+
+   acc_diff = accuracy - sv->accuracy_last;
+
+/*
+   Compute the nutation angles (arcseconds) if the input Julian date
+   is significantly different from the last Julian date, or the
+   accuracy mode, the nutation source or the tolerance has changed from
+   the last call.
+*/
+
+   if (((fabs (jd_tdb - sv->jd_last)) > 1.0e-8) || (acc_diff != 0) ||
+      (NUT_SOURCE != sv->source_last) ||
+      (NUT_TOLERANCE != sv->tolerance_last))
+   {
+
+/*
+   Interpolate the table made with 'nutation_table_make' or read with
+   'nutation_table_load', if it covers the date.
+*/
+
+      sv->tabulated = (nutation_table_eval (jd_tdb,accuracy, &sv->dp,
+         &sv->de,&sv->mean_tab,&sv->c_terms) == 0);
+
+      if (!sv->tabulated)
+      {
+         nutation_angles_ctx (ctx,t,accuracy, &sv->dp,&sv->de);
+
+/*
+   Obtain complementary terms for equation of the equinoxes in
+   arcseconds.
+*/
+
+         sv->c_terms = ee_ct (jd_tdb,0.0,accuracy) / ASEC2RAD;
+      }
+
+/*
+   Reset the values of the last Julian date and last mode.
+*/
+
+      sv->jd_last = jd_tdb;
+      sv->accuracy_last = accuracy;
+      sv->source_last = NUT_SOURCE;
+      sv->tolerance_last = NUT_TOLERANCE;
+   }
+
+/*
+   Apply observed celestial pole offsets.
+*/
+
+   d_psi = sv->dp + ctx->psi_cor;
+   d_eps = sv->de + ctx->eps_cor;
+
+/*
+   Compute mean obliquity of the ecliptic in arcseconds.
+*/
+
+   if (sv->tabulated)
+      mean_ob = sv->mean_tab;
+    else
+      mean_ob = mean_obliq (jd_tdb);
+
+/*
+   Compute true obliquity of the ecliptic in arcseconds.
+*/
+
+   true_ob = mean_ob + d_eps;
+
+/*
+   Convert obliquity values to degrees.
+*/
+
+   mean_ob /= 3600.0;
+   true_ob /= 3600.0;
+
+/*
+   Compute equation of the equinoxes in seconds of time.
+*/
+
+   eq_eq = d_psi * cos (mean_ob * DEG2RAD) + sv->c_terms;
+   eq_eq /= 15.0;
+
+/*
+   Set output values.
+*/
+
+   *dpsi = d_psi;
+   *deps = d_eps;
+   *ee   = eq_eq;
+   *mobl = mean_ob;
+   *tobl = true_ob;
+
+   return;
+}
+
+/********cel_pole */
+
+short int cel_pole (double tjd, short int type, double dpole1,
+                    double dpole2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function allows for the specification of celestial pole
+      offsets for high-precision applications.  Each set of offsets is
+      a correction to the modeled position of the pole for a specific
+      date, derived from observations and published by the IERS.
+
+   REFERENCES:
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      Kaplan, G. (2003), USNO/AA Technical Note 2003-03.
+
+   INPUT
+   ARGUMENTS:
+      tjd (double)
+         TDB or TT Julian date for pole offsets.
+      type (short int)
+         Type of pole offset
+            = 1 for corrections to angular coordinates of modeled pole
+                referred to mean ecliptic of date, that is,
+                delta-delta-psi and delta-delta-epsilon.
+            = 2 for corrections to components of modeled pole unit
+                vector referred to GCRS axes, that is, dx and dy.
+      dpole1 (double)
+         Value of celestial pole offset in first coordinate,
+         (delta-delta-psi or dx) in milliarcseconds.
+      dpole2 (double)
+         Value of celestial pole offset in second coordinate,
+         (delta-delta-epsilon or dy) in milliarcseconds.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'type'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      cel_pole_ctx       novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/12-04/JAB (USNO/AA)
+      V1.1/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function sets the celestial pole offsets of the default
+      'novas_context' ('cel_pole_ctx' sets those of its context).
+      These offsets are used only in NOVAS function 'e_tilt'.
+      2. This function, if used, should be called before any other
+      NOVAS functions for a given date.  Values of the pole offsets
+      specified via a call to this function will be used until
+      explicitly changed.
+      3. 'tjd' is used only for 'type' = 2, to transform dx and dy to
+      the equivalent delta-delta-psi and delta-delta-epsilon values.
+      4. For 'type' = 2, dx and dy are unit vector component
+      corrections, but are expressed in milliarcseconds simply by
+      multiplying by 206264806, the number of milliarcseconds in one
+      radian.
+      5. This function is the C version of NOVAS Fortran routine
+      'celpol'.
+
+------------------------------------------------------------------------
+*/
+{
+   return cel_pole_ctx (default_context (), tjd,type,dpole1,dpole2);
+}
+
+/********cel_pole_ctx */
+
+short int cel_pole_ctx (novas_context *ctx, double tjd, short int type,
+                        double dpole1, double dpole2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'cel_pole' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'cel_pole'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cel_pole'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'cel_pole'.
+
+   RETURNED
+   VALUE:
+      See function 'cel_pole'.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      frame_tie_ctx      novas.c
+      precession_ctx     novas.c
+      mean_obliq         novas.c
+      sin                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'cel_pole' V1.0.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   double dx, dy, t, mean_ob, sin_e, x, dz, dp1[3], dp2[3], dp3[3];
+
+   switch (type)
+   {
+      case (1):
+
+/*
+   Angular coordinates of modeled pole referred to mean ecliptic of
+   date, that is,delta-delta-psi and delta-delta-epsilon.
+*/
+
+          ctx->psi_cor = dpole1 * 1.0e-3;
+          ctx->eps_cor = dpole2 * 1.0e-3;
+          break;
+
+      case (2):
+
+/*
+   Components of modeled pole unit vector referred to GCRS axes, that
+   is, dx and dy.
+*/
+
+          dx = dpole1;
+          dy = dpole2;
+
+          t = (tjd - T0) / 36525.0;
+
+/*
+   Compute sin_e of mean obliquity of date.
+*/
+
+          mean_ob = mean_obliq (tjd);
+          sin_e = sin (mean_ob * ASEC2RAD);
+
+/*
+   The following algorithm, to transform dx and dy to
+   delta-delta-psi and delta-delta-epsilon, is from eqs. (7)-(9) of the
+   second reference.
+
+   Trivial model of pole trajectory in GCRS allows computation of dz.
+*/
+
+          x = (2004.190 * t) * ASEC2RAD;
+          dz = - (x + 0.5 * x * x * x) * dx;
+
+/*
+   Form pole offset vector (observed - modeled) in GCRS.
+*/
+
+          dp1[0] = dx * 1.0e-3 * ASEC2RAD;
+          dp1[1] = dy * 1.0e-3 * ASEC2RAD;
+          dp1[2] = dz * 1.0e-3 * ASEC2RAD;
+
+/*
+   Precess pole offset vector to mean equator and equinox of date.
+*/
+
+          frame_tie_ctx (ctx,dp1,1, dp2);
+          precession_ctx (ctx,T0,dp2,tjd, dp3);
+
+/*
+   Compute delta-delta-psi and delta-delta-epsilon in arcseconds.
+*/
+
+          ctx->psi_cor = (dp3[0] / sin_e) / ASEC2RAD;
+          ctx->eps_cor = dp3[1] / ASEC2RAD;
+          break;
+
+      default:
+
+/*
+   Invalid value of 'type'.
+*/
+         error = 1;
+         break;
+   }
+
+   return (error);
+}
+
+/********set_nutation_source */
+
+short int set_nutation_source (short int source)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function selects where the nutation angles come from: the
+      IAU 2000 series (the default) or the nutation series stored in
+      the JPL planetary ephemeris file opened by 'ephem_open'.
+
+   REFERENCES:
+      Standish, E.M. and Newhall, X X (1988). "The JPL Export
+         Planetary Ephemeris"; JPL document dated 17 June 1988.
+
+   INPUT
+   ARGUMENTS:
+      source (short int)
+         Source of the nutation angles.
+            = NUTATION_SERIES    ... IAU 2000A or NU2000K, according to
+                                     'accuracy' (see 'nutation_angles')
+            = NUTATION_EPHEMERIS ... Chebyshev series of the ephemeris
+                                     file
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'source'.
+
+   GLOBALS
+   USED:
+      NUT_SOURCE         novas.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. This function sets global variable 'NUT_SOURCE' declared at
+      the top of file 'novas.c', used only in NOVAS function
+      'nutation_angles'.
+      2. With NUTATION_EPHEMERIS, a nutation costs about one planet
+      lookup.  Epochs outside the file span, files without nutations
+      and a closed file fall back to the series.  The DE4xx files carry
+      the IAU 1980 nutation model, which differs from IAU 2000A by up
+      to a few tens of milliarcseconds; use 'cel_pole' offsets or the
+      default source where this matters.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((source != NUTATION_SERIES) && (source != NUTATION_EPHEMERIS))
+      return 1;
+
+   NUT_SOURCE = source;
+
+   return 0;
+}
+
+/********set_nutation_tolerance */
+
+short int set_nutation_tolerance (double tolerance)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function makes 'nutation_angles' truncate the IAU 2000A
+      series to a given accuracy, instead of choosing between IAU 2000A
+      and NU2000K according to 'accuracy'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      tolerance (double)
+         Largest error allowed in nutation in longitude and in
+         obliquity with respect to the full IAU 2000A series, in
+         microarcseconds; 0 restores the default models.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'tolerance'.
+
+   GLOBALS
+   USED:
+      NUT_TOLERANCE      novas.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. This function sets global variable 'NUT_TOLERANCE' declared at
+      the top of file 'novas.c', used only in NOVAS function
+      'nutation_angles'.
+      2. The terms are evaluated in decreasing order of amplitude until
+      the rest of the series is bounded by the tolerance (see
+      'iau2000a_trunc'): about 85 terms for 10000 microarcseconds and
+      440 for 1000.  The tolerance applies to both values of
+      'accuracy'.
+
+------------------------------------------------------------------------
+*/
+{
+   if (tolerance < 0.0)
+      return 1;
+
+   NUT_TOLERANCE = tolerance;
+
+   return 0;
+}
+
+/********get_nutation_source */
+
+short int get_nutation_source (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the source of the nutation angles selected
+      with 'set_nutation_source'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         NUTATION_SERIES or NUTATION_EPHEMERIS.
+
+   GLOBALS
+   USED:
+      NUT_SOURCE         novas.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   return NUT_SOURCE;
+}
+
+/********get_nutation_tolerance */
+
+double get_nutation_tolerance (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the truncation tolerance of the IAU 2000A
+      series set with 'set_nutation_tolerance'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (double)
+         Tolerance in microarcseconds; 0 for the default models.
+
+   GLOBALS
+   USED:
+      NUT_TOLERANCE      novas.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   return NUT_TOLERANCE;
+}
+
+/********ee_ct */
+
+double ee_ct (double jd_high, double jd_low, short int accuracy)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the "complementary terms" of the equation of the
+      equinoxes.
+
+   REFERENCES:
+      Capitaine, N., Wallace, P.T., and McCarthy, D.D. (2003). Astron. &
+         Astrophys. 406, p. 1135-1149. Table 3.
+      IERS Conventions (2010), Chapter 5, p. 60, Table 5.2e.
+         (Table 5.2e presented in the printed publication is a truncated
+         series. The full series, which is used in NOVAS, is available
+         on the IERS Conventions Center website in file tab5.2e.txt.)
+         ftp://tai.bipm.org/iers/conv2010/chapter5/
+
+   INPUT
+   ARGUMENTS:
+      jd_high (double)
+         High-order part of TT Julian date.
+      jd_low (double)
+         Low-order part of TT Julian date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      None
+
+   RETURNED
+   VALUE:
+      (double)
+         Complementary terms, in radians.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+      TWOPI              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      norm_ang           novas.c
+      fund_args          novas.c
+      fmod               math.h
+      sin                math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-03/JAB (USNO/AA)
+      V1.1/12-04/JAB (USNO/AA) Added low-accuracy formula.
+      V1.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.3/11-10/JAB (USNO/AA) Updated reference and notes.
+      V1.4/03-11/WKP (USNO/AA) Added braces to 2-D array initialization
+                               to quiet gcc warnings.
+
+   NOTES:
+      1. The series used in this function was derived from the first
+      reference.  This same series was also adopted for use in the IAU's
+      Standards of Fundamental Astronomy (SOFA) software (i.e.,
+      subroutine eect00.for and function eect00.c).
+      2. The low-accuracy series used in this function is a simple
+      implementation derived from the first reference, in which terms
+      smaller than 2 microarcseconds have been omitted.
+      3. This function is based on NOVAS Fortran routine 'eect2000',
+      with the low-accuracy formula taken from NOVAS Fortran routine
+      'etilt'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, j;
+
+   double t, fa[14], fa2[5], s0, s1, a, c_terms;
+
+/*
+   Argument coefficients for t^0.
+*/
+
+   const short int ke0_t[33][14] = {
+      {0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  1,  2, -2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  1,  2, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  4, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  1, -1,  1,  0, -8, 12,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {0,  0,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {1,  0,  2,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+      {1,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
       {0,  0,  2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
       {0,  1, -2,  2, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0},
       {0,  1, -2,  2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
@@ -4587,238 +7499,2720 @@ double ee_ct (double jd_high, double jd_low, short int accuracy)
       {1,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0}};
 
 /*
-   Argument coefficients for t^1.
+   Argument coefficients for t^1.
+*/
+
+   const short int ke1[14] =
+      {0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0};
+
+/*
+   Sine and cosine coefficients for t^0.
+*/
+
+   const double se0_t[33][2] = {
+      {+2640.96e-6,          -0.39e-6},
+      {  +63.52e-6,          -0.02e-6},
+      {  +11.75e-6,          +0.01e-6},
+      {  +11.21e-6,          +0.01e-6},
+      {   -4.55e-6,          +0.00e-6},
+      {   +2.02e-6,          +0.00e-6},
+      {   +1.98e-6,          +0.00e-6},
+      {   -1.72e-6,          +0.00e-6},
+      {   -1.41e-6,          -0.01e-6},
+      {   -1.26e-6,          -0.01e-6},
+      {   -0.63e-6,          +0.00e-6},
+      {   -0.63e-6,          +0.00e-6},
+      {   +0.46e-6,          +0.00e-6},
+      {   +0.45e-6,          +0.00e-6},
+      {   +0.36e-6,          +0.00e-6},
+      {   -0.24e-6,          -0.12e-6},
+      {   +0.32e-6,          +0.00e-6},
+      {   +0.28e-6,          +0.00e-6},
+      {   +0.27e-6,          +0.00e-6},
+      {   +0.26e-6,          +0.00e-6},
+      {   -0.21e-6,          +0.00e-6},
+      {   +0.19e-6,          +0.00e-6},
+      {   +0.18e-6,          +0.00e-6},
+      {   -0.10e-6,          +0.05e-6},
+      {   +0.15e-6,          +0.00e-6},
+      {   -0.14e-6,          +0.00e-6},
+      {   +0.14e-6,          +0.00e-6},
+      {   -0.14e-6,          +0.00e-6},
+      {   +0.14e-6,          +0.00e-6},
+      {   +0.13e-6,          +0.00e-6},
+      {   -0.11e-6,          +0.00e-6},
+      {   +0.11e-6,          +0.00e-6},
+      {   +0.11e-6,          +0.00e-6}};
+/*
+   Sine and cosine coefficients for t^1.
+*/
+
+   const double se1[2] =
+      {   -0.87e-6,          +0.00e-6};
+
+/*
+   Interval between fundamental epoch J2000.0 and current date.
+*/
+
+      t = ((jd_high - T0) + jd_low) / 36525.0;
+
+/*
+   High accuracy mode.
+*/
+
+   if (accuracy == 0)
+   {
+
+/*
+   Fundamental Arguments.
+
+   Mean Anomaly of the Moon.
+*/
+
+      fa[0] = norm_ang ((485868.249036 +
+                         (715923.2178 +
+                         (    31.8792 +
+                         (     0.051635 +
+                         (    -0.00024470)
+                         * t) * t) * t) * t) * ASEC2RAD
+                         + fmod (1325.0*t, 1.0) * TWOPI);
+
+/*
+   Mean Anomaly of the Sun.
+*/
+
+      fa[1] = norm_ang ((1287104.793048 +
+                         (1292581.0481 +
+                         (     -0.5532 +
+                         (     +0.000136 +
+                         (     -0.00001149)
+                         * t) * t) * t) * t) * ASEC2RAD
+                         + fmod (99.0*t, 1.0) * TWOPI);
+
+/*
+   Mean Longitude of the Moon minus Mean Longitude of the Ascending
+   Node of the Moon.
+*/
+
+      fa[2] = norm_ang (( 335779.526232 +
+                         ( 295262.8478 +
+                         (    -12.7512 +
+                         (     -0.001037 +
+                         (      0.00000417)
+                         * t) * t) * t) * t) * ASEC2RAD
+                         + fmod (1342.0*t, 1.0) * TWOPI);
+
+/*
+   Mean Elongation of the Moon from the Sun.
+*/
+
+      fa[3] = norm_ang ((1072260.703692 +
+                         (1105601.2090 +
+                         (     -6.3706 +
+                         (      0.006593 +
+                         (     -0.00003169)
+                         * t) * t) * t) * t) * ASEC2RAD
+                         + fmod (1236.0*t, 1.0) * TWOPI);
+
+/*
+   Mean Longitude of the Ascending Node of the Moon.
+*/
+
+      fa[4] = norm_ang (( 450160.398036 +
+                         (-482890.5431 +
+                         (      7.4722 +
+                         (      0.007702 +
+                         (     -0.00005939)
+                         * t) * t) * t) * t) * ASEC2RAD
+                         + fmod (-5.0*t, 1.0) * TWOPI);
+
+      fa[ 5] = norm_ang (4.402608842 + 2608.7903141574 * t);
+      fa[ 6] = norm_ang (3.176146697 + 1021.3285546211 * t);
+      fa[ 7] = norm_ang (1.753470314 +  628.3075849991 * t);
+      fa[ 8] = norm_ang (6.203480913 +  334.0612426700 * t);
+      fa[ 9] = norm_ang (0.599546497 +   52.9690962641 * t);
+      fa[10] = norm_ang (0.874016757 +   21.3299104960 * t);
+      fa[11] = norm_ang (5.481293872 +    7.4781598567 * t);
+      fa[12] = norm_ang (5.311886287 +    3.8133035638 * t);
+      fa[13] =          (0.024381750 +    0.00000538691 * t) * t;
+
+/*
+   Evaluate the complementary terms.
+*/
+
+      s0 = 0.0;
+      s1 = 0.0;
+
+      for (i = 32; i >= 0; i--)
+      {
+         a = 0.0;
+
+         for (j = 0; j < 14; j++)
+         {
+            a += (double) ke0_t[i][j] * fa[j];
+         }
+
+         s0 += (se0_t[i][0] * sin (a) + se0_t[i][1] * cos (a));
+      }
+
+      a = 0.0;
+
+      for (j = 0; j < 14; j++)
+      {
+         a += (double) (ke1[j]) * fa[j];
+      }
+
+      s1 += (se1[0] * sin (a) + se1[1] * cos (a));
+
+      c_terms = (s0 + s1 * t);
+   }
+
+    else
+
+/*
+   Low accuracy mode: Terms smaller than 2 microarcseconds omitted.
+*/
+
+   {
+      fund_args (t, fa2);
+      c_terms =
+          2640.96e-6 * sin (fa2[4])
+         +  63.52e-6 * sin (2.0 * fa2[4])
+         +  11.75e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] + 3.0 * fa2[4])
+         +  11.21e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] +       fa2[4])
+         -   4.55e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] + 2.0 * fa2[4])
+         +   2.02e-6 * sin (2.0 * fa2[2]                + 3.0 * fa2[4])
+         +   1.98e-6 * sin (2.0 * fa2[2]                +       fa2[4])
+         -   1.72e-6 * sin (3.0 * fa2[4])
+         -   0.87e-6 * t * sin (fa2[4]);
+   }
+
+   return (c_terms *= ASEC2RAD);
+}
+
+/********frame_tie */
+
+void frame_tie (double *pos1, short int direction,
+
+                double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To transform a vector from the dynamical reference system to the
+      International Celestial Reference System (ICRS), or vice versa.
+      The dynamical reference system is based on the dynamical mean
+      equator and equinox of J2000.0.  The ICRS is based on the space-
+      fixed ICRS axes defined by the radio catalog positions of several
+      hundred extragalactic objects.
+
+   REFERENCES:
+      Hilton, J. and Hohenkerk, C. (2004), Astronomy and Astrophysics
+         413, 765-770, eq. (6) and (8).
+      IERS (2003) Conventions, Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      pos1[3] (double)
+         Position vector, equatorial rectangular coordinates.
+      direction (short int)
+         Set 'direction' < 0 for dynamical to ICRS transformation.
+         Set 'direction' >= 0 for ICRS to dynamical transformation.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, equatorial rectangular coordinates.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      frame_tie_ctx      novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-03/JAB (USNO/AA)
+      V1.1/02-06/WKP (USNO/AA) Added second-order corrections to diagonal
+                               elements.
+      V1.2/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. For geocentric coordinates, the same transformation is used
+      between the dynamical reference system and the GCRS.
+      2. This function is the C version of NOVAS Fortran routine 'frame'.
+
+------------------------------------------------------------------------
+*/
+{
+   frame_tie_ctx (default_context (), pos1,direction, pos2);
+   return;
+}
+
+/********frame_tie_ctx */
+
+void frame_tie_ctx (novas_context *ctx, double *pos1,
+                    short int direction,
+
+                    double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'frame_tie' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'frame_tie'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'frame_tie'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'frame_tie'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      ASEC2RAD           novascon.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'frame_tie' V1.1.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   frame_tie_saved *sv = &ctx->frame_tie;
+
+/*
+   'xi0', 'eta0', and 'da0' are ICRS frame biases in arcseconds taken
+   from IERS (2003) Conventions, Chapter 5.
+*/
+
+   const double xi0  = -0.0166170;
+   const double eta0 = -0.0068192;
+   const double da0  = -0.01460;
+
+/*
+   Compute elements of rotation matrix to first order the first time
+   this function is called.  Elements will be saved for future use and
+   not recomputed.
+*/
+
+   if (sv->compute_matrix == 1)
+   {
+      sv->xx =  1.0;
+      sv->yx = -da0  * ASEC2RAD;
+      sv->zx =  xi0  * ASEC2RAD;
+      sv->xy =  da0  * ASEC2RAD;
+      sv->yy =  1.0;
+      sv->zy =  eta0 * ASEC2RAD;
+      sv->xz = -xi0  * ASEC2RAD;
+      sv->yz = -eta0 * ASEC2RAD;
+      sv->zz =  1.0;
+
+/*
+   Include second-order corrections to diagonal elements.
+*/
+
+      sv->xx = 1.0 - 0.5 * (sv->yx * sv->yx + sv->zx * sv->zx);
+      sv->yy = 1.0 - 0.5 * (sv->yx * sv->yx + sv->zy * sv->zy);
+      sv->zz = 1.0 - 0.5 * (sv->zy * sv->zy + sv->zx * sv->zx);
+
+      sv->compute_matrix = 0;
+   }
+
+/*
+   Perform the rotation in the sense specified by 'direction'.
+*/
+
+   if (direction < 0)
+   {
+
+/*
+   Perform rotation from dynamical system to ICRS.
+*/
+
+      pos2[0] = sv->xx * pos1[0] + sv->yx * pos1[1] + sv->zx * pos1[2];
+      pos2[1] = sv->xy * pos1[0] + sv->yy * pos1[1] + sv->zy * pos1[2];
+      pos2[2] = sv->xz * pos1[0] + sv->yz * pos1[1] + sv->zz * pos1[2];
+   }
+    else
+   {
+
+/*
+   Perform rotation from ICRS to dynamical system.
+*/
+
+      pos2[0] = sv->xx * pos1[0] + sv->xy * pos1[1] + sv->xz * pos1[2];
+      pos2[1] = sv->yx * pos1[0] + sv->yy * pos1[1] + sv->yz * pos1[2];
+      pos2[2] = sv->zx * pos1[0] + sv->zy * pos1[1] + sv->zz * pos1[2];
+   }
+
+   return;
+}
+
+/********proper_motion */
+
+void proper_motion (double jd_tdb1, double *pos, double *vel,
+                    double jd_tdb2,
+
+                    double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Applies proper motion, including foreshortening effects, to a
+      star's position.
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb1 (double)
+         TDB Julian date of first epoch.
+      pos[3] (double)
+         Position vector at first epoch.
+      vel[3] (double)
+         Velocity vector at first epoch.
+      jd_tdb2 (double)
+         TDB Julian date of second epoch.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector at second epoch.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Updated to C programming standards.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'propmo'.
+
+------------------------------------------------------------------------
+*/
+{
+    short int j;
+
+    for (j = 0; j < 3; j++)
+    {
+       pos2[j] = pos[j] + (vel[j] * (jd_tdb2 - jd_tdb1));
+    }
+
+    return;
+}
+
+/********bary2obs */
+
+void bary2obs (double *pos, double *pos_obs,
+
+               double *pos2, double *lighttime)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function moves the origin of coordinates from the barycenter
+      of the solar system to the observer (or the geocenter); i.e.,
+      this function accounts for parallax (annual+geocentric or just
+      annual).
+
+   REFERENCES:
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+
+   INPUT
+   ARGUMENTS:
+      pos1[3] (double)
+         Position vector, referred to origin at solar system barycenter,
+         components in AU.
+      pos_obs[3] (double)
+         Position vector of observer (or the geocenter), with respect
+         to origin at solar system barycenter, components in AU.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, referred to origin at center of mass of the
+         Earth, components in AU.
+      *lighttime (double)
+         Light time from object to Earth in days.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      C_AUDAY            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/10-03/JAB (USNO/AA) Remove calls to 'pow'.
+      V2.0/01-05/JAB (USNO/AA) Update documentation; change
+                               'earthvector' to 'pos_obs'.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'geocen'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int j;
+
+/*
+   Translate vector to geocentric coordinates.
+*/
+
+   for (j = 0; j < 3; j++)
+   {
+      pos2[j] = pos[j] - pos_obs[j];
+   }
+
+/*
+   Calculate length of vector in terms of light time.
+*/
+
+   *lighttime = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1] +
+       pos2[2] * pos2[2]) / C_AUDAY;
+
+   return;
+}
+
+/********geo_posvel */
+
+short int geo_posvel (double jd_tt, double delta_t, short int accuracy,
+                      observer *obs,
+
+                      double *pos, double *vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the geocentric position and velocity
+      of an observer on the surface of the earth or on a near-earth
+      spacecraft.  The final vectors are expressed in the GCRS.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date.
+      delta_t (double)
+         Value of Delta T (= TT - UT1) at 'jd_tt'.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      *obs (struct observer)
+         Data specifying the location of the observer (struct defined
+         in novas.h).
+
+   OUTPUT
+   ARGUMENTS:
+      *pos (double)
+         Position vector of observer, with respect to origin at
+         geocenter, referred to GCRS axes, components in AU.
+      *vel (double)
+         Velocity vector of observer, with respect to origin at
+         geocenter, referred to GCRS axes, components in AU/day.
+
+   RETURNED
+   VALUE:
+      (short int)
+         = 0 ... everything OK.
+         = 1 ... invalid value of 'accuracy'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      geo_posvel_ctx     novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/12-04/JAB (USNO/AA)
+      V2.2/12-05/WKP (USNO/AA) Updated error handling.
+      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V2.4/02-06/WKP (USNO/AA) Changed time argument in sidereal_time
+                               call from 'jd_tt' to 'jd_ut1'.
+      V2.5/04-06/WKP (USNO/AA) Corrected calculation of 'fac' and
+                               changed it to a static.
+      V2.6/10-06/JAB (USNO/AA) Remove 'jd_tdb' input argument; TDB
+                               is approximated by TT.
+      V2.7/02-07/JAB (USNO/AA) Compute 'jd_tdb' corresponding to input
+                               'jd_tt'.
+      V2.8/10-26/ROA           Use the default 'novas_context'.
+
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'geopos'.  This C function differs from its Fortran counterpart
+      in that it does not use the input TT time as a substitute for
+      the TDB time.
+
+------------------------------------------------------------------------
+*/
+{
+   return geo_posvel_ctx (default_context (),
+      jd_tt,delta_t,accuracy,obs, pos,vel);
+}
+
+/********geo_posvel_ctx */
+
+short int geo_posvel_ctx (novas_context *ctx, double jd_tt,
+                          double delta_t, short int accuracy,
+                          observer *obs,
+
+                          double *pos, double *vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'geo_posvel' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'geo_posvel'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'geo_posvel'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'geo_posvel'.
+
+   RETURNED
+   VALUE:
+      See function 'geo_posvel'.
+
+   GLOBALS
+   USED:
+      AU_KM, T0          novascon.c
+
+   FUNCTIONS
+   CALLED:
+      tdb2tt             novas.c
+      sidereal_time_ctx  novas.c
+      e_tilt_ctx         novas.c
+      terra              novas.c
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+      fabs               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'geo_posvel' V2.7.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   geo_posvel_saved *sv = &ctx->geo_posvel;
+
+   double x, secdif, gmst, x1, x2, x3, x4, eqeq, pos1[3], vel1[3],
+      pos2[3], vel2[3], pos3[3], vel3[3], jd_tdb, jd_ut1;
+   short int error = 0;
+
+/*
+   Invalid value of 'accuracy'.
+*/
+
+   if ((accuracy < 0) || (accuracy > 1))
+      return (error = 1);
+
+/*
+   Compute 'jd_tdb', the TDB Julian date corresponding to 'jd_tt'.
+*/
+
+   jd_tdb = jd_tt;
+   tdb2tt (jd_tdb, &x,&secdif);
+   jd_tdb = jd_tt + secdif / 86400.0;
+
+   switch (obs->where)
+   {
+
+/*
+   Observer at geocenter.  Trivial case.
+*/
+
+      case (0):
+         pos[0] = 0.0;
+         pos[1] = 0.0;
+         pos[2] = 0.0;
+         vel[0] = 0.0;
+         vel[1] = 0.0;
+         vel[2] = 0.0;
+         return (error = 0);
+
+/*
+   Other two cases: Get geocentric position and velocity vectors of
+   observer wrt equator and equinox of date.
+
+   Observer on surface of Earth.
+*/
+
+      case (1):
+
+/*
+   Compute UT1 and sidereal time.
+*/
+
+         jd_ut1 = jd_tt - (delta_t / 86400.0);
+         if (fabs (jd_ut1 - sv->t_last) > 1.0e-8 )
+         {
+            sidereal_time_ctx (ctx,jd_ut1,0.0,delta_t,0,1,accuracy,
+               &gmst);
+            e_tilt_ctx (ctx,jd_tdb,accuracy, &x1,&x2,&eqeq,&x3,&x4);
+            sv->gast = gmst + eqeq / 3600.0;
+            sv->t_last = jd_ut1;
+         }
+
+/*
+   Function 'terra' does the hard work, given sidereal time.
+*/
+
+         terra (&obs->on_surf,sv->gast, pos1,vel1);
+         break;
+
+/*
+   Observer on near-earth spacecraft.
+*/
+
+      case (2):
+
+/*
+   Convert units to AU and AU/day.
+*/
+
+         if (sv->first_time)
+         {
+            sv->fac = AU_KM / 86400.0;
+            sv->first_time = 0;
+         }
+
+         pos1[0] = obs->near_earth.sc_pos[0] / AU_KM;
+         pos1[1] = obs->near_earth.sc_pos[1] / AU_KM;
+         pos1[2] = obs->near_earth.sc_pos[2] / AU_KM;
+
+         vel1[0] = obs->near_earth.sc_vel[0] / sv->fac;
+         vel1[1] = obs->near_earth.sc_vel[1] / sv->fac;
+         vel1[2] = obs->near_earth.sc_vel[2] / sv->fac;
+         break;
+   }
+
+/*
+   Transform geocentric position vector of observer to GCRS.
+*/
+
+   nutation_ctx (ctx,jd_tdb,-1,accuracy,pos1, pos2);
+   precession_ctx (ctx,jd_tdb,pos2,T0, pos3);
+   frame_tie_ctx (ctx,pos3,-1, pos);
+
+/*
+   Transform geocentric velocity vector of observer to GCRS.
+*/
+
+   nutation_ctx (ctx,jd_tdb,-1,accuracy,vel1, vel2);
+   precession_ctx (ctx,jd_tdb,vel2,T0, vel3);
+   frame_tie_ctx (ctx,vel3,-1, vel);
+
+   return (error = 0);
+}
+
+/********light_time */
+
+short int light_time (double jd_tdb, object *ss_object, double pos_obs[3],
+                      double tlight0, short int accuracy,
+
+                      double pos[3], double *tlight)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the geocentric position of a solar system
+      body, as antedated for light-time.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date of observation.
+      *ss_object (struct object)
+         Pointer to structure containing the designation for the
+         solar system body (defined in novas.h).
+      pos_obs[3] (double)
+         Position vector of observer (or the geocenter), with respect to
+         origin at solar system barycenter, referred to ICRS axes,
+         components in AU.
+      tlight0 (double)
+         First approximation to light-time, in days (can be set to 0.0
+         if unknown).
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      pos[3] (double)
+         Position vector of body, with respect to origin at observer (or
+         the geocenter), referred to ICRS axes, components in AU.
+      tlight (double)
+         Final light-time, in days.
+
+   RETURNED
+   VALUE:
+      (short int)
+         =  0 ... everything OK.
+         =  1 ... algorithm failed to converge after 10 iterations.
+         > 10 ... error is 10 + error from function 'solarsystem'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context  novas.c
+      light_time_ctx   novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-04/JAB (USNO/AA)
+      V1.1/06-05/JAB (USNO/AA): Changed the convergence tolerance from
+                                1.0e-8 to 1.0e-10
+      V1.2/04-06/JAB (USNO/AA): Changed the convergence tolerance from
+                                1.0e-10 to 1.0e-9
+      V2.0/12-06/JAB (USNO/AA): Support use of split Julian date to
+                                improve accuracy when the full accuracy
+                                option is selected.
+      V2.1/11-07/JAB (USNO/AA): Changed high-accuracy convergence
+                                tolerance from 1.0e-11 to 1.0e-12.
+      V2.2/10-08/JAB (USNO/AA): Use function 'ephemeris' instead of
+                                direct calls to the solar system
+                                functions.
+      V2.3/09-10/WKP (USNO/AA): Initialized 't3' variable to silence
+                                compiler warning.
+      V2.4/10-26/ROA:           Ask 'ephemeris' for the position only.
+      V2.5/10-26/ROA:           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'littim'.
+
+------------------------------------------------------------------------
+*/
+{
+   return light_time_ctx (default_context (),
+      jd_tdb,ss_object,pos_obs,tlight0,accuracy, pos,tlight);
+}
+
+/********light_time_ctx */
+
+short int light_time_ctx (novas_context *ctx, double jd_tdb,
+                          object *ss_object, double pos_obs[3],
+                          double tlight0, short int accuracy,
+
+                          double pos[3], double *tlight)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'light_time' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'light_time'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'light_time'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'light_time'.
+
+   RETURNED
+   VALUE:
+      See function 'light_time'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      ephemeris_ctx    novas.c
+      bary2obs         novas.c
+      fabs             math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'light_time' V2.4.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+   short int iter = 0;
+
+   double tol, jd[2], t1, t2, t3 = 0.0, pos1[3];
+
+/*
+   Set light-time convergence tolerance.  If full-accuracy option has
+   been selected, split the Julian date into whole days + fraction of
+   day.
+*/
+
+   if (accuracy == 0)
+   {
+      tol = 1.0e-12;
+
+      jd[0] = (double) ((long int) jd_tdb);
+      t1 = jd_tdb - jd[0];
+      t2 = t1 - tlight0;
+   }
+    else
+   {
+      tol = 1.0e-9;
+
+      jd[0] = 0.0;
+      jd[1] = 0.0;
+      t1 = jd_tdb;
+      t2 = jd_tdb - tlight0;
+   }
+
+/*
+   Iterate to obtain correct light-time (usually converges rapidly).
+*/
+
+   do
+   {
+      if (iter > 10)
+      {
+         error = 1;
+         *tlight = 0.0;
+         break;
+      }
+
+      if (iter > 0)
+      {
+         t2 = t3;
+      }
+
+      jd[1] = t2;
+      error = ephemeris_ctx (ctx,jd,ss_object,0,accuracy, pos1, NULL);
+
+      if (error != 0)
+      {
+         error += 10;
+         *tlight = 0.0;
+         break;
+      }
+
+      bary2obs (pos1,pos_obs, pos,tlight);
+
+      t3 = t1 - *tlight;
+      iter++;
+   } while (fabs (t3 - t2) > tol);
+
+   return (error);
+}
+
+/********d_light */
+
+double d_light (double *pos1, double *pos_obs)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the difference in light-time, for a star,
+      between the barycenter of the solar system and the observer (or
+      the geocenter).
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      pos1[3] (double)
+         Position vector of star, with respect to origin at solar
+         system barycenter.
+      pos_obs[3] (double)
+         Position vector of observer (or the geocenter), with respect
+         to origin at solar system barycenter, components in AU.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (double)
+         Difference in light time, in the sense star to barycenter minus
+         star to earth, in days.
+
+   GLOBALS
+   USED:
+      C_AUDAY            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/12-04/JAB (USNO/AA)
+
+   NOTES:
+      1.  Alternatively, this function returns the light-time from the
+      observer (or the geocenter) to a point on a light ray that is
+      closest to a specific solar system body.  For this purpose, 'pos1'
+      is the position vector toward observed object, with respect to
+      origin at observer (or the geocenter); 'pos_obs' is the position
+      vector of solar system body, with respect to origin at observer
+      (or the geocenter), components in AU; and the returned value is
+      the light time to point on line defined by 'pos1' that is closest
+      to solar system body (positive if light passes body before hitting
+      observer, i.e., if 'pos1' is within 90 degrees of 'pos_obs').
+      2. This function is the C version of NOVAS Fortran routine
+      'dlight'.
+
+------------------------------------------------------------------------
+*/
+{
+   double dis, u1[3], diflt;
+
+/*
+   From 'pos1', form unit vector 'u1' in direction of star or light
+   source.
+*/
+
+   dis = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
+      pos1[2] * pos1[2]);
+
+   u1[0] = pos1[0] / dis;
+   u1[1] = pos1[1] / dis;
+   u1[2] = pos1[2] / dis;
+
+/*
+   Light-time returned is the projection of vector 'pos_obs' onto the
+   unit vector 'u1' (formed from 'pos1'), divided by the speed of light.
+*/
+
+   diflt = (pos_obs[0] * u1[0] + pos_obs[1] * u1[1] +
+      pos_obs[2] * u1[2]) / C_AUDAY;
+
+   return (diflt);
+}
+
+/********grav_def */
+
+short int grav_def (double jd_tdb, short int loc_code,
+                    short int accuracy, double *pos1, double *pos_obs,
+
+                    double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the total gravitational deflection of
+      light for the observed object due to the major gravitating bodies
+      in the solar system.  This function valid for an observed body
+      within the solar system as well as for a star.
+
+   REFERENCES:
+      Klioner, S. (2003), Astronomical Journal 125, 1580-1597,
+         Section 6.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date of observation.
+      loc_code (short int)
+         Code for location of observer, determining whether the
+         gravitational deflection due to the earth itself is applied.
+            = 0 ... No earth deflection (normally means observer
+                          is at geocenter)
+            = 1 ... Add in earth deflection (normally means
+         observer is on or above surface of earth, including earth
+         orbit)
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      *pos1 (double)
+         Position vector of observed object, with respect to origin at
+         observer (or the geocenter), referred to ICRS axes, components
+         in AU.
+      *pos_obs (double)
+         Position vector of observer (or the geocenter), with respect to
+         origin at solar system barycenter, referred to ICRS axes,
+         components in AU.
+
+   OUTPUT
+   ARGUMENTS:
+      *pos2 (double)
+         Position vector of observed object, with respect to origin at
+         observer (or the geocenter), referred to ICRS axes, corrected
+         for gravitational deflection, components in AU.
+
+   RETURNED
+   VALUE:
+      (short int)
+         =  0 ... Everything OK.
+         < 30 ... Error from function 'ephemeris'.
+         > 30 ... Error from function 'make_object'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      grav_def_ctx       novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-05/JAB (USNO/AA)
+      V1.1/04-06/WKP (USNO/AA): Added second note (superceded).
+      V1.2/10-08/JAB (USNO/AA): Substituted calls to 'ephemeris' for
+                                calls to 'solarsystem'; added
+                                actions based on 'accuracy' input.
+      V1.3/10-26/ROA:           Ask 'ephemeris' for positions only.
+      V1.4/10-26/ROA:           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'grvdef'.
+      2. If 'accuracy' is set to zero (full accuracy), three bodies
+      (Sun, Jupiter, and Saturn) are used in the calculation.  If
+      the reduced-accuracy option is set, only the Sun is used in the
+      calculation.  In both cases, if the observer is not at the
+      geocenter, the deflection due to the Earth is included.
+      3. The number of bodies used at full and reduced accuracy can be
+      set by making a change to the code in this function as indicated
+      in the comments.
+
+------------------------------------------------------------------------
+*/
+{
+   return grav_def_ctx (default_context (),
+      jd_tdb,loc_code,accuracy,pos1,pos_obs, pos2);
+}
+
+/********grav_def_ctx */
+
+short int grav_def_ctx (novas_context *ctx, double jd_tdb,
+                        short int loc_code, short int accuracy,
+                        double *pos1, double *pos_obs,
+
+                        double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'grav_def' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'grav_def'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'grav_def'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'grav_def'.
+
+   RETURNED
+   VALUE:
+      See function 'grav_def'.
+
+   GLOBALS
+   USED:
+      C_AUDAY            novascon.c
+      RMASS[12]          novascon.c
+
+   FUNCTIONS
+   CALLED:
+      make_cat_entry     novas.c
+      make_object        novas.c
+      ephemeris_ctx      novas.c
+      bary2obs           novas.c
+      d_light            novas.c
+      grav_vec           novas.c
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'grav_def' V1.3.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+/*
+   The following list of body numbers and corresponding names identifies
+   which gravitating bodies (aside from the Earth) are potentially
+   used -- list is taken from Klioner's table 1, the order based on area
+   of sky affected (col 2).  Order is Sun, Jupiter, Saturn, Moon, Venus,
+   Uranus, Neptune.
+*/
+
+   char body_name[7][8] = {"Sun", "Jupiter", "Saturn", "Moon",
+      "Venus", "Uranus", "Neptune"};
+
+   const short int body_num[7] = {10, 5, 6, 11, 2, 7, 8};
+
+   grav_def_saved *sv = &ctx->grav_def;
+
+   short int error = 0;
+   short int nbodies, i;
+
+   double jd[2], tlt, pbody[3], pbodyo[3], x, dlt, tclose;
+
+   cat_entry dummy_star;
+
+   jd[1] = 0.0;
+
+/*
+   Initialize output vector of observed object to equal input vector.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      pos2[i] = pos1[i];
+   }
+
+/*
+   Set the number of bodies -- and hence the bodies used -- based on the
+   value of the 'accuracy' flag.
+
+   Change value of 'nbodies' to include or exclude gravitating bodies
+   ('nbodies' <= 0 means no deflection calculated, 'nbodies' = 1 means
+   Sun only, 'nbodies' = 2 means Sun + Jupiter, etc.)  Default is
+   'nbodies' = 3: Sun + Jupiter + Saturn.
+*/
+
+   if (accuracy == 0)
+   {
+      nbodies = 3;
+   }
+    else
+   {
+      nbodies = 1;
+   }
+
+/*
+   Set up the structures of type 'object' containing the body
+   information.
+*/
+
+   if ((sv->first_time == 1) || (nbodies != sv->nbodies_last))
+   {
+      for (i = 0; i < nbodies; i++)
+      {
+         if (i == 0)
+         {
+            make_cat_entry ("dummy","   ",0,0.0,0.0,0.0,0.0,0.0,0.0,
+               &dummy_star);
+
+            make_object (0,3,"Earth",&dummy_star, &sv->earth);
+         }
+
+         if ((error = make_object (0,body_num[i],body_name[i],
+            &dummy_star, &sv->body[i])) != 0)
+         {
+            return (error += 30);
+         }
+      }
+      sv->first_time = 0;
+      sv->nbodies_last = nbodies;
+   }
+
+/*
+   Compute light-time to observed object.
+*/
+
+   tlt = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
+   pos1[2] *pos1[2]) / C_AUDAY;
+
+/*
+   Cycle through gravitating bodies.
+*/
+
+   for (i = 0; i < nbodies; i++)
+   {
+
+
+/*
+   Get position of gravitating body wrt ss barycenter at time 'jd_tdb'.
+*/
+
+      jd[0] = jd_tdb;
+      if ((error = ephemeris_ctx (ctx,jd,&sv->body[i],0,accuracy, pbody,
+         NULL)) != 0)
+      {
+         return (error);
+      }
+
+/*
+   Get position of gravitating body wrt observer at time 'jd_tdb'.
+*/
+
+      bary2obs (pbody,pos_obs, pbodyo,&x);
+
+/*
+   Compute light-time from point on incoming light ray that is closest
+   to gravitating body.
+*/
+
+      dlt = d_light (pos2,pbodyo);
+
+/*
+   Get position of gravitating body wrt ss barycenter at time when
+   incoming photons were closest to it.
+*/
+
+      tclose = jd_tdb;
+
+      if (dlt > 0.0)
+         tclose = jd_tdb - dlt;
+
+      if (tlt < dlt)
+         tclose = jd_tdb - tlt;
+
+      jd[0] = tclose;
+      if ((error = ephemeris_ctx (ctx,jd,&sv->body[i],0,accuracy, pbody,
+         NULL)) != 0)
+      {
+         return (error);
+      }
+
+/*
+   Compute deflection due to gravitating body.
+*/
+
+      grav_vec (pos2,pos_obs,pbody,RMASS[body_num[i]], pos2);
+   }
+
+/*
+   If observer is not at geocenter, add in deflection due to Earth.
+*/
+
+   if (loc_code != 0 )
+   {
+
+/*
+   Get position of Earth wrt solar system barycenter at time 'jd_tdb'.
+*/
+
+      jd[0] = jd_tdb;
+      if ((error = ephemeris_ctx (ctx,jd,&sv->earth,0,accuracy,
+         pbody,NULL)) != 0)
+      {
+         return (error);
+      }
+
+/*
+   Compute deflection due to Earth.
+*/
+
+      grav_vec (pos2,pos_obs,pbody,RMASS[3], pos2);
+   }
+
+   return (error);
+}
+
+/********grav_vec */
+
+void grav_vec (double *pos1, double *pos_obs, double *pos_body,
+               double rmass,
+
+               double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function corrects position vector for the deflection
+      of light in the gravitational field of an arbitrary body.  This
+      function valid for an observed body within the solar system as
+      well as for a star.
+
+   REFERENCES:
+      Murray, C.A. (1981) Mon. Notices Royal Ast. Society 195, 639-648.
+      See also formulae in Section B of the Astronomical Almanac, or
+         Kaplan, G. et al. (1989) Astronomical Journal 97, 1197-1210,
+         section iii f.
+
+   INPUT
+   ARGUMENTS:
+      pos1[3] (double)
+         Position vector of observed object, with respect to origin at
+         observer (or the geocenter), components in AU.
+      pos_obs [3] (double)
+         Position vector of observer (or the geocenter), with respect
+         to origin at solar system barycenter, components in AU.
+      pos_body[3] (double)
+         Position vector of gravitating body, with respect to origin
+         at solar system barycenter, components in AU.
+      rmass (double)
+         Reciprocal mass of gravitating body in solar mass units,
+         that is, Sun mass / body mass.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector of observed object, with respect to origin at
+         observer (or the geocenter), corrected for gravitational
+         deflection, components in AU.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      C, AU, GS          novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+      fabs               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/12-04/JAB (USNO/AA)
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'grvd'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   double pq[3], pe[3], pmag, emag, qmag, phat[3], ehat[3], qhat[3],
+      pdotq, edotp, qdote, fac1, fac2, p2i;
+
+/*
+   Construct vector 'pq' from gravitating body to observed object and
+   construct vector 'pe' from gravitating body to observer.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      pq[i] = pos_obs[i] + pos1[i] - pos_body[i];
+      pe[i] = pos_obs[i] - pos_body[i];
+   }
+
+/*
+   Compute vector magnitudes and unit vectors.
+*/
+
+   pmag = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
+      pos1[2] * pos1[2]);
+   emag = sqrt (pe[0] * pe[0] + pe[1] * pe[1] + pe[2] * pe[2]);
+   qmag = sqrt (pq[0] * pq[0] + pq[1] * pq[1] + pq[2] * pq[2]);
+
+   for (i = 0; i < 3; i++)
+   {
+      phat[i] = pos1[i] / pmag;
+      ehat[i] = pe[i] / emag;
+      qhat[i] = pq[i] / qmag;
+   }
+
+/*
+   Compute dot products of vectors.
+*/
+
+   pdotq = phat[0] * qhat[0] + phat[1] * qhat[1] + phat[2] * qhat[2];
+   edotp = ehat[0] * phat[0] + ehat[1] * phat[1] + ehat[2] * phat[2];
+   qdote = qhat[0] * ehat[0] + qhat[1] * ehat[1] + qhat[2] * ehat[2];
+
+/*
+   If gravitating body is observed object, or is on a straight line
+   toward or away from observed object to within 1 arcsec, deflection
+   is set to zero; set 'pos2' equal to 'pos1'.
+*/
+
+   if (fabs (edotp) > 0.99999999999)
+   {
+      for (i = 0; i < 3; i++)
+      {
+         pos2[i] = pos1[i];
+      }
+   }
+
+    else
+   {
+
+/*
+   Compute scalar factors.
+*/
+
+      fac1 = 2.0 * GS / (C * C * emag * AU * rmass);
+      fac2 = 1.0 + qdote;
+
+/*
+   Construct corrected position vector 'pos2'.
+*/
+
+      for (i = 0; i < 3; i++)
+      {
+         p2i = phat[i] + fac1 * (pdotq * ehat[i] - edotp * qhat[i]) /
+            fac2;
+         pos2[i] = p2i * pmag;
+      }
+   }
+
+   return;
+}
+
+/********aberration */
+
+void aberration (double *pos, double *ve, double lighttime,
+
+                 double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Corrects position vector for aberration of light.  Algorithm
+      includes relativistic terms.
+
+   REFERENCES:
+      Murray, C. A. (1981) Mon. Notices Royal Ast. Society 195, 639-648.
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+
+   INPUT
+   ARGUMENTS:
+      pos[3] (double)
+         Position vector, referred to origin at center of mass of the
+         Earth, components in AU.
+      ve[3] (double)
+         Velocity vector of center of mass of the Earth, referred to
+         origin at solar system barycenter, components in AU/day.
+      lighttime (double)
+         Light time from object to Earth in days.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, referred to origin at center of mass of the
+         Earth, corrected for aberration, components in AU
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      C_AUDAY            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/12-02/JAB (USNO/AA) Improve efficiency by removing calls to
+                               'pow' and replacing final 'for' loop
+                               with direct assignment.
+      V1.3/11-03/JAB (USNO/AA) Remove returned value.
+      V1.4/02-06/WKP (USNO/AA) Changed C to C_AUDAY.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'aberat'.
+      2. If 'lighttime' = 0 on input, this function will compute it.
+
+------------------------------------------------------------------------
+*/
+{
+   double p1mag, vemag, beta, dot, cosd, gammai, p, q, r;
+
+   if (lighttime == 0.0)
+   {
+      p1mag = sqrt (pos[0] * pos[0] + pos[1] * pos[1] + pos[2] *
+         pos[2]);
+      lighttime = p1mag / C_AUDAY;
+   }
+    else
+      p1mag = lighttime * C_AUDAY;
+
+   vemag = sqrt (ve[0] * ve[0] + ve[1] * ve[1] + ve[2] * ve[2]);
+   beta = vemag / C_AUDAY;
+   dot = pos[0] * ve[0] + pos[1] * ve[1] + pos[2] * ve[2];
+
+   cosd = dot / (p1mag * vemag);
+   gammai = sqrt (1.0 - beta * beta);
+   p = beta * cosd;
+   q = (1.0 + p / (1.0 + gammai)) * lighttime;
+   r = 1.0 + p;
+
+   pos2[0] = (gammai * pos[0] + q * ve[0]) / r;
+   pos2[1] = (gammai * pos[1] + q * ve[1]) / r;
+   pos2[2] = (gammai * pos[2] + q * ve[2]) / r;
+
+   return;
+}
+
+/********rad_vel */
+
+void rad_vel (object *cel_object, double *pos, double *vel,
+              double *vel_obs, double d_obs_geo, double d_obs_sun,
+              double d_obj_sun,
+
+              double *rv)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Predicts the radial velocity of the observed object
+      as it would be measured by spectroscopic means.  Radial
+      velocity is here defined as the radial velocity measure (z)
+      times the speed of light.  For a solar system body, it applies
+      to a fictitious emitter at the center of the observed object,
+      assumed massless (no gravitational red shift), and does not
+      in general apply to reflected light.  For stars, it includes
+      all effects, such as gravitational red shift, contained
+      in the catalog barycentric radial velocity measure, a scalar
+      derived from spectroscopy.  Nearby stars with a known kinematic
+      velocity vector (obtained independently of spectroscopy) can be
+      treated like solar system objects.
+
+   REFERENCES:
+      Lindegren & Dravins (2003), Astronomy & Astrophysics 401,
+         1185-1201.
+
+   INPUT
+   ARGUMENTS:
+      *cel_object (struct object)
+         Specifies the celestial object of interest (structure defined
+         in novas.h).
+      *pos (double)
+         Geometric position vector of object with respect to observer,
+         corrected for light-time, in AU.
+      *vel (double)
+         Velocity vector of object with respect to solar system
+         barycenter, in AU/day.
+      *vel_obs (double)
+         Velocity vector of observer with respect to solar system
+         barycenter, in AU/day.
+      d_obs_geo (double)
+         Distance from observer to geocenter, in AU.
+      d_obs_sun (double)
+         Distance from observer to Sun, in AU.
+      d_obj_sun (double)
+         Distance from object to Sun, in AU.
+
+   OUTPUT
+   ARGUMENTS:
+      *rv (double)
+         The observed radial velocity measure times the speed of light,
+         in kilometers/second.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      AU, C, GS, GE      novascon.c
+      DEG2RAD            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+      sin                math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-06/JAB (USNO/AA)
+      V2.0/01-07/JAB (USNO/AA): Implement new algorithm
+      V2.1/10-26/ROA:           No static variables, so that the
+                                function is re-entrant.
+
+   NOTES:
+      1. All the input arguments are BCRS quantities, expressed
+      with respect to the ICRS axes.  'vel' and 'vel_obs' are kinematic
+      velocities - derived from geometry or dynamics, not spectroscopy.
+      2. If the object is outside the solar system, the algorithm
+      used will be consistent with the IAU definition of stellar
+      radial velocity, specifically, the barycentric radial velocity
+      measure, which is derived from spectroscopy.  In that case,
+      the vector 'vel' can be very approximate -- or, for distant stars
+      or galaxies, zero -- as it will be used only for a small geometric
+      correction that is proportional to proper motion.
+      3. Any of the distances (last three input arguments) can be set to
+      zero (0.0) if the corresponding general relativistic gravitational
+      potential term is not to be evaluated.  These terms generally
+      are important only at the meter/second level.  If 'd_obs_geo' and
+      'd_obs_sun' are both zero, an average value will be used for the
+      relativistic term for the observer, appropriate for an observer on
+      the surface of the Earth.  'd_obj_sun', if given, is used only for
+      solar system objects.
+      4. This function is the C version of NOVAS Fortran routine
+      'radvl'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   double c2, toms, toms2, v[3], ra, dec, radvel, posmag, uk[3], v2,
+      vo2, r, phigeo, phisun, rel, rar, dcr, cosdec, du[3], zc, kv, zb1,
+      kvobs, zobs1;
+
+/*
+   Set up local constants.
+*/
+
+   c2 = C * C;
+   toms = AU / 86400.0;
+   toms2 = toms * toms;
+
+/*
+   Initialize variables needed for radial velocity calculation.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      v[i] = vel[i];
+   }
+
+   switch (cel_object->type)
+   {
+      case 2:     /* Data for objects outside the solar system. */
+         ra = cel_object->star.ra;
+         dec = cel_object->star.dec;
+         radvel = cel_object->star.radialvelocity;
+
+         if (cel_object->star.parallax <= 0.0)
+         {
+            for (i = 0; i < 3; i++)
+            {
+               v[i] = 0.0;
+            }
+         }
+         break;
+
+      default:    /* Data not used for solar system objects. */
+         ra = 0.0;
+         dec = 0.0;
+         radvel = 0.0;
+   }
+
+/*
+   Compute length of position vector = distance to object in AU.
+*/
+
+   posmag = sqrt (pos[0] * pos[0] + pos[1] * pos[1] + pos[2] * pos[2]);
+
+/*
+   Compute unit vector toward object.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      uk[i] = pos[i] / posmag;
+   }
+
+/*
+   Compute velocity-squared factors.
+*/
+
+   v2 =  (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) * toms2;
+   vo2 = (vel_obs[0] * vel_obs[0] + vel_obs[1] * vel_obs[1] +
+      vel_obs[2] * vel_obs[2]) * toms2;
+
+/*
+   Compute geopotential at observer, unless observer is geocentric.
+*/
+
+      r = d_obs_geo * AU;
+
+      if (r > 1.0e6)
+      {
+         phigeo = GE / r;
+      }
+       else
+      {
+         phigeo = 0.0;
+      }
+
+
+/*
+   Compute solar potential at observer.
+*/
+
+      r = d_obs_sun * AU;
+
+      if (r > 1.0e8)
+      {
+         phisun = GS / r;
+      }
+       else
+      {
+         phisun = 0.0;
+      }
+
+/*
+   Compute relativistic potential and velocity factor for observer.
+*/
+
+   if ((d_obs_geo != 0.0) || (d_obs_sun != 0.0))
+   {
+
+/*
+   Lindegren & Dravins eq. (41), second factor in parentheses.
+*/
+      rel = 1.0 - (phigeo + phisun) / c2 - 0.5 * vo2 / c2;
+   }
+    else
+   {
+
+/*
+   Lindegren & Dravins eq. (42), inverse.
+*/
+
+      rel = 1.0 - 1.550e-8;
+   }
+
+/*
+   Complete radial velocity calculation.
+*/
+
+   switch (cel_object->type)
+   {
+      case 2:     /* Objects outside the solar system. */
+
+/*
+   For stars, update barycentric radial velocity measure for change
+   in view angle.
+*/
+
+         rar = ra * 15.0 * DEG2RAD;
+         dcr = dec * DEG2RAD;
+         cosdec = cos (dcr);
+         du[0] = uk[0] - (cosdec * cos (rar));
+         du[1] = uk[1] - (cosdec * sin (rar));
+         du[2] = uk[2] - sin (dcr);
+         zc = radvel * 1.0e3 +
+            (v[0] * du[0] + v[1] * du[1] + v[2] * du[2]) * toms;
+
+/*
+   Compute observed radial velocity measure of a star (inverse of
+   Lindegren & Dravins eq. (41)).
+*/
+
+         zb1 = 1.0 + zc / C;
+         kvobs = (uk[0] * vel_obs[0] + uk[1] * vel_obs[1] +
+            uk[2] * vel_obs[2]) * toms;
+         zobs1 = zb1 * rel / (1.0 + kvobs / C);
+         break;
+
+      case 0:     /* Objects in the solar system */
+      case 1:
+      default:
+
+/*
+   Compute solar potential at object, if within solar system.
+*/
+
+         r = d_obj_sun * AU;
+
+         if ((r > 1.0e8) && (r < 1.0e16))
+         {
+            phisun = GS / r;
+         }
+          else
+         {
+            phisun = 0.0;
+         }
+
+/*
+   Compute observed radial velocity measure of a planet or other
+   object -- including a nearby star -- where kinematic barycentric
+   velocity vector is known and gravitational red shift is negligible
+   (Lindegren & Dravins eq. (40), applied as per S. Klioner private
+   communication (2006)).
+*/
+
+         kv = (uk[0] * vel[0] + uk[1] * vel[1] + uk[2] * vel[2]) * toms;
+         zb1 = (1.0 + kv / C ) / (1.0 - phisun / c2 - 0.5 * v2 / c2);
+         kvobs = (uk[0] * vel_obs[0] + uk[1] * vel_obs[1] +
+            uk[2] * vel_obs[2] ) * toms;
+         zobs1 = zb1 * rel / (1.0 + kvobs / C);
+   }
+
+/*
+   Convert observed radial velocity measure to kilometers/second.
+*/
+
+   *rv = (zobs1 - 1.0) * C / 1000.0;
+
+   return;
+}
+
+/********precession */
+
+short int precession (double jd_tdb1, double *pos1, double jd_tdb2,
+
+                      double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Precesses equatorial rectangular coordinates from one epoch to
+      another.  One of the two epochs must be J2000.0.  The coordinates
+      are referred to the mean dynamical equator and equinox of the two
+      respective epochs.
+
+   REFERENCES:
+      Explanatory Supplement To The Astronomical Almanac, pp. 103-104.
+      Capitaine, N. et al. (2003), Astronomy And Astrophysics 412,
+         pp. 567-586.
+      Hilton, J. L. et al. (2006), IAU WG report, Celest. Mech., 94,
+         pp. 351-367.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb1 (double)
+         TDB Julian date of first epoch.  See Note 1 below.
+      pos1[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to mean dynamical equator and equinox of first epoch.
+      jd_tdb2 (double)
+         TDB Julian date of second epoch.  See Note 1 below.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to mean dynamical equator and equinox of second epoch.
+
+   RETURNED
+   VALUE:
+      (short int)
+         = 0 ... everything OK.
+         = 1 ... Precession not to or from J2000.0; 'jd_tdb1' or 'jd_tdb2'
+                 not 2451545.0.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      precession_ctx     novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/03-98/JAB (USNO/AA) Change function type from 'short int' to
+                               'void'.
+      V1.3/12-99/JAB (USNO/AA) Precompute trig terms for greater
+                               efficiency.
+      V2.0/10-03/JAB (USNO/AA) Update function for consistency with
+                               IERS (2000) Conventions.
+      V2.1/01-05/JAB (USNO/AA) Update expressions for the precession
+                               angles (extra significant digits).
+      V2.2/04-06/JAB (USNO/AA) Update model to 2006 IAU convention.
+                               This is model "P03" of second reference.
+      V2.3/03-10/JAB (USNO/AA) Implement 'first-time' to fix bug when
+                                'jd_tdb2' is 'T0' on first call to
+                                function.
+      V2.4/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. Either 'jd_tdb1' or 'jd_tdb2' must be 2451545.0 (J2000.0) TDB.
+      2. This function is the C version of NOVAS Fortran routine
+      'preces'.
+
+------------------------------------------------------------------------
+*/
+{
+   return precession_ctx (default_context (), jd_tdb1,pos1,jd_tdb2,
+      pos2);
+}
+
+/********precession_ctx */
+
+short int precession_ctx (novas_context *ctx, double jd_tdb1,
+                          double *pos1, double jd_tdb2,
+
+                          double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'precession' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'precession'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'precession'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'precession'.
+
+   RETURNED
+   VALUE:
+      See function 'precession'.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      fabs               math.h
+      sin                math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'precession' V2.3.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   precession_saved *sv = &ctx->precession;
+
+   short int error = 0;
+
+   double eps0 = 84381.406;
+   double  t, psia, omegaa, chia, sa, ca, sb, cb, sc, cc, sd, cd;
+
+/*
+   Check to be sure that either 'jd_tdb1' or 'jd_tdb2' is equal to T0.
+*/
+
+   if ((jd_tdb1 != T0) && (jd_tdb2 != T0))
+      return (error = 1);
+
+/*
+   't' is time in TDB centuries between the two epochs.
+*/
+
+   t = (jd_tdb2 - jd_tdb1) / 36525.0;
+
+   if (jd_tdb2 == T0)
+      t = -t;
+
+   if ((fabs (t - sv->t_last) >= 1.0e-15) || (sv->first_time == 1))
+   {
+
+/*
+   Numerical coefficients of psi_a, omega_a, and chi_a, along with
+   epsilon_0, the obliquity at J2000.0, are 4-angle formulation from
+   Capitaine et al. (2003), eqs. (4), (37), & (39).
+*/
+
+      psia   = ((((-    0.0000000951  * t
+                   +    0.000132851 ) * t
+                   -    0.00114045  ) * t
+                   -    1.0790069   ) * t
+                   + 5038.481507    ) * t;
+
+      omegaa = ((((+    0.0000003337  * t
+                   -    0.000000467 ) * t
+                   -    0.00772503  ) * t
+                   +    0.0512623   ) * t
+                   -    0.025754    ) * t + eps0;
+
+      chia   = ((((-    0.0000000560  * t
+                   +    0.000170663 ) * t
+                   -    0.00121197  ) * t
+                   -    2.3814292   ) * t
+                   +   10.556403    ) * t;
+
+      eps0 = eps0 * ASEC2RAD;
+      psia = psia * ASEC2RAD;
+      omegaa = omegaa * ASEC2RAD;
+      chia = chia * ASEC2RAD;
+
+      sa = sin (eps0);
+      ca = cos (eps0);
+      sb = sin (-psia);
+      cb = cos (-psia);
+      sc = sin (-omegaa);
+      cc = cos (-omegaa);
+      sd = sin (chia);
+      cd = cos (chia);
+/*
+   Compute elements of precession rotation matrix equivalent to
+   R3(chi_a) R1(-omega_a) R3(-psi_a) R1(epsilon_0).
+*/
+
+      sv->xx =  cd * cb - sb * sd * cc;
+      sv->yx =  cd * sb * ca + sd * cc * cb * ca - sa * sd * sc;
+      sv->zx =  cd * sb * sa + sd * cc * cb * sa + ca * sd * sc;
+      sv->xy = -sd * cb - sb * cd * cc;
+      sv->yy = -sd * sb * ca + cd * cc * cb * ca - sa * cd * sc;
+      sv->zy = -sd * sb * sa + cd * cc * cb * sa + ca * cd * sc;
+      sv->xz =  sb * sc;
+      sv->yz = -sc * cb * ca - sa * cc;
+      sv->zz = -sc * cb * sa + cc * ca;
+
+      sv->t_last = t;
+      sv->first_time = 0;
+   }
+
+   if (jd_tdb2 == T0)
+   {
+
+/*
+   Perform rotation from epoch to J2000.0.
+*/
+      pos2[0] = sv->xx * pos1[0] + sv->xy * pos1[1] + sv->xz * pos1[2];
+      pos2[1] = sv->yx * pos1[0] + sv->yy * pos1[1] + sv->yz * pos1[2];
+      pos2[2] = sv->zx * pos1[0] + sv->zy * pos1[1] + sv->zz * pos1[2];
+   }
+    else
+   {
+
+/*
+   Perform rotation from J2000.0 to epoch.
+*/
+
+      pos2[0] = sv->xx * pos1[0] + sv->yx * pos1[1] + sv->zx * pos1[2];
+      pos2[1] = sv->xy * pos1[0] + sv->yy * pos1[1] + sv->zy * pos1[2];
+      pos2[2] = sv->xz * pos1[0] + sv->yz * pos1[1] + sv->zz * pos1[2];
+   }
+
+   return (error = 0);
+}
+
+/********nutation */
+
+void nutation (double jd_tdb, short int direction, short int accuracy,
+               double *pos,
+
+               double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Nutates equatorial rectangular coordinates from mean equator and
+      equinox of epoch to true equator and equinox of epoch. Inverse
+      transformation may be applied by setting flag 'direction'.
+
+   REFERENCES:
+      Explanatory Supplement To The Astronomical Almanac, pp. 114-115.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date of epoch.
+      direction (short int)
+         Flag determining 'direction' of transformation;
+            direction  = 0 transformation applied, mean to true.
+            direction != 0 inverse transformation applied, true to mean.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      pos[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to mean equator and equinox of epoch.
+
+   OUTPUT
+   ARGUMENTS:
+      pos2[3] (double)
+         Position vector, geocentric equatorial rectangular coordinates,
+         referred to true equator and equinox of epoch.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      nutation_ctx       novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/11-03/JAB (USNO/AA) Remove returned value.
+      V1.3/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.4/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'nutate'.
+
+------------------------------------------------------------------------
+*/
+{
+   nutation_ctx (default_context (), jd_tdb,direction,accuracy,pos,
+      pos2);
+   return;
+}
+
+/********nutation_ctx */
+
+void nutation_ctx (novas_context *ctx, double jd_tdb,
+                   short int direction, short int accuracy, double *pos,
+
+                   double *pos2)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function is the version of 'nutation' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
+
+   REFERENCES:
+      See function 'nutation'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'nutation'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'nutation'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      DEG2RAD, ASEC2RAD  novascon.c
+
+   FUNCTIONS
+   CALLED:
+      e_tilt_ctx         novas.c
+      cos                math.h
+      sin                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'nutation' V1.3.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   double cobm, sobm, cobt, sobt, cpsi, spsi, xx, yx, zx, xy, yy, zy,
+      xz, yz, zz, oblm, oblt, eqeq, psi, eps;
+
+/*
+   Call 'e_tilt' to get the obliquity and nutation angles.
 */
 
-   const short int ke1[14] =
-      {0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0};
+   e_tilt_ctx (ctx,jd_tdb,accuracy, &oblm,&oblt,&eqeq,&psi,&eps);
+
+   cobm = cos (oblm * DEG2RAD);
+   sobm = sin (oblm * DEG2RAD);
+   cobt = cos (oblt * DEG2RAD);
+   sobt = sin (oblt * DEG2RAD);
+   cpsi = cos (psi * ASEC2RAD);
+   spsi = sin (psi * ASEC2RAD);
 
 /*
-   Sine and cosine coefficients for t^0.
+   Nutation rotation matrix follows.
 */
 
-   const double se0_t[33][2] = {
-      {+2640.96e-6,          -0.39e-6},
-      {  +63.52e-6,          -0.02e-6},
-      {  +11.75e-6,          +0.01e-6},
-      {  +11.21e-6,          +0.01e-6},
-      {   -4.55e-6,          +0.00e-6},
-      {   +2.02e-6,          +0.00e-6},
-      {   +1.98e-6,          +0.00e-6},
-      {   -1.72e-6,          +0.00e-6},
-      {   -1.41e-6,          -0.01e-6},
-      {   -1.26e-6,          -0.01e-6},
-      {   -0.63e-6,          +0.00e-6},
-      {   -0.63e-6,          +0.00e-6},
-      {   +0.46e-6,          +0.00e-6},
-      {   +0.45e-6,          +0.00e-6},
-      {   +0.36e-6,          +0.00e-6},
-      {   -0.24e-6,          -0.12e-6},
-      {   +0.32e-6,          +0.00e-6},
-      {   +0.28e-6,          +0.00e-6},
-      {   +0.27e-6,          +0.00e-6},
-      {   +0.26e-6,          +0.00e-6},
-      {   -0.21e-6,          +0.00e-6},
-      {   +0.19e-6,          +0.00e-6},
-      {   +0.18e-6,          +0.00e-6},
-      {   -0.10e-6,          +0.05e-6},
-      {   +0.15e-6,          +0.00e-6},
-      {   -0.14e-6,          +0.00e-6},
-      {   +0.14e-6,          +0.00e-6},
-      {   -0.14e-6,          +0.00e-6},
-      {   +0.14e-6,          +0.00e-6},
-      {   +0.13e-6,          +0.00e-6},
-      {   -0.11e-6,          +0.00e-6},
-      {   +0.11e-6,          +0.00e-6},
-      {   +0.11e-6,          +0.00e-6}};
+   xx = cpsi;
+   yx = -spsi * cobm;
+   zx = -spsi * sobm;
+   xy = spsi * cobt;
+   yy = cpsi * cobm * cobt + sobm * sobt;
+   zy = cpsi * sobm * cobt - cobm * sobt;
+   xz = spsi * sobt;
+   yz = cpsi * cobm * sobt - sobm * cobt;
+   zz = cpsi * sobm * sobt + cobm * cobt;
+
+   if (!direction)
+   {
+
 /*
-   Sine and cosine coefficients for t^1.
+   Perform rotation.
 */
 
-   const double se1[2] =
-      {   -0.87e-6,          +0.00e-6};
+      pos2[0] = xx * pos[0] + yx * pos[1] + zx * pos[2];
+      pos2[1] = xy * pos[0] + yy * pos[1] + zy * pos[2];
+      pos2[2] = xz * pos[0] + yz * pos[1] + zz * pos[2];
+   }
+    else
+   {
 
 /*
-   Interval between fundamental epoch J2000.0 and current date.
+   Perform inverse rotation.
 */
 
-      t = ((jd_high - T0) + jd_low) / 36525.0;
+      pos2[0] = xx * pos[0] + xy * pos[1] + xz * pos[2];
+      pos2[1] = yx * pos[0] + yy * pos[1] + yz * pos[2];
+      pos2[2] = zx * pos[0] + zy * pos[1] + zz * pos[2];
+   }
+
+   return;
+}
+
+/********nutation_angles */
+
+void nutation_angles (double t, short int accuracy,
 
+                      double *dpsi, double *deps)
 /*
-   High accuracy mode.
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the values for nutation in longitude and
+      nutation in obliquity for a given TDB Julian date.  The nutation
+      model selected depends upon the input value of 'accuracy'.  See
+      notes below for important details.
+
+   REFERENCES:
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
+
+   INPUT
+   ARGUMENTS:
+      t (double)
+         TDB time in Julian centuries since J2000.0
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      dpsi (double)
+         Nutation in longitude in arcseconds.
+      deps (double)
+         Nutation in obliquity in arcseconds.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      nutation_angles_ctx novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/12-04/JAB (USNO/AA)
+      V1.1/01-06/WKP (USNO/AA): Changed 'mode' to 'accuracy'.
+      V1.2/02-06/WKP (USNO/AA): Fixed units bug.
+      V1.3/01-07/JAB (USNO/AA): Implemented 'low_acc_choice' construct.
+      V1.4/10-26/ROA:           Optionally interpolate the nutation
+                                series of the ephemeris file.
+      V1.5/10-26/ROA:           Optionally truncate IAU 2000A to a
+                                tolerance.
+      V1.6/10-26/ROA:           Use the default 'novas_context'.
+
+   NOTES:
+      1. This function selects the nutation model depending first upon
+      the input value of 'accuracy'.  If 'accuracy' = 0 (full accuracy),
+      the IAU 2000A nutation model is used.  If 'accuracy' = 1 (reduced
+      accuracy, the model used depends upon the value of local
+      variable 'low_acc_choice', which is set below.
+      2. If local variable 'low_acc_choice' = 1 (the default), a
+      specially truncated version of IAU 2000A, called 'NU2000K' is
+      used.  If 'low_acc_choice' = 2, the IAU 2000B nutation model is
+      used.
+      3.  See the prologs of the nutation functions in file 'nutation.c'
+      for details concerning the models.
+      4. If the source selected with 'set_nutation_source' is
+      NUTATION_EPHEMERIS, the angles are interpolated from the open
+      ephemeris file for both values of 'accuracy'; the series above
+      are used only if that fails.
+      5. If a tolerance has been set with 'set_nutation_tolerance',
+      the IAU 2000A series truncated to that tolerance is used for both
+      values of 'accuracy'.
+      6. This function is the C version of NOVAS Fortran routine
+      'nod'.
+
+------------------------------------------------------------------------
 */
+{
+   nutation_angles_ctx (default_context (), t,accuracy, dpsi,deps);
+   return;
+}
 
-   if (accuracy == 0)
-   {
+/********nutation_angles_ctx */
+
+void nutation_angles_ctx (novas_context *ctx, double t,
+                          short int accuracy,
 
+                          double *dpsi, double *deps)
 /*
-   Fundamental Arguments.
+------------------------------------------------------------------------
 
-   Mean Anomaly of the Moon.
+   PURPOSE:
+      This function is the version of 'nutation_angles' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
+
+   REFERENCES:
+      See function 'nutation_angles'.
+
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'nutation_angles'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'nutation_angles'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+      NUT_SOURCE         novas.c
+      NUT_TOLERANCE      novas.c
+
+   FUNCTIONS
+   CALLED:
+      iau2000a           nutation.c
+      iau2000b           nutation.c
+      nu2000k            nutation.c
+      iau2000a_trunc     nutation_fast.c
+      ephem_nutation     eph_manager.c
+      ephem_nutation_r   eph_manager.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'nutation_angles' V1.5.
+
+   NOTES:
+      1. With the nutation source NUTATION_EPHEMERIS, the series of the
+      ephemeris file of 'ctx' are used, if one was set with
+      'novas_context_set_ephemeris'.  The default context uses those of
+      the file opened with 'ephem_open' otherwise; the other contexts
+      never touch that shared file, and use the IAU series instead.
+
+------------------------------------------------------------------------
 */
+{
 
-      fa[0] = norm_ang ((485868.249036 +
-                         (715923.2178 +
-                         (    31.8792 +
-                         (     0.051635 +
-                         (    -0.00024470)
-                         * t) * t) * t) * t) * ASEC2RAD
-                         + fmod (1325.0*t, 1.0) * TWOPI);
+/*
+   Set the value of 'low_acc_choice' according to the rules explained
+   under NOTES in the prolog.
+*/
+
+   short int low_acc_choice = 1, error = 1;
+
+   double t1, tjd[2];
+
+   t1 = t * 36525.0;
 
 /*
-   Mean Anomaly of the Sun.
+   Ephemeris mode -- interpolate the series of the ephemeris file, if
+   the epoch is on the file.
 */
 
-      fa[1] = norm_ang ((1287104.793048 +
-                         (1292581.0481 +
-                         (     -0.5532 +
-                         (     +0.000136 +
-                         (     -0.00001149)
-                         * t) * t) * t) * t) * ASEC2RAD
-                         + fmod (99.0*t, 1.0) * TWOPI);
+   if (NUT_SOURCE == NUTATION_EPHEMERIS)
+   {
+      tjd[0] = T0;
+      tjd[1] = t1;
+      if (ctx->eph != NULL)
+         error = ephem_nutation_r (ctx->eph,tjd, dpsi,deps);
+       else if (!ctx->private_solsys)
+         error = ephem_nutation (tjd, dpsi,deps);
+      if (error == 0)
+      {
+         *dpsi /= ASEC2RAD;
+         *deps /= ASEC2RAD;
+         return;
+      }
+   }
 
 /*
-   Mean Longitude of the Moon minus Mean Longitude of the Ascending
-   Node of the Moon.
+   Tolerance mode -- use IAU 2000A truncated to the tolerance.
 */
 
-      fa[2] = norm_ang (( 335779.526232 +
-                         ( 295262.8478 +
-                         (    -12.7512 +
-                         (     -0.001037 +
-                         (      0.00000417)
-                         * t) * t) * t) * t) * ASEC2RAD
-                         + fmod (1342.0*t, 1.0) * TWOPI);
+   if (NUT_TOLERANCE > 0.0)
+   {
+      iau2000a_trunc (T0,t1,NUT_TOLERANCE, dpsi,deps);
+   }
+
+/*
+   High accuracy mode -- use IAU 2000A.
+*/
+
+    else if (accuracy == 0)
+   {
+      iau2000a (T0,t1, dpsi,deps);
+   }
+
+/*
+   Low accuracy mode -- model depends upon value of 'low_acc_choice'.
+*/
+
+    else
+   {
+      switch (low_acc_choice)
+      {
+         case 2:   /*  use IAU 2000B */
+            iau2000b (T0,t1, dpsi,deps);
+            break;
+
+         case 1:   /*  use NU2000K  */
+         default:
+            nu2000k (T0,t1, dpsi,deps);
+      }
+   }
 
 /*
-   Mean Elongation of the Moon from the Sun.
+   Convert output to arcseconds.
 */
 
-      fa[3] = norm_ang ((1072260.703692 +
-                         (1105601.2090 +
-                         (     -6.3706 +
-                         (      0.006593 +
-                         (     -0.00003169)
-                         * t) * t) * t) * t) * ASEC2RAD
-                         + fmod (1236.0*t, 1.0) * TWOPI);
+   *dpsi /= ASEC2RAD;
+   *deps /= ASEC2RAD;
 
-/*
-   Mean Longitude of the Ascending Node of the Moon.
-*/
+   return;
+}
 
-      fa[4] = norm_ang (( 450160.398036 +
-                         (-482890.5431 +
-                         (      7.4722 +
-                         (      0.007702 +
-                         (     -0.00005939)
-                         * t) * t) * t) * t) * ASEC2RAD
-                         + fmod (-5.0*t, 1.0) * TWOPI);
+/********fund_args */
 
-      fa[ 5] = norm_ang (4.402608842 + 2608.7903141574 * t);
-      fa[ 6] = norm_ang (3.176146697 + 1021.3285546211 * t);
-      fa[ 7] = norm_ang (1.753470314 +  628.3075849991 * t);
-      fa[ 8] = norm_ang (6.203480913 +  334.0612426700 * t);
-      fa[ 9] = norm_ang (0.599546497 +   52.9690962641 * t);
-      fa[10] = norm_ang (0.874016757 +   21.3299104960 * t);
-      fa[11] = norm_ang (5.481293872 +    7.4781598567 * t);
-      fa[12] = norm_ang (5.311886287 +    3.8133035638 * t);
-      fa[13] =          (0.024381750 +    0.00000538691 * t) * t;
+void fund_args (double t,
 
+                double a[5])
 /*
-   Evaluate the complementary terms.
-*/
+------------------------------------------------------------------------
 
-      s0 = 0.0;
-      s1 = 0.0;
+   PURPOSE:
+      To compute the fundamental arguments (mean elements) of the Sun
+      and Moon.
 
-      for (i = 32; i >= 0; i--)
-      {
-         a = 0.0;
+   REFERENCES:
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
 
-         for (j = 0; j < 14; j++)
-         {
-            a += (double) ke0_t[i][j] * fa[j];
-         }
+   INPUT
+   ARGUMENTS:
+      t (double)
+         TDB time in Julian centuries since J2000.0
 
-         s0 += (se0_t[i][0] * sin (a) + se0_t[i][1] * cos (a));
-      }
+   OUTPUT
+   ARGUMENTS:
+      a[5] (double)
+         Fundamental arguments, in radians:
+          a[0] = l (mean anomaly of the Moon)
+          a[1] = l' (mean anomaly of the Sun)
+          a[2] = F (mean argument of the latitude of the Moon)
+          a[3] = D (mean elongation of the Moon from the Sun)
+          a[4] = Omega (mean longitude of the Moon's ascending node);
+                 from Simon section 3.4(b.3),
+                 precession = 5028.8200 arcsec/cy)
 
-      a = 0.0;
+   RETURNED
+   VALUE:
+      None.
 
-      for (j = 0; j < 14; j++)
-      {
-         a += (double) (ke1[j]) * fa[j];
-      }
+   GLOBALS
+   USED:
+      ASEC2RAD, ASEC360  novascon.c
 
-      s1 += (se1[0] * sin (a) + se1[1] * cos (a));
+   FUNCTIONS
+   CALLED:
+      fmod               math.h
 
-      c_terms = (s0 + s1 * t);
-   }
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-97/JAB (USNO/AA)
+      V1.1/07-98/JAB (USNO/AA): Place arguments in the range 0-TWOPI
+                                radians.
+      V1.2/09-03/JAB (USNO/AA): Incorporate function 'norm_ang'.
+      V1.3/11-03/JAB (USNO/AA): Update with Simon et al. expressions.
+      V1.4/01-06/JAB (USNO/AA): Remove function 'norm_ang'; rewrite for
+                                consistency with Fortran.
+      V1.5/02-11/WKP (USNO/AA): Clarified a[4] description in prolog.
 
-    else
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'funarg'.
 
-/*
-   Low accuracy mode: Terms smaller than 2 microarcseconds omitted.
+------------------------------------------------------------------------
 */
+{
 
-   {
-      fund_args (t, fa2);
-      c_terms =
-          2640.96e-6 * sin (fa2[4])
-         +  63.52e-6 * sin (2.0 * fa2[4])
-         +  11.75e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] + 3.0 * fa2[4])
-         +  11.21e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] +       fa2[4])
-         -   4.55e-6 * sin (2.0 * fa2[2] - 2.0 * fa2[3] + 2.0 * fa2[4])
-         +   2.02e-6 * sin (2.0 * fa2[2]                + 3.0 * fa2[4])
-         +   1.98e-6 * sin (2.0 * fa2[2]                +       fa2[4])
-         -   1.72e-6 * sin (3.0 * fa2[4])
-         -   0.87e-6 * t * sin (fa2[4]);
-   }
+   a[0] = fmod (485868.249036 +
+             t * (1717915923.2178 +
+             t * (        31.8792 +
+             t * (         0.051635 +
+             t * (       - 0.00024470)))), ASEC360) * ASEC2RAD;
 
-   return (c_terms *= ASEC2RAD);
-}
+   a[1] = fmod (1287104.79305 +
+             t * ( 129596581.0481 +
+             t * (       - 0.5532 +
+             t * (         0.000136 +
+             t * (       - 0.00001149)))), ASEC360) * ASEC2RAD;
 
-/********frame_tie */
+   a[2] = fmod (335779.526232 +
+             t * (1739527262.8478 +
+             t * (      - 12.7512 +
+             t * (      -  0.001037 +
+             t * (         0.00000417)))), ASEC360) * ASEC2RAD;
 
-void frame_tie (double *pos1, short int direction,
+   a[3] = fmod (1072260.70369 +
+             t * (1602961601.2090 +
+             t * (       - 6.3706 +
+             t * (         0.006593 +
+             t * (       - 0.00003169)))), ASEC360) * ASEC2RAD;
 
-                double *pos2)
+   a[4] = fmod (450160.398036 +
+             t * ( - 6962890.5431 +
+             t * (         7.4722 +
+             t * (         0.007702 +
+             t * (       - 0.00005939)))), ASEC360) * ASEC2RAD;
+
+   return;
+}
+
+/********mean_obliq */
+
+double mean_obliq (double jd_tdb)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To transform a vector from the dynamical reference system to the
-      International Celestial Reference System (ICRS), or vice versa.
-      The dynamical reference system is based on the dynamical mean
-      equator and equinox of J2000.0.  The ICRS is based on the space-
-      fixed ICRS axes defined by the radio catalog positions of several
-      hundred extragalactic objects.
+      To compute the mean obliquity of the ecliptic.
 
    REFERENCES:
-      Hilton, J. and Hohenkerk, C. (2004), Astronomy and Astrophysics
-         413, 765-770, eq. (6) and (8).
-      IERS (2003) Conventions, Chapter 5.
+      Capitaine et al. (2003), Astronomy and Astrophysics 412, 567-586.
 
    INPUT
    ARGUMENTS:
-      pos1[3] (double)
-         Position vector, equatorial rectangular coordinates.
-      direction (short int)
-         Set 'direction' < 0 for dynamical to ICRS transformation.
-         Set 'direction' >= 0 for ICRS to dynamical transformation.
+      jd_tdb (double)
+         TDB Julian Date.
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, equatorial rectangular coordinates.
+      None.
 
    RETURNED
    VALUE:
-      None.
+      (double)
+         Mean obliquity of the ecliptic in arcseconds.
 
    GLOBALS
    USED:
-      ASEC2RAD           novascon.c
+      T0                 novascon.c
 
    FUNCTIONS
    CALLED:
@@ -4826,124 +10220,181 @@ void frame_tie (double *pos1, short int direction,
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-03/JAB (USNO/AA)
-      V1.1/02-06/WKP (USNO/AA) Added second-order corrections to diagonal
-                               elements.
+      V1.0/12-04/JAB (USNO/AA)
+      V2.0/04-06/JAB (USNO/AA) Update the expression for mean obliquity
+                               using data from the reference.
 
    NOTES:
-      1. For geocentric coordinates, the same transformation is used
-      between the dynamical reference system and the GCRS.
-      2. This function is the C version of NOVAS Fortran routine 'frame'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int compute_matrix = 1;
+   double t, epsilon;
 
 /*
-   'xi0', 'eta0', and 'da0' are ICRS frame biases in arcseconds taken
-   from IERS (2003) Conventions, Chapter 5.
+   Compute time in Julian centuries from epoch J2000.0.
 */
 
-   const double xi0  = -0.0166170;
-   const double eta0 = -0.0068192;
-   const double da0  = -0.01460;
-   static double xx, yx, zx, xy, yy, zy, xz, yz, zz;
+   t = (jd_tdb - T0) / 36525.0;
 
 /*
-   Compute elements of rotation matrix to first order the first time
-   this function is called.  Elements will be saved for future use and
-   not recomputed.
+   Compute the mean obliquity in arcseconds.  Use expression from the
+   reference's eq. (39) with obliquity at J2000.0 taken from eq. (37)
+   or Table 8.
 */
 
-   if (compute_matrix == 1)
-   {
-      xx =  1.0;
-      yx = -da0  * ASEC2RAD;
-      zx =  xi0  * ASEC2RAD;
-      xy =  da0  * ASEC2RAD;
-      yy =  1.0;
-      zy =  eta0 * ASEC2RAD;
-      xz = -xi0  * ASEC2RAD;
-      yz = -eta0 * ASEC2RAD;
-      zz =  1.0;
+   epsilon = (((( -  0.0000000434   * t
+                  -  0.000000576  ) * t
+                  +  0.00200340   ) * t
+                  -  0.0001831    ) * t
+                  - 46.836769     ) * t + 84381.406;
 
-/*
-   Include second-order corrections to diagonal elements.
-*/
+   return (epsilon);
+}
 
-      xx = 1.0 - 0.5 * (yx * yx + zx * zx);
-      yy = 1.0 - 0.5 * (yx * yx + zy * zy);
-      zz = 1.0 - 0.5 * (zy * zy + zx * zx);
+/********nutation_angles_batch */
 
-      compute_matrix = 0;
-   }
+short int nutation_angles_batch (long int n, const double *t,
+                                 short int accuracy, short int n_threads,
 
+                                 double *dpsi, double *deps)
 /*
-   Perform the rotation in the sense specified by 'direction'.
-*/
+------------------------------------------------------------------------
 
-   if (direction < 0)
-   {
+   PURPOSE:
+      This function returns the nutation in longitude and obliquity
+      for an array of TDB dates, as 'nutation_angles', splitting the
+      dates among several threads.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of dates.
+      *t (double)
+         TDB times in Julian centuries since J2000.0 ('n' values).
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation in longitude in arcseconds ('n' values).
+      *deps (double)
+         Nutation in obliquity in arcseconds ('n' values).
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'n' or 'accuracy'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      batch_run          novas.c
+      batch_nutation     novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA           Use the default 'novas_context'.
+      V1.2/10-26/ROA           Series evaluated for blocks of dates.
+      V1.3/10-26/ROA           Threads also with NUTATION_EPHEMERIS.
+
+   NOTES:
+      1. The results are identical to those of 'nutation_angles' with
+      the nutation kernel NUTATION_KERNEL_SCALAR; with the other
+      kernels they agree to far less than 1 microarcsecond (see
+      'iau2000a_batch').  No function-local static data is used, so
+      this function can run at the same time as the scalar functions.
+      2. Each thread passes its dates BATCH_BLOCK at a time to
+      'iau2000a_batch' or 'nu2000k_batch', which evaluate each term of
+      the series for a block of dates in one vector loop.  With a
+      tolerance set by 'set_nutation_tolerance' the truncated series
+      is evaluated date by date.
+      3. With the nutation source NUTATION_EPHEMERIS (see
+      'set_nutation_source') each thread reads its own copy of the file
+      opened with 'ephem_open' (see 'batch_run').
 
-/*
-   Perform rotation from dynamical system to ICRS.
+------------------------------------------------------------------------
 */
+{
+   batch_data data;
 
-      pos2[0] = xx * pos1[0] + yx * pos1[1] + zx * pos1[2];
-      pos2[1] = xy * pos1[0] + yy * pos1[1] + zy * pos1[2];
-      pos2[2] = xz * pos1[0] + yz * pos1[1] + zz * pos1[2];
-   }
-    else
-   {
+   if ((n < 0) || (accuracy < 0) || (accuracy > 1))
+      return 1;
 
-/*
-   Perform rotation from ICRS to dynamical system.
-*/
+   memset (&data, 0, sizeof data);
+   data.t = t;
+   data.accuracy = accuracy;
+   data.dpsi = dpsi;
+   data.deps = deps;
 
-      pos2[0] = xx * pos1[0] + xy * pos1[1] + xz * pos1[2];
-      pos2[1] = yx * pos1[0] + yy * pos1[1] + yz * pos1[2];
-      pos2[2] = zx * pos1[0] + zy * pos1[1] + zz * pos1[2];
-   }
+   batch_run (n,n_threads,batch_nutation,&data);
 
-   return;
+   return 0;
 }
 
-/********proper_motion */
+/********e_tilt_batch */
 
-void proper_motion (double jd_tdb1, double *pos, double *vel,
-                    double jd_tdb2,
+short int e_tilt_batch (long int n, const double *jd_tdb,
+                        short int accuracy, short int n_threads,
 
-                    double *pos2)
+                        double *mobl, double *tobl, double *ee,
+                        double *dpsi, double *deps)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Applies proper motion, including foreshortening effects, to a
-      star's position.
+      Computes quantities related to the orientation of the Earth's
+      rotation axis for an array of TDB dates, as 'e_tilt', splitting
+      the dates among several threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      None.
 
    INPUT
    ARGUMENTS:
-      jd_tdb1 (double)
-         TDB Julian date of first epoch.
-      pos[3] (double)
-         Position vector at first epoch.
-      vel[3] (double)
-         Velocity vector at first epoch.
-      jd_tdb2 (double)
-         TDB Julian date of second epoch.
+      n (long int)
+         Number of dates.
+      *jd_tdb (double)
+         TDB Julian dates ('n' values).
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector at second epoch.
+      *mobl (double)
+         Mean obliquity of the ecliptic in degrees ('n' values).
+      *tobl (double)
+         True obliquity of the ecliptic in degrees ('n' values).
+      *ee (double)
+         Equation of the equinoxes in seconds of time ('n' values).
+      *dpsi (double)
+         Nutation in longitude in arcseconds ('n' values).
+      *deps (double)
+         Nutation in obliquity in arcseconds ('n' values).
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'n' or 'accuracy'.
 
    GLOBALS
    USED:
@@ -4951,359 +10402,373 @@ void proper_motion (double jd_tdb1, double *pos, double *vel,
 
    FUNCTIONS
    CALLED:
-      None.
+      batch_run          novas.c
+      batch_e_tilt       novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Updated to C programming standards.
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA           Use the default 'novas_context'.
+      V1.2/10-26/ROA           Series evaluated for blocks of dates.
+      V1.3/10-26/ROA           Threads also with NUTATION_EPHEMERIS.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'propmo'.
+      1. The results are those of 'e_tilt', including the celestial
+      pole offsets of 'cel_pole' and the table of
+      'nutation_table_make', but without its cache of the last date:
+      this function can run at the same time as the scalar functions.
+      2. See notes 1 to 3 of 'nutation_angles_batch'.
 
 ------------------------------------------------------------------------
 */
 {
-    short int j;
+   batch_data data;
 
-    for (j = 0; j < 3; j++)
-    {
-       pos2[j] = pos[j] + (vel[j] * (jd_tdb2 - jd_tdb1));
-    }
+   if ((n < 0) || (accuracy < 0) || (accuracy > 1))
+      return 1;
 
-    return;
+   memset (&data, 0, sizeof data);
+   data.jd_high = jd_tdb;
+   data.accuracy = accuracy;
+   data.mobl = mobl;
+   data.tobl = tobl;
+   data.ee = ee;
+   data.dpsi = dpsi;
+   data.deps = deps;
+
+   batch_run (n,n_threads,batch_e_tilt,&data);
+
+   return 0;
 }
 
-/********bary2obs */
+/********ee_ct_batch */
 
-void bary2obs (double *pos, double *pos_obs,
+short int ee_ct_batch (long int n, const double *jd_high,
+                       const double *jd_low, short int accuracy,
+                       short int n_threads,
 
-               double *pos2, double *lighttime)
+                       double *ee)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function moves the origin of coordinates from the barycenter
-      of the solar system to the observer (or the geocenter); i.e.,
-      this function accounts for parallax (annual+geocentric or just
-      annual).
+      To compute the "complementary terms" of the equation of the
+      equinoxes for an array of dates, as 'ee_ct', splitting the dates
+      among several threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      None.
 
    INPUT
    ARGUMENTS:
-      pos1[3] (double)
-         Position vector, referred to origin at solar system barycenter,
-         components in AU.
-      pos_obs[3] (double)
-         Position vector of observer (or the geocenter), with respect
-         to origin at solar system barycenter, components in AU.
+      n (long int)
+         Number of dates.
+      *jd_high (double)
+         High-order parts of the TT Julian dates ('n' values).
+      *jd_low (double)
+         Low-order parts of the TT Julian dates ('n' values), or NULL
+         for zero.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, referred to origin at center of mass of the
-         Earth, components in AU.
-      *lighttime (double)
-         Light time from object to Earth in days.
+      *ee (double)
+         Complementary terms, in radians ('n' values).
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'n' or 'accuracy'.
 
    GLOBALS
    USED:
-      C_AUDAY            novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sqrt               math.h
+      novas_parallel_for parallel.cpp
+      batch_ee_ct        novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/10-03/JAB (USNO/AA) Remove calls to 'pow'.
-      V2.0/01-05/JAB (USNO/AA) Update documentation; change
-                               'earthvector' to 'pos_obs'.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'geocen'.
+      1. The results are identical to those of 'ee_ct'.
 
 ------------------------------------------------------------------------
 */
 {
-   short int j;
-
-/*
-   Translate vector to geocentric coordinates.
-*/
+   batch_data data;
 
-   for (j = 0; j < 3; j++)
-   {
-      pos2[j] = pos[j] - pos_obs[j];
-   }
+   if ((n < 0) || (accuracy < 0) || (accuracy > 1))
+      return 1;
 
-/*
-   Calculate length of vector in terms of light time.
-*/
+   memset (&data, 0, sizeof data);
+   data.jd_high = jd_high;
+   data.jd_low = jd_low;
+   data.accuracy = accuracy;
+   data.ee = ee;
 
-   *lighttime = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1] +
-       pos2[2] * pos2[2]) / C_AUDAY;
+   novas_parallel_for (n, n_threads, batch_ee_ct, &data);
 
-   return;
+   return 0;
 }
 
-/********geo_posvel */
+/********mean_obliq_batch */
 
-short int geo_posvel (double jd_tt, double delta_t, short int accuracy,
-                      observer *obs,
+short int mean_obliq_batch (long int n, const double *jd_tdb,
+                            short int n_threads,
 
-                      double *pos, double *vel)
+                            double *mobl)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function computes the geocentric position and velocity
-      of an observer on the surface of the earth or on a near-earth
-      spacecraft.  The final vectors are expressed in the GCRS.
+      To compute the mean obliquity of the ecliptic for an array of
+      dates, as 'mean_obliq', splitting the dates among several
+      threads.
 
    REFERENCES:
-      None.
+      Capitaine et al. (2003), Astronomy and Astrophysics 412, 567-586.
 
    INPUT
    ARGUMENTS:
-      jd_tt (double)
-         TT Julian date.
-      delta_t (double)
-         Value of Delta T (= TT - UT1) at 'jd_tt'.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      *obs (struct observer)
-         Data specifying the location of the observer (struct defined
-         in novas.h).
+      n (long int)
+         Number of dates.
+      *jd_tdb (double)
+         TDB Julian dates ('n' values).
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
 
    OUTPUT
    ARGUMENTS:
-      *pos (double)
-         Position vector of observer, with respect to origin at
-         geocenter, referred to GCRS axes, components in AU.
-      *vel (double)
-         Velocity vector of observer, with respect to origin at
-         geocenter, referred to GCRS axes, components in AU/day.
+      *mobl (double)
+         Mean obliquity of the ecliptic in arcseconds ('n' values).
 
    RETURNED
    VALUE:
       (short int)
-         = 0 ... everything OK.
-         = 1 ... invalid value of 'accuracy'.
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'n'.
 
    GLOBALS
    USED:
-      AU_KM, T0          novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      sidereal_time      novas.c
-      e_tilt             novas.c
-      terra              novas.c
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
-      fabs               math.h
+      novas_parallel_for parallel.cpp
+      batch_mean_obliq   novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
-      V2.2/12-05/WKP (USNO/AA) Updated error handling.
-      V2.3/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V2.4/02-06/WKP (USNO/AA) Changed time argument in sidereal_time
-                               call from 'jd_tt' to 'jd_ut1'.
-      V2.5/04-06/WKP (USNO/AA) Corrected calculation of 'fac' and
-                               changed it to a static.
-      V2.6/10-06/JAB (USNO/AA) Remove 'jd_tdb' input argument; TDB
-                               is approximated by TT.
-      V2.7/02-07/JAB (USNO/AA) Compute 'jd_tdb' corresponding to input
-                               'jd_tt'.
-
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA           Vectorized loop, split among threads.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'geopos'.  This C function differs from its Fortran counterpart
-      in that it does not use the input TT time as a substitute for
-      the TDB time.
+      1. The results are identical to those of 'mean_obliq'.  Each
+      thread computes its dates with 'mean_obliq_array', whose loop is
+      vectorized; a polynomial per date is little work, so threads pay
+      off only for long arrays.
 
 ------------------------------------------------------------------------
 */
 {
-   static double t_last = 0;
-   static double gast, fac;
-   static short int first_time = 1;
-
-   double x, secdif, gmst, x1, x2, x3, x4, eqeq, pos1[3], vel1[3],
-      pos2[3], vel2[3], pos3[3], vel3[3], jd_tdb, jd_ut1;
-   short int error = 0;
+   batch_data data;
 
-/*
-   Invalid value of 'accuracy'.
-*/
+   if (n < 0)
+      return 1;
 
-   if ((accuracy < 0) || (accuracy > 1))
-      return (error = 1);
+   memset (&data, 0, sizeof data);
+   data.jd_high = jd_tdb;
+   data.mobl = mobl;
 
-/*
-   Compute 'jd_tdb', the TDB Julian date corresponding to 'jd_tt'.
-*/
+   novas_parallel_for (n, n_threads, batch_mean_obliq, &data);
 
-   jd_tdb = jd_tt;
-   tdb2tt (jd_tdb, &x,&secdif);
-   jd_tdb = jd_tt + secdif / 86400.0;
+   return 0;
+}
 
-   switch (obs->where)
-   {
+/********batch_run */
 
+static void batch_run (long int n, short int n_threads,
+                       novas_range_fn range, batch_data *data)
 /*
-   Observer at geocenter.  Trivial case.
-*/
-
-      case (0):
-         pos[0] = 0.0;
-         pos[1] = 0.0;
-         pos[2] = 0.0;
-         vel[0] = 0.0;
-         vel[1] = 0.0;
-         vel[2] = 0.0;
-         return (error = 0);
+------------------------------------------------------------------------
 
-/*
-   Other two cases: Get geocentric position and velocity vectors of
-   observer wrt equator and equinox of date.
+   PURPOSE:
+      This function runs the work of a batch of nutation dates
+      ('batch_nutation', 'batch_e_tilt') on several threads.
 
-   Observer on surface of Earth.
-*/
+   REFERENCES:
+      None.
 
-      case (1):
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of dates.
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+      range (novas_range_fn)
+         Work on a range of dates.
+      *data (batch_data)
+         Data of the batch; 'ctx' and the members of 'batch_task' are
+         set here.
 
-/*
-   Compute UT1 and sidereal time.
-*/
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
 
-         jd_ut1 = jd_tt - (delta_t / 86400.0);
-         if (fabs (jd_ut1 - t_last) > 1.0e-8 )
-         {
-            sidereal_time (jd_ut1,0.0,delta_t,0,1,accuracy, &gmst);
-            e_tilt (jd_tdb,accuracy, &x1,&x2,&eqeq,&x3,&x4);
-            gast = gmst + eqeq / 3600.0;
-            t_last = jd_ut1;
-         }
+   RETURNED
+   VALUE:
+      None.
 
-/*
-   Function 'terra' does the hard work, given sidereal time.
-*/
+   GLOBALS
+   USED:
+      NUT_SOURCE         novas.c
 
-         terra (&obs->on_surf,gast, pos1,vel1);
-         break;
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      novas_thread_count parallel.cpp
+      novas_parallel_for parallel.cpp
+      novas_parallel_tasks parallel.cpp
+      batch_task         novas.c
+      ephem_reopen_r     eph_manager.c
+      ephem_close_r      eph_manager.c
+      novas_context_create novas.c
+      novas_context_set_ephemeris novas.c
+      novas_context_free novas.c
+      calloc             stdlib.h
+      free               stdlib.h
 
-/*
-   Observer on near-earth spacecraft.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
 
-      case (2):
+   NOTES:
+      1. The threads share the default context, except with the
+      nutation source NUTATION_EPHEMERIS: the file opened with
+      'ephem_open' cannot be read from several threads, so each worker
+      gets a context of its own, with the pole offsets of the default
+      context and a copy of the file opened with 'ephem_reopen_r' (none
+      if no file is open, in which case the series are used, as by the
+      default context).
+      2. If the copies cannot be made, the dates are processed by the
+      calling thread with the default context.  The results never
+      depend on the number of threads.
 
-/*
-   Convert units to AU and AU/day.
+------------------------------------------------------------------------
 */
+{
+   short int count, w, error, ok;
 
-         if (first_time)
-         {
-            fac = AU_KM / 86400.0;
-            first_time = 0;
-         }
+   novas_context *dflt, **ctx;
 
-         pos1[0] = obs->near_earth.sc_pos[0] / AU_KM;
-         pos1[1] = obs->near_earth.sc_pos[1] / AU_KM;
-         pos1[2] = obs->near_earth.sc_pos[2] / AU_KM;
+   ephem_handle **eph;
 
-         vel1[0] = obs->near_earth.sc_vel[0] / fac;
-         vel1[1] = obs->near_earth.sc_vel[1] / fac;
-         vel1[2] = obs->near_earth.sc_vel[2] / fac;
-         break;
+   dflt = default_context ();
+   data->ctx = dflt;
+
+   count = novas_thread_count (n_threads,n);
+   if ((NUT_SOURCE != NUTATION_EPHEMERIS) || (count < 2))
+   {
+      novas_parallel_for (n,count,range,data);
+      return;
    }
 
 /*
-   Transform geocentric position vector of observer to GCRS.
+   Context, and copy of the ephemeris file, of each worker.
 */
 
-   nutation (jd_tdb,-1,accuracy,pos1, pos2);
-   precession (jd_tdb,pos2,T0, pos3);
-   frame_tie (pos3,-1, pos);
+   ctx = (novas_context **) calloc ((size_t) count,
+      sizeof (novas_context *));
+   eph = (ephem_handle **) calloc ((size_t) count,
+      sizeof (ephem_handle *));
+   ok = (ctx != NULL) && (eph != NULL);
+
+   for (w = 0; ok && (w < count); w++)
+   {
+      error = ephem_reopen_r (NULL,&eph[w]);
+      if (((error != 0) && (error != 15)) ||
+         ((ctx[w] = novas_context_create ()) == NULL))
+      {
+         ok = 0;
+      }
+       else
+      {
+         novas_context_set_ephemeris (ctx[w],eph[w]);
+         ctx[w]->psi_cor = dflt->psi_cor;
+         ctx[w]->eps_cor = dflt->eps_cor;
+      }
+   }
 
 /*
-   Transform geocentric velocity vector of observer to GCRS.
+   One range of dates per worker.
 */
 
-   nutation (jd_tdb,-1,accuracy,vel1, vel2);
-   precession (jd_tdb,vel2,T0, vel3);
-   frame_tie (vel3,-1, vel);
+   if (ok)
+   {
+      data->n = n;
+      data->n_tasks = count;
+      data->range = range;
+      data->worker_ctx = ctx;
+      novas_parallel_tasks (count,count,batch_task,data);
+   }
+    else
+   {
+      range (0,n,data);
+   }
+
+   for (w = 0; (ctx != NULL) && (w < count); w++)
+      if (ctx[w] != NULL)
+         novas_context_free (ctx[w]);
 
-   return (error = 0);
-}
+   for (w = 0; (eph != NULL) && (w < count); w++)
+      if (eph[w] != NULL)
+         ephem_close_r (eph[w]);
 
-/********light_time */
+   free (ctx);
+   free (eph);
 
-short int light_time (double jd_tdb, object *ss_object, double pos_obs[3],
-                      double tlight0, short int accuracy,
+   return;
+}
 
-                      double pos[3], double *tlight)
+/********batch_task */
+
+static void batch_task (long int task, short int worker, void *arg)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function computes the geocentric position of a solar system
-      body, as antedated for light-time.
+      Work of one range of dates of 'batch_run', with the context of
+      the worker doing it.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date of observation.
-      *ss_object (struct object)
-         Pointer to structure containing the designation for the
-         solar system body (defined in novas.h).
-      pos_obs[3] (double)
-         Position vector of observer (or the geocenter), with respect to
-         origin at solar system barycenter, referred to ICRS axes,
-         components in AU.
-      tlight0 (double)
-         First approximation to light-time, in days (can be set to 0.0
-         if unknown).
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      task (long int)
+         Index of the range.
+      worker (short int)
+         Worker doing the range (selects the context).
+      *arg (void)
+         Data of the batch ('batch_data').
 
    OUTPUT
    ARGUMENTS:
-      pos[3] (double)
-         Position vector of body, with respect to origin at observer (or
-         the geocenter), referred to ICRS axes, components in AU.
-      tlight (double)
-         Final light-time, in days.
+      None (results written to the arrays of the batch).
 
    RETURNED
    VALUE:
-      (short int)
-         =  0 ... everything OK.
-         =  1 ... algorithm failed to converge after 10 iterations.
-         > 10 ... error is 10 + error from function 'solarsystem'.
+      None.
 
    GLOBALS
    USED:
@@ -5311,502 +10776,458 @@ short int light_time (double jd_tdb, object *ss_object, double pos_obs[3],
 
    FUNCTIONS
    CALLED:
-      ephemeris        novas.c
-      bary2obs         novas.c
-      fabs             math.h
+      None (the work of the batch, through 'range').
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-04/JAB (USNO/AA)
-      V1.1/06-05/JAB (USNO/AA): Changed the convergence tolerance from
-                                1.0e-8 to 1.0e-10
-      V1.2/04-06/JAB (USNO/AA): Changed the convergence tolerance from
-                                1.0e-10 to 1.0e-9
-      V2.0/12-06/JAB (USNO/AA): Support use of split Julian date to
-                                improve accuracy when the full accuracy
-                                option is selected.
-      V2.1/11-07/JAB (USNO/AA): Changed high-accuracy convergence
-                                tolerance from 1.0e-11 to 1.0e-12.
-      V2.2/10-08/JAB (USNO/AA): Use function 'ephemeris' instead of
-                                direct calls to the solar system
-                                functions.
-      V2.3/09-10/WKP (USNO/AA): Initialized 't3' variable to silence
-                                compiler warning.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'littim'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int iter = 0;
+   batch_data *data = (batch_data *) arg;
+   batch_data part = *data;
+
+   part.ctx = data->worker_ctx[worker];
+
+   data->range (data->n * task / data->n_tasks,
+      data->n * (task + 1) / data->n_tasks, &part);
+
+   return;
+}
 
-   double tol, jd[2], t1, t2, t3 = 0.0, pos1[3], vel1[3];
+/********batch_nutation */
 
+static void batch_nutation (long int begin, long int end, void *arg)
 /*
-   Set light-time convergence tolerance.  If full-accuracy option has
-   been selected, split the Julian date into whole days + fraction of
-   day.
-*/
+------------------------------------------------------------------------
 
-   if (accuracy == 0)
-   {
-      tol = 1.0e-12;
+   PURPOSE:
+      Work of one thread of 'nutation_angles_batch'.
 
-      jd[0] = (double) ((long int) jd_tdb);
-      t1 = jd_tdb - jd[0];
-      t2 = t1 - tlight0;
-   }
-    else
-   {
-      tol = 1.0e-9;
+   REFERENCES:
+      None.
 
-      jd[0] = 0.0;
-      jd[1] = 0.0;
-      t1 = jd_tdb;
-      t2 = jd_tdb - tlight0;
-   }
+   INPUT
+   ARGUMENTS:
+      begin (long int)
+         First date of the range.
+      end (long int)
+         One past the last date of the range.
+      *arg (void)
+         Data of the batch ('batch_data').
 
-/*
-   Iterate to obtain correct light-time (usually converges rapidly).
-*/
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
 
-   do
-   {
-      if (iter > 10)
-      {
-         error = 1;
-         *tlight = 0.0;
-         break;
-      }
+   RETURNED
+   VALUE:
+      None.
 
-      if (iter > 0)
-      {
-         t2 = t3;
-      }
+   GLOBALS
+   USED:
+      None.
 
-      jd[1] = t2;
-      error = ephemeris (jd,ss_object,0,accuracy, pos1, vel1);
+   FUNCTIONS
+   CALLED:
+      nutation_block     novas.c
 
-      if (error != 0)
-      {
-         error += 10;
-         *tlight = 0.0;
-         break;
-      }
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA           Ephemeris of the context of the batch.
+      V1.2/10-26/ROA           Blocks of BATCH_BLOCK dates.
 
-      bary2obs (pos1,pos_obs, pos,tlight);
+   NOTES:
+      None.
 
-      t3 = t1 - *tlight;
-      iter++;
-   } while (fabs (t3 - t2) > tol);
+------------------------------------------------------------------------
+*/
+{
+   long int first, m;
 
-   return (error);
+   batch_data *data = (batch_data *) arg;
+
+   for (first = begin; first < end; first += BATCH_BLOCK)
+   {
+      m = (end - first < BATCH_BLOCK) ? end - first : BATCH_BLOCK;
+      nutation_block (data->ctx,m,&data->t[first],data->accuracy,
+         &data->dpsi[first],&data->deps[first]);
+   }
+
+   return;
 }
 
-/********d_light */
+/********batch_e_tilt */
 
-double d_light (double *pos1, double *pos_obs)
+static void batch_e_tilt (long int begin, long int end, void *arg)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function returns the difference in light-time, for a star,
-      between the barycenter of the solar system and the observer (or
-      the geocenter).
+      Work of one thread of 'e_tilt_batch'.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      pos1[3] (double)
-         Position vector of star, with respect to origin at solar
-         system barycenter.
-      pos_obs[3] (double)
-         Position vector of observer (or the geocenter), with respect
-         to origin at solar system barycenter, components in AU.
+      begin (long int)
+         First date of the range.
+      end (long int)
+         One past the last date of the range.
+      *arg (void)
+         Data of the batch ('batch_data').
 
    OUTPUT
    ARGUMENTS:
-      None.
+      None (results written to the arrays of the batch).
 
    RETURNED
    VALUE:
-      (double)
-         Difference in light time, in the sense star to barycenter minus
-         star to earth, in days.
+      None.
 
    GLOBALS
    USED:
-      C_AUDAY            novascon.c
+      T0, ASEC2RAD       novascon.c
+      DEG2RAD            novascon.c
 
    FUNCTIONS
    CALLED:
-      sqrt               math.h
+      nutation_table_eval nutation_table.c
+      nutation_block     novas.c
+      ee_ct              novas.c
+      mean_obliq_array   nutation_fast.c
+      cos                math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA           Pole offsets and ephemeris of the
+                               context of the batch.
+      V1.2/10-26/ROA           Blocks of BATCH_BLOCK dates.
 
    NOTES:
-      1.  Alternatively, this function returns the light-time from the
-      observer (or the geocenter) to a point on a light ray that is
-      closest to a specific solar system body.  For this purpose, 'pos1'
-      is the position vector toward observed object, with respect to
-      origin at observer (or the geocenter); 'pos_obs' is the position
-      vector of solar system body, with respect to origin at observer
-      (or the geocenter), components in AU; and the returned value is
-      the light time to point on line defined by 'pos1' that is closest
-      to solar system body (positive if light passes body before hitting
-      observer, i.e., if 'pos1' is within 90 degrees of 'pos_obs').
-      2. This function is the C version of NOVAS Fortran routine
-      'dlight'.
+      1. Same steps as 'e_tilt'.  The dates are taken BATCH_BLOCK at a
+      time: those not covered by the table are gathered, and their
+      nutation and mean obliquity are computed together
+      ('nutation_block', 'mean_obliq_array').  The obliquities and the
+      equation of the equinoxes are then formed in a loop over the
+      whole range.  'ee' and 'tobl' hold the complementary terms and
+      the mean obliquity until then.
 
 ------------------------------------------------------------------------
 */
 {
-   double dis, u1[3], diflt;
+   long int first, m, i, j, k, idx[BATCH_BLOCK];
 
-/*
-   From 'pos1', form unit vector 'u1' in direction of star or light
-   source.
-*/
+   double d_psi, d_eps, mean_ob;
+   double t[BATCH_BLOCK], jd[BATCH_BLOCK], mo[BATCH_BLOCK];
+   double dp[BATCH_BLOCK], de[BATCH_BLOCK];
 
-   dis = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
-      pos1[2] * pos1[2]);
+   batch_data *data = (batch_data *) arg;
 
-   u1[0] = pos1[0] / dis;
-   u1[1] = pos1[1] / dis;
-   u1[2] = pos1[2] / dis;
+   for (first = begin; first < end; first += BATCH_BLOCK)
+   {
+      m = (end - first < BATCH_BLOCK) ? end - first : BATCH_BLOCK;
 
 /*
-   Light-time returned is the projection of vector 'pos_obs' onto the
-   unit vector 'u1' (formed from 'pos1'), divided by the speed of light.
+   Table, where it covers the date; gather the other dates.
 */
 
-   diflt = (pos_obs[0] * u1[0] + pos_obs[1] * u1[1] +
-      pos_obs[2] * u1[2]) / C_AUDAY;
-
-   return (diflt);
-}
-
-/********grav_def */
-
-short int grav_def (double jd_tdb, short int loc_code,
-                    short int accuracy, double *pos1, double *pos_obs,
+      k = 0;
+      for (i = first; i < first + m; i++)
+      {
+         if (nutation_table_eval (data->jd_high[i],data->accuracy,
+            &data->dpsi[i],&data->deps[i],&data->tobl[i],
+            &data->ee[i]) != 0)
+         {
+            idx[k] = i;
+            jd[k] = data->jd_high[i];
+            t[k] = (data->jd_high[i] - T0) / 36525.0;
+            data->ee[i] = ee_ct (data->jd_high[i],0.0,data->accuracy) /
+               ASEC2RAD;
+            k++;
+         }
+      }
 
-                    double *pos2)
 /*
-------------------------------------------------------------------------
+   Series of the gathered dates.
+*/
 
-   PURPOSE:
-      This function computes the total gravitational deflection of
-      light for the observed object due to the major gravitating bodies
-      in the solar system.  This function valid for an observed body
-      within the solar system as well as for a star.
+      nutation_block (data->ctx,k,t,data->accuracy, dp,de);
+      mean_obliq_array (k,jd, mo);
 
-   REFERENCES:
-      Klioner, S. (2003), Astronomical Journal 125, 1580-1597,
-         Section 6.
+      for (j = 0; j < k; j++)
+      {
+         data->dpsi[idx[j]] = dp[j];
+         data->deps[idx[j]] = de[j];
+         data->tobl[idx[j]] = mo[j];
+      }
+   }
 
-   INPUT
-   ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date of observation.
-      loc_code (short int)
-         Code for location of observer, determining whether the
-         gravitational deflection due to the earth itself is applied.
-            = 0 ... No earth deflection (normally means observer
-                          is at geocenter)
-            = 1 ... Add in earth deflection (normally means
-         observer is on or above surface of earth, including earth
-         orbit)
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
-      *pos1 (double)
-         Position vector of observed object, with respect to origin at
-         observer (or the geocenter), referred to ICRS axes, components
-         in AU.
-      *pos_obs (double)
-         Position vector of observer (or the geocenter), with respect to
-         origin at solar system barycenter, referred to ICRS axes,
-         components in AU.
+   for (i = begin; i < end; i++)
+   {
+      d_psi = data->dpsi[i] + data->ctx->psi_cor;
+      d_eps = data->deps[i] + data->ctx->eps_cor;
+      mean_ob = data->tobl[i];
+
+      data->ee[i] = (d_psi * cos (mean_ob / 3600.0 * DEG2RAD) +
+         data->ee[i]) / 15.0;
+      data->mobl[i] = mean_ob / 3600.0;
+      data->tobl[i] = (mean_ob + d_eps) / 3600.0;
+      data->dpsi[i] = d_psi;
+      data->deps[i] = d_eps;
+   }
+
+   return;
+}
+
+/********batch_ee_ct */
+
+static void batch_ee_ct (long int begin, long int end, void *arg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Work of one thread of 'ee_ct_batch'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      begin (long int)
+         First date of the range.
+      end (long int)
+         One past the last date of the range.
+      *arg (void)
+         Data of the batch ('batch_data').
 
    OUTPUT
    ARGUMENTS:
-      *pos2 (double)
-         Position vector of observed object, with respect to origin at
-         observer (or the geocenter), referred to ICRS axes, corrected
-         for gravitational deflection, components in AU.
+      None (results written to the arrays of the batch).
 
    RETURNED
    VALUE:
-      (short int)
-         =  0 ... Everything OK.
-         < 30 ... Error from function 'ephemeris'.
-         > 30 ... Error from function 'make_object'.
+      None.
 
    GLOBALS
    USED:
-      C_AUDAY            novascon.c
-      RMASS[12]          novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      make_cat_entry     novas.c
-      make_object        novas.c
-      ephemeris          novas.c
-      bary2obs           novas.c
-      d_light            novas.c
-      grav_vec           novas.c
-      sqrt               math.h
+      ee_ct              novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-05/JAB (USNO/AA)
-      V1.1/04-06/WKP (USNO/AA): Added second note (superceded).
-      V1.2/10-08/JAB (USNO/AA): Substituted calls to 'ephemeris' for
-                                calls to 'solarsystem'; added
-                                actions based on 'accuracy' input.
+      V1.0/10-26/ROA
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'grvdef'.
-      2. If 'accuracy' is set to zero (full accuracy), three bodies
-      (Sun, Jupiter, and Saturn) are used in the calculation.  If
-      the reduced-accuracy option is set, only the Sun is used in the
-      calculation.  In both cases, if the observer is not at the
-      geocenter, the deflection due to the Earth is included.
-      3. The number of bodies used at full and reduced accuracy can be
-      set by making a change to the code in this function as indicated
-      in the comments.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-/*
-   The following list of body numbers and corresponding names identifies
-   which gravitating bodies (aside from the Earth) are potentially
-   used -- list is taken from Klioner's table 1, the order based on area
-   of sky affected (col 2).  Order is Sun, Jupiter, Saturn, Moon, Venus,
-   Uranus, Neptune.
-*/
-
-   char body_name[7][8] = {"Sun", "Jupiter", "Saturn", "Moon",
-      "Venus", "Uranus", "Neptune"};
-
-   const short int body_num[7] = {10, 5, 6, 11, 2, 7, 8};
+   long int i;
 
-   static short int first_time = 1;
-   static short int nbodies_last = 0;
+   batch_data *data = (batch_data *) arg;
 
-   short int error = 0;
-   short int nbodies, i;
-
-   double jd[2], tlt, pbody[3], vbody[3], pbodyo[3], x, dlt, tclose;
-
-   cat_entry dummy_star;
+   for (i = begin; i < end; i++)
+      data->ee[i] = ee_ct (data->jd_high[i],
+         (data->jd_low == NULL) ? 0.0 : data->jd_low[i], data->accuracy);
 
-   static object body[7], earth;
+   return;
+}
 
-   jd[1] = 0.0;
+/********batch_mean_obliq */
 
+static void batch_mean_obliq (long int begin, long int end, void *arg)
 /*
-   Initialize output vector of observed object to equal input vector.
-*/
-
-   for (i = 0; i < 3; i++)
-   {
-      pos2[i] = pos1[i];
-   }
+------------------------------------------------------------------------
 
-/*
-   Set the number of bodies -- and hence the bodies used -- based on the
-   value of the 'accuracy' flag.
+   PURPOSE:
+      Work of one thread of 'mean_obliq_batch'.
 
-   Change value of 'nbodies' to include or exclude gravitating bodies
-   ('nbodies' <= 0 means no deflection calculated, 'nbodies' = 1 means
-   Sun only, 'nbodies' = 2 means Sun + Jupiter, etc.)  Default is
-   'nbodies' = 3: Sun + Jupiter + Saturn.
-*/
+   REFERENCES:
+      None.
 
-   if (accuracy == 0)
-   {
-      nbodies = 3;
-   }
-    else
-   {
-      nbodies = 1;
-   }
+   INPUT
+   ARGUMENTS:
+      begin (long int)
+         First date of the range.
+      end (long int)
+         One past the last date of the range.
+      *arg (void)
+         Data of the batch ('batch_data').
 
-/*
-   Set up the structures of type 'object' containing the body
-   information.
-*/
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
 
-   if ((first_time == 1) || (nbodies != nbodies_last))
-   {
-      for (i = 0; i < nbodies; i++)
-      {
-         if (i == 0)
-         {
-            make_cat_entry ("dummy","   ",0,0.0,0.0,0.0,0.0,0.0,0.0,
-               &dummy_star);
+   RETURNED
+   VALUE:
+      None.
 
-            make_object (0,3,"Earth",&dummy_star, &earth);
-         }
+   GLOBALS
+   USED:
+      None.
 
-         if ((error = make_object (0,body_num[i],body_name[i],
-            &dummy_star, &body[i])) != 0)
-         {
-            return (error += 30);
-         }
-      }
-      first_time = 0;
-      nbodies_last = nbodies;
-   }
+   FUNCTIONS
+   CALLED:
+      mean_obliq_array   nutation_fast.c
 
-/*
-   Compute light-time to observed object.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
 
-   tlt = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
-   pos1[2] *pos1[2]) / C_AUDAY;
+   NOTES:
+      None.
 
-/*
-   Cycle through gravitating bodies.
+------------------------------------------------------------------------
 */
+{
+   batch_data *data = (batch_data *) arg;
 
-   for (i = 0; i < nbodies; i++)
-   {
+   mean_obliq_array (end - begin,&data->jd_high[begin],
+      &data->mobl[begin]);
 
+   return;
+}
 
-/*
-   Get position of gravitating body wrt ss barycenter at time 'jd_tdb'.
-*/
+/********nutation_block */
 
-      jd[0] = jd_tdb;
-      if ((error = ephemeris (jd,&body[i],0,accuracy, pbody,vbody))
-         != 0)
-      {
-         return (error);
-      }
+static void nutation_block (novas_context *ctx, long int m,
+                            const double *t, short int accuracy,
 
+                            double *dpsi, double *deps)
 /*
-   Get position of gravitating body wrt observer at time 'jd_tdb'.
-*/
-
-      bary2obs (pbody,pos_obs, pbodyo,&x);
+------------------------------------------------------------------------
 
-/*
-   Compute light-time from point on incoming light ray that is closest
-   to gravitating body.
-*/
+   PURPOSE:
+      This function returns the nutation in longitude and obliquity
+      for a block of dates, as 'nutation_angles_ctx' does for each of
+      them.
 
-      dlt = d_light (pos2,pbodyo);
+   REFERENCES:
+      None.
 
-/*
-   Get position of gravitating body wrt ss barycenter at time when
-   incoming photons were closest to it.
-*/
+   INPUT
+   ARGUMENTS:
+      *ctx (novas_context)
+         Computation context (see 'nutation_angles_ctx').
+      m (long int)
+         Number of dates, at most BATCH_BLOCK.
+      *t (double)
+         TDB times in Julian centuries since J2000.0 ('m' values).
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
-      tclose = jd_tdb;
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation in longitude in arcseconds ('m' values).
+      *deps (double)
+         Nutation in obliquity in arcseconds ('m' values).
 
-      if (dlt > 0.0)
-         tclose = jd_tdb - dlt;
+   RETURNED
+   VALUE:
+      None.
 
-      if (tlt < dlt)
-         tclose = jd_tdb - tlt;
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+      NUT_SOURCE         novas.c
+      NUT_TOLERANCE      novas.c
 
-      jd[0] = tclose;
-      if ((error = ephemeris (jd,&body[i],0,accuracy, pbody,vbody))
-         != 0)
-      {
-         return (error);
-      }
+   FUNCTIONS
+   CALLED:
+      nutation_angles_ctx novas.c
+      get_nutation_kernel nutation.c
+      iau2000a_batch     nutation_fast.c
+      nu2000k_batch      nutation_fast.c
 
-/*
-   Compute deflection due to gravitating body.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
 
-      grav_vec (pos2,pos_obs,pbody,RMASS[body_num[i]], pos2);
-   }
+   NOTES:
+      1. The series are those of 'nutation_angles_ctx' (NU2000K for
+      reduced accuracy), evaluated for the whole block by
+      'iau2000a_batch' or 'nu2000k_batch' with the kernel of
+      'set_nutation_kernel'.  The ephemeris source and the truncated
+      series are left to 'nutation_angles_ctx', date by date.
 
-/*
-   If observer is not at geocenter, add in deflection due to Earth.
+------------------------------------------------------------------------
 */
+{
+   long int j;
 
-   if (loc_code != 0 )
+   double t1[BATCH_BLOCK];
+
+   if ((NUT_SOURCE == NUTATION_EPHEMERIS) || (NUT_TOLERANCE > 0.0))
    {
+      for (j = 0; j < m; j++)
+         nutation_angles_ctx (ctx,t[j],accuracy, &dpsi[j],&deps[j]);
+      return;
+   }
 
 /*
-   Get position of Earth wrt solar system barycenter at time 'jd_tdb'.
+   Same dates as in 'nutation_angles_ctx'.
 */
 
-      jd[0] = jd_tdb;
-      if ((error = ephemeris (jd,&earth,0,accuracy, pbody,vbody))
-         != 0)
-      {
-         return (error);
-      }
+   for (j = 0; j < m; j++)
+      t1[j] = t[j] * 36525.0;
+
+   if (accuracy == 0)
+      iau2000a_batch (m,T0,t1,get_nutation_kernel (), dpsi,deps);
+    else
+      nu2000k_batch (m,T0,t1,get_nutation_kernel (), dpsi,deps);
 
 /*
-   Compute deflection due to Earth.
+   Convert output to arcseconds.
 */
 
-      grav_vec (pos2,pos_obs,pbody,RMASS[3], pos2);
+   for (j = 0; j < m; j++)
+   {
+      dpsi[j] /= ASEC2RAD;
+      deps[j] /= ASEC2RAD;
    }
 
-   return (error);
+   return;
 }
 
-/********grav_vec */
-
-void grav_vec (double *pos1, double *pos_obs, double *pos_body,
-               double rmass,
+/********grid_tile */
 
-               double *pos2)
+static void grid_tile (long int task, short int worker, void *arg)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function corrects position vector for the deflection
-      of light in the gravitational field of an arbitrary body.  This
-      function valid for an observed body within the solar system as
-      well as for a star.
+      Work of one tile of 'place_grid'.
 
    REFERENCES:
-      Murray, C.A. (1981) Mon. Notices Royal Ast. Society 195, 639-648.
-      See also formulae in Section B of the Astronomical Almanac, or
-         Kaplan, G. et al. (1989) Astronomical Journal 97, 1197-1210,
-         section iii f.
+      None.
 
    INPUT
    ARGUMENTS:
-      pos1[3] (double)
-         Position vector of observed object, with respect to origin at
-         observer (or the geocenter), components in AU.
-      pos_obs [3] (double)
-         Position vector of observer (or the geocenter), with respect
-         to origin at solar system barycenter, components in AU.
-      pos_body[3] (double)
-         Position vector of gravitating body, with respect to origin
-         at solar system barycenter, components in AU.
-      rmass (double)
-         Reciprocal mass of gravitating body in solar mass units,
-         that is, Sun mass / body mass.
+      task (long int)
+         Index of the tile.
+      worker (short int)
+         Worker doing the tile (selects the context).
+      *arg (void)
+         Data of the grid ('grid_data').
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector of observed object, with respect to origin at
-         observer (or the geocenter), corrected for gravitational
-         deflection, components in AU.
+      None (results written to the arrays of the grid).
 
    RETURNED
    VALUE:
@@ -5814,248 +11235,251 @@ void grav_vec (double *pos1, double *pos_obs, double *pos_body,
 
    GLOBALS
    USED:
-      C, AU, GS          novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sqrt               math.h
-      fabs               math.h
+      make_frame_ctx     novas.c
+      frame_place        novas.c
+      place_ctx          novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'grvd'.
+      1. If the frame cannot be made, the stars also go through
+      'place_ctx', which returns the error code.
 
 ------------------------------------------------------------------------
 */
 {
-   short int i;
-
-   double pq[3], pe[3], pmag, emag, qmag, phat[3], ehat[3], qhat[3],
-      pdotq, edotp, qdote, fac1, fac2, p2i;
-
-/*
-   Construct vector 'pq' from gravitating body to observed object and
-   construct vector 'pe' from gravitating body to observer.
-*/
+   short int frame_error, error;
 
-   for (i = 0; i < 3; i++)
-   {
-      pq[i] = pos_obs[i] + pos1[i] - pos_body[i];
-      pe[i] = pos_obs[i] - pos_body[i];
-   }
-
-/*
-   Compute vector magnitudes and unit vectors.
-*/
+   long int epoch, station, first, last, m, k;
 
-   pmag = sqrt (pos1[0] * pos1[0] + pos1[1] * pos1[1] +
-      pos1[2] * pos1[2]);
-   emag = sqrt (pe[0] * pe[0] + pe[1] * pe[1] + pe[2] * pe[2]);
-   qmag = sqrt (pq[0] * pq[0] + pq[1] * pq[1] + pq[2] * pq[2]);
+   novas_frame frame;
 
-   for (i = 0; i < 3; i++)
-   {
-      phat[i] = pos1[i] / pmag;
-      ehat[i] = pe[i] / emag;
-      qhat[i] = pq[i] / qmag;
-   }
+   grid_data *data = (grid_data *) arg;
+   novas_context *ctx = data->ctx[worker];
 
 /*
-   Compute dot products of vectors.
+   Epoch, observer and targets of the tile.
 */
 
-   pdotq = phat[0] * qhat[0] + phat[1] * qhat[1] + phat[2] * qhat[2];
-   edotp = ehat[0] * phat[0] + ehat[1] * phat[1] + ehat[2] * phat[2];
-   qdote = qhat[0] * ehat[0] + qhat[1] * ehat[1] + qhat[2] * ehat[2];
+   epoch = task / (data->n_stations * data->n_blocks);
+   station = (task / data->n_blocks) % data->n_stations;
+   first = (task % data->n_blocks) * GRID_TILE;
+   last = first + GRID_TILE;
+   if (last > data->n_targets)
+      last = data->n_targets;
 
-/*
-   If gravitating body is observed object, or is on a straight line
-   toward or away from observed object to within 1 arcsec, deflection
-   is set to zero; set 'pos2' equal to 'pos1'.
-*/
+   frame_error = make_frame_ctx (ctx,data->jd_tt[epoch],
+      data->delta_t[epoch],&data->stations[station],data->coord_sys,
+      data->accuracy, &frame);
 
-   if (fabs (edotp) > 0.99999999999)
+   for (m = first; m < last; m++)
    {
-      for (i = 0; i < 3; i++)
+      k = (epoch * data->n_stations + station) * data->n_targets + m;
+
+      if ((data->targets[m].type == 2) && (frame_error == 0))
       {
-         pos2[i] = pos1[i];
+         frame_place (&frame,&data->targets[m].star, &data->output[k]);
+         error = 0;
       }
-   }
-
-    else
-   {
-
-/*
-   Compute scalar factors.
-*/
-
-      fac1 = 2.0 * GS / (C * C * emag * AU * rmass);
-      fac2 = 1.0 + qdote;
-
-/*
-   Construct corrected position vector 'pos2'.
-*/
-
-      for (i = 0; i < 3; i++)
+       else
       {
-         p2i = phat[i] + fac1 * (pdotq * ehat[i] - edotp * qhat[i]) /
-            fac2;
-         pos2[i] = p2i * pmag;
+         error = place_ctx (ctx,data->jd_tt[epoch],&data->targets[m],
+            &data->stations[station],data->delta_t[epoch],
+            data->coord_sys,data->accuracy, &data->output[k]);
       }
+
+      if (data->errors != NULL)
+         data->errors[k] = error;
+      if ((error != 0) && (data->tile_error[task] == 0))
+         data->tile_error[task] = error;
    }
 
    return;
 }
 
-/********aberration */
+/********vector2radec */
 
-void aberration (double *pos, double *ve, double lighttime,
+short int vector2radec (double *pos,
 
-                 double *pos2)
+                        double *ra, double *dec)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Corrects position vector for aberration of light.  Algorithm
-      includes relativistic terms.
+      Converts an vector in equatorial rectangular coordinates to
+      equatorial spherical coordinates.
 
    REFERENCES:
-      Murray, C. A. (1981) Mon. Notices Royal Ast. Society 195, 639-648.
       Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
 
    INPUT
    ARGUMENTS:
       pos[3] (double)
-         Position vector, referred to origin at center of mass of the
-         Earth, components in AU.
-      ve[3] (double)
-         Velocity vector of center of mass of the Earth, referred to
-         origin at solar system barycenter, components in AU/day.
-      lighttime (double)
-         Light time from object to Earth in days.
+         Position vector, equatorial rectangular coordinates.
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, referred to origin at center of mass of the
-         Earth, corrected for aberration, components in AU
+      *rightascension (double)
+         Right ascension in hours.
+      *declination (double)
+         Declination in degrees.
 
    RETURNED
    VALUE:
-      None.
-
+      (short int)
+         = 0 ... Everything OK.
+         = 1 ... All vector components are zero; 'ra' and 'dec' are
+                 indeterminate.
+         = 2 ... Both pos[0] and pos[1] are zero, but pos[2] is nonzero;
+                 'ra' is indeterminate.
    GLOBALS
    USED:
-      C_AUDAY            novascon.c
+      ASEC2RAD           novascon.c
 
    FUNCTIONS
    CALLED:
       sqrt               math.h
+      atan2              math.h
 
    VER./DATE/
    PROGRAMMER:
       V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
       V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/12-02/JAB (USNO/AA) Improve efficiency by removing calls to
-                               'pow' and replacing final 'for' loop
-                               with direct assignment.
-      V1.3/11-03/JAB (USNO/AA) Remove returned value.
-      V1.4/02-06/WKP (USNO/AA) Changed C to C_AUDAY.
+      V1.2/01-04/JAB (USNO/AA) Remove calls to 'pow'.
 
    NOTES:
       1. This function is the C version of NOVAS Fortran routine
-      'aberat'.
-      2. If 'lighttime' = 0 on input, this function will compute it.
+      'angles'.
 
 ------------------------------------------------------------------------
 */
 {
-   double p1mag, vemag, beta, dot, cosd, gammai, p, q, r;
+   double xyproj;
 
-   if (lighttime == 0.0)
+   xyproj = sqrt (pos[0] * pos[0] + pos[1] * pos[1]);
+   if ((xyproj == 0.0) && (pos[2] == 0))
    {
-      p1mag = sqrt (pos[0] * pos[0] + pos[1] * pos[1] + pos[2] *
-         pos[2]);
-      lighttime = p1mag / C_AUDAY;
+      *ra = 0.0;
+      *dec = 0.0;
+      return 1;
+   }
+    else if (xyproj == 0.0)
+   {
+      *ra = 0.0;
+      if (pos[2] < 0.0)
+         *dec = -90.0;
+       else
+         *dec = 90.0;
+      return 2;
    }
     else
-      p1mag = lighttime * C_AUDAY;
+   {
+      *ra = atan2 (pos[1], pos[0]) / ASEC2RAD / 54000.0;
+      *dec = atan2 (pos[2], xyproj) / ASEC2RAD / 3600.0;
 
-   vemag = sqrt (ve[0] * ve[0] + ve[1] * ve[1] + ve[2] * ve[2]);
-   beta = vemag / C_AUDAY;
-   dot = pos[0] * ve[0] + pos[1] * ve[1] + pos[2] * ve[2];
+      if (*ra < 0.0)
+         *ra += 24.0;
+   }
+   return 0;
+}
 
-   cosd = dot / (p1mag * vemag);
-   gammai = sqrt (1.0 - beta * beta);
-   p = beta * cosd;
-   q = (1.0 + p / (1.0 + gammai)) * lighttime;
-   r = 1.0 + p;
+/********radec2vector */
 
-   pos2[0] = (gammai * pos[0] + q * ve[0]) / r;
-   pos2[1] = (gammai * pos[1] + q * ve[1]) / r;
-   pos2[2] = (gammai * pos[2] + q * ve[2]) / r;
+void radec2vector (double ra, double dec, double dist,
+
+                   double *vector)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Converts equatorial spherical coordinates to a vector (equatorial
+      rectangular coordinates).
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      ra (double)
+         Right ascension (hours).
+      dec (double)
+         Declination (degrees).
+      dist (double)
+         Distance (AU)
+
+   OUTPUT
+   ARGUMENTS:
+      vector[3] (double)
+         Position vector, equatorial rectangular coordinates (AU).
+
+   RETURNED
+   VALUE:
+      (short int)
+         = 0 ... Everything OK.
+
+   GLOBALS
+   USED:
+      DEG2RAD            novascon.c
+
+   FUNCTIONS
+   CALLED:
+      cos                math.h
+      sin                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/05-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/08-09/JLB (USNO/AA) Documented "dist" in prolog
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+
+   vector[0] = dist * cos (DEG2RAD * dec) * cos (DEG2RAD * 15.0 * ra);
+   vector[1] = dist * cos (DEG2RAD * dec) * sin (DEG2RAD * 15.0 * ra);
+   vector[2] = dist * sin (DEG2RAD * dec);
 
    return;
 }
 
-/********rad_vel */
+/********starvectors */
 
-void rad_vel (object *cel_object, double *pos, double *vel,
-              double *vel_obs, double d_obs_geo, double d_obs_sun,
-              double d_obj_sun,
+void starvectors (cat_entry *star,
 
-              double *rv)
+                  double *pos, double *vel)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Predicts the radial velocity of the observed object
-      as it would be measured by spectroscopic means.  Radial
-      velocity is here defined as the radial velocity measure (z)
-      times the speed of light.  For a solar system body, it applies
-      to a fictitious emitter at the center of the observed object,
-      assumed massless (no gravitational red shift), and does not
-      in general apply to reflected light.  For stars, it includes
-      all effects, such as gravitational red shift, contained
-      in the catalog barycentric radial velocity measure, a scalar
-      derived from spectroscopy.  Nearby stars with a known kinematic
-      velocity vector (obtained independently of spectroscopy) can be
-      treated like solar system objects.
+      Converts angular quantities for stars to vectors.
 
    REFERENCES:
-      Lindegren & Dravins (2003), Astronomy & Astrophysics 401,
-         1185-1201.
+      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
 
    INPUT
    ARGUMENTS:
-      *cel_object (struct object)
-         Specifies the celestial object of interest (structure defined
-         in novas.h).
-      *pos (double)
-         Geometric position vector of object with respect to observer,
-         corrected for light-time, in AU.
-      *vel (double)
-         Velocity vector of object with respect to solar system
-         barycenter, in AU/day.
-      *vel_obs (double)
-         Velocity vector of observer with respect to solar system
-         barycenter, in AU/day.
-      d_obs_geo (double)
-         Distance from observer to geocenter, in AU.
-      d_obs_sun (double)
-         Distance from observer to Sun, in AU.
-      d_obj_sun (double)
-         Distance from object to Sun, in AU.
+      *star (struct cat_entry)
+         Pointer to catalog entry structure containing ICRS catalog
+         data (defined in novas.h).
 
    OUTPUT
    ARGUMENTS:
-      *rv (double)
-         The observed radial velocity measure times the speed of light,
-         in kilometers/second.
+      pos[3] (double)
+         Position vector, equatorial rectangular coordinates,
+         components in AU.
+      vel[3] (double)
+         Velocity vector, equatorial rectangular coordinates,
+         components in AU/Day.
 
    RETURNED
    VALUE:
@@ -6063,1367 +11487,1587 @@ void rad_vel (object *cel_object, double *pos, double *vel,
 
    GLOBALS
    USED:
-      AU, C, GS, GE      novascon.c
-      DEG2RAD            novascon.c
+      ASEC2RAD, DEG2RAD  novascon.c
+      AU_KM, C           novascon.c
 
    FUNCTIONS
    CALLED:
-      sqrt               math.h
       sin                math.h
       cos                math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-06/JAB (USNO/AA)
-      V2.0/01-07/JAB (USNO/AA): Implement new algorithm
+      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Updated to C programming standards.
+      V1.2/11-03/JAB (USNO/AA) Update to account for parallax in units
+                               of milliarcseconds and proper motion
+                               in milliarcseconds/year.
+      V1.3/01-06/WKP (USNO/AA) Changed 'a[3]' to 'd' and added Doppler
+                               factor.
+      V1.4/02-06/WKP (USNO/AA) Corrected units of C to km/sec.
 
    NOTES:
-      1. All the input arguments are BCRS quantities, expressed
-      with respect to the ICRS axes.  'vel' and 'vel_obs' are kinematic
-      velocities - derived from geometry or dynamics, not spectroscopy.
-      2. If the object is outside the solar system, the algorithm
-      used will be consistent with the IAU definition of stellar
-      radial velocity, specifically, the barycentric radial velocity
-      measure, which is derived from spectroscopy.  In that case,
-      the vector 'vel' can be very approximate -- or, for distant stars
-      or galaxies, zero -- as it will be used only for a small geometric
-      correction that is proportional to proper motion.
-      3. Any of the distances (last three input arguments) can be set to
-      zero (0.0) if the corresponding general relativistic gravitational
-      potential term is not to be evaluated.  These terms generally
-      are important only at the meter/second level.  If 'd_obs_geo' and
-      'd_obs_sun' are both zero, an average value will be used for the
-      relativistic term for the observer, appropriate for an observer on
-      the surface of the Earth.  'd_obj_sun', if given, is used only for
-      solar system objects.
-      4. This function is the C version of NOVAS Fortran routine
-      'radvl'.
+      1. This function is the C version of NOVAS Fortran routine
+      'vectrs'.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_call = 1;
-   short int i;
-
-   static double c2, toms, toms2;
-   double v[3], ra, dec, radvel, posmag, uk[3], v2, vo2, r, phigeo,
-      phisun, rel, rar, dcr, cosdec, du[3], zc, kv, zb1, kvobs, zobs1;
+   double paralx, dist, r, d, cra, sra, cdc, sdc, pmr, pmd, rvl, k;
 
 /*
-   Set up local constants the first time this function is called.
+   If parallax is unknown, undetermined, or zero, set it to 1e-6
+   milliarcsecond, corresponding to a distance of 1 gigaparsec.
 */
 
-   if (first_call)
-   {
-      c2 = C * C;
-      toms = AU / 86400.0;
-      toms2 = toms * toms;
+   paralx = star->parallax;
 
-      first_call = 0;
-   }
+   if (star->parallax <= 0.0)
+      paralx = 1.0e-6;
 
 /*
-   Initialize variables needed for radial velocity calculation.
+   Convert right ascension, declination, and parallax to position vector
+   in equatorial system with units of AU.
 */
 
-   for (i = 0; i < 3; i++)
-   {
-      v[i] = vel[i];
-   }
-
-   switch (cel_object->type)
-   {
-      case 2:     /* Data for objects outside the solar system. */
-         ra = cel_object->star.ra;
-         dec = cel_object->star.dec;
-         radvel = cel_object->star.radialvelocity;
-
-         if (cel_object->star.parallax <= 0.0)
-         {
-            for (i = 0; i < 3; i++)
-            {
-               v[i] = 0.0;
-            }
-         }
-         break;
+   dist = 1.0 / sin (paralx * 1.0e-3 * ASEC2RAD);
+   r = (star->ra) * 15.0 * DEG2RAD;
+   d = (star->dec) * DEG2RAD;
+   cra = cos (r);
+   sra = sin (r);
+   cdc = cos (d);
+   sdc = sin (d);
 
-      default:    /* Data not used for solar system objects. */
-         ra = 0.0;
-         dec = 0.0;
-         radvel = 0.0;
-   }
+   pos[0] = dist * cdc * cra;
+   pos[1] = dist * cdc * sra;
+   pos[2] = dist * sdc;
 
 /*
-   Compute length of position vector = distance to object in AU.
+   Compute Doppler factor, which accounts for change in
+   light travel time to star.
 */
 
-   posmag = sqrt (pos[0] * pos[0] + pos[1] * pos[1] + pos[2] * pos[2]);
+   k = 1.0 / (1.0 - star->radialvelocity / C * 1000.0);
 
 /*
-   Compute unit vector toward object.
+   Convert proper motion and radial velocity to orthogonal components of
+   motion with units of AU/Day.
 */
 
-   for (i = 0; i < 3; i++)
-   {
-      uk[i] = pos[i] / posmag;
-   }
+   pmr = star->promora  / (paralx * 365.25) * k;
+   pmd = star->promodec / (paralx * 365.25) * k;
+   rvl = star->radialvelocity * 86400.0 / AU_KM * k;
 
 /*
-   Compute velocity-squared factors.
+   Transform motion vector to equatorial system.
 */
 
-   v2 =  (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]) * toms2;
-   vo2 = (vel_obs[0] * vel_obs[0] + vel_obs[1] * vel_obs[1] +
-      vel_obs[2] * vel_obs[2]) * toms2;
+   vel[0] = - pmr * sra - pmd * sdc * cra + rvl * cdc * cra;
+   vel[1] =   pmr * cra - pmd * sdc * sra + rvl * cdc * sra;
+   vel[2] =   pmd * cdc + rvl * sdc;
 
+   return;
+}
+
+/********tdb2tt */
+
+void tdb2tt (double tdb_jd,
+
+             double *tt_jd, double *secdiff)
 /*
-   Compute geopotential at observer, unless observer is geocentric.
-*/
+------------------------------------------------------------------------
 
-      r = d_obs_geo * AU;
+   PURPOSE:
+      Computes the Terrestrial Time (TT) or Terrestrial Dynamical Time
+      (TDT) Julian date corresponding to a Barycentric Dynamical Time
+      (TDB) Julian date.
 
-      if (r > 1.0e6)
-      {
-         phigeo = GE / r;
-      }
-       else
-      {
-         phigeo = 0.0;
-      }
+   REFERENCES:
+      Fairhead, L. & Bretagnon, P. (1990) Astron. & Astrophys. 229, 240.
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
 
+   INPUT
+   ARGUMENTS:
+      tdb_jd (double)
+         TDB Julian date.
 
-/*
-   Compute solar potential at observer.
-*/
+   OUTPUT
+   ARGUMENTS:
+      *tt_jd (double)
+         TT Julian date.
+      *secdiff (double)
+         Difference 'tdb_jd'-'tt_jd', in seconds.
 
-      r = d_obs_sun * AU;
+   RETURNED
+   VALUE:
+      None.
 
-      if (r > 1.0e8)
-      {
-         phisun = GS / r;
-      }
-       else
-      {
-         phisun = 0.0;
-      }
+   GLOBALS
+   USED:
+      T0                 novascon.c
 
-/*
-   Compute relativistic potential and velocity factor for observer.
-*/
+   FUNCTIONS
+   CALLED:
+      sin                math.h
 
-   if ((d_obs_geo != 0.0) || (d_obs_sun != 0.0))
-   {
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/07-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
+      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
+      V1.2/06-98/JAB (USNO/AA) Adopt new model (Explanatory Supplement
+                               to the Astronomical Almanac, pp. 42-44
+                               and p. 316.)
+      V1.3/11-03/JAB (USNO/AA) Changed variable names of the input
+                               Julian dates to make more descriptive.
+      V1.4/01-07/JAB (USNO/AA) Adopt Fairhead & Bretagnon expression.
 
-/*
-   Lindegren & Dravins eq. (41), second factor in parentheses.
+   NOTES:
+      1. Expression used in this function is a truncated form of a
+      longer and more precise series given in the first reference.  The
+      result is good to about 10 microseconds.
+      2. This function is the C version of NOVAS Fortran routine
+      'times'.
+------------------------------------------------------------------------
 */
-      rel = 1.0 - (phigeo + phisun) / c2 - 0.5 * vo2 / c2;
-   }
-    else
-   {
+{
+   double t;
+
+   t = (tdb_jd - T0) / 36525.0;
 
 /*
-   Lindegren & Dravins eq. (42), inverse.
+   Expression given in USNO Circular 179, eq. 2.6.
 */
 
-      rel = 1.0 - 1.550e-8;
-   }
+   *secdiff = 0.001657 * sin ( 628.3076 * t + 6.2401)
+            + 0.000022 * sin ( 575.3385 * t + 4.2970)
+            + 0.000014 * sin (1256.6152 * t + 6.1969)
+            + 0.000005 * sin ( 606.9777 * t + 4.0212)
+            + 0.000005 * sin (  52.9691 * t + 0.4444)
+            + 0.000002 * sin (  21.3299 * t + 5.5431)
+            + 0.000010 * t * sin ( 628.3076 * t + 4.2490);
 
-/*
-   Complete radial velocity calculation.
-*/
+   *tt_jd = tdb_jd - *secdiff / 86400.0;
 
-   switch (cel_object->type)
-   {
-      case 2:     /* Objects outside the solar system. */
+    return;
+}
 
-/*
-   For stars, update barycentric radial velocity measure for change
-   in view angle.
-*/
+/********cio_ra */
 
-         rar = ra * 15.0 * DEG2RAD;
-         dcr = dec * DEG2RAD;
-         cosdec = cos (dcr);
-         du[0] = uk[0] - (cosdec * cos (rar));
-         du[1] = uk[1] - (cosdec * sin (rar));
-         du[2] = uk[2] - sin (dcr);
-         zc = radvel * 1.0e3 +
-            (v[0] * du[0] + v[1] * du[1] + v[2] * du[2]) * toms;
+short int cio_ra (double jd_tt, short int accuracy,
 
+                  double *ra_cio)
 /*
-   Compute observed radial velocity measure of a star (inverse of
-   Lindegren & Dravins eq. (41)).
-*/
+------------------------------------------------------------------------
 
-         zb1 = 1.0 + zc / C;
-         kvobs = (uk[0] * vel_obs[0] + uk[1] * vel_obs[1] +
-            uk[2] * vel_obs[2]) * toms;
-         zobs1 = zb1 * rel / (1.0 + kvobs / C);
-         break;
+   PURPOSE:
+      This function computes the true right ascension of the celestial
+      intermediate origin (CIO) at a given TT Julian date.  This is
+      -(equation of the origins).
 
-      case 0:     /* Objects in the solar system */
-      case 1:
-      default:
+   REFERENCES:
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
 
-/*
-   Compute solar potential at object, if within solar system.
-*/
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
-         r = d_obj_sun * AU;
+   OUTPUT
+   ARGUMENTS:
+      *ra_cio (double)
+         Right ascension of the CIO, with respect to the true equinox
+         of date, in hours (+ or -).
 
-         if ((r > 1.0e8) && (r < 1.0e16))
-         {
-            phisun = GS / r;
-         }
-          else
-         {
-            phisun = 0.0;
-         }
+   RETURNED
+   VALUE:
+      (short int)
+         = 0  ... everything OK.
+         = 1  ... invalid value of 'accuracy'.
+         > 10 ... 10 + the error code from function 'cio_location'.
+         > 20 ... 20 + the error code from function 'cio_basis'.
 
-/*
-   Compute observed radial velocity measure of a planet or other
-   object -- including a nearby star -- where kinematic barycentric
-   velocity vector is known and gravitational red shift is negligible
-   (Lindegren & Dravins eq. (40), applied as per S. Klioner private
-   communication (2006)).
-*/
+   GLOBALS
+   USED:
+      None.
 
-         kv = (uk[0] * vel[0] + uk[1] * vel[1] + uk[2] * vel[2]) * toms;
-         zb1 = (1.0 + kv / C ) / (1.0 - phisun / c2 - 0.5 * v2 / c2);
-         kvobs = (uk[0] * vel_obs[0] + uk[1] * vel_obs[1] +
-            uk[2] * vel_obs[2] ) * toms;
-         zobs1 = zb1 * rel / (1.0 + kvobs / C);
-   }
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      cio_ra_ctx         novas.c
 
-/*
-   Convert observed radial velocity measure to kilometers/second.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/01-05/JAB (USNO/AA)
+      V1.1/12-05/WKP (USNO/AA) Corrected minor syntax problems.
+      V1.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.3/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
+      V1.4/10-26/ROA           Use the default 'novas_context'.
 
-   *rv = (zobs1 - 1.0) * C / 1000.0;
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'ciora'.
 
-   return;
+------------------------------------------------------------------------
+*/
+{
+   return cio_ra_ctx (default_context (), jd_tt,accuracy, ra_cio);
 }
 
-/********precession */
+/********cio_ra_ctx */
 
-short int precession (double jd_tdb1, double *pos1, double jd_tdb2,
+short int cio_ra_ctx (novas_context *ctx, double jd_tt,
+                      short int accuracy,
 
-                      double *pos2)
+                      double *ra_cio)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Precesses equatorial rectangular coordinates from one epoch to
-      another.  One of the two epochs must be J2000.0.  The coordinates
-      are referred to the mean dynamical equator and equinox of the two
-      respective epochs.
+      This function is the version of 'cio_ra' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Explanatory Supplement To The Astronomical Almanac, pp. 103-104.
-      Capitaine, N. et al. (2003), Astronomy And Astrophysics 412,
-         pp. 567-586.
-      Hilton, J. L. et al. (2006), IAU WG report, Celest. Mech., 94,
-         pp. 351-367.
+      See function 'cio_ra'.
 
    INPUT
    ARGUMENTS:
-      jd_tdb1 (double)
-         TDB Julian date of first epoch.  See Note 1 below.
-      pos1[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to mean dynamical equator and equinox of first epoch.
-      jd_tdb2 (double)
-         TDB Julian date of second epoch.  See Note 1 below.
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cio_ra'.
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to mean dynamical equator and equinox of second epoch.
+      See function 'cio_ra'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK.
-         = 1 ... Precession not to or from J2000.0; 'jd_tdb1' or 'jd_tdb2'
-                 not 2451545.0.
+      See function 'cio_ra'.
 
    GLOBALS
    USED:
-      T0, ASEC2RAD       novascon.c
+      RAD2DEG, T0        novascon.c
 
    FUNCTIONS
    CALLED:
-      fabs               math.h
-      sin                math.h
-      cos                math.h
+      tdb2tt             novas.c
+      cio_location_ctx   novas.c
+      cio_basis_ctx      novas.c
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+      atan2              math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/03-98/JAB (USNO/AA) Change function type from 'short int' to
-                               'void'.
-      V1.3/12-99/JAB (USNO/AA) Precompute trig terms for greater
-                               efficiency.
-      V2.0/10-03/JAB (USNO/AA) Update function for consistency with
-                               IERS (2000) Conventions.
-      V2.1/01-05/JAB (USNO/AA) Update expressions for the precession
-                               angles (extra significant digits).
-      V2.2/04-06/JAB (USNO/AA) Update model to 2006 IAU convention.
-                               This is model "P03" of second reference.
-      V2.3/03-10/JAB (USNO/AA) Implement 'first-time' to fix bug when
-                                'jd_tdb2' is 'T0' on first call to
-                                function.
+      V1.0/10-26/ROA:           Moved out of 'cio_ra' V1.3.
 
    NOTES:
-      1. Either 'jd_tdb1' or 'jd_tdb2' must be 2451545.0 (J2000.0) TDB.
-      2. This function is the C version of NOVAS Fortran routine
-      'preces'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_time = 1;
    short int error = 0;
+   short int rs;
 
-   static double t_last = 0.0;
-   static double xx, yx, zx, xy, yy, zy, xz, yz, zz;
-   double eps0 = 84381.406;
-   double  t, psia, omegaa, chia, sa, ca, sb, cb, sc, cc, sd, cd;
+   double unitx[3] = {1.0, 0.0, 0.0};
+   double jd_tdb, t, secdif, x[3], y[3], z[3], w1[3], w2[3],
+       eq[3], az, r_cio;
 
 /*
-   Check to be sure that either 'jd_tdb1' or 'jd_tdb2' is equal to T0.
+   Check for valid value of 'accuracy'.
 */
 
-   if ((jd_tdb1 != T0) && (jd_tdb2 != T0))
+   if ((accuracy < 0) || (accuracy > 1))
       return (error = 1);
 
 /*
-   't' is time in TDB centuries between the two epochs.
+   'jd_tdb' is the TDB Julian date.
 */
 
-   t = (jd_tdb2 - jd_tdb1) / 36525.0;
-
-   if (jd_tdb2 == T0)
-      t = -t;
-
-   if ((fabs (t - t_last) >= 1.0e-15) || (first_time == 1))
-   {
+      jd_tdb = jd_tt;
+      tdb2tt (jd_tdb, &t,&secdif);
+      jd_tdb = jd_tt + secdif / 86400.0;
 
 /*
-   Numerical coefficients of psi_a, omega_a, and chi_a, along with
-   epsilon_0, the obliquity at J2000.0, are 4-angle formulation from
-   Capitaine et al. (2003), eqs. (4), (37), & (39).
+   Obtain the basis vectors, in the GCRS, for the celestial intermediate
+   system defined by the CIP (in the z direction) and the CIO (in the
+   x direction).
 */
 
-      psia   = ((((-    0.0000000951  * t
-                   +    0.000132851 ) * t
-                   -    0.00114045  ) * t
-                   -    1.0790069   ) * t
-                   + 5038.481507    ) * t;
-
-      omegaa = ((((+    0.0000003337  * t
-                   -    0.000000467 ) * t
-                   -    0.00772503  ) * t
-                   +    0.0512623   ) * t
-                   -    0.025754    ) * t + eps0;
-
-      chia   = ((((-    0.0000000560  * t
-                   +    0.000170663 ) * t
-                   -    0.00121197  ) * t
-                   -    2.3814292   ) * t
-                   +   10.556403    ) * t;
+   if ((error = cio_location_ctx (ctx,jd_tdb,accuracy, &r_cio,
+      &rs)) != 0)
+   {
+      *ra_cio = 0.0;
+      return (error += 10);
+   }
 
-      eps0 = eps0 * ASEC2RAD;
-      psia = psia * ASEC2RAD;
-      omegaa = omegaa * ASEC2RAD;
-      chia = chia * ASEC2RAD;
+   if ((error = cio_basis_ctx (ctx,jd_tdb,r_cio,rs,accuracy, x,y,
+      z)) != 0)
+   {
+      return (error += 20);
+   }
 
-      sa = sin (eps0);
-      ca = cos (eps0);
-      sb = sin (-psia);
-      cb = cos (-psia);
-      sc = sin (-omegaa);
-      cc = cos (-omegaa);
-      sd = sin (chia);
-      cd = cos (chia);
 /*
-   Compute elements of precession rotation matrix equivalent to
-   R3(chi_a) R1(-omega_a) R3(-psi_a) R1(epsilon_0).
+   Compute the direction of the true equinox in the GCRS.
 */
 
-      xx =  cd * cb - sb * sd * cc;
-      yx =  cd * sb * ca + sd * cc * cb * ca - sa * sd * sc;
-      zx =  cd * sb * sa + sd * cc * cb * sa + ca * sd * sc;
-      xy = -sd * cb - sb * cd * cc;
-      yy = -sd * sb * ca + cd * cc * cb * ca - sa * cd * sc;
-      zy = -sd * sb * sa + cd * cc * cb * sa + ca * cd * sc;
-      xz =  sb * sc;
-      yz = -sc * cb * ca - sa * cc;
-      zz = -sc * cb * sa + cc * ca;
-
-      t_last = t;
-      first_time = 0;
-   }
-
-   if (jd_tdb2 == T0)
-   {
+   nutation_ctx (ctx,jd_tdb,-1,accuracy,unitx, w1);
+   precession_ctx (ctx,jd_tdb,w1,T0, w2);
+   frame_tie_ctx (ctx,w2,-1, eq);
 
 /*
-   Perform rotation from epoch to J2000.0.
+   Compute the RA-like coordinate of the true equinox in the celestial
+   intermediate system.
 */
-      pos2[0] = xx * pos1[0] + xy * pos1[1] + xz * pos1[2];
-      pos2[1] = yx * pos1[0] + yy * pos1[1] + yz * pos1[2];
-      pos2[2] = zx * pos1[0] + zy * pos1[1] + zz * pos1[2];
-   }
-    else
-   {
+
+   az = atan2 (eq[0] * y[0] + eq[1] * y[1] + eq[2] * y[2],
+      eq[0] * x[0] + eq[1] * x[1] + eq[2] * x[2]) * RAD2DEG;
 
 /*
-   Perform rotation from J2000.0 to epoch.
+   The RA of the CIO is minus this coordinate.
 */
 
-      pos2[0] = xx * pos1[0] + yx * pos1[1] + zx * pos1[2];
-      pos2[1] = xy * pos1[0] + yy * pos1[1] + zy * pos1[2];
-      pos2[2] = xz * pos1[0] + yz * pos1[1] + zz * pos1[2];
-   }
+   *ra_cio = -az / 15.0;
 
-   return (error = 0);
+   return (error);
 }
 
-/********nutation */
+/********cio_location */
 
-void nutation (double jd_tdb, short int direction, short int accuracy,
-               double *pos,
+short int cio_location (double jd_tdb, short int accuracy,
 
-               double *pos2)
+                        double *ra_cio, short int *ref_sys)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Nutates equatorial rectangular coordinates from mean equator and
-      equinox of epoch to true equator and equinox of epoch. Inverse
-      transformation may be applied by setting flag 'direction'.
+      This function returns the location of the celestial
+      intermediate origin (CIO) for a given Julian date, as a
+      right ascension with respect to either the GCRS (geocentric ICRS)
+      origin or the true equinox of date.  The CIO is always located on
+      the true equator (= intermediate equator) of date.
 
    REFERENCES:
-      Explanatory Supplement To The Astronomical Almanac, pp. 114-115.
+      None.
 
    INPUT
    ARGUMENTS:
       jd_tdb (double)
-         TDB Julian date of epoch.
-      direction (short int)
-         Flag determining 'direction' of transformation;
-            direction  = 0 transformation applied, mean to true.
-            direction != 0 inverse transformation applied, true to mean.
+         TDB Julian date.
       accuracy (short int)
          Selection for accuracy
             = 0 ... full accuracy
             = 1 ... reduced accuracy
-      pos[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to mean equator and equinox of epoch.
 
    OUTPUT
    ARGUMENTS:
-      pos2[3] (double)
-         Position vector, geocentric equatorial rectangular coordinates,
-         referred to true equator and equinox of epoch.
+      *ra_cio (double)
+         Right ascension of the CIO, in hours.
+      *ref_sys (short int)
+         Reference system in which right ascension is given
+            = 1 ... GCRS
+            = 2 ... True equator and equinox of date.
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         = 0  ... everything OK.
+         = 1  ... unable to allocate memory for the 'cio' array.
+         > 10 ... 10 + the error code from function 'cio_array'.
 
    GLOBALS
    USED:
-      DEG2RAD, ASEC2RAD  novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      e_tilt             novas.c
-      cos                math.h
-      sin                math.h
+      default_context    novas.c
+      cio_location_ctx   novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/11-03/JAB (USNO/AA) Remove returned value.
-      V1.3/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.0/07-06/JAB (USNO/AA)
+      V1.1/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'nutate'.
+      1. If an external file of CIO right ascensions is available,
+      it will be used and 'ref_sys' will be set to 1.  Otherwise an
+      internal computation will be used and 'ref_sys' will be set to 2.
+      2. The external binary file of CIO right ascensions is assumed
+      to be named 'cio_ra.bin'.  Utility program 'cio_file.c', provided
+      with the NOVAS-C package, creates this file from a text file also
+      provided with NOVAS-C.
+      3. This function is the C version of NOVAS Fortran routine
+      'cioloc'.
 
 ------------------------------------------------------------------------
 */
 {
-   double cobm, sobm, cobt, sobt, cpsi, spsi, xx, yx, zx, xy, yy, zy,
-      xz, yz, zz, oblm, oblt, eqeq, psi, eps;
-
-/*
-   Call 'e_tilt' to get the obliquity and nutation angles.
-*/
-
-   e_tilt (jd_tdb,accuracy, &oblm,&oblt,&eqeq,&psi,&eps);
-
-   cobm = cos (oblm * DEG2RAD);
-   sobm = sin (oblm * DEG2RAD);
-   cobt = cos (oblt * DEG2RAD);
-   sobt = sin (oblt * DEG2RAD);
-   cpsi = cos (psi * ASEC2RAD);
-   spsi = sin (psi * ASEC2RAD);
-
-/*
-   Nutation rotation matrix follows.
-*/
-
-   xx = cpsi;
-   yx = -spsi * cobm;
-   zx = -spsi * sobm;
-   xy = spsi * cobt;
-   yy = cpsi * cobm * cobt + sobm * sobt;
-   zy = cpsi * sobm * cobt - cobm * sobt;
-   xz = spsi * sobt;
-   yz = cpsi * cobm * sobt - sobm * cobt;
-   zz = cpsi * sobm * sobt + cobm * cobt;
-
-   if (!direction)
-   {
-
-/*
-   Perform rotation.
-*/
-
-      pos2[0] = xx * pos[0] + yx * pos[1] + zx * pos[2];
-      pos2[1] = xy * pos[0] + yy * pos[1] + zy * pos[2];
-      pos2[2] = xz * pos[0] + yz * pos[1] + zz * pos[2];
-   }
-    else
-   {
-
-/*
-   Perform inverse rotation.
-*/
-
-      pos2[0] = xx * pos[0] + xy * pos[1] + xz * pos[2];
-      pos2[1] = yx * pos[0] + yy * pos[1] + yz * pos[2];
-      pos2[2] = zx * pos[0] + zy * pos[1] + zz * pos[2];
-   }
-
-   return;
+   return cio_location_ctx (default_context (), jd_tdb,accuracy,
+      ra_cio,ref_sys);
 }
 
-/********nutation_angles */
+/********cio_location_ctx */
 
-void nutation_angles (double t, short int accuracy,
+short int cio_location_ctx (novas_context *ctx, double jd_tdb,
+                            short int accuracy,
 
-                      double *dpsi, double *deps)
+                            double *ra_cio, short int *ref_sys)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function returns the values for nutation in longitude and
-      nutation in obliquity for a given TDB Julian date.  The nutation
-      model selected depends upon the input value of 'accuracy'.  See
-      notes below for important details.
+      This function is the version of 'cio_location' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
 
    REFERENCES:
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      See function 'cio_location'.
 
    INPUT
    ARGUMENTS:
-      t (double)
-         TDB time in Julian centuries since J2000.0
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cio_location'.
 
    OUTPUT
    ARGUMENTS:
-      dpsi (double)
-         Nutation in longitude in arcseconds.
-      deps (double)
-         Nutation in obliquity in arcseconds.
+      See function 'cio_location'.
 
    RETURNED
    VALUE:
-      None.
+      See function 'cio_location'.
 
    GLOBALS
    USED:
-      T0, ASEC2RAD       novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      iau2000a           nutation.c
-      iau2000b           nutation.c
-      nu2000k            nutation.c
+      cio_array_ctx      novas.c
+      ira_equinox_ctx    novas.c
+      fopen              stdio.h
+      fclose             stdio.h
+      fabs               math.h
+      calloc             stdlib.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
-      V1.1/01-06/WKP (USNO/AA): Changed 'mode' to 'accuracy'.
-      V1.2/02-06/WKP (USNO/AA): Fixed units bug.
-      V1.3/01-07/JAB (USNO/AA): Implemented 'low_acc_choice' construct.
+      V1.0/10-26/ROA:           Moved out of 'cio_location' V1.0.
 
    NOTES:
-      1. This function selects the nutation model depending first upon
-      the input value of 'accuracy'.  If 'accuracy' = 0 (full accuracy),
-      the IAU 2000A nutation model is used.  If 'accuracy' = 1 (reduced
-      accuracy, the model used depends upon the value of local
-      variable 'low_acc_choice', which is set below.
-      2. If local variable 'low_acc_choice' = 1 (the default), a
-      specially truncated version of IAU 2000A, called 'NU2000K' is
-      used.  If 'low_acc_choice' = 2, the IAU 2000B nutation model is
-      used.
-      3.  See the prologs of the nutation functions in file 'nutation.c'
-      for details concerning the models.
-      4. This function is the C version of NOVAS Fortran routine
-      'nod'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
+   cio_location_saved *sv = &ctx->cio_location;
 
-/*
-   Set the value of 'low_acc_choice' according to the rules explained
-   under NOTES in the prolog.
-*/
+   short int error = 0;
+
+   long int n_pts = 6;
+   long int i, j;
 
-   short int low_acc_choice = 1;
+   double p, eq_origins;
 
-   double t1;
+   size_t cio_size;
 
-   t1 = t * 36525.0;
+   FILE *cio_file;
 
 /*
-   High accuracy mode -- use IAU 2000A.
+   Check if the input external binary file exists and can be read.
 */
 
-   if (accuracy == 0)
+   if (sv->first_call)
    {
-      iau2000a (T0,t1, dpsi,deps);
+      if ((cio_file = fopen ("cio_ra.bin", "rb")) == NULL)
+      {
+         sv->use_file = 0;
+      }
+       else
+      {
+         sv->use_file = 1;
+         fclose (cio_file);
+      }
    }
 
 /*
-   Low accuracy mode -- model depends upon value of 'low_acc_choice'.
+   Check if previously computed RA value can be used.
 */
 
-    else
+   if ((fabs (jd_tdb - sv->t_last) <= 1.0e-8))
    {
-      switch (low_acc_choice)
-      {
-         case 2:   /*  use IAU 2000B */
-            iau2000b (T0,t1, dpsi,deps);
-            break;
-
-         case 1:   /*  use NU2000K  */
-         default:
-            nu2000k (T0,t1, dpsi,deps);
-      }
+      *ra_cio = sv->ra_last;
+      *ref_sys = sv->ref_sys_last;
+      return (error = 0);
    }
 
 /*
-   Convert output to arcseconds.
+   Compute the RA of the CIO.
 */
 
-   *dpsi /= ASEC2RAD;
-   *deps /= ASEC2RAD;
-
-   return;
-}
+   switch (sv->use_file)
+   {
 
-/********fund_args */
+/*
+   -----------------------------
+   Interpolate values from file.
+   -----------------------------
+*/
 
-void fund_args (double t,
+      case 1:
 
-                double a[5])
 /*
-------------------------------------------------------------------------
+   Allocate memory for the array 'cio'.  This array contains the values
+   to be interpolated, extracted from the CIO file.
+*/
 
-   PURPOSE:
-      To compute the fundamental arguments (mean elements) of the Sun
-      and Moon.
+         if (sv->first_call)
+         {
+            cio_size = sizeof (ra_of_cio);
+            sv->cio = (ra_of_cio *) calloc ((size_t) n_pts, cio_size);
+            if (sv->cio == NULL)
+               return (error = 1);
+             else
+               sv->first_call = 0;
+         }
 
-   REFERENCES:
-      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
-         esp. Sections 3.4-3.5.
+/*
+   Get array of values to interpolate.
+*/
 
-   INPUT
-   ARGUMENTS:
-      t (double)
-         TDB time in Julian centuries since J2000.0
+         if ((error = cio_array_ctx (ctx,jd_tdb,n_pts, sv->cio)) != 0)
+         {
+            *ra_cio = 0.0;
+            return (error += 10);
+         }
 
-   OUTPUT
-   ARGUMENTS:
-      a[5] (double)
-         Fundamental arguments, in radians:
-          a[0] = l (mean anomaly of the Moon)
-          a[1] = l' (mean anomaly of the Sun)
-          a[2] = F (mean argument of the latitude of the Moon)
-          a[3] = D (mean elongation of the Moon from the Sun)
-          a[4] = Omega (mean longitude of the Moon's ascending node);
-                 from Simon section 3.4(b.3),
-                 precession = 5028.8200 arcsec/cy)
+/*
+   Perform Lagrangian interpolation for the RA at 'tdb_jd'.
+*/
 
-   RETURNED
-   VALUE:
-      None.
+         *ra_cio = 0.0;
+         for (j = 0L; j < n_pts; j++)
+         {
+            p = 1.0;
+            for (i = 0L; i < n_pts; i++)
+            {
+               if (i != j)
+                  p *= ((jd_tdb - sv->cio[i].jd_tdb) /
+                       (sv->cio[j].jd_tdb - sv->cio[i].jd_tdb));
+            }
+            *ra_cio += (p * sv->cio[j].ra_cio);
+         }
 
-   GLOBALS
-   USED:
-      ASEC2RAD, ASEC360  novascon.c
+         *ra_cio /= 54000.0;
+         *ref_sys = 1;
 
-   FUNCTIONS
-   CALLED:
-      fmod               math.h
+         break;
 
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/10-97/JAB (USNO/AA)
-      V1.1/07-98/JAB (USNO/AA): Place arguments in the range 0-TWOPI
-                                radians.
-      V1.2/09-03/JAB (USNO/AA): Incorporate function 'norm_ang'.
-      V1.3/11-03/JAB (USNO/AA): Update with Simon et al. expressions.
-      V1.4/01-06/JAB (USNO/AA): Remove function 'norm_ang'; rewrite for
-                                consistency with Fortran.
-      V1.5/02-11/WKP (USNO/AA): Clarified a[4] description in prolog.
+/*
+   -------------------------
+   Use internal computation.
+   -------------------------
+*/
 
-   NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'funarg'.
+      case 0:
 
-------------------------------------------------------------------------
+/*
+   Compute equation of the origins.
 */
-{
 
-   a[0] = fmod (485868.249036 +
-             t * (1717915923.2178 +
-             t * (        31.8792 +
-             t * (         0.051635 +
-             t * (       - 0.00024470)))), ASEC360) * ASEC2RAD;
+         if (sv->first_call)
+            sv->first_call = 0;
 
-   a[1] = fmod (1287104.79305 +
-             t * ( 129596581.0481 +
-             t * (       - 0.5532 +
-             t * (         0.000136 +
-             t * (       - 0.00001149)))), ASEC360) * ASEC2RAD;
+         eq_origins = ira_equinox_ctx (ctx,jd_tdb,1,accuracy);
 
-   a[2] = fmod (335779.526232 +
-             t * (1739527262.8478 +
-             t * (      - 12.7512 +
-             t * (      -  0.001037 +
-             t * (         0.00000417)))), ASEC360) * ASEC2RAD;
+         *ra_cio = -eq_origins;
+         *ref_sys = 2;
 
-   a[3] = fmod (1072260.70369 +
-             t * (1602961601.2090 +
-             t * (       - 6.3706 +
-             t * (         0.006593 +
-             t * (       - 0.00003169)))), ASEC360) * ASEC2RAD;
+         break;
+   }
 
-   a[4] = fmod (450160.398036 +
-             t * ( - 6962890.5431 +
-             t * (         7.4722 +
-             t * (         0.007702 +
-             t * (       - 0.00005939)))), ASEC360) * ASEC2RAD;
+   sv->t_last = jd_tdb;
+   sv->ra_last = *ra_cio;
+   sv->ref_sys_last = *ref_sys;
 
-   return;
+   return (error);
 }
 
-/********mean_obliq */
+/********cio_basis */
 
-double mean_obliq (double jd_tdb)
+short int cio_basis (double jd_tdb, double ra_cio, short int ref_sys,
+                     short int accuracy,
+
+                     double *x, double *y, double *z)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To compute the mean obliquity of the ecliptic.
+      To compute the orthonormal basis vectors, with
+      respect to the GCRS (geocentric ICRS), of the celestial
+      intermediate system defined by the celestial intermediate pole
+      (CIP) (in the z direction) and the celestial intermediate origin
+      (CIO) (in the x direction).  A TDB Julian date and the right
+      ascension of the CIO at that date is required as input.  The
+      right ascension of the CIO can be with respect to either the
+      GCRS origin or the true equinox of date -- different algorithms
+      are used in the two cases.
 
    REFERENCES:
-      Capitaine et al. (2003), Astronomy and Astrophysics 412, 567-586.
+      Kaplan, G. (2005), US Naval Observatory Circular 179.
 
    INPUT
    ARGUMENTS:
       jd_tdb (double)
-         TDB Julian Date.
+         TDB Julian date of epoch.
+      ra_cio (double)
+         Right ascension of the CIO at epoch (hours).
+      ref_sys (short int)
+         Reference system in which right ascension is given (output
+         from function 'cio_location')
+            = 1 ... GCRS
+            = 2 ... True equator and equinox of date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
    OUTPUT
    ARGUMENTS:
-      None.
+      *x (double)
+         Unit vector toward the CIO, equatorial rectangular
+         coordinates, referred to the GCRS.
+      *y (double)
+         Unit vector toward the y-direction, equatorial rectangular
+         coordinates, referred to the GCRS.
+      *z (double)
+         Unit vector toward north celestial pole (CIP), equatorial
+         rectangular coordinates, referred to the GCRS.
 
    RETURNED
    VALUE:
-      (double)
-         Mean obliquity of the ecliptic in arcseconds.
+      (short int)
+         = 0 ... everything OK.
+         = 1 ... invalid value of input variable 'ref_sys'.
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      None.
+      default_context    novas.c
+      cio_basis_ctx      novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/12-04/JAB (USNO/AA)
-      V2.0/04-06/JAB (USNO/AA) Update the expression for mean obliquity
-                               using data from the reference.
+      V1.0/08-04/JAB (USNO/AA)
+      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
+      V1.2/07-06/JAB (USNA/AA) Incorporate code to use 'ref_sys' input.
+      V1.3/06-08/WKP (USNO/AA) Changed value of direction argument in
+                               calls to 'nutation' from 1 to -1 for
+                               consistency.
+      V1.4/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      None.
+      1. This function effectively constructs the matrix C in eq. (3)
+      of the reference.
+      2. This function is the C version of NOVAS Fortran routine
+      'ciobas'.
 
 ------------------------------------------------------------------------
 */
 {
-   double t, epsilon;
-
-/*
-   Compute time in Julian centuries from epoch J2000.0.
-*/
-
-   t = (jd_tdb - T0) / 36525.0;
-
-/*
-   Compute the mean obliquity in arcseconds.  Use expression from the
-   reference's eq. (39) with obliquity at J2000.0 taken from eq. (37)
-   or Table 8.
-*/
-
-   epsilon = (((( -  0.0000000434   * t
-                  -  0.000000576  ) * t
-                  +  0.00200340   ) * t
-                  -  0.0001831    ) * t
-                  - 46.836769     ) * t + 84381.406;
-
-   return (epsilon);
+   return cio_basis_ctx (default_context (),
+      jd_tdb,ra_cio,ref_sys,accuracy, x,y,z);
 }
 
-/********vector2radec */
+/********cio_basis_ctx */
 
-short int vector2radec (double *pos,
+short int cio_basis_ctx (novas_context *ctx, double jd_tdb,
+                         double ra_cio, short int ref_sys,
+                         short int accuracy,
 
-                        double *ra, double *dec)
+                         double *x, double *y, double *z)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Converts an vector in equatorial rectangular coordinates to
-      equatorial spherical coordinates.
+      This function is the version of 'cio_basis' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      See function 'cio_basis'.
 
    INPUT
    ARGUMENTS:
-      pos[3] (double)
-         Position vector, equatorial rectangular coordinates.
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cio_basis'.
 
    OUTPUT
    ARGUMENTS:
-      *rightascension (double)
-         Right ascension in hours.
-      *declination (double)
-         Declination in degrees.
+      See function 'cio_basis'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... Everything OK.
-         = 1 ... All vector components are zero; 'ra' and 'dec' are
-                 indeterminate.
-         = 2 ... Both pos[0] and pos[1] are zero, but pos[2] is nonzero;
-                 'ra' is indeterminate.
+      See function 'cio_basis'.
+
    GLOBALS
    USED:
-      ASEC2RAD           novascon.c
+      T0, DEG2RAD        novascon.c
 
    FUNCTIONS
    CALLED:
+      nutation_ctx       novas.c
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+      fabs               math.h
+      sin                math.h
+      cos                math.h
       sqrt               math.h
-      atan2              math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/01-04/JAB (USNO/AA) Remove calls to 'pow'.
+      V1.0/10-26/ROA:           Moved out of 'cio_basis' V1.3.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'angles'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   double xyproj;
+   cio_basis_saved *sv = &ctx->cio_basis;
 
-   xyproj = sqrt (pos[0] * pos[0] + pos[1] * pos[1]);
-   if ((xyproj == 0.0) && (pos[2] == 0))
+   short int error = 0;
+   short int i;
+
+   double z0[3] = {0.0, 0.0, 1.0};
+   double w0[3], w1[3], w2[3], sinra, cosra, xmag;
+
+/*
+   Compute unit vector z toward celestial pole.
+*/
+
+   if (((fabs (jd_tdb - sv->t_last) > 1.0e-8)) ||
+      (ref_sys != sv->ref_sys_last))
    {
-      *ra = 0.0;
-      *dec = 0.0;
-      return 1;
+      nutation_ctx (ctx,jd_tdb,-1,accuracy,z0, w1);
+      precession_ctx (ctx,jd_tdb,w1,T0, w2);
+      frame_tie_ctx (ctx,w2,-1, sv->zz);
+
+      sv->t_last = jd_tdb;
+      sv->ref_sys_last = ref_sys;
    }
-    else if (xyproj == 0.0)
+    else
    {
-      *ra = 0.0;
-      if (pos[2] < 0.0)
-         *dec = -90.0;
-       else
-         *dec = 90.0;
-      return 2;
+      for (i = 0; i < 3; i++)
+      {
+         x[i] = sv->xx[i];
+         y[i] = sv->yy[i];
+         z[i] = sv->zz[i];
+      }
+      return (error);
+   }
+
+/*
+   Now compute unit vectors x and y.  Method used depends on the
+   reference system in which right ascension of the CIO is given.
+*/
+
+   switch (ref_sys)
+   {
+
+/*
+   ----------------------------
+   RA of CIO expressed in GCRS.
+   ----------------------------
+*/
+
+      case 1:
+
+/*
+   Compute vector x toward CIO in GCRS.
+*/
+
+         sinra = sin (ra_cio * 15.0 * DEG2RAD);
+         cosra = cos (ra_cio * 15.0 * DEG2RAD);
+         sv->xx[0] =  sv->zz[2] * cosra;
+         sv->xx[1] =  sv->zz[2] * sinra;
+         sv->xx[2] = -sv->zz[0] * cosra - sv->zz[1] * sinra;
+
+/*
+   Normalize vector x.
+*/
+
+         xmag = sqrt (sv->xx[0] * sv->xx[0] + sv->xx[1] * sv->xx[1] +
+                      sv->xx[2] * sv->xx[2]);
+         sv->xx[0] /= xmag;
+         sv->xx[1] /= xmag;
+         sv->xx[2] /= xmag;
+
+/*
+   Compute unit vector y orthogonal to x and z (y = z cross x).
+*/
+
+         sv->yy[0] = sv->zz[1] * sv->xx[2] - sv->zz[2] * sv->xx[1];
+         sv->yy[1] = sv->zz[2] * sv->xx[0] - sv->zz[0] * sv->xx[2];
+         sv->yy[2] = sv->zz[0] * sv->xx[1] - sv->zz[1] * sv->xx[0];
+
+         break;
+
+/*
+   ----------------------------------------------------------
+   RA of CIO expressed in equator-and-equinox of date system.
+   ----------------------------------------------------------
+*/
+
+      case 2:
+
+/*
+   Construct unit vector toward CIO in equator-and-equinox-of-date
+   system.
+*/
+
+          w0[0] = cos (ra_cio * 15.0 * DEG2RAD);
+          w0[1] = sin (ra_cio * 15.0 * DEG2RAD);
+          w0[2] = 0.0;
+
+/*
+   Rotate the vector into the GCRS to form unit vector x.
+*/
+
+          nutation_ctx (ctx,jd_tdb,-1,accuracy,w0, w1);
+          precession_ctx (ctx,jd_tdb,w1,T0, w2);
+          frame_tie_ctx (ctx,w2,-1, sv->xx);
+
+/*
+   Compute unit vector y orthogonal to x and z (y = z cross x).
+*/
+
+          sv->yy[0] = sv->zz[1] * sv->xx[2] - sv->zz[2] * sv->xx[1];
+          sv->yy[1] = sv->zz[2] * sv->xx[0] - sv->zz[0] * sv->xx[2];
+          sv->yy[2] = sv->zz[0] * sv->xx[1] - sv->zz[1] * sv->xx[0];
+
+          break;
+
+/*
+   ---------------------------
+   Invalid value of 'ref_sys'.
+   ---------------------------
+*/
+
+      default:
+
+         for (i = 0; i < 3; i++)
+         {
+            sv->xx[i] = 0.0;
+            sv->yy[i] = 0.0;
+            sv->zz[i] = 0.0;
+         }
+
+         error = 1;
+         break;
    }
-    else
-   {
-      *ra = atan2 (pos[1], pos[0]) / ASEC2RAD / 54000.0;
-      *dec = atan2 (pos[2], xyproj) / ASEC2RAD / 3600.0;
 
-      if (*ra < 0.0)
-         *ra += 24.0;
+/*
+   Load the x, y, and z arrays.
+*/
+
+   for (i = 0; i < 3; i++)
+   {
+      x[i] = sv->xx[i];
+      y[i] = sv->yy[i];
+      z[i] = sv->zz[i];
    }
-   return 0;
+
+   return (error);
 }
 
-/********radec2vector */
+/********cio_array */
 
-void radec2vector (double ra, double dec, double dist,
+short int cio_array (double jd_tdb, long int n_pts,
 
-                   double *vector)
+                     ra_of_cio *cio)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Converts equatorial spherical coordinates to a vector (equatorial
-      rectangular coordinates).
+      Given an input TDB Julian date and the number of data points
+      desired, this function returns a set of Julian dates and
+      corresponding values of the GCRS right ascension of the celestial
+      intermediate origin (CIO).  The range of dates is centered (at
+      least approximately) on the requested date.  The function obtains
+      the data from an external data file.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      ra (double)
-         Right ascension (hours).
-      dec (double)
-         Declination (degrees).
-      dist (double)
-         Distance (AU)
+      jd_tdb (double)
+         TDB Julian date.
+      n_pts (long int)
+         Number of Julian dates and right ascension values requested
+         (not less than 2 or more than 20).
 
    OUTPUT
    ARGUMENTS:
-      vector[3] (double)
-         Position vector, equatorial rectangular coordinates (AU).
+      *cio (struct ra_of_cio)
+         An time series (array) of the right ascension of the Celestial
+         Intermediate Origin (CIO) with respect to the GCRS (structure
+         defined in novas.h).
 
    RETURNED
    VALUE:
       (short int)
-         = 0 ... Everything OK.
+         = 0 ... everything OK
+         = 1 ... error opening the 'cio_ra.bin' file.
+         = 2 ... 'jd_tdb' not in the range of the CIO file.
+         = 3 ... 'n_pts' out of range.
+         = 4 ... unable to allocate memory for the internal 't' array.
+         = 5 ... unable to allocate memory for the internal 'ra' array.
+         = 6 ... 'jd_tdb' is too close to either end of the CIO file;
+                 unable to put 'n_pts' data points into the output
+                 structure.
 
    GLOBALS
    USED:
-      DEG2RAD            novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      cos                math.h
-      sin                math.h
+      default_context    novas.c
+      cio_array_ctx      novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/05-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/08-09/JLB (USNO/AA) Documented "dist" in prolog
+      V1.0/09-04/JAB (USNO/AA)
+      V1.1/12-05/WKP (USNO/AA) Changed struct type from 'cio_ra' to
+                               'ra_of_cio' to avoid conflicts.
+      V1.2/02-08/JAB (USNO/AA) Fix file-read strategy "Case 2" and
+                               improve documentation.
+      V1.3/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      None.
+      1. This function assumes that binary, random-access file
+      'cio_ra.bin' has been created and is in the same directory as
+      your executable.  This file is created by program 'cio_file.c',
+      included in the NOVAS-C package.  On the first call to this
+      function, file 'cio_ra.bin' is opened in read mode.
 
 ------------------------------------------------------------------------
 */
 {
-
-   vector[0] = dist * cos (DEG2RAD * dec) * cos (DEG2RAD * 15.0 * ra);
-   vector[1] = dist * cos (DEG2RAD * dec) * sin (DEG2RAD * 15.0 * ra);
-   vector[2] = dist * sin (DEG2RAD * dec);
-
-   return;
+   return cio_array_ctx (default_context (), jd_tdb,n_pts, cio);
 }
 
-/********starvectors */
+/********cio_array_ctx */
 
-void starvectors (cat_entry *star,
+short int cio_array_ctx (novas_context *ctx, double jd_tdb,
+                         long int n_pts,
 
-                  double *pos, double *vel)
+                         ra_of_cio *cio)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Converts angular quantities for stars to vectors.
+      This function is the version of 'cio_array' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Kaplan, G. H. et. al. (1989). Astron. Journ. 97, 1197-1210.
+      See function 'cio_array'.
 
    INPUT
    ARGUMENTS:
-      *star (struct cat_entry)
-         Pointer to catalog entry structure containing ICRS catalog
-         data (defined in novas.h).
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'cio_array'.
 
    OUTPUT
    ARGUMENTS:
-      pos[3] (double)
-         Position vector, equatorial rectangular coordinates,
-         components in AU.
-      vel[3] (double)
-         Velocity vector, equatorial rectangular coordinates,
-         components in AU/Day.
+      See function 'cio_array'.
 
    RETURNED
    VALUE:
-      None.
+      See function 'cio_array'.
 
    GLOBALS
    USED:
-      ASEC2RAD, DEG2RAD  novascon.c
-      AU_KM, C           novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sin                math.h
-      cos                math.h
+      fopen              stdio.h
+      fread              stdio.h
+      fclose             stdio.h
+      abs                math.h
+      free               stdlib.h
+      calloc             stdlib.h
+      fseek              stdio.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-93/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Updated to C programming standards.
-      V1.2/11-03/JAB (USNO/AA) Update to account for parallax in units
-                               of milliarcseconds and proper motion
-                               in milliarcseconds/year.
-      V1.3/01-06/WKP (USNO/AA) Changed 'a[3]' to 'd' and added Doppler
-                               factor.
-      V1.4/02-06/WKP (USNO/AA) Corrected units of C to km/sec.
+      V1.0/10-26/ROA:           Moved out of 'cio_array' V1.2.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'vectrs'.
+      1. The CIO file and the 't' and 'ra' arrays belong to 'ctx'; they
+      are released by 'novas_context_free'.  After an allocation
+      failure they are released at once, and the file is opened again
+      on the next call.
 
 ------------------------------------------------------------------------
 */
 {
-   double paralx, dist, r, d, cra, sra, cdc, sdc, pmr, pmd, rvl, k;
+   cio_array_saved *sv = &ctx->cio_array;
+
+   short int error = 0;
+
+   long int min_pts = 2;
+   long int max_pts = 20;
+   long int  del_n_pts, index_rec, half_int, lo_limit, hi_limit,
+      del_index, abs_del_index, bytes_to_lo, n_swap, n_read, i, j;
+
+   long int header_size, record_size;
+
+   double t_temp, ra_temp;
+
+   size_t double_size, long_size;
 
 /*
-   If parallax is unknown, undetermined, or zero, set it to 1e-6
-   milliarcsecond, corresponding to a distance of 1 gigaparsec.
+   Set the sizes of the file header and data records, open the CIO file,
+   and read the file header on the first call to this function.
+*/
+
+   double_size = sizeof (double);
+   long_size = sizeof (long int);
+   header_size = (long) ((size_t) 3 * double_size + long_size);
+   record_size = (long) ((size_t) 2 * double_size);
+
+   if (sv->first_call)
+   {
+
+/*
+   Open the input (binary, random-access) file.
+*/
+
+      if ((sv->cio_file = fopen ("cio_ra.bin", "rb")) == NULL)
+         return (error = 1);
+
+/*
+   Read the file header.
+*/
+
+      fread (&sv->jd_beg, double_size, (size_t) 1, sv->cio_file);
+      fread (&sv->jd_end, double_size, (size_t) 1, sv->cio_file);
+      fread (&sv->t_int, double_size, (size_t) 1, sv->cio_file);
+      fread (&sv->n_recs, long_size, (size_t) 1, sv->cio_file);
+
+      sv->first_call = 0;
+   }
+
+/*
+   Check the input data against limits.
+*/
+
+   if ((jd_tdb < sv->jd_beg) || (jd_tdb > sv->jd_end))
+      return (error = 2);
+
+   if ((n_pts < min_pts) || (n_pts > max_pts))
+      return (error = 3);
+
+/*
+   Calculate the difference between the current value of 'n_pts' and
+   the last value of 'n_pts'.
+*/
+
+   del_n_pts = abs (n_pts - sv->last_n_pts);
+
+/*
+   Allocate memory for the 't' and 'ra' arrays.
+*/
+
+   if (del_n_pts != 0L)
+   {
+      free (sv->t);
+      free (sv->ra);
+
+      sv->t = (double *) calloc ((size_t) n_pts, double_size);
+      if (sv->t == NULL )
+      {
+         free (sv->ra);
+         sv->ra = NULL;
+         fclose (sv->cio_file);
+         sv->cio_file = NULL;
+         sv->first_call = 1;
+         return (error = 4);
+      }
+
+      sv->ra = (double *) calloc ((size_t) n_pts, double_size);
+      if (sv->ra == NULL )
+      {
+         free (sv->t);
+         sv->t = NULL;
+         fclose (sv->cio_file);
+         sv->cio_file = NULL;
+         sv->first_call = 1;
+         return (error = 5);
+      }
+   }
+
+/*
+   Calculate the record number of the record immediately preceding
+   the date of interest: the "index record".
+*/
+
+   index_rec = (long int) ((jd_tdb - sv->jd_beg) / sv->t_int) + 1L;
+
+/*
+   Test the range of 'n_pts' values centered on 'index_rec' to be sure
+   the range of values requested falls within the file limits.
+*/
+
+   half_int = (n_pts / 2L) - 1L;
+   lo_limit = index_rec - half_int;
+   hi_limit = index_rec + (n_pts - half_int - 1L);
+
+   if ((lo_limit < 1L) || (hi_limit > sv->n_recs))
+      return (error = 6);
+
+/*
+   Compute the number of bytes from the beginning of the file to
+   the 'lo_limit'.
+*/
+
+   bytes_to_lo = header_size + (lo_limit - 1L) * record_size;
+
+/*
+   Compare the current index record with the previous index record.
+*/
+
+   del_index = index_rec - sv->last_index_rec;
+   abs_del_index = abs (del_index);
+
+/*
+   Determine the file read strategy.
+*/
+
+/*
+   Case 1: The input value of 'n_pts' changed since the last entry,
+   or there are no data in the current arrays that can be re-used in the
+   new arrays.  In this case, read all new data points into the arrays.
+*/
+
+   if ((abs_del_index > n_pts) || (del_n_pts != 0))
+   {
+      fseek (sv->cio_file, bytes_to_lo, SEEK_SET);
+
+      for (i = 0L; i < n_pts; i++)
+      {
+         fread (&sv->t[i], double_size, (size_t) 1, sv->cio_file);
+         fread (&sv->ra[i], double_size, (size_t) 1, sv->cio_file);
+      }
+   }
+
+/*
+   Case 2: The new index is close enough to the previous index that
+   there are some data in the current arrays that can be re-used
+   in the new arrays.  The remaining data will be read from the CIO
+   file.
+
+   Note that if the new index is the same as the previous index (i.e.,
+   'del_index' == 0), neither Case 2a nor 2b is satisfied, and the
+   program flow goes directly to load the output arrays with the same
+   values as in the current arrays.
+*/
+
+    else if ((abs_del_index <= n_pts) && (del_n_pts == 0))
+   {
+      n_swap = abs (n_pts - abs_del_index);
+      n_read = abs_del_index;
+
+/*
+   Case 2a: The new index is less than the previous one.  Put the "old"
+   data at the end of the new arrays, and read "new" data into the
+   beginning of the new arrays.
 */
 
-   paralx = star->parallax;
+      if (del_index < 0L)
+      {
+         for (i = 0L; i < n_swap; i++)
+         {
+            t_temp = sv->t[i];
+            ra_temp = sv->ra[i];
+
+            j = i + abs_del_index;
+            sv->t[j] = t_temp;
+            sv->ra[j] = ra_temp;
+         }
 
-   if (star->parallax <= 0.0)
-      paralx = 1.0e-6;
+         fseek (sv->cio_file, bytes_to_lo, SEEK_SET);
+
+         for (i = 0L; i < n_read; i++)
+         {
+            fread (&sv->t[i], double_size, (size_t) 1, sv->cio_file);
+            fread (&sv->ra[i], double_size, (size_t) 1, sv->cio_file);
+         }
+      }
 
 /*
-   Convert right ascension, declination, and parallax to position vector
-   in equatorial system with units of AU.
+   Case 2b: The new index is greater than the previous one.  Put the
+   "old" data at the beginning of the new arrays, and read "new" data
+   into the end of the new arrays.
 */
 
-   dist = 1.0 / sin (paralx * 1.0e-3 * ASEC2RAD);
-   r = (star->ra) * 15.0 * DEG2RAD;
-   d = (star->dec) * DEG2RAD;
-   cra = cos (r);
-   sra = sin (r);
-   cdc = cos (d);
-   sdc = sin (d);
+       else if (del_index > 0L)
+      {
+         for (i = 0L; i < n_swap; i++)
+         {
+            j = i + abs_del_index;
+            t_temp = sv->t[j];
+            ra_temp = sv->ra[j];
 
-   pos[0] = dist * cdc * cra;
-   pos[1] = dist * cdc * sra;
-   pos[2] = dist * sdc;
+            sv->t[i] = t_temp;
+            sv->ra[i] = ra_temp;
+         }
 
-/*
-   Compute Doppler factor, which accounts for change in
-   light travel time to star.
-*/
+         fseek (sv->cio_file, bytes_to_lo + (n_swap * record_size),
+            SEEK_SET);
 
-   k = 1.0 / (1.0 - star->radialvelocity / C * 1000.0);
+         j = i++;
+         for (i = j; i < n_pts; i++)
+         {
+            fread (&sv->t[i], double_size, (size_t) 1, sv->cio_file);
+            fread (&sv->ra[i], double_size, (size_t) 1, sv->cio_file);
+         }
+      }
+   }
 
 /*
-   Convert proper motion and radial velocity to orthogonal components of
-   motion with units of AU/Day.
+   Load the output 'cio' array with the values in the 't' and 'ra'
+   arrays.
+
+   Note that if the input value of 'n_pts' has not changed since the
+   last entry, all data in the current arrays can be re-used in
+   the new arrays. The if statements above are bypassed and the new
+   arrays are the same as the current arrays.
 */
 
-   pmr = star->promora  / (paralx * 365.25) * k;
-   pmd = star->promodec / (paralx * 365.25) * k;
-   rvl = star->radialvelocity * 86400.0 / AU_KM * k;
+   for (i = 0L; i < n_pts; i++)
+   {
+      cio[i].jd_tdb = sv->t[i];
+      cio[i].ra_cio = sv->ra[i];
+   }
 
 /*
-   Transform motion vector to equatorial system.
+   Set values of 'last_index_rec' and 'last_n_pts'.
 */
 
-   vel[0] = - pmr * sra - pmd * sdc * cra + rvl * cdc * cra;
-   vel[1] =   pmr * cra - pmd * sdc * sra + rvl * cdc * sra;
-   vel[2] =   pmd * cdc + rvl * sdc;
+   sv->last_index_rec = index_rec;
+   sv->last_n_pts = n_pts;
 
-   return;
+   return (error);
 }
 
-/********tdb2tt */
-
-void tdb2tt (double tdb_jd,
+/********ira_equinox */
 
-             double *tt_jd, double *secdiff)
+double ira_equinox (double jd_tdb, short int equinox,
+                    short int accuracy)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Computes the Terrestrial Time (TT) or Terrestrial Dynamical Time
-      (TDT) Julian date corresponding to a Barycentric Dynamical Time
-      (TDB) Julian date.
+      To compute the intermediate right ascension of the equinox at
+      the input Julian date, using an analytical expression for the
+      accumulated precession in right ascension.  For the true equinox,
+      the result is the equation of the origins.
 
    REFERENCES:
-      Fairhead, L. & Bretagnon, P. (1990) Astron. & Astrophys. 229, 240.
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      Capitaine, N. et al. (2003), Astronomy and Astrophysics 412,
+         567-586, eq. (42).
 
    INPUT
    ARGUMENTS:
-      tdb_jd (double)
+      jd_tdb (double)
          TDB Julian date.
+      equinox (short int)
+         Equinox selection flag:
+            = 0 ... mean equinox
+            = 1 ... true equinox.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
    OUTPUT
    ARGUMENTS:
-      *tt_jd (double)
-         TT Julian date.
-      *secdiff (double)
-         Difference 'tdb_jd'-'tt_jd', in seconds.
+      None.
 
    RETURNED
    VALUE:
-      None.
+      (double)
+         Intermediate right ascension of the equinox, in hours (+ or -).
+         If 'equinox' = 1 (i.e true equinox), then the returned value is
+         the equation of the origins.
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      sin                math.h
+      default_context    novas.c
+      ira_equinox_ctx    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/07-92/TKB (USNO/NRL Optical Interfer.) Translate Fortran.
-      V1.1/08-93/WTH (USNO/AA) Update to C Standards.
-      V1.2/06-98/JAB (USNO/AA) Adopt new model (Explanatory Supplement
-                               to the Astronomical Almanac, pp. 42-44
-                               and p. 316.)
-      V1.3/11-03/JAB (USNO/AA) Changed variable names of the input
-                               Julian dates to make more descriptive.
-      V1.4/01-07/JAB (USNO/AA) Adopt Fairhead & Bretagnon expression.
+      V1.0/07-06/JAB (USNO/AA)
+      V1.1/10-26/ROA           Use the default 'novas_context'.
 
    NOTES:
-      1. Expression used in this function is a truncated form of a
-      longer and more precise series given in the first reference.  The
-      result is good to about 10 microseconds.
-      2. This function is the C version of NOVAS Fortran routine
-      'times'.
+      1. This function is the C version of NOVAS Fortran routine
+      'eqxra'.
+
 ------------------------------------------------------------------------
 */
 {
-   double t;
-
-   t = (tdb_jd - T0) / 36525.0;
-
-/*
-   Expression given in USNO Circular 179, eq. 2.6.
-*/
-
-   *secdiff = 0.001657 * sin ( 628.3076 * t + 6.2401)
-            + 0.000022 * sin ( 575.3385 * t + 4.2970)
-            + 0.000014 * sin (1256.6152 * t + 6.1969)
-            + 0.000005 * sin ( 606.9777 * t + 4.0212)
-            + 0.000005 * sin (  52.9691 * t + 0.4444)
-            + 0.000002 * sin (  21.3299 * t + 5.5431)
-            + 0.000010 * t * sin ( 628.3076 * t + 4.2490);
-
-   *tt_jd = tdb_jd - *secdiff / 86400.0;
-
-    return;
+   return ira_equinox_ctx (default_context (), jd_tdb,equinox,accuracy);
 }
 
-/********cio_ra */
-
-short int cio_ra (double jd_tt, short int accuracy,
+/********ira_equinox_ctx */
 
-                  double *ra_cio)
+double ira_equinox_ctx (novas_context *ctx, double jd_tdb,
+                        short int equinox, short int accuracy)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function computes the true right ascension of the celestial
-      intermediate origin (CIO) at a given TT Julian date.  This is
-      -(equation of the origins).
+      This function is the version of 'ira_equinox' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      See function 'ira_equinox'.
 
    INPUT
    ARGUMENTS:
-      jd_tt (double)
-         TT Julian date.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'ira_equinox'.
 
    OUTPUT
    ARGUMENTS:
-      *ra_cio (double)
-         Right ascension of the CIO, with respect to the true equinox
-         of date, in hours (+ or -).
+      See function 'ira_equinox'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0  ... everything OK.
-         = 1  ... invalid value of 'accuracy'.
-         > 10 ... 10 + the error code from function 'cio_location'.
-         > 20 ... 20 + the error code from function 'cio_basis'.
+      See function 'ira_equinox'.
 
    GLOBALS
    USED:
-      RAD2DEG, T0        novascon.c
+      T0                 novascon.c
 
    FUNCTIONS
    CALLED:
-      tdb2tt             novas.c
-      cio_location       novas.c
-      cio_basis          novas.c
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
-      atan2              math.h
+      e_tilt_ctx         novas.c
+      fabs               math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/01-05/JAB (USNO/AA)
-      V1.1/12-05/WKP (USNO/AA) Corrected minor syntax problems.
-      V1.2/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V1.3/07-06/JAB (USNO/AA) Implement 'cio_location' construct.
+      V1.0/10-26/ROA:           Moved out of 'ira_equinox' V1.0.
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'ciora'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int rs;
+   ira_equinox_saved *sv = &ctx->ira_equinox;
 
-   double unitx[3] = {1.0, 0.0, 0.0};
-   double jd_tdb, t, secdif, x[3], y[3], z[3], w1[3], w2[3],
-       eq[3], az, r_cio;
+   double t, u, v, w, x, prec_ra, ra_eq;
 
 /*
-   Check for valid value of 'accuracy'.
+   Compute time in Julian centuries.
 */
 
-   if ((accuracy < 0) || (accuracy > 1))
-      return (error = 1);
+   t = (jd_tdb - T0 ) / 36525.0;
 
 /*
-   'jd_tdb' is the TDB Julian date.
+   For the true equinox, obtain the equation of the equinoxes in time
+   seconds, which includes the 'complementary terms'.
 */
 
-      jd_tdb = jd_tt;
-      tdb2tt (jd_tdb, &t,&secdif);
-      jd_tdb = jd_tt + secdif / 86400.0;
+   if (equinox == 1)
+   {
+      if (((fabs (jd_tdb - sv->t_last)) > 1.0e-8) ||
+         (accuracy != sv->acc_last))
+      {
+         e_tilt_ctx (ctx,jd_tdb,accuracy, &u, &v, &sv->eq_eq, &w, &x);
+         sv->t_last = jd_tdb;
+         sv->acc_last = accuracy;
+      }
+   }
+    else
+   {
+      sv->eq_eq = 0.0;
+   }
 
 /*
-   Obtain the basis vectors, in the GCRS, for the celestial intermediate
-   system defined by the CIP (in the z direction) and the CIO (in the
-   x direction).
+   Precession in RA in arcseconds taken from the reference.
 */
 
-   if ((error = cio_location (jd_tdb,accuracy, &r_cio,&rs)) != 0)
-   {
-      *ra_cio = 0.0;
-      return (error += 10);
-   }
+   prec_ra = 0.014506 +
+      (((( -    0.0000000368   * t
+           -    0.000029956  ) * t
+           -    0.00000044   ) * t
+           +    1.3915817    ) * t
+           + 4612.156534     ) * t;
 
-   if ((error = cio_basis (jd_tdb,r_cio,rs,accuracy, x,y,z)) != 0)
-   {
-      return (error += 20);
-   }
+   ra_eq = - (prec_ra / 15.0 + sv->eq_eq) / 3600.0;
+
+   return (ra_eq);
+}
+
+/********ephemeris */
+
+short int ephemeris (double jd[2], object *cel_obj, short int origin,
+                     short int accuracy,
+
+                     double *pos, double *vel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Retrieves the position and velocity of a solar system body from
+      a fundamental ephemeris.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd[2] (double)
+         TDB Julian date split into two parts, where the sum
+         jd[0] + jd[1] is the TDB Julian date.
+      *cel_obj (struct object)
+         Pointer to structure containing the designation of the body
+         of interest (defined in novas.h).
+      origin (short int)
+         Origin code
+            = 0 ... solar system barycenter
+            = 1 ... center of mass of the Sun
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
 
-/*
-   Compute the direction of the true equinox in the GCRS.
-*/
+   OUTPUT
+   ARGUMENTS:
+      pos[3] (double)
+         Position vector of the body at 'jd_tdb'; equatorial rectangular
+         coordinates in AU referred to the ICRS.
+      vel[3] (double)
+         Velocity vector of the body at 'jd_tdb'; equatorial rectangular
+         coordinates in AU/day referred to the ICRS.  May be NULL if
+         only the position is wanted.
 
-   nutation (jd_tdb,-1,accuracy,unitx, w1);
-   precession (jd_tdb,w1,T0, w2);
-   frame_tie (w2,-1, eq);
+   RETURNED
+   VALUE:
+      (short int)
+         0    ... Everything OK.
+         1    ... Invalid value of 'origin'.
+         2    ... Invalid value of 'type' in 'cel_obj'.
+         10+n ... where n is the error code from 'solarsystem'.
+         20+n ... where n is the error code from 'readeph_pv'.
 
-/*
-   Compute the RA-like coordinate of the true equinox in the celestial
-   intermediate system.
-*/
+   GLOBALS
+   USED:
+      None.
 
-   az = atan2 (eq[0] * y[0] + eq[1] * y[1] + eq[2] * y[2],
-      eq[0] * x[0] + eq[1] * x[1] + eq[2] * x[2]) * RAD2DEG;
+   FUNCTIONS
+   CALLED:
+      default_context     novas.c
+      ephemeris_ctx       novas.c
 
-/*
-   The RA of the CIO is minus this coordinate.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/06-97/JAB (USNO/AA)
+      V1.1/10-97/JAB (USNO/AA): Support error code from 'readeph'.
+      V1.2/08-98/JAB (USNO/AA): Add computation of barycentric
+                                coordinates of a minor planet; support
+                                new 'readeph' argument list.
+      V1.3/12-99/JAB (USNO/AA): Add error handling to call to
+                                'solarsystem' (case 1).
+      V1.4/12-02/JAB (USNO/AA): Fix memory leaks with 'posvel' (case 1).
+      V1.5/10-08/JAB (USNO/AA): Incorporate higher-precision call to
+                                the solar system ephemeris, primarily
+                                to support light-time calculations.
+      V1.6/02-11/JLB (USNO/AA): Reformatted description of origin for
+                                consistency with other documentation.
+      V1.7/10-26/ROA:           Position only if 'vel' is NULL.
+      V1.8/10-26/ROA:           Call 'readeph_pv' and keep the minor
+                                planet vectors on the stack, so
+                                nothing is allocated.
+      V1.9/10-26/ROA:           Use the default 'novas_context'.
 
-   *ra_cio = -az / 15.0;
+   NOTES:
+      1. It is recommended that the input structure 'cel_obj' be
+      created using function 'make_object' in file novas.c.
+      2. Error 3 (unable to allocate memory) is no longer returned.
 
-   return (error);
+------------------------------------------------------------------------
+*/
+{
+   return ephemeris_ctx (default_context (), jd,cel_obj,origin,accuracy,
+      pos,vel);
 }
 
-/********cio_location */
+/********ephemeris_ctx */
 
-short int cio_location (double jd_tdb, short int accuracy,
+short int ephemeris_ctx (novas_context *ctx, double jd[2],
+                         object *cel_obj, short int origin,
+                         short int accuracy,
 
-                        double *ra_cio, short int *ref_sys)
+                         double *pos, double *vel)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function returns the location of the celestial
-      intermediate origin (CIO) for a given Julian date, as a
-      right ascension with respect to either the GCRS (geocentric ICRS)
-      origin or the true equinox of date.  The CIO is always located on
-      the true equator (= intermediate equator) of date.
+      This function is the version of 'ephemeris' that keeps the
+      values saved between calls in the computation context 'ctx',
+      so that different contexts can be used concurrently from
+      different threads.
 
    REFERENCES:
-      None.
+      See function 'ephemeris'.
 
    INPUT
    ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'ephemeris'.
 
    OUTPUT
    ARGUMENTS:
-      *ra_cio (double)
-         Right ascension of the CIO, in hours.
-      *ref_sys (short int)
-         Reference system in which right ascension is given
-            = 1 ... GCRS
-            = 2 ... True equator and equinox of date.
+      See function 'ephemeris'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0  ... everything OK.
-         = 1  ... unable to allocate memory for the 'cio' array.
-         > 10 ... 10 + the error code from function 'cio_array'.
+      See function 'ephemeris'.
 
    GLOBALS
    USED:
@@ -7431,1805 +13075,1556 @@ short int cio_location (double jd_tdb, short int accuracy,
 
    FUNCTIONS
    CALLED:
-      cio_array          novas.c
-      ira_equinox        novas.c
-      fopen              stdio.h
-      fclose             stdio.h
-      fabs               math.h
-      calloc             stdlib.h
+      context_solarsystem novas.c
+      readeph_pv         readeph.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/07-06/JAB (USNO/AA)
+      V1.0/10-26/ROA:           Moved out of 'ephemeris' V1.8.
 
    NOTES:
-      1. If an external file of CIO right ascensions is available,
-      it will be used and 'ref_sys' will be set to 1.  Otherwise an
-      internal computation will be used and 'ref_sys' will be set to 2.
-      2. The external binary file of CIO right ascensions is assumed
-      to be named 'cio_ra.bin'.  Utility program 'cio_file.c', provided
-      with the NOVAS-C package, creates this file from a text file also
-      provided with NOVAS-C.
-      3. This function is the C version of NOVAS Fortran routine
-      'cioloc'.
+      1. The positions of the major planets, Sun and Moon come from
+      'context_solarsystem': those of the default context from
+      'solarsystem' and 'solarsystem_hp', as before.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_call = 1;
-   static short int ref_sys_last = 0;
-   static short int use_file = 0;
-   short int error = 0;
-
-   long int n_pts = 6;
-   long int i, j;
-
-   static double t_last = 0.0;
-   static double ra_last;
-   double p, eq_origins;
-
-   size_t cio_size;
+   int err = 0;
+   int mp_number;
 
-   static ra_of_cio *cio;
+   short int error = 0;
+   short int ss_number, i;
 
-   static FILE *cio_file;
+   double jd_tdb, jd_sun[2], posvel[6], sun_pos[3], sun_vel[3];
 
 /*
-   Check if the input external binary file exists and can be read.
+   Check the value of 'origin'.
 */
 
-   if (first_call)
-   {
-      if ((cio_file = fopen ("cio_ra.bin", "rb")) == NULL)
-      {
-         use_file = 0;
-      }
-       else
-      {
-         use_file = 1;
-         fclose (cio_file);
-      }
-   }
+   if ((origin < 0) || (origin > 1))
+      return (error = 1);
 
 /*
-   Check if previously computed RA value can be used.
+   Invoke the appropriate ephemeris access software depending upon the
+   type of object.
 */
 
-   if ((fabs (jd_tdb - t_last) <= 1.0e-8))
+   switch (cel_obj->type)
    {
-      *ra_cio = ra_last;
-      *ref_sys = ref_sys_last;
-      return (error = 0);
-   }
 
 /*
-   Compute the RA of the CIO.
+   Get the position and velocity of a major planet, Pluto, Sun, or Moon.
+   When high accuracy is specified, use function 'solarsystem_hp' rather
+   than 'solarsystem'.
 */
 
-   switch (use_file)
-   {
+      case 0:
+         ss_number = cel_obj->number;
+
+         if ((error = context_solarsystem (ctx,accuracy,jd,ss_number,
+            origin, pos,vel)) != 0)
+            error += 10;
+         break;
 
 /*
-   -----------------------------
-   Interpolate values from file.
-   -----------------------------
+   Get the position and velocity of a minor planet.
+
 */
 
       case 1:
+         mp_number = (int) cel_obj->number;
 
-/*
-   Allocate memory for the array 'cio'.  This array contains the values
-   to be interpolated, extracted from the CIO file.
+/*  The USNO minor planet software returns heliocentric positions and
+    velocities.
 */
 
-         if (first_call)
-         {
-            cio_size = sizeof (ra_of_cio);
-            cio = (ra_of_cio *) calloc ((size_t) n_pts, cio_size);
-            if (cio == NULL)
-               return (error = 1);
-             else
-               first_call = 0;
-         }
+         jd_tdb = jd[0] + jd[1];
+         if ((err = readeph_pv (mp_number,cel_obj->name,jd_tdb, posvel))
+            != 0)
+            return ((short int) (20 + err));
 
-/*
-   Get array of values to interpolate.
+/*  Barycentric coordinates of the minor planet, if desired, are
+    computed via the barycentric coordinates of the Sun, obtained
+    from the solar system ephemeris.
 */
 
-         if ((error = cio_array (jd_tdb,n_pts, cio)) != 0)
+         if (origin == 0)
          {
-            *ra_cio = 0.0;
-            return (error += 10);
+            jd_sun[0] = jd_tdb;
+            jd_sun[1] = 0.0;
+            if ((error = context_solarsystem (ctx,1,jd_sun,10,0, sun_pos,
+               vel ? sun_vel : NULL)) != 0)
+               return (error += 10);
+
+            for (i = 0; i < 3; i++)
+            {
+               posvel[i] += sun_pos[i];
+               if (vel)
+                  posvel[i+3] += sun_vel[i];
+            }
          }
 
 /*
-   Perform Lagrangian interpolation for the RA at 'tdb_jd'.
+   Break up 'posvel' into separate position and velocity vectors.
 */
 
-         *ra_cio = 0.0;
-         for (j = 0L; j < n_pts; j++)
+         for (i = 0; i < 3; i++)
          {
-            p = 1.0;
-            for (i = 0L; i < n_pts; i++)
-            {
-               if (i != j)
-                  p *= ((jd_tdb - cio[i].jd_tdb) /
-                       (cio[j].jd_tdb - cio[i].jd_tdb));
-            }
-            *ra_cio += (p * cio[j].ra_cio);
+            pos[i] = posvel[i];
+            if (vel)
+               vel[i] = posvel[i+3];
          }
+         break;
 
-         *ra_cio /= 54000.0;
-         *ref_sys = 1;
+/*
+   Invalid type of object.
+*/
 
+      default:
+         error = 2;
          break;
 
+   }
+
+   return (error);
+}
+
+/********transform_hip */
+
+void transform_hip (cat_entry *hipparcos,
+
+                    cat_entry *hip_2000)
 /*
-   -------------------------
-   Use internal computation.
-   -------------------------
-*/
+------------------------------------------------------------------------
 
-      case 0:
+   PURPOSE:
+      To convert Hipparcos catalog data at epoch J1991.25 to epoch
+      J2000.0, for use within NOVAS.  To be used only for Hipparcos or
+      Tycho stars with linear space motion.  Both input and output data
+      is in the ICRS.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *hipparcos (struct cat_entry)
+         An entry from the Hipparcos catalog, at epoch J1991.25, with
+         all members having Hipparcos catalog units.  See Note 1
+         below (struct defined in novas.h).
+
+   OUTPUT
+   ARGUMENTS:
+      *hip_2000 (struct cat_entry)
+         The transformed input entry, at epoch J2000.0.  See Note 2
+         below (struct defined in novas.h).
+
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      transform_hip_ctx  novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-98/JAB (USNO/AA)
+      V1.1/11-03/JAB (USNO/AA) Update for ICRS
+      V1.2/10-26/ROA           Use the default 'novas_context'.
+
+   NOTES:
+      1. Input (Hipparcos catalog) epoch and units:
+         Epoch: J1991.25
+         Right ascension (RA): degrees
+         Declination (Dec): degrees
+         Proper motion in RA: milliarcseconds per year
+         Proper motion in Dec: milliarcseconds per year
+         Parallax: milliarcseconds
+         Radial velocity: kilometers per second (not in catalog)
+      2. Output (modified Hipparcos) epoch and units:
+         Epoch: J2000.0
+         Right ascension: hours
+         Declination: degrees
+         Proper motion in RA: milliarcseconds per year
+         Proper motion in Dec: milliarcseconds per year
+         Parallax: milliarcseconds
+         Radial velocity: kilometers per second
+      3. This function is the C version of NOVAS Fortran routine
+         'gethip'.
 
-/*
-   Compute equation of the origins.
+------------------------------------------------------------------------
 */
-
-         if (first_call)
-            first_call = 0;
-
-         eq_origins = ira_equinox (jd_tdb,1,accuracy);
-
-         *ra_cio = -eq_origins;
-         *ref_sys = 2;
-
-         break;
-   }
-
-   t_last = jd_tdb;
-   ra_last = *ra_cio;
-   ref_sys_last = *ref_sys;
-
-   return (error);
+{
+   transform_hip_ctx (default_context (), hipparcos, hip_2000);
+   return;
 }
 
-/********cio_basis */
+/********transform_hip_ctx */
 
-short int cio_basis (double jd_tdb, double ra_cio, short int ref_sys,
-                     short int accuracy,
+void transform_hip_ctx (novas_context *ctx, cat_entry *hipparcos,
 
-                     double *x, double *y, double *z)
+                        cat_entry *hip_2000)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To compute the orthonormal basis vectors, with
-      respect to the GCRS (geocentric ICRS), of the celestial
-      intermediate system defined by the celestial intermediate pole
-      (CIP) (in the z direction) and the celestial intermediate origin
-      (CIO) (in the x direction).  A TDB Julian date and the right
-      ascension of the CIO at that date is required as input.  The
-      right ascension of the CIO can be with respect to either the
-      GCRS origin or the true equinox of date -- different algorithms
-      are used in the two cases.
+      This function is the version of 'transform_hip' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
 
    REFERENCES:
-      Kaplan, G. (2005), US Naval Observatory Circular 179.
+      See function 'transform_hip'.
 
    INPUT
    ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date of epoch.
-      ra_cio (double)
-         Right ascension of the CIO at epoch (hours).
-      ref_sys (short int)
-         Reference system in which right ascension is given (output
-         from function 'cio_location')
-            = 1 ... GCRS
-            = 2 ... True equator and equinox of date.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'transform_hip'.
 
    OUTPUT
    ARGUMENTS:
-      *x (double)
-         Unit vector toward the CIO, equatorial rectangular
-         coordinates, referred to the GCRS.
-      *y (double)
-         Unit vector toward the y-direction, equatorial rectangular
-         coordinates, referred to the GCRS.
-      *z (double)
-         Unit vector toward north celestial pole (CIP), equatorial
-         rectangular coordinates, referred to the GCRS.
+      See function 'transform_hip'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK.
-         = 1 ... invalid value of input variable 'ref_sys'.
+      None.
 
    GLOBALS
    USED:
-      T0, DEG2RAD        novascon.c
+      T0                 novascon.c
 
    FUNCTIONS
    CALLED:
-      nutation           novas.c
-      precession         novas.c
-      frame_tie          novas.c
-      fabs               math.h
-      sin                math.h
-      cos                math.h
-      sqrt               math.h
+      transform_cat_ctx  novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-04/JAB (USNO/AA)
-      V1.1/01-06/WKP (USNO/AA) Changed 'mode' to 'accuracy'.
-      V1.2/07-06/JAB (USNA/AA) Incorporate code to use 'ref_sys' input.
-      V1.3/06-08/WKP (USNO/AA) Changed value of direction argument in
-                               calls to 'nutation' from 1 to -1 for
-                               consistency.
+      V1.0/10-26/ROA:           Moved out of 'transform_hip' V1.1.
 
    NOTES:
-      1. This function effectively constructs the matrix C in eq. (3)
-      of the reference.
-      2. This function is the C version of NOVAS Fortran routine
-      'ciobas'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int ref_sys_last = 0;
-   short int error = 0;
-   short int i;
-
-   static double t_last = 0.0;
-   static double xx[3], yy[3], zz[3];
-   double z0[3] = {0.0, 0.0, 1.0};
-   double w0[3], w1[3], w2[3], sinra, cosra, xmag;
-
-/*
-   Compute unit vector z toward celestial pole.
-*/
-
-   if (((fabs (jd_tdb - t_last) > 1.0e-8)) || (ref_sys != ref_sys_last))
-   {
-      nutation (jd_tdb,-1,accuracy,z0, w1);
-      precession (jd_tdb,w1,T0, w2);
-      frame_tie (w2,-1, zz);
-
-      t_last = jd_tdb;
-      ref_sys_last = ref_sys;
-   }
-    else
-   {
-      for (i = 0; i < 3; i++)
-      {
-         x[i] = xx[i];
-         y[i] = yy[i];
-         z[i] = zz[i];
-      }
-      return (error);
-   }
-
-/*
-   Now compute unit vectors x and y.  Method used depends on the
-   reference system in which right ascension of the CIO is given.
-*/
+   const double epoch_hip = 2448349.0625;
 
-   switch (ref_sys)
-   {
+   cat_entry scratch;
 
 /*
-   ----------------------------
-   RA of CIO expressed in GCRS.
-   ----------------------------
+   Set up a "scratch" catalog entry containing Hipparcos data in
+   "NOVAS units."
 */
 
-      case 1:
-
-/*
-   Compute vector x toward CIO in GCRS.
-*/
+   strcpy (scratch.starname, hipparcos->starname);
+   scratch.starnumber = hipparcos->starnumber;
+   scratch.dec = hipparcos->dec;
+   scratch.promora = hipparcos->promora;
+   scratch.promodec = hipparcos->promodec;
+   scratch.parallax = hipparcos->parallax;
+   scratch.radialvelocity = hipparcos->radialvelocity;
 
-         sinra = sin (ra_cio * 15.0 * DEG2RAD);
-         cosra = cos (ra_cio * 15.0 * DEG2RAD);
-         xx[0] =  zz[2] * cosra;
-         xx[1] =  zz[2] * sinra;
-         xx[2] = -zz[0] * cosra - zz[1] * sinra;
+   strcpy (scratch.catalog, "SCR");
 
 /*
-   Normalize vector x.
+   Convert right ascension from degrees to hours.
 */
 
-         xmag = sqrt (xx[0] * xx[0] + xx[1] * xx[1] + xx[2] * xx[2]);
-         xx[0] /= xmag;
-         xx[1] /= xmag;
-         xx[2] /= xmag;
+   scratch.ra = hipparcos->ra / 15.0;
 
 /*
-   Compute unit vector y orthogonal to x and z (y = z cross x).
+   Change the epoch of the Hipparcos data from J1991.25 to J2000.0.
 */
 
-         yy[0] = zz[1] * xx[2] - zz[2] * xx[1];
-         yy[1] = zz[2] * xx[0] - zz[0] * xx[2];
-         yy[2] = zz[0] * xx[1] - zz[1] * xx[0];
+   transform_cat_ctx (ctx,1,epoch_hip,&scratch,T0,"HP2", hip_2000);
 
-         break;
+   return;
+}
 
-/*
-   ----------------------------------------------------------
-   RA of CIO expressed in equator-and-equinox of date system.
-   ----------------------------------------------------------
-*/
+/********transform_cat */
 
-      case 2:
+short int transform_cat (short int option, double date_incat,
+                         cat_entry *incat, double date_newcat,
+                         char *newcat_id,
 
+                         cat_entry *newcat)
 /*
-   Construct unit vector toward CIO in equator-and-equinox-of-date
-   system.
-*/
-
-          w0[0] = cos (ra_cio * 15.0 * DEG2RAD);
-          w0[1] = sin (ra_cio * 15.0 * DEG2RAD);
-          w0[2] = 0.0;
+------------------------------------------------------------------------
 
-/*
-   Rotate the vector into the GCRS to form unit vector x.
-*/
+   PURPOSE:
+      To transform a star's catalog quantities for a change of epoch
+      and/or equator and equinox.  Also used to rotate catalog
+      quantities on the dynamical equator and equinox of J2000.0 to the
+      ICRS or vice versa.
 
-          nutation (jd_tdb,-1,accuracy,w0, w1);
-          precession (jd_tdb,w1,T0, w2);
-          frame_tie (w2,-1, xx);
+   REFERENCES:
+      None.
 
-/*
-   Compute unit vector y orthogonal to x and z (y = z cross x).
-*/
+   INPUT
+   ARGUMENTS:
+      option (short int)
+         Transformation option
+            = 1 ... change epoch; same equator and equinox
+            = 2 ... change equator and equinox; same epoch
+            = 3 ... change equator and equinox and epoch
+            = 4 ... change equator and equinox J2000.0 to ICRS
+            = 5 ... change ICRS to equator and equinox of J2000.0
+      date_incat (double)
+         TT Julian date, or year, of input catalog data.
+      *incat (struct cat_entry)
+         An entry from the input catalog, with units as given in
+         the struct definition (struct defined in novas.h).
+      date_newcat (double)
+         TT Julian date, or year, of transformed catalog data.
+      newcat_id[SIZE_OF_CAT_NAME] (char)
+         Catalog identifier ((SIZE_OF_CAT_NAME - 1) characters maximum)
+         e.g. HIP = Hipparcos, TY2 = Tycho-2.
 
-          yy[0] = zz[1] * xx[2] - zz[2] * xx[1];
-          yy[1] = zz[2] * xx[0] - zz[0] * xx[2];
-          yy[2] = zz[0] * xx[1] - zz[1] * xx[0];
+   OUTPUT
+   ARGUMENTS:
+      *newcat (struct cat_entry)
+         The transformed catalog entry, with units as given in
+         the struct definition (struct defined in novas.h).
 
-          break;
+   RETURNED
+   VALUE:
+      = 0 ... Everything OK.
+      = 1 ... Invalid value of an input date for option 2 or 3 (see
+              Note 1 below).
+      = 2 ... length of 'newcat_id' out of bounds.
 
-/*
-   ---------------------------
-   Invalid value of 'ref_sys'.
-   ---------------------------
-*/
+   GLOBALS
+   USED:
+      None.
 
-      default:
+   FUNCTIONS
+   CALLED:
+      default_context    novas.c
+      transform_cat_ctx  novas.c
 
-         for (i = 0; i < 3; i++)
-         {
-            xx[i] = 0.0;
-            yy[i] = 0.0;
-            zz[i] = 0.0;
-         }
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-98/JAB (USNO/AA)
+      V1.1/11-03/JAB (USNO/AA) Update for ICRS; add options 4 and 5.
+      V1.2/06-08/WKP (USNO/AA) Changed 'a[3]' to 'd', added Doppler factor,
+                               and corrected 'frame_tie' direction.
+      V1.3/06-08/JAB (USNO/AA) Error check on dates for options 2 and 3.
+      V1.4/02-11/WKP (USNO/AA) Implement SIZE_OF_CAT_NAME.
+      V1.5/10-26/ROA           Use the default 'novas_context'.
 
-         error = 1;
-         break;
-   }
+   NOTES:
+      1. 'date_incat' and 'date_newcat' may be specified either as a
+      Julian date (e.g., 2433282.5) or a Julian year and fraction
+      (e.g., 1950.0).  Values less than 10000 are assumed to be years.
+      For 'option' = 2 or 'option' = 3, either 'date_incat' or
+      'date_newcat' must be 2451545.0 or 2000.0 (J2000.0).  For
+      'option' = 4 and 'option' = 5, 'date_incat' and 'date_newcat'
+      are ignored.
+      2. 'option' = 1 updates the star's data to account for the
+      star's space motion between the first and second dates, within a
+      fixed reference frame.
+         'option' = 2 applies a rotation of the reference frame
+      corresponding to precession between the first and second dates,
+      but leaves the star fixed in space.
+         'option' = 3 provides both transformations.
+         'option' = 4 and 'option' = 5 provide a a fixed rotation
+      about very small angles (<0.1 arcsecond) to take data from the
+      dynamical system of J2000.0 to the ICRS ('option' = 4) or vice
+      versa ('option' = 5).
+      3. For 'option' = 1, input data can be in any fixed reference
+      system. for 'option' = 2 or 'option' = 3, this function assumes
+      the input data is in the dynamical system and produces output in
+      the dynamical system.  for 'option' = 4, the input data must be
+      on the dynamical equator and equinox of J2000.0.  for
+     'option' = 5, the input data must be in the ICRS.
+      4. This function cannot be properly used to bring data from
+      old star catalogs into the modern system, because old catalogs
+      were compiled using a set of constants that are
+      incompatible with modern values.  In particular, it should not
+      be used for catalogs whose positions and proper motions were
+      derived by assuming a precession constant significantly different
+      from the value implicit in function 'precession'.
+      5. This function is the C version of NOVAS Fortran routine
+      'catran'.
+      6. SIZE_OF_CAT_NAME is defined in novas.h.
 
-/*
-   Load the x, y, and z arrays.
+------------------------------------------------------------------------
 */
-
-   for (i = 0; i < 3; i++)
-   {
-      x[i] = xx[i];
-      y[i] = yy[i];
-      z[i] = zz[i];
-   }
-
-   return (error);
+{
+   return transform_cat_ctx (default_context (),
+      option,date_incat,incat,date_newcat,newcat_id, newcat);
 }
 
-/********cio_array */
+/********transform_cat_ctx */
 
-short int cio_array (double jd_tdb, long int n_pts,
+short int transform_cat_ctx (novas_context *ctx, short int option,
+                             double date_incat, cat_entry *incat,
+                             double date_newcat, char *newcat_id,
 
-                     ra_of_cio *cio)
+                             cat_entry *newcat)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Given an input TDB Julian date and the number of data points
-      desired, this function returns a set of Julian dates and
-      corresponding values of the GCRS right ascension of the celestial
-      intermediate origin (CIO).  The range of dates is centered (at
-      least approximately) on the requested date.  The function obtains
-      the data from an external data file.
+      This function is the version of 'transform_cat' that keeps
+      the values saved between calls in the computation context
+      'ctx', so that different contexts can be used concurrently
+      from different threads.
 
    REFERENCES:
-      None.
+      See function 'transform_cat'.
 
    INPUT
    ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date.
-      n_pts (long int)
-         Number of Julian dates and right ascension values requested
-         (not less than 2 or more than 20).
+      *ctx (novas_context)
+         Computation context (see 'novas_context_create').
+      Other arguments: see function 'transform_cat'.
 
    OUTPUT
    ARGUMENTS:
-      *cio (struct ra_of_cio)
-         An time series (array) of the right ascension of the Celestial
-         Intermediate Origin (CIO) with respect to the GCRS (structure
-         defined in novas.h).
+      See function 'transform_cat'.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK
-         = 1 ... error opening the 'cio_ra.bin' file.
-         = 2 ... 'jd_tdb' not in the range of the CIO file.
-         = 3 ... 'n_pts' out of range.
-         = 4 ... unable to allocate memory for the internal 't' array.
-         = 5 ... unable to allocate memory for the internal 'ra' array.
-         = 6 ... 'jd_tdb' is too close to either end of the CIO file;
-                 unable to put 'n_pts' data points into the output
-                 structure.
+      See function 'transform_cat'.
 
    GLOBALS
    USED:
-      None.
+      SIZE_OF_CAT_NAME   novas.h
+      T0, ASEC2RAD       novascon.c
+      AU_KM, C           novascon.c
 
    FUNCTIONS
    CALLED:
-      fopen              stdio.h
-      fread              stdio.h
-      fclose             stdio.h
-      abs                math.h
-      free               stdlib.h
-      calloc             stdlib.h
-      fseek              stdio.h
+      precession_ctx     novas.c
+      frame_tie_ctx      novas.c
+      sin                math.h
+      cos                math.h
+      sqrt               math.h
+      atan2              math.h
+      asin               math.h
+      strcpy             string.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-04/JAB (USNO/AA)
-      V1.1/12-05/WKP (USNO/AA) Changed struct type from 'cio_ra' to
-                               'ra_of_cio' to avoid conflicts.
-      V1.2/02-08/JAB (USNO/AA) Fix file-read strategy "Case 2" and
-                               improve documentation.
+      V1.0/10-26/ROA:           Moved out of 'transform_cat' V1.4.
 
    NOTES:
-      1. This function assumes that binary, random-access file
-      'cio_ra.bin' has been created and is in the same directory as
-      your executable.  This file is created by program 'cio_file.c',
-      included in the NOVAS-C package.  On the first call to this
-      function, file 'cio_ra.bin' is opened in read mode.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_call = 1;
    short int error = 0;
+   short int j;
 
-   static long int last_index_rec = -50L;
-   static long int last_n_pts = 0L;
-   static long int header_size, record_size, n_recs;
-   long int min_pts = 2;
-   long int max_pts = 20;
-   long int  del_n_pts, index_rec, half_int, lo_limit, hi_limit,
-      del_index, abs_del_index, bytes_to_lo, n_swap, n_read, i, j;
-
-   static double jd_beg, jd_end, t_int, *t, *ra;
-   double t_temp, ra_temp;
-
-   static size_t double_size, long_size;
-
-   static FILE *cio_file;
-
-/*
-   Set the sizes of the file header and data records, open the CIO file,
-   and read the file header on the first call to this function.
-*/
-
-   if (first_call)
-   {
-      double_size = sizeof (double);
-      long_size = sizeof (long int);
-      header_size = (long) ((size_t) 3 * double_size + long_size);
-      record_size = (long) ((size_t) 2 * double_size);
-
-/*
-   Open the input (binary, random-access) file.
-*/
-
-      if ((cio_file = fopen ("cio_ra.bin", "rb")) == NULL)
-         return (error = 1);
+   double jd_incat, jd_newcat, paralx, dist, r, d, cra, sra, cdc,
+      sdc, k, pos1[3], term1, pmr, pmd, rvl, vel1[3], pos2[3],
+      vel2[3], xyproj;
 
 /*
-   Read the file header.
-*/
-
-      fread (&jd_beg, double_size, (size_t) 1, cio_file);
-      fread (&jd_end, double_size, (size_t) 1, cio_file);
-      fread (&t_int, double_size, (size_t) 1, cio_file);
-      fread (&n_recs, long_size, (size_t) 1, cio_file);
-   }
+   If necessary, compute Julian dates.
 
-/*
-   Check the input data against limits.
+   This function uses TDB Julian dates internally, but no
+   distinction between TDB and TT is necessary.
 */
 
-   if ((jd_tdb < jd_beg) || (jd_tdb > jd_end))
-      return (error = 2);
+   if (date_incat < 10000.0)
+      jd_incat = T0 + (date_incat - 2000.0) * 365.25;
+    else
+      jd_incat = date_incat;
 
-   if ((n_pts < min_pts) || (n_pts > max_pts))
-      return (error = 3);
+   if (date_newcat < 10000.0)
+      jd_newcat = T0 + (date_newcat - 2000.0) * 365.25;
+    else
+      jd_newcat = date_newcat;
 
 /*
-   Calculate the difference between the current value of 'n_pts' and
-   the last value of 'n_pts'.
-*/
-
-   del_n_pts = abs (n_pts - last_n_pts);
+   Convert input angular components to vectors
 
-/*
-   Allocate memory for the 't' and 'ra' arrays.
+   If parallax is unknown, undetermined, or zero, set it to 1.0e-6
+   milliarcsecond, corresponding to a distance of 1 gigaparsec.
 */
 
-   if (del_n_pts != 0L)
-   {
-      if (!first_call)
-      {
-         free (t);
-         free (ra);
-      }
-
-      t = (double *) calloc ((size_t) n_pts, double_size);
-      if (t == NULL )
-      {
-         fclose (cio_file);
-         return (error = 4);
-      }
-
-      ra = (double *) calloc ((size_t) n_pts, double_size);
-      if (ra == NULL )
-      {
-         free (t);
-         fclose (cio_file);
-         return (error = 5);
-      }
-
-      first_call = 0;
-   }
+   paralx = incat->parallax;
+   if (paralx <= 0.0)
+      paralx = 1.0e-6;
 
 /*
-   Calculate the record number of the record immediately preceding
-   the date of interest: the "index record".
+   Convert right ascension, declination, and parallax to position
+   vector in equatorial system with units of AU.
 */
 
-   index_rec = (long int) ((jd_tdb - jd_beg) / t_int) + 1L;
+   dist = 1.0 / sin (paralx * 1.0e-3 * ASEC2RAD);
+   r = incat->ra * 54000.0 * ASEC2RAD;
+   d = incat->dec * 3600.0 * ASEC2RAD;
+   cra = cos (r);
+   sra = sin (r);
+   cdc = cos (d);
+   sdc = sin (d);
+   pos1[0] = dist * cdc * cra;
+   pos1[1] = dist * cdc * sra;
+   pos1[2] = dist * sdc;
 
 /*
-   Test the range of 'n_pts' values centered on 'index_rec' to be sure
-   the range of values requested falls within the file limits.
+   Compute Doppler factor, which accounts for change in light
+   travel time to star.
 */
 
-   half_int = (n_pts / 2L) - 1L;
-   lo_limit = index_rec - half_int;
-   hi_limit = index_rec + (n_pts - half_int - 1L);
-
-   if ((lo_limit < 1L) || (hi_limit > n_recs))
-      return (error = 6);
+   k = 1.0 / (1.0 - incat->radialvelocity / C * 1000.0);
 
 /*
-   Compute the number of bytes from the beginning of the file to
-   the 'lo_limit'.
+   Convert proper motion and radial velocity to orthogonal components
+   of motion, in spherical polar system at star's original position,
+   with units of AU/day.
 */
 
-   bytes_to_lo = header_size + (lo_limit - 1L) * record_size;
+   term1 = paralx * 365.25;
+   pmr = incat->promora  / term1 * k;
+   pmd = incat->promodec / term1 * k;
+   rvl = incat->radialvelocity * 86400.0 / AU_KM * k;
 
 /*
-   Compare the current index record with the previous index record.
+   Transform motion vector to equatorial system.
 */
 
-   del_index = index_rec - last_index_rec;
-   abs_del_index = abs (del_index);
-
-/*
-   Determine the file read strategy.
-*/
+   vel1[0] = - pmr * sra - pmd * sdc * cra + rvl * cdc * cra;
+   vel1[1] =   pmr * cra - pmd * sdc * sra + rvl * cdc * sra;
+   vel1[2] =               pmd * cdc       + rvl * sdc;
 
 /*
-   Case 1: The input value of 'n_pts' changed since the last entry,
-   or there are no data in the current arrays that can be re-used in the
-   new arrays.  In this case, read all new data points into the arrays.
+   Update star's position vector for space motion (only if 'option' = 1
+   or 'option' = 3).
 */
 
-   if ((abs_del_index > n_pts) || (del_n_pts != 0))
+   if ((option == 1) || (option == 3))
    {
-      fseek (cio_file, bytes_to_lo, SEEK_SET);
-
-      for (i = 0L; i < n_pts; i++)
+      for (j = 0; j < 3; j++)
       {
-         fread (&t[i], double_size, (size_t) 1, cio_file);
-         fread (&ra[i], double_size, (size_t) 1, cio_file);
+         pos2[j] = pos1[j] + vel1[j] * (jd_newcat - jd_incat);
+         vel2[j] = vel1[j];
       }
    }
-
-/*
-   Case 2: The new index is close enough to the previous index that
-   there are some data in the current arrays that can be re-used
-   in the new arrays.  The remaining data will be read from the CIO
-   file.
-
-   Note that if the new index is the same as the previous index (i.e.,
-   'del_index' == 0), neither Case 2a nor 2b is satisfied, and the
-   program flow goes directly to load the output arrays with the same
-   values as in the current arrays.
-*/
-
-    else if ((abs_del_index <= n_pts) && (del_n_pts == 0))
-   {
-      n_swap = abs (n_pts - abs_del_index);
-      n_read = abs_del_index;
-
-/*
-   Case 2a: The new index is less than the previous one.  Put the "old"
-   data at the end of the new arrays, and read "new" data into the
-   beginning of the new arrays.
-*/
-
-      if (del_index < 0L)
-      {
-         for (i = 0L; i < n_swap; i++)
-         {
-            t_temp = t[i];
-            ra_temp = ra[i];
-
-            j = i + abs_del_index;
-            t[j] = t_temp;
-            ra[j] = ra_temp;
-         }
-
-         fseek (cio_file, bytes_to_lo, SEEK_SET);
-
-         for (i = 0L; i < n_read; i++)
-         {
-            fread (&t[i], double_size, (size_t) 1, cio_file);
-            fread (&ra[i], double_size, (size_t) 1, cio_file);
-         }
-      }
-
-/*
-   Case 2b: The new index is greater than the previous one.  Put the
-   "old" data at the beginning of the new arrays, and read "new" data
-   into the end of the new arrays.
-*/
-
-       else if (del_index > 0L)
-      {
-         for (i = 0L; i < n_swap; i++)
-         {
-            j = i + abs_del_index;
-            t_temp = t[j];
-            ra_temp = ra[j];
-
-            t[i] = t_temp;
-            ra[i] = ra_temp;
-         }
-
-         fseek (cio_file, bytes_to_lo + (n_swap * record_size),
-            SEEK_SET);
-
-         j = i++;
-         for (i = j; i < n_pts; i++)
-         {
-            fread (&t[i], double_size, (size_t) 1, cio_file);
-            fread (&ra[i], double_size, (size_t) 1, cio_file);
-         }
+    else
+   {
+      for (j = 0; j < 3; j++)
+      {
+           pos2[j] = pos1[j];
+           vel2[j] = vel1[j];
       }
    }
 
 /*
-   Load the output 'cio' array with the values in the 't' and 'ra'
-   arrays.
-
-   Note that if the input value of 'n_pts' has not changed since the
-   last entry, all data in the current arrays can be re-used in
-   the new arrays. The if statements above are bypassed and the new
-   arrays are the same as the current arrays.
+   Precess position and velocity vectors (only if 'option' = 2 or
+   'option' = 3).
 */
 
-   for (i = 0L; i < n_pts; i++)
+   if ((option == 2) || (option == 3))
    {
-      cio[i].jd_tdb = t[i];
-      cio[i].ra_cio = ra[i];
+      for (j = 0; j < 3; j++)
+      {
+           pos1[j] = pos2[j];
+           vel1[j] = vel2[j];
+      }
+      if ((error = precession_ctx (ctx,jd_incat,pos1,jd_newcat,
+         pos2)) != 0) return (error);
+      precession_ctx (ctx,jd_incat,vel1,jd_newcat, vel2);
    }
 
 /*
-   Set values of 'last_index_rec' and 'last_n_pts'.
+   Rotate dynamical J2000.0 position and velocity vectors to ICRS
+   (only if 'option' = 4).
 */
 
-   last_index_rec = index_rec;
-   last_n_pts = n_pts;
-
-   return (error);
-}
-
-/********ira_equinox */
+   if (option == 4)
+   {
+      frame_tie_ctx (ctx,pos1,-1, pos2);
+      frame_tie_ctx (ctx,vel1,-1, vel2);
+   }
 
-double ira_equinox (double jd_tdb, short int equinox,
-                    short int accuracy)
 /*
-------------------------------------------------------------------------
-
-   PURPOSE:
-      To compute the intermediate right ascension of the equinox at
-      the input Julian date, using an analytical expression for the
-      accumulated precession in right ascension.  For the true equinox,
-      the result is the equation of the origins.
-
-   REFERENCES:
-      Capitaine, N. et al. (2003), Astronomy and Astrophysics 412,
-         567-586, eq. (42).
+   Rotate ICRS position and velocity vectors to dynamical J2000.0
+   (only if 'option' = 5).
+*/
+   if (option == 5)
+   {
+      frame_tie_ctx (ctx,pos1,1, pos2);
+      frame_tie_ctx (ctx,vel1,1, vel2);
+   }
 
-   INPUT
-   ARGUMENTS:
-      jd_tdb (double)
-         TDB Julian date.
-      equinox (short int)
-         Equinox selection flag:
-            = 0 ... mean equinox
-            = 1 ... true equinox.
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+/*
+   Convert vectors back to angular components for output.
 
-   OUTPUT
-   ARGUMENTS:
-      None.
+   From updated position vector, obtain star's new position expressed
+   as angular quantities.
+*/
 
-   RETURNED
-   VALUE:
-      (double)
-         Intermediate right ascension of the equinox, in hours (+ or -).
-         If 'equinox' = 1 (i.e true equinox), then the returned value is
-         the equation of the origins.
+   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
 
-   GLOBALS
-   USED:
-      T0                 novascon.c
+   if (xyproj > 0.0)
+      r = atan2 (pos2[1], pos2[0]);
+    else
+      r = 0.0;
+   newcat->ra = r / ASEC2RAD / 54000.0;
+   if (newcat->ra < 0.0)
+      newcat->ra += 24.0;
+   if (newcat->ra >= 24.0)
+      newcat->ra -= 24.0;
 
-   FUNCTIONS
-   CALLED:
-      e_tilt             novas.c
-      fabs               math.h
+   d = atan2 (pos2[2], xyproj);
+   newcat->dec = d / ASEC2RAD / 3600.0;
 
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/07-06/JAB (USNO/AA)
+   dist = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1] +
+      pos2[2] * pos2[2]);
 
-   NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'eqxra'.
+   paralx = asin (1.0 / dist) / ASEC2RAD * 1000.0;
+   newcat->parallax = paralx;
 
-------------------------------------------------------------------------
+/*
+   Transform motion vector back to spherical polar system at star's
+   new position.
 */
-{
-   static short int acc_last = 99;
 
-   static double t_last = 0.0;
-   static double eq_eq = 0.0;
-   double t, u, v, w, x, prec_ra, ra_eq;
+   cra = cos (r);
+   sra = sin (r);
+   cdc = cos (d);
+   sdc = sin (d);
+   pmr = - vel2[0] * sra       + vel2[1] * cra;
+   pmd = - vel2[0] * cra * sdc - vel2[1] * sra * sdc + vel2[2] * cdc;
+   rvl =   vel2[0] * cra * cdc + vel2[1] * sra * cdc + vel2[2] * sdc;
 
 /*
-   Compute time in Julian centuries.
+   Convert components of motion to from AU/day to normal catalog units.
 */
 
-   t = (jd_tdb - T0 ) / 36525.0;
+   newcat->promora  = pmr * paralx * 365.25 / k;
+   newcat->promodec = pmd * paralx * 365.25 / k;
+   newcat->radialvelocity = rvl * (AU_KM / 86400.0) / k;
 
 /*
-   For the true equinox, obtain the equation of the equinoxes in time
-   seconds, which includes the 'complementary terms'.
+  Take care of zero-parallax case.
 */
 
-   if (equinox == 1)
-   {
-      if (((fabs (jd_tdb - t_last)) > 1.0e-8) || (accuracy != acc_last))
-      {
-         e_tilt (jd_tdb,accuracy, &u, &v, &eq_eq, &w, &x);
-         t_last = jd_tdb;
-         acc_last = accuracy;
-      }
-   }
-    else
+   if (newcat->parallax <= 1.01e-6)
    {
-      eq_eq = 0.0;
+      newcat->parallax = 0.0;
+      newcat->radialvelocity = incat->radialvelocity;
    }
 
 /*
-   Precession in RA in arcseconds taken from the reference.
+   Set the catalog identification code for the transformed catalog
+   entry.
 */
 
-   prec_ra = 0.014506 +
-      (((( -    0.0000000368   * t
-           -    0.000029956  ) * t
-           -    0.00000044   ) * t
-           +    1.3915817    ) * t
-           + 4612.156534     ) * t;
+   if ((short int) strlen (newcat_id) > SIZE_OF_CAT_NAME - 1)
+      return (2);
+    else
+      strcpy (newcat->catalog, newcat_id);
+
+/*
+   Copy unchanged quantities from the input catalog entry to the
+   transformed catalog entry.
+*/
 
-   ra_eq = - (prec_ra / 15.0 + eq_eq) / 3600.0;
+   strcpy (newcat->starname, incat->starname);
+   newcat->starnumber = incat->starnumber;
 
-   return (ra_eq);
+   return (error);
 }
 
-/********ephemeris */
+/********limb_angle */
 
-short int ephemeris (double jd[2], object *cel_obj, short int origin,
-                     short int accuracy,
+void limb_angle (double pos_obj[3], double pos_obs[3],
 
-                     double *pos, double *vel)
+                 double *limb_ang, double *nadir_ang)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Retrieves the position and velocity of a solar system body from
-      a fundamental ephemeris.
+      This function determines the angle of an object above or below
+      the Earth's limb (horizon).  The geometric limb is computed,
+      assuming the Earth to be an airless sphere (no refraction or
+      oblateness is included).  The observer can be on or above the
+      Earth.  For an observer on the surface of the Earth, this
+      function returns the approximate unrefracted altitude.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      jd[2] (double)
-         TDB Julian date split into two parts, where the sum
-         jd[0] + jd[1] is the TDB Julian date.
-      *cel_obj (struct object)
-         Pointer to structure containing the designation of the body
-         of interest (defined in novas.h).
-      origin (short int)
-         Origin code
-            = 0 ... solar system barycenter
-            = 1 ... center of mass of the Sun
-      accuracy (short int)
-         Selection for accuracy
-            = 0 ... full accuracy
-            = 1 ... reduced accuracy
+      pos_obj[3] (double)
+         Position vector of observed object, with respect to origin at
+         geocenter, components in AU.
+      pos_obs[3] (double)
+         Position vector of observer, with respect to origin at
+         geocenter, components in AU.
 
    OUTPUT
    ARGUMENTS:
-      pos[3] (double)
-         Position vector of the body at 'jd_tdb'; equatorial rectangular
-         coordinates in AU referred to the ICRS.
-      vel[3] (double)
-         Velocity vector of the body at 'jd_tdb'; equatorial rectangular
-         coordinates in AU/day referred to the ICRS.
+      *limb_ang (double)
+         Angle of observed object above (+) or below (-) limb
+         in degrees.
+      *nadir_ang (double)
+         Nadir angle of observed object as a fraction of apparent
+         radius of limb:
+            < 1.0 ... below the limb
+            = 1.0 ... on the limb
+            > 1.0 ... above the limb
+
 
    RETURNED
    VALUE:
-      (short int)
-         0    ... Everything OK.
-         1    ... Invalid value of 'origin'.
-         2    ... Invalid value of 'type' in 'cel_obj'.
-         3    ... Unable to allocate memory.
-         10+n ... where n is the error code from 'solarsystem'.
-         20+n ... where n is the error code from 'readeph'.
+      None.
 
    GLOBALS
    USED:
-      None.
+      TWOPI, ERAD        novascon.c
+      AU, RAD2DEG        novascon.c
 
    FUNCTIONS
    CALLED:
-      solarsystem         novas.c
-      solarsystem_hp      novas.c
-      readeph             readeph.c
-      strlen              string.h
-      strcpy              string.h
-      malloc              stdlib.h
-      free                stdlib.h
-
-   VER./DATE/
-   PROGRAMMER:
-      V1.0/06-97/JAB (USNO/AA)
-      V1.1/10-97/JAB (USNO/AA): Support error code from 'readeph'.
-      V1.2/08-98/JAB (USNO/AA): Add computation of barycentric
-                                coordinates of a minor planet; support
-                                new 'readeph' argument list.
-      V1.3/12-99/JAB (USNO/AA): Add error handling to call to
-                                'solarsystem' (case 1).
-      V1.4/12-02/JAB (USNO/AA): Fix memory leaks with 'posvel' (case 1).
-      V1.5/10-08/JAB (USNO/AA): Incorporate higher-precision call to
-                                the solar system ephemeris, primarily
-                                to support light-time calculations.
-      V1.6/02-11/JLB (USNO/AA): Reformatted description of origin for
-                                consistency with other documentation.
-
-   NOTES:
-      1. It is recommended that the input structure 'cel_obj' be
-      created using function 'make_object' in file novas.c.
-
-------------------------------------------------------------------------
-*/
-{
-   char *mp_name;
-
-   int err = 0;
-   int mp_number;
-
-   short int error = 0;
-   short int ss_number, i;
-
-   double jd_tdb, *posvel, *sun_pos, *sun_vel;
-
-   size_t name_len;
-
-/*
-   Check the value of 'origin'.
-*/
+      sqrt               math.h
+      asin               math.h
+      acos               math.h
 
-   if ((origin < 0) || (origin > 1))
-      return (error = 1);
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-04/JAB (USNO/AA)
+      V1.1/10-26/ROA:           No static variables, so that the
+                                function is re-entrant.
 
-/*
-   Invoke the appropriate ephemeris access software depending upon the
-   type of object.
+   NOTES:
+      1.This function is the C version of NOVAS Fortran routine
+      'limang'.
+
+------------------------------------------------------------------------
 */
+{
+   double pi, halfpi, rade, disobj, disobs, aprad, zdlim, coszd, zdobj;
 
-   switch (cel_obj->type)
-   {
+   pi = TWOPI / 2.0;
+   halfpi = pi / 2.0;
+   rade = ERAD / AU;
 
 /*
-   Get the position and velocity of a major planet, Pluto, Sun, or Moon.
-   When high accuracy is specified, use function 'solarsystem_hp' rather
-   than 'solarsystem'.
+   Compute the distance to the object and the distance to the observer.
 */
 
-      case 0:
-         ss_number = cel_obj->number;
+   disobj = sqrt (pos_obj[0] * pos_obj[0] +
+                  pos_obj[1] * pos_obj[1] +
+                  pos_obj[2] * pos_obj[2]);
 
-         if (accuracy == 0)
-         {
-            if ((error = solarsystem_hp (jd,ss_number,origin, pos,vel))
-               != 0)
-               error += 10;
-         }
-          else
-         {
-            jd_tdb = jd[0] + jd[1];
-            if ((error = solarsystem (jd_tdb,ss_number,origin, pos,vel))
-            != 0)
-            error += 10;
-         }
-         break;
+   disobs = sqrt (pos_obs[0] * pos_obs[0] +
+                  pos_obs[1] * pos_obs[1] +
+                  pos_obs[2] * pos_obs[2]);
 
 /*
-   Get the position and velocity of a minor planet.
-
+   Compute apparent angular radius of Earth's limb.
 */
 
-      case 1:
-         mp_number = (int) cel_obj->number;
-
-         name_len = (strlen (cel_obj->name) + 1L) * sizeof (char);
-         mp_name = (char *) malloc (name_len);
-         if (mp_name == NULL)
-            return (error = 3);
-         strcpy (mp_name, cel_obj->name);
+   if (disobs >= rade)
+   {
+      aprad = asin (rade / disobs);
+   }
+    else
+   {
+      aprad = halfpi;
+   }
 
-/*  The USNO minor planet software returns heliocentric positions and
-    velocities.
+/*
+   Compute zenith distance of Earth's limb.
 */
 
-         jd_tdb = jd[0] + jd[1];
-         posvel = readeph (mp_number,mp_name,jd_tdb, &err);
-         if (posvel == NULL)
-         {
-            free (mp_name);
-            return (error = 3);
-         }
-
-         if (err != 0)
-         {
-            free (mp_name);
-            free (posvel);
-            return ((short int) (20 + err));
-         }
+   zdlim = pi - aprad;
 
-/*  Barycentric coordinates of the minor planet, if desired, are
-    computed via the barycentric coordinates of the Sun, obtained
-    from the solar system ephemeris.
+/*
+   Compute zenith distance of observed object.
 */
 
-         if (origin == 0)
-         {
-            sun_pos = (double *) malloc (3L * sizeof (double));
-            if (sun_pos == NULL)
-            {
-               free (mp_name);
-               free (posvel);
-               return (error = 3);
-            }
-
-            sun_vel = (double *) malloc (3L * sizeof (double));
-            if (sun_vel == NULL)
-            {
-               free (mp_name);
-               free (posvel);
-               free (sun_pos);
-               return (error = 3);
-            }
-
-            if ((error = solarsystem (jd_tdb,10,0, sun_pos,sun_vel)) != 0)
-            {
-               free (mp_name);
-               free (posvel);
-               free (sun_pos);
-               free (sun_vel);
-               return (error += 10);
-            }
-
-            for (i = 0; i < 3; i++)
-            {
-               posvel[i] += sun_pos[i];
-               posvel[i+3] += sun_vel[i];
-            }
+   coszd = (pos_obj[0] * pos_obs[0] + pos_obj[1] * pos_obs[1] +
+      pos_obj[2] * pos_obs[2]) / (disobj * disobs);
 
-            free (sun_pos);
-            free (sun_vel);
-         }
+   if (coszd <= -1.0)
+   {
+      zdobj = pi;
+   }
+    else if (coszd >= 1.0)
+   {
+      zdobj = 0.0;
+   }
+    else
+   {
+      zdobj = acos (coszd);
+   }
 
 /*
-   Break up 'posvel' into separate position and velocity vectors.
+   Angle of object wrt limb is difference in zenith distances.
 */
 
-         for (i = 0; i < 3; i++)
-         {
-            pos[i] = posvel[i];
-            vel[i] = posvel[i+3];
-         }
-
-         free (mp_name);
-         free (posvel);
-         break;
+   *limb_ang = (zdlim - zdobj) * RAD2DEG;
 
 /*
-   Invalid type of object.
+   Nadir angle of object as a fraction of angular radius of limb.
 */
 
-      default:
-         error = 2;
-         break;
-
-   }
+   *nadir_ang = (pi - zdobj) / aprad;
 
-   return (error);
+   return;
 }
 
-/********transform_hip */
-
-void transform_hip (cat_entry *hipparcos,
+/********refract */
 
-                    cat_entry *hip_2000)
+double refract (on_surface *location, short int ref_option,
+                double zd_obs)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To convert Hipparcos catalog data at epoch J1991.25 to epoch
-      J2000.0, for use within NOVAS.  To be used only for Hipparcos or
-      Tycho stars with linear space motion.  Both input and output data
-      is in the ICRS.
+      This function computes atmospheric refraction in zenith
+      distance.  This version computes approximate refraction for
+      optical wavelengths.
 
    REFERENCES:
-      None.
+      Explanatory Supplement to the Astronomical Almanac, p. 144.
+      Bennett, G. (1982), Journal of Navigation (Royal Institute) 35,
+         pp. 255-259.
 
    INPUT
    ARGUMENTS:
-      *hipparcos (struct cat_entry)
-         An entry from the Hipparcos catalog, at epoch J1991.25, with
-         all members having Hipparcos catalog units.  See Note 1
-         below (struct defined in novas.h).
+      *location (struct on_surface)
+         Pointer to structure containing observer's location.  This
+         structure also contains weather data (optional) for the
+         observer's location (defined in novas.h).
+      ref_option (short int)
+         = 1 ... Use 'standard' atmospheric conditions.
+         = 2 ... Use atmospheric parameters input in the 'location'
+                 structure.
+      zd_obs (double)
+         Observed zenith distance, in degrees.
 
    OUTPUT
    ARGUMENTS:
-      *hip_2000 (struct cat_entry)
-         The transformed input entry, at epoch J2000.0.  See Note 2
-         below (struct defined in novas.h).
-
+      None.
 
    RETURNED
    VALUE:
-      None.
+      (double)
+         Atmospheric refraction, in degrees.
 
    GLOBALS
    USED:
-      T0                 novascon.c
+      DEG2RAD            novascon.c
 
    FUNCTIONS
    CALLED:
-      transform_cat      novas.c
+      exp                math.h
+      tan                math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-98/JAB (USNO/AA)
-      V1.1/11-03/JAB (USNO/AA) Update for ICRS
+      V1.0/06-98/JAB (USNO/AA)
 
    NOTES:
-      1. Input (Hipparcos catalog) epoch and units:
-         Epoch: J1991.25
-         Right ascension (RA): degrees
-         Declination (Dec): degrees
-         Proper motion in RA: milliarcseconds per year
-         Proper motion in Dec: milliarcseconds per year
-         Parallax: milliarcseconds
-         Radial velocity: kilometers per second (not in catalog)
-      2. Output (modified Hipparcos) epoch and units:
-         Epoch: J2000.0
-         Right ascension: hours
-         Declination: degrees
-         Proper motion in RA: milliarcseconds per year
-         Proper motion in Dec: milliarcseconds per year
-         Parallax: milliarcseconds
-         Radial velocity: kilometers per second
-      3. This function is the C version of NOVAS Fortran routine
-         'gethip'.
+      1. This function can be used for planning observations or
+      telescope pointing, but should not be used for the reduction
+      of precise observations.
+      2. This function is the C version of NOVAS Fortran routine
+      'refrac'.
 
 ------------------------------------------------------------------------
 */
 {
-   const double epoch_hip = 2448349.0625;
 
-   cat_entry scratch;
+/*
+   's' is the approximate scale height of atmosphere in meters.
+*/
+
+   const double s = 9.1e3;
+   double refr, p, t, h, r;
+
+/*
+   Compute refraction only for zenith distances between 0.1 and
+   91 degrees.
+*/
+
+   if ((zd_obs < 0.1) || (zd_obs > 91.0))
+      refr = 0.0;
+    else
+   {
+
+/*
+   If observed weather data are available, use them.  Otherwise, use
+   crude estimates of average conditions.
+*/
+
+      if (ref_option == 2)
+      {
+         p = location->pressure;
+         t = location->temperature;
+      }
+       else
+      {
+         p = 1010.0 * exp (-location->height / s);
+         t = 10.0;
+      }
+
+      h = 90.0 - zd_obs;
+      r = 0.016667 / tan ((h + 7.31 / (h + 4.4)) * DEG2RAD);
+      refr = r * (0.28 * p / (t + 273.0));
+   }
+
+   return (refr);
+}
+
+/********julian_date */
+
+double julian_date (short int year, short int month, short int day,
+                    double hour)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function will compute the Julian date for a given calendar
+      date (year, month, day, hour).
+
+   REFERENCES:
+      Fliegel, H. & Van Flandern, T.  Comm. of the ACM, Vol. 11, No. 10,
+         October 1968, p. 657.
+
+   INPUT
+   ARGUMENTS:
+      year (short int)
+         Year.
+      month (short int)
+         Month number.
+      day (short int)
+         Day-of-month.
+      hour (double)
+         Hour-of-day.
 
-/*
-   Set up a "scratch" catalog entry containing Hipparcos data in
-   "NOVAS units."
-*/
+   OUTPUT
+   ARGUMENTS:
+      None.
 
-   strcpy (scratch.starname, hipparcos->starname);
-   scratch.starnumber = hipparcos->starnumber;
-   scratch.dec = hipparcos->dec;
-   scratch.promora = hipparcos->promora;
-   scratch.promodec = hipparcos->promodec;
-   scratch.parallax = hipparcos->parallax;
-   scratch.radialvelocity = hipparcos->radialvelocity;
+   RETURNED
+   VALUE:
+      (double)
+         Julian date.
 
-   strcpy (scratch.catalog, "SCR");
+   GLOBALS
+   USED:
+      None.
 
-/*
-   Convert right ascension from degrees to hours.
-*/
+   FUNCTIONS
+   CALLED:
+      None.
 
-   scratch.ra = hipparcos->ra / 15.0;
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/06-98/JAB (USNO/AA)
+      V1.1/03-08/WKP (USNO/AA) Updated prolog.
 
-/*
-   Change the epoch of the Hipparcos data from J1991.25 to J2000.0.
+   NOTES:
+      1. This function is the C version of NOVAS Fortran routine
+      'juldat'.
+      2. This function makes no checks for a valid input calendar
+      date.
+      3. Input calendar date must be Gregorian.
+      4. Input time value can be based on any UT-like time scale
+      (UTC, UT1, TT, etc.) - output Julian date will have the same basis.
+------------------------------------------------------------------------
 */
+{
+   long int jd12h;
 
-   transform_cat (1,epoch_hip,&scratch,T0,"HP2", hip_2000);
+   double tjd;
 
-   return;
+   jd12h = (long) day - 32075L + 1461L * ((long) year + 4800L
+      + ((long) month - 14L) / 12L) / 4L
+      + 367L * ((long) month - 2L - ((long) month - 14L) / 12L * 12L)
+      / 12L - 3L * (((long) year + 4900L + ((long) month - 14L) / 12L)
+      / 100L) / 4L;
+   tjd = (double) jd12h - 0.5 + hour / 24.0;
+
+   return (tjd);
 }
 
-/********transform_cat */
+/********cal_date */
 
-short int transform_cat (short int option, double date_incat,
-                         cat_entry *incat, double date_newcat,
-                         char *newcat_id,
+void cal_date (double tjd,
 
-                         cat_entry *newcat)
+               short int *year, short int *month, short int *day,
+               double *hour)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To transform a star's catalog quantities for a change of epoch
-      and/or equator and equinox.  Also used to rotate catalog
-      quantities on the dynamical equator and equinox of J2000.0 to the
-      ICRS or vice versa.
+      This function will compute a date on the Gregorian calendar given
+      the Julian date.
 
    REFERENCES:
-      None.
+      Fliegel, H. & Van Flandern, T.  Comm. of the ACM, Vol. 11, No. 10,
+         October 1968, p. 657.
 
    INPUT
    ARGUMENTS:
-      option (short int)
-         Transformation option
-            = 1 ... change epoch; same equator and equinox
-            = 2 ... change equator and equinox; same epoch
-            = 3 ... change equator and equinox and epoch
-            = 4 ... change equator and equinox J2000.0 to ICRS
-            = 5 ... change ICRS to equator and equinox of J2000.0
-      date_incat (double)
-         TT Julian date, or year, of input catalog data.
-      *incat (struct cat_entry)
-         An entry from the input catalog, with units as given in
-         the struct definition (struct defined in novas.h).
-      date_newcat (double)
-         TT Julian date, or year, of transformed catalog data.
-      newcat_id[SIZE_OF_CAT_NAME] (char)
-         Catalog identifier ((SIZE_OF_CAT_NAME - 1) characters maximum)
-         e.g. HIP = Hipparcos, TY2 = Tycho-2.
+      tjd (double)
+         Julian date.
 
    OUTPUT
    ARGUMENTS:
-      *newcat (struct cat_entry)
-         The transformed catalog entry, with units as given in
-         the struct definition (struct defined in novas.h).
+      *year (short int)
+         Year.
+      *month (short int)
+         Month number.
+      *day (short int)
+         Day-of-month.
+      *hour (double)
+         Hour-of-day.
 
    RETURNED
    VALUE:
-      = 0 ... Everything OK.
-      = 1 ... Invalid value of an input date for option 2 or 3 (see
-              Note 1 below).
-      = 2 ... length of 'newcat_id' out of bounds.
+      None.
 
    GLOBALS
    USED:
-      SIZE_OF_CAT_NAME   novas.h
-      T0, ASEC2RAD       novascon.c
-      AU_KM, C           novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      precession         novas.c
-      frame_tie          novas.c
-      sin                math.h
-      cos                math.h
-      sqrt               math.h
-      atan2              math.h
-      asin               math.h
-      strcpy             string.h
+      fmod               math.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-98/JAB (USNO/AA)
-      V1.1/11-03/JAB (USNO/AA) Update for ICRS; add options 4 and 5.
-      V1.2/06-08/WKP (USNO/AA) Changed 'a[3]' to 'd', added Doppler factor,
-                               and corrected 'frame_tie' direction.
-      V1.3/06-08/JAB (USNO/AA) Error check on dates for options 2 and 3.
-      V1.4/02-11/WKP (USNO/AA) Implement SIZE_OF_CAT_NAME.
+      V1.0/06-98/JAB (USNO/AA)
 
    NOTES:
-      1. 'date_incat' and 'date_newcat' may be specified either as a
-      Julian date (e.g., 2433282.5) or a Julian year and fraction
-      (e.g., 1950.0).  Values less than 10000 are assumed to be years.
-      For 'option' = 2 or 'option' = 3, either 'date_incat' or
-      'date_newcat' must be 2451545.0 or 2000.0 (J2000.0).  For
-      'option' = 4 and 'option' = 5, 'date_incat' and 'date_newcat'
-      are ignored.
-      2. 'option' = 1 updates the star's data to account for the
-      star's space motion between the first and second dates, within a
-      fixed reference frame.
-         'option' = 2 applies a rotation of the reference frame
-      corresponding to precession between the first and second dates,
-      but leaves the star fixed in space.
-         'option' = 3 provides both transformations.
-         'option' = 4 and 'option' = 5 provide a a fixed rotation
-      about very small angles (<0.1 arcsecond) to take data from the
-      dynamical system of J2000.0 to the ICRS ('option' = 4) or vice
-      versa ('option' = 5).
-      3. For 'option' = 1, input data can be in any fixed reference
-      system. for 'option' = 2 or 'option' = 3, this function assumes
-      the input data is in the dynamical system and produces output in
-      the dynamical system.  for 'option' = 4, the input data must be
-      on the dynamical equator and equinox of J2000.0.  for
-     'option' = 5, the input data must be in the ICRS.
-      4. This function cannot be properly used to bring data from
-      old star catalogs into the modern system, because old catalogs
-      were compiled using a set of constants that are
-      incompatible with modern values.  In particular, it should not
-      be used for catalogs whose positions and proper motions were
-      derived by assuming a precession constant significantly different
-      from the value implicit in function 'precession'.
-      5. This function is the C version of NOVAS Fortran routine
-      'catran'.
-      6. SIZE_OF_CAT_NAME is defined in novas.h.
+      1. This routine valid for any 'jd' greater than zero.
+      2. Input Julian date can be based on any UT-like time scale
+      (UTC, UT1, TT, etc.) - output time value will have same basis.
+      3. This function is the C version of NOVAS Fortran routine
+      'caldat'.
+
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int j;
+   long int jd, k, m, n;
 
-   double jd_incat, jd_newcat, paralx, dist, r, d, cra, sra, cdc,
-      sdc, k, pos1[3], term1, pmr, pmd, rvl, vel1[3], pos2[3],
-      vel2[3], xyproj;
+   double djd;
 
-/*
-   If necessary, compute Julian dates.
+   djd = tjd + 0.5;
+   jd = (long int) djd;
 
-   This function uses TDB Julian dates internally, but no
-   distinction between TDB and TT is necessary.
-*/
+   *hour = fmod (djd,1.0) * 24.0;
 
-   if (date_incat < 10000.0)
-      jd_incat = T0 + (date_incat - 2000.0) * 365.25;
-    else
-      jd_incat = date_incat;
+   k     = jd + 68569L;
+   n     = 4L * k / 146097L;
 
-   if (date_newcat < 10000.0)
-      jd_newcat = T0 + (date_newcat - 2000.0) * 365.25;
-    else
-      jd_newcat = date_newcat;
+   k     = k - (146097L * n + 3L) / 4L;
+   m     = 4000L * (k + 1L) / 1461001L;
+   k     = k - 1461L * m / 4L + 31L;
 
-/*
-   Convert input angular components to vectors
+   *month = (short int) (80L * k / 2447L);
+   *day   = (short int) (k - 2447L * (long int) *month / 80L);
+   k      = (long int) *month / 11L;
 
-   If parallax is unknown, undetermined, or zero, set it to 1.0e-6
-   milliarcsecond, corresponding to a distance of 1 gigaparsec.
-*/
+   *month = (short int) ((long int) *month + 2L - 12L * k);
+   *year  = (short int) (100L * (n - 49L) + m + k);
 
-   paralx = incat->parallax;
-   if (paralx <= 0.0)
-      paralx = 1.0e-6;
+   return;
+}
+
+/********norm_ang */
 
+double norm_ang (double angle)
 /*
-   Convert right ascension, declination, and parallax to position
-   vector in equatorial system with units of AU.
-*/
+------------------------------------------------------------------------
 
-   dist = 1.0 / sin (paralx * 1.0e-3 * ASEC2RAD);
-   r = incat->ra * 54000.0 * ASEC2RAD;
-   d = incat->dec * 3600.0 * ASEC2RAD;
-   cra = cos (r);
-   sra = sin (r);
-   cdc = cos (d);
-   sdc = sin (d);
-   pos1[0] = dist * cdc * cra;
-   pos1[1] = dist * cdc * sra;
-   pos1[2] = dist * sdc;
+   PURPOSE:
+      Normalize angle into the range 0 <= angle < (2 * pi).
 
-/*
-   Compute Doppler factor, which accounts for change in light
-   travel time to star.
-*/
+   REFERENCES:
+      None.
 
-   k = 1.0 / (1.0 - incat->radialvelocity / C * 1000.0);
+   INPUT
+   ARGUMENTS:
+      angle (double)
+         Input angle (radians).
 
-/*
-   Convert proper motion and radial velocity to orthogonal components
-   of motion, in spherical polar system at star's original position,
-   with units of AU/day.
-*/
+   OUTPUT
+   ARGUMENTS:
+      None.
 
-   term1 = paralx * 365.25;
-   pmr = incat->promora  / term1 * k;
-   pmd = incat->promodec / term1 * k;
-   rvl = incat->radialvelocity * 86400.0 / AU_KM * k;
+   RETURNED
+   VALUE:
+      (double)
+          The input angle, normalized as described above (radians).
 
-/*
-   Transform motion vector to equatorial system.
-*/
+   GLOBALS
+   USED:
+      TWOPI              novascon.c
 
-   vel1[0] = - pmr * sra - pmd * sdc * cra + rvl * cdc * cra;
-   vel1[1] =   pmr * cra - pmd * sdc * sra + rvl * cdc * sra;
-   vel1[2] =               pmd * cdc       + rvl * sdc;
+   FUNCTIONS
+   CALLED:
+      fmod               math.h
 
-/*
-   Update star's position vector for space motion (only if 'option' = 1
-   or 'option' = 3).
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/09-03/JAB (USNO/AA)
 
-   if ((option == 1) || (option == 3))
-   {
-      for (j = 0; j < 3; j++)
-      {
-         pos2[j] = pos1[j] + vel1[j] * (jd_newcat - jd_incat);
-         vel2[j] = vel1[j];
-      }
-   }
-    else
-   {
-      for (j = 0; j < 3; j++)
-      {
-           pos2[j] = pos1[j];
-           vel2[j] = vel1[j];
-      }
-   }
+   NOTES:
+      None.
 
-/*
-   Precess position and velocity vectors (only if 'option' = 2 or
-   'option' = 3).
+------------------------------------------------------------------------
 */
+{
+   double a;
 
-   if ((option == 2) || (option == 3))
-   {
-      for (j = 0; j < 3; j++)
-      {
-           pos1[j] = pos2[j];
-           vel1[j] = vel2[j];
-      }
-      if ((error = precession (jd_incat,pos1,jd_newcat, pos2)) != 0)
-         return (error);
-      precession (jd_incat,vel1,jd_newcat, vel2);
-   }
+   a = fmod (angle,TWOPI);
+   if (a < 0.0)
+         a += TWOPI;
 
-/*
-   Rotate dynamical J2000.0 position and velocity vectors to ICRS
-   (only if 'option' = 4).
-*/
+   return (a);
+}
 
-   if (option == 4)
-   {
-      frame_tie (pos1,-1, pos2);
-      frame_tie (vel1,-1, vel2);
-   }
+/********make_cat_entry */
 
-/*
-   Rotate ICRS position and velocity vectors to dynamical J2000.0
-   (only if 'option' = 5).
-*/
-   if (option == 5)
-   {
-      frame_tie (pos1,1, pos2);
-      frame_tie (vel1,1, vel2);
-   }
+short int make_cat_entry (char *star_name,
+                          char *catalog,
+                          long int star_num, double ra, double dec,
+                          double pm_ra, double pm_dec, double parallax,
+                          double rad_vel,
 
+                          cat_entry *star)
 /*
-   Convert vectors back to angular components for output.
-
-   From updated position vector, obtain star's new position expressed
-   as angular quantities.
-*/
+------------------------------------------------------------------------
 
-   xyproj = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1]);
+   PURPOSE:
+      To create a structure of type 'cat_entry' containing catalog
+      data for a star or "star-like" object.
 
-   if (xyproj > 0.0)
-      r = atan2 (pos2[1], pos2[0]);
-    else
-      r = 0.0;
-   newcat->ra = r / ASEC2RAD / 54000.0;
-   if (newcat->ra < 0.0)
-      newcat->ra += 24.0;
-   if (newcat->ra >= 24.0)
-      newcat->ra -= 24.0;
+   REFERENCES:
+      None.
 
-   d = atan2 (pos2[2], xyproj);
-   newcat->dec = d / ASEC2RAD / 3600.0;
+   INPUT
+   ARGUMENTS:
+      star_name[SIZE_OF_OBJ_NAME] (char)
+         Object name ((SIZE_OF_OBJ_NAME - 1) characters maximum).
+      catalog[SIZE_OF_CAT_NAME] (char)
+         Catalog identifier ((SIZE_OF_CAT_NAME - 1) characters maximum)
+         e.g. HIP = Hipparcos, TY2 = Tycho-2.
+      star_num (long int)
+         Object number in the catalog.
+      ra (double)
+         Right ascension of the object (hours).
+      dec (double)
+         Declination of the object (degrees).
+      pm_ra (double)
+         Proper motion in right ascension (milliarcseconds/year).
+      pm_dec (double)
+         Proper motion in declination (milliarcseconds/year).
+      parallax (double)
+         Parallax (milliarcseconds).
+      rad_vel (double)
+         Radial velocity (kilometers/second).
 
-   dist = sqrt (pos2[0] * pos2[0] + pos2[1] * pos2[1] +
-      pos2[2] * pos2[2]);
+   OUTPUT
+   ARGUMENTS:
+      *star (struct cat_entry)
+         Structure containing the input data (structure defined in
+         novas.h).
 
-   paralx = asin (1.0 / dist) / ASEC2RAD * 1000.0;
-   newcat->parallax = paralx;
+   RETURNED
+   VALUE:
+      (short int)
+         = 0 ... no problems.
+         = 1 ... length of 'star_name' out of bounds.
+         = 2 ... length of 'catalog' out of bounds.
 
-/*
-   Transform motion vector back to spherical polar system at star's
-   new position.
-*/
+   GLOBALS
+   USED:
+      SIZE_OF_OBJ_NAME   novas.h
+      SIZE_OF_CAT_NAME   novas.h
 
-   cra = cos (r);
-   sra = sin (r);
-   cdc = cos (d);
-   sdc = sin (d);
-   pmr = - vel2[0] * sra       + vel2[1] * cra;
-   pmd = - vel2[0] * cra * sdc - vel2[1] * sra * sdc + vel2[2] * cdc;
-   rvl =   vel2[0] * cra * cdc + vel2[1] * sra * cdc + vel2[2] * sdc;
+   FUNCTIONS
+   CALLED:
+      strlen             string.h
+      strcpy             string.h
 
-/*
-   Convert components of motion to from AU/day to normal catalog units.
-*/
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/03-98/JAB (USNO/AA)
+      V1.1/08-04/JAB (USNO/AA)
+      V1.3/05-10/JAB (USNO/AA): Fix bugs in set-up of 'star->starname'
+                                and 'star->catalog'.
 
-   newcat->promora  = pmr * paralx * 365.25 / k;
-   newcat->promodec = pmd * paralx * 365.25 / k;
-   newcat->radialvelocity = rvl * (AU_KM / 86400.0) / k;
+   NOTES:
+      1. This utility function creates a single data structure
+      encapsulating the input data.
+      2. SIZE_OF_OBJ_NAME and SIZE_OF_CAT_NAME are defined in novas.h.
 
-/*
-  Take care of zero-parallax case.
+------------------------------------------------------------------------
 */
-
-   if (newcat->parallax <= 1.01e-6)
-   {
-      newcat->parallax = 0.0;
-      newcat->radialvelocity = incat->radialvelocity;
-   }
+{
 
 /*
-   Set the catalog identification code for the transformed catalog
-   entry.
+   Set up the 'star' structure.
 */
 
-   if ((short int) strlen (newcat_id) > SIZE_OF_CAT_NAME - 1)
-      return (2);
+   if ((short int) strlen (star_name) > SIZE_OF_OBJ_NAME - 1)
+      return (1);
     else
-      strcpy (newcat->catalog, newcat_id);
+      strcpy (star->starname, star_name);
 
-/*
-   Copy unchanged quantities from the input catalog entry to the
-   transformed catalog entry.
-*/
+   if ((short int) strlen (catalog) > SIZE_OF_CAT_NAME - 1)
+      return (2);
+    else
+      strcpy (star->catalog, catalog);
 
-   strcpy (newcat->starname, incat->starname);
-   newcat->starnumber = incat->starnumber;
+   star->starnumber = star_num;
+   star->ra = ra;
+   star->dec = dec;
+   star->promora = pm_ra;
+   star->promodec = pm_dec;
+   star->parallax = parallax;
+   star->radialvelocity = rad_vel;
 
-   return (error);
+   return (0);
 }
 
-/********limb_angle */
+/********make_object */
 
-void limb_angle (double pos_obj[3], double pos_obs[3],
+short int make_object (short int type, short int number,
+                       char *name, cat_entry *star_data,
 
-                 double *limb_ang, double *nadir_ang)
+                       object *cel_obj)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function determines the angle of an object above or below
-      the Earth's limb (horizon).  The geometric limb is computed,
-      assuming the Earth to be an airless sphere (no refraction or
-      oblateness is included).  The observer can be on or above the
-      Earth.  For an observer on the surface of the Earth, this
-      function returns the approximate unrefracted altitude.
+      Makes a structure of type 'object' - specifying a celestial
+      object - based on the input parameters.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      pos_obj[3] (double)
-         Position vector of observed object, with respect to origin at
-         geocenter, components in AU.
-      pos_obs[3] (double)
-         Position vector of observer, with respect to origin at
-         geocenter, components in AU.
-
-   OUTPUT
-   ARGUMENTS:
-      *limb_ang (double)
-         Angle of observed object above (+) or below (-) limb
-         in degrees.
-      *nadir_ang (double)
-         Nadir angle of observed object as a fraction of apparent
-         radius of limb:
-            < 1.0 ... below the limb
-            = 1.0 ... on the limb
-            > 1.0 ... above the limb
+      type (short int)
+         Type of object
+            = 0 ... major planet, Pluto, Sun, or Moon
+            = 1 ... minor planet
+            = 2 ... object located outside the solar system
+                    (e.g. star, galaxy, nebula, etc.)
+      number (short int)
+         Body number
+            For 'type' = 0: Mercury = 1,...,Pluto = 9, Sun = 10,
+                            Moon = 11
+            For 'type' = 1: minor planet number
+            For 'type' = 2: set to 0 (zero)
+      name[SIZE_OF_OBJ_NAME] (char)
+         Name of the object ((SIZE_OF_OBJ_NAME - 1) characters maximum).
+      *star_data (struct cat_entry)
+         Structure containing basic astrometric data for any celestial
+         object located outside the solar system; the catalog
+         data for a star (defined in novas.h).
 
+   OUTPUT
+   ARGUMENTS:
+      struct object *cel_obj
+         Structure containing the object definition (defined in novas.h).
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         = 0 ... everything OK
+         = 1 ... invalid value of 'type'
+         = 2 ... 'number' out of range
+         = 3 ... Initialization of 'cel_obj' failed (object name).
+         = 4 ... Initialization of 'cel_obj' failed (catalog name).
+         = 5 ... 'name' is out of string bounds.
 
    GLOBALS
    USED:
-      TWOPI, ERAD        novascon.c
-      AU, RAD2DEG        novascon.c
+      SIZE_OF_OBJ_NAME   novas.h
+      SIZE_OF_CAT_NAME   novas.h
 
    FUNCTIONS
    CALLED:
-      sqrt               math.h
-      asin               math.h
-      acos               math.h
+      strlen             string.h
+      strcpy             string.h
+      toupper            ctype.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-04/JAB (USNO/AA)
+      V1.0/06-97/JAB (USNO/AA)
+      V1.1/10-98/JAB (USNO/AA): Change object name to mixed case.
+      V1.2/12-02/JAB (USNO/AA): Fix bug by adding brackets in the "Set
+                                the object number" 'if' block.
+      V1.3/07-04/JAB (USNO/AA): Change name from 'set_body'; expand to
+                                include objects outside solar system.
+      V1.4/05-10/JAB (USNO/AA): Implement SIZE_OF_OBJ_NAME and
+                                SIZE_OF_CAT_NAME; check length of
+                                'name'.
+      V1.5/09-10/WKP (USNO/AA): Explicitly cast 'toupper' return value
+                                to type 'char' to silence compiler.
 
    NOTES:
-      1.This function is the C version of NOVAS Fortran routine
-      'limang'.
+      1. SIZE_OF_OBJ_NAME and SIZE_OF_CAT_NAME are defined in novas.h.
 
 ------------------------------------------------------------------------
 */
 {
-   static short int first_entry = 1;
-
-   static double pi, halfpi, rade;
-   double disobj, disobs, aprad, zdlim, coszd, zdobj;
-
-   if (first_entry)
-   {
-      pi = TWOPI / 2.0;
-      halfpi = pi / 2.0;
-      rade = ERAD / AU;
-      first_entry = 0;
-   }
+   short int error = 0;
+   short int i;
 
 /*
-   Compute the distance to the object and the distance to the observer.
+   Initialize the structure.
 */
 
-   disobj = sqrt (pos_obj[0] * pos_obj[0] +
-                  pos_obj[1] * pos_obj[1] +
-                  pos_obj[2] * pos_obj[2]);
-
-   disobs = sqrt (pos_obs[0] * pos_obs[0] +
-                  pos_obs[1] * pos_obs[1] +
-                  pos_obs[2] * pos_obs[2]);
-
-/*
-   Compute apparent angular radius of Earth's limb.
-*/
+   cel_obj->type = 0;
+   cel_obj->number = 0;
+   strcpy (cel_obj->name, "  ");
 
-   if (disobs >= rade)
-   {
-      aprad = asin (rade / disobs);
-   }
+   if ((short int) strlen ("  ") > SIZE_OF_OBJ_NAME - 1)
+      return (error = 3);
     else
    {
-      aprad = halfpi;
+      strcpy (cel_obj->name, "  ");
+      strcpy (cel_obj->star.starname, "  ");
    }
 
+   if ((short int) strlen ("  ") > SIZE_OF_CAT_NAME - 1)
+      return (error = 4);
+    else
+      strcpy (cel_obj->star.catalog, "  ");
+
+   cel_obj->star.starnumber = 0L;
+   cel_obj->star.ra = 0.0;
+   cel_obj->star.dec = 0.0;
+   cel_obj->star.promora = 0.0;
+   cel_obj->star.promodec = 0.0;
+   cel_obj->star.parallax = 0.0;
+   cel_obj->star.radialvelocity = 0.0;
+
 /*
-   Compute zenith distance of Earth's limb.
+   Set the object type.
 */
 
-   zdlim = pi - aprad;
+   if ((type < 0) || (type > 2))
+      return (error = 1);
+    else
+      cel_obj->type = type;
 
 /*
-   Compute zenith distance of observed object.
+   Set the object number.
 */
 
-   coszd = (pos_obj[0] * pos_obs[0] + pos_obj[1] * pos_obs[1] +
-      pos_obj[2] * pos_obs[2]) / (disobj * disobs);
-
-   if (coszd <= -1.0)
+   if (type == 0)
    {
-      zdobj = pi;
+      if ((number <= 0) || (number > 11))
+         return (error = 2);
    }
-    else if (coszd >= 1.0)
+    else if (type == 1)
    {
-      zdobj = 0.0;
+      if (number <= 0)
+         return (error = 2);
    }
     else
    {
-      zdobj = acos (coszd);
+      number = 0;
    }
 
+   cel_obj->number = number;
+
 /*
-   Angle of object wrt limb is difference in zenith distances.
+   Check length of 'name'.  Set the object name in upper case.
 */
 
-   *limb_ang = (zdlim - zdobj) * RAD2DEG;
+   if ((short int) strlen (name) > SIZE_OF_OBJ_NAME - 1)
+      return (error = 5);
+
+   for (i = 0; i < SIZE_OF_OBJ_NAME - 1; i++)
+   {
+      cel_obj->name[i] = (char) toupper (name[i]);
+      if (name[i] == '\0')
+         break;
+   }
+   cel_obj->name[i] = '\0';
 
 /*
-   Nadir angle of object as a fraction of angular radius of limb.
+   Populate the astrometric-data structure if the object is 'type' = 2.
 */
 
-   *nadir_ang = (pi - zdobj) / aprad;
+   if (type == 2)
+   {
+      strcpy (cel_obj->star.starname, star_data->starname);
+      strcpy (cel_obj->star.catalog, star_data->catalog);
+      cel_obj->star.starnumber = star_data->starnumber;
+      cel_obj->star.ra = star_data->ra;
+      cel_obj->star.dec = star_data->dec;
+      cel_obj->star.promora = star_data->promora;
+      cel_obj->star.promodec = star_data->promodec;
+      cel_obj->star.parallax = star_data->parallax;
+      cel_obj->star.radialvelocity = star_data->radialvelocity;
+   }
 
-   return;
+    return (error);
 }
 
-/********refract */
+/********make_observer */
 
-double refract (on_surface *location, short int ref_option,
-                double zd_obs)
+short int make_observer (short int where, on_surface *obs_surface,
+                         in_space *obs_space,
+
+                         observer *obs)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function computes atmospheric refraction in zenith
-      distance.  This version computes approximate refraction for
-      optical wavelengths.
+      Makes a structure of type 'observer' - specifying the location of
+      the observer.
 
    REFERENCES:
-      Explanatory Supplement to the Astronomical Almanac, p. 144.
-      Bennett, G. (1982), Journal of Navigation (Royal Institute) 35,
-         pp. 255-259.
+      None.
 
    INPUT
    ARGUMENTS:
-      *location (struct on_surface)
-         Pointer to structure containing observer's location.  This
-         structure also contains weather data (optional) for the
-         observer's location (defined in novas.h).
-      ref_option (short int)
-         = 1 ... Use 'standard' atmospheric conditions.
-         = 2 ... Use atmospheric parameters input in the 'location'
-                 structure.
-      zd_obs (double)
-         Observed zenith distance, in degrees.
+      where (short int)
+         Integer code specifying location of observer.
+            = 0: observer at geocenter
+            = 1: observer on surface of earth
+            = 2: observer on near-earth spacecraft
+      *obs_surface (struct on_surface)
+         Structure containing data for an observer's location on the
+         surface of the Earth; used when 'where' = 1 (defined in
+         novas.h).
+      *obs_space (struct in_space)
+         Data for an observer's location on a near-Earth spacecraft;
+         used when 'where' = 2  (defined in novas.h).
 
    OUTPUT
    ARGUMENTS:
-      None.
+      struct observer *obs
+         Structure specifying the location of the observer (defined in
+         novas.h).
 
    RETURNED
    VALUE:
-      (double)
-         Atmospheric refraction, in degrees.
+      (short int)
+         = 0 ... everything OK.
+         = 1 ... input value of 'where' is out-of-range.
 
    GLOBALS
    USED:
-      DEG2RAD            novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      exp                math.h
-      tan                math.h
+      None.
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-98/JAB (USNO/AA)
+      V1.0/08-04/JAB (USNO/AA)
 
    NOTES:
-      1. This function can be used for planning observations or
-      telescope pointing, but should not be used for the reduction
-      of precise observations.
-      2. This function is the C version of NOVAS Fortran routine
-      'refrac'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
+   short int error = 0;
 
 /*
-   's' is the approximate scale height of atmosphere in meters.
+   Initialize the output structure.
 */
 
-   const double s = 9.1e3;
-   double refr, p, t, h, r;
+   obs->where = where;
+   obs->on_surf.latitude = 0.0;
+   obs->on_surf.longitude = 0.0;
+   obs->on_surf.height = 0.0;
+   obs->on_surf.temperature = 0.0;
+   obs->on_surf.pressure = 0.0;
+   obs->near_earth.sc_pos[0] = 0.0;
+   obs->near_earth.sc_pos[1] = 0.0;
+   obs->near_earth.sc_pos[2] = 0.0;
+   obs->near_earth.sc_vel[0] = 0.0;
+   obs->near_earth.sc_vel[1] = 0.0;
+   obs->near_earth.sc_vel[2] = 0.0;
 
 /*
-   Compute refraction only for zenith distances between 0.1 and
-   91 degrees.
+   Populate the output structure based on the value of 'where'.
 */
 
-   if ((zd_obs < 0.1) || (zd_obs > 91.0))
-      refr = 0.0;
-    else
+   switch (where)
    {
+      case (0):  /* Geocentric */
+         break;
 
-/*
-   If observed weather data are available, use them.  Otherwise, use
-   crude estimates of average conditions.
-*/
+      case (1):  /* On surface of Earth */
+         obs->on_surf.latitude = obs_surface->latitude;
+         obs->on_surf.longitude = obs_surface->longitude;
+         obs->on_surf.height = obs_surface->height;
+         obs->on_surf.temperature = obs_surface->temperature;
+         obs->on_surf.pressure = obs_surface->pressure;
+         break;
 
-      if (ref_option == 2)
-      {
-         p = location->pressure;
-         t = location->temperature;
-      }
-       else
-      {
-         p = 1010.0 * exp (-location->height / s);
-         t = 10.0;
-      }
+      case (2):  /* In near-Earth spacecraft */
+         obs->near_earth.sc_pos[0] = obs_space->sc_pos[0];
+         obs->near_earth.sc_pos[1] = obs_space->sc_pos[1];
+         obs->near_earth.sc_pos[2] = obs_space->sc_pos[2];
+         obs->near_earth.sc_vel[0] = obs_space->sc_vel[0];
+         obs->near_earth.sc_vel[1] = obs_space->sc_vel[1];
+         obs->near_earth.sc_vel[2] = obs_space->sc_vel[2];
+         break;
 
-      h = 90.0 - zd_obs;
-      r = 0.016667 / tan ((h + 7.31 / (h + 4.4)) * DEG2RAD);
-      refr = r * (0.28 * p / (t + 273.0));
+      default:
+         error = 1;
+         break;
    }
 
-   return (refr);
+   return (error);
 }
 
-/********julian_date */
+/********make_observer_at_geocenter */
 
-double julian_date (short int year, short int month, short int day,
-                    double hour)
+void make_observer_at_geocenter (
+
+                                 observer *obs_at_geocenter)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function will compute the Julian date for a given calendar
-      date (year, month, day, hour).
+      Makes a structure of type 'observer' specifying an observer at the
+      geocenter.
 
    REFERENCES:
-      Fliegel, H. & Van Flandern, T.  Comm. of the ACM, Vol. 11, No. 10,
-         October 1968, p. 657.
+      None.
 
    INPUT
    ARGUMENTS:
-      year (short int)
-         Year.
-      month (short int)
-         Month number.
-      day (short int)
-         Day-of-month.
-      hour (double)
-         Hour-of-day.
+      None.
 
    OUTPUT
    ARGUMENTS:
-      None.
+      struct observer *obs_at_geocenter
+         Structure specifying the location of the observer at the geocenter
+         (defined in novas.h).
 
    RETURNED
    VALUE:
-      (double)
-         Julian date.
+      None.
 
    GLOBALS
    USED:
@@ -9237,70 +14632,76 @@ double julian_date (short int year, short int month, short int day,
 
    FUNCTIONS
    CALLED:
-      None.
+      make_in_space      novas.c
+      make_on_surface    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-98/JAB (USNO/AA)
-      V1.1/03-08/WKP (USNO/AA) Updated prolog.
+      V1.0/03-07/JAB (USNO/AA)
 
    NOTES:
-      1. This function is the C version of NOVAS Fortran routine
-      'juldat'.
-      2. This function makes no checks for a valid input calendar
-      date.
-      3. Input calendar date must be Gregorian.
-      4. Input time value can be based on any UT-like time scale
-      (UTC, UT1, TT, etc.) - output Julian date will have the same basis.
+      1. The output data structure is one of the inputs to NOVAS-C
+      function 'place'.
+
 ------------------------------------------------------------------------
 */
 {
-   long int jd12h;
+   double latitude = 0.0;
+   double longitude = 0.0;
+   double height = 0.0;
+   double temperature = 0.0;
+   double pressure = 0.0;
+   double sat_pos[3] = {0.0, 0.0, 0.0};
+   double sat_vel[3] = {0.0, 0.0, 0.0};
 
-   double tjd;
+   in_space sat_state;
 
-   jd12h = (long) day - 32075L + 1461L * ((long) year + 4800L
-      + ((long) month - 14L) / 12L) / 4L
-      + 367L * ((long) month - 2L - ((long) month - 14L) / 12L * 12L)
-      / 12L - 3L * (((long) year + 4900L + ((long) month - 14L) / 12L)
-      / 100L) / 4L;
-   tjd = (double) jd12h - 0.5 + hour / 24.0;
+   on_surface surface_loc;
 
-   return (tjd);
+   make_in_space (sat_pos,sat_vel, &sat_state);
+   make_on_surface (latitude,longitude,height,temperature,pressure,
+      &surface_loc);
+
+   obs_at_geocenter->where = 0;
+   obs_at_geocenter->on_surf = surface_loc;
+   obs_at_geocenter->near_earth = sat_state;
 }
 
-/********cal_date */
+/********make_observer_on_surface */
 
-void cal_date (double tjd,
+void make_observer_on_surface (double latitude, double longitude,
+                               double height, double temperature,
+                               double pressure,
 
-               short int *year, short int *month, short int *day,
-               double *hour)
+                               observer *obs_on_surface)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      This function will compute a date on the Gregorian calendar given
-      the Julian date.
+      Makes a structure of type 'observer' specifying the location
+      of and weather for an observer on the surface of the Earth.
 
    REFERENCES:
-      Fliegel, H. & Van Flandern, T.  Comm. of the ACM, Vol. 11, No. 10,
-         October 1968, p. 657.
+      None.
 
    INPUT
    ARGUMENTS:
-      tjd (double)
-         Julian date.
+      latitude (double)
+         Geodetic (ITRS) latitude in degrees; north positive.
+      longitude (double)
+         Geodetic (ITRS) longitude in degrees; east positive.
+      height (double)
+         Height of the observer (meters).
+      temperature (double)
+         Temperature (degrees Celsius).
+      pressure (double)
+         Atmospheric pressure (millibars).
 
    OUTPUT
    ARGUMENTS:
-      *year (short int)
-         Year.
-      *month (short int)
-         Month number.
-      *day (short int)
-         Day-of-month.
-      *hour (double)
-         Hour-of-day.
+      struct observer *obs_on_surface
+         Structure containing the location of and weather for an
+         observer on the surface of the Earth (defined in novas.h).
 
    RETURNED
    VALUE:
@@ -9312,429 +14713,327 @@ void cal_date (double tjd,
 
    FUNCTIONS
    CALLED:
-      fmod               math.h
+      make_in_space      novas.c
+      make_on_surface    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-98/JAB (USNO/AA)
+      V1.0/03-07/JAB (USNO/AA)
 
    NOTES:
-      1. This routine valid for any 'jd' greater than zero.
-      2. Input Julian date can be based on any UT-like time scale
-      (UTC, UT1, TT, etc.) - output time value will have same basis.
-      3. This function is the C version of NOVAS Fortran routine
-      'caldat'.
-
+      1. The output data structure is one of the inputs to NOVAS-C
+      function 'place'.
 
 ------------------------------------------------------------------------
 */
 {
-   long int jd, k, m, n;
-
-   double djd;
-
-   djd = tjd + 0.5;
-   jd = (long int) djd;
-
-   *hour = fmod (djd,1.0) * 24.0;
-
-   k     = jd + 68569L;
-   n     = 4L * k / 146097L;
+   double sat_pos[3] = {0.0, 0.0, 0.0};
+   double sat_vel[3] = {0.0, 0.0, 0.0};
 
-   k     = k - (146097L * n + 3L) / 4L;
-   m     = 4000L * (k + 1L) / 1461001L;
-   k     = k - 1461L * m / 4L + 31L;
+   in_space sat_state;
 
-   *month = (short int) (80L * k / 2447L);
-   *day   = (short int) (k - 2447L * (long int) *month / 80L);
-   k      = (long int) *month / 11L;
+   on_surface surface_loc;
 
-   *month = (short int) ((long int) *month + 2L - 12L * k);
-   *year  = (short int) (100L * (n - 49L) + m + k);
+   make_in_space (sat_pos,sat_vel, &sat_state);
+   make_on_surface (latitude,longitude,height,temperature,pressure,
+      &surface_loc);
 
-   return;
+   obs_on_surface->where = 1;
+   obs_on_surface->on_surf = surface_loc;
+   obs_on_surface->near_earth = sat_state;
 }
 
-/********norm_ang */
+/********make_observer_in_space */
 
-double norm_ang (double angle)
+void make_observer_in_space (double sc_pos[3], double sc_vel[3],
+
+                             observer *obs_in_space)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Normalize angle into the range 0 <= angle < (2 * pi).
+      Makes a structure of type 'observer' specifying the position and
+      velocity of an observer situated on a near-Earth spacecraft.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      angle (double)
-         Input angle (radians).
+      sc_pos[3] (double)
+         Geocentric position vector (x, y, z) in km.
+      sc_vel[3] (double)
+         Geocentric velocity vector (x_dot, y_dot, z_dot) in km/s.
 
    OUTPUT
    ARGUMENTS:
-      None.
+      struct observer *obs_in_space
+         Structure containing the position and velocity of an observer
+         situated on a near-Earth spacecraft (defined in novas.h).
 
    RETURNED
    VALUE:
-      (double)
-          The input angle, normalized as described above (radians).
+      None.
 
    GLOBALS
    USED:
-      TWOPI              novascon.c
+      None.
 
    FUNCTIONS
    CALLED:
-      fmod               math.h
+      make_in_space      novas.c
+      make_on_surface    novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/09-03/JAB (USNO/AA)
+      V1.0/03-07/JAB (USNO/AA)
 
    NOTES:
-      None.
+      1. Both input vectors are with respect to true equator and equinox
+      of date.
+      2. The output data structure is one of the inputs to NOVAS-C
+      function 'place'.
 
 ------------------------------------------------------------------------
 */
 {
-   double a;
+   const double latitude = 0.0;
+   const double longitude = 0.0;
+   const double height = 0.0;
+   const double temperature = 0.0;
+   const double pressure = 0.0;
 
-   a = fmod (angle,TWOPI);
-   if (a < 0.0)
-         a += TWOPI;
+   in_space sat_state;
 
-   return (a);
+   on_surface surface_loc;
+
+   make_in_space (sc_pos,sc_vel, &sat_state);
+   make_on_surface (latitude,longitude,height,temperature,pressure,
+      &surface_loc);
+
+   obs_in_space->where = 2;
+   obs_in_space->on_surf = surface_loc;
+   obs_in_space->near_earth = sat_state;
 }
 
-/********make_cat_entry */
+/********make_on_surface */
 
-short int make_cat_entry (char *star_name,
-                          char *catalog,
-                          long int star_num, double ra, double dec,
-                          double pm_ra, double pm_dec, double parallax,
-                          double rad_vel,
+void make_on_surface (double latitude, double longitude, double height,
+                      double temperature, double pressure,
 
-                          cat_entry *star)
+                      on_surface *obs_surface)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      To create a structure of type 'cat_entry' containing catalog
-      data for a star or "star-like" object.
+      Makes a structure of type 'on_surface' - specifying the location
+      of and weather for an observer on the surface of the Earth.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      star_name[SIZE_OF_OBJ_NAME] (char)
-         Object name ((SIZE_OF_OBJ_NAME - 1) characters maximum).
-      catalog[SIZE_OF_CAT_NAME] (char)
-         Catalog identifier ((SIZE_OF_CAT_NAME - 1) characters maximum)
-         e.g. HIP = Hipparcos, TY2 = Tycho-2.
-      star_num (long int)
-         Object number in the catalog.
-      ra (double)
-         Right ascension of the object (hours).
-      dec (double)
-         Declination of the object (degrees).
-      pm_ra (double)
-         Proper motion in right ascension (milliarcseconds/year).
-      pm_dec (double)
-         Proper motion in declination (milliarcseconds/year).
-      parallax (double)
-         Parallax (milliarcseconds).
-      rad_vel (double)
-         Radial velocity (kilometers/second).
+      latitude (double)
+         Geodetic (ITRS) latitude in degrees; north positive.
+      longitude (double)
+         Geodetic (ITRS) longitude in degrees; east positive.
+      height (double)
+         Height of the observer (meters).
+      temperature (double)
+         Temperature (degrees Celsius).
+      pressure (double)
+         Atmospheric pressure (millibars).
 
    OUTPUT
    ARGUMENTS:
-      *star (struct cat_entry)
-         Structure containing the input data (structure defined in
-         novas.h).
+      struct on_surface *obs_surface
+         Structure containing the location of and weather for an
+         observer on the surface of the Earth (defined in novas.h).
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... no problems.
-         = 1 ... length of 'star_name' out of bounds.
-         = 2 ... length of 'catalog' out of bounds.
+      None.
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
-      SIZE_OF_CAT_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      strlen             string.h
-      strcpy             string.h
+      None.
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-98/JAB (USNO/AA)
-      V1.1/08-04/JAB (USNO/AA)
-      V1.3/05-10/JAB (USNO/AA): Fix bugs in set-up of 'star->starname'
-                                and 'star->catalog'.
+      V1.0/08-04/JAB (USNO/AA)
 
    NOTES:
-      1. This utility function creates a single data structure
-      encapsulating the input data.
-      2. SIZE_OF_OBJ_NAME and SIZE_OF_CAT_NAME are defined in novas.h.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-
-/*
-   Set up the 'star' structure.
-*/
-
-   if ((short int) strlen (star_name) > SIZE_OF_OBJ_NAME - 1)
-      return (1);
-    else
-      strcpy (star->starname, star_name);
-
-   if ((short int) strlen (catalog) > SIZE_OF_CAT_NAME - 1)
-      return (2);
-    else
-      strcpy (star->catalog, catalog);
-
-   star->starnumber = star_num;
-   star->ra = ra;
-   star->dec = dec;
-   star->promora = pm_ra;
-   star->promodec = pm_dec;
-   star->parallax = parallax;
-   star->radialvelocity = rad_vel;
-
-   return (0);
+   obs_surface->latitude = latitude;
+   obs_surface->longitude = longitude;
+   obs_surface->height = height;
+   obs_surface->temperature = temperature;
+   obs_surface->pressure = pressure;
 }
 
-/********make_object */
+/********make_in_space */
 
-short int make_object (short int type, short int number,
-                       char *name, cat_entry *star_data,
+void make_in_space (double sc_pos[3], double sc_vel[3],
 
-                       object *cel_obj)
+                    in_space *obs_space)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'object' - specifying a celestial
-      object - based on the input parameters.
+      Makes a structure of type 'in_space' - specifying the position and
+      velocity of an observer situated on a near-Earth spacecraft.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      type (short int)
-         Type of object
-            = 0 ... major planet, Pluto, Sun, or Moon
-            = 1 ... minor planet
-            = 2 ... object located outside the solar system
-                    (e.g. star, galaxy, nebula, etc.)
-      number (short int)
-         Body number
-            For 'type' = 0: Mercury = 1,...,Pluto = 9, Sun = 10,
-                            Moon = 11
-            For 'type' = 1: minor planet number
-            For 'type' = 2: set to 0 (zero)
-      name[SIZE_OF_OBJ_NAME] (char)
-         Name of the object ((SIZE_OF_OBJ_NAME - 1) characters maximum).
-      *star_data (struct cat_entry)
-         Structure containing basic astrometric data for any celestial
-         object located outside the solar system; the catalog
-         data for a star (defined in novas.h).
+      sc_pos[3] (double)
+         Geocentric position vector (x, y, z) in km.
+      sc_vel[3] (double)
+         Geocentric velocity vector (x_dot, y_dot, z_dot) in km/s.
 
    OUTPUT
    ARGUMENTS:
-      struct object *cel_obj
-         Structure containing the object definition (defined in novas.h).
+      struct in_space *obs_space
+         Structure containing the position and velocity of an observer
+         situated on a near-Earth spacecraft (defined in novas.h).
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK
-         = 1 ... invalid value of 'type'
-         = 2 ... 'number' out of range
-         = 3 ... Initialization of 'cel_obj' failed (object name).
-         = 4 ... Initialization of 'cel_obj' failed (catalog name).
-         = 5 ... 'name' is out of string bounds.
+      None.
 
    GLOBALS
    USED:
-      SIZE_OF_OBJ_NAME   novas.h
-      SIZE_OF_CAT_NAME   novas.h
+      None.
 
    FUNCTIONS
    CALLED:
-      strlen             string.h
-      strcpy             string.h
-      toupper            ctype.h
+      None.
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/06-97/JAB (USNO/AA)
-      V1.1/10-98/JAB (USNO/AA): Change object name to mixed case.
-      V1.2/12-02/JAB (USNO/AA): Fix bug by adding brackets in the "Set
-                                the object number" 'if' block.
-      V1.3/07-04/JAB (USNO/AA): Change name from 'set_body'; expand to
-                                include objects outside solar system.
-      V1.4/05-10/JAB (USNO/AA): Implement SIZE_OF_OBJ_NAME and
-                                SIZE_OF_CAT_NAME; check length of
-                                'name'.
-      V1.5/09-10/WKP (USNO/AA): Explicitly cast 'toupper' return value
-                                to type 'char' to silence compiler.
+      V1.0/08-04/JAB (USNO/AA)
 
    NOTES:
-      1. SIZE_OF_OBJ_NAME and SIZE_OF_CAT_NAME are defined in novas.h.
+      1. Both vectors with respect to true equator and equinox of date.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-   short int i;
-
-/*
-   Initialize the structure.
-*/
+   obs_space->sc_pos[0] = sc_pos[0];
+   obs_space->sc_pos[1] = sc_pos[1];
+   obs_space->sc_pos[2] = sc_pos[2];
 
-   cel_obj->type = 0;
-   cel_obj->number = 0;
-   strcpy (cel_obj->name, "  ");
+   obs_space->sc_vel[0] = sc_vel[0];
+   obs_space->sc_vel[1] = sc_vel[1];
+   obs_space->sc_vel[2] = sc_vel[2];
+}
 
-   if ((short int) strlen ("  ") > SIZE_OF_OBJ_NAME - 1)
-      return (error = 3);
-    else
-   {
-      strcpy (cel_obj->name, "  ");
-      strcpy (cel_obj->star.starname, "  ");
-   }
+/********novas_context_create */
 
-   if ((short int) strlen ("  ") > SIZE_OF_CAT_NAME - 1)
-      return (error = 4);
-    else
-      strcpy (cel_obj->star.catalog, "  ");
+novas_context *novas_context_create (void)
+/*
+------------------------------------------------------------------------
 
-   cel_obj->star.starnumber = 0L;
-   cel_obj->star.ra = 0.0;
-   cel_obj->star.dec = 0.0;
-   cel_obj->star.promora = 0.0;
-   cel_obj->star.promodec = 0.0;
-   cel_obj->star.parallax = 0.0;
-   cel_obj->star.radialvelocity = 0.0;
+   PURPOSE:
+      This function allocates a computation context: the values that
+      the NOVAS functions save between calls, so that they are not
+      recomputed for the same date, and the celestial pole offsets.
+      Functions with the '_ctx' suffix work on a context; different
+      contexts can be used concurrently from different threads.
 
-/*
-   Set the object type.
-*/
+   REFERENCES:
+      None.
 
-   if ((type < 0) || (type > 2))
-      return (error = 1);
-    else
-      cel_obj->type = type;
+   INPUT
+   ARGUMENTS:
+      None.
 
-/*
-   Set the object number.
-*/
+   OUTPUT
+   ARGUMENTS:
+      None.
 
-   if (type == 0)
-   {
-      if ((number <= 0) || (number > 11))
-         return (error = 2);
-   }
-    else if (type == 1)
-   {
-      if (number <= 0)
-         return (error = 2);
-   }
-    else
-   {
-      number = 0;
-   }
+   RETURNED
+   VALUE:
+      (novas_context *)
+         The new context, or NULL if it cannot be allocated.
 
-   cel_obj->number = number;
+   GLOBALS
+   USED:
+      None.
 
-/*
-   Check length of 'name'.  Set the object name in upper case.
-*/
+   FUNCTIONS
+   CALLED:
+      malloc             stdlib.h
+      context_init       novas.c
 
-   if ((short int) strlen (name) > SIZE_OF_OBJ_NAME - 1)
-      return (error = 5);
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
 
-   for (i = 0; i < SIZE_OF_OBJ_NAME - 1; i++)
-   {
-      cel_obj->name[i] = (char) toupper (name[i]);
-      if (name[i] == '\0')
-         break;
-   }
-   cel_obj->name[i] = '\0';
+   NOTES:
+      1. The context must be released with 'novas_context_free'.
+      2. A context of this function uses only re-entrant functions for
+      the major planets, Sun and Moon (see 'context_solarsystem'): the
+      JPL backend needs a file of the context, set with
+      'novas_context_set_ephemeris', to be used by several threads.
+      3. The settings of 'set_nutation_source',
+      'set_nutation_tolerance', 'set_nutation_kernel',
+      'set_solsys_backend' and the nutation table are shared by all
+      contexts; they should not be changed while contexts are in use.
+      4. The functions without the '_ctx' suffix use a default context
+      of their own, as they used static variables before.
 
-/*
-   Populate the astrometric-data structure if the object is 'type' = 2.
+------------------------------------------------------------------------
 */
+{
+   novas_context *ctx;
 
-   if (type == 2)
-   {
-      strcpy (cel_obj->star.starname, star_data->starname);
-      strcpy (cel_obj->star.catalog, star_data->catalog);
-      cel_obj->star.starnumber = star_data->starnumber;
-      cel_obj->star.ra = star_data->ra;
-      cel_obj->star.dec = star_data->dec;
-      cel_obj->star.promora = star_data->promora;
-      cel_obj->star.promodec = star_data->promodec;
-      cel_obj->star.parallax = star_data->parallax;
-      cel_obj->star.radialvelocity = star_data->radialvelocity;
-   }
+   ctx = (novas_context *) malloc (sizeof (novas_context));
+   if (ctx == NULL)
+      return NULL;
 
-    return (error);
-}
+   context_init (ctx);
+   ctx->private_solsys = 1;
 
-/********make_observer */
+   return ctx;
+}
 
-short int make_observer (short int where, on_surface *obs_surface,
-                         in_space *obs_space,
+/********novas_context_free */
 
-                         observer *obs)
+void novas_context_free (novas_context *ctx)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'observer' - specifying the location of
-      the observer.
+      This function releases a context of 'novas_context_create', with
+      the CIO file and the arrays it holds.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      where (short int)
-         Integer code specifying location of observer.
-            = 0: observer at geocenter
-            = 1: observer on surface of earth
-            = 2: observer on near-earth spacecraft
-      *obs_surface (struct on_surface)
-         Structure containing data for an observer's location on the
-         surface of the Earth; used when 'where' = 1 (defined in
-         novas.h).
-      *obs_space (struct in_space)
-         Data for an observer's location on a near-Earth spacecraft;
-         used when 'where' = 2  (defined in novas.h).
+      *ctx (novas_context)
+         Context to release (may be NULL).
 
    OUTPUT
    ARGUMENTS:
-      struct observer *obs
-         Structure specifying the location of the observer (defined in
-         novas.h).
+      None.
 
    RETURNED
    VALUE:
-      (short int)
-         = 0 ... everything OK.
-         = 1 ... input value of 'where' is out-of-range.
+      None.
 
    GLOBALS
    USED:
@@ -9742,99 +15041,62 @@ short int make_observer (short int where, on_surface *obs_surface,
 
    FUNCTIONS
    CALLED:
-      None.
+      context_release    novas.c
+      free               stdlib.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-04/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      None.
+      1. The ephemeris file set with 'novas_context_set_ephemeris' is
+      not closed; it belongs to the caller.
 
 ------------------------------------------------------------------------
 */
 {
-   short int error = 0;
-
-/*
-   Initialize the output structure.
-*/
-
-   obs->where = where;
-   obs->on_surf.latitude = 0.0;
-   obs->on_surf.longitude = 0.0;
-   obs->on_surf.height = 0.0;
-   obs->on_surf.temperature = 0.0;
-   obs->on_surf.pressure = 0.0;
-   obs->near_earth.sc_pos[0] = 0.0;
-   obs->near_earth.sc_pos[1] = 0.0;
-   obs->near_earth.sc_pos[2] = 0.0;
-   obs->near_earth.sc_vel[0] = 0.0;
-   obs->near_earth.sc_vel[1] = 0.0;
-   obs->near_earth.sc_vel[2] = 0.0;
-
-/*
-   Populate the output structure based on the value of 'where'.
-*/
-
-   switch (where)
-   {
-      case (0):  /* Geocentric */
-         break;
-
-      case (1):  /* On surface of Earth */
-         obs->on_surf.latitude = obs_surface->latitude;
-         obs->on_surf.longitude = obs_surface->longitude;
-         obs->on_surf.height = obs_surface->height;
-         obs->on_surf.temperature = obs_surface->temperature;
-         obs->on_surf.pressure = obs_surface->pressure;
-         break;
-
-      case (2):  /* In near-Earth spacecraft */
-         obs->near_earth.sc_pos[0] = obs_space->sc_pos[0];
-         obs->near_earth.sc_pos[1] = obs_space->sc_pos[1];
-         obs->near_earth.sc_pos[2] = obs_space->sc_pos[2];
-         obs->near_earth.sc_vel[0] = obs_space->sc_vel[0];
-         obs->near_earth.sc_vel[1] = obs_space->sc_vel[1];
-         obs->near_earth.sc_vel[2] = obs_space->sc_vel[2];
-         break;
+   if (ctx == NULL)
+      return;
 
-      default:
-         error = 1;
-         break;
-   }
+   context_release (ctx);
+   free (ctx);
 
-   return (error);
+   return;
 }
 
-/********make_observer_at_geocenter */
-
-void make_observer_at_geocenter (
+/********novas_context_set_ephemeris */
 
-                                 observer *obs_at_geocenter)
+short int novas_context_set_ephemeris (novas_context *ctx,
+                                       ephem_handle *eph)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'observer' specifying an observer at the
-      geocenter.
+      This function sets the JPL ephemeris file of a context, used for
+      the major planets, Sun and Moon when the JPL backend is selected
+      (see 'set_solsys_backend'), and for the nutation angles with the
+      nutation source NUTATION_EPHEMERIS.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      None.
+      *ctx (novas_context)
+         Context of 'novas_context_create'.
+      *eph (ephem_handle)
+         File opened with 'ephem_open_r', or NULL for none (the file
+         opened with 'ephem_open' is never used by these contexts).
 
    OUTPUT
    ARGUMENTS:
-      struct observer *obs_at_geocenter
-         Structure specifying the location of the observer at the geocenter
-         (defined in novas.h).
+      None.
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... 'ctx' is NULL.
 
    GLOBALS
    USED:
@@ -9842,76 +15104,67 @@ void make_observer_at_geocenter (
 
    FUNCTIONS
    CALLED:
-      make_in_space      novas.c
-      make_on_surface    novas.c
+      context_release    novas.c
+      context_init       novas.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-07/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      1. The output data structure is one of the inputs to NOVAS-C
-      function 'place'.
+      1. A handle is used by one thread at a time: each context used
+      concurrently needs a file of its own.
+      2. The values saved for previous dates are discarded, since they
+      may come from another file; the celestial pole offsets are kept.
 
 ------------------------------------------------------------------------
 */
 {
-   double latitude = 0.0;
-   double longitude = 0.0;
-   double height = 0.0;
-   double temperature = 0.0;
-   double pressure = 0.0;
-   double sat_pos[3] = {0.0, 0.0, 0.0};
-   double sat_vel[3] = {0.0, 0.0, 0.0};
+   short int private_solsys;
 
-   in_space sat_state;
+   double psi_cor, eps_cor;
 
-   on_surface surface_loc;
+   if (ctx == NULL)
+      return 1;
 
-   make_in_space (sat_pos,sat_vel, &sat_state);
-   make_on_surface (latitude,longitude,height,temperature,pressure,
-      &surface_loc);
+   psi_cor = ctx->psi_cor;
+   eps_cor = ctx->eps_cor;
+   private_solsys = ctx->private_solsys;
 
-   obs_at_geocenter->where = 0;
-   obs_at_geocenter->on_surf = surface_loc;
-   obs_at_geocenter->near_earth = sat_state;
-}
+   context_release (ctx);
+   context_init (ctx);
 
-/********make_observer_on_surface */
+   ctx->psi_cor = psi_cor;
+   ctx->eps_cor = eps_cor;
+   ctx->private_solsys = private_solsys;
+   ctx->eph = eph;
 
-void make_observer_on_surface (double latitude, double longitude,
-                               double height, double temperature,
-                               double pressure,
+   return 0;
+}
 
-                               observer *obs_on_surface)
+/********context_init */
+
+static void context_init (novas_context *ctx)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'observer' specifying the location
-      of and weather for an observer on the surface of the Earth.
+      Sets a context to the state of the NOVAS functions before their
+      first call.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      latitude (double)
-         Geodetic (ITRS) latitude in degrees; north positive.
-      longitude (double)
-         Geodetic (ITRS) longitude in degrees; east positive.
-      height (double)
-         Height of the observer (meters).
-      temperature (double)
-         Temperature (degrees Celsius).
-      pressure (double)
-         Atmospheric pressure (millibars).
+      *ctx (novas_context)
+         Context to initialize.
 
    OUTPUT
    ARGUMENTS:
-      struct observer *obs_on_surface
-         Structure containing the location of and weather for an
-         observer on the surface of the Earth (defined in novas.h).
+      *ctx (novas_context)
+         Context with the initial values of the former static
+         variables, no pole offsets and no ephemeris file.
 
    RETURNED
    VALUE:
@@ -9923,63 +15176,46 @@ void make_observer_on_surface (double latitude, double longitude,
 
    FUNCTIONS
    CALLED:
-      make_in_space      novas.c
-      make_on_surface    novas.c
+      None.
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-07/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      1. The output data structure is one of the inputs to NOVAS-C
-      function 'place'.
+      1. The values are those of 'CONTEXT_INITIAL', which also
+      initializes 'DEFAULT_CTX'.
 
 ------------------------------------------------------------------------
 */
 {
-   double sat_pos[3] = {0.0, 0.0, 0.0};
-   double sat_vel[3] = {0.0, 0.0, 0.0};
-
-   in_space sat_state;
-
-   on_surface surface_loc;
+   static const novas_context initial = CONTEXT_INITIAL;
 
-   make_in_space (sat_pos,sat_vel, &sat_state);
-   make_on_surface (latitude,longitude,height,temperature,pressure,
-      &surface_loc);
+   *ctx = initial;
 
-   obs_on_surface->where = 1;
-   obs_on_surface->on_surf = surface_loc;
-   obs_on_surface->near_earth = sat_state;
+   return;
 }
 
-/********make_observer_in_space */
-
-void make_observer_in_space (double sc_pos[3], double sc_vel[3],
+/********context_release */
 
-                             observer *obs_in_space)
+static void context_release (novas_context *ctx)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'observer' specifying the position and
-      velocity of an observer situated on a near-Earth spacecraft.
+      Closes the CIO file and frees the arrays held by a context.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      sc_pos[3] (double)
-         Geocentric position vector (x, y, z) in km.
-      sc_vel[3] (double)
-         Geocentric velocity vector (x_dot, y_dot, z_dot) in km/s.
+      *ctx (novas_context)
+         Context to release.
 
    OUTPUT
    ARGUMENTS:
-      struct observer *obs_in_space
-         Structure containing the position and velocity of an observer
-         situated on a near-Earth spacecraft (defined in novas.h).
+      None.
 
    RETURNED
    VALUE:
@@ -9991,83 +15227,62 @@ void make_observer_in_space (double sc_pos[3], double sc_vel[3],
 
    FUNCTIONS
    CALLED:
-      make_in_space      novas.c
-      make_on_surface    novas.c
+      fclose             stdio.h
+      free               stdlib.h
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/03-07/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      1. Both input vectors are with respect to true equator and equinox
-      of date.
-      2. The output data structure is one of the inputs to NOVAS-C
-      function 'place'.
+      None.
 
 ------------------------------------------------------------------------
 */
 {
-   const double latitude = 0.0;
-   const double longitude = 0.0;
-   const double height = 0.0;
-   const double temperature = 0.0;
-   const double pressure = 0.0;
-
-   in_space sat_state;
+   if (ctx->cio_array.cio_file != NULL)
+      fclose (ctx->cio_array.cio_file);
 
-   on_surface surface_loc;
+   free (ctx->cio_array.t);
+   free (ctx->cio_array.ra);
+   free (ctx->cio_location.cio);
 
-   make_in_space (sc_pos,sc_vel, &sat_state);
-   make_on_surface (latitude,longitude,height,temperature,pressure,
-      &surface_loc);
+   ctx->cio_array.cio_file = NULL;
+   ctx->cio_array.t = NULL;
+   ctx->cio_array.ra = NULL;
+   ctx->cio_location.cio = NULL;
 
-   obs_in_space->where = 2;
-   obs_in_space->on_surf = surface_loc;
-   obs_in_space->near_earth = sat_state;
+   return;
 }
 
-/********make_on_surface */
-
-void make_on_surface (double latitude, double longitude, double height,
-                      double temperature, double pressure,
+/********default_context */
 
-                      on_surface *obs_surface)
+static novas_context *default_context (void)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'on_surface' - specifying the location
-      of and weather for an observer on the surface of the Earth.
+      Returns the context of the functions without the '_ctx' suffix.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      latitude (double)
-         Geodetic (ITRS) latitude in degrees; north positive.
-      longitude (double)
-         Geodetic (ITRS) longitude in degrees; east positive.
-      height (double)
-         Height of the observer (meters).
-      temperature (double)
-         Temperature (degrees Celsius).
-      pressure (double)
-         Atmospheric pressure (millibars).
+      None.
 
    OUTPUT
    ARGUMENTS:
-      struct on_surface *obs_surface
-         Structure containing the location of and weather for an
-         observer on the surface of the Earth (defined in novas.h).
+      None.
 
    RETURNED
    VALUE:
-      None.
+      (novas_context *)
+         Pointer to 'DEFAULT_CTX'.
 
    GLOBALS
    USED:
-      None.
+      DEFAULT_CTX        novas.c
 
    FUNCTIONS
    CALLED:
@@ -10075,76 +15290,139 @@ void make_on_surface (double latitude, double longitude, double height,
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-04/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      None.
+      1. 'DEFAULT_CTX' is initialized at compile time (see
+      'CONTEXT_INITIAL'), so getting it is safe from any thread.  Like
+      the static variables it replaces, its contents are not protected
+      against concurrent use: threads that run at the same time need
+      contexts of their own (see 'novas_context_create').
 
 ------------------------------------------------------------------------
 */
 {
-   obs_surface->latitude = latitude;
-   obs_surface->longitude = longitude;
-   obs_surface->height = height;
-   obs_surface->temperature = temperature;
-   obs_surface->pressure = pressure;
+   return &DEFAULT_CTX;
 }
 
-/********make_in_space */
+/********context_solarsystem */
 
-void make_in_space (double sc_pos[3], double sc_vel[3],
+static short int context_solarsystem (novas_context *ctx,
+                                      short int accuracy, double jd[2],
+                                      short int body, short int origin,
 
-                    in_space *obs_space)
+                                      double *pos, double *vel)
 /*
 ------------------------------------------------------------------------
 
    PURPOSE:
-      Makes a structure of type 'in_space' - specifying the position and
-      velocity of an observer situated on a near-Earth spacecraft.
+      Position and velocity of a major planet, the Sun or the Moon for
+      function 'ephemeris_ctx'.
 
    REFERENCES:
       None.
 
    INPUT
    ARGUMENTS:
-      sc_pos[3] (double)
-         Geocentric position vector (x, y, z) in km.
-      sc_vel[3] (double)
-         Geocentric velocity vector (x_dot, y_dot, z_dot) in km/s.
+      *ctx (novas_context)
+         Computation context.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy ('solarsystem_hp')
+            = 1 ... reduced accuracy ('solarsystem')
+      jd[2] (double)
+         TDB Julian date, split in two parts.
+      body (short int)
+         Body identification number, as in 'solarsystem'.
+      origin (short int)
+         Origin code, as in 'solarsystem'.
 
    OUTPUT
    ARGUMENTS:
-      struct in_space *obs_space
-         Structure containing the position and velocity of an observer
-         situated on a near-Earth spacecraft (defined in novas.h).
+      *pos (double)
+         Position vector of 'body' with respect to 'origin' (AU).
+      *vel (double)
+         Velocity vector of 'body' (AU/day); may be NULL.
 
    RETURNED
    VALUE:
-      None.
+      (short int)
+         0    ... Everything OK.
+         4    ... JPL backend selected, but no ephemeris file set in
+                  the context (see 'novas_context_set_ephemeris').
+         n    ... Error code of the ephemeris function called.
 
    GLOBALS
    USED:
-      None.
+      SOLSYS_JPL         solarsystem.h
+      SOLSYS_ANALYTIC    solarsystem.h
 
    FUNCTIONS
    CALLED:
-      None.
+      solarsystem        solsys.c
+      solarsystem_hp     solsys.c
+      get_solsys_backend solsys.c
+      solarsystem_backend solsys.c
+      solarsystem_hp_jpl solsys1.c
+      solarsystem_analytic_batch solsys3.c
 
    VER./DATE/
    PROGRAMMER:
-      V1.0/08-04/JAB (USNO/AA)
+      V1.0/10-26/ROA
 
    NOTES:
-      1. Both vectors with respect to true equator and equinox of date.
+      1. The default context calls 'solarsystem_hp' or 'solarsystem',
+      so the results of the functions without the '_ctx' suffix are
+      unchanged.
+      2. The other contexts avoid the functions that keep static data.
+      The JPL backend reads only the file of the context (reduced
+      accuracy on the unsplit date, as 'solarsystem'), never the file
+      shared by 'ephem_open', so a context without a file of its own
+      gets error 4.  The analytic backend is evaluated with
+      'solarsystem_analytic_batch', which agrees with
+      'solarsystem_analytic' to about 1.0e-13 AU; like
+      'solarsystem_hp_analytic', it returns error 3 for full accuracy.
+      Other backends are called through 'solarsystem_backend'.
 
 ------------------------------------------------------------------------
 */
 {
-   obs_space->sc_pos[0] = sc_pos[0];
-   obs_space->sc_pos[1] = sc_pos[1];
-   obs_space->sc_pos[2] = sc_pos[2];
+   short int backend;
 
-   obs_space->sc_vel[0] = sc_vel[0];
-   obs_space->sc_vel[1] = sc_vel[1];
-   obs_space->sc_vel[2] = sc_vel[2];
+   double tjd[2];
+
+   if (!ctx->private_solsys)
+   {
+      if (accuracy == 0)
+         return solarsystem_hp (jd,body,origin, pos,vel);
+       else
+         return solarsystem (jd[0] + jd[1],body,origin, pos,vel);
+   }
+
+   backend = get_solsys_backend (accuracy);
+
+   tjd[0] = jd[0];
+   tjd[1] = jd[1];
+   if (accuracy != 0)
+   {
+      tjd[0] = jd[0] + jd[1];
+      tjd[1] = 0.0;
+   }
+
+   if (backend == SOLSYS_JPL)
+   {
+      if (ctx->eph == NULL)
+         return 4;
+      return solarsystem_hp_jpl (ctx->eph,tjd,body,origin, pos,vel);
+   }
+
+   if (backend == SOLSYS_ANALYTIC)
+   {
+      if (accuracy == 0)
+         return 3;
+      return solarsystem_analytic_batch (1L,tjd,body,origin,1, pos,vel);
+   }
+
+   return solarsystem_backend (backend,accuracy,tjd,body,origin,
+      pos,vel);
 }
@@ -16,6 +16,169 @@
 #include "nutation.h"
 #include "novascon.h"
 
+/*
+   'NUT_KERNEL' selects how the series are evaluated.  See function
+   'set_nutation_kernel' for more details.
+*/
+
+static short int NUT_KERNEL = NUTATION_KERNEL_SCALAR;
+
+/********set_nutation_kernel */
+
+short int set_nutation_kernel (short int kernel)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function selects how 'iau2000a', 'iau2000b' and 'nu2000k'
+      evaluate their series.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      kernel (short int)
+         Evaluation kernel.
+            = NUTATION_KERNEL_SCALAR ... term by term (the default)
+            = NUTATION_KERNEL_VECTOR ... vector instructions (see
+                                         'iau2000a_fast')
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'kernel'.
+          = 2 ... The kernel does not reproduce the scalar one within
+                  1 microarcsecond; the selection is not changed.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD
+      NUT_KERNEL   nutation.c
+
+   FUNCTIONS
+   CALLED:
+      iau2000a      nutation.c
+      nu2000k       nutation.c
+      iau2000a_fast nutation_fast.c
+      nu2000k_fast  nutation_fast.c
+      fabs          math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+      V1.1/10-26/ROA:           Added the check against the scalar
+                                kernel.
+
+   NOTES:
+      1. The fast kernels agree with the scalar ones to far better
+      than 1 microarcsecond, but not bit for bit; the scalar kernel
+      stays the default so that existing results are reproduced
+      exactly.
+      2. Before the vector kernel is selected, 'iau2000a' and 'nu2000k'
+      are evaluated with it and with the scalar kernel at a few dates
+      between 1800 and 2200.
+
+------------------------------------------------------------------------
+*/
+{
+   static const double check_days[4] = {-73048.5, -18262.5, 9131.25,
+      73048.5};
+   const double tol = 1.0e-6 * ASEC2RAD;
+
+   short int i;
+
+   double dp_ref, de_ref, dp, de;
+
+   if ((kernel != NUTATION_KERNEL_SCALAR) &&
+      (kernel != NUTATION_KERNEL_VECTOR))
+      return 1;
+
+/*
+   Check the fast kernel against the scalar one ('NUT_KERNEL' is still
+   the previous selection, so force the scalar path for the reference).
+*/
+
+   if (kernel != NUTATION_KERNEL_SCALAR)
+   {
+      short int previous = NUT_KERNEL;
+
+      NUT_KERNEL = NUTATION_KERNEL_SCALAR;
+      for (i = 0; i < 4; i++)
+      {
+         iau2000a (T0, check_days[i], &dp_ref, &de_ref);
+         iau2000a_fast (T0, check_days[i], &dp, &de);
+         if ((fabs (dp - dp_ref) > tol) || (fabs (de - de_ref) > tol))
+            break;
+
+         nu2000k (T0, check_days[i], &dp_ref, &de_ref);
+         nu2000k_fast (T0, check_days[i], &dp, &de);
+         if ((fabs (dp - dp_ref) > tol) || (fabs (de - de_ref) > tol))
+            break;
+      }
+      NUT_KERNEL = previous;
+
+      if (i < 4)
+         return 2;
+   }
+
+   NUT_KERNEL = kernel;
+
+   return 0;
+}
+
+/********get_nutation_kernel */
+
+short int get_nutation_kernel (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the evaluation kernel of the nutation
+      series selected with 'set_nutation_kernel'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         NUTATION_KERNEL_SCALAR or NUTATION_KERNEL_VECTOR.
+
+   GLOBALS
+   USED:
+      NUT_KERNEL   nutation.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   return NUT_KERNEL;
+}
+
 /********iau2000a */
 
 void iau2000a (double jd_high, double jd_low,
@@ -54,9 +217,11 @@ void iau2000a (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_KERNEL   nutation.c
 
    FUNCTIONS
    CALLED:
+      iau2000a_fast nutation_fast.c
       fund_args    novas.c
       fmod         math.h
       sin          math.h
@@ -69,6 +234,8 @@ void iau2000a (double jd_high, double jd_low,
                                 arrays.
       V1.2/03-11/WKP (USNO/AA): Added braces to 2-D array initialization
                                 to quiet gcc warnings.
+      V1.3/10-26/ROA:           Use the vector kernel if selected with
+                                'set_nutation_kernel'.
 
    NOTES:
      1. The IAU 2000A nutation model is MHB_2000 without the free core
@@ -2848,6 +3015,16 @@ void iau2000a (double jd_high, double jd_low,
       {    3.0,          0.0,          0.0,         -1.0},
       {    3.0,          0.0,          0.0,         -1.0}};
 
+/*
+   Fast kernel, if selected.
+*/
+
+   if (NUT_KERNEL != NUTATION_KERNEL_SCALAR)
+   {
+      iau2000a_fast (jd_high, jd_low, dpsi, deps);
+      return;
+   }
+
 /*
    Interval between fundamental epoch J2000.0 and given date.
 */
@@ -3058,9 +3235,11 @@ void iau2000b (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_KERNEL   nutation.c
 
    FUNCTIONS
    CALLED:
+      iau2000b_fast nutation_fast.c
       fmod      math.h
       sin       math.h
       cos       math.h
@@ -3072,6 +3251,8 @@ void iau2000b (double jd_high, double jd_low,
                                 arrays.
       V1.2/03-11/WKP (USNO/AA): Added braces to 2-D array initialization
                                 to quiet gcc warnings.
+      V1.3/10-26/ROA:           Use the vector kernel if selected with
+                                'set_nutation_kernel'.
 
    NOTES:
       1. IAU 2000B reproduces the IAU 2000A model to a precision of
@@ -3264,6 +3445,16 @@ void iau2000b (double jd_high, double jd_low,
       {      1405.0,       0.0,      4.0,     -610.0,     0.0,     2.0},
       {      1290.0,       0.0,      0.0,     -556.0,     0.0,     0.0}};
 
+/*
+   Fast kernel, if selected.
+*/
+
+   if (NUT_KERNEL != NUTATION_KERNEL_SCALAR)
+   {
+      iau2000b_fast (jd_high, jd_low, dpsi, deps);
+      return;
+   }
+
 /*
    Interval between fundamental epoch J2000.0 and given date.
 */
@@ -3418,9 +3609,11 @@ void nu2000k (double jd_high, double jd_low,
    GLOBALS
    USED:
       T0, ASEC2RAD, TWOPI
+      NUT_KERNEL   nutation.c
 
    FUNCTIONS
    CALLED:
+      nu2000k_fast nutation_fast.c
       fund_args    novas.c
       fmod         math.h
       sin          math.h
@@ -3433,6 +3626,8 @@ void nu2000k (double jd_high, double jd_low,
                                 arrays.
       V1.2/03-11/WKP (USNO/AA): Added braces to 2-D array initialization
                                 to quiet gcc warnings.
+      V1.3/10-26/ROA:           Use the vector kernel if selected with
+                                'set_nutation_kernel'.
 
    NOTES:
       1. NU2000K was compared to IAU 2000A over six centuries (1700-
@@ -4462,6 +4657,16 @@ void nu2000k (double jd_high, double jd_low,
       {  126.0,     -63.0,     -27.0,     -55.0},
       { -126.0,     -63.0,     -27.0,      55.0}};
 
+/*
+   Fast kernel, if selected.
+*/
+
+   if (NUT_KERNEL != NUTATION_KERNEL_SCALAR)
+   {
+      nu2000k_fast (jd_high, jd_low, dpsi, deps);
+      return;
+   }
+
 /*
    Interval between fundamental epoch J2000.0 and given date.
 */
@@ -0,0 +1,7394 @@
+/*
+   Naval Observatory Vector Astrometry Software (NOVAS)
+   C Edition, Version 3.1
+
+   nutation_fast.c: Fast evaluation of the nutation models
+
+   Royal Observatory of the Spanish Navy.
+*/
+
+#include <math.h>
+
+#include "novas.h"
+#include "nutation.h"
+#include "novascon.h"
+
+/*
+   The series of 'iau2000a', 'iau2000b' and 'nu2000k' are copied here as
+   structures of arrays (one row per multiplier or coefficient, with
+   the multipliers as signed chars), so that blocks of consecutive
+   terms are evaluated with vector instructions.  With GCC on x86-64
+   Linux the kernels are compiled for AVX-512, AVX2 and the baseline
+   SSE2, and the loader picks the best one for the CPU.
+
+   The sine and cosine of each term come from a vectorized polynomial
+   (NUTATION_KERNEL_VECTOR).
+
+   The batch functions ('iau2000a_batch', etc.) turn the loops around:
+   the vector lanes are the dates of a block, and the terms are taken
+   one at a time.
+*/
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__)
+   #define NUT_TARGET_CLONES \
+      __attribute__((target_clones("avx512f","avx2","default")))
+#else
+   #define NUT_TARGET_CLONES
+#endif
+
+/*
+   Number of terms evaluated together, and number of partial sums.
+*/
+
+#define NUT_BLOCK 64
+#define NUT_LANES 8
+
+/*
+   Prototypes of the functions private to this file.
+*/
+
+static void series_ls (long int n, long int ld, const signed char *mult,
+                       const double *coef, const double *a, double t,
+
+                       double *dp, double *de);
+
+static void series_pl (long int n, long int ld, const signed char *mult,
+                       const double *coef, const double *a,
+
+                       double *dp, double *de);
+
+static void series_ls_dates (long int m, long int n, long int ld,
+                             const signed char *mult,
+                             const double *coef, const double *a,
+                             const double *t, short int kernel,
+
+                             double *dp, double *de);
+
+static void series_pl_dates (long int m, long int n, long int ld,
+                             const signed char *mult,
+                             const double *coef, const double *a,
+                             short int kernel,
+
+                             double *dp, double *de);
+
+static inline void sincos_block (long int n, const double *x,
+
+                                 double *s, double *c);
+
+/*
+   IAU 2000A luni-solar argument multipliers (L, L', F, D, Om) and
+   coefficients, one row per column of 'nals_t' and 'cls_t' in
+   'iau2000a'.  The first 77 terms are the IAU 2000B series.
+*/
+static const signed char A_LS_MULT[5][678] = {
+   {
+        0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0, -1, -1,  1, -1, -1,
+        1, -2,  0,  0,  0, -2,  2,  1, -1,  2,  0,  0, -1,  0,  0,  1,
+        0, -1,  0,  1, -2,  0,  0,  0,  0,  1,  2, -2,  2,  0,  0, -1,
+        2,  1,  0,  1, -2,  3,  0,  1,  0, -1, -1,  0, -2,  1,  2, -1,
+        1,  1, -1,  1, -1,  0, -1, -1,  0,  1, -2, -1,  1, -2, -1,  2,
+        2,  1,  3,  3,  0,  0,  0,  0, -1,  2, -2, -1, -1,  0,  0,  0,
+        0,  0, -2,  1, -1, -1,  1,  1, -1,  3,  0, -1,  0, -1,  0,  1,
+       -1,  0,  2,  0,  1, -1,  0,  0,  0,  0, -1,  2,  1,  1,  2,  1,
+       -1,  0,  0, -1,  0, -1,  1,  1,  0,  1,  0,  1, -1,  1,  1,  0,
+       -1, -2,  4,  2,  2,  0,  1, -1,  0, -2,  2,  1, -1, -1,  2,  0,
+       -1,  2,  0,  0,  0,  0,  0,  0, -1,  1, -2, -2, -2, -1,  0,  3,
+       -2,  1,  0, -2, -3,  1,  0,  3, -1,  2,  0,  2, -1,  0,  0,  2,
+        4,  2,  0,  1,  0, -3, -1, -1, -1, -2,  1, -2, -2,  2, -3, -2,
+       -1,  0, -1,  0, -1,  2,  0, -2, -1, -1,  3, -1,  2,  0,  0,  2,
+        0, -1,  0,  1,  1, -1,  1, -2, -1, -2,  0,  1,  2,  1,  4,  2,
+        3, -2,  1,  1, -1,  0,  0, -2, -2, -1,  1,  0, -1,  1,  1,  2,
+        1,  2, -2,  1,  0,  1, -2,  1,  1,  1,  2,  3,  4, -2,  0,  1,
+        0,  2, -1,  1,  0,  0, -1,  0, -2, -1,  2,  0,  0, -1, -2,  1,
+       -3, -3, -2,  2, -2,  1,  0, -1,  0,  1,  1, -1,  3,  0,  2,  0,
+        2, -1,  1,  1,  0, -1,  3, -1,  1, -2,  2, -1,  1,  2,  1, -3,
+        2, -1, -4, -1,  0,  1,  0, -2,  0, -2, -2,  0,  1,  3, -1,  1,
+        1, -3, -3, -2,  0, -3, -1,  0,  2,  0,  1, -2, -2, -4,  1, -1,
+        0,  0, -3, -3,  1, -1,  1,  1,  0, -1,  1,  0, -1,  1, -1,  1,
+       -1, -1,  3,  1,  1, -2,  0, -2, -2,  2,  1,  0,  1, -2,  2,  0,
+        0,  0,  0, -3, -1,  1, -1, -1, -1,  1,  0, -2,  0,  0, -1, -1,
+       -2,  1,  0,  3,  2,  1,  0,  1,  3,  3,  2,  1,  0,  1, -2,  0,
+       -2,  0,  0, -1, -2,  2,  2, -1,  3,  4, -1, -1, -3, -1,  3,  3,
+        3,  1,  5,  0,  2,  0,  1,  3,  3,  5,  0,  4,  0, -1,  0,  1,
+        2, -1, -1, -1, -2, -1, -4, -3, -2,  1,  2, -4, -3, -1,  0,  0,
+       -3, -2, -1, -4,  2,  2,  0, -1, -2,  1,  1,  0,  1, -1, -2, -2,
+       -2, -2,  1,  1, -1,  2, -1,  0, -1, -1,  0, -2,  1,  1, -3, -1,
+       -1, -3, -3,  2,  0,  2, -2,  0,  0, -1,  2, -4, -1,  0, -3, -1,
+       -2,  0, -2,  1, -1,  1,  2,  2,  0,  0, -1, -1, -1, -2,  0, -2,
+        0, -3,  1, -1,  1,  0,  0,  0, -1,  0, -2,  2,  3,  1,  1,  2,
+       -1, -2,  0,  0, -1, -2, -1,  2,  1, -1,  0, -1, -1, -1,  0, -2,
+        2,  1,  1,  1,  0,  2,  0,  0,  0,  4,  2,  2, -1, -1, -3, -3,
+       -1, -3, -3,  0, -2, -4, -1, -3,  0, -1,  1,  0, -1,  0, -2, -1,
+        3,  2,  2,  0,  0,  0, -1, -1,  1,  3,  1, -2,  0, -2, -2,  0,
+        0, -1, -2,  2,  1,  0,  0,  1,  0,  1, -1, -2,  2,  2,  2,  1,
+        0,  2,  3,  1,  1,  1,  0,  2,  2,  4, -1, -3, -1, -3,  1,  1,
+       -2,  1,  3,  1,  0, -1,  0, -1,  2,  5,  2,  1,  3,  3, -2,  0,
+        0, -2,  2,  2,  2,  0,  1,  4,  2,  0,  4,  3,  2,  4, -1, -1,
+        1,  1,  3,  5,  2,  2},
+   {
+        0,  0,  0,  0,  1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  0,
+       -1,  0,  2,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0, -1,  0, -1,
+        0,  0,  1, -1,  0,  0, -1, -1,  0, -1,  0, -1,  0,  1,  0,  1,
+        1,  0,  0,  0,  0,  0,  0,  1, -2,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0, -1,  0,  1,  0, -1,
+        0,  0, -1,  1,  1,  1, -1, -1,  1,  0,  1,  0,  1, -1, -1,  0,
+        0, -1, -1,  0, -1,  1,  1, -1,  3,  0,  0,  1,  1,  1,  0,  0,
+        0,  1,  1,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0, -1,  1,  1,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,
+       -2,  1,  0,  0,  3,  0, -1,  0, -1,  0,  2, -1,  0, -1,  0,  0,
+       -1,  0, -2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  1,  0, -2,  0,
+        0,  0,  2,  0,  2,  0,  1, -1, -2, -1, -1,  1,  1,  1,  0,  0,
+        1, -1,  0, -2,  0,  0,  0,  0,  0,  1,  0,  0, -1,  1, -1, -1,
+        2, -1, -2,  0, -1, -1, -1, -1,  0, -1,  2,  1,  0,  0,  0,  1,
+       -1,  2,  0,  1, -1, -1, -1,  0,  0,  0, -2,  1,  2, -1,  2, -1,
+        0,  1,  0, -2,  1,  0,  0,  1,  0,  0,  0,  1,  0, -1,  1,  0,
+       -1, -1,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0, -1,  1,  1,  1,  1,  0, -1,  1,  2,  1, -1, -1,  0,
+        0, -1,  0, -2,  0,  1,  0,  0,  1,  0,  1,  0,  0,  0,  1,  1,
+        0,  0,  0, -1,  0,  0, -1,  1,  0, -2,  0, -2,  2,  0,  1, -1,
+        1,  0,  0,  0,  0,  0, -1,  1,  1,  2,  0,  0, -1,  0,  1,  0,
+        0,  3, -1,  0, -1, -1, -2, -1,  0, -1, -2, -1,  0,  1,  1,  2,
+        2,  0,  0,  2,  0, -1, -1,  1, -1,  0,  0,  1, -1,  0,  1,  1,
+       -1,  0,  2,  0, -1, -2,  0, -2,  0,  0,  0,  0,  0,  0,  1, -1,
+        0,  0, -1, -1,  0, -1,  0,  0,  1, -1,  0,  1,  0,  2,  0, -1,
+       -1, -2, -1,  0,  1,  0, -2,  1,  0,  0,  0, -2,  0,  0,  0, -1,
+        0,  0,  0, -1, -1,  1, -1, -1,  0,  0,  0,  0, -1,  0, -2,  0,
+       -2,  0,  0, -1,  2,  0,  1,  0, -1,  0, -1,  0,  1,  0, -2, -2,
+        0, -1,  0,  0,  1, -1,  0,  2,  1,  1,  0,  2, -1,  1,  0,  0,
+       -2,  0,  2,  1,  2,  0,  2,  0, -1,  1,  0,  1, -2,  0,  1,  1,
+       -1,  0, -1,  0,  1,  0,  1, -1,  1,  0,  0,  0, -1,  0,  0,  0,
+        0,  0, -1,  0,  0,  0,  1,  1,  1,  1, -1, -3,  0, -1,  0,  0,
+       -1,  0,  1,  1, -2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  2,  0,
+        1, -2, -3,  0, -1,  0,  0, -2, -1,  0, -2,  0,  1, -1, -1,  1,
+       -2,  1,  0,  0,  2, -1, -1,  0,  1,  0,  2,  0, -2, -3,  0,  0,
+       -1,  0,  0,  1,  1,  0,  0,  0,  0,  1, -2,  1,  0,  0,  0,  1,
+        0,  1, -1,  0,  0,  0,  2,  0,  2,  1,  1, -1, -2,  0, -2, -3,
+        0, -1,  0, -1,  0,  1,  1, -1,  0,  0,  0,  0,  1,  1, -1,  0,
+        1,  0,  0,  0,  0,  1,  2,  1,  0,  1, -1, -1,  0,  0, -1, -1,
+        0, -2, -1, -1,  0,  1,  1,  0,  0,  0,  1,  0,  1,  0, -1,  0,
+       -2,  0,  0,  0, -2,  0,  0,  0,  0,  0, -1,  0,  1,  1, -1,  0,
+       -1,  1,  1,  0, -1,  0},
+   {
+        0,  2,  2,  0,  0,  2,  0,  2,  2,  2,  2,  2,  0,  0,  0,  2,
+        2,  2,  0,  2,  2,  0,  2,  2,  2,  0,  2,  0,  0,  2, -2,  0,
+        0,  2,  0,  2,  2,  2,  2,  2,  0,  2,  2,  0,  2,  2,  0,  0,
+        0,  0,  2,  0,  2,  2,  0,  2,  0,  2,  2,  2,  0,  2,  0,  0,
+        0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  2,  0,  2,  2,  4,  2,
+        2,  0,  0,  2,  4,  2, -2,  2,  0, -2,  0,  0,  0,  0, -2,  2,
+        2,  2,  0,  0,  0,  0,  0,  2,  2,  2, -2,  0,  2,  2,  0,  2,
+       -2,  2,  2,  0,  2,  2,  0, -2,  2,  0,  2,  2,  0,  2,  0, -2,
+        0,  0,  0,  2,  0,  0,  2,  0,  0,  2,  2,  0,  2, -2,  2,  2,
+        2,  2,  2,  0,  2,  2,  4,  0,  0,  2,  2,  0,  0,  4,  2,  2,
+        0,  0,  4,  0,  0,  2,  0,  0,  2,  2,  0,  2,  0,  2,  4,  2,
+        0,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0,  2,  0,  2,  2,  0,
+        2,  0,  0,  0,  2,  0,  2,  0,  2,  2,  2,  0,  2,  0,  2,  2,
+        0,  2,  4,  2,  2,  0,  2,  4, -2,  2,  0,  2,  2,  2,  2,  2,
+       -2,  2,  0,  2,  0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  0,  2,
+        2,  0,  2,  2,  2,  0,  0,  0, -2, -2,  0,  0,  0,  2,  2,  2,
+        2,  2,  0,  2,  2,  4,  4,  2,  0,  2,  2,  2,  2,  2, -2, -2,
+       -2,  0,  2,  2,  2,  2, -2,  2,  0,  0,  2,  4,  4,  0,  0, -2,
+        2,  2,  2,  0,  2,  0,  4,  0,  0,  0,  0,  2,  2,  0,  0,  4,
+        4,  2,  0,  2,  2,  2,  0,  4,  2,  2,  2,  2,  2,  2, -2,  2,
+       -2,  0,  2,  0, -2,  0,  2,  2,  2,  0, -2, -2,  0,  0,  2,  2,
+        0,  2,  2,  0, -2,  0, -2,  2,  0,  0,  0,  2,  0,  0,  0,  2,
+        4,  2,  0,  0, -2,  0,  0,  0,  0,  2,  2,  2,  2,  0,  2,  0,
+        2,  4,  2,  2,  4,  0,  0,  0,  2, -2,  0,  0,  2,  4,  0,  2,
+        4,  4,  2,  0,  0,  0,  0,  2,  0, -2, -2, -2,  0,  0,  0,  2,
+        2,  0,  2,  0,  0,  2,  2,  2,  0,  2,  2,  2,  4,  2,  0,  0,
+        2,  2,  2,  2,  2,  0,  2,  2,  2,  2,  0,  2,  2,  2,  0,  2,
+        2,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  1,  2, -1,
+        0,  1,  1,  2,  0,  1,  2,  2,  2, -2, -2,  2,  0, -1,  0,  0,
+        0,  0, -2,  0, -2,  0,  1,  0,  2,  0,  1,  0,  2,  2,  4,  4,
+        0, -2,  2,  2,  2,  0,  0,  0,  2,  0,  0,  0,  0, -2,  0, -2,
+        0,  0,  0,  2,  2,  0,  2,  2,  0,  0, -2,  2,  0, -2,  0, -2,
+       -2, -4, -2,  2,  2,  0,  2,  2,  4,  4, -2,  0, -2,  0, -2,  0,
+        0,  2, -2,  0,  2,  1,  1,  1,  0,  2,  2,  0,  0,  2,  0,  2,
+        4,  0,  0, -2,  0,  0,  0,  0,  0,  0,  2,  1,  0,  2,  2,  2,
+        2,  0,  1,  1,  0,  2,  4,  4,  4,  2,  2,  4,  0,  2,  2,  2,
+        0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  2,  2,  2,
+        0,  0,  2,  2,  3,  3,  2,  4,  2,  2,  4,  0,  0,  0,  2,  2,
+        0,  2,  2,  0,  0,  0,  0,  2,  2,  2,  2,  4,  0,  0,  2,  2,
+        2,  2,  2,  2,  3,  2,  2,  2,  4,  2,  0,  2,  0,  2,  0,  0,
+        2,  2,  0,  2,  2,  2,  2,  4,  2,  0,  2,  4,  2,  4,  2,  0,
+        2,  2,  0,  0,  2,  2,  2,  0,  2,  4,  2,  2,  2,  2,  2,  2,
+        2,  2,  2,  2,  2,  2},
+   {
+        0, -2,  0,  0,  0, -2,  0,  0,  0, -2, -2,  0,  2,  0,  0,  2,
+        0,  0,  2,  2, -2,  2,  0, -2,  0,  0,  0,  0,  2, -2,  2, -2,
+        0,  2,  0,  2,  0,  0,  2,  0,  2, -2, -2,  2,  0, -2, -2,  2,
+       -2,  2, -2,  0,  0,  0,  2,  0,  1,  2,  0,  2,  0,  0,  0,  1,
+        0,  0, -2,  0,  1,  1,  4,  1, -2,  2,  2,  0, -2,  4,  0, -2,
+        2,  2,  0, -2, -2,  0,  2, -2,  4,  0,  4,  2,  1,  0,  0,  0,
+       -1,  4,  2, -2,  2,  1,  0,  2,  2,  0,  2, -2,  2,  2,  0, -4,
+        2,  2,  0,  2,  0,  0,  2,  2, -2,  1,  2,  0,  0,  0,  2,  2,
+        2,  1, -2, -2, -1,  0, -1,  2,  4,  1,  1, -2,  4,  0, -2,  2,
+       -1,  2,  0,  0, -2,  1, -2,  0,  2,  4,  0,  1,  4,  0,  2, -3,
+        2,  0,  0,  0,  0, -4,  2,  4,  4,  4,  2,  0,  2,  0, -2, -2,
+        2, -1,  2,  4,  0,  2,  4,  2, -2, -4, -2, -4,  2, -1,  2,  2,
+       -2, -2,  0, -4, -2,  4,  0,  4,  2,  4,  2,  2,  0, -2,  0, -2,
+        2, -1, -2,  0,  1,  0,  0,  0,  0,  2,  0,  3,  0,  2,  4,  2,
+        2, -1,  0, -4, -2,  0, -2,  4,  3,  2,  0,  2, -1,  1,  0,  0,
+        0,  2, -3, -4, -2, -1, -2,  0,  2,  4,  0,  1,  2, -2, -2, -2,
+       -1, -2, -2,  0,  1, -2,  2,  1,  4,  2,  1,  0,  0,  0,  2,  1,
+        2, -2, -1, -3, -2, -3,  2, -4,  0, -1, -4, -4, -4,  2,  3,  2,
+        2,  2,  2,  0,  2,  1, -2, -2, -4,  2,  2,  2, -2,  4,  2,  0,
+       -2,  4,  4,  2,  3,  4,  2,  2,  2,  6,  2,  6,  4,  4,  1,  1,
+        0,  1,  2,  1,  2, -1, -2,  0, -2,  2,  4,  2, -2, -4, -2, -4,
+       -2,  0,  0,  1,  1,  2,  2, -4, -4, -2, -3, -2,  0,  2, -4, -4,
+       -4, -2,  4,  4,  2,  2,  0,  0,  1,  0, -2, -1,  0,  0,  0,  0,
+        0, -2, -4, -2, -4,  4,  2,  4,  2,  2,  1,  2, -1,  0,  0,  0,
+       -2, -2,  0,  6,  4,  2,  4,  2, -2, -2, -2,  0,  3,  3,  4,  2,
+        3,  2,  1,  0,  1,  0,  1,  0,  0, -2, -1,  0, -1,  0,  6,  4,
+        4,  2,  2,  3,  4,  2,  0,  3, -1, -2,  6,  4,  6,  4,  2,  0,
+        0,  0, -2,  4,  2,  4,  4,  2,  2,  0,  6,  2, -1,  0, -2,  0,
+       -2,  0,  0, -1,  2,  0,  2,  1,  0,  1,  0,  2,  3,  2,  0,  0,
+        3,  2,  3,  4,  0, -2, -1,  1,  0, -1, -2,  0, -3, -1, -2, -2,
+        2,  4, -4, -4, -2, -3,  0, -2, -2,  0, -1,  1, -2,  0,  2,  2,
+        0,  2,  2, -6, -4, -4, -2, -4, -2, -2, -2,  0, -1,  0,  1,  1,
+        2,  2,  2, -6, -4, -4, -4, -4, -4, -4,  4,  2,  4,  3,  3,  3,
+        1,  2,  2,  2, -2,  0,  0,  0,  2,  0,  0, -1, -2, -2,  0, -3,
+       -2,  4,  2,  4,  3,  4,  3,  0,  1,  2,  0,  2,  3,  1,  0,  2,
+       -2,  1,  0,  0,  2, -2, -2, -2, -2, -4, -2, -4,  4,  2,  4, -2,
+       -2,  0,  2, -4, -2,  0, -4, -2,  3,  4,  0,  3,  2,  2,  2,  2,
+        0,  1, -1,  0,  0,  0,  2,  0,  0, -2, -2,  6,  4,  6,  4,  2,
+        4,  3,  4,  2,  3,  4,  4,  1,  2,  2,  2,  2,  2,  2,  0,  1,
+        2,  0,  0,  0,  0,  1,  2,  0, -2, -2,  6,  6,  6,  6,  4,  4,
+        5,  2,  2,  2,  3,  4,  3,  2,  1,  0,  1,  0,  0, -2,  6,  6,
+        4,  6,  4,  4,  2,  4,  3,  2,  2,  2,  0,  1,  2,  0,  6,  6,
+        4,  4,  2,  0,  4,  4},
+   {
+        1,  2,  2,  2,  0,  2,  0,  1,  2,  2,  1,  2,  0,  1,  1,  2,
+        1,  1,  0,  2,  2,  0,  2,  2,  1,  0,  0,  1,  1,  2,  0,  1,
+        1,  1,  0,  2,  0,  2,  1,  2,  1,  1,  2,  1,  1,  1,  1,  0,
+        1,  0,  1,  0,  2,  2,  0,  2,  0,  2,  0,  2,  1,  2,  1,  0,
+        0,  0,  1,  2,  0,  2,  2,  1,  1,  1,  2,  2,  2,  2,  2,  1,
+        2,  1,  0,  2,  2,  1,  1,  3,  0,  1,  0,  1,  1,  2,  1,  1,
+        2,  2,  0,  1,  0,  2,  1,  2,  2,  1,  0,  1,  2,  1,  2,  1,
+        0,  1,  2,  2,  1,  2,  0,  0,  2,  1,  0,  2,  1,  1,  0,  0,
+        2,  0,  1,  2,  1,  1,  2,  0,  0,  2,  1,  2,  1,  1,  1,  0,
+        1,  1,  2,  0,  2,  2,  2,  1,  1,  1,  0,  0,  1,  1,  1,  2,
+        0,  0,  2,  3,  0,  1,  1,  1,  2,  2,  0,  1,  2,  2,  1,  1,
+        1,  1,  0,  1,  1,  2,  1,  2,  1,  1,  2,  1,  1,  1,  2,  1,
+        2,  2,  1,  1,  1,  0,  1,  0,  2,  2,  1,  0,  1,  1,  1,  1,
+        2,  2,  2,  2,  2,  2,  3,  2,  1,  1,  1,  2,  1,  1,  2,  2,
+        0,  1,  1,  2,  1,  1,  2,  0,  0,  2,  2,  0,  2,  1,  0,  1,
+        2,  1,  1,  1,  1,  1,  1,  2,  0,  0,  0,  1,  0,  1,  2,  2,
+        1,  1,  1,  2,  1,  1,  2,  2,  0,  0,  2,  2,  1,  0,  1,  0,
+        1,  1,  2,  2,  3,  1,  1,  2,  1,  1,  2,  4,  2,  1,  0,  1,
+        2,  1,  0,  1,  2,  0,  2,  1,  1,  1,  1,  2,  2,  0,  0,  1,
+        2,  1,  1,  2,  2,  2,  0,  2,  1,  2,  2,  2,  1,  2,  0,  2,
+        2,  2,  1,  0,  2,  2,  3,  0,  4,  0,  0,  0,  1,  1,  2,  1,
+        2,  0,  2,  0,  0,  1,  0,  1,  1,  1,  1,  2,  1,  0,  1,  1,
+        1,  2,  0,  1,  0,  2,  1,  2,  2,  0,  2,  1,  3,  2,  0,  0,
+        2,  1,  2,  1,  2,  1,  2,  0,  1,  0,  1,  2,  2,  1,  1,  0,
+        2,  4,  1,  0,  1,  0,  2,  1,  2,  1,  1,  1,  1,  0,  0,  0,
+        2,  2,  2,  0,  0,  0,  0,  3,  0,  2,  1,  0,  2,  2,  0,  1,
+        1,  1,  0,  1,  2,  2,  2,  2,  2,  1,  0,  2,  2,  0,  1,  1,
+        0,  2,  2,  1,  1,  2,  2,  2,  1,  2,  2,  2,  1,  3,  3,  1,
+        1,  2,  1,  2,  2,  0,  2,  1,  2,  1,  1,  0,  0,  0,  2,  2,
+        0,  2,  0,  0,  1,  2,  0,  0,  2,  1,  1,  2,  1,  1,  2,  1,
+        1,  0,  1,  2,  1,  1,  1,  0,  2,  2,  2,  0,  1,  2,  0,  0,
+        2,  0,  0,  1,  2,  2,  1,  1,  2,  0,  1,  1,  1,  2,  0,  0,
+        1,  0,  0,  1,  2,  2,  2,  1,  4,  2,  0,  0,  1,  0,  0,  1,
+        0,  0,  0,  2,  1,  2,  1,  0,  1,  2,  2,  1,  1,  3,  1,  2,
+        2,  0,  0,  0,  0,  2,  1,  0,  0,  0,  1,  1,  0,  2,  0,  1,
+        2,  1,  1,  0,  0,  1,  1,  3,  1,  2,  2,  2,  0,  2,  2,  1,
+        1,  2,  0,  1,  1,  1,  1,  1,  2,  1,  1,  0,  3,  2,  2,  0,
+        2,  0,  2,  1,  3,  2,  1,  0,  1,  1,  2,  0,  0,  1,  2,  2,
+        2,  2,  0,  1,  0,  1,  0,  2,  3,  2,  2,  1,  1,  0,  0,  0,
+        0,  3,  2,  2,  3,  1,  2,  0,  1,  2,  0,  2,  1,  1,  1,  0,
+        2,  1,  0,  0,  1,  1,  2,  1,  1,  0,  2,  1,  1,  2,  2,  0,
+        2,  1,  1,  0,  2,  0,  2,  0,  0,  2,  2,  2,  1,  2,  2,  1,
+        1,  2,  2,  1,  2,  1}};
+
+static const double A_LS_COEF[6][678] = {
+   {
+      -172064161.0,-13170906.0, -2276413.0,  2074554.0,  1475877.0,  -516821.0,
+         711159.0,  -387298.0,  -301461.0,   215829.0,   128227.0,   123457.0,
+         156994.0,    63110.0,   -57976.0,   -59641.0,   -51613.0,    45893.0,
+          63384.0,   -38571.0,    32481.0,   -47722.0,   -31046.0,    28593.0,
+          20441.0,    29243.0,    25887.0,   -14053.0,    15164.0,   -15794.0,
+          21783.0,   -12873.0,   -12654.0,   -10204.0,    16707.0,    -7691.0,
+         -11024.0,     7566.0,    -6637.0,    -7141.0,    -6302.0,     5800.0,
+           6443.0,    -5774.0,    -5350.0,    -4752.0,    -4940.0,     7350.0,
+           4065.0,     6579.0,     3579.0,     4725.0,    -3075.0,    -2904.0,
+           4348.0,    -2878.0,    -4230.0,    -2819.0,    -4056.0,    -2647.0,
+          -2294.0,     2481.0,     2179.0,     3276.0,    -3389.0,     3339.0,
+          -1987.0,    -1981.0,     4026.0,     1660.0,    -1521.0,     1314.0,
+          -1283.0,    -1331.0,     1383.0,     1405.0,     1290.0,    -1214.0,
+           1146.0,     1019.0,    -1100.0,     -970.0,     1575.0,      934.0,
+            922.0,      815.0,      834.0,     1248.0,     1338.0,      716.0,
+           1282.0,      742.0,     1020.0,      715.0,     -666.0,     -667.0,
+           -704.0,     -694.0,    -1014.0,     -585.0,     -949.0,     -595.0,
+            528.0,     -590.0,      570.0,     -502.0,     -875.0,     -492.0,
+            535.0,     -467.0,      591.0,     -453.0,      766.0,     -446.0,
+           -488.0,     -468.0,     -421.0,      463.0,     -673.0,      658.0,
+           -438.0,     -390.0,      639.0,      412.0,     -361.0,      360.0,
+            588.0,     -578.0,     -396.0,      565.0,     -335.0,      357.0,
+            321.0,     -301.0,     -334.0,      493.0,      494.0,      337.0,
+            280.0,      309.0,     -263.0,      253.0,      245.0,      416.0,
+           -229.0,      231.0,     -259.0,      375.0,      252.0,     -245.0,
+            243.0,      208.0,      199.0,     -208.0,      335.0,     -325.0,
+           -187.0,      197.0,     -192.0,     -188.0,      276.0,     -286.0,
+            186.0,     -219.0,      276.0,     -153.0,     -156.0,     -154.0,
+           -174.0,     -163.0,     -228.0,       91.0,      175.0,     -159.0,
+            141.0,      147.0,     -132.0,      159.0,      213.0,      123.0,
+           -118.0,      144.0,     -121.0,     -134.0,     -105.0,     -102.0,
+            120.0,      101.0,     -113.0,     -106.0,     -129.0,     -114.0,
+            113.0,     -102.0,      -94.0,     -100.0,       87.0,      161.0,
+             96.0,      151.0,     -104.0,     -110.0,     -100.0,       92.0,
+             82.0,       82.0,      -78.0,      -77.0,        2.0,       94.0,
+            -93.0,      -83.0,       83.0,      -91.0,      128.0,      -79.0,
+            -83.0,       84.0,       83.0,       91.0,      -77.0,       84.0,
+            -92.0,      -92.0,      -94.0,       68.0,      -61.0,       71.0,
+             62.0,      -63.0,      -73.0,      115.0,     -103.0,       63.0,
+             74.0,     -103.0,      -69.0,       57.0,       94.0,       64.0,
+            -63.0,      -38.0,      -43.0,      -45.0,       47.0,      -48.0,
+             45.0,       56.0,       88.0,      -75.0,       85.0,       49.0,
+            -74.0,      -39.0,       45.0,       51.0,      -40.0,       41.0,
+            -42.0,      -51.0,      -42.0,       39.0,       46.0,      -53.0,
+             82.0,       81.0,       47.0,       53.0,      -45.0,      -44.0,
+            -33.0,      -61.0,       28.0,      -38.0,      -33.0,      -60.0,
+             48.0,       27.0,       38.0,       31.0,      -29.0,       28.0,
+            -32.0,       45.0,      -44.0,       28.0,      -51.0,      -36.0,
+             44.0,       26.0,      -60.0,       35.0,      -27.0,       47.0,
+             36.0,      -36.0,      -35.0,      -37.0,       32.0,       35.0,
+             32.0,       65.0,       47.0,       32.0,       37.0,      -30.0,
+            -32.0,      -31.0,       37.0,       31.0,       49.0,       32.0,
+             23.0,      -43.0,       26.0,      -32.0,      -29.0,      -27.0,
+             30.0,      -11.0,      -21.0,      -34.0,      -10.0,      -36.0,
+             -9.0,      -12.0,      -21.0,      -29.0,      -15.0,      -20.0,
+             28.0,       17.0,      -22.0,      -14.0,       24.0,       11.0,
+             14.0,       24.0,       18.0,      -38.0,      -31.0,      -16.0,
+             29.0,      -18.0,      -10.0,      -17.0,        9.0,       16.0,
+             22.0,       20.0,      -13.0,      -17.0,      -14.0,        0.0,
+             14.0,       19.0,      -34.0,      -20.0,        9.0,      -18.0,
+             13.0,       17.0,      -12.0,       15.0,      -11.0,       13.0,
+            -18.0,      -35.0,        9.0,      -19.0,      -26.0,        8.0,
+            -10.0,       10.0,      -21.0,      -15.0,        9.0,      -29.0,
+            -19.0,       12.0,       22.0,      -10.0,      -20.0,      -20.0,
+            -17.0,       15.0,        8.0,       14.0,      -12.0,       25.0,
+            -13.0,      -14.0,       13.0,      -17.0,      -12.0,      -10.0,
+             10.0,      -15.0,      -22.0,       28.0,       15.0,       23.0,
+             12.0,       29.0,      -25.0,       22.0,      -18.0,       15.0,
+            -23.0,       12.0,       -8.0,      -19.0,      -10.0,       21.0,
+             23.0,      -16.0,      -19.0,      -22.0,       27.0,       16.0,
+             19.0,        9.0,       -9.0,       -9.0,       -8.0,       18.0,
+             16.0,      -10.0,      -23.0,       16.0,      -12.0,       -8.0,
+             30.0,       24.0,       10.0,      -16.0,      -16.0,       17.0,
+            -24.0,      -12.0,      -24.0,      -23.0,      -13.0,      -15.0,
+              0.0,        0.0,       -4.0,        0.0,        5.0,        0.0,
+              0.0,       -3.0,        4.0,        0.0,        5.0,        3.0,
+             -3.0,       -5.0,        3.0,        3.0,        3.0,        0.0,
+              0.0,        4.0,        6.0,        5.0,       -7.0,      -12.0,
+              5.0,        3.0,       -5.0,        3.0,       -7.0,        7.0,
+              0.0,        4.0,        3.0,       -3.0,       -7.0,       -4.0,
+             -3.0,        0.0,       -3.0,        7.0,       -4.0,        4.0,
+             -5.0,        5.0,       -5.0,        5.0,       -8.0,        9.0,
+              6.0,       -5.0,        3.0,       -7.0,       -3.0,        5.0,
+              3.0,       -3.0,        4.0,        3.0,       -5.0,        4.0,
+              9.0,        4.0,        4.0,       -3.0,       -4.0,        9.0,
+             -4.0,       -4.0,        3.0,        8.0,        3.0,       -3.0,
+              3.0,        3.0,       -3.0,        6.0,        3.0,       -3.0,
+             -7.0,        9.0,       -3.0,       -3.0,       -4.0,       -5.0,
+            -13.0,       -7.0,       10.0,        3.0,       10.0,        0.0,
+              0.0,        0.0,       -7.0,       -4.0,        4.0,        5.0,
+              5.0,       -3.0,       -3.0,       -4.0,       -5.0,        6.0,
+              9.0,        5.0,       -7.0,       -3.0,       -4.0,        7.0,
+             -4.0,        4.0,       -6.0,        0.0,       11.0,        3.0,
+             11.0,       -3.0,       -1.0,        4.0,        0.0,        3.0,
+             -7.0,        5.0,       -3.0,        3.0,        5.0,       -7.0,
+              8.0,       -4.0,       11.0,       -3.0,        3.0,       -4.0,
+              8.0,        3.0,       11.0,       -6.0,       -4.0,       -8.0,
+             -7.0,       -4.0,        3.0,        6.0,       -6.0,        6.0,
+              6.0,        5.0,       -5.0,       -4.0,       -4.0,        4.0,
+              6.0,       -4.0,        0.0,        0.0,        5.0,      -13.0,
+              3.0,        4.0,        7.0,        4.0,        5.0,       -3.0,
+             -6.0,       -5.0,       -7.0,        5.0,       13.0,       -4.0,
+             -3.0,        5.0,      -11.0,        5.0,        4.0,        4.0,
+             -4.0,        6.0,        3.0,      -12.0,        4.0,       -3.0,
+             -4.0,        3.0,        3.0,       -3.0,        0.0,       -7.0,
+              6.0,       -3.0,        5.0,        3.0,        3.0,       -3.0,
+             -5.0,       -3.0,       -3.0,       12.0,        3.0,       -4.0,
+              4.0,        6.0,        5.0,        4.0,       -6.0,        4.0,
+              6.0,        6.0,       -6.0,        3.0,        7.0,        4.0,
+             -5.0,        5.0,       -6.0,       -6.0,       -4.0,       10.0,
+             -4.0,        7.0,        7.0,        4.0,       11.0,        5.0,
+             -6.0,        4.0,        3.0,        5.0,       -4.0,       -4.0,
+             -3.0,        4.0,        3.0,       -3.0,       -3.0,       -3.0},
+   {
+        -174666.0,    -1675.0,     -234.0,      207.0,    -3633.0,     1226.0,
+             73.0,     -367.0,      -36.0,     -494.0,      137.0,       11.0,
+             10.0,       63.0,      -63.0,      -11.0,      -42.0,       50.0,
+             11.0,       -1.0,        0.0,        0.0,       -1.0,        0.0,
+             21.0,        0.0,        0.0,      -25.0,       10.0,       72.0,
+              0.0,      -10.0,       11.0,        0.0,      -85.0,        0.0,
+              0.0,      -21.0,      -11.0,       21.0,      -11.0,       10.0,
+              0.0,      -11.0,        0.0,      -11.0,      -11.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,      -11.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          33386.0,   -13696.0,     2796.0,     -698.0,    11817.0,     -524.0,
+           -872.0,      380.0,      816.0,      111.0,      181.0,       19.0,
+           -168.0,       27.0,     -189.0,      149.0,      129.0,       31.0,
+           -150.0,      158.0,        0.0,      -18.0,      131.0,       -1.0,
+             10.0,      -74.0,      -66.0,       79.0,       11.0,      -16.0,
+             13.0,      -37.0,       63.0,       25.0,      -10.0,       44.0,
+            -14.0,      -11.0,       25.0,        8.0,        2.0,        2.0,
+             -7.0,      -15.0,       21.0,       -3.0,      -21.0,       -8.0,
+              6.0,      -24.0,        5.0,       -6.0,       -2.0,       15.0,
+            -10.0,        8.0,        5.0,        7.0,        5.0,       11.0,
+            -10.0,       -7.0,       -2.0,        1.0,        5.0,      -13.0,
+             -6.0,        0.0,     -353.0,       -5.0,        9.0,        0.0,
+              0.0,        8.0,       -2.0,        4.0,        0.0,        5.0,
+             -3.0,       -1.0,        9.0,        2.0,       -6.0,       -3.0,
+             -1.0,       -1.0,        2.0,        0.0,       -5.0,       -2.0,
+             -3.0,        1.0,      -25.0,       -4.0,       -3.0,        1.0,
+              0.0,        5.0,       -1.0,       -2.0,        1.0,        0.0,
+              0.0,        4.0,       -2.0,        3.0,        1.0,       -3.0,
+             -2.0,        1.0,        0.0,       -1.0,        1.0,        2.0,
+              2.0,        0.0,        1.0,        0.0,        2.0,        0.0,
+              0.0,        0.0,       -2.0,       -2.0,        0.0,       -1.0,
+             -3.0,        1.0,        0.0,       -1.0,       -1.0,        1.0,
+              1.0,       -1.0,        0.0,       -2.0,       -2.0,       -1.0,
+             -1.0,        1.0,        2.0,        1.0,        0.0,       -2.0,
+              0.0,        0.0,        2.0,       -1.0,        0.0,        1.0,
+             -1.0,        1.0,        0.0,        1.0,       -2.0,        1.0,
+              0.0,       -1.0,        2.0,        0.0,        0.0,        1.0,
+             -1.0,        0.0,        0.0,       -1.0,        0.0,        1.0,
+              1.0,        2.0,        0.0,       -4.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,      -28.0,        0.0,        0.0,
+             -1.0,       -1.0,        1.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        1.0,        0.0,
+             -1.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        1.0,       -5.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       10.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              1.0,        1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -3.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+          -1988.0,      -63.0,        0.0,        5.0,        0.0,      364.0,
+          -1044.0,        0.0,        0.0,      330.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        5.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+            -12.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       13.0,       30.0,
+           -162.0,       75.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -3.0,       -3.0,        0.0,        0.0,
+              0.0,        0.0,        3.0,        0.0,      -13.0,        6.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,      -26.0,      -10.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -5.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+       92052331.0,  5730336.0,   978459.0,  -897492.0,    73871.0,   224386.0,
+          -6750.0,   200728.0,   129025.0,   -95929.0,   -68982.0,   -53311.0,
+          -1235.0,   -33228.0,    31429.0,    25543.0,    26366.0,   -24236.0,
+          -1220.0,    16452.0,   -13870.0,      477.0,    13238.0,   -12338.0,
+         -10758.0,     -609.0,     -550.0,     8551.0,    -8001.0,     6850.0,
+           -167.0,     6953.0,     6415.0,     5222.0,      168.0,     3268.0,
+            104.0,    -3250.0,     3353.0,     3070.0,     3272.0,    -3045.0,
+          -2768.0,     3041.0,     2695.0,     2719.0,     2720.0,      -51.0,
+          -2206.0,     -199.0,    -1900.0,      -41.0,     1313.0,     1233.0,
+            -81.0,     1232.0,      -20.0,     1207.0,       40.0,     1129.0,
+           1266.0,    -1062.0,    -1129.0,       -9.0,       35.0,     -107.0,
+           1073.0,      854.0,     -553.0,     -710.0,      647.0,     -700.0,
+            672.0,      663.0,     -594.0,     -610.0,     -556.0,      518.0,
+           -490.0,     -527.0,      465.0,      496.0,      -50.0,     -399.0,
+           -395.0,     -422.0,     -440.0,     -170.0,      -39.0,     -389.0,
+            -23.0,     -391.0,     -495.0,     -326.0,      369.0,      346.0,
+            304.0,      294.0,        4.0,      316.0,        8.0,      258.0,
+           -279.0,      252.0,     -244.0,      250.0,       29.0,      275.0,
+           -228.0,      240.0,     -253.0,      244.0,        9.0,      225.0,
+            207.0,      201.0,      216.0,     -200.0,       14.0,       -2.0,
+            188.0,      205.0,      -19.0,     -176.0,      189.0,     -185.0,
+            -24.0,        5.0,      171.0,       -6.0,      184.0,     -154.0,
+           -174.0,      162.0,      144.0,      -15.0,      -19.0,     -143.0,
+           -144.0,     -134.0,      131.0,     -138.0,     -128.0,      -17.0,
+            128.0,     -120.0,      109.0,       -8.0,     -108.0,      104.0,
+           -104.0,     -112.0,     -102.0,      105.0,      -14.0,        7.0,
+             96.0,     -100.0,       94.0,       83.0,       -2.0,        6.0,
+            -79.0,       43.0,        2.0,       84.0,       81.0,       78.0,
+             75.0,       69.0,        1.0,      -54.0,      -75.0,       69.0,
+            -72.0,      -75.0,       69.0,      -54.0,       -4.0,      -64.0,
+             66.0,      -61.0,       60.0,       56.0,       57.0,       56.0,
+            -52.0,      -54.0,       59.0,       61.0,       55.0,       57.0,
+            -49.0,       44.0,       51.0,       56.0,      -47.0,       -1.0,
+            -50.0,       -5.0,       44.0,       48.0,       50.0,       12.0,
+            -45.0,      -45.0,       41.0,       43.0,       54.0,      -40.0,
+             40.0,       40.0,      -36.0,       39.0,       -1.0,       34.0,
+             47.0,      -44.0,      -43.0,      -39.0,       39.0,      -43.0,
+             39.0,       39.0,        0.0,      -36.0,       32.0,      -31.0,
+            -34.0,       33.0,       32.0,       -2.0,        2.0,      -28.0,
+            -32.0,        3.0,       30.0,      -29.0,       -4.0,      -33.0,
+             26.0,       20.0,       24.0,       23.0,      -24.0,       25.0,
+            -26.0,      -25.0,        2.0,        0.0,        0.0,      -26.0,
+             -1.0,       21.0,      -20.0,      -22.0,       21.0,      -21.0,
+             24.0,       22.0,       22.0,      -21.0,      -18.0,       22.0,
+             -4.0,       -4.0,      -19.0,      -23.0,       22.0,       -2.0,
+             16.0,        1.0,      -15.0,       19.0,       21.0,        0.0,
+            -10.0,      -14.0,      -20.0,      -13.0,       15.0,      -15.0,
+             15.0,       -8.0,       19.0,      -15.0,        0.0,       20.0,
+            -19.0,      -14.0,        2.0,      -18.0,       11.0,       -1.0,
+            -15.0,       20.0,       19.0,       19.0,      -16.0,      -14.0,
+            -13.0,       -2.0,       -1.0,      -16.0,      -16.0,       15.0,
+             16.0,       13.0,      -16.0,      -13.0,       -2.0,      -13.0,
+            -12.0,       18.0,      -11.0,       14.0,       14.0,       12.0,
+              0.0,        5.0,       10.0,       15.0,        6.0,        0.0,
+              4.0,        5.0,        5.0,       -1.0,        3.0,        0.0,
+              0.0,        0.0,       12.0,        7.0,      -11.0,       -6.0,
+             -6.0,        0.0,       -8.0,        0.0,        0.0,        8.0,
+              0.0,       10.0,        5.0,       10.0,       -4.0,       -6.0,
+            -12.0,        0.0,        6.0,        9.0,        8.0,       -7.0,
+              0.0,      -10.0,        0.0,        8.0,       -5.0,        7.0,
+             -6.0,        0.0,        5.0,       -8.0,        3.0,       -5.0,
+              0.0,        0.0,       -4.0,       10.0,       11.0,       -4.0,
+              4.0,       -6.0,        9.0,        0.0,       -5.0,        0.0,
+             10.0,       -5.0,       -9.0,        5.0,       11.0,        0.0,
+              7.0,       -3.0,       -4.0,        0.0,        6.0,        0.0,
+              6.0,        8.0,       -5.0,        9.0,        6.0,        5.0,
+             -6.0,        0.0,        0.0,       -1.0,       -7.0,      -10.0,
+             -5.0,       -1.0,        1.0,        0.0,        0.0,        3.0,
+              0.0,       -5.0,        4.0,        0.0,        4.0,       -9.0,
+             -1.0,        8.0,        9.0,       10.0,       -1.0,       -8.0,
+             -8.0,       -4.0,        4.0,        4.0,        4.0,       -9.0,
+             -1.0,        4.0,        9.0,       -1.0,        6.0,        4.0,
+             -2.0,      -10.0,       -4.0,        7.0,        7.0,       -7.0,
+             10.0,        5.0,       11.0,        9.0,        5.0,        7.0,
+              0.0,        0.0,        0.0,        0.0,       -3.0,        0.0,
+              0.0,        1.0,       -2.0,        0.0,       -2.0,       -2.0,
+              1.0,        2.0,       -1.0,        0.0,        0.0,        0.0,
+              1.0,       -2.0,        0.0,       -2.0,        0.0,        0.0,
+             -3.0,       -1.0,        0.0,        0.0,        3.0,       -4.0,
+              0.0,       -2.0,       -2.0,        2.0,        3.0,        2.0,
+              1.0,        0.0,        1.0,       -3.0,        2.0,       -2.0,
+              3.0,        0.0,        2.0,       -2.0,        3.0,        0.0,
+             -3.0,        2.0,        0.0,        0.0,        1.0,        0.0,
+              0.0,        2.0,       -2.0,       -1.0,        2.0,       -2.0,
+             -3.0,        0.0,       -2.0,        2.0,        2.0,       -3.0,
+              0.0,        0.0,       -2.0,        0.0,        0.0,        2.0,
+             -1.0,       -1.0,        1.0,       -3.0,        0.0,        1.0,
+              0.0,        0.0,        2.0,        0.0,        0.0,        3.0,
+              0.0,        0.0,        0.0,       -1.0,        6.0,        0.0,
+              0.0,        0.0,        4.0,        2.0,       -2.0,       -2.0,
+             -3.0,        0.0,        2.0,        2.0,        2.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,        2.0,        0.0,
+              0.0,        0.0,        3.0,        0.0,        0.0,       -1.0,
+              0.0,        2.0,        3.0,       -2.0,        0.0,        0.0,
+              0.0,       -3.0,        1.0,        0.0,       -3.0,        3.0,
+             -3.0,        2.0,        0.0,        1.0,       -1.0,        2.0,
+             -4.0,       -1.0,        0.0,        3.0,        2.0,        4.0,
+              3.0,        2.0,       -1.0,       -3.0,        3.0,        0.0,
+             -1.0,       -2.0,        2.0,        0.0,        2.0,        0.0,
+             -3.0,        2.0,        0.0,        0.0,       -3.0,        0.0,
+             -2.0,       -2.0,       -3.0,        0.0,        0.0,        2.0,
+              2.0,        2.0,        3.0,       -2.0,        0.0,        2.0,
+              0.0,       -2.0,        0.0,       -2.0,        0.0,       -2.0,
+              2.0,       -3.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -1.0,        1.0,        0.0,        4.0,
+             -3.0,        0.0,       -3.0,       -1.0,        0.0,        1.0,
+              3.0,        2.0,        2.0,        0.0,       -1.0,        2.0,
+              0.0,        0.0,       -3.0,       -2.0,        3.0,       -2.0,
+             -3.0,        0.0,        3.0,       -2.0,       -4.0,       -2.0,
+              2.0,        0.0,        3.0,        3.0,        2.0,        0.0,
+              2.0,        0.0,       -3.0,        0.0,        0.0,       -2.0,
+              2.0,       -2.0,       -2.0,       -2.0,        2.0,        2.0,
+              2.0,       -2.0,       -1.0,        1.0,        1.0,        2.0},
+   {
+           9086.0,    -3015.0,     -485.0,      470.0,     -184.0,     -677.0,
+              0.0,       18.0,      -63.0,      299.0,       -9.0,       32.0,
+              0.0,        0.0,        0.0,      -11.0,        0.0,      -10.0,
+              0.0,      -11.0,        0.0,        0.0,      -11.0,       10.0,
+              0.0,        0.0,        0.0,       -2.0,        0.0,      -42.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          15377.0,    -4587.0,     1374.0,     -291.0,    -1924.0,     -174.0,
+            358.0,      318.0,      367.0,      132.0,       39.0,       -4.0,
+             82.0,       -9.0,      -75.0,       66.0,       78.0,       20.0,
+             29.0,       68.0,        0.0,      -25.0,       59.0,       -3.0,
+             -3.0,       13.0,       11.0,      -45.0,       -1.0,       -5.0,
+             13.0,      -14.0,       26.0,       15.0,       10.0,       19.0,
+              2.0,       -5.0,       14.0,        4.0,        4.0,       -1.0,
+             -4.0,       -5.0,       12.0,       -3.0,       -9.0,        4.0,
+              1.0,        2.0,        1.0,        3.0,       -1.0,        7.0,
+              2.0,        4.0,       -2.0,        3.0,       -2.0,        5.0,
+             -4.0,       -3.0,       -2.0,        0.0,       -2.0,        1.0,
+             -2.0,        0.0,     -139.0,       -2.0,        4.0,        0.0,
+              0.0,        4.0,       -2.0,        2.0,        0.0,        2.0,
+             -1.0,       -1.0,        4.0,        1.0,        0.0,       -1.0,
+             -1.0,       -1.0,        1.0,        1.0,        0.0,       -1.0,
+              1.0,        0.0,      -10.0,        2.0,       -1.0,        1.0,
+              0.0,        2.0,       -1.0,       -1.0,       -1.0,        0.0,
+              0.0,        2.0,       -1.0,        2.0,        0.0,       -1.0,
+             -1.0,        1.0,        0.0,       -1.0,        0.0,        1.0,
+              1.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -1.0,        0.0,       -1.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -1.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        0.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       11.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -2.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -1.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -2.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+          -1679.0,      -27.0,        0.0,        4.0,        0.0,      176.0,
+           -891.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+            -10.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -5.0,       14.0,
+           -138.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,       -1.0,        0.0,      -11.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,      -11.0,       -5.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -2.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0}};
+
+/*
+   IAU 2000A planetary argument multipliers and coefficients, one row
+   per column of 'napl_t' and 'cpl_t' in 'iau2000a'.
+*/
+static const signed char A_PL_MULT[14][687] = {
+   {
+        0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  1,  0,  1,  0, -2,  0,  0, -2, -1, -2,
+       -1, -1,  0,  0,  0,  0,  0,  0,  0, -2, -2, -2,  0, -2,  0,  0,
+        0, -1, -1, -2, -2,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+        0,  1,  0, -2,  0,  0,  0,  0,  0,  0, -2,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  2, -2,  2,  2, -2, -2, -2, -2, -2, -1,
+       -1,  1,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  1,  1,  0,  0,  0,  0, -2, -2,  0,  0,  0,
+       -1, -1,  0,  0, -2,  0,  0,  0,  1,  0, -1,  0,  0,  0,  2, -2,
+        0, -2,  1, -2,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -2, -2,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0, -2,  0,  0,
+        0,  0, -2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,
+        1, -1, -1, -1,  1, -2, -1, -1, -1, -1,  1, -1, -2,  1, -1,  1,
+       -1, -1,  0, -1, -1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  1, -1,  0,  1,  0,  0, -1,  2,  1,  0, -1, -2,  0,  0,
+        0,  0, -1,  1, -1,  2,  1,  1,  1,  0,  2, -1, -1,  1,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        1,  0,  1,  0,  0, -1,  0,  1,  0,  1,  0,  0, -1,  0,  0,  1,
+        1,  0,  0,  2,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0, -1,  0,
+        1,  1,  0,  0,  2,  1,  0,  1,  0,  0,  0, -1,  1,  0,  0,  1,
+        0,  0,  1,  0, -2,  1,  0, -1, -2, -1,  0,  1,  0, -1,  1,  0,
+        0,  0,  0,  1,  0, -1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,
+        1,  0,  0,  2, -1,  0,  1,  1,  0, -2,  0,  1,  0,  1,  0,  0,
+        2,  0,  0,  0,  0,  0,  0,  0, -1, -2,  0,  0,  0,  0, -1,  2,
+        0,  0,  1,  0,  1,  1,  0,  0,  0,  2,  0,  0,  0, -1, -1,  0,
+        0,  0,  0,  1,  1,  0,  0,  1,  0,  1,  0,  0,  0,  1,  1,  0,
+        0,  1,  0,  1,  0,  2, -1,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  1,  0,  0,  1,  0, -1,  0,  0,  0,  2,  2,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  1,  1,  0, -1, -1,  2,  1,  0,  0,  1,
+        0,  0,  2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  2,  0,  0,  1,
+        0,  0,  1,  0, -1,  2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        1,  0,  0,  2,  0,  0, -1,  2,  0,  2,  1,  0,  0,  1,  0,  0,
+       -1,  0,  0,  0,  0, -1,  2,  1, -2,  0,  0,  0,  0,  1,  0,  0,
+        0,  1,  0,  0,  0,  0, -2,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  0, -2,  0,  2, -1,  0,  0,  1,
+        0,  0,  0,  1,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  2,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  1,  1,
+        0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  2,  2,  2,  2,
+        0,  1,  2,  2,  1,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,
+        2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  2,  2},
+   {
+        0,  0,  0,  0,  0,  0, -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+       -1,  0, -1,  0,  0, -1, -2, -1, -1, -1,  2,  0,  1,  2,  0,  1,
+       -1,  1,  0, -2,  0, -1,  0, -1,  0,  2,  2,  2,  0,  2,  1,  0,
+       -1,  0,  1,  2,  0, -1,  0, -1,  0,  0,  1,  1, -1,  0,  0, -1,
+        0, -2, -1,  2,  2, -1,  0,  1,  2,  1,  2, -3,  0,  1, -1,  0,
+        0,  0,  0, -1,  0, -1, -2,  2, -2, -2,  1,  1,  2,  2,  2,  1,
+        1, -2,  0, -2,  1,  0, -1, -1, -2,  2,  0, -1,  0, -1,  0,  0,
+       -2,  0,  2,  0,  0, -1, -1,  0,  1,  2,  0,  2,  2,  0,  1, -2,
+        1,  0, -1,  0,  1, -1,  0,  0,  0, -2,  0,  0,  0,  1, -1,  2,
+        0,  2,  0,  1, -1,  0,  0, -1,  0, -1,  0,  1,  1, -1, -1,  0,
+        0, -1,  0, -1,  0, -2,  1,  0,  2,  0,  2,  2, -1,  0, -1,  0,
+        0,  0, -1,  0,  0, -1,  0,  1,  0,  0, -2, -2, -2,  2,  0, -1,
+        0,  0,  2,  0,  0, -2, -1, -1,  0,  1,  1, -2, -1,  0,  0, -1,
+        0,  0, -2,  0,  0, -1,  0,  0, -1,  0,  0,  0, -2,  0,  0, -1,
+        0,  0, -1,  0,  1, -2,  0,  0,  0,  0, -2,  2, -2,  0,  0,  0,
+       -1,  0,  0, -2,  0,  0,  1, -2,  0, -2, -1,  0,  0, -1,  0,  0,
+        1,  0,  0,  0,  0,  1, -2,  1,  2,  0,  0,  0,  0, -1,  0,  0,
+        0, -1,  0,  0,  0,  0,  2,  0,  0,  0,  0, -2,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  2,  0, -2,  1,  0,  0, -1,
+        0,  0,  0, -1,  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+       -1,  0,  0, -1,  0,  0,  0,  0,  0,  0, -2,  0,  2,  0,  0,  0,
+        0,  0,  0,  0, -1,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -1, -2,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2, -2,
+       -2,  0,  0,  2, -2,  2,  0,  0,  0,  2,  1,  2,  0,  0, -1, -1,
+        0,  2,  0,  2,  2, -2, -2, -2,  0,  0, -2, -2,  0,  0,  0,  0,
+        2,  1,  0,  0,  1,  0,  0,  0,  0, -2,  0,  1,  0,  2,  0,  0,
+        0,  0,  2,  0,  2,  0,  0,  0,  1,  0,  0,  2,  2,  0,  2},
+   {
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        1,  0,  1,  0,  0,  0,  0,  1,  1,  1,  1,  0,  0,  1,  0,  2,
+        1,  1,  0,  2,  0,  1,  0,  1,  0,  1,  2,  0,  1,  0,  0,  1,
+        2,  1,  0,  0,  2,  1,  0,  1,  0,  0,  0,  0,  2,  1,  2,  1,
+        0,  0,  1,  1,  0,  2,  1,  0,  0,  1,  0,  1,  2,  1,  1,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,
+        1,  0,  1,  1,  0,  1,  2,  1,  1,  1,  0,  1,  0,  1,  0,  0,
+        1,  1,  0,  0,  0,  1,  1,  2,  1,  0,  0,  1,  1,  1,  0,  1,
+        0,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,
+        1,  0,  1,  1,  2,  1,  0,  1,  0,  1,  0,  1,  1,  1,  1,  0,
+        0,  0,  1,  2,  1,  1,  0,  1,  1,  1,  1,  1,  1,  0,  1,  0,
+        0,  0,  1,  0,  0,  2,  1,  0,  0,  0,  1,  1,  1,  0,  0,  1,
+        0,  0,  0,  2,  2,  1,  2,  2,  1,  0,  0,  1,  1,  0,  0,  1,
+        0,  0,  2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  2,  0,  0,  1,
+        0,  0,  2,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,
+        1,  0,  0,  2,  0,  1,  0,  1,  1,  1,  2,  0,  0,  1,  0,  0,
+        0,  1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,
+        0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  1,  0,  0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  0,  0,  1,  0,  0,
+        1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,
+        0,  1,  0,  0,  0,  1,  2,  2,  0,  0,  0,  0,  2,  2,  2,  2,
+        0,  2,  2,  2,  1,  2,  2,  2,  2,  2,  1,  0,  1,  2,  2,  2,
+        2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  1,  2,  2,  2,  2},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0, -5,  0,  0,
+        0,  0,  0,  0,  0,  0, 19,  2,  0,  0,  0,  3,  0,  0, 18,  0,
+       18,  0, -8, -8, -8, -8,  8,  8,  8,  0,  3,  0,  3,  0,  0,  0,
+        0,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,
+        0, 17,  0,  0,  0,  0,  0,  0,  5,  5,  6, -6,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+      -20, 20,  0,  0,  0,  0,  0,  0, -6,  5,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  3,  0,  3,  8,  8, -8,
+        0, 18,  0,  3,  0,  0,  0,  0,-10,  0, 10,  0,  0,  0,  0,  0,
+       -3,  0,-18,  0, -8, -8,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
+        0,  3, -3, -3,  0, -5,  5,  5,  6,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3, -3,
+       -3, -3, -3, -3,  0,  0,  0,  0,  0,  0,  0, -5, -5, -5, -5, -5,
+       -5,  5,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  3,  3, -3,  0,  0, -5,  0,  0,  0,  0,  0,
+        2,  2,  0,  0,  0,  0,  0,  0,  3, -6, -6, -2, -2, -2,  2,  2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0, -1,  0,  0,
+        0,  0,  1,  1,  1, -1, -1, -7, -7,  4,  0, -4,  4,  0, -4, -4,
+       -4, -4, -4, -4, -4,  4,  2,  0,  1,  1,  0,  0,  0,  0, -1, -1,
+       -1,  1,  1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  4,  0,  0,  0,
+        0,  0,  2, -2, -2, -2, -6, -6,  6,  0, -2,  0,  0,  3,  0,  0,
+        0, -5,  0, -3, -3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0, -3,
+        0,  0,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0,  0,  0, -8, -8,
+        0,  0,  0,  0,  0, -5,  0,  0,  0,  3, -3, -3,  0, -5, -5, -5,
+        5,  0,  0,  0,  0,  0,  2,  0,  0, -2, -2,  2,  2,  0,  0,  0,
+       -2,  0,  1, -1, -1, -1, -7, -7,  0, -4, -4, -4,  4,  0,  0,  0,
+        1,  1, -9,  0,  0,  0,  0,  0, -2, -2, -6, -6,  6,  0,  0,  0,
+        0,  0,  0,  0, -5,  0,  0, -3,  3,  3,  3,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -8, -3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  3, -8, -8, -8,  0,  0,  3,  0,  0,  0,  0,
+        0, -3,  0, -5, -5,  5,  5,  0,  0,  0,  2,  2,  0,  0, -1, -1,
+       -7, -7,  0,  0, -4,  4,  4,  4,  0,  0,  1,  1,  1, -9,  0,  1,
+        0,  0,  0, -2, -6,  6,  0,  0,  0,  0,  3,  3,  0,  0,  0,  0,
+        0,  0, -8,  0,  0,  0,  0,  0, -8, -8, -8,  0,  0, -3, -5,  5,
+        5,  5,  2,  2,  2,  0,  0,  0,  7,  0,  4,  1, -9, -9,  0,  0,
+       -6,  6,  6,  0,  0,  3,  3,  3,  0,  0,  0,  0,  8,  5,  2,  2,
+        2, -7,  7,  4,  4,  4,  4,  0,  0,  0,  3, -8,  8,  5,  5, -9,
+       -9, -9,  9,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+        1,  3,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  3,  0, -3,  0,  1,  0,  2,  0, -2,  0, -1, -2,
+        0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,
+        0,  2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  3,  1,  0},
+   {
+        8, -8,  8,  0, -4,  4,  3, -3,  0,  4, -5, -4,  4,  6,  0,  0,
+       -1,  0, -1,  0,  0,  3,-21, -4, -1, -1,  2, -7,  1,  2,-16,  1,
+      -17,  2, 13, 11, 13, 12,-13,-14,-13,  2, -3,  2, -5,  2,  0, -1,
+       -2, -5, -4,  2, -5, -1,  0, -1,  0,  0,  3,  1, -1, -9,  5, -1,
+        0,-16, -1,  5,  9, -1,  0,  1, -6, -7, -8,  7,  0,  1, -1,  0,
+        0, -8, -8, -9,  8,  8, -5,  2, -6, -2,  1,  1,  2,  6,  2,  1,
+       20,-21,  8,-10,  1,  0, -1, -1,  8, -6,  0, -1,  0, -1,  0,  0,
+       -9,  7,  5,  9, -9, -3,  4, -1,  0, -2, -5,  2, -3,-13,-12, 11,
+        2,-16, -1, -7, -3, -1,  0, -4,  3, -2, -3,  4,  0,  1,  3,  2,
+        7,  2, 16,  1, 12, 13,  1,  0,  1, -2, -1, -4,  3, -1, -1,  0,
+        0, -6,  5,  4, -2,  6, -7, -8, -8, -8,  2,  6, -1,  0, -1,  0,
+        0,  0, -1,  0,  0, -1,  0,  1, -7,  7, -5, -8,  2,  4,  0, -1,
+        0,  0, -3, -4,  4, -2, -1,  0,  1,  2,  1, -2, -6, -5, -5,  4,
+        5,  5,  3,  5,  2,  1,  2, -2, -3, -2, -2,  8,  6,  8,  8,  7,
+        8, -8, -1,  0,  1, -2, -6,  6,  4, -4,  3,  2, -7,  0,  0,  0,
+       -1,  0,  0, -2,  0, -5, -4,  3,  2, -4,  7,  3, -3, -4, -3, -3,
+       -2, -3, -5, -5,  5,  1, -2,  1, -3, 10, 10,  3,  3,  2, -3, -3,
+        0, -1,  0,  0,  4, -4,  2, -4, -4,  4,  3, -2, -5,  2,  0, -3,
+       -3,  3, -2, -3, -2,  2,  2, 11, 11, -4,  2,  4, -5,  1,  7,  6,
+        7,  6,  6,  5,  6, -6, -2,  0,  0, -1, -1,  1, -1, -7,  1,  1,
+        0, -1, -1, -2, -2, -1,  1,  1, -6, -6, -3, -3, -4, -5,  5, -1,
+       -1,  1, -4,  4,  3,  4,  9,  9, -9,  1,  2, -4,  4, -4, -1,  1,
+        1,  9,  3,  4,  4, -4, -4,  2, -1,  1,  1, -1,  1,  1,  1,  4,
+        1,  2,  1, -1, -2, 14,  1,  5,  5, -1,  1,  3, -3,  1, 12, 12,
+        1,  1,  0,  0,  1,  5,  1,  1,  1, -6,  6,  6, -1,  7,  7,  6,
+       -7, -1, -1,  3,  1, -2, -2, -6,  6,  2,  1, -2, -2,  1, -5,  5,
+        2,  4, -3,  3,  2,  3, 10, 10,  3,  8,  5,  5, -5,  1, -2,  0,
+        0,  0, 13, -1, -2,  2, -2,  2,  5,  5,  8,  8, -8,  2, -3,  5,
+        5,  2,  2,  2, 10,  4,  4,  3, -3, -3, -3,  2, -5,  2,  2,  2,
+        2,  3,  3,  2, -6, 15,  9,  2, -2,  6,  2,  2,  2,  1,  2,  2,
+       -6, -2, -2,  6,  2, -5, 11, 11, 11, 11,  2, -3,  4,  1, -4,  1,
+        2,  7,  0,  6,  6, -6, -6,  2, -1,  7, -1, -1,  6,  5,  4,  4,
+        9,  9,  4,  3,  4, -4, -4, -4,  2, -3,  1,  1,  1, 12,  3, -1,
+        7,  3,  3,  6,  7, -7,  6,  3,  3,  5, -2, -2,  3,  3,  3,  4,
+        3,  1, 16,  3,  7, -5,  3, -1, 10, 10, 10,  2,  3,  8,  5, -5,
+       -5, -5,  0,  0,  0,  7,  7,  6, -8,  5, -3,  2, 11, 11,  4,  4,
+        6, -6, -6,  4,  6, -1, -1, -1,  4,  4,  5,  4, -9, -4,  1,  1,
+        1,  7, -7, -2, -2, -2, -2,  5,  5,  5,  0,  8, -8, -3, -3,  9,
+        9,  9, -9, -4,  6,  6,  6,  6,  6,  6,  6,  6,  0,  2, -2,  1,
+       -1, -3,  2,  4,  4,  4,  2,  1, -1, -2,  1,  2,  2,  4, -1, -1,
+        4,  2,  2,  2, -3, -2,  3, -2, -1,  1, -2,  1,  2, -1,  1,  3,
+        2,  1,  1, -3,  1,  1,  4, -4, -4, -2, -2,  1,  1,  2, -3, -1,
+        1, -2, -1,  1,  2,  2, -4,  4,  1,  1,  1,  2, -3, -1,  2},
+   {
+      -16, 16,-16,  0,  8, -8, -8,  0,  0, -8,  8,  8, -8,  4,  0,  0,
+        0,  0,  0,  0,  0, -7,  3,  0,  0,  0,  0,  4,  0,  0,  0,  0,
+        0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,
+        2,  0,  0,  0,  9,  0,  0,  0,  0,  0, -4,  0,  0, 17,  0,  0,
+        0,  0,  0, -6,-13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, 15, 15, 15,-15,-15,  0,  0,  8,  0,  0,  0,  0, -8,  0,  0,
+        0,  0,-15, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       13,-13, -6,-17, 17,  4,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,
+       -2,  0,  0,  4,  7,  0,  0,  8,  0,  0,  0, -8,  0,  0, -7,  0,
+       -4,  0,  0,  0,  0,  0, -2, -2, -2,  2,  2,  0, -4,  0,  0,  0,
+        0,  0,  0,  0,  4,  0,  0,  0,  0, 15,  0, -8,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, 13,-13,  6, 11,  0, -4,  0,  0,
+        0,  0,  0,  8, -8,  0,  0, -2, -2, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -4, -4, -4,  4,  4,  4,  4,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, 11,-11,  0,  0,  0,  0,  9,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -4,  4,  0, -6,  6,  6,  6,  6,
+        0,  0,  9,  9, -9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -8,  8,  0,  7,  7, -7,  0,  0, 10,  0,  0,  5,
+        5, -5,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0, -1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0, -3,  3, 12,  0,  0,
+        0,  0,  0,  0,  5,  0,  0,  0, 10, 10,  0,  7,  0,  8, -8,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6, -6,  0,  0,  0,
+        0,  0, -4,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -2,  0,  0,  2,  0,  0, -8, -8,  0,  0, -8,  8,  0,  0,  0,
+        0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+        0,  0,  0,  0,  0,  6,  0,  9, -9,  0,  0,  0,  0,  0,  7, -7,
+        0, -5,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  1,  0,  3,
+        0,  0,  0,  5,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0,  9, -6,
+       -6,  0,  0,  0,  0, -4, -4,  0,  0,  0,  0,  0, 13,  0,  0,  0,
+        0, -2, -2,  0, 15,  0, -4,  0,  8, -8,  0,  0,  0,  0,  0,  0,
+       16,  8,  8, -8,  0,  4,  0,  0,  0,  0,  0,  0, -8,  0,  8,  2,
+        0,  0,  4,  0,  0,  0,  0,  0,  6, -9,  0,  0, -7, -5,  0,  0,
+        0,  0, -3, -1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+       -8,  0,  0,  0,  0,  0, -6,  0,  0, -4,  0,  0,  0,  0,  0, -2,
+        0,  0,  0,  0, -8, 16,  0,  8,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -7, -7, -5,  0, -3,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -4,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -8, -8, -8,  0,  0,  0,  0,  0,  0,  0, -8,  0,  0,
+       -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, -8,  8,  8,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  8, -8,  0,  0,  0,  0,  0,  0,  0},
+   {
+        4, -4,  4,  0, -1,  3,  3,  0, -2,  3, -3, -3,  1,  0,  2,  2,
+        2,  2, -2, -2, -2,  0,  0, -3,  2, -4,  0,  0,  1, -2,  0, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0, -3,  2, -4,  0,  0,
+        0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+        1, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -5,  0,  3, -3, -3, -3,  0, -1, -1,
+        0,  0,  0,  0,  1,  1,  1, -2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2, -3,  0,  0,  0,  0,
+        0,  0, -1,  0,  0, -2, -2, -3,  0,  0,  0,  3,  2,  2,  0,  0,
+        0, -2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  1,  3, -1, -1,
+        1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+        0,  0,  0, -3,  3,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -1, -1, -1,  1,  0,  0,  0,  0,  0,  0,  0,  4,  2,  2,
+        2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        3,  3,  3,  3,  0,  0, -2,  0,  0,  0,  0,  3,  0,  0,  4,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  4, -4,  0,  0,  0,  3,  0,  0,  0,  0,  3,
+        3, -3,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  2, -2,
+       -1,  0,  0,  0,  0,  0,  0,  0,  2,  0,  1,  1, -1, -1, -3,  0,
+        0,  0,  0,  1,  0,  0,  2,  3,  3,  0,  0,  3, -3, -2,  0,  0,
+        1,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+        0,  0,  0,  0,  4, -4,  0, -3,  0,  0,  0,  0,  0, -2,  0,  0,
+        0, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,
+        0,  0,  0,  0,  0,  0,  0,  2, -1,  3,  0,  0,  0,  0,  0,  0,
+       -4, -3, -3,  1, -2,  0,  0,  0,  0,  0,  0,  2,  3,  0, -3,  0,
+        1,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0, -4,  0,
+        0, -3, -3,  0,  0,  0,  0, -2, -2,  0,  0,  0, -1, -1,  0,  0,
+        0, -1,  0,  2,  3, -4,  0, -3,  0,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4, -3,
+        0,  0,  0, -2,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -4, -3, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -1,
+        0,  0, -2,  3,  3,  3, -3, -1,  0,  0,  0, -3, -3,  3,  0,  0,
+        3, -2, -2, -2,  0,  2,  0,  2,  0, -1,  0, -1,  0,  1,  0,  0,
+       -2,  0,  0,  0,  0,  0,  3, -3, -3,  3,  3,  0,  0, -2,  0,  0,
+       -1,  0,  1,  0, -3, -3, -3,  3,  0,  0,  0, -2,  0,  0, -2},
+   {
+        5, -5,  5,  0, -5,  0,  0,  0,  6,  0,  0,  0,  5,  0, -5, -5,
+       -5, -5,  5,  5,  5,  0,  0,  0,  0, 10, -5,  0, -1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  1,  0,  3,  0,  0,
+        0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  2,
+       -2,  0, -3,  0,  0,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0, -5,  0,
+        0,  0,  0,  0,  0,  0,  0,  4,  0,  0, -1, -1,  1,  1,  1,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  5,  5,  0,  0,  0,  0,  0, -5, -5,  0, -5,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  2,  2,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,
+        0,  0,  0,  0,  0, -1, -1, -1,  0,  0,  0,  0,  0,  0, -2,  3,
+        3,  3,  0,  0,  0,  0,  0,  0,  0,  0, -2,  2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0, -5,  0,  0,
+        0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -3, -5,  0,  0,  0,  5,  0,
+       -2,  0, -1,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  5,  0,  0,
+       -2,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0, -2,
+       -2,  0,  0, -1,  0,  0,  0, -5, -5,  0,  0,  0,  0,  0,  0,  0,
+       -5,  0,  0,  5,  5,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,
+       -1,  0,  0, -5,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0, -1,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  2,  2,  2,  2,  1,  0,  0,  2,  0,  0,  1,  2,  2,  2,  1,
+        0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        2,  2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  2,
+        0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  1,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  1,  0,  1,  2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+        1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        1,  2,  0,  2,  1,  0,  0,  1,  0,  1,  2,  2,  0,  2,  1,  0,
+        1,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,  0,  2,  0,  1,
+        0,  1,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  2,
+        0,  0,  2,  1,  0,  0,  0,  0,  0,  1,  2,  2,  1,  0,  0,  1,
+        1,  0,  1,  2,  0,  2,  0,  2,  1,  0,  0,  0,  2,  0,  2,  2,
+        1,  0,  1,  0,  0,  1,  2,  2,  1,  0,  0,  0,  0,  0,  1,  0,
+        2,  2,  1,  0,  1,  0,  0,  0,  0,  0,  2,  0,  2,  2,  2,  1,
+        0,  0,  1,  0,  2,  2,  0,  0,  2,  0,  0,  2,  0,  2,  0,  2,
+        1,  0,  0,  1,  0,  2,  2,  1,  0,  0,  0,  2,  0,  0,  2,  0,
+        0,  2,  0,  2,  1,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  2,  0,  0,  2,  1,  0,  0,  2,  2,  2,  0,
+        0,  2,  0,  2,  2,  0,  0,  1,  2,  0,  1,  2,  2,  2,  1,  0,
+        0,  0,  0,  2,  2,  2,  0,  2,  0,  1,  0,  0,  1,  2,  2,  0,
+        0,  0,  0,  1,  0,  2,  2,  1,  0,  2,  2,  1,  0,  2,  2,  2,
+        0,  2,  2,  2,  2,  0,  2,  0,  1,  2,  2,  1,  0,  0,  2,  0,
+        2,  0,  1,  2,  2,  0,  2,  1,  0,  1,  2,  0,  2,  0,  2,  0,
+        1,  0,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0,  1,  0,  1,  2,
+        2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  0,  0,  0,  2,
+        2,  2,  2,  2,  1,  0,  2,  2,  2,  2,  0,  2,  2,  2,  1,  2,
+        2,  1,  2,  2,  1,  0,  1,  2,  2,  2,  0,  1,  2,  2,  0,  0,
+        2,  0,  2,  2,  1,  0,  2,  0,  2,  2,  0,  2,  2,  2,  2,  2,
+        2,  0,  2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  2,  2,  1,  0,
+        1,  2,  0,  1,  2,  2,  2,  2,  0,  2,  2,  2,  2,  1,  2,  2,
+        1,  0,  1,  2,  2,  0,  1,  2,  2,  2,  2,  0,  0,  2,  2,  1,
+        1,  1,  0,  1,  2,  0,  0,  2,  2,  2,  2,  1,  0,  1,  2,  1,
+        1,  1,  0,  1,  2,  0,  0,  1,  2,  0,  1,  2,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}};
+
+static const double A_PL_COEF[4][687] = {
+   {
+           1440.0,       56.0,      125.0,        0.0,        3.0,        3.0,
+           -114.0,     -219.0,       -3.0,     -462.0,       99.0,       -3.0,
+              0.0,        3.0,      -12.0,       14.0,       31.0,     -491.0,
+          -3084.0,    -1444.0,       11.0,       26.0,      103.0,        0.0,
+            -26.0,        9.0,       12.0,       -7.0,        0.0,      284.0,
+            226.0,        0.0,        0.0,        5.0,      -41.0,        0.0,
+            425.0,     1200.0,      235.0,       11.0,        5.0,       -5.0,
+              6.0,       15.0,       13.0,       -6.0,      266.0,     -460.0,
+              0.0,       -3.0,        0.0,        4.0,        0.0,        0.0,
+              0.0,      -17.0,       -9.0,       -6.0,      -16.0,        0.0,
+             11.0,       -3.0,        3.0,        0.0,        0.0,        0.0,
+              0.0,       -6.0,       -3.0,       -5.0,        4.0,      -42.0,
+            -10.0,       -3.0,       78.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -7.0,      -14.0,        0.0,        0.0,
+             45.0,       -3.0,        0.0,        0.0,        3.0,       89.0,
+              0.0,       -3.0,     -349.0,      -15.0,       -3.0,      -53.0,
+              5.0,        0.0,       15.0,       -3.0,      -21.0,       20.0,
+              0.0,        5.0,      -17.0,        0.0,       32.0,      174.0,
+             11.0,      -66.0,       47.0,        0.0,       10.0,       -3.0,
+            -24.0,        5.0,        3.0,        4.0,        0.0,       -5.0,
+              8.0,        0.0,       10.0,        3.0,       -5.0,       46.0,
+            -14.0,        0.0,       -5.0,      -68.0,        0.0,       10.0,
+             -5.0,       -3.0,       76.0,       84.0,        3.0,       -3.0,
+             -3.0,      -82.0,      -73.0,       -9.0,        3.0,       -3.0,
+             -9.0,     -439.0,       57.0,        0.0,       -4.0,      -40.0,
+             23.0,      273.0,     -449.0,       -8.0,        6.0,        0.0,
+             -3.0,        3.0,      -48.0,       51.0,     -133.0,        0.0,
+            -21.0,        0.0,      -11.0,      -18.0,       35.0,        0.0,
+             11.0,       -5.0,      -53.0,        0.0,        4.0,        0.0,
+            -50.0,      -13.0,      -91.0,        6.0,       -6.0,        0.0,
+             52.0,       -3.0,        0.0,       -4.0,       -4.0,       10.0,
+              3.0,        0.0,        0.0,       -4.0,       -4.0,       -8.0,
+              8.0,        0.0,     -138.0,        0.0,        0.0,       54.0,
+              0.0,       -7.0,      -37.0,        0.0,       -4.0,        8.0,
+             -9.0,       -3.0,     -145.0,      -10.0,       11.0,    -2150.0,
+            -12.0,       85.0,        4.0,        3.0,      -86.0,       -6.0,
+              9.0,       -8.0,      -51.0,      -11.0,        0.0,        0.0,
+             31.0,      140.0,       57.0,      -14.0,        0.0,        4.0,
+              0.0,       -3.0,        0.0,        9.0,       -4.0,        5.0,
+             16.0,       -3.0,        0.0,        7.0,      -25.0,       42.0,
+            -27.0,        9.0,    -1166.0,       -5.0,       -6.0,       -8.0,
+              0.0,      117.0,       -4.0,        3.0,       -5.0,        0.0,
+             -5.0,        4.0,       -4.0,      -24.0,        3.0,        0.0,
+              8.0,        3.0,        7.0,       -3.0,       50.0,        0.0,
+             13.0,        0.0,       24.0,        5.0,       30.0,       18.0,
+              8.0,        3.0,        6.0,       -3.0,        0.0,     -127.0,
+              3.0,       -6.0,        5.0,       16.0,        3.0,        0.0,
+              0.0,        7.0,        0.0,        0.0,       -9.0,       17.0,
+              0.0,      -20.0,      -10.0,       -4.0,       22.0,       -4.0,
+             -3.0,      -16.0,        0.0,        4.0,      -68.0,       27.0,
+              0.0,      -25.0,      -12.0,        3.0,        3.0,      490.0,
+            -22.0,       -7.0,       -3.0,      -46.0,       -5.0,        2.0,
+              0.0,      -28.0,        5.0,        0.0,      -11.0,        0.0,
+             -3.0,       25.0,        5.0,     1485.0,       -7.0,        0.0,
+             -6.0,       30.0,       -4.0,      -19.0,        0.0,        0.0,
+              4.0,        0.0,       -3.0,        5.0,        0.0,      118.0,
+              0.0,      -28.0,        5.0,       14.0,        0.0,     -458.0,
+              0.0,        9.0,        0.0,        0.0,       11.0,        6.0,
+            -16.0,        0.0,       -5.0,     -166.0,       15.0,       10.0,
+            -78.0,        0.0,        7.0,       -5.0,        3.0,        5.0,
+              0.0,       -3.0,       -3.0,        0.0,    -1223.0,        0.0,
+              3.0,        0.0,       -6.0,     -368.0,      -75.0,       11.0,
+              3.0,       -3.0,      -13.0,       21.0,       -3.0,       -4.0,
+              8.0,      -19.0,       -4.0,        0.0,       -6.0,       -8.0,
+             -1.0,      -14.0,        6.0,      -74.0,        0.0,        4.0,
+              8.0,        0.0,     -262.0,        0.0,       -7.0,        0.0,
+            -19.0,      202.0,       -8.0,        0.0,       16.0,        5.0,
+              0.0,        1.0,      -35.0,       -3.0,        6.0,        3.0,
+              0.0,       12.0,        0.0,     -598.0,       -3.0,       -5.0,
+              3.0,        5.0,        4.0,       16.0,        8.0,        8.0,
+              0.0,      113.0,        0.0,        4.0,       27.0,       -3.0,
+              0.0,        5.0,        0.0,      -13.0,        5.0,      -18.0,
+             -4.0,       -5.0,       -3.0,       -5.0,       17.0,       11.0,
+              0.0,       83.0,       -4.0,        0.0,      117.0,       -5.0,
+             -3.0,       -3.0,        0.0,        3.0,        0.0,      393.0,
+             -4.0,       -6.0,       -3.0,        8.0,       18.0,        8.0,
+             89.0,        3.0,       54.0,        0.0,        3.0,        0.0,
+           -154.0,       15.0,        0.0,        0.0,       80.0,        0.0,
+             11.0,       61.0,       14.0,      -11.0,        0.0,      123.0,
+              0.0,       -5.0,        7.0,        0.0,        0.0,      -89.0,
+              0.0,        0.0,     -123.0,        0.0,       12.0,      -13.0,
+              0.0,        3.0,      -62.0,      -11.0,        0.0,       -3.0,
+              0.0,        0.0,        0.0,      -85.0,      163.0,      -63.0,
+            -21.0,        0.0,        3.0,        0.0,        3.0,        3.0,
+              0.0,        0.0,        6.0,        5.0,        0.0,        7.0,
+             -3.0,        3.0,       74.0,       -3.0,       26.0,       19.0,
+              6.0,       83.0,        0.0,       11.0,        3.0,        3.0,
+             -4.0,        5.0,     -339.0,        0.0,        5.0,        3.0,
+              0.0,       18.0,        9.0,       -8.0,        3.0,        0.0,
+              6.0,       -4.0,       67.0,       30.0,        0.0,        0.0,
+              0.0,      517.0,        0.0,      143.0,       29.0,       -4.0,
+             -6.0,        5.0,      -25.0,       -3.0,        0.0,      -22.0,
+             50.0,        0.0,        0.0,       -4.0,       -5.0,        0.0,
+              4.0,       59.0,        0.0,       -8.0,       -3.0,        4.0,
+            370.0,        0.0,        0.0,       -6.0,        0.0,      -10.0,
+              0.0,        4.0,       34.0,        0.0,       -5.0,      -37.0,
+              3.0,       40.0,        0.0,     -184.0,       -3.0,       -3.0,
+              0.0,       31.0,       -3.0,       -7.0,        0.0,        3.0,
+              0.0,        0.0,       19.0,        0.0,        0.0,        0.0,
+             28.0,        0.0,        8.0,        0.0,        0.0,       -3.0,
+             -9.0,        3.0,       17.0,        0.0,       19.0,        0.0,
+             14.0,        0.0,        0.0,        0.0,       13.0,        0.0,
+              2.0,        0.0,        8.0,        0.0,        6.0,        6.0,
+              0.0,        5.0,        3.0,       -3.0,        6.0,        7.0,
+             -4.0,        4.0,        6.0,        0.0,        0.0,        5.0,
+             -3.0,        4.0,       -5.0,        4.0,        0.0,       13.0,
+             21.0,        0.0,        0.0,        0.0,        0.0,       -3.0,
+             20.0,      -34.0,      -19.0,        3.0,       -3.0,       -6.0,
+             -4.0,        3.0,        3.0,        4.0,        3.0,        6.0,
+             -8.0,        0.0,       -3.0,        0.0,      126.0,       -5.0,
+             -3.0,        5.0,        0.0,        0.0,     -126.0,        3.0,
+             21.0,        0.0,      -21.0,       -3.0,        0.0,        8.0,
+             -6.0,       -3.0,        3.0,       -3.0,       -5.0,       24.0,
+              0.0,        0.0,        0.0,      -24.0,        4.0,       13.0,
+              7.0,        3.0,        3.0},
+   {
+              0.0,     -117.0,      -43.0,        5.0,       -7.0,        0.0,
+              0.0,       89.0,        0.0,     1604.0,        0.0,        0.0,
+              6.0,        0.0,        0.0,     -218.0,     -481.0,      128.0,
+           5123.0,     2409.0,      -24.0,       -9.0,      -60.0,      -13.0,
+            -29.0,      -27.0,        0.0,        0.0,       24.0,        0.0,
+            101.0,       -8.0,       -6.0,        0.0,      175.0,       15.0,
+            212.0,      598.0,      334.0,      -12.0,       -6.0,        0.0,
+              0.0,        0.0,        0.0,       -9.0,      -78.0,     -435.0,
+             15.0,        0.0,      131.0,        0.0,        3.0,        4.0,
+              3.0,      -19.0,      -11.0,        0.0,        8.0,        3.0,
+             24.0,       -4.0,        0.0,       -8.0,        3.0,        5.0,
+              3.0,        4.0,       -5.0,        0.0,       24.0,       20.0,
+            233.0,        0.0,      -18.0,        3.0,       -3.0,       -4.0,
+             -8.0,       -5.0,        0.0,        8.0,        8.0,       19.0,
+            -22.0,        0.0,       -3.0,        3.0,        5.0,      -16.0,
+              3.0,        7.0,      -62.0,       22.0,        0.0,        0.0,
+              0.0,       -8.0,       -7.0,        0.0,      -78.0,      -70.0,
+              6.0,        3.0,       -4.0,        6.0,       15.0,       84.0,
+             56.0,      -12.0,        8.0,        8.0,      -22.0,        0.0,
+             12.0,       -6.0,        0.0,        3.0,       29.0,       -4.0,
+             -3.0,       -3.0,        0.0,        0.0,        0.0,       66.0,
+              7.0,        3.0,        0.0,      -34.0,       14.0,       -6.0,
+             -4.0,        5.0,       17.0,      298.0,        0.0,        0.0,
+              0.0,      292.0,       17.0,      -16.0,        0.0,        0.0,
+             -5.0,        0.0,      -28.0,       -6.0,        0.0,       57.0,
+              7.0,       80.0,      430.0,      -47.0,       47.0,       23.0,
+              0.0,       -4.0,     -110.0,      114.0,        0.0,        4.0,
+             -6.0,       -3.0,      -21.0,     -436.0,       -7.0,        5.0,
+             -3.0,       -3.0,       -9.0,        3.0,        0.0,       -4.0,
+            194.0,       52.0,      248.0,       49.0,      -47.0,        5.0,
+             23.0,        0.0,        5.0,        0.0,        8.0,        0.0,
+              0.0,        8.0,        8.0,        0.0,        0.0,        4.0,
+             -4.0,       15.0,        0.0,       -7.0,       -7.0,        0.0,
+             10.0,        0.0,       35.0,        4.0,        9.0,        0.0,
+            -14.0,       -9.0,       47.0,       40.0,      -49.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,      153.0,        9.0,
+            -13.0,       12.0,        0.0,     -268.0,       12.0,        7.0,
+              6.0,       27.0,       11.0,      -39.0,       -6.0,       15.0,
+              4.0,        0.0,       11.0,        6.0,       10.0,        3.0,
+              0.0,        0.0,        3.0,        0.0,       22.0,      223.0,
+           -143.0,       49.0,        0.0,        0.0,        0.0,        0.0,
+             -4.0,        0.0,        8.0,        0.0,        0.0,       31.0,
+              0.0,        0.0,        0.0,      -13.0,        0.0,      -32.0,
+             12.0,        0.0,       13.0,       16.0,        0.0,       -5.0,
+              0.0,        5.0,        5.0,      -11.0,       -3.0,        0.0,
+            614.0,       -3.0,       17.0,       -9.0,        6.0,       21.0,
+              5.0,      -10.0,        0.0,        9.0,        0.0,       22.0,
+             19.0,        0.0,       -5.0,        3.0,        3.0,        0.0,
+             -3.0,       34.0,        0.0,        0.0,      -87.0,        0.0,
+             -6.0,       -3.0,       -3.0,        0.0,       39.0,        0.0,
+             -4.0,        0.0,       -3.0,        0.0,       66.0,        0.0,
+             93.0,       28.0,       13.0,       14.0,        0.0,        1.0,
+             -3.0,        0.0,        0.0,        3.0,        0.0,        3.0,
+              0.0,      106.0,       21.0,        0.0,      -32.0,        5.0,
+             -3.0,       -6.0,        4.0,        0.0,        4.0,        3.0,
+              0.0,       -3.0,        0.0,        3.0,       11.0,        0.0,
+             -5.0,       36.0,       -5.0,      -59.0,        9.0,        0.0,
+            -45.0,        0.0,       -3.0,       -4.0,        0.0,        0.0,
+             23.0,       -4.0,        0.0,      269.0,        0.0,        0.0,
+             45.0,       -5.0,        0.0,      328.0,        0.0,        0.0,
+              3.0,        0.0,        0.0,       -4.0,      -26.0,        7.0,
+              0.0,        3.0,       20.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,      -30.0,        3.0,        0.0,        0.0,
+            -27.0,      -11.0,        0.0,        5.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -3.0,        0.0,
+             11.0,        3.0,        0.0,       -4.0,        0.0,      -27.0,
+             -8.0,        0.0,       35.0,        4.0,       -5.0,        0.0,
+             -3.0,        0.0,      -48.0,       -5.0,        0.0,        0.0,
+             -5.0,       55.0,        5.0,        0.0,      -13.0,       -7.0,
+              0.0,       -7.0,        0.0,       -6.0,       -3.0,      -31.0,
+              3.0,        0.0,      -24.0,        0.0,        0.0,        0.0,
+             -4.0,        0.0,       -3.0,        0.0,        0.0,      -10.0,
+            -28.0,        6.0,        0.0,       -9.0,        0.0,        4.0,
+             -6.0,       15.0,        0.0,     -114.0,        0.0,       19.0,
+              0.0,        0.0,       -3.0,        0.0,       -6.0,        3.0,
+             21.0,        0.0,        8.0,        0.0,      -29.0,       34.0,
+              0.0,       12.0,      -15.0,        3.0,        0.0,       35.0,
+            -30.0,        0.0,        4.0,        9.0,      -71.0,      -20.0,
+              5.0,      -96.0,        9.0,       -6.0,       -3.0,     -415.0,
+              0.0,        0.0,      -32.0,       -9.0,       -4.0,        0.0,
+            -86.0,        0.0,     -416.0,       -3.0,       -6.0,        9.0,
+            -15.0,        0.0,      -97.0,        5.0,      -19.0,        0.0,
+              4.0,        3.0,        4.0,      -70.0,      -12.0,      -16.0,
+            -32.0,       -3.0,        0.0,        8.0,       10.0,        0.0,
+             -7.0,       -4.0,       19.0,     -173.0,       -7.0,      -12.0,
+              0.0,       -4.0,        0.0,       12.0,      -14.0,        0.0,
+             24.0,        0.0,      -10.0,       -3.0,        0.0,        0.0,
+              0.0,      -23.0,        0.0,      -10.0,        0.0,        0.0,
+             -4.0,       -3.0,      -11.0,        0.0,        0.0,        9.0,
+             -9.0,      -12.0,      -91.0,      -18.0,        0.0,     -114.0,
+              0.0,       16.0,       -7.0,       -3.0,        0.0,        0.0,
+              0.0,       12.0,        0.0,        0.0,        4.0,       12.0,
+              0.0,        7.0,        3.0,        4.0,      -11.0,        4.0,
+             17.0,        0.0,       -4.0,        0.0,        0.0,      -15.0,
+             -8.0,        0.0,        3.0,        3.0,        6.0,        0.0,
+              9.0,       17.0,        0.0,        5.0,        0.0,       -7.0,
+             13.0,        0.0,       -3.0,       -3.0,        0.0,        0.0,
+            -10.0,       -6.0,      -32.0,        0.0,       -8.0,       -4.0,
+              4.0,        3.0,      -23.0,        0.0,        3.0,        9.0,
+              0.0,       -7.0,       -4.0,        0.0,        3.0,        0.0,
+              0.0,       12.0,       -3.0,        7.0,        0.0,       -5.0,
+             -3.0,        0.0,        0.0,        5.0,        0.0,       -3.0,
+              9.0,        0.0,        0.0,        4.0,        0.0,        0.0,
+              3.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -4.0,       -4.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        3.0,        0.0,
+             11.0,       -5.0,       -5.0,        5.0,       -5.0,        0.0,
+             10.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,       -3.0,      -63.0,        0.0,
+             28.0,        0.0,        9.0,        9.0,      -63.0,        0.0,
+            -11.0,       -4.0,      -11.0,        0.0,        3.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -12.0,
+              3.0,        3.0,        3.0,      -12.0,        0.0,        0.0,
+              0.0,        0.0,        0.0},
+   {
+              0.0,      -42.0,        0.0,        0.0,       -3.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,      117.0,     -257.0,        0.0,
+           2735.0,    -1286.0,      -11.0,        0.0,        0.0,       -7.0,
+            -16.0,      -14.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,       -3.0,        0.0,       76.0,        6.0,
+           -133.0,      319.0,        0.0,       -7.0,        3.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,     -232.0,
+              7.0,        0.0,        0.0,        0.0,        0.0,        2.0,
+              0.0,      -10.0,        6.0,        0.0,        0.0,        0.0,
+             11.0,       -2.0,        0.0,       -4.0,        0.0,        0.0,
+              2.0,        2.0,        0.0,        0.0,       13.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,       -1.0,       -2.0,
+             -4.0,        3.0,        0.0,        3.0,       -4.0,       10.0,
+              0.0,        0.0,        0.0,        0.0,        3.0,       -9.0,
+              0.0,        4.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -4.0,        0.0,        0.0,      -37.0,
+              3.0,        2.0,       -2.0,        3.0,       -8.0,       45.0,
+              0.0,       -6.0,        4.0,        4.0,      -12.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,       15.0,       -2.0,
+             -1.0,        0.0,        0.0,        0.0,        0.0,       35.0,
+              0.0,        2.0,        0.0,      -18.0,        7.0,       -3.0,
+             -2.0,        2.0,        9.0,      159.0,        0.0,        0.0,
+              0.0,      156.0,        9.0,        0.0,       -1.0,        0.0,
+             -3.0,        0.0,      -15.0,       -3.0,        0.0,       30.0,
+              3.0,       43.0,        0.0,      -25.0,       25.0,       13.0,
+              0.0,       -2.0,      -59.0,       61.0,        0.0,        0.0,
+             -3.0,       -1.0,      -11.0,     -233.0,        0.0,        3.0,
+             -1.0,       -1.0,       -5.0,        2.0,        0.0,        0.0,
+            103.0,       28.0,        0.0,       26.0,      -25.0,        3.0,
+             10.0,        0.0,        3.0,        0.0,        3.0,        0.0,
+              0.0,        4.0,        4.0,        0.0,        0.0,        2.0,
+             -2.0,        7.0,        0.0,       -3.0,       -3.0,        0.0,
+              4.0,        0.0,       19.0,        0.0,        0.0,        0.0,
+             -8.0,       -5.0,        0.0,       21.0,      -26.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        5.0,
+             -7.0,        6.0,        0.0,     -116.0,        5.0,        3.0,
+              3.0,       14.0,        6.0,        0.0,       -2.0,        8.0,
+              0.0,        0.0,        5.0,        0.0,        4.0,        0.0,
+              0.0,        0.0,        2.0,        0.0,        0.0,      119.0,
+            -77.0,       26.0,        0.0,        0.0,        0.0,        1.0,
+              0.0,        0.0,        4.0,        0.0,        0.0,        0.0,
+              1.0,        0.0,        0.0,       -6.0,        0.0,      -17.0,
+              5.0,        0.0,        0.0,        0.0,        0.0,       -3.0,
+              0.0,        3.0,        2.0,       -5.0,       -2.0,        0.0,
+              0.0,       -1.0,        9.0,       -5.0,        3.0,        9.0,
+              0.0,       -4.0,        0.0,        4.0,        0.0,        0.0,
+             10.0,        0.0,       -2.0,        1.0,        1.0,        0.0,
+             -2.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+             -2.0,       -1.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -2.0,        0.0,       29.0,        0.0,
+             49.0,       15.0,        7.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        1.0,
+              0.0,       57.0,       11.0,        0.0,      -17.0,        3.0,
+             -2.0,       -2.0,        0.0,        0.0,        2.0,        0.0,
+              0.0,       -1.0,        0.0,        1.0,        0.0,        0.0,
+             -3.0,        0.0,        0.0,      -31.0,        5.0,        0.0,
+            -20.0,        0.0,        0.0,       -2.0,        0.0,        0.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              1.0,        0.0,        0.0,       -2.0,        0.0,        3.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,      -12.0,
+             -4.0,        0.0,       19.0,        2.0,        0.0,        0.0,
+              0.0,        0.0,      -21.0,       -2.0,        0.0,        0.0,
+              0.0,       29.0,        3.0,        0.0,       -7.0,       -3.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -16.0,
+              1.0,        0.0,      -10.0,        0.0,        0.0,        0.0,
+             -2.0,        0.0,        0.0,        0.0,        0.0,       -4.0,
+              0.0,        3.0,        0.0,       -4.0,        0.0,        0.0,
+             -2.0,        0.0,        0.0,      -49.0,        0.0,       10.0,
+              0.0,        0.0,       -1.0,        0.0,       -2.0,        0.0,
+             11.0,       -1.0,        4.0,        0.0,      -13.0,       18.0,
+              0.0,        6.0,       -7.0,        0.0,        0.0,        0.0,
+            -13.0,        0.0,        2.0,        0.0,      -31.0,       -9.0,
+              2.0,      -42.0,        4.0,       -3.0,       -1.0,     -180.0,
+              0.0,        0.0,      -17.0,       -5.0,        2.0,        0.0,
+            -19.0,      -19.0,     -180.0,       -1.0,       -3.0,        4.0,
+             -7.0,        0.0,      -42.0,        2.0,       -8.0,        0.0,
+              2.0,        0.0,        2.0,      -31.0,       -5.0,       -7.0,
+            -14.0,       -1.0,        0.0,        0.0,        4.0,        0.0,
+             -3.0,       -2.0,        0.0,      -75.0,       -3.0,       -5.0,
+              0.0,       -2.0,        0.0,        6.0,       -6.0,        0.0,
+             13.0,        0.0,       -5.0,       -1.0,        1.0,        0.0,
+              0.0,      -12.0,        0.0,       -5.0,        0.0,        0.0,
+             -2.0,        0.0,       -5.0,        0.0,        0.0,        0.0,
+             -4.0,        0.0,      -39.0,       -8.0,        0.0,      -50.0,
+              0.0,        7.0,       -3.0,       -1.0,        0.0,        0.0,
+              0.0,        5.0,        0.0,        0.0,        2.0,        5.0,
+              0.0,        4.0,        1.0,        2.0,       -5.0,        2.0,
+              9.0,        0.0,       -2.0,        0.0,        0.0,       -8.0,
+              0.0,       -3.0,        1.0,        1.0,        0.0,        0.0,
+              4.0,        7.0,        0.0,        3.0,        0.0,       -3.0,
+              7.0,        0.0,       -2.0,       -1.0,        0.0,        0.0,
+             -6.0,        0.0,      -14.0,        0.0,       -4.0,        0.0,
+              0.0,        1.0,      -10.0,        0.0,        2.0,        5.0,
+              0.0,       -4.0,        0.0,       -2.0,        0.0,        0.0,
+              1.0,        5.0,       -1.0,        4.0,        0.0,       -3.0,
+              0.0,       -1.0,        0.0,        3.0,        0.0,       -2.0,
+              4.0,        0.0,        0.0,        2.0,        0.0,        0.0,
+              1.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -2.0,        3.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        0.0,       -2.0,      -27.0,        1.0,
+             15.0,        1.0,        4.0,        4.0,      -27.0,        0.0,
+             -6.0,        0.0,       -6.0,        0.0,        1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -5.0,
+              1.0,        1.0,        2.0,       -5.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0},
+   {
+              0.0,      -40.0,      -54.0,        0.0,        0.0,       -2.0,
+             61.0,        0.0,        0.0,        0.0,      -53.0,        2.0,
+              0.0,        0.0,        0.0,        8.0,      -17.0,        0.0,
+           1647.0,     -771.0,       -9.0,        0.0,        0.0,        0.0,
+             14.0,       -5.0,       -6.0,        0.0,        0.0,     -151.0,
+              0.0,        0.0,        0.0,       -3.0,       17.0,        0.0,
+            269.0,     -641.0,        0.0,       -6.0,        3.0,        3.0,
+             -3.0,        0.0,       -7.0,        0.0,        0.0,      246.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        9.0,       -5.0,        3.0,        0.0,        0.0,
+             -5.0,        1.0,       -1.0,        0.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,        2.0,       -2.0,        0.0,
+              0.0,        1.0,        0.0,        0.0,        0.0,        1.0,
+             -1.0,        0.0,        3.0,        6.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -2.0,      -48.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+             -3.0,        0.0,       -8.0,        1.0,        0.0,      -11.0,
+              0.0,       -2.0,        9.0,        0.0,       17.0,      -93.0,
+              0.0,       35.0,      -25.0,        0.0,       -5.0,        2.0,
+              0.0,        0.0,       -2.0,       -2.0,        0.0,        2.0,
+             -5.0,        0.0,        0.0,       -2.0,        3.0,      -25.0,
+              0.0,        0.0,        0.0,       36.0,        0.0,       -5.0,
+              3.0,        1.0,      -41.0,      -45.0,       -1.0,        2.0,
+              1.0,       44.0,       39.0,        0.0,       -2.0,        0.0,
+              5.0,        0.0,      -30.0,        0.0,        2.0,       21.0,
+            -13.0,     -146.0,        0.0,        4.0,       -3.0,        0.0,
+              2.0,       -2.0,       26.0,      -27.0,       57.0,        0.0,
+             11.0,        0.0,        6.0,        9.0,        0.0,        0.0,
+             -6.0,        3.0,       28.0,        1.0,       -2.0,        0.0,
+             27.0,        7.0,        0.0,       -3.0,        3.0,        0.0,
+            -23.0,        1.0,        0.0,        0.0,        2.0,        0.0,
+             -2.0,        0.0,        1.0,        0.0,        0.0,        4.0,
+             -4.0,        0.0,        0.0,        0.0,        0.0,      -29.0,
+              0.0,        3.0,       20.0,        0.0,        0.0,       -4.0,
+              5.0,        3.0,        0.0,        5.0,       -7.0,      932.0,
+              5.0,      -37.0,       -2.0,       -2.0,        0.0,        3.0,
+             -5.0,        4.0,       22.0,        5.0,        0.0,        0.0,
+            -17.0,      -75.0,      -30.0,        0.0,        0.0,       -2.0,
+              0.0,        1.0,        0.0,        0.0,        2.0,        0.0,
+             -9.0,        0.0,       -1.0,       -3.0,        0.0,      -22.0,
+             14.0,       -5.0,      505.0,        2.0,        3.0,        4.0,
+              0.0,      -63.0,        2.0,       -2.0,        2.0,        0.0,
+              3.0,       -2.0,        2.0,       10.0,        0.0,        0.0,
+             -3.0,       -1.0,        0.0,        0.0,      -27.0,        0.0,
+              0.0,        1.0,      -11.0,       -2.0,      -16.0,       -9.0,
+              0.0,       -2.0,       -3.0,        2.0,       -1.0,       55.0,
+              0.0,        3.0,        0.0,       -7.0,       -2.0,        0.0,
+              0.0,       -4.0,        0.0,        0.0,        4.0,       -7.0,
+             -1.0,        0.0,        5.0,        2.0,        0.0,        2.0,
+              1.0,        7.0,        0.0,        0.0,        0.0,      -14.0,
+              0.0,        0.0,        6.0,       -1.0,       -1.0,     -213.0,
+             12.0,        4.0,        2.0,        0.0,        0.0,        0.0,
+              0.0,       15.0,       -2.0,        0.0,        5.0,        0.0,
+              1.0,      -13.0,       -3.0,        0.0,        4.0,        0.0,
+              3.0,      -13.0,        0.0,       10.0,       -1.0,        0.0,
+             -2.0,        0.0,        0.0,       -2.0,        0.0,      -52.0,
+              0.0,        0.0,        0.0,       -8.0,        1.0,      198.0,
+              0.0,       -5.0,        0.0,       -1.0,       -6.0,       -2.0,
+              0.0,        0.0,        2.0,        0.0,       -8.0,       -4.0,
+              0.0,        0.0,       -4.0,        0.0,       -2.0,       -2.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -6.0,
+             -2.0,        1.0,        0.0,        0.0,        1.0,        2.0,
+              0.0,        0.0,        2.0,        0.0,        2.0,        0.0,
+              0.0,        6.0,        0.0,       32.0,        0.0,       -2.0,
+              0.0,        0.0,      114.0,        0.0,        4.0,        0.0,
+              8.0,      -87.0,        5.0,        0.0,        0.0,       -3.0,
+              0.0,        0.0,       15.0,        1.0,       -3.0,       -1.0,
+              0.0,       -6.0,        0.0,        0.0,        1.0,        2.0,
+             -1.0,        0.0,       -2.0,        0.0,        0.0,       -4.0,
+              0.0,      -49.0,        0.0,       -2.0,        0.0,        1.0,
+              0.0,       -2.0,        0.0,        6.0,       -2.0,        8.0,
+              0.0,        2.0,        1.0,        2.0,       -7.0,        0.0,
+              0.0,        0.0,        2.0,        0.0,      -51.0,        2.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+              2.0,        3.0,        1.0,        0.0,       -8.0,       -4.0,
+              0.0,       -1.0,      -24.0,        0.0,       -1.0,        0.0,
+             67.0,        0.0,        0.0,        0.0,      -35.0,        0.0,
+             -5.0,      -27.0,       -6.0,        5.0,        0.0,      -53.0,
+            -35.0,        0.0,       -4.0,        0.0,        0.0,       38.0,
+             -6.0,        6.0,       53.0,        0.0,       -5.0,        6.0,
+              0.0,       -1.0,       27.0,        5.0,        0.0,        1.0,
+              0.0,        0.0,        0.0,       37.0,      -72.0,       28.0,
+              9.0,        0.0,       -2.0,        0.0,       -1.0,       -1.0,
+              0.0,        0.0,        0.0,       -2.0,        0.0,       -3.0,
+              2.0,       -1.0,      -32.0,        2.0,      -11.0,       -8.0,
+             -3.0,        0.0,        0.0,       -5.0,       -1.0,       -1.0,
+              0.0,       -3.0,      147.0,        0.0,        0.0,       -1.0,
+              0.0,        0.0,       -4.0,        4.0,       -1.0,        0.0,
+             -2.0,        0.0,      -29.0,      -13.0,        0.0,        0.0,
+             23.0,     -224.0,        0.0,      -62.0,      -13.0,        2.0,
+              3.0,       -2.0,       11.0,        1.0,        0.0,       10.0,
+            -22.0,        0.0,        0.0,        2.0,        2.0,        0.0,
+             -2.0,        0.0,        0.0,        4.0,        0.0,       -2.0,
+           -160.0,        0.0,        0.0,        3.0,        0.0,        4.0,
+              0.0,       -2.0,      -15.0,        0.0,        2.0,       16.0,
+             -2.0,        0.0,        0.0,       80.0,        1.0,        0.0,
+             -1.0,      -13.0,        1.0,        3.0,        0.0,        0.0,
+              0.0,        0.0,        2.0,      -10.0,        0.0,       -1.0,
+              0.0,        0.0,       -4.0,        0.0,        0.0,        1.0,
+              4.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+             -1.0,        0.0,       -5.0,        0.0,        0.0,        0.0,
+              3.0,       -4.0,        0.0,        0.0,       -3.0,        0.0,
+              0.0,       -2.0,       -1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        2.0,
+              0.0,        0.0,        0.0,       -2.0,        1.0,        3.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,       -3.0,
+              3.0,        0.0,        0.0,        0.0,      -55.0,        2.0,
+              2.0,       -2.0,        1.0,       -1.0,       55.0,       -1.0,
+            -11.0,        0.0,       11.0,        1.0,        0.0,       -4.0,
+              3.0,        1.0,       -1.0,        1.0,        2.0,      -11.0,
+              0.0,        0.0,        0.0,       10.0,       -2.0,       -6.0,
+             -3.0,       -1.0,       -1.0}};
+
+/*
+   NU2000K luni-solar and planetary series, laid out as above (see
+   'nu2000k').
+*/
+static const signed char K_LS_MULT[5][323] = {
+   {
+        0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0, -1, -1,  1, -1, -1,
+        1, -2,  0,  0,  0, -2,  2,  1, -1,  2,  0,  0, -1,  0,  0,  1,
+        0, -1,  0,  1, -2,  0,  0,  0,  0,  1,  2, -2,  2,  0,  0, -1,
+        2,  1,  0,  1, -2,  3,  0,  1,  0, -1, -1,  0, -2,  1,  2, -1,
+        1,  1, -1,  1, -1,  0, -1, -1,  0,  1, -2, -1,  1, -2, -1,  2,
+        2,  1,  3,  3,  0,  0,  0,  0, -1,  2, -2, -1, -1,  0,  0,  0,
+        0,  0, -2,  1, -1, -1,  1,  1, -1,  3,  0, -1,  0, -1,  0,  1,
+       -1,  0,  2,  0,  1, -1,  0,  0,  0,  0, -1,  2,  1,  1,  2,  1,
+       -1,  0,  0, -1,  0, -1,  1,  1,  0,  1,  0,  1, -1,  1,  1,  0,
+       -1, -2,  4,  2,  2,  0,  1, -1,  0, -2,  2,  1, -1, -1,  2,  0,
+       -1,  2,  0,  0,  0,  0,  0,  0, -1,  1, -2, -2, -2, -1,  0,  3,
+       -2,  1,  0, -2, -3,  1,  0,  3, -1,  2,  0,  2, -1,  0,  0,  2,
+        4,  2,  0,  1,  0, -3, -1, -1, -1, -2,  1, -2, -2,  2, -3, -2,
+       -1,  0, -1,  0, -1,  2,  0, -2, -1, -1,  3, -1,  2,  0,  0,  2,
+        0, -1,  0,  1,  1, -1,  1, -2, -1, -2,  0,  1,  2,  1,  4,  2,
+        3, -2,  1,  1, -1,  0,  0, -2, -2, -1,  1,  0, -1,  1,  1,  2,
+        1,  2, -2,  1,  0,  1, -2,  1,  1,  1,  2,  3,  4, -2,  0,  1,
+        2, -1,  1,  0, -1,  0,  2,  0,  0, -2,  1, -3, -2,  2,  1,  0,
+       -1,  0,  1,  1, -1,  3,  0,  2,  0,  2, -1,  1,  1,  0, -1,  3,
+       -1, -2, -1,  1, -1, -1, -2,  0,  1,  1,  3,  0, -1, -1, -1, -1,
+        0,  0,  0},
+   {
+        0,  0,  0,  0,  1,  1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  0,
+       -1,  0,  2,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0, -1,  0, -1,
+        0,  0,  1, -1,  0,  0, -1, -1,  0, -1,  0, -1,  0,  1,  0,  1,
+        1,  0,  0,  0,  0,  0,  0,  1, -2,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0, -1,  0,  1,  0, -1,
+        0,  0, -1,  1,  1,  1, -1, -1,  1,  0,  1,  0,  1, -1, -1,  0,
+        0, -1, -1,  0, -1,  1,  1, -1,  3,  0,  0,  1,  1,  1,  0,  0,
+        0,  1,  1,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0, -1,  1,  1,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,
+       -2,  1,  0,  0,  3,  0, -1,  0, -1,  0,  2, -1,  0, -1,  0,  0,
+       -1,  0, -2,  0,  0,  1,  0,  0,  1,  0,  0,  0,  1,  0, -2,  0,
+        0,  0,  2,  0,  2,  0,  1, -1, -2, -1, -1,  1,  1,  1,  0,  0,
+        1, -1,  0, -2,  0,  0,  0,  0,  0,  1,  0,  0, -1,  1, -1, -1,
+        2, -1, -2,  0, -1, -1, -1, -1,  0, -1,  2,  1,  0,  0,  0,  1,
+       -1,  2,  0,  1, -1, -1, -1,  0,  0,  0, -2,  1,  2, -1,  2, -1,
+        0,  1,  0, -2,  1,  0,  0,  1,  0,  0,  0,  1,  0, -1,  1,  0,
+       -1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  1,  1,
+        1,  0, -1,  1,  2,  1, -1, -1,  0,  0, -1,  0, -2,  0,  1,  0,
+        0,  0,  0,  1,  0, -1,  0,  0, -1,  2,  0, -1,  0,  0,  0,  0,
+        0,  0,  0},
+   {
+        0,  2,  2,  0,  0,  2,  0,  2,  2,  2,  2,  2,  0,  0,  0,  2,
+        2,  2,  0,  2,  2,  0,  2,  2,  2,  0,  2,  0,  0,  2, -2,  0,
+        0,  2,  0,  2,  2,  2,  2,  2,  0,  2,  2,  0,  2,  2,  0,  0,
+        0,  0,  2,  0,  2,  2,  0,  2,  0,  2,  2,  2,  0,  2,  0,  0,
+        0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  2,  0,  2,  2,  4,  2,
+        2,  0,  0,  2,  4,  2, -2,  2,  0, -2,  0,  0,  0,  0, -2,  2,
+        2,  2,  0,  0,  0,  0,  0,  2,  2,  2, -2,  0,  2,  2,  0,  2,
+       -2,  2,  2,  0,  2,  2,  0, -2,  2,  0,  2,  2,  0,  2,  0, -2,
+        0,  0,  0,  2,  0,  0,  2,  0,  0,  2,  2,  0,  2, -2,  2,  2,
+        2,  2,  2,  0,  2,  2,  4,  0,  0,  2,  2,  0,  0,  4,  2,  2,
+        0,  0,  4,  0,  0,  2,  0,  0,  2,  2,  0,  2,  0,  2,  4,  2,
+        0,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0,  2,  0,  2,  2,  0,
+        2,  0,  0,  0,  2,  0,  2,  0,  2,  2,  2,  0,  2,  0,  2,  2,
+        0,  2,  4,  2,  2,  0,  2,  4, -2,  2,  0,  2,  2,  2,  2,  2,
+       -2,  2,  0,  2,  0,  2,  2,  0,  0,  2,  2,  0,  2,  2,  0,  2,
+        2,  0,  2,  2,  2,  0,  0,  0, -2, -2,  0,  0,  0,  2,  2,  2,
+        2,  2,  0,  2,  2,  4,  4,  2,  0,  2,  2,  2,  2,  2, -2, -2,
+        0,  2,  2,  2, -2,  2,  2,  4,  4,  0, -2,  2,  2,  0,  0,  4,
+        0,  0,  0,  0,  2,  2,  0,  0,  4,  4,  2,  0,  2,  2,  2,  0,
+        4,  2,  2, -2,  0,  0,  0, -2, -2,  0,  2,  1,  1,  1,  1,  1,
+        1,  1,  1},
+   {
+        0, -2,  0,  0,  0, -2,  0,  0,  0, -2, -2,  0,  2,  0,  0,  2,
+        0,  0,  2,  2, -2,  2,  0, -2,  0,  0,  0,  0,  2, -2,  2, -2,
+        0,  2,  0,  2,  0,  0,  2,  0,  2, -2, -2,  2,  0, -2, -2,  2,
+       -2,  2, -2,  0,  0,  0,  2,  0,  1,  2,  0,  2,  0,  0,  0,  1,
+        0,  0, -2,  0,  1,  1,  4,  1, -2,  2,  2,  0, -2,  4,  0, -2,
+        2,  2,  0, -2, -2,  0,  2, -2,  4,  0,  4,  2,  1,  0,  0,  0,
+       -1,  4,  2, -2,  2,  1,  0,  2,  2,  0,  2, -2,  2,  2,  0, -4,
+        2,  2,  0,  2,  0,  0,  2,  2, -2,  1,  2,  0,  0,  0,  2,  2,
+        2,  1, -2, -2, -1,  0, -1,  2,  4,  1,  1, -2,  4,  0, -2,  2,
+       -1,  2,  0,  0, -2,  1, -2,  0,  2,  4,  0,  1,  4,  0,  2, -3,
+        2,  0,  0,  0,  0, -4,  2,  4,  4,  4,  2,  0,  2,  0, -2, -2,
+        2, -1,  2,  4,  0,  2,  4,  2, -2, -4, -2, -4,  2, -1,  2,  2,
+       -2, -2,  0, -4, -2,  4,  0,  4,  2,  4,  2,  2,  0, -2,  0, -2,
+        2, -1, -2,  0,  1,  0,  0,  0,  0,  2,  0,  3,  0,  2,  4,  2,
+        2, -1,  0, -4, -2,  0, -2,  4,  3,  2,  0,  2, -1,  1,  0,  0,
+        0,  2, -3, -4, -2, -1, -2,  0,  2,  4,  0,  1,  2, -2, -2, -2,
+       -1, -2, -2,  0,  1, -2,  2,  1,  4,  2,  1,  0,  0,  0,  2,  1,
+       -2, -1, -3, -2,  2, -4, -4, -4, -4,  3,  2,  2,  2,  0,  1, -2,
+       -2, -4,  2,  2,  2, -2,  4,  2,  0, -2,  4,  4,  2,  3,  4,  2,
+        2,  6,  6,  1,  1,  1,  1,  1,  2,  0,  0, -1,  0,  0,  0,  0,
+        0,  0,  0},
+   {
+        1,  2,  2,  2,  0,  2,  0,  1,  2,  2,  1,  2,  0,  1,  1,  2,
+        1,  1,  0,  2,  2,  0,  2,  2,  1,  0,  0,  1,  1,  2,  0,  1,
+        1,  1,  0,  2,  0,  2,  1,  2,  1,  1,  2,  1,  1,  1,  1,  0,
+        1,  0,  1,  0,  2,  2,  0,  2,  0,  2,  0,  2,  1,  2,  1,  0,
+        0,  0,  1,  2,  0,  2,  2,  1,  1,  1,  2,  2,  2,  2,  2,  1,
+        2,  1,  0,  2,  2,  1,  1,  3,  0,  1,  0,  1,  1,  2,  1,  1,
+        2,  2,  0,  1,  0,  2,  1,  2,  2,  1,  0,  1,  2,  1,  2,  1,
+        0,  1,  2,  2,  1,  2,  0,  0,  2,  1,  0,  2,  1,  1,  0,  0,
+        2,  0,  1,  2,  1,  1,  2,  0,  0,  2,  1,  2,  1,  1,  1,  0,
+        1,  1,  2,  0,  2,  2,  2,  1,  1,  1,  0,  0,  1,  1,  1,  2,
+        0,  0,  2,  3,  0,  1,  1,  1,  2,  2,  0,  1,  2,  2,  1,  1,
+        1,  1,  0,  1,  1,  2,  1,  2,  1,  1,  2,  1,  1,  1,  2,  1,
+        2,  2,  1,  1,  1,  0,  1,  0,  2,  2,  1,  0,  1,  1,  1,  1,
+        2,  2,  2,  2,  2,  2,  3,  2,  1,  1,  1,  2,  1,  1,  2,  2,
+        0,  1,  1,  2,  1,  1,  2,  0,  0,  2,  2,  0,  2,  1,  0,  1,
+        2,  1,  1,  1,  1,  1,  1,  2,  0,  0,  0,  1,  0,  1,  2,  2,
+        1,  1,  1,  2,  1,  1,  2,  2,  0,  0,  2,  2,  1,  0,  1,  0,
+        1,  2,  2,  3,  1,  2,  2,  4,  2,  0,  1,  2,  0,  1,  0,  2,
+        1,  1,  1,  1,  2,  2,  0,  0,  1,  2,  1,  1,  2,  2,  2,  0,
+        2,  2,  2,  0,  2,  0,  0,  0,  0,  0,  0,  1,  3,  2,  1,  0,
+        2,  1,  0}};
+
+static const double K_LS_COEF[6][323] = {
+   {
+      -172064161.0,-13170906.0, -2276413.0,  2074554.0,  1475877.0,  -516821.0,
+         711159.0,  -387298.0,  -301461.0,   215829.0,   128227.0,   123457.0,
+         156994.0,    63110.0,   -57976.0,   -59641.0,   -51613.0,    45893.0,
+          63384.0,   -38571.0,    32481.0,   -47722.0,   -31046.0,    28593.0,
+          20441.0,    29243.0,    25887.0,   -14053.0,    15164.0,   -15794.0,
+          21783.0,   -12873.0,   -12654.0,   -10204.0,    16707.0,    -7691.0,
+         -11024.0,     7566.0,    -6637.0,    -7141.0,    -6302.0,     5800.0,
+           6443.0,    -5774.0,    -5350.0,    -4752.0,    -4940.0,     7350.0,
+           4065.0,     6579.0,     3579.0,     4725.0,    -3075.0,    -2904.0,
+           4348.0,    -2878.0,    -4230.0,    -2819.0,    -4056.0,    -2647.0,
+          -2294.0,     2481.0,     2179.0,     3276.0,    -3389.0,     3339.0,
+          -1987.0,    -1981.0,     4026.0,     1660.0,    -1521.0,     1314.0,
+          -1283.0,    -1331.0,     1383.0,     1405.0,     1290.0,    -1214.0,
+           1146.0,     1019.0,    -1100.0,     -970.0,     1575.0,      934.0,
+            922.0,      815.0,      834.0,     1248.0,     1338.0,      716.0,
+           1282.0,      742.0,     1020.0,      715.0,     -666.0,     -667.0,
+           -704.0,     -694.0,    -1014.0,     -585.0,     -949.0,     -595.0,
+            528.0,     -590.0,      570.0,     -502.0,     -875.0,     -492.0,
+            535.0,     -467.0,      591.0,     -453.0,      766.0,     -446.0,
+           -488.0,     -468.0,     -421.0,      463.0,     -673.0,      658.0,
+           -438.0,     -390.0,      639.0,      412.0,     -361.0,      360.0,
+            588.0,     -578.0,     -396.0,      565.0,     -335.0,      357.0,
+            321.0,     -301.0,     -334.0,      493.0,      494.0,      337.0,
+            280.0,      309.0,     -263.0,      253.0,      245.0,      416.0,
+           -229.0,      231.0,     -259.0,      375.0,      252.0,     -245.0,
+            243.0,      208.0,      199.0,     -208.0,      335.0,     -325.0,
+           -187.0,      197.0,     -192.0,     -188.0,      276.0,     -286.0,
+            186.0,     -219.0,      276.0,     -153.0,     -156.0,     -154.0,
+           -174.0,     -163.0,     -228.0,       91.0,      175.0,     -159.0,
+            141.0,      147.0,     -132.0,      159.0,      213.0,      123.0,
+           -118.0,      144.0,     -121.0,     -134.0,     -105.0,     -102.0,
+            120.0,      101.0,     -113.0,     -106.0,     -129.0,     -114.0,
+            113.0,     -102.0,      -94.0,     -100.0,       87.0,      161.0,
+             96.0,      151.0,     -104.0,     -110.0,     -100.0,       92.0,
+             82.0,       82.0,      -78.0,      -77.0,        2.0,       94.0,
+            -93.0,      -83.0,       83.0,      -91.0,      128.0,      -79.0,
+            -83.0,       84.0,       83.0,       91.0,      -77.0,       84.0,
+            -92.0,      -92.0,      -94.0,       68.0,      -61.0,       71.0,
+             62.0,      -63.0,      -73.0,      115.0,     -103.0,       63.0,
+             74.0,     -103.0,      -69.0,       57.0,       94.0,       64.0,
+            -63.0,      -38.0,      -43.0,      -45.0,       47.0,      -48.0,
+             45.0,       56.0,       88.0,      -75.0,       85.0,       49.0,
+            -74.0,      -39.0,       45.0,       51.0,      -40.0,       41.0,
+            -42.0,      -51.0,      -42.0,       39.0,       46.0,      -53.0,
+             82.0,       81.0,       47.0,       53.0,      -45.0,      -44.0,
+            -33.0,      -61.0,      -38.0,      -33.0,      -60.0,       48.0,
+             38.0,       31.0,      -32.0,       45.0,      -44.0,      -51.0,
+            -36.0,       44.0,      -60.0,       35.0,       47.0,       36.0,
+            -36.0,      -35.0,      -37.0,       32.0,       35.0,       32.0,
+             65.0,       47.0,       32.0,       37.0,      -30.0,      -32.0,
+            -31.0,       37.0,       31.0,       49.0,       32.0,      -43.0,
+            -32.0,       30.0,      -34.0,      -36.0,      -38.0,      -31.0,
+            -34.0,      -35.0,       30.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+        -174666.0,    -1675.0,     -234.0,      207.0,    -3633.0,     1226.0,
+             73.0,     -367.0,      -36.0,     -494.0,      137.0,       11.0,
+             10.0,       63.0,      -63.0,      -11.0,      -42.0,       50.0,
+             11.0,       -1.0,        0.0,        0.0,       -1.0,        0.0,
+             21.0,        0.0,        0.0,      -25.0,       10.0,       72.0,
+              0.0,      -10.0,       11.0,        0.0,      -85.0,        0.0,
+              0.0,      -21.0,      -11.0,       21.0,      -11.0,       10.0,
+              0.0,      -11.0,        0.0,      -11.0,      -11.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,      -11.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          33386.0,   -13696.0,     2796.0,     -698.0,    11817.0,     -524.0,
+           -872.0,      380.0,      816.0,      111.0,      181.0,       19.0,
+           -168.0,       27.0,     -189.0,      149.0,      129.0,       31.0,
+           -150.0,      158.0,        0.0,      -18.0,      131.0,       -1.0,
+             10.0,      -74.0,      -66.0,       79.0,       11.0,      -16.0,
+             13.0,      -37.0,       63.0,       25.0,      -10.0,       44.0,
+            -14.0,      -11.0,       25.0,        8.0,        2.0,        2.0,
+             -7.0,      -15.0,       21.0,       -3.0,      -21.0,       -8.0,
+              6.0,      -24.0,        5.0,       -6.0,       -2.0,       15.0,
+            -10.0,        8.0,        5.0,        7.0,        5.0,       11.0,
+            -10.0,       -7.0,       -2.0,        1.0,        5.0,      -13.0,
+             -6.0,        0.0,     -353.0,       -5.0,        9.0,        0.0,
+              0.0,        8.0,       -2.0,        4.0,        0.0,        5.0,
+             -3.0,       -1.0,        9.0,        2.0,       -6.0,       -3.0,
+             -1.0,       -1.0,        2.0,        0.0,       -5.0,       -2.0,
+             -3.0,        1.0,      -25.0,       -4.0,       -3.0,        1.0,
+              0.0,        5.0,       -1.0,       -2.0,        1.0,        0.0,
+              0.0,        4.0,       -2.0,        3.0,        1.0,       -3.0,
+             -2.0,        1.0,        0.0,       -1.0,        1.0,        2.0,
+              2.0,        0.0,        1.0,        0.0,        2.0,        0.0,
+              0.0,        0.0,       -2.0,       -2.0,        0.0,       -1.0,
+             -3.0,        1.0,        0.0,       -1.0,       -1.0,        1.0,
+              1.0,       -1.0,        0.0,       -2.0,       -2.0,       -1.0,
+             -1.0,        1.0,        2.0,        1.0,        0.0,       -2.0,
+              0.0,        0.0,        2.0,       -1.0,        0.0,        1.0,
+             -1.0,        1.0,        0.0,        1.0,       -2.0,        1.0,
+              0.0,       -1.0,        2.0,        0.0,        0.0,        1.0,
+             -1.0,        0.0,        0.0,       -1.0,        0.0,        1.0,
+              1.0,        2.0,        0.0,       -4.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,      -28.0,        0.0,        0.0,
+             -1.0,       -1.0,        1.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        1.0,        0.0,
+             -1.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        1.0,       -5.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       10.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              1.0,        1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -3.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,    -1988.0,      -63.0,      364.0,
+          -1044.0,      330.0,       30.0,     -162.0,       75.0},
+   {
+       92052331.0,  5730336.0,   978459.0,  -897492.0,    73871.0,   224386.0,
+          -6750.0,   200728.0,   129025.0,   -95929.0,   -68982.0,   -53311.0,
+          -1235.0,   -33228.0,    31429.0,    25543.0,    26366.0,   -24236.0,
+          -1220.0,    16452.0,   -13870.0,      477.0,    13238.0,   -12338.0,
+         -10758.0,     -609.0,     -550.0,     8551.0,    -8001.0,     6850.0,
+           -167.0,     6953.0,     6415.0,     5222.0,      168.0,     3268.0,
+            104.0,    -3250.0,     3353.0,     3070.0,     3272.0,    -3045.0,
+          -2768.0,     3041.0,     2695.0,     2719.0,     2720.0,      -51.0,
+          -2206.0,     -199.0,    -1900.0,      -41.0,     1313.0,     1233.0,
+            -81.0,     1232.0,      -20.0,     1207.0,       40.0,     1129.0,
+           1266.0,    -1062.0,    -1129.0,       -9.0,       35.0,     -107.0,
+           1073.0,      854.0,     -553.0,     -710.0,      647.0,     -700.0,
+            672.0,      663.0,     -594.0,     -610.0,     -556.0,      518.0,
+           -490.0,     -527.0,      465.0,      496.0,      -50.0,     -399.0,
+           -395.0,     -422.0,     -440.0,     -170.0,      -39.0,     -389.0,
+            -23.0,     -391.0,     -495.0,     -326.0,      369.0,      346.0,
+            304.0,      294.0,        4.0,      316.0,        8.0,      258.0,
+           -279.0,      252.0,     -244.0,      250.0,       29.0,      275.0,
+           -228.0,      240.0,     -253.0,      244.0,        9.0,      225.0,
+            207.0,      201.0,      216.0,     -200.0,       14.0,       -2.0,
+            188.0,      205.0,      -19.0,     -176.0,      189.0,     -185.0,
+            -24.0,        5.0,      171.0,       -6.0,      184.0,     -154.0,
+           -174.0,      162.0,      144.0,      -15.0,      -19.0,     -143.0,
+           -144.0,     -134.0,      131.0,     -138.0,     -128.0,      -17.0,
+            128.0,     -120.0,      109.0,       -8.0,     -108.0,      104.0,
+           -104.0,     -112.0,     -102.0,      105.0,      -14.0,        7.0,
+             96.0,     -100.0,       94.0,       83.0,       -2.0,        6.0,
+            -79.0,       43.0,        2.0,       84.0,       81.0,       78.0,
+             75.0,       69.0,        1.0,      -54.0,      -75.0,       69.0,
+            -72.0,      -75.0,       69.0,      -54.0,       -4.0,      -64.0,
+             66.0,      -61.0,       60.0,       56.0,       57.0,       56.0,
+            -52.0,      -54.0,       59.0,       61.0,       55.0,       57.0,
+            -49.0,       44.0,       51.0,       56.0,      -47.0,       -1.0,
+            -50.0,       -5.0,       44.0,       48.0,       50.0,       12.0,
+            -45.0,      -45.0,       41.0,       43.0,       54.0,      -40.0,
+             40.0,       40.0,      -36.0,       39.0,       -1.0,       34.0,
+             47.0,      -44.0,      -43.0,      -39.0,       39.0,      -43.0,
+             39.0,       39.0,        0.0,      -36.0,       32.0,      -31.0,
+            -34.0,       33.0,       32.0,       -2.0,        2.0,      -28.0,
+            -32.0,        3.0,       30.0,      -29.0,       -4.0,      -33.0,
+             26.0,       20.0,       24.0,       23.0,      -24.0,       25.0,
+            -26.0,      -25.0,        2.0,        0.0,        0.0,      -26.0,
+             -1.0,       21.0,      -20.0,      -22.0,       21.0,      -21.0,
+             24.0,       22.0,       22.0,      -21.0,      -18.0,       22.0,
+             -4.0,       -4.0,      -19.0,      -23.0,       22.0,       -2.0,
+             16.0,        1.0,       19.0,       21.0,        0.0,      -10.0,
+            -20.0,      -13.0,       15.0,       -8.0,       19.0,        0.0,
+             20.0,      -19.0,        2.0,      -18.0,       -1.0,      -15.0,
+             20.0,       19.0,       19.0,      -16.0,      -14.0,      -13.0,
+             -2.0,       -1.0,      -16.0,      -16.0,       15.0,       16.0,
+             13.0,      -16.0,      -13.0,       -2.0,      -13.0,       18.0,
+             14.0,        0.0,       15.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+           9086.0,    -3015.0,     -485.0,      470.0,     -184.0,     -677.0,
+              0.0,       18.0,      -63.0,      299.0,       -9.0,       32.0,
+              0.0,        0.0,        0.0,      -11.0,        0.0,      -10.0,
+              0.0,      -11.0,        0.0,        0.0,      -11.0,       10.0,
+              0.0,        0.0,        0.0,       -2.0,        0.0,      -42.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          15377.0,    -4587.0,     1374.0,     -291.0,    -1924.0,     -174.0,
+            358.0,      318.0,      367.0,      132.0,       39.0,       -4.0,
+             82.0,       -9.0,      -75.0,       66.0,       78.0,       20.0,
+             29.0,       68.0,        0.0,      -25.0,       59.0,       -3.0,
+             -3.0,       13.0,       11.0,      -45.0,       -1.0,       -5.0,
+             13.0,      -14.0,       26.0,       15.0,       10.0,       19.0,
+              2.0,       -5.0,       14.0,        4.0,        4.0,       -1.0,
+             -4.0,       -5.0,       12.0,       -3.0,       -9.0,        4.0,
+              1.0,        2.0,        1.0,        3.0,       -1.0,        7.0,
+              2.0,        4.0,       -2.0,        3.0,       -2.0,        5.0,
+             -4.0,       -3.0,       -2.0,        0.0,       -2.0,        1.0,
+             -2.0,        0.0,     -139.0,       -2.0,        4.0,        0.0,
+              0.0,        4.0,       -2.0,        2.0,        0.0,        2.0,
+             -1.0,       -1.0,        4.0,        1.0,        0.0,       -1.0,
+             -1.0,       -1.0,        1.0,        1.0,        0.0,       -1.0,
+              1.0,        0.0,      -10.0,        2.0,       -1.0,        1.0,
+              0.0,        2.0,       -1.0,       -1.0,       -1.0,        0.0,
+              0.0,        2.0,       -1.0,        2.0,        0.0,       -1.0,
+             -1.0,        1.0,        0.0,       -1.0,        0.0,        1.0,
+              1.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -1.0,        0.0,       -1.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -1.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        0.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       11.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -2.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -1.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,    -1679.0,      -27.0,      176.0,
+           -891.0,        0.0,       14.0,     -138.0,        0.0}};
+
+static const signed char K_PL_MULT[14][165] = {
+   {
+        0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  1,  1, -2, -1,
+        0,  0,  0,  0,  0,  0, -1,  0,  0, -2,  0,  2, -2, -1,  0,  0,
+        0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0, -2,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0, -2,  2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -1,  1, -1},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  1,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,
+        0,  0,  1,  0, -1,  0,  0, -1, -2,  0,  0,  0,  0,  0, -1,  0,
+        0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        1,  0,  1,  0,  0,  2, -1,  0,  1,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,
+        0,  0,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  2},
+   {
+        0,  0,  0, -1,  0,  0, -1,  0, -1,  0, -1,  0, -2, -1,  2,  0,
+        0,  0, -1,  0,  1,  0,  1,  1,  2,  2,  0, -2,  2,  1,  1,  0,
+        0, -1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0, -1,  0,
+       -1,  0, -1,  0,  0, -2,  1,  2, -1,  0,  0,  0, -1,  0,  2, -2,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0, -1,
+        0,  0, -2,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  0,  0},
+   {
+        0,  0,  0,  1,  0,  0,  1,  0,  1,  0,  1,  0,  0,  1,  1,  0,
+        0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,
+        0,  1,  0,  1,  0,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  0,
+        1,  0,  1,  0,  0,  1,  0,  1,  1,  0,  0,  0,  1,  0,  0,  1,
+        1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,
+        0,  0,  1,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  2},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 19,  0,  0, 18,
+       -8, -8, -8,  8,  0,  0,  3,  0,  5,  6,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  8, 18,  0,  0,  0,  0,  0,-18, -8,  0,  0,
+        0,  0,  0,  0,  0, -5,  5,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+        0,  3, -3, -3, -3, -3,  0,  0, -5, -5, -5, -5,  5,  0,  0,  0,
+        0,  0, -3,  0,  2,  0, -2,  2,  0,  0,  1,  0, -4, -4, -4,  4,
+       -1,  1,  1,  0,  0,  0, -2, -2, -6,  0,  0,  3,  0,  0,  0,  0,
+        0,  0, -5, -5,  0, -2,  2, -1, -1,  0, -2, -6,  0,  0, -3,  3,
+        3,  0,  0,  0, -8,  0,  0,  0,  0,  0,  0, -8,  0,  0, -3,  0,
+        2, -7,  4,  1,  0,  0,  3,  0,  0, -8,  5,  2, -9,  0,  6,  0,
+        3,  0,  0,  0,  0},
+   {
+        8, -8,  8,  3, -3,  4, -5,  0, -1,  0, -1,  0,-21, -1,  2,-16,
+       13, 13, 12,-13,  0, -1, -4,  1, -6, -8,  8, -2,  2,  1,  1,  0,
+        0, -1,  0, -1,  0,-13,-16,  0, -4,  4,  0,  2, 16, 13,  0,  1,
+       -2, -1, -1,  0,  0,  6, -7,  2, -1,  0,  0,  0, -1,  0, -3, -2,
+        1, -5,  4,  5,  5,  5,  2, -2,  8,  8,  7,  8, -8,  0,  0, -1,
+        0,  0,  3,  3, -3, -2,  3, -3,  0,  3, -2,  2,  7,  6,  6, -6,
+        1, -1, -1, -1, -1,  1,  4,  4,  9,  1,  3, -4,  1,  2,  1,  1,
+        0,  1,  7,  7,  1,  2, -2,  3,  3,  2,  5,  8,  2,  4,  3, -3,
+       -3,  2,  2,  3, 15,  6,  2,  2,  2, -6, -2, 11,  1,  2,  7,  0,
+       -1,  9, -4,  1,  3,  5, -2,  3,  4, 10, -5,  0, 11,  4, -6,  4,
+       -1,  4,  2,  1, -4},
+   {
+      -16, 16,-16, -8,  0, -8,  8,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+        0,  0,  0,  0,  2,  2,  0,  0,  0,  0,-15,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  8, -8,  0,  0,  0,  0, -2, -2,
+        2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -2,  0,  0,  0,  0,  0, -4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -6,  0,  0,  0,  0,  0, -5,  0, -3,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0, -2,  0,  0,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,
+        0,  0,  0, -2,  0, -8,  0,  0,  0, 16,  8,  0,  2,  0,  0,  4,
+        0,  0,  0,  0,  0, -4,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  8},
+   {
+        4, -4,  4,  3,  0,  3, -3,  2,  2,  2, -2, -2,  0,  2, -2,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, -3, -1,  1,  1,
+        0,  0,  0,  0,  0,  0,  0, -2, -3,  3,  2, -2,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -3, -1, -1,  1,  1,  1,  1,  0,  2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,
+        2,  2,  0,  0,  0,  2,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  4,  3, -3,  0,  0,  0, -2,  0,  0, -1,  0,  0,  2,
+        0,  1,  0,  0,  2,  0,  0,  0,  0, -3,  0,  0, -2,  0,  0,  0,
+        0, -1, -1,  0,  0,  3,  0,  0,  0, -4, -3,  0,  0,  1,  0,  0,
+        0,  0,  0,  0, -2,  0,  0, -1,  0,  0,  0,  0,  0, -3,  0, -2,
+        0, -1, -2,  0, -3},
+   {
+        5, -5,  5,  0,  0,  0,  0, -5, -5, -5,  5,  5,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+       -1, -1,  1,  1,  1,  0,  0,  5,  0,  0, -5,  0,  0,  0,  0,  0,
+        0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -5,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0},
+   {
+        0,  2,  2,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,
+        2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  1,  2,  0,  0,  0,  0,  1,  0,  1,  0,  2,  0,  0,
+        0,  0,  0,  1,  2,  2,  0,  2,  2,  1,  0,  1,  0,  0,  1,  0,
+        1,  2,  0,  0,  0,  0,  1,  0,  2,  0,  0,  0,  2,  2,  1,  0,
+        1,  0,  1,  2,  2,  0,  1,  2,  2,  0,  0,  0,  0,  0,  0,  0,
+        2,  2,  2,  1,  2,  1,  0,  1,  2,  0,  2,  2,  0,  2,  1,  0,
+        2,  0,  2,  2,  2,  2,  0,  1,  2,  2,  2,  2,  2,  2,  2,  2,
+        2,  2,  0,  2,  2,  2,  2,  2,  2,  2,  0,  2,  2,  2,  0,  2,
+        2,  2,  0,  0,  0}};
+
+static const double K_PL_COEF[4][165] = {
+   {
+           1440.0,       56.0,      125.0,     -114.0,     -219.0,     -462.0,
+             99.0,       14.0,       31.0,     -491.0,    -3084.0,    -1444.0,
+            103.0,      -26.0,      284.0,      226.0,      -41.0,      425.0,
+           1200.0,      235.0,      266.0,     -460.0,        0.0,      -42.0,
+            -10.0,       78.0,       45.0,       89.0,     -349.0,      -53.0,
+            -21.0,       20.0,       32.0,      174.0,       11.0,      -66.0,
+             47.0,       46.0,      -68.0,       76.0,       84.0,      -82.0,
+            -73.0,     -439.0,       57.0,      -40.0,      273.0,     -449.0,
+             -8.0,        6.0,      -48.0,       51.0,     -133.0,      -18.0,
+             35.0,      -53.0,      -50.0,      -13.0,      -91.0,        6.0,
+             -6.0,       52.0,     -138.0,       54.0,      -37.0,     -145.0,
+            -10.0,       11.0,    -2150.0,       85.0,      -86.0,      -51.0,
+            -11.0,       31.0,      140.0,       57.0,      -14.0,      -25.0,
+             42.0,      -27.0,        9.0,    -1166.0,      117.0,        0.0,
+              0.0,       50.0,       30.0,        8.0,     -127.0,      -20.0,
+             22.0,      -68.0,        3.0,      490.0,      -22.0,      -46.0,
+             25.0,     1485.0,       -7.0,       30.0,      118.0,      -28.0,
+             14.0,     -458.0,        0.0,     -166.0,      -78.0,       -5.0,
+          -1223.0,     -368.0,      -75.0,      -13.0,      -74.0,     -262.0,
+            202.0,       -8.0,      -35.0,       12.0,     -598.0,        8.0,
+            113.0,       83.0,        0.0,      117.0,      393.0,       18.0,
+              8.0,       89.0,       54.0,        0.0,     -154.0,       80.0,
+             61.0,      123.0,        0.0,        7.0,      -89.0,        0.0,
+           -123.0,      -62.0,      -85.0,      163.0,      -63.0,      -21.0,
+              5.0,       74.0,       83.0,     -339.0,       67.0,       30.0,
+              0.0,      517.0,      143.0,       50.0,       59.0,      370.0,
+             34.0,      -37.0,       40.0,     -184.0,       31.0,       -3.0,
+            -34.0,      126.0,     -126.0},
+   {
+              0.0,     -117.0,      -43.0,        0.0,       89.0,     1604.0,
+              0.0,     -218.0,     -481.0,      128.0,     5123.0,     2409.0,
+            -60.0,      -29.0,        0.0,      101.0,      175.0,      212.0,
+            598.0,      334.0,      -78.0,     -435.0,      131.0,       20.0,
+            233.0,      -18.0,      -22.0,      -16.0,      -62.0,        0.0,
+            -78.0,      -70.0,       15.0,       84.0,       56.0,      -12.0,
+              8.0,       66.0,      -34.0,       17.0,      298.0,      292.0,
+             17.0,        0.0,      -28.0,       57.0,       80.0,      430.0,
+            -47.0,       47.0,     -110.0,      114.0,        0.0,     -436.0,
+             -7.0,       -9.0,      194.0,       52.0,      248.0,       49.0,
+            -47.0,       23.0,        0.0,        0.0,       35.0,       47.0,
+             40.0,      -49.0,        0.0,        0.0,      153.0,        0.0,
+           -268.0,        6.0,       27.0,       11.0,      -39.0,       22.0,
+            223.0,     -143.0,       49.0,        0.0,        0.0,       31.0,
+            -32.0,        0.0,       -3.0,      614.0,       21.0,       34.0,
+            -87.0,       39.0,       66.0,        0.0,       93.0,       14.0,
+            106.0,        0.0,      -32.0,       -6.0,        0.0,       36.0,
+            -59.0,        0.0,      -45.0,      269.0,       45.0,      328.0,
+            -26.0,        0.0,        0.0,      -30.0,        0.0,        0.0,
+              0.0,       35.0,      -48.0,       55.0,        0.0,      -31.0,
+              0.0,       15.0,     -114.0,        0.0,        3.0,      -29.0,
+             34.0,        0.0,      -15.0,       35.0,      -30.0,      -71.0,
+            -96.0,     -415.0,        0.0,      -32.0,        0.0,      -86.0,
+           -416.0,      -97.0,      -70.0,      -12.0,      -16.0,      -32.0,
+           -173.0,        0.0,        0.0,        0.0,      -91.0,      -18.0,
+           -114.0,       16.0,       -3.0,        0.0,        0.0,       -8.0,
+              0.0,       -7.0,        0.0,       -3.0,       -6.0,      -32.0,
+              0.0,      -63.0,      -63.0},
+   {
+              0.0,      -42.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,      117.0,     -257.0,        0.0,     2735.0,    -1286.0,
+              0.0,      -16.0,        0.0,        0.0,       76.0,     -133.0,
+            319.0,        0.0,        0.0,     -232.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -9.0,        0.0,        0.0,
+              0.0,      -37.0,       -8.0,       45.0,        0.0,       -6.0,
+              4.0,       35.0,      -18.0,        9.0,      159.0,      156.0,
+              9.0,        0.0,      -15.0,       30.0,       43.0,        0.0,
+            -25.0,       25.0,      -59.0,       61.0,        0.0,     -233.0,
+              0.0,       -5.0,      103.0,       28.0,        0.0,       26.0,
+            -25.0,       10.0,        0.0,        0.0,       19.0,        0.0,
+             21.0,      -26.0,        0.0,        0.0,        0.0,        0.0,
+           -116.0,        3.0,       14.0,        6.0,        0.0,        0.0,
+            119.0,      -77.0,       26.0,        0.0,        0.0,        0.0,
+            -17.0,        0.0,       -2.0,        0.0,        9.0,        0.0,
+              0.0,        0.0,       29.0,        0.0,       49.0,        0.0,
+             57.0,        0.0,      -17.0,       -2.0,        0.0,        0.0,
+            -31.0,        0.0,      -20.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       19.0,      -21.0,       29.0,        0.0,      -16.0,
+              0.0,        0.0,      -49.0,        0.0,        0.0,      -13.0,
+             18.0,        0.0,       -7.0,        0.0,      -13.0,      -31.0,
+            -42.0,     -180.0,        0.0,      -17.0,        0.0,      -19.0,
+           -180.0,      -42.0,      -31.0,       -5.0,       -7.0,      -14.0,
+            -75.0,        0.0,        0.0,        0.0,      -39.0,       -8.0,
+            -50.0,        7.0,       -1.0,        0.0,        0.0,        0.0,
+              0.0,       -3.0,        0.0,       -1.0,        0.0,      -14.0,
+              0.0,      -27.0,      -27.0},
+   {
+              0.0,      -40.0,      -54.0,       61.0,        0.0,        0.0,
+            -53.0,        8.0,      -17.0,        0.0,     1647.0,     -771.0,
+              0.0,       14.0,     -151.0,        0.0,       17.0,      269.0,
+           -641.0,        0.0,        0.0,      246.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,      -48.0,        0.0,        0.0,
+              0.0,      -11.0,       17.0,      -93.0,        0.0,       35.0,
+            -25.0,      -25.0,       36.0,      -41.0,      -45.0,       44.0,
+             39.0,        0.0,      -30.0,       21.0,     -146.0,        0.0,
+              4.0,       -3.0,       26.0,      -27.0,       57.0,        9.0,
+              0.0,       28.0,       27.0,        7.0,        0.0,       -3.0,
+              3.0,      -23.0,        0.0,      -29.0,       20.0,        0.0,
+              5.0,       -7.0,      932.0,      -37.0,        0.0,       22.0,
+              5.0,      -17.0,      -75.0,      -30.0,        0.0,        0.0,
+            -22.0,       14.0,       -5.0,      505.0,      -63.0,        0.0,
+              0.0,      -27.0,      -16.0,        0.0,       55.0,        0.0,
+              0.0,        0.0,       -1.0,     -213.0,       12.0,        0.0,
+            -13.0,        0.0,        4.0,      -13.0,      -52.0,        0.0,
+             -8.0,      198.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       32.0,      114.0,
+            -87.0,        5.0,       15.0,       -6.0,        0.0,       -4.0,
+            -49.0,        0.0,        0.0,      -51.0,        0.0,       -8.0,
+             -4.0,        0.0,      -24.0,        0.0,       67.0,      -35.0,
+            -27.0,      -53.0,      -35.0,       -4.0,       38.0,       -6.0,
+             53.0,       27.0,       37.0,      -72.0,       28.0,        9.0,
+             -2.0,      -32.0,        0.0,      147.0,      -29.0,      -13.0,
+              0.0,     -224.0,      -62.0,      -22.0,        0.0,     -160.0,
+            -15.0,       16.0,        0.0,       80.0,      -13.0,        1.0,
+              0.0,      -55.0,       55.0}};
+
+/*
+   IAU 2000A series for 'iau2000a_trunc': the columns of 'A_LS_MULT',
+   'A_LS_COEF', 'A_PL_MULT' and 'A_PL_COEF' in decreasing order of
+   amplitude, and the number of luni-solar terms among the first k
+   terms of both series merged in that order.
+*/
+
+static const signed char TRUNC_LS_MULT[5][678] = {
+   {
+        0,  0,  0,  0,  0,  1,  0,  0,  1,  0, -1,  0, -1,  0,  1, -1,
+       -1,  1, -2, -2,  0,  0,  2,  2,  1,  0,  0, -1,  0,  0, -1,  0,
+        1,  0, -2, -1,  1,  0, -1,  0,  0,  1,  2,  0,  1, -2,  2,  0,
+        0,  1, -1,  0,  0,  2, -1,  0,  1,  1, -1, -2,  3,  1, -1,  0,
+        1, -2,  2, -1,  0,  1,  0,  3, -1, -1, -2, -1,  1, -1,  1, -2,
+        0,  0, -2, -1,  2, -1, -1,  2, -2,  1, -1,  3,  0,  0,  0,  0,
+       -1, -1,  0,  2,  0,  0,  0,  0,  0,  0, -1, -1,  1,  0,  2,  1,
+        1, -1,  0,  0,  1,  3,  0, -1,  1,  2, -1,  0, -1,  1,  0,  0,
+        1,  0,  2, -1,  0,  2, -1,  1,  1, -1,  1,  2,  0,  1, -1,  1,
+        0,  1, -1,  2,  0, -1,  0, -1,  4,  1,  2,  0,  1,  1, -2, -1,
+       -2,  0,  0, -1, -2,  0, -1,  2,  0, -1,  0,  1, -1, -2,  1,  0,
+       -3, -1,  0,  0,  0, -1,  3,  1,  0,  3, -2,  0,  0, -2,  0,  0,
+       -3, -2,  2,  4, -1, -2,  0,  1, -1, -1, -1,  2,  2,  2,  1,  1,
+       -2, -1, -2,  0,  0,  0,  4, -1,  0,  0,  2,  2, -1, -2,  0,  1,
+       -1,  0, -1, -1,  3, -2,  2,  1,  1, -2, -3, -2,  2, -1, -1,  0,
+        0,  1,  1,  2, -1,  0,  2, -1, -2,  3, -1,  1,  0,  1,  1, -2,
+        1, -2, -1,  1,  3,  2,  1, -2,  0,  3,  0,  0, -1,  2,  1,  2,
+       -2,  1,  0,  1,  4,  0, -2,  0, -3,  1, -2, -2,  0,  2,  1,  1,
+        1, -2,  2, -1, -2,  1,  2,  0,  1,  0, -1, -1,  2,  0, -1,  1,
+       -1,  1,  0, -1,  2,  1,  3,  0,  1, -1, -1,  0,  1, -1,  0, -1,
+        1,  3,  0, -2,  1, -2, -1,  2,  3,  0, -1, -1, -2, -1,  0, -2,
+        2,  0, -3,  2,  3,  0,  1,  2, -1, -3,  1,  1,  3,  1,  1,  3,
+       -2, -3,  5,  1,  1, -2,  1, -1,  1,  0,  2,  0,  0,  1, -2, -4,
+       -1,  2,  0, -3, -1,  1,  1, -2, -2, -3,  0,  1, -1,  0,  4,  0,
+        0, -1, -1,  0,  1,  0, -3, -2,  0, -1, -1, -1,  0,  2,  0,  0,
+       -2,  0,  0, -2,  1,  4,  3,  1,  0, -3, -3, -1,  1,  0,  1, -1,
+       -1,  0,  0,  1, -1, -2,  1,  1,  0, -1,  0,  0,  3,  3,  3, -4,
+        1,  2,  1, -3,  1, -1, -1,  0, -1, -3,  0,  2, -4,  2,  1, -2,
+       -2, -2,  0,  0, -1,  5,  1,  0,  2,  0,  1,  1, -1, -2,  2,  2,
+       -1, -2,  0,  0, -1,  0,  0,  1,  1,  0,  2,  3,  3,  0,  0,  2,
+       -1, -4,  0, -1, -2,  1, -2,  1, -1, -1, -3, -1, -1,  2,  0,  4,
+       -1,  1,  0,  1,  3,  0,  1, -3,  1,  2, -2,  0, -1,  1,  0, -1,
+        2, -2, -2,  0,  1,  0,  2,  5,  2,  0, -2,  4,  1,  2, -4,  1,
+       -1, -2,  2,  0, -1,  0, -1, -1,  1, -3, -2, -2,  2,  3, -1,  0,
+        2,  0,  0, -2, -1,  0,  0, -1,  0,  1,  1,  2, -1,  0, -2,  0,
+        0,  4,  0, -2,  0,  0, -2, -1,  2,  0,  0, -1,  2, -1, -3, -1,
+        0,  0, -2,  2, -1,  1, -1,  2,  1,  2, -3, -2, -3, -1,  3,  2,
+        0,  3, -2,  2,  0,  1, -1,  2,  0,  1,  3, -1, -1,  3,  2,  2,
+        4,  3, -1, -1,  1, -1, -3, -2,  2, -4, -3,  2, -1,  1, -1, -2,
+        1, -3, -1, -3,  2,  2, -4, -2, -2,  1, -1,  1,  2,  0,  0, -1,
+       -2, -1,  1,  1, -2, -1, -1, -2,  0,  0, -1, -3, -3,  0,  1, -2,
+        1,  2,  1,  2,  3,  1,  2,  4, -1, -3, -3,  1, -2,  1,  2,  1,
+        3,  5,  2,  2,  0, -2},
+   {
+        0,  0,  0,  0,  1,  0,  1,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  2,  2,  0,  1,
+        0, -1,  0,  0,  0,  1, -1, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+       -1, -1,  0, -1,  0,  0,  0,  1,  1,  0,  1,  0,  0, -1, -1, -1,
+        1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,
+       -2,  0,  0,  0,  0,  0,  0,  0, -1,  0,  1,  0,  0,  1,  0,  1,
+        0, -1,  1,  0,  0,  0,  1,  0, -1, -1,  0,  1, -1, -1,  0,  1,
+        0,  1,  1,  1, -1,  0,  0,  0, -1, -1, -1,  0,  1,  0, -1,  3,
+       -1,  0,  1,  0,  0, -1,  0,  1,  1,  0,  0,  0,  1,  0,  0,  0,
+        0,  0,  1,  1,  0, -2,  3,  0,  0,  0,  1,  1,  1,  0,  0,  0,
+        2,  0, -2, -1,  0,  1,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,
+        0, -1, -1,  0,  0, -1,  0,  1,  0,  0, -1, -2,  0,  0,  0,  0,
+        0, -1,  0,  0,  1, -1,  0,  1,  1, -2,  0,  0,  0,  0,  0, -1,
+        1,  1, -1,  2, -1,  2,  0,  0, -2, -1, -1,  0,  0,  0,  2, -2,
+        1,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0, -1,  2,  0,  0,
+        2, -1,  0,  0, -1, -1,  1, -1, -1, -1,  0, -1, -2,  0,  0,  0,
+        0,  0,  1,  1,  1, -1, -2,  0,  1,  0, -1,  1, -1,  0,  1, -1,
+        0,  1, -1,  2,  0,  0, -1,  0,  0,  0,  0,  0,  1,  1,  0, -1,
+        0,  2, -1,  0,  0, -1,  0,  0,  0,  1,  1, -1, -1,  0,  2,  2,
+        0, -1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0, -2,  1,  0, -1,
+        1,  0,  0,  1,  0,  1, -1,  0, -1, -1,  0, -2,  0, -1,  0,  1,
+        0, -1,  0,  1,  0,  0, -2,  0,  1,  0,  0, -1,  0,  1,  0,  1,
+        0,  0,  0, -2,  2, -1, -1,  1, -1, -2,  0, -1, -1,  2, -2,  0,
+       -1,  1,  1,  0,  0,  0,  1, -1,  1,  0,  1, -1,  1,  0,  0, -2,
+        2,  0, -1, -1,  0,  1,  0,  0, -1,  0,  0,  0, -1, -1,  0, -1,
+        1,  0,  0,  0,  0,  0,  0,  1,  0, -1,  0, -2,  1,  0,  1,  0,
+        0,  0, -1,  0,  0,  0,  0, -2,  1, -1,  0, -1, -1,  0, -1,  0,
+        0,  1, -1,  1, -1,  0,  1, -1, -2,  0,  1,  0,  0,  1,  0, -1,
+        0,  0,  0,  0, -2,  0,  1,  0,  0,  0,  0, -2,  2, -1,  0, -2,
+        1,  1,  1,  0, -3, -3, -2,  0,  2,  2,  0,  0, -1,  0,  0,  2,
+       -1,  0,  3,  0,  1,  1,  0,  1,  1, -1,  0,  2, -1, -2,  2,  0,
+        0,  1,  0,  1,  1,  0,  0,  0, -2,  1, -2,  1,  1, -2,  1,  0,
+       -1, -2,  0,  2, -1,  1,  0,  0,  1, -2,  0, -1,  0, -2,  1,  0,
+        0, -1,  1,  0,  2,  0, -1,  1,  0,  0,  1,  0,  0,  0,  1,  0,
+       -1,  1,  0,  0,  2, -2, -3, -1,  1, -1,  0,  0,  0,  0, -1,  0,
+        0,  1, -2,  2, -2,  2,  0,  2,  0,  1, -1,  0,  0, -1,  0,  0,
+        0,  0,  0,  0,  0, -1,  0, -2,  1,  0,  0,  1,  0,  1,  0,  1,
+        0,  1, -1, -1,  0,  0,  0, -1,  1, -2, -1,  1,  0,  0,  0, -2,
+        0,  0, -1,  0,  1, -1,  0, -1, -1,  0,  1, -1,  2, -1,  1, -2,
+        2,  1, -1, -1,  0,  0,  0,  0, -1,  0,  0,  0,  1,  1,  1,  0,
+       -1,  1,  0,  2,  0,  0, -1,  1, -1,  0, -3,  0,  0,  0,  2,  0,
+        0,  1,  0,  0,  0,  0,  1,  1, -1, -1,  0, -1,  0,  0,  1, -1,
+        1,  0, -1,  0, -2,  0},
+   {
+        0,  2,  2,  0,  0,  0,  2,  2,  2,  2,  0,  2,  2,  0,  0,  2,
+        0,  2,  0,  2,  2,  2,  2,  0,  2,  2, -2,  2,  0,  2,  0,  0,
+        0,  0,  2,  2,  2,  2,  0,  2,  2,  0,  2,  0,  2,  0,  2,  0,
+        2,  0,  0,  0,  0,  0,  2,  2,  0,  2,  0,  2,  2,  2,  2,  2,
+        2,  0,  0,  2,  1,  0,  2,  0,  2,  0,  2,  0,  2,  0,  2,  0,
+        2,  2,  2,  4,  2,  0,  1,  2,  0,  0,  0,  2,  4, -2, -2,  2,
+       -2,  0,  0, -2,  2,  2,  0, -2,  2, -2,  2,  0,  2,  0,  0,  0,
+       -2,  2,  0,  2,  0,  2,  0,  0,  0,  2,  2,  0,  2,  2,  2,  2,
+        2,  2,  2,  0,  0,  0,  1,  0,  2,  2,  2,  2,  0,  2,  1,  0,
+        0,  0,  0,  0,  2,  0,  0,  2,  2, -2,  2,  2,  2,  4,  2,  2,
+        0,  0,  0,  0,  2,  0,  4,  2,  2,  0,  4,  0,  2,  0,  2,  1,
+        0,  2,  0,  0,  2,  0,  2,  2,  4,  2,  0,  2,  2,  0,  2,  0,
+        0,  0,  0,  2,  0,  2,  2,  0,  2,  2,  0,  0,  0,  2,  0,  2,
+        0,  2,  2,  0,  2, -2,  0,  4,  2,  2,  2,  0,  2, -2,  2,  0,
+        2,  2,  2, -2,  0,  2,  0,  0,  2,  4,  2,  2,  2,  0, -2,  1,
+        2,  2,  2,  2,  2,  0,  2,  2,  2,  2,  1,  0,  0, -2,  2,  2,
+        2,  0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  2,  2,  2,  0,  0,
+        4,  2,  0,  2,  2,  4,  2,  4,  2,  2,  2,  0,  2,  2,  2,  2,
+        4,  0,  0, -2,  0,  0,  4,  2, -2,  4,  0,  0,  0,  0,  2,  0,
+        0, -2, -2,  2,  2,  0,  2,  4,  0,  4,  2,  2,  2,  2, -2,  2,
+       -2,  2,  1,  0,  2,  2, -2, -2,  0, -2,  0,  0, -2,  2,  2,  2,
+        2,  2,  2,  2,  2,  3,  0,  0,  2,  2,  4,  2,  2,  2,  0,  0,
+        0,  2,  2,  2,  0,  0,  2,  0,  2,  2, -2,  2,  0,  2,  0,  0,
+        0,  0,  2,  0,  4,  0,  2,  2,  2,  2,  2,  0,  2,  2,  2, -2,
+        0,  2,  2,  4, -2,  2,  0,  2,  0,  2,  0,  2,  2,  2,  2,  2,
+        0,  4,  0,  2,  2,  2,  0,  0,  4,  0,  0,  2,  0,  0,  0,  0,
+        0,  2,  0,  1,  4,  2,  0,  2,  0,  0, -2,  2,  2,  0,  2,  0,
+        1,  0,  0,  2,  2,  2,  0,  2,  0, -2,  0,  2,  2,  0,  4,  0,
+        4, -2,  0,  4,  2,  2, -2,  3,  0, -2,  0,  0,  2,  2,  0,  2,
+        2,  0,  0, -2,  0,  0,  2,  1,  2,  2,  2,  2,  2,  0, -4,  2,
+        0,  0,  2, -2,  2,  0,  4,  2, -2, -2,  2,  0,  0,  0,  0,  2,
+        0,  4,  0,  2,  2,  2,  2,  0,  0,  2,  0,  0,  0,  2,  0,  2,
+        2,  2,  4,  2,  2,  2,  2,  0,  2,  2,  2,  2, -1,  0,  2, -2,
+       -1,  0, -2,  1,  0,  0,  2,  0, -2,  0,  2,  0,  0,  0,  4, -2,
+        2,  4,  2,  2,  2,  0,  2,  2,  0,  2,  3,  4,  0,  2,  2,  0,
+        4,  2,  2,  0,  0,  0,  4,  2,  0,  2,  2,  0, -2,  0,  0, -2,
+       -2,  2,  2,  2,  0,  0,  0,  2,  0,  4,  2,  0,  0,  2,  0,  0,
+        2,  2,  0,  0,  2,  2,  2,  2,  2,  2,  0,  2,  4,  4,  0,  2,
+        0,  2,  2,  2,  2,  2,  2,  2, -2,  2,  0,  0,  0,  2,  2,  0,
+        2,  0,  0,  0,  2,  0,  2, -2, -2,  2,  2,  0,  2,  4,  4, -2,
+        0,  0,  2,  0,  0,  1,  2,  2,  4,  4,  2,  2,  0,  0,  2,  0,
+        0,  0,  2,  2,  2,  2,  2,  2,  0,  2,  2,  0,  2,  4,  2,  2,
+        2,  2,  2,  2,  0, -2},
+   {
+        0, -2,  0,  0,  0,  0, -2,  0,  0, -2,  2, -2,  0,  2,  0,  2,
+        0,  0,  2,  0,  2, -2,  0,  0, -2,  0,  2,  0,  0, -2,  2,  0,
+       -2,  0,  0,  2,  2,  0,  2,  0,  2,  2, -2,  2, -2,  2,  0, -2,
+       -2,  0,  1,  2,  1, -2,  0, -2,  0,  0,  1,  0,  0,  0,  2,  2,
+        0,  0,  0, -2, -1,  0,  1,  0,  4,  0,  2,  4,  2,  1, -2,  4,
+       -2, -2,  4,  0,  2,  1,  0, -2,  2,  2,  2, -2, -2,  2,  2,  0,
+        2,  2,  0,  0, -1,  4,  2,  0,  0,  2,  2,  1,  2,  0,  2, -2,
+        2,  2,  1,  2,  0,  0,  4, -2,  2,  0,  2,  2,  0, -4,  2, -2,
+        0,  2,  0,  2,  1,  0,  0,  0,  0, -2,  1,  0, -2, -1,  0,  1,
+       -1, -2,  0,  0,  1,  2,  0,  4,  0,  0, -2,  1, -2, -2,  2, -1,
+        2,  0,  2,  0,  4,  2,  0,  2, -3,  4,  0, -1,  4,  2,  4,  0,
+        4,  0,  2,  4, -4,  4, -2,  2, -2,  2,  2,  2,  0,  4,  4, -2,
+        0,  4,  2, -2,  2,  4, -1,  2, -2,  2,  3, -4, -2, -4, -4,  2,
+        2,  0,  0,  0, -1,  2,  0, -2,  0,  4,  2,  0,  3,  2, -2,  0,
+        2,  2,  1,  0,  0,  0, -2,  4,  2,  0,  0, -2,  0,  2,  4,  0,
+        0, -2, -4, -1, -1,  4,  0,  0,  2,  0,  0, -2,  0,  1, -3,  2,
+        1,  0,  2,  1,  0, -2,  0,  3,  1,  2, -1, -2, -2,  1,  1,  2,
+        2, -4, -2, -2,  0, -4,  0, -4,  2, -3,  6, -2,  1, -2, -1, -2,
+       -2,  2, -2,  2,  1,  2, -2,  3,  2, -2, -2,  1,  0, -4,  2,  0,
+        1,  2,  2, -1, -4,  2, -2,  0,  4,  2,  6, -4,  2,  4,  1,  4,
+        1,  0,  0,  0,  4,  0,  2,  2,  0,  2, -1,  2,  4,  2, -3,  2,
+        4,  2,  2,  2, -4,  0,  2,  1, -2,  0,  0,  4,  2,  2,  2,  0,
+        6,  6,  0, -2, -2,  0, -1,  4,  0,  2,  0, -2,  2,  0,  2,  2,
+        2,  0,  0,  4, -2,  1,  0,  4,  4,  0, -4,  0,  0,  1, -2,  2,
+       -2, -4,  0, -2, -2,  4,  2, -2,  4,  3,  6,  4,  4,  2, -2, -1,
+        4, -2,  3,  3,  0,  2, -4, -2, -4,  4,  6,  2, -4,  1,  0,  4,
+       -2,  6,  1,  0,  0,  4, -1, -2,  2,  4, -2,  1, -2,  2,  2,  4,
+       -2,  2,  4,  1, -4,  0,  3,  0,  4,  2,  4,  2,  2, -4, -4,  4,
+        0,  0,  3, -1,  4, -2,  2,  0,  4,  2, -3,  0,  0,  2,  2,  0,
+        3,  1, -2,  0,  2,  2,  0,  0, -2,  0, -1, -1,  0, -1,  2, -2,
+       -2,  0, -2,  3,  0, -1, -2, -4,  2,  4,  2,  2,  3,  0,  2, -4,
+       -4, -2,  4,  1,  0,  4,  3,  3, -2, -4,  4, -4,  4,  0,  3,  2,
+       -1,  4,  2,  2,  2,  3,  1,  0,  1,  4,  6,  0,  0, -2,  2,  1,
+        2,  2,  0, -1,  0, -2, -2,  0,  0,  2, -2,  3, -1, -2, -2,  4,
+       -2, -2,  2,  2,  2,  4,  2,  3,  4,  1,  0, -2,  6,  3,  6,  6,
+        2,  0, -2,  2,  0,  0, -2, -2, -3, -4, -4, -2, -2, -1,  1,  1,
+        3,  0,  0, -3,  3,  1,  2, -2,  1, -4, -2, -2, -2,  2,  0,  1,
+        0, -2,  6,  2,  2,  2,  2,  0,  2,  2,  2,  4,  2, -2,  4,  2,
+        2,  1,  6,  6,  4, -1,  1,  0,  0,  2,  3, -2,  1, -3, -1,  2,
+       -4,  2,  0,  2, -6, -4,  0,  2,  2, -6, -4, -4, -4, -4, -4,  4,
+        3,  2, -2,  0,  4,  2,  1,  2, -2, -2,  2,  4,  0,  3,  0,  6,
+        3,  2,  1,  0,  0,  0,  0, -2,  6,  6,  6,  4,  5,  0,  2,  4,
+        2,  0,  4,  4,  0,  4},
+   {
+        1,  2,  2,  2,  0,  0,  2,  1,  2,  2,  0,  1,  2,  0,  1,  2,
+        1,  1,  0,  1,  2,  2,  2,  0,  2,  0,  0,  1,  0,  2,  1,  1,
+        1,  1,  0,  1,  2,  2,  0,  2,  1,  0,  2,  1,  1,  1,  1,  1,
+        1,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  2,  2,  2,  2,  2,
+        2,  1,  1,  1,  1,  2,  2,  0,  2,  2,  2,  0,  1,  1,  2,  0,
+        1,  3,  2,  2,  2,  1,  1,  1,  0,  1,  0,  2,  2,  0,  1,  1,
+        0,  1,  2,  1,  2,  2,  0,  1,  1,  0,  0,  2,  2,  2,  0,  1,
+        0,  2,  0,  2,  1,  1,  0,  1,  0,  2,  1,  2,  2,  1,  1,  2,
+        1,  0,  2,  2,  1,  0,  2,  1,  1,  2,  2,  0,  1,  2,  0,  0,
+        1,  2,  1,  0,  1,  0,  0,  1,  2,  1,  2,  2,  1,  2,  1,  1,
+        0,  3,  0,  1,  1,  1,  1,  1,  2,  1,  2,  1,  2,  2,  2,  1,
+        0,  2,  1,  1,  1,  0,  1,  2,  1,  2,  1,  2,  3,  1,  1,  2,
+        1,  0,  1,  2,  1,  2,  1,  0,  1,  2,  0,  1,  2,  1,  1,  1,
+        0,  1,  1,  1,  2,  0,  0,  2,  2,  2,  2,  2,  2,  0,  1,  0,
+        1,  1,  2,  1,  1,  1,  1,  0,  0,  2,  1,  1,  1,  0,  0,  0,
+        2,  2,  2,  2,  1,  0,  1,  1,  2,  2,  3,  1,  1,  0,  2,  0,
+        1,  2,  2,  2,  2,  2,  2,  0,  1,  0,  1,  3,  1,  2,  0,  0,
+        2,  1,  1,  2,  1,  4,  0,  2,  2,  1,  2,  1,  1,  1,  1,  1,
+        1,  1,  1,  1,  0,  1,  2,  2,  1,  2,  1,  0,  1,  1,  2,  0,
+        2,  0,  1,  2,  2,  1,  2,  1,  1,  2,  2,  2,  2,  2,  0,  1,
+        0,  0,  2,  1,  1,  0,  0,  0,  0,  1,  1,  1,  0,  0,  1,  2,
+        2,  0,  1,  2,  2,  3,  0,  0,  2,  0,  2,  2,  1,  1,  2,  0,
+        0,  2,  2,  1,  1,  1,  2,  0,  0,  1,  2,  3,  2,  2,  0,  0,
+        2,  1,  0,  1,  1,  1,  0,  1,  2,  2,  1,  2,  0,  0,  1,  0,
+        1,  1,  0,  2,  1,  2,  1,  2,  1,  1,  0,  0,  1,  1,  4,  1,
+        0,  4,  0,  2,  3,  2,  1,  2,  1,  0,  0,  1,  1,  2,  2,  2,
+        2,  2,  0,  1,  0,  0,  2,  2,  2,  1,  1,  2,  2,  1,  2,  0,
+        1,  0,  0,  2,  1,  3,  0,  0,  0,  0,  0,  0,  1,  1,  2,  1,
+        1,  1,  1,  2,  2,  2,  0,  2,  0,  2,  1,  1,  2,  1,  2,  2,
+        2,  0,  2,  2,  0,  0,  1,  0,  1,  1,  1,  2,  1,  2,  0,  2,
+        1,  1,  2,  0,  2,  1,  2,  2,  0,  0,  0,  1,  0,  0,  0,  2,
+        1,  2,  2,  1,  1,  0,  2,  0,  1,  1,  0,  1,  1,  1,  0,  3,
+        2,  2,  1,  2,  0,  2,  1,  0,  2,  2,  1,  2,  1,  1,  2,  1,
+        0,  2,  1,  0,  1,  0,  2,  2,  2,  0,  1,  1,  1,  1,  2,  0,
+        1,  1,  2,  2,  1,  0,  2,  2,  1,  2,  3,  1,  1,  1,  2,  0,
+        2,  2,  3,  2,  2,  2,  1,  1,  1,  2,  1,  0,  1,  1,  0,  0,
+        0,  2,  2,  2,  1,  0,  0,  2,  1,  2,  1,  1,  1,  0,  2,  0,
+        1,  1,  0,  1,  3,  2,  2,  0,  0,  1,  0,  1,  1,  2,  1,  2,
+        0,  2,  2,  1,  2,  2,  1,  2,  1,  0,  0,  2,  0,  1,  1,  1,
+        1,  0,  2,  0,  1,  2,  1,  1,  0,  1,  2,  2,  2,  4,  2,  1,
+        0,  2,  3,  1,  2,  1,  2,  1,  1,  3,  2,  2,  2,  2,  1,  1,
+        0,  1,  0,  3,  2,  2,  0,  2,  0,  2,  1,  1,  2,  1,  1,  1,
+        2,  1,  2,  1,  2,  0}};
+
+static const double TRUNC_LS_COEF[6][678] = {
+   {
+      -172064161.0,-13170906.0, -2276413.0,  2074554.0,  1475877.0,   711159.0,
+        -516821.0,  -387298.0,  -301461.0,   215829.0,   156994.0,   128227.0,
+         123457.0,    63384.0,    63110.0,   -59641.0,   -57976.0,   -51613.0,
+         -47722.0,    45893.0,   -38571.0,    32481.0,   -31046.0,    29243.0,
+          28593.0,    25887.0,    21783.0,    20441.0,    16707.0,   -15794.0,
+          15164.0,   -14053.0,   -12873.0,   -12654.0,   -11024.0,   -10204.0,
+          -7691.0,     7566.0,     7350.0,    -7141.0,    -6637.0,     6579.0,
+           6443.0,    -6302.0,     5800.0,    -5774.0,    -5350.0,    -4940.0,
+          -4752.0,     4725.0,     4026.0,     4348.0,    -4230.0,     4065.0,
+          -4056.0,     3579.0,    -3389.0,     3339.0,     3276.0,    -3075.0,
+          -2904.0,    -2878.0,    -2819.0,    -2647.0,     2481.0,    -2294.0,
+           2179.0,    -1987.0,        0.0,    -1981.0,     1660.0,     1575.0,
+          -1521.0,     1405.0,     1383.0,     1338.0,    -1331.0,     1314.0,
+           1290.0,     1282.0,    -1283.0,     1248.0,    -1214.0,     1146.0,
+          -1100.0,     1020.0,        0.0,     1019.0,    -1014.0,     -970.0,
+           -949.0,      934.0,      922.0,     -875.0,      834.0,      815.0,
+            766.0,      742.0,      715.0,      716.0,     -704.0,     -694.0,
+           -673.0,     -666.0,     -667.0,      658.0,      639.0,     -595.0,
+           -590.0,      591.0,      588.0,     -585.0,     -578.0,      570.0,
+            565.0,      535.0,      528.0,     -502.0,      494.0,     -492.0,
+            493.0,     -488.0,     -467.0,     -468.0,      463.0,     -453.0,
+           -446.0,     -438.0,     -421.0,      416.0,      412.0,     -396.0,
+           -390.0,      375.0,        0.0,     -361.0,      360.0,      357.0,
+            337.0,      335.0,     -335.0,     -334.0,        0.0,     -325.0,
+            321.0,      309.0,     -301.0,     -286.0,      280.0,      276.0,
+            276.0,     -263.0,     -259.0,      253.0,      252.0,     -245.0,
+            245.0,      243.0,      231.0,     -229.0,     -228.0,     -219.0,
+            213.0,      208.0,     -208.0,      199.0,      197.0,     -192.0,
+           -188.0,     -187.0,      186.0,      159.0,     -174.0,      175.0,
+           -163.0,        0.0,      161.0,     -159.0,     -156.0,     -154.0,
+           -153.0,      151.0,      147.0,      144.0,      141.0,     -134.0,
+           -132.0,     -129.0,      128.0,      123.0,     -121.0,      120.0,
+           -118.0,      115.0,     -114.0,      113.0,     -113.0,     -110.0,
+           -106.0,     -103.0,     -105.0,     -104.0,     -103.0,     -102.0,
+           -102.0,      101.0,     -100.0,     -100.0,       92.0,       96.0,
+             91.0,      -94.0,       94.0,      -94.0,       94.0,      -93.0,
+            -83.0,      -92.0,      -92.0,      -91.0,       91.0,       88.0,
+             87.0,       85.0,       84.0,       84.0,       83.0,      -83.0,
+             83.0,       82.0,       82.0,       82.0,       81.0,      -79.0,
+            -78.0,      -77.0,      -77.0,      -74.0,      -75.0,        0.0,
+             74.0,      -73.0,       71.0,      -69.0,       68.0,       65.0,
+             64.0,      -63.0,       63.0,      -63.0,        0.0,       62.0,
+            -61.0,      -61.0,      -60.0,      -60.0,       57.0,       56.0,
+              2.0,      -53.0,       53.0,       51.0,      -51.0,      -51.0,
+             49.0,       49.0,      -48.0,       48.0,       47.0,       47.0,
+             47.0,       47.0,       46.0,      -45.0,       45.0,       45.0,
+            -45.0,       45.0,      -44.0,      -44.0,       44.0,      -43.0,
+            -43.0,      -42.0,      -42.0,       41.0,      -40.0,      -39.0,
+             39.0,      -38.0,      -38.0,       38.0,      -38.0,      -37.0,
+             37.0,       37.0,      -36.0,       36.0,      -36.0,      -36.0,
+             35.0,      -35.0,       35.0,      -35.0,      -34.0,      -34.0,
+            -33.0,      -33.0,      -32.0,       32.0,       32.0,       32.0,
+            -32.0,       32.0,      -32.0,       31.0,      -31.0,       31.0,
+            -31.0,      -30.0,       30.0,       30.0,        0.0,      -29.0,
+            -29.0,      -29.0,       29.0,      -29.0,       29.0,       28.0,
+             28.0,       28.0,       28.0,       28.0,       27.0,      -27.0,
+            -27.0,       27.0,       26.0,       26.0,      -26.0,        0.0,
+             25.0,      -25.0,       24.0,       24.0,       24.0,      -24.0,
+            -24.0,       23.0,       23.0,      -23.0,       23.0,      -23.0,
+            -23.0,       10.0,      -22.0,       22.0,       22.0,      -22.0,
+             22.0,      -22.0,      -21.0,      -21.0,      -21.0,       21.0,
+            -20.0,       20.0,      -20.0,      -20.0,      -20.0,       19.0,
+            -19.0,      -19.0,      -19.0,      -19.0,       19.0,       18.0,
+            -18.0,      -18.0,      -18.0,      -18.0,       18.0,       17.0,
+            -17.0,      -17.0,       17.0,      -17.0,      -17.0,       17.0,
+            -16.0,       16.0,      -16.0,       16.0,       16.0,       16.0,
+            -16.0,      -16.0,      -15.0,       15.0,      -15.0,       15.0,
+            -15.0,       15.0,       15.0,      -15.0,      -14.0,       14.0,
+            -14.0,       14.0,       14.0,      -14.0,      -13.0,       13.0,
+             13.0,      -13.0,       13.0,      -13.0,      -13.0,        0.0,
+            -13.0,       13.0,      -12.0,      -12.0,       12.0,      -12.0,
+            -12.0,       12.0,       12.0,      -12.0,      -12.0,      -12.0,
+              0.0,      -12.0,       12.0,      -11.0,       11.0,      -11.0,
+             11.0,       11.0,       11.0,       11.0,      -11.0,       11.0,
+            -10.0,      -10.0,      -10.0,       10.0,      -10.0,      -10.0,
+             10.0,      -10.0,      -10.0,       10.0,       10.0,        0.0,
+             10.0,       -9.0,        9.0,        9.0,        9.0,        9.0,
+              9.0,       -9.0,       -9.0,        9.0,        9.0,        9.0,
+              9.0,        9.0,       -6.0,        3.0,        8.0,        8.0,
+             -8.0,       -8.0,       -8.0,       -8.0,        8.0,        8.0,
+              8.0,       -8.0,        0.0,       -7.0,       -7.0,        7.0,
+             -7.0,        7.0,       -7.0,       -7.0,       -7.0,       -7.0,
+             -7.0,        7.0,       -7.0,       -7.0,       -7.0,        7.0,
+             -7.0,       -7.0,        7.0,        7.0,        7.0,        6.0,
+              6.0,        6.0,        6.0,       -6.0,        6.0,       -6.0,
+              6.0,        6.0,        6.0,       -6.0,        6.0,        6.0,
+              6.0,       -6.0,        6.0,        6.0,       -6.0,       -6.0,
+             -6.0,       -6.0,        0.0,        5.0,        5.0,       -5.0,
+              0.0,        5.0,        5.0,       -5.0,       -5.0,        5.0,
+             -5.0,        5.0,       -5.0,        5.0,       -5.0,       -5.0,
+              5.0,        5.0,       -5.0,        5.0,        5.0,        5.0,
+              5.0,       -5.0,        5.0,        5.0,       -5.0,        5.0,
+              5.0,        5.0,        0.0,        5.0,       -5.0,        5.0,
+             -5.0,        5.0,        5.0,        5.0,       -4.0,        4.0,
+              4.0,        4.0,       -4.0,       -4.0,        4.0,        4.0,
+              4.0,        4.0,        4.0,       -4.0,       -4.0,       -4.0,
+             -4.0,       -4.0,        4.0,       -4.0,       -4.0,       -4.0,
+              4.0,       -1.0,        4.0,       -4.0,       -4.0,       -4.0,
+             -4.0,       -4.0,       -4.0,        4.0,       -4.0,        4.0,
+              4.0,       -4.0,        4.0,        4.0,       -4.0,        4.0,
+             -4.0,       -4.0,        4.0,        4.0,        4.0,        4.0,
+             -4.0,       -4.0,        4.0,        4.0,       -4.0,       -4.0,
+              4.0,       -3.0,        3.0,       -3.0,        3.0,        3.0,
+              3.0,        3.0,        3.0,        3.0,       -3.0,       -3.0,
+             -3.0,        3.0,       -3.0,        3.0,       -3.0,        3.0,
+             -3.0,        3.0,        3.0,       -3.0,        3.0,        3.0,
+             -3.0,        3.0,       -3.0,       -3.0,       -3.0,        3.0,
+             -3.0,       -3.0,       -3.0,        0.0,        3.0,       -3.0,
+             -3.0,        3.0,       -3.0,        3.0,        3.0,        3.0,
+              3.0,       -3.0,       -3.0,        3.0,       -3.0,        3.0,
+              3.0,       -3.0,       -3.0,        3.0,        3.0,       -3.0,
+             -3.0,       -3.0,        3.0,        3.0,        3.0,       -3.0,
+              3.0,       -3.0,       -3.0,       -3.0,        0.0,        0.0},
+   {
+        -174666.0,    -1675.0,     -234.0,      207.0,    -3633.0,       73.0,
+           1226.0,     -367.0,      -36.0,     -494.0,       10.0,      137.0,
+             11.0,       11.0,       63.0,      -11.0,      -63.0,      -42.0,
+              0.0,       50.0,       -1.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,       21.0,      -85.0,       72.0,
+             10.0,      -25.0,      -10.0,       11.0,        0.0,        0.0,
+              0.0,      -21.0,        0.0,       21.0,      -11.0,        0.0,
+              0.0,      -11.0,       10.0,      -11.0,        0.0,      -11.0,
+            -11.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,      -11.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          33386.0,   -13696.0,     2796.0,     -698.0,    11817.0,     -872.0,
+           -524.0,      380.0,      816.0,      111.0,     -168.0,      181.0,
+             19.0,     -150.0,       27.0,      149.0,     -189.0,      129.0,
+            -18.0,       31.0,      158.0,        0.0,      131.0,      -74.0,
+             -1.0,      -66.0,       13.0,       10.0,      -10.0,      -16.0,
+             11.0,       79.0,      -37.0,       63.0,      -14.0,       25.0,
+             44.0,      -11.0,       -8.0,        8.0,       25.0,      -24.0,
+             -7.0,        2.0,        2.0,      -15.0,       21.0,      -21.0,
+             -3.0,       -6.0,     -353.0,      -10.0,        5.0,        6.0,
+              5.0,        5.0,        5.0,      -13.0,        1.0,       -2.0,
+             15.0,        8.0,        7.0,       11.0,       -7.0,      -10.0,
+             -2.0,       -6.0,    -1988.0,        0.0,       -5.0,       -6.0,
+              9.0,        4.0,       -2.0,       -5.0,        8.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        5.0,       -3.0,
+              9.0,      -25.0,    -1044.0,       -1.0,       -1.0,        2.0,
+              1.0,       -3.0,       -1.0,        1.0,        2.0,       -1.0,
+              1.0,        1.0,       -4.0,       -2.0,        0.0,        5.0,
+              2.0,       -3.0,        1.0,        0.0,       -2.0,        0.0,
+              4.0,        0.0,       -3.0,       -2.0,        1.0,       -2.0,
+             -1.0,       -2.0,        0.0,        3.0,       -2.0,       -3.0,
+             -2.0,        2.0,        1.0,        0.0,        0.0,       -1.0,
+              2.0,        0.0,        1.0,       -2.0,       -2.0,        0.0,
+              0.0,       -1.0,      364.0,        0.0,       -1.0,        1.0,
+             -1.0,       -2.0,       -1.0,        0.0,      330.0,        1.0,
+              1.0,        1.0,       -1.0,        1.0,       -1.0,        0.0,
+              0.0,        2.0,        2.0,        1.0,        0.0,        1.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        1.0,        0.0,       -1.0,        2.0,
+              0.0,        0.0,       -1.0,      -28.0,        1.0,        0.0,
+              2.0,     -162.0,        0.0,        0.0,        0.0,        1.0,
+             -1.0,       -1.0,        0.0,       -1.0,        0.0,        1.0,
+              0.0,        1.0,        0.0,        0.0,        1.0,        0.0,
+             -1.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -1.0,        1.0,       -5.0,        0.0,
+             -4.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             10.0,        1.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,       -3.0,        0.0,       75.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,      -63.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       30.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -26.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       13.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -13.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+            -12.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -10.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -3.0,        6.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        5.0,        0.0,        0.0,        0.0,
+              5.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -5.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -3.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+       92052331.0,  5730336.0,   978459.0,  -897492.0,    73871.0,    -6750.0,
+         224386.0,   200728.0,   129025.0,   -95929.0,    -1235.0,   -68982.0,
+         -53311.0,    -1220.0,   -33228.0,    25543.0,    31429.0,    26366.0,
+            477.0,   -24236.0,    16452.0,   -13870.0,    13238.0,     -609.0,
+         -12338.0,     -550.0,     -167.0,   -10758.0,      168.0,     6850.0,
+          -8001.0,     8551.0,     6953.0,     6415.0,      104.0,     5222.0,
+           3268.0,    -3250.0,      -51.0,     3070.0,     3353.0,     -199.0,
+          -2768.0,     3272.0,    -3045.0,     3041.0,     2695.0,     2720.0,
+           2719.0,      -41.0,     -553.0,      -81.0,      -20.0,    -2206.0,
+             40.0,    -1900.0,       35.0,     -107.0,       -9.0,     1313.0,
+           1233.0,     1232.0,     1207.0,     1129.0,    -1062.0,     1266.0,
+          -1129.0,     1073.0,        0.0,      854.0,     -710.0,      -50.0,
+            647.0,     -610.0,     -594.0,      -39.0,      663.0,     -700.0,
+           -556.0,      -23.0,      672.0,     -170.0,      518.0,     -490.0,
+            465.0,     -495.0,        0.0,     -527.0,        4.0,      496.0,
+              8.0,     -399.0,     -395.0,       29.0,     -440.0,     -422.0,
+              9.0,     -391.0,     -326.0,     -389.0,      304.0,      294.0,
+             14.0,      369.0,      346.0,       -2.0,      -19.0,      258.0,
+            252.0,     -253.0,      -24.0,      316.0,        5.0,     -244.0,
+             -6.0,     -228.0,     -279.0,      250.0,      -19.0,      275.0,
+            -15.0,      207.0,      240.0,      201.0,     -200.0,      244.0,
+            225.0,      188.0,      216.0,      -17.0,     -176.0,      171.0,
+            205.0,       -8.0,        0.0,      189.0,     -185.0,     -154.0,
+           -143.0,      -14.0,      184.0,      144.0,        0.0,        7.0,
+           -174.0,     -134.0,      162.0,        6.0,     -144.0,       -2.0,
+              2.0,      131.0,      109.0,     -138.0,     -108.0,      104.0,
+           -128.0,     -104.0,     -120.0,      128.0,        1.0,       43.0,
+             -4.0,     -112.0,      105.0,     -102.0,     -100.0,       94.0,
+             83.0,       96.0,      -79.0,      -54.0,       75.0,      -75.0,
+             69.0,        0.0,       -1.0,       69.0,       81.0,       78.0,
+             84.0,       -5.0,      -75.0,      -61.0,      -72.0,       56.0,
+             69.0,       55.0,       -1.0,      -64.0,       60.0,      -52.0,
+             66.0,       -2.0,       57.0,      -49.0,       59.0,       48.0,
+             61.0,        3.0,       57.0,       44.0,        2.0,       56.0,
+             44.0,      -54.0,       56.0,       50.0,       12.0,      -50.0,
+            -54.0,       51.0,      -40.0,        0.0,       -4.0,       40.0,
+             40.0,       39.0,       39.0,       39.0,      -39.0,        2.0,
+            -47.0,        0.0,      -44.0,      -43.0,      -36.0,       47.0,
+            -43.0,      -45.0,      -45.0,       -4.0,       -4.0,       34.0,
+             41.0,       43.0,       39.0,       -1.0,        0.0,        0.0,
+            -32.0,       32.0,      -31.0,       30.0,      -36.0,       -2.0,
+            -33.0,       33.0,      -28.0,       26.0,        0.0,      -34.0,
+             32.0,        1.0,        0.0,        2.0,      -29.0,      -25.0,
+             54.0,       22.0,      -23.0,      -22.0,       22.0,        0.0,
+            -26.0,       -2.0,       25.0,      -10.0,      -24.0,      -19.0,
+             -1.0,       -1.0,      -18.0,       23.0,      -26.0,      -20.0,
+             22.0,       -8.0,       -2.0,       19.0,      -19.0,       24.0,
+             18.0,       24.0,       22.0,      -21.0,       21.0,       21.0,
+            -21.0,       20.0,       19.0,      -20.0,        0.0,       19.0,
+            -16.0,      -16.0,       20.0,      -15.0,       20.0,        0.0,
+            -18.0,       19.0,      -14.0,        0.0,       15.0,        0.0,
+             16.0,       21.0,       15.0,      -16.0,      -13.0,      -16.0,
+             16.0,      -13.0,       14.0,      -13.0,       13.0,      -13.0,
+              0.0,       15.0,        0.0,       -2.0,        0.0,       15.0,
+             14.0,       -1.0,        0.0,        0.0,       -1.0,      -15.0,
+            -15.0,      -15.0,        0.0,       -1.0,      -14.0,       11.0,
+             12.0,       -1.0,      -14.0,      -11.0,       11.0,        0.0,
+              0.0,        1.0,      -11.0,        0.0,      -10.0,       10.0,
+             11.0,      -12.0,      -10.0,        0.0,       -1.0,        9.0,
+              9.0,        6.0,       12.0,      -12.0,       -9.0,        0.0,
+              0.0,       10.0,       10.0,        5.0,        9.0,       -9.0,
+              0.0,        0.0,        8.0,       11.0,        0.0,      -10.0,
+             10.0,       10.0,        0.0,        9.0,       -8.0,       -8.0,
+             10.0,        7.0,        0.0,        0.0,       -9.0,        0.0,
+             10.0,        9.0,        0.0,        7.0,        9.0,       -7.0,
+              8.0,       -6.0,        8.0,       -8.0,       -1.0,       -1.0,
+              7.0,        7.0,        3.0,       -8.0,        0.0,       -3.0,
+              0.0,       -7.0,        3.0,        7.0,        7.0,       -6.0,
+              8.0,        0.0,        0.0,        8.0,        6.0,       -6.0,
+             -5.0,        6.0,       -5.0,        5.0,        0.0,        0.0,
+              0.0,        0.0,        5.0,        5.0,       -5.0,        6.0,
+              6.0,       -5.0,       -5.0,        6.0,        5.0,        0.0,
+              0.0,        0.0,        0.0,        5.0,       -6.0,        3.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              6.0,        5.0,        4.0,       -6.0,        5.0,        5.0,
+             -6.0,        4.0,        4.0,       -4.0,        0.0,        0.0,
+              0.0,        4.0,       -4.0,       -5.0,       -4.0,       -5.0,
+             -4.0,        4.0,        4.0,        0.0,       -3.0,       -3.0,
+              0.0,        0.0,        3.0,        0.0,       -4.0,       -4.0,
+              4.0,        4.0,        4.0,        3.0,        0.0,       -3.0,
+             -4.0,        4.0,       -7.0,        0.0,        3.0,       -4.0,
+              3.0,       -3.0,        0.0,        0.0,        0.0,        4.0,
+              0.0,        0.0,        0.0,        3.0,        3.0,       -3.0,
+              3.0,        4.0,       -4.0,        0.0,       -3.0,        0.0,
+             -3.0,       -3.0,        0.0,        3.0,       -3.0,        3.0,
+              0.0,       -1.0,       -3.0,        2.0,       -3.0,       -3.0,
+              0.0,        3.0,       -3.0,        0.0,        3.0,        3.0,
+              3.0,        2.0,        0.0,       -3.0,       -2.0,        2.0,
+              0.0,       -2.0,       -3.0,        0.0,        3.0,        0.0,
+              2.0,       -2.0,        2.0,        0.0,        2.0,        3.0,
+             -2.0,       -3.0,        2.0,        0.0,       -3.0,       -3.0,
+             -2.0,        2.0,       -3.0,        0.0,        2.0,       -2.0,
+             -2.0,       -2.0,        0.0,       -3.0,        3.0,       -3.0,
+              2.0,        0.0,       -2.0,       -2.0,        0.0,       -2.0,
+             -2.0,       -2.0,        2.0,        2.0,       -2.0,       -2.0,
+             -2.0,        0.0,       -2.0,        2.0,        0.0,        0.0,
+              0.0,        2.0,       -2.0,        2.0,        2.0,        0.0,
+              0.0,        3.0,       -2.0,        2.0,        2.0,        2.0,
+              2.0,        0.0,        2.0,        0.0,        2.0,       -2.0,
+              0.0,        2.0,        0.0,       -2.0,        2.0,        0.0,
+              0.0,        2.0,        0.0,       -2.0,       -2.0,       -2.0,
+              2.0,        2.0,        0.0,       -2.0,        2.0,        2.0,
+             -2.0,        1.0,       -2.0,        1.0,       -1.0,        0.0,
+              0.0,       -1.0,        0.0,       -2.0,        2.0,        1.0,
+              1.0,        0.0,        1.0,        0.0,        2.0,       -1.0,
+              2.0,       -2.0,        0.0,        2.0,       -1.0,       -1.0,
+              1.0,        0.0,        1.0,        2.0,        0.0,       -1.0,
+              0.0,        2.0,        1.0,        0.0,       -1.0,        2.0,
+              1.0,        0.0,        1.0,       -1.0,       -1.0,       -1.0,
+             -2.0,        2.0,        0.0,       -2.0,        0.0,        0.0,
+             -1.0,        1.0,        0.0,       -1.0,        0.0,        1.0,
+              2.0,        2.0,       -1.0,       -2.0,       -2.0,        2.0,
+             -1.0,        1.0,        1.0,        2.0,        1.0,        0.0},
+   {
+           9086.0,    -3015.0,     -485.0,      470.0,     -184.0,        0.0,
+           -677.0,       18.0,      -63.0,      299.0,        0.0,       -9.0,
+             32.0,        0.0,        0.0,      -11.0,        0.0,        0.0,
+              0.0,      -10.0,      -11.0,        0.0,      -11.0,        0.0,
+             10.0,        0.0,        0.0,        0.0,       -1.0,      -42.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0},
+   {
+          15377.0,    -4587.0,     1374.0,     -291.0,    -1924.0,      358.0,
+           -174.0,      318.0,      367.0,      132.0,       82.0,       39.0,
+             -4.0,       29.0,       -9.0,       66.0,      -75.0,       78.0,
+            -25.0,       20.0,       68.0,        0.0,       59.0,       13.0,
+             -3.0,       11.0,       13.0,       -3.0,       10.0,       -5.0,
+             -1.0,      -45.0,      -14.0,       26.0,        2.0,       15.0,
+             19.0,       -5.0,        4.0,        4.0,       14.0,        2.0,
+             -4.0,        4.0,       -1.0,       -5.0,       12.0,       -9.0,
+             -3.0,        3.0,     -139.0,        2.0,       -2.0,        1.0,
+             -2.0,        1.0,       -2.0,        1.0,        0.0,       -1.0,
+              7.0,        4.0,        3.0,        5.0,       -3.0,       -4.0,
+             -2.0,       -2.0,    -1679.0,        0.0,       -2.0,        0.0,
+              4.0,        2.0,       -2.0,        0.0,        4.0,        0.0,
+              0.0,        1.0,        0.0,        1.0,        2.0,       -1.0,
+              4.0,      -10.0,     -891.0,       -1.0,       -1.0,        1.0,
+             -1.0,       -1.0,       -1.0,        0.0,        1.0,       -1.0,
+              0.0,        0.0,        2.0,       -1.0,        0.0,        2.0,
+              0.0,       -1.0,        1.0,        0.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,       -1.0,        0.0,       -1.0,
+              0.0,       -1.0,        0.0,        2.0,        0.0,       -1.0,
+              0.0,        1.0,        1.0,        0.0,        0.0,       -1.0,
+              1.0,        0.0,        1.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,      176.0,        0.0,       -1.0,        0.0,
+             -1.0,        0.0,       -1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        1.0,
+              0.0,        0.0,        0.0,       11.0,        0.0,        0.0,
+              1.0,     -138.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        1.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -2.0,        0.0,
+             -2.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -2.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,      -27.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       14.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -11.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -5.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,      -11.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+            -10.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,       -5.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        4.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0}};
+
+static const signed char TRUNC_PL_MULT[14][687] = {
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -1, -1, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  2, -1,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  1,  0,  0,
+        0,  2,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0, -2,  0,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+        0, -1,  0,  0,  0,  0,  0, -2,  1, -1,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0, -1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -1, -1,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  2,
+        1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+       -1,  0, -1, -2,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1, -1,  1,  0,  0,  0, -1, -2,  1,
+        0,  0, -1, -2, -1,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -2, -1,  1, -1,  1, -1, -1,  1, -1, -2,  0,  0,
+        0,  0,  1,  0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1, -1, -1,
+        1, -1, -1,  1,  0,  0,  2,  0,  0,  0,  0, -1, -2,  0,  0,  0,
+        0,  0,  0,  2,  0,  1,  2, -2, -2, -2,  0,  0,  0,  0, -2,  0,
+        1,  0, -1,  2, -2, -1,  0, -2,  0,  2,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  1, -1,  1, -1,  1,  1,  1,  0,  0,  0,  0,  0,  2,
+       -2,  0,  0, -1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1, -2,  0,  0,  0,
+        0,  0,  2,  2,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  1, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  2,  2,  0, -1,  1,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  1,  0, -1,
+        0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  1,  0,  1,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0, -1, -2,  0,  0,
+        0,  0,  2,  0,  0,  0,  1,  0,  0,  2,  2,  0,  1,  0,  0,  0,
+        0,  0,  0, -1,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,
+        0,  0,  1,  0,  0,  0,  0,  0,  2,  2,  1,  1, -2,  1,  0,  0,
+        0,  1,  0,  1,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  1,  0,  0,  1,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2,  0,  1,  0,  0,  1, -2,  1,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,
+        1,  0,  1,  0,  0,  0,  0,  0,  2,  1,  0,  1,  0, -2,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  2,  2,  2,  0,  1, -1,
+        1,  1,  0,  0, -1,  0,  0, -1,  0, -1, -1,  1,  0,  1,  0, -2,
+       -1,  0,  2,  0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0,  0,  0,
+        0,  2,  2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0,  1,  2,  0, -1,  0,
+        0,  1, -1,  1,  0, -1,  0,  0,  1,  0,  2,  0,  0, -2,  0,  2,
+        0,  2,  0, -1,  0,  0,  1,  0,  1,  0,  1,  2,  0,  2,  2, -1,
+        0,  0,  0,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -1,  0,  0,  2,  0,  0,  2,  2,  0,  1,  2,
+        2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  0,  0,  0,  0,  0},
+   {
+       -1,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  0, -2,  2,  0,  2,  0,  0,  0,  0,  0, -1,
+        1,  0,  0,  0,  0,  0,  2,  0,  0,  0, -1, -1,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0, -1,  0, -2,  0, -1,
+        0,  0,  0,  0,  0,  0,  2,  0,  1,  0,  0,  0, -2,  0,  0, -1,
+        0,  0,  0,  0,  0,  0, -2,  0, -1,  1,  0,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  2,  0,  0,  0,  0, -1,  0, -1,
+        0, -2,  0,  1,  0, -1,  0,  0,  0, -1, -2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+        0, -1, -1,  2,  0,  0,  0,  0, -1, -1, -1,  0,  0,  0,  0,  0,
+        0,  2,  0, -2,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0, -1,  0,  1,
+        0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0, -1,  1, -1,  0,  0,
+        0,  0,  0, -1,  0,  0,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2, -1,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -2,  2,  2, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -1,  0,  2,  0,  0,  0,  0, -1,  0,  1,  2,  0,  0,
+        0,  2,  2,  0,  2,  0, -1,  0,  0, -2, -2,  0, -1,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0,  2,  1,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0, -1,
+        0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  1, -1,  2, -1,  0, -2,
+       -2, -1,  0, -1,  0, -2, -2, -2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1,  0,  0, -1,
+        0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+        2,  0, -1,  2,  0, -1,  2,  1, -1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -2,  0, -2,  0,  0,  0,  1,  2, -2,
+       -1,  0,  1,  2,  1,  0,  0,  0, -2, -1,  0,  1,  0,  2,  0,  2,
+        0, -1,  0,  0,  0,  0,  0, -2,  0, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  2,  0,  0, -1, -1,  0,  0,  0,  2,  2, -1,  1,
+       -1, -1, -1,  0,  1,  2,  0,  1,  0,  1,  1, -1,  0, -1,  0,  2,
+        1,  0, -2,  0,  0,  0,  0,  0, -2,  0, -1,  0,  0,  0,  0,  0,
+        0, -2, -2,  0,  0,  0, -2,  0,  0,  0,  0,  0,  0, -2,  0,  2,
+       -2,  0,  2,  0, -2,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+        0, -1,  1, -3,  0, -1, -2,  2,  1,  2, -2,  0,  0,  2,  2, -2,
+        0, -2,  0, -1,  2,  1, -1,  2, -1, -2, -1, -2,  2, -2, -2,  1,
+        0,  0,  0,  0,  0, -1,  0,  1,  0,  0,  0,  0,  0,  2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0, -2,  0,  1,  2, -2, -2,  0, -2,  0,  0,  2,  1, -2,
+        2,  0,  0,  2,  0,  0,  0,  1,  0,  2,  0,  0,  0,  0,  0},
+   {
+        1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  1,
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0,
+        0,  0,  2,  2,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,
+        0,  0,  0,  1,  0,  0,  1,  1,  1,  0,  0,  1,  0,  1,  1,  1,
+        0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  1,
+        0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  2,  2,  0,  0,  2,  1,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  1,  1,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,
+        1,  0,  0,  1,  1,  0,  0,  0,  1,  1,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  0,  0,
+        0,  0,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  2,  0,  0,  2,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  1,  1,  1,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,
+        0,  0,  2,  0,  1,  0,  1,  0,  0,  2,  2,  1,  1,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  1,  1,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  0,  0,  1,
+        0,  0,  1,  0,  0,  0,  0,  0,  2,  2,  2,  1,  0,  1,  0,  1,
+        0,  1,  0,  2,  1,  1,  1,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  2,  2,  0,  1,  0,  1,  1,  2,  2,  2,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2,  0,  1,  2,  0,  2,  1,  1,  2,  0,  0,  0,  0,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  1,  1,  0,
+        2,  0,  1,  1,  0,  1,  0,  1,  2,  2,  0,  1,  0,  0,  0,  0,
+        0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  2,  2,  2,  0,  1,  1,
+        2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,
+        0,  0,  1,  1,  1,  0,  0,  0,  1,  0,  1,  1,  0,  0,  0,  0,
+        0,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  2,  0,  0,  2,
+        0,  1,  1,  1,  2,  0,  0,  0,  0,  0,  1,  1,  0,  0,  1,  1,
+        1,  1,  1,  1,  0,  1,  2,  1,  2,  1,  1,  1,  0,  1,  1,  0,
+        0,  0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  1,  1,  2,  0,  0,  2,  2,  0,  2,  2,
+        2,  2,  2,  2,  2,  2,  2,  1,  2,  2,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0, -1,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0},
+   {
+        0,  0, -3,  0, -8,  1,  0,  0,  0,  0,  0, -8,  2,  0,  2,  8,
+        0,  0,  0,  0, -4, -2, -5,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  1,  3, 18, 10,  0, -5,  0,  0,  0,  0,  5,  0,  0, -8,
+       -5,  3,  0,  0,  0,  0,  2,  0,  0,  0,  0, -5,  0, 19, -8,  0,
+        0, -8,  0,  0,  0,  0,  3,  0,  3, -1,  0,  0, -3, -6, -4,  0,
+       -2,  3, -1,  8,  1,  0,  0, 18,  0,  0,  0, -8,  6,  0,  0,  0,
+        3,  0,  0,-18, -3,  0,  4, -3,  0,  0,  0,  0, -7, -2,  0, -4,
+        3, -5,  0,  0, -2,  0,  0,  0,  0, -3,  4,  5,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  5,  0,  0, -3,  0, -8,  0,  0,  0,  0,
+       -6,  0,  0, -5,  5, -3,  2,  0,  6,  1,  0, -1,  0,  0, -5,  0,
+        3,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,  0,
+       -9,  0, -2,  0,  0,  2,  1,  0,  0,  0,  0,  0,  0,  0, -4,  0,
+       -3, -6,  0,  0,  1,  0,  1,  7, -3, -4, -3,  0,  0, -1,  0,  0,
+        0,  0,  0,  0,  2,  0,  0,  0,  0, -7, -6,  8,  3,  3,  0, -3,
+        0,  0,  0,  0,  0,  0,  3, -6,  8,  5,  0, -5,  1,  0,  0,  0,
+        0,  0,  0,  3,  0,  0,  0, -2, -7, -1,  0,  0,  0,  0,  2,  8,
+        3, -2,  0,  0,  0,  0,  0,  5,  3, -3, -2,  0, -4,  2,  0,  0,
+        0,  0, -6, -8,  0,  0,  0,  0,  0,  0, -4,  0,  0,  3,  0, -8,
+       -7,  0,  0,  0, -3,  6,  0,  0,  0,  4,  2,  3,  0,  3,  0,  5,
+        9,  0,  0,  0,  0,  0,  0,  0,  3, -3, -5,  0,  0,  0,  0,  0,
+        4,  8,  0,  0,  0,  0,  0, -2,  0,  1,  1, -5,  0,  0,  0,  0,
+        3,  0,  0,  1,  2, -5,  4, -9,  0,  3,  2,  0,  0, -1,  0, -2,
+       -6,  0,  0,  6,  0,  4, -7,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       20,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0, -8,  0,  0,
+        5, -2,  0,  5,  0,  0, -1,  1,  3,  0,  0,  0,  0,  0,  0,  0,
+       -5,  0,  0, -3,  0, -3,  0,  0, -1,  0, -8,  0,  0,  4, -8,  0,
+        3,  0, 18,  3,  0,  0,  5,  0,  0,  0,  2,  0,  0, -8,  0,  2,
+        0,  0,  0, -8,  7,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0, 17,
+        0,  0,-20,  3,  0,  5,  0,  0,  0, -5,  0,  0, -6,  0,  0,  2,
+        0,  1,  0,  0, -3,  0,  0,  0,  0, -2, -4,  0,  0,  0, -9,  0,
+        5, -9, -9,  0,  0,  1,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,
+       -8,  3,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  1, -1,  4,
+        4,  0,  0,  0,  3,  0,  0,  0, -5,  3, -5, -2, -7, -4, -2,  0,
+        0,  0,  0,  0,  1,  0,  0,  0, -3,  5,  8,  0,  0,  1,  3,  0,
+        0,  0,  2,  1,  0,  0,  0,  0,  0,  0, -5,  3,  0,  0,  0, -3,
+        0,  0,  5, -6,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0, -8,
+      -10,  0, 10,  0,  0,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+        0,  0, -1,  0, -7, -4,  0,  1,  0,  0, -1,  0,  0,  4,  6,  3,
+        0,  0,  0,  0, -3,  0, -8,  0,  0,  0,  0,  0,  0, -1, -4,  4,
+       -9,  6,  0,  0,  0,  0,  0,  0,  0, -8,  3,  0, -5, -5,  0, -1,
+        0,  0,  1, -6,  0, -8,  2,  0,  0,  6,  0,  3,  5,  2,  4,  0,
+        6,  0,  0,  0,  0,  0,  0,  0, -3,  0,  2, -2, -2,  0,  0,  0,
+        0,  2,  2,  0, -1,  0,  0,  0,  1,  0,  4,  0,  0, -9,  3},
+   {
+       -1,  0,  5,  4, 12, -1,  8,  1,  0, -1,  1, 13, -3,  0, -2,-13,
+       -2,  6,  3, -1,  6,  4,  6,  2,  1,  2,  2, -4,  0,  4,  2,  0,
+        0,  0,  1, -4,-16, -3,  2,  8,  0,  1, -1, -1, -6,  2,  0, 13,
+        7, -5,  1, -4,  4,  2, -1,  2, -8, -1,  8,  7,  0,-21, 11, -1,
+        3, 15,  1,  3,  0,  4, -3,  0, -4,  1,  3, -1,  3,  8,  6,  3,
+        5, -2,  3,-13, -2,  2, -2,-16, -5,  1,  2, 13, -8,  0,  0,  0,
+       -3,  2, -6, 16,  5,  1, -4,  7, -1,  0,  1,  0,  9,  4,  1,  7,
+       -3,  8,  8,  0,  2,  0,  1,  1,  2,  5, -6, -5,  0, -1,  0, -2,
+        0, -2,  3,  1, -1, -1, -8,  0, -2,  4, -2, 10,  5,  0,  0,  4,
+        9,  4,  1,  7, -7,  3,  1,  4, -6, -1,  4,  3,  2,  6,  8, -3,
+       -1, -1, -1,  5, -1,  2,  1,  0,  3, -1,  5,  1,  2,  2,  4, -1,
+       11,  2,  3, -9, -2, -3,  0,  2, -2,  1,  3,  1,  1,  3,  4,  2,
+        4, 10,  3,  0, -1,  0,  1, -7,  5,  4,  6, -1,  3,  0,  1,  1,
+       -4,  1,  2, -2, -1,  7,  1,  3,  5, 10,  8,-14, -4, -6,  0,  9,
+        3, -8,  8, -3,  4,  4, -5,  8,-12, -7,  3,  5,  2,  0, -2, -5,
+        5,  2,  3,  0, -9,  0,  1,  3, 11,  1,  1,  2,  5,  3,  0, -8,
+       -3,  2,  2, -3, -2,  2,  3, -3, -7,  3,  3, -4,  6, -2, -6, 11,
+        3,  3,  6, 11,  2,  2, -2,  0, -2,  6,  7,  1,  2, -3,  2, 11,
+        9,  6,  5, -1,  7, -8,  4,  1, -1, -4, -4, -5,  1, -3,  1, -6,
+       -9,  2,  2,  0,  2, -7, -1,  0, -5,  3,  6,  2, -1,  0,  1,  5,
+       -2,-13,  9,  0, -6, -1,  5,  2, -1, -3,  0, 10,  6, -4,  5,  1,
+       -5,  7, -1, -2, -4,  9, -4, 12,  5, -1,  1, -1, -3,  2, -2,  3,
+        9,  3,  1, -7,  6, -3,  7,  5,  4, -4,  1, -1,  9, -1, -8, -6,
+      -21, -1,  0, -1, -8, -8,  2, -2, -4, -5,  4,  1, -5, 12, -2,  4,
+       -6,  6,  2, -5,  5,  6,  1, -1, -7, -9,  0, -3, -1, -4,  4,  0,
+        8,  0, -2,  4,  1,  6, -1,  6,  4,  3, 10,  4,  4, -2,  8,  1,
+       -3,  4,-17, -3,  0, -1, -6,  1, -1,  0, -3,  0, -4, 12,  0, -2,
+       -2,  5,  2, 16, -8,  6,  6, -2,  2, -2, -1,  1,  0,  2,  2,-16,
+       -1,  0, 20, -3,  2, -8,  0,  0, -2,  7, -3,  1, 10,  2, -5, -2,
+       -1, -2, -1, -1,  4,  2,  1, -1,  6,  1,  5, -2,  2,  3, 11,  4,
+       -3,  9,  9,  6,  4, -1,  4, -1, -1,  4, -3,  1,  2,  2, -1,  1,
+       12, -6, -1,  0,  1,  4,  0,  2,  2,  1, -4, -4, -3, -3,  2, -4,
+       -5, -6, -3,  1, -4, -1, -1, -3,  5, -6,  6,  2, 10,  5,  5,  2,
+        2,  4, -4,  7,  1,  7,  1,  3,  8, -5, -9,  6,  6, -1, -3,  4,
+        4,  1, -2, -1,  1,  1,  1,  4,  0, -4,  6, -5, -5,  0,  1,  5,
+        0, -1, -7,  7,  0,  8, -5,  2,  1,  2,-10,  7, -9, -2,  2, 11,
+        3, -2, -3,  3,  2,  3,  4,  6, -1, -5,  1, -2,  2, -7, -4, -2,
+       -5, -4,  2, -3, 11,  6,  0,  0,  1, -7,  1, -6, -3, -4, -9, -4,
+       -1,  1,  1,  1,  4, -2, 14,  5,  1,  1, -1, -6, -5,  2,  8, -5,
+       13, -8,  2, -3,  5,  2, -5, -2,  6, 11, -3,  1,  6,  6,  2,  4,
+        2, -3, -1,  7, -5, 10,  0,  7,  7, -6,  6, -1, -4,  1, -2,  5,
+       -4,  6,  0,  2,  2,  1,  2, -2,  3,  1, -2,  2,  3,  2,  1, -2,
+        2, -3, -2, -1,  1, -4,  4,  1, -1,  2, -2,  1,  3,  9, -2},
+   {
+        0,  0,  0, -8,  0,  0,-16,  0,  0,  2, -2,  0,  0,  0,  0,  0,
+        8, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0, -8, -2, -2,
+        2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,
+        0,  0,  0,  8,  0,  0,  0,  0, 16,  0,-16,  0,  0,  3,  0,  0,
+        0,  0,  2, -2,  0, -2,  0,  0,  0,  0, -4,  0,  0,  0,  0, -8,
+        0,  0,  0,  0,  0, -3,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0, -2,  0,
+        0,  0,-15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+        0,  0, -5,  0,  2,  0,  0,  4,  4,  0,  0,  0, -4,  0,  0, -4,
+        0,  0,  0,  0,  0,  0,  0, -3,  0,  0, -6,  0,  0, -8,  0,  6,
+        0,  0,  0, -6,  0,  0,  0,  0, -7,  0,  0,  0,  0,  0,  0,  8,
+        0,  0,  0, 13,  4,  0,  0,  0,  0,  0, -6,  0, -2, -8,  0,  0,
+        0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  4, -3,  0,  0,  0,
+        7, -1,  0,  8,  0, -8,  0, -4, -8,  0,  0,  0,  0,  0,  0, -4,
+        0, 15,-15,  4, -7, -5,  4,  0,  0,  0,  0,  0,  0,  0,  4,  9,
+       -9,  0,  0,  0, 15,  0,  0,  0,  0,  0,  0,  0, -5, -1,  0,  0,
+        0,  0,  0,  5,  0,  0,  0,  0,  4,  0,  0,  8,  0,  0, 15,  0,
+        0,  0,  0,  0,  0,  0,  2,  0,  4,-11,  0,  0,  0,  0,  0,  0,
+        0, -6,  0,  0, -4,  0,  0,  0,  5,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0,  0,  0, 13,  0,  0,  0,  0,  0, -4,  0,  0,  0, -7,
+        0,  0,-17,  2, 11,  3, -8,  0,  0,  0,  0,  0,  0,  8, -6,  0,
+        0,-13,  0,  0,  0,  0,  0,  0, -3,  0,  0,  2,  7,  0,  5,  0,
+        0, -2,  0,  0, -5,  0,  0,  0, -8,  8,  0,  0,-13,  0, 15,  8,
+        0,  0,  0,  0, 15, 11,  0,  0,  0,  0, -8,  0,  8,  0,  6, -4,
+        0,  0,  2,  0, -2,  0,  0,  0,  4, 17,  0,  4,  0,  8, -8, -2,
+        0,  0,  0,  0,  0,  0,  6, -7,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  2,  0,
+        7, -6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0,  0, -2,  0,  0,  0,  0,  0,  6,  0,  0,  0, 10,  0,
+        0,  0,  0,  0,  0, -2,  0,  0, -9,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -8,  0, -8,  0,  0, -8,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -4,  0, -2, -4,  0,  0,  6,  6,  0,  0,  0,
+        0, 10,  0,  0,  0,  0,  0,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -8,  8, -9,  0, -8,  0,  0,  0,  0,  0,  0,  0,  0,  0, -8,
+       -8,  0,  0,  0,  0,  0,  0, -8,  0,  8,  4,  0,  9,  0,  0,  0,
+        0,  0,  0,  0,  0,-15,  0,  0,  0,  0, 15,-13, 17,  0,  0,  0,
+        0,  0,  0, -7,  0, -4,  0, -8,  0,  6, -4,  0,  0,  9,  4,  0,
+        9,  7,  0,  5,  0,  0,  1,  0, -3, 12,  0, 10,  7,  0,  0,  0,
+        0,  0,  0,  0,  0,  2,  0, -8,  0,  0,  0,  9,  7,  0,  0,  0,
+        0,  0,  0,  9, -6,  0, 13,  8, -8,  0,  0,  0,  0,  0,  0,  0,
+        1,  0,  0,  0, 16,  0,  0, -7, -7,  0, -4,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  8, -8,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+       -2, -2,  0,  3,  0,  0,  4, -1,  2,  0,  0,  0,  0,  2,  0,  0,
+       -3,  3, -1,  2,  0,  0,  0, -2, -2, -3, -2, -3,  0,  3,  0,  0,
+        0,  1,  0,  0,  0,  0, -2,  0,  2,  1,  0, -1,  0,  0,  2,  0,
+        0,  0,  0, -3, -2, -1,  0,  1, -4,  2,  4,  0,  0,  0,  0,  0,
+       -2,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  3,
+        0,  0,  0,  0,  0,  0,  3,  0, -3,  1, -3,  0,  0, -2,  1,  2,
+        0,  0, -4,  0,  0,  2,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -1, -3,  0, -3,  0,  0,  0,  2,  2,  0,  0,
+        1,  2,  0, -1,  0,  1,  0,  0,  0,  0,  2,  0,  0,  0,  2,  0,
+        0, -3,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -4,  0,  0,  4, -3,  0, -2,  0,  0,  0,  0, -1,  0, -1, -3,
+        0, -2,  0,  0,  0,  0,  0, -3,  3,  0,  0,  0,  0,  3,  0, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+        0,  0, -2, -3,  0,  3,  1,  0,  3,  0,  0,  0,  0,  0,  3,  0,
+       -1,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  0,
+        0,  0, -3,  0,  0, -1, -2,  0,  0,  0,  1,  0,  0,  0,  0,  0,
+        0,  0, -2,  0,  4,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+       -2,  1,  0,  0, -3, -4,  0,  0,  0,  0,  0, -1, -4,  0,  0,  0,
+        0,  0, -2, -1,  0,  0,  0,  0,  0,  0, -3,  2,  0,  0,  0,  0,
+        0, -3, -2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  3,  4,  3,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0, -1,  0, -3,
+        2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0, -3,  3, -3, -2, -1,  0,  0,  0,  0,
+        0, -2,  0, -2,  0,  0,  0,  0,  0,  0,  0, -4,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -3,  3,  0,
+        0,  4,  3,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,
+        0,  1,  0,  0,  0,  1,  0, -2, -1,  0,  0,  3,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  0,  0,  0, -2,  2,  1, -1,  0,  0, -4, -2,
+        0,  0,  0,  0,  0,  0,  1,  0,  2,  0,  0,  0,  0, -2,  0,  0,
+        5,  0,  3,  2,  0,  0, -2,  1,  0,  0,  0,  5,  0, -4,  0, -4,
+        0,  0,  0,  0,  3,  0,  3,  0,  0,  3,  0,  0, -3, -2,  0,  1,
+        0,  0,  1,  3,  0,  0,  2,  0,  0, -1,  0,  0,  0,  0,  0,  0,
+        0,  0,  3, -2,  0,  1,  0, -3,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  3, -3,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+        3, -1,  0,  0, -1,  0,  0,  3, -2, -3,  0,  0,  0,  0,  0,  0,
+        1,  1,  0,  0,  1,  0,  0, -5, -3, -1,  0,  0,  0,  0, -3,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        2,  0,  1, -3,  0,  0,  0,  3,  0,  1,  1,  0,  0,  0,  0,  0,
+        0,  0, -2,  0,  0,  0,  0, -1,  1,  0,  2,  0,  0,  0,  2,  0,
+        0,  5,  0,  0, -4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -4,
+        0,  0,  0, -2, -3,  0, -2,  2,  0, -1,  0,  0,  0, -2,  0,  3,
+       -2,  0,  0,  1,  0, -3,  3,  0,  0, -2,  0,  1,  0,  0,  0},
+   {
+        5,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0, -5,  0,  0,
+        0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0, -5,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  5,  0,  2,  0,  0,  2,
+        0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0, -5,
+        0,  0, -5,  0,  0,  0,  0,  0,  1,  0, -1,  0,  0,  0,  0,  0,
+        0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,
+        0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, 10,  0,  0,  0,  0,  0,  5,  0,  2,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0, -1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2, -5,
+        0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+        0,  0,  5,  0,  0, -5, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  1,  3,  0,  3,  0,  0,  0,  0,  0,  0, -2,  0,
+        0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0, -5, -5,  0,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -5,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,
+        0,  4,  1,  5,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0,
+        0, -5,  0,  0,  0,  0,  0,  0,  0, -2,  0, -2,  0,  0,  0,  0,
+        0,  5,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,
+        1,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,
+        0,  0,  0, -5, -1,  0, -2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  2,  0,
+       -2, -3,  0,  0,  0,  0,  0,  5,  0, -5,  0,  0,  0,  0,  1,  0,
+        0,  0,  0,  0, -5,  0,  0,  0, -1,  0,  0,  0, -2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0, -3, -5,  5,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0, -3,  0, -5,  5,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0, -5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -2,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,  0,  0,
+        0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0, -3,  0,  0,  0,  0,  1,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+   {
+        0,  1,  2,  0,  0,  0,  0,  0,  2,  0,  0,  1,  0,  0,  0,  0,
+        2,  2,  2,  0,  2,  2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  2,  0,  0,  0,  0,  2,  1,  2,  0,  0,  0,  0,  1,  2,
+        2,  0,  0,  0,  2,  2,  2,  2,  2,  0,  2,  0,  1,  0,  2,  0,
+        2,  2,  2,  2,  2,  2,  0,  2,  0,  1,  0,  2,  0,  2,  1,  0,
+        2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  2,  2,  0,  2,  2,  0,  2,  0,  2,  0,  2,  2,  1,  0,  2,
+        2,  1,  0,  0,  1,  1,  0,  0,  0,  1,  0,  0,  1,  0,  1,  0,
+        1,  0,  0,  0,  1,  0,  0,  2,  2,  0,  0,  2,  2,  1,  0,  2,
+        2,  2,  0,  1,  0,  1,  2,  2,  0,  1,  0,  1,  1,  0,  1,  2,
+        2,  0,  0,  0,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  2,  2,
+        2,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,
+        0,  2,  2,  0,  0,  2,  1,  0,  0,  0,  2,  2,  0,  0,  0,  0,
+        2,  0,  1,  2,  0,  2,  0,  0,  0,  2,  1,  0,  0,  0,  1,  2,
+        2,  2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  1,  2,  1,  1,  2,
+        0,  2,  2,  2,  0,  0,  0,  0,  2,  0,  0,  2,  2,  2,  1,  0,
+        0,  0,  2,  2,  2,  2,  2,  2,  0,  0,  2,  2,  1,  1,  2,  2,
+        0,  2,  1,  0,  0,  0,  0,  2,  1,  0,  1,  0,  0,  1,  0,  2,
+        1,  2,  2,  0,  0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  2,  2,
+        0,  0,  0,  2,  0,  2,  0,  1,  1,  0,  0,  0,  0,  2,  2,  0,
+        2,  1,  0,  0,  2,  2,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0,
+        0,  0,  0,  1,  0,  2,  1,  2,  2,  1,  1,  0,  0,  2,  2,  0,
+        1,  0,  0,  0,  2,  2,  1,  2,  0,  0,  0,  0,  0,  0,  1,  0,
+        0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,
+        0,  2,  2,  2,  2,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,
+        2,  2,  0,  1,  1,  1,  2,  2,  2,  2,  1,  2,  0,  1,  1,  0,
+        0,  2,  0,  0,  2,  0,  0,  0,  0,  2,  1,  1,  2,  2,  0,  0,
+        2,  2,  2,  2,  0,  2,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  1,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  1,  0,  2,  0,
+        2,  0,  1,  2,  2,  0,  2,  0,  0,  0,  1,  2,  0,  0,  1,  2,
+        1,  1,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  1,  0,  1,  0,
+        0,  2,  0,  0,  0,  1,  1,  2,  0,  0,  0,  0,  1,  2,  1,  1,
+        1,  0,  0,  2,  0,  2,  0,  2,  2,  1,  0,  0,  1,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  1,  2,  1,  2,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        1,  1,  0,  1,  1,  0,  0,  0,  0,  2,  2,  0,  2,  0,  0,  1,
+        0,  0,  0,  0,  0,  0,  2,  2,  2,  1,  0,  2,  2,  0,  2,  0,
+        2,  0,  0,  2,  0,  0,  2,  2,  2,  1,  2,  0,  2,  1,  2,  1,
+        2,  2,  0,  1,  2,  2,  0,  2,  2,  1,  2,  0,  2,  1,  0,  2,
+        1,  1,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+        0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  1,  0}};
+
+static const double TRUNC_PL_COEF[4][687] = {
+   {
+          -3084.0,    -1444.0,    -2150.0,     -462.0,     1200.0,     1485.0,
+           1440.0,    -1223.0,    -1166.0,     -460.0,     -449.0,      425.0,
+              8.0,     -491.0,     -598.0,      235.0,     -123.0,      123.0,
+            517.0,       31.0,      490.0,     -458.0,      -18.0,     -439.0,
+           -166.0,     -349.0,      393.0,       84.0,      370.0,      -82.0,
+           -368.0,      273.0,      266.0,      -91.0,     -339.0,       -5.0,
+            226.0,     -219.0,      284.0,      -11.0,       42.0,     -262.0,
+            174.0,      -50.0,      -10.0,      -86.0,       14.0,      -41.0,
+            202.0,     -145.0,      126.0,     -126.0,     -184.0,     -154.0,
+              5.0,      163.0,       56.0,      -27.0,      125.0,      140.0,
+             51.0,      103.0,      -62.0,      -48.0,       67.0,       61.0,
+            -85.0,       80.0,     -127.0,      143.0,     -138.0,     -133.0,
+              0.0,       25.0,      -78.0,      118.0,      117.0,      117.0,
+            -22.0,     -114.0,        0.0,        0.0,      113.0,       46.0,
+             22.0,      -68.0,       89.0,      -68.0,       99.0,      -21.0,
+             83.0,      -40.0,       78.0,       76.0,       20.0,      -73.0,
+             89.0,      -89.0,        0.0,       57.0,       85.0,      -35.0,
+             83.0,      -63.0,      -66.0,       52.0,      -75.0,      -74.0,
+             74.0,       14.0,      -37.0,        3.0,       54.0,       57.0,
+             45.0,       11.0,       12.0,      -13.0,      -28.0,      -42.0,
+            -53.0,       11.0,      -46.0,       59.0,        9.0,      -26.0,
+             47.0,       -8.0,        6.0,       54.0,      -20.0,      -53.0,
+              6.0,       -6.0,      -14.0,      -21.0,      -51.0,      -10.0,
+             50.0,       50.0,       30.0,       32.0,      -25.0,       18.0,
+              0.0,      -37.0,      -13.0,       -8.0,       35.0,        8.0,
+             19.0,       26.0,       40.0,       -7.0,      -16.0,        8.0,
+              7.0,      -15.0,       31.0,      -24.0,       31.0,        9.0,
+            -17.0,      -24.0,       30.0,       24.0,      -24.0,       11.0,
+             26.0,       11.0,       -7.0,        8.0,        0.0,        0.0,
+             -3.0,      -22.0,       34.0,      -34.0,       30.0,       10.0,
+            -11.0,        0.0,       -4.0,       21.0,       21.0,      -21.0,
+              0.0,       -3.0,       23.0,      -19.0,        6.0,       20.0,
+              0.0,       24.0,       29.0,        4.0,      -28.0,      -18.0,
+              5.0,       28.0,      -21.0,       27.0,        0.0,      -19.0,
+             27.0,        5.0,       -6.0,       -9.0,       16.0,      -25.0,
+             -4.0,        0.0,        6.0,      -25.0,        0.0,      -16.0,
+             21.0,        0.0,       -5.0,       11.0,        0.0,       -9.0,
+              6.0,       14.0,        0.0,      -14.0,       15.0,        9.0,
+              0.0,       16.0,      -13.0,      -17.0,      -14.0,       16.0,
+             18.0,        4.0,        4.0,       -9.0,       -8.0,        8.0,
+              7.0,        0.0,        9.0,       17.0,        0.0,        4.0,
+             -3.0,        0.0,      -16.0,      -19.0,        8.0,        0.0,
+              7.0,       19.0,        4.0,       19.0,      -19.0,       18.0,
+             12.0,       17.0,       17.0,      -11.0,        5.0,       14.0,
+             10.0,       16.0,        5.0,       -6.0,       -3.0,       -3.0,
+             11.0,      -11.0,       -4.0,       -5.0,        3.0,        0.0,
+             15.0,       -6.0,        0.0,        0.0,       -6.0,        9.0,
+            -12.0,       15.0,       11.0,        3.0,       15.0,        0.0,
+             -3.0,        6.0,        3.0,        0.0,       -9.0,       11.0,
+             -4.0,      -14.0,       -5.0,       11.0,        0.0,       13.0,
+             -4.0,       13.0,      -13.0,        3.0,       13.0,       13.0,
+             13.0,      -12.0,       12.0,       -4.0,       -8.0,        8.0,
+             -3.0,      -12.0,        0.0,       -4.0,       -3.0,       -9.0,
+             -5.0,        5.0,        8.0,        5.0,        5.0,        8.0,
+              0.0,      -11.0,        0.0,       11.0,       11.0,        8.0,
+             -5.0,       -3.0,        2.0,        3.0,       -6.0,       -3.0,
+             10.0,       10.0,        0.0,      -10.0,        5.0,       10.0,
+              0.0,        0.0,      -10.0,        0.0,        0.0,       -5.0,
+             -5.0,       -3.0,       -6.0,        0.0,        9.0,        0.0,
+              0.0,        0.0,       -6.0,        0.0,        0.0,       -9.0,
+              0.0,        0.0,        0.0,        0.0,       -3.0,        0.0,
+              0.0,        3.0,        0.0,        5.0,        0.0,       -3.0,
+             -5.0,        0.0,        0.0,        8.0,        5.0,       -8.0,
+              3.0,       -4.0,        5.0,       -8.0,       -3.0,        8.0,
+              0.0,       -8.0,       -4.0,       -8.0,        0.0,        8.0,
+             -8.0,        8.0,       -7.0,       -3.0,       -7.0,        4.0,
+              3.0,        0.0,        0.0,       -7.0,        0.0,        7.0,
+              7.0,        7.0,        0.0,       -7.0,        0.0,        0.0,
+              3.0,        0.0,        0.0,       -7.0,        3.0,        0.0,
+              0.0,        7.0,        7.0,        0.0,        0.0,        6.0,
+             -6.0,        0.0,        0.0,        0.0,        0.0,       -6.0,
+              3.0,        0.0,        6.0,       -6.0,        6.0,        6.0,
+              0.0,        0.0,       -6.0,       -6.0,        0.0,        6.0,
+              6.0,        6.0,        6.0,       -6.0,        6.0,       -6.0,
+              0.0,        5.0,       -5.0,        0.0,       -5.0,        0.0,
+              5.0,       -5.0,       -5.0,        0.0,        0.0,        0.0,
+             -5.0,       -5.0,       -5.0,        0.0,        0.0,        5.0,
+              0.0,       -5.0,        5.0,        0.0,        0.0,       -5.0,
+              0.0,        5.0,        0.0,        5.0,        0.0,        0.0,
+              5.0,        5.0,       -5.0,        5.0,        0.0,       -5.0,
+              0.0,        0.0,        0.0,        5.0,        5.0,       -5.0,
+              0.0,        0.0,        0.0,        0.0,       -5.0,        5.0,
+             -5.0,        4.0,        0.0,        0.0,       -4.0,        0.0,
+              4.0,        0.0,       -4.0,       -4.0,       -4.0,        0.0,
+              4.0,        0.0,        0.0,        4.0,       -4.0,       -4.0,
+             -4.0,        4.0,        0.0,        0.0,        4.0,        0.0,
+              0.0,        0.0,       -4.0,       -4.0,        4.0,        0.0,
+              0.0,        4.0,        4.0,        0.0,       -4.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -4.0,        0.0,
+             -4.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -4.0,        4.0,        0.0,        0.0,        4.0,
+              4.0,       -4.0,        4.0,        0.0,        4.0,        3.0,
+             -3.0,       -3.0,        3.0,       -3.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,        0.0,       -3.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        0.0,       -3.0,
+             -3.0,       -3.0,        3.0,        0.0,        3.0,        0.0,
+              3.0,       -3.0,       -3.0,        3.0,       -3.0,       -3.0,
+              0.0,        0.0,       -3.0,        3.0,        3.0,       -3.0,
+             -3.0,        0.0,        3.0,        3.0,        3.0,        3.0,
+              0.0,        0.0,        0.0,        3.0,        2.0,        0.0,
+              0.0,        0.0,       -3.0,        0.0,        0.0,       -3.0,
+              0.0,        3.0,        0.0,       -3.0,       -3.0,        3.0,
+              0.0,        3.0,       -3.0,       -3.0,        0.0,        0.0,
+              0.0,        3.0,        3.0,        0.0,       -3.0,        0.0,
+             -3.0,       -3.0,       -3.0,        0.0,        3.0,        0.0,
+              3.0,        0.0,        0.0,        3.0,       -3.0,        0.0,
+              0.0,        3.0,        3.0,       -3.0,        3.0,        3.0,
+              3.0,        3.0,       -3.0,        0.0,       -3.0,        0.0,
+              0.0,        0.0,       -3.0,       -3.0,        0.0,        0.0,
+              0.0,       -3.0,        0.0,        0.0,        3.0,       -3.0,
+             -3.0,        0.0,       -3.0,        3.0,       -3.0,        3.0,
+              3.0,        3.0,        0.0,       -3.0,        0.0,        3.0,
+             -3.0,        0.0,       -3.0,        3.0,       -3.0,        0.0,
+              0.0,        0.0,        3.0,        3.0,        0.0,       -1.0,
+              1.0,        0.0,        0.0},
+   {
+           5123.0,     2409.0,        0.0,     1604.0,      598.0,        0.0,
+              0.0,      -26.0,        0.0,     -435.0,      430.0,      212.0,
+            614.0,      128.0,        0.0,      334.0,     -416.0,     -415.0,
+             16.0,     -481.0,        0.0,        0.0,     -436.0,        0.0,
+            269.0,      -62.0,        3.0,      298.0,       -8.0,      292.0,
+              0.0,       80.0,      -78.0,      248.0,        0.0,      328.0,
+            101.0,       89.0,        0.0,     -268.0,      223.0,        0.0,
+             84.0,      194.0,      233.0,      153.0,     -218.0,      175.0,
+              0.0,       47.0,      -63.0,      -63.0,       -3.0,      -30.0,
+           -173.0,      -12.0,     -117.0,     -143.0,      -43.0,       27.0,
+            114.0,      -60.0,      -97.0,     -110.0,      -91.0,      -96.0,
+            -70.0,      -71.0,       21.0,       -3.0,        0.0,        0.0,
+            131.0,      106.0,       45.0,        0.0,        0.0,        0.0,
+             93.0,        0.0,     -114.0,     -114.0,        0.0,       66.0,
+            -87.0,       39.0,      -16.0,      -34.0,        0.0,      -78.0,
+             15.0,       57.0,      -18.0,       17.0,      -70.0,       17.0,
+              0.0,        0.0,      -86.0,      -28.0,        0.0,      -48.0,
+              0.0,      -16.0,      -12.0,       23.0,        0.0,        0.0,
+              0.0,      -59.0,       35.0,       66.0,      -15.0,       11.0,
+            -22.0,       56.0,       55.0,       52.0,       36.0,       20.0,
+             -9.0,      -49.0,       14.0,        0.0,       49.0,      -29.0,
+              8.0,      -47.0,       49.0,        0.0,       34.0,        0.0,
+             47.0,      -47.0,      -39.0,      -32.0,        0.0,       40.0,
+              0.0,        0.0,      -18.0,       15.0,       22.0,      -29.0,
+            -45.0,       -7.0,      -30.0,       35.0,       -7.0,       34.0,
+            -23.0,      -14.0,        0.0,      -32.0,       23.0,      -31.0,
+            -32.0,       22.0,        6.0,      -13.0,       -6.0,      -27.0,
+            -19.0,       12.0,       -6.0,      -12.0,      -12.0,      -24.0,
+             -9.0,       24.0,       28.0,      -27.0,       35.0,        0.0,
+            -32.0,       12.0,        0.0,        0.0,       -3.0,      -22.0,
+            -21.0,      -32.0,      -28.0,       11.0,      -11.0,      -11.0,
+             31.0,       28.0,        7.0,      -11.0,       24.0,       10.0,
+             29.0,        5.0,        0.0,       24.0,        0.0,      -10.0,
+            -23.0,        0.0,       -6.0,        0.0,      -27.0,       -8.0,
+              0.0,       21.0,       20.0,      -16.0,        9.0,        0.0,
+             21.0,        0.0,       19.0,        0.0,       24.0,        8.0,
+              3.0,      -24.0,       19.0,      -12.0,       23.0,      -14.0,
+             17.0,        9.0,        0.0,        8.0,       -7.0,      -13.0,
+             22.0,       -6.0,        9.0,       -4.0,        7.0,       -5.0,
+             -3.0,       17.0,       17.0,      -11.0,       12.0,       12.0,
+             13.0,      -20.0,      -11.0,       -3.0,       19.0,       15.0,
+             16.0,       19.0,       -3.0,        0.0,       11.0,      -19.0,
+            -12.0,        0.0,      -15.0,        0.0,        0.0,        0.0,
+             -6.0,        0.0,        0.0,       -6.0,       12.0,       -3.0,
+             -6.0,        0.0,      -11.0,      -10.0,       13.0,      -13.0,
+              5.0,        5.0,      -12.0,      -11.0,       13.0,       15.0,
+              0.0,       -9.0,       15.0,       15.0,        9.0,        6.0,
+             -3.0,        0.0,        4.0,       12.0,        0.0,      -15.0,
+             12.0,       -9.0,       12.0,       14.0,       -5.0,       -3.0,
+             10.0,        0.0,       -9.0,       -3.0,      -13.0,        0.0,
+              9.0,        0.0,        0.0,       10.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        8.0,        4.0,       -4.0,
+             -9.0,        0.0,       12.0,        8.0,       -9.0,        3.0,
+             -7.0,       -7.0,       -4.0,       -6.0,       -6.0,       -3.0,
+             11.0,        0.0,       11.0,        0.0,        0.0,       -3.0,
+              6.0,        8.0,        9.0,       -7.0,        4.0,        7.0,
+              0.0,        0.0,       10.0,        0.0,       -5.0,        0.0,
+            -10.0,      -10.0,        0.0,      -10.0,        0.0,       -4.0,
+             -4.0,       -6.0,       -3.0,        9.0,        0.0,        9.0,
+             -9.0,        9.0,        3.0,        9.0,        9.0,        0.0,
+              9.0,        9.0,       -8.0,       -8.0,       -5.0,       -8.0,
+              8.0,        5.0,       -8.0,        3.0,        8.0,        5.0,
+             -3.0,        8.0,        8.0,        0.0,        3.0,        0.0,
+              5.0,        4.0,        3.0,        0.0,       -5.0,        0.0,
+              8.0,        0.0,        4.0,        0.0,       -8.0,        0.0,
+              0.0,        0.0,        0.0,       -4.0,        0.0,        3.0,
+             -4.0,       -7.0,       -7.0,        0.0,        7.0,        0.0,
+              0.0,        0.0,        7.0,        0.0,       -7.0,       -7.0,
+             -4.0,       -7.0,        7.0,        0.0,       -4.0,       -7.0,
+              7.0,        0.0,        0.0,        6.0,       -6.0,        0.0,
+              0.0,        6.0,        6.0,       -6.0,       -6.0,        0.0,
+             -3.0,        6.0,        0.0,        0.0,        0.0,        0.0,
+             -6.0,       -6.0,        0.0,        0.0,        6.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              5.0,        0.0,        0.0,        5.0,        0.0,       -5.0,
+              0.0,        0.0,        0.0,        5.0,        5.0,        5.0,
+              0.0,        0.0,        0.0,       -5.0,        5.0,        0.0,
+             -5.0,        0.0,        0.0,        5.0,       -5.0,        0.0,
+             -5.0,        0.0,        5.0,        0.0,       -5.0,        5.0,
+              0.0,        0.0,        0.0,        0.0,        5.0,        0.0,
+             -5.0,        0.0,        5.0,        0.0,        0.0,        0.0,
+             -5.0,       -5.0,        5.0,       -5.0,        0.0,        0.0,
+              0.0,        0.0,        4.0,       -4.0,        0.0,        4.0,
+              0.0,       -4.0,        0.0,        0.0,        0.0,        4.0,
+              0.0,        4.0,       -4.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,       -4.0,        4.0,        0.0,       -4.0,
+             -4.0,       -4.0,        0.0,        0.0,        0.0,       -4.0,
+              4.0,        0.0,        0.0,       -4.0,        0.0,        4.0,
+             -4.0,        4.0,        4.0,       -4.0,        0.0,       -4.0,
+              0.0,        4.0,        4.0,       -4.0,        4.0,        0.0,
+              4.0,        0.0,        0.0,       -4.0,       -4.0,        0.0,
+              0.0,        0.0,        0.0,       -4.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        3.0,        3.0,
+              3.0,        0.0,        3.0,        3.0,        0.0,        3.0,
+             -3.0,        0.0,       -3.0,        3.0,        3.0,        0.0,
+              0.0,        0.0,        0.0,       -3.0,        0.0,        3.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -3.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              3.0,       -3.0,       -3.0,        0.0,        1.0,       -3.0,
+              3.0,        3.0,        0.0,        3.0,       -3.0,        0.0,
+             -3.0,        0.0,        3.0,        0.0,        0.0,        0.0,
+              3.0,        0.0,        0.0,        0.0,       -3.0,        3.0,
+             -3.0,        0.0,        0.0,        3.0,        0.0,       -3.0,
+              0.0,        0.0,        0.0,       -3.0,        0.0,        3.0,
+              0.0,       -3.0,       -3.0,        0.0,        0.0,        3.0,
+             -3.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        3.0,        0.0,        0.0,
+              3.0,       -3.0,        0.0,        0.0,        3.0,        3.0,
+              3.0,        0.0,       -3.0,        3.0,        0.0,        0.0,
+              0.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        3.0,        0.0,       -3.0,        0.0,
+              0.0,        3.0,        0.0,        0.0,        0.0,        3.0,
+              3.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0},
+   {
+           2735.0,    -1286.0,        0.0,        0.0,      319.0,        0.0,
+              0.0,        0.0,        0.0,     -232.0,        0.0,     -133.0,
+              0.0,        0.0,        0.0,        0.0,     -180.0,     -180.0,
+              7.0,     -257.0,        0.0,        0.0,     -233.0,        0.0,
+              0.0,        0.0,        0.0,      159.0,        0.0,      156.0,
+              0.0,       43.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,     -116.0,      119.0,        0.0,
+             45.0,      103.0,        0.0,        0.0,      117.0,       76.0,
+              0.0,        0.0,      -27.0,      -27.0,       -1.0,      -13.0,
+            -75.0,       -5.0,      -42.0,      -77.0,        0.0,       14.0,
+             61.0,        0.0,      -42.0,      -59.0,      -39.0,      -42.0,
+            -31.0,      -31.0,        9.0,       -1.0,        0.0,        0.0,
+              0.0,       57.0,        0.0,        0.0,        0.0,        0.0,
+             49.0,        0.0,      -49.0,      -50.0,        0.0,       35.0,
+              0.0,        0.0,       -9.0,      -18.0,        0.0,        0.0,
+              0.0,       30.0,        0.0,        9.0,      -37.0,        9.0,
+              0.0,        0.0,      -19.0,      -15.0,        0.0,      -21.0,
+              0.0,       -7.0,       -6.0,       10.0,        0.0,        0.0,
+              0.0,      -31.0,       19.0,       29.0,       -7.0,        6.0,
+              0.0,        0.0,       29.0,       28.0,        0.0,        0.0,
+             -5.0,      -26.0,        0.0,        0.0,       26.0,      -16.0,
+              4.0,      -25.0,       26.0,        0.0,        0.0,        0.0,
+             25.0,      -25.0,        0.0,      -14.0,        0.0,       21.0,
+              0.0,        0.0,       -8.0,       -8.0,        0.0,      -13.0,
+            -20.0,       -3.0,        0.0,       19.0,        0.0,       18.0,
+            -10.0,       -6.0,        0.0,      -17.0,        0.0,      -16.0,
+            -17.0,        0.0,        3.0,       -6.0,        0.0,      -14.0,
+            -10.0,        0.0,       -2.0,       -5.0,       -5.0,      -11.0,
+              0.0,       11.0,       15.0,        0.0,        0.0,        0.0,
+            -14.0,        5.0,        0.0,        0.0,       -2.0,      -12.0,
+            -11.0,      -17.0,        0.0,        0.0,       -6.0,       -6.0,
+              0.0,       15.0,        3.0,        0.0,       13.0,        0.0,
+             15.0,        2.0,        0.0,       13.0,        0.0,       -4.0,
+            -12.0,        0.0,       -3.0,        0.0,      -12.0,       -4.0,
+              0.0,       11.0,        0.0,        0.0,        4.0,        0.0,
+             11.0,      -19.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,      -10.0,       10.0,       -7.0,       13.0,       -8.0,
+              9.0,        4.0,        0.0,        3.0,       -4.0,       -7.0,
+              0.0,        0.0,        4.0,       -2.0,        0.0,        0.0,
+              0.0,        9.0,        7.0,        6.0,        6.0,        5.0,
+              0.0,       -9.0,       -5.0,       -1.0,       10.0,        8.0,
+              0.0,       10.0,       -1.0,        0.0,        0.0,       -8.0,
+             -5.0,        0.0,       -8.0,        0.0,        0.0,        0.0,
+             -3.0,        0.0,        0.0,       -3.0,        5.0,        0.0,
+             -3.0,        0.0,       -5.0,       -4.0,        7.0,       -7.0,
+              2.0,        2.0,        0.0,       -5.0,        7.0,        6.0,
+              0.0,        0.0,        7.0,        7.0,        5.0,        0.0,
+             -2.0,        0.0,        0.0,        6.0,        0.0,       -7.0,
+              6.0,       -4.0,        5.0,        7.0,       -3.0,       -1.0,
+              4.0,        0.0,       -4.0,       -1.0,       -7.0,        0.0,
+              0.0,        0.0,        0.0,        4.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        3.0,        2.0,       -2.0,
+             -5.0,        0.0,        5.0,        4.0,       -5.0,        1.0,
+             -3.0,        0.0,        0.0,        3.0,        0.0,       -1.0,
+              5.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              3.0,        4.0,        4.0,       -3.0,        2.0,        4.0,
+              0.0,        0.0,        4.0,        1.0,        0.0,        0.0,
+             -5.0,       -5.0,        0.0,       -6.0,        0.0,       -2.0,
+             -2.0,       -2.0,       -2.0,        5.0,        0.0,        0.0,
+             -5.0,        0.0,        1.0,        4.0,        5.0,        1.0,
+              4.0,        4.0,       -2.0,       -4.0,        0.0,       -4.0,
+             -4.0,        3.0,        0.0,        2.0,        4.0,        2.0,
+             -1.0,        4.0,        4.0,        0.0,        0.0,        1.0,
+              0.0,        0.0,        1.0,        0.0,       -2.0,        0.0,
+              0.0,        0.0,        2.0,        0.0,       -4.0,        0.0,
+              0.0,        0.0,        0.0,       -2.0,        0.0,        1.0,
+             -2.0,       -3.0,       -3.0,        0.0,        3.0,        0.0,
+              0.0,        0.0,        3.0,        0.0,       -3.0,       -3.0,
+             -2.0,       -3.0,        4.0,        0.0,        0.0,       -4.0,
+              4.0,        0.0,        0.0,        2.0,       -3.0,        0.0,
+              0.0,        3.0,        3.0,       -3.0,       -2.0,        0.0,
+             -1.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+             -2.0,       -2.0,       -1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        3.0,
+              0.0,        0.0,        0.0,        3.0,        3.0,        3.0,
+              0.0,        0.0,        1.0,       -3.0,        3.0,        0.0,
+             -2.0,        0.0,        0.0,        3.0,       -3.0,        0.0,
+             -2.0,        0.0,        2.0,        0.0,        0.0,        3.0,
+              0.0,        0.0,        0.0,        0.0,        3.0,        0.0,
+             -3.0,        0.0,        3.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        3.0,        0.0,        1.0,        1.0,
+              0.0,        0.0,        2.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        2.0,        0.0,       -2.0,
+             -2.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,       -2.0,        0.0,        2.0,
+              2.0,        2.0,        2.0,       -2.0,        0.0,       -2.0,
+              0.0,        2.0,        2.0,       -2.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        2.0,        0.0,        1.0,
+             -1.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        2.0,
+              0.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+             -1.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        2.0,        0.0,        0.0,        0.0,        0.0,
+              1.0,       -2.0,       -2.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,        0.0,       -1.0,        2.0,
+              0.0,        0.0,        0.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,       -1.0,       -1.0,        0.0,        0.0,        0.0,
+             -1.0,        0.0,        0.0,        0.0,        1.0,        0.0,
+              0.0,        0.0,        0.0,        1.0,        0.0,       -3.0,
+              1.0,       -2.0,        0.0,        0.0,        1.0,        2.0,
+              0.0,        0.0,       -2.0,        1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,       -2.0,        0.0,
+              0.0,        1.0,        0.0,        0.0,        0.0,        1.0,
+              1.0,        2.0,        0.0,        0.0,       -2.0,        0.0,
+              0.0,       -1.0,        0.0},
+   {
+           1647.0,     -771.0,      932.0,        0.0,     -641.0,        0.0,
+              0.0,        0.0,      505.0,      246.0,        0.0,      269.0,
+              0.0,        0.0,        0.0,        0.0,       53.0,      -53.0,
+           -224.0,      -17.0,     -213.0,      198.0,        9.0,        0.0,
+              0.0,        0.0,        0.0,      -45.0,     -160.0,       44.0,
+              0.0,     -146.0,        0.0,        0.0,      147.0,        0.0,
+              0.0,        0.0,     -151.0,        5.0,      -22.0,      114.0,
+            -93.0,       27.0,        0.0,        0.0,        8.0,       17.0,
+            -87.0,        0.0,      -55.0,       55.0,       80.0,       67.0,
+             -2.0,      -72.0,      -40.0,       14.0,      -54.0,      -75.0,
+            -27.0,        0.0,       27.0,       26.0,      -29.0,      -27.0,
+             37.0,      -35.0,       55.0,      -62.0,        0.0,       57.0,
+              0.0,      -13.0,        0.0,      -52.0,      -63.0,      -51.0,
+             12.0,       61.0,        0.0,        0.0,      -49.0,      -25.0,
+              0.0,        0.0,      -48.0,       36.0,      -53.0,        0.0,
+              0.0,       21.0,        0.0,      -41.0,      -11.0,       39.0,
+              0.0,       38.0,       -6.0,      -30.0,      -37.0,       15.0,
+              0.0,       28.0,       35.0,      -23.0,        0.0,       32.0,
+            -32.0,       -8.0,       20.0,       -1.0,      -24.0,      -30.0,
+              0.0,        0.0,       -6.0,        7.0,        0.0,        0.0,
+             28.0,       -7.0,        0.0,        0.0,       -5.0,       14.0,
+            -25.0,        4.0,       -3.0,      -29.0,        0.0,        0.0,
+             -3.0,        3.0,        0.0,        9.0,       22.0,        5.0,
+            -27.0,      -22.0,      -13.0,       17.0,        0.0,       -8.0,
+              0.0,       16.0,        0.0,        5.0,        0.0,       -4.0,
+              2.0,      -11.0,        0.0,        4.0,        0.0,       -4.0,
+             -4.0,        0.0,      -17.0,       10.0,      -13.0,       -5.0,
+              9.0,        0.0,      -13.0,      -11.0,       10.0,       -9.0,
+              0.0,       -5.0,        4.0,        0.0,        0.0,      -35.0,
+              1.0,       10.0,      -15.0,        0.0,      -16.0,       -5.0,
+              6.0,        0.0,        0.0,        0.0,      -11.0,       11.0,
+              0.0,        2.0,      -13.0,        0.0,       -3.0,        0.0,
+              0.0,      -11.0,      -13.0,       -2.0,       15.0,        8.0,
+             -3.0,        0.0,       11.0,      -14.0,        0.0,        8.0,
+              0.0,       -3.0,        0.0,        0.0,       -7.0,        0.0,
+              2.0,        6.0,        0.0,       11.0,        0.0,        0.0,
+              0.0,        0.0,        2.0,       -6.0,        0.0,        5.0,
+             -3.0,       -6.0,       23.0,        6.0,       -8.0,       -5.0,
+              0.0,        0.0,        6.0,        9.0,        0.0,        0.0,
+              0.0,       -2.0,       -2.0,       -5.0,        4.0,       -3.0,
+              0.0,        0.0,       -4.0,        0.0,        0.0,       -2.0,
+              0.0,        0.0,        7.0,       10.0,        0.0,        0.0,
+             -3.0,       -8.0,       -2.0,        0.0,        0.0,       -9.0,
+             -5.0,       -7.0,       -7.0,        5.0,       -2.0,       -1.0,
+             -5.0,       -9.0,       -2.0,        3.0,        2.0,        1.0,
+             -5.0,        5.0,        0.0,        2.0,       -2.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        3.0,        0.0,
+              6.0,       -8.0,        0.0,       -1.0,        0.0,        0.0,
+              2.0,       -2.0,       -1.0,        0.0,        5.0,       -6.0,
+              2.0,        6.0,        2.0,       -5.0,        0.0,       -7.0,
+              0.0,        0.0,        6.0,       -1.0,        0.0,        0.0,
+             -6.0,        0.0,       -6.0,        2.0,        4.0,       -4.0,
+              3.0,        5.0,        0.0,        2.0,        2.0,        4.0,
+              2.0,        0.0,       -4.0,        3.0,        0.0,       -5.0,
+              0.0,        5.0,        0.0,       -6.0,       -6.0,        0.0,
+              2.0,        1.0,        3.0,        0.0,        3.0,        2.0,
+              0.0,        0.0,        0.0,        5.0,        0.0,       -4.0,
+              0.0,        0.0,        4.0,       -1.0,      -10.0,        2.0,
+              3.0,        1.0,        3.0,        1.0,       -5.0,        0.0,
+              0.0,        0.0,        3.0,        0.0,       -1.0,        4.0,
+              1.0,       -1.0,        0.0,        0.0,        0.0,       -1.0,
+              0.0,       -2.0,        0.0,       -2.0,        0.0,        1.0,
+              3.0,        0.0,        1.0,       -4.0,        0.0,        4.0,
+              0.0,        0.0,       -2.0,        0.0,        1.0,        0.0,
+              0.0,        4.0,        2.0,        4.0,        0.0,        0.0,
+              3.0,       -4.0,        0.0,        1.0,        3.0,       -2.0,
+             -2.0,        0.0,        0.0,        3.0,        0.0,       -3.0,
+             -4.0,       -4.0,        0.0,        4.0,        0.0,        0.0,
+             -1.0,        0.0,        0.0,        3.0,        0.0,        0.0,
+              0.0,        0.0,       -3.0,        0.0,        0.0,       -3.0,
+              3.0,        0.0,        0.0,        0.0,        0.0,        3.0,
+             -2.0,       -1.0,       -2.0,        2.0,        0.0,       -3.0,
+              0.0,        0.0,        3.0,        3.0,        0.0,       -3.0,
+              0.0,        0.0,        0.0,        3.0,       -3.0,        3.0,
+              0.0,       -3.0,        3.0,        0.0,        2.0,        0.0,
+             -3.0,        3.0,        0.0,        0.0,        0.0,        0.0,
+              2.0,        2.0,        3.0,        0.0,        1.0,        0.0,
+              0.0,        0.0,       -2.0,        0.0,        0.0,        2.0,
+              0.0,       -2.0,        0.0,       -3.0,        0.0,        0.0,
+             -2.0,       -2.0,        0.0,        0.0,        0.0,        2.0,
+              0.0,       -5.0,        0.0,       -2.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        2.0,       -2.0,
+              2.0,        0.0,        0.0,        1.0,        2.0,        0.0,
+             -2.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+             -2.0,        0.0,        0.0,       -2.0,        2.0,        2.0,
+              2.0,        0.0,        0.0,       -1.0,       -2.0,       -1.0,
+              0.0,        0.0,        2.0,        2.0,       -2.0,        0.0,
+              0.0,       -2.0,       -2.0,        0.0,        2.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              2.0,        0.0,        0.0,        0.0,        0.0,       -4.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,       -2.0,       -2.0,
+              0.0,        2.0,        0.0,        2.0,        0.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        1.0,        0.0,
+              0.0,        0.0,        0.0,        0.0,        0.0,        0.0,
+              1.0,        2.0,       -2.0,        0.0,       -2.0,        0.0,
+             -1.0,        2.0,        1.0,       -2.0,        0.0,        2.0,
+              0.0,        1.0,        1.0,       -2.0,       -2.0,        1.0,
+              0.0,       -1.0,       -2.0,        0.0,       -1.0,       -2.0,
+              0.0,       -1.0,        0.0,       -1.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        0.0,        0.0,        0.0,        0.0,
+              0.0,       -2.0,        1.0,        1.0,        0.0,        0.0,
+              0.0,       -1.0,       -1.0,        0.0,        1.0,        0.0,
+              1.0,        0.0,        2.0,        0.0,        0.0,        0.0,
+             -1.0,        0.0,        0.0,       -1.0,        1.0,        0.0,
+              0.0,       -2.0,       -1.0,        2.0,       -1.0,       -1.0,
+             -1.0,       -1.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        0.0,        1.0,        0.0,        0.0,        0.0,
+              0.0,        1.0,        0.0,        0.0,       -1.0,        0.0,
+              0.0,        0.0,        2.0,       -2.0,        1.0,        0.0,
+              0.0,       -1.0,        0.0,        0.0,        0.0,       -1.0,
+              1.0,        0.0,        1.0,       -1.0,        1.0,        0.0,
+              0.0,        0.0,       -1.0,       -1.0,        0.0,        0.0,
+              0.0,        0.0,        0.0}};
+
+static const short int TRUNC_LS_COUNT[1366] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+     14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,
+     28,  29,  30,  31,  32,  33,  34,  35,  36,  36,  37,  38,  39,  40,
+     41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,
+     55,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,
+     67,  67,  68,  69,  70,  70,  71,  72,  73,  73,  73,  74,  75,  76,
+     77,  78,  79,  80,  81,  81,  82,  83,  83,  84,  85,  86,  87,  88,
+     89,  90,  91,  92,  93,  93,  93,  94,  95,  96,  97,  98,  99, 100,
+    101, 102, 103, 104, 105, 106, 107, 107, 107, 107, 107, 108, 109, 110,
+    111, 112, 113, 114, 114, 115, 115, 115, 116, 116, 117, 117, 118, 119,
+    120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 127, 127, 128, 128,
+    129, 130, 131, 131, 132, 132, 133, 133, 133, 134, 134, 134, 135, 136,
+    137, 138, 138, 138, 138, 138, 139, 140, 141, 142, 142, 143, 143, 144,
+    145, 146, 146, 147, 148, 148, 149, 149, 150, 151, 152, 152, 152, 153,
+    153, 154, 155, 156, 157, 158, 158, 158, 158, 158, 159, 160, 161, 162,
+    162, 163, 164, 165, 165, 166, 167, 168, 168, 168, 168, 169, 170, 171,
+    172, 172, 172, 172, 173, 174, 174, 174, 174, 174, 174, 175, 175, 175,
+    176, 177, 178, 178, 178, 178, 178, 179, 180, 180, 181, 182, 182, 182,
+    183, 183, 184, 185, 185, 186, 186, 187, 187, 187, 188, 189, 190, 190,
+    191, 192, 193, 193, 193, 193, 194, 194, 195, 196, 196, 196, 196, 197,
+    197, 197, 198, 198, 198, 199, 200, 201, 201, 202, 203, 204, 205, 205,
+    206, 207, 208, 208, 208, 208, 209, 209, 210, 210, 211, 212, 213, 214,
+    215, 216, 217, 218, 219, 219, 220, 221, 221, 221, 221, 221, 222, 223,
+    223, 224, 224, 224, 225, 226, 227, 228, 229, 229, 229, 230, 231, 232,
+    233, 234, 234, 235, 235, 236, 237, 238, 239, 240, 240, 240, 241, 241,
+    241, 242, 242, 242, 243, 244, 244, 244, 245, 245, 245, 245, 245, 246,
+    246, 247, 247, 248, 249, 250, 251, 252, 252, 252, 253, 254, 255, 256,
+    256, 256, 256, 256, 257, 258, 258, 258, 258, 258, 259, 259, 259, 260,
+    261, 261, 261, 261, 261, 261, 262, 263, 264, 264, 264, 264, 264, 265,
+    266, 267, 268, 268, 269, 270, 271, 272, 272, 272, 272, 273, 274, 275,
+    276, 277, 278, 278, 279, 280, 281, 281, 282, 283, 283, 283, 284, 285,
+    285, 285, 285, 286, 287, 287, 287, 288, 289, 289, 289, 289, 289, 290,
+    291, 292, 293, 294, 295, 296, 296, 296, 296, 296, 297, 298, 299, 300,
+    300, 300, 300, 300, 300, 300, 301, 302, 303, 304, 304, 304, 304, 304,
+    304, 304, 304, 304, 305, 306, 306, 306, 306, 307, 308, 308, 309, 310,
+    311, 312, 313, 314, 315, 315, 315, 315, 315, 315, 315, 315, 316, 317,
+    318, 319, 319, 319, 320, 321, 322, 323, 323, 323, 323, 323, 324, 325,
+    326, 327, 328, 329, 329, 329, 329, 330, 331, 332, 333, 334, 334, 334,
+    334, 334, 334, 335, 336, 337, 338, 338, 338, 338, 338, 338, 339, 340,
+    341, 342, 342, 342, 343, 344, 344, 344, 344, 344, 344, 344, 344, 345,
+    346, 347, 348, 349, 349, 349, 349, 349, 349, 350, 351, 352, 353, 354,
+    355, 356, 356, 356, 356, 356, 356, 356, 357, 358, 359, 360, 361, 362,
+    362, 362, 362, 362, 362, 362, 363, 364, 365, 366, 366, 366, 366, 366,
+    366, 366, 367, 368, 369, 370, 371, 371, 371, 371, 371, 371, 371, 371,
+    372, 373, 374, 375, 376, 377, 377, 377, 377, 377, 377, 377, 377, 377,
+    377, 377, 377, 377, 377, 378, 379, 380, 381, 382, 383, 383, 383, 384,
+    385, 386, 387, 388, 389, 390, 390, 390, 390, 390, 390, 391, 392, 393,
+    394, 395, 396, 397, 398, 398, 398, 398, 398, 398, 398, 398, 398, 398,
+    398, 398, 399, 400, 401, 402, 403, 404, 405, 406, 406, 406, 406, 406,
+    406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 407, 408,
+    409, 410, 411, 412, 412, 412, 412, 412, 412, 412, 412, 413, 414, 415,
+    416, 417, 418, 419, 420, 421, 422, 422, 422, 422, 422, 422, 422, 422,
+    422, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434,
+    435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435, 435,
+    435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 444, 444, 444, 444,
+    444, 444, 444, 444, 444, 444, 444, 444, 445, 446, 447, 448, 449, 450,
+    451, 452, 453, 454, 455, 456, 457, 457, 457, 457, 457, 457, 457, 457,
+    457, 457, 457, 457, 457, 457, 457, 458, 459, 460, 461, 462, 463, 464,
+    465, 466, 467, 468, 469, 470, 471, 472, 472, 472, 472, 472, 472, 472,
+    472, 472, 472, 472, 472, 472, 472, 472, 472, 473, 474, 475, 476, 477,
+    478, 479, 480, 481, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482, 482,
+    482, 482, 482, 482, 482, 482, 482, 483, 484, 485, 486, 487, 488, 489,
+    490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+    503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503,
+    503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 503, 504, 505, 506,
+    507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+    524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524, 524,
+    524, 524, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+    536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+    550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 562,
+    562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562,
+    562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562,
+    562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562,
+    562, 562, 562, 562, 562, 562, 563, 564, 565, 566, 567, 568, 569, 570,
+    571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
+    585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598,
+    599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613, 613,
+    613, 613, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624,
+    625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638,
+    639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652,
+    653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666,
+    667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+    676, 676, 677, 677, 677, 677, 678, 678};
+
+/*
+   Bound of the terms from each position of the merged order to the end,
+   in 0.1 microarcseconds: sums of the absolute values of the constant
+   and secular coefficients in longitude, and the same in obliquity.
+*/
+
+static const double TRUNC_REST[4][1366] = {
+   {
+      194676797.0,22579250.0, 9394648.0, 7115439.0, 5040187.0, 3552493.0,
+       2840462.0, 2323117.0, 1935439.0, 1633162.0, 1417222.0, 1260060.0,
+       1131652.0, 1008176.0,  944642.0,  881505.0,  821715.0,  763550.0,
+        711808.0,  664068.0,  618144.0,  579415.0,  546934.0,  515757.0,
+        486440.0,  457846.0,  431893.0,  410097.0,  389646.0,  372929.0,
+        357119.0,  341944.0,  327812.0,  314902.0,  302185.0,  291147.0,
+        280918.0,  272711.0,  264976.0,  257399.0,  250041.0,  242892.0,
+        236230.0,  229627.0,  223177.0,  216873.0,  211071.0,  205282.0,
+        199911.0,  194950.0,  190195.0,  185464.0,  181085.0,  176727.0,
+        172492.0,  168421.0,  164360.0,  160507.0,  156923.0,  153529.0,
+        150177.0,  146900.0,  143823.0,  140904.0,  138018.0,  135192.0,
+        132534.0,  130046.0,  127742.0,  125561.0,  123411.0,  121345.0,
+        119352.0,  117364.0,  115383.0,  113585.0,  111920.0,  110339.0,
+        108809.0,  107324.0,  105884.0,  104475.0,  103090.0,  101747.0,
+        100408.0,   99094.0,   97804.0,   96519.0,   95236.0,   93987.0,
+         92739.0,   91520.0,   90354.0,   89205.0,   88096.0,   87051.0,
+         86007.0,   84987.0,   83972.0,   83000.0,   82050.0,   81113.0,
+         80190.0,   79295.0,   78416.0,   77540.0,   76704.0,   75888.0,
+         75121.0,   74378.0,   73659.0,   72941.0,   72237.0,   71538.0,
+         70863.0,   70194.0,   69526.0,   68868.0,   68227.0,   67590.0,
+         66968.0,   66349.0,   65751.0,   65156.0,   64562.0,   63971.0,
+         63380.0,   62793.0,   62214.0,   61642.0,   61073.0,   60507.0,
+         59968.0,   59430.0,   58893.0,   58360.0,   57832.0,   57320.0,
+         56815.0,   56319.0,   55824.0,   55329.0,   54839.0,   54349.0,
+         53881.0,   53413.0,   52950.0,   52492.0,   52038.0,   51584.0,
+         51136.0,   50697.0,   50259.0,   49824.0,   49402.0,   48984.0,
+         48570.0,   48159.0,   47763.0,   47367.0,   46977.0,   46595.0,
+         46217.0,   45841.0,   45467.0,   45099.0,   44735.0,   44374.0,
+         44013.0,   43655.0,   43302.0,   42958.0,   42619.0,   42280.0,
+         41942.0,   41605.0,   41269.0,   40935.0,   40602.0,   40272.0,
+         39945.0,   39619.0,   39297.0,   38987.0,   38679.0,   38377.0,
+         38090.0,   37806.0,   37525.0,   37246.0,   36970.0,   36694.0,
+         36429.0,   36164.0,   35902.0,   35641.0,   35383.0,   35129.0,
+         34877.0,   34631.0,   34386.0,   34142.0,   33898.0,   33655.0,
+         33416.0,   33184.0,   32953.0,   32724.0,   32496.0,   32277.0,
+         32061.0,   31848.0,   31639.0,   31430.0,   31228.0,   31029.0,
+         30831.0,   30637.0,   30445.0,   30256.0,   30067.0,   29879.0,
+         29692.0,   29505.0,   29318.0,   29131.0,   28947.0,   28769.0,
+         28594.0,   28419.0,   28244.0,   28071.0,   27901.0,   27733.0,
+         27566.0,   27401.0,   27236.0,   27073.0,   26911.0,   26750.0,
+         26591.0,   26432.0,   26274.0,   26116.0,   25959.0,   25803.0,
+         25648.0,   25493.0,   25339.0,   25187.0,   25036.0,   24888.0,
+         24741.0,   24595.0,   24450.0,   24309.0,   24171.0,   24036.0,
+         23903.0,   23771.0,   23640.0,   23509.0,   23379.0,   23251.0,
+         23128.0,   23005.0,   22883.0,   22763.0,   22644.0,   22526.0,
+         22409.0,   22292.0,   22177.0,   22062.0,   21948.0,   21834.0,
+         21720.0,   21606.0,   21492.0,   21379.0,   21266.0,   21154.0,
+         21044.0,   20935.0,   20828.0,   20722.0,   20616.0,   20511.0,
+         20406.0,   20302.0,   20199.0,   20097.0,   19995.0,   19893.0,
+         19792.0,   19691.0,   19590.0,   19491.0,   19392.0,   19294.0,
+         19197.0,   19100.0,   19004.0,   18908.0,   18813.0,   18719.0,
+         18625.0,   18531.0,   18437.0,   18344.0,   18251.0,   18158.0,
+         18065.0,   17972.0,   17881.0,   17790.0,   17700.0,   17610.0,
+         17521.0,   17432.0,   17344.0,   17257.0,   17171.0,   17086.0,
+         17001.0,   16916.0,   16832.0,   16748.0,   16665.0,   16582.0,
+         16499.0,   16416.0,   16333.0,   16251.0,   16169.0,   16087.0,
+         16005.0,   15926.0,   15847.0,   15769.0,   15691.0,   15614.0,
+         15537.0,   15460.0,   15385.0,   15310.0,   15235.0,   15160.0,
+         15086.0,   15012.0,   14938.0,   14865.0,   14792.0,   14720.0,
+         14649.0,   14580.0,   14511.0,   14442.0,   14374.0,   14306.0,
+         14239.0,   14172.0,   14105.0,   14040.0,   13975.0,   13911.0,
+         13847.0,   13784.0,   13721.0,   13658.0,   13595.0,   13533.0,
+         13471.0,   13409.0,   13348.0,   13287.0,   13227.0,   13167.0,
+         13107.0,   13047.0,   12988.0,   12930.0,   12873.0,   12817.0,
+         12762.0,   12707.0,   12652.0,   12597.0,   12595.0,   12541.0,
+         12487.0,   12434.0,   12381.0,   12328.0,   12275.0,   12222.0,
+         12169.0,   12116.0,   12065.0,   12014.0,   11963.0,   11912.0,
+         11862.0,   11812.0,   11762.0,   11713.0,   11664.0,   11616.0,
+         11568.0,   11520.0,   11473.0,   11426.0,   11379.0,   11332.0,
+         11285.0,   11238.0,   11191.0,   11145.0,   11100.0,   11055.0,
+         11010.0,   10965.0,   10920.0,   10875.0,   10831.0,   10787.0,
+         10743.0,   10699.0,   10656.0,   10613.0,   10570.0,   10527.0,
+         10485.0,   10443.0,   10401.0,   10359.0,   10317.0,   10276.0,
+         10236.0,   10196.0,   10156.0,   10117.0,   10078.0,   10039.0,
+         10000.0,    9961.0,    9922.0,    9884.0,    9846.0,    9808.0,
+          9770.0,    9733.0,    9696.0,    9659.0,    9622.0,    9585.0,
+          9548.0,    9511.0,    9475.0,    9439.0,    9403.0,    9367.0,
+          9331.0,    9295.0,    9259.0,    9223.0,    9187.0,    9151.0,
+          9116.0,    9081.0,    9046.0,    9011.0,    8976.0,    8941.0,
+          8906.0,    8871.0,    8836.0,    8801.0,    8801.0,    8766.0,
+          8732.0,    8698.0,    8664.0,    8630.0,    8596.0,    8563.0,
+          8530.0,    8497.0,    8465.0,    8433.0,    8401.0,    8369.0,
+          8337.0,    8305.0,    8273.0,    8241.0,    8209.0,    8177.0,
+          8145.0,    8113.0,    8081.0,    8049.0,    8018.0,    7987.0,
+          7956.0,    7925.0,    7894.0,    7863.0,    7833.0,    7803.0,
+          7773.0,    7743.0,    7713.0,    7683.0,    7653.0,    7623.0,
+          7594.0,    7565.0,    7536.0,    7507.0,    7478.0,    7449.0,
+          7420.0,    7391.0,    7362.0,    7334.0,    7306.0,    7278.0,
+          7250.0,    7222.0,    7194.0,    7166.0,    7138.0,    7110.0,
+          7082.0,    7055.0,    7028.0,    7001.0,    6974.0,    6947.0,
+          6920.0,    6893.0,    6866.0,    6839.0,    6813.0,    6787.0,
+          6761.0,    6735.0,    6709.0,    6683.0,    6658.0,    6633.0,
+          6608.0,    6583.0,    6558.0,    6533.0,    6533.0,    6508.0,
+          6483.0,    6459.0,    6435.0,    6411.0,    6387.0,    6363.0,
+          6339.0,    6315.0,    6291.0,    6267.0,    6243.0,    6220.0,
+          6197.0,    6174.0,    6151.0,    6128.0,    6105.0,    6082.0,
+          6059.0,    6036.0,    6013.0,    5990.0,    5967.0,    5967.0,
+          5945.0,    5923.0,    5901.0,    5879.0,    5857.0,    5835.0,
+          5813.0,    5791.0,    5769.0,    5747.0,    5725.0,    5703.0,
+          5682.0,    5661.0,    5640.0,    5619.0,    5598.0,    5577.0,
+          5556.0,    5535.0,    5514.0,    5493.0,    5473.0,    5453.0,
+          5433.0,    5413.0,    5393.0,    5373.0,    5353.0,    5333.0,
+          5313.0,    5293.0,    5273.0,    5253.0,    5234.0,    5215.0,
+          5196.0,    5177.0,    5158.0,    5139.0,    5120.0,    5101.0,
+          5082.0,    5063.0,    5044.0,    5025.0,    5006.0,    4987.0,
+          4968.0,    4949.0,    4930.0,    4911.0,    4892.0,    4874.0,
+          4856.0,    4838.0,    4820.0,    4802.0,    4784.0,    4766.0,
+          4748.0,    4731.0,    4714.0,    4697.0,    4680.0,    4663.0,
+          4646.0,    4629.0,    4612.0,    4595.0,    4578.0,    4561.0,
+          4544.0,    4528.0,    4512.0,    4496.0,    4480.0,    4464.0,
+          4448.0,    4432.0,    4416.0,    4400.0,    4384.0,    4368.0,
+          4352.0,    4336.0,    4320.0,    4304.0,    4288.0,    4272.0,
+          4256.0,    4240.0,    4225.0,    4210.0,    4195.0,    4180.0,
+          4165.0,    4150.0,    4135.0,    4120.0,    4105.0,    4090.0,
+          4075.0,    4060.0,    4045.0,    4030.0,    4015.0,    4000.0,
+          3985.0,    3970.0,    3955.0,    3940.0,    3925.0,    3910.0,
+          3895.0,    3880.0,    3866.0,    3852.0,    3838.0,    3824.0,
+          3810.0,    3796.0,    3782.0,    3768.0,    3754.0,    3740.0,
+          3726.0,    3712.0,    3698.0,    3685.0,    3672.0,    3659.0,
+          3646.0,    3633.0,    3620.0,    3607.0,    3594.0,    3581.0,
+          3568.0,    3555.0,    3542.0,    3529.0,    3516.0,    3503.0,
+          3490.0,    3477.0,    3464.0,    3451.0,    3439.0,    3427.0,
+          3415.0,    3403.0,    3391.0,    3379.0,    3367.0,    3355.0,
+          3343.0,    3331.0,    3319.0,    3307.0,    3295.0,    3283.0,
+          3271.0,    3259.0,    3247.0,    3235.0,    3223.0,    3211.0,
+          3199.0,    3187.0,    3175.0,    3163.0,    3151.0,    3139.0,
+          3127.0,    3116.0,    3105.0,    3094.0,    3083.0,    3072.0,
+          3061.0,    3050.0,    3039.0,    3028.0,    3017.0,    3006.0,
+          2995.0,    2984.0,    2973.0,    2962.0,    2951.0,    2940.0,
+          2929.0,    2918.0,    2907.0,    2896.0,    2886.0,    2876.0,
+          2866.0,    2856.0,    2846.0,    2836.0,    2826.0,    2816.0,
+          2806.0,    2796.0,    2786.0,    2776.0,    2766.0,    2756.0,
+          2746.0,    2736.0,    2726.0,    2716.0,    2706.0,    2696.0,
+          2686.0,    2676.0,    2666.0,    2656.0,    2646.0,    2636.0,
+          2636.0,    2627.0,    2618.0,    2609.0,    2600.0,    2591.0,
+          2582.0,    2573.0,    2564.0,    2555.0,    2546.0,    2537.0,
+          2528.0,    2519.0,    2510.0,    2501.0,    2492.0,    2483.0,
+          2474.0,    2465.0,    2456.0,    2447.0,    2438.0,    2429.0,
+          2420.0,    2411.0,    2402.0,    2393.0,    2384.0,    2375.0,
+          2366.0,    2358.0,    2350.0,    2342.0,    2334.0,    2326.0,
+          2318.0,    2310.0,    2302.0,    2294.0,    2286.0,    2278.0,
+          2270.0,    2262.0,    2254.0,    2246.0,    2238.0,    2230.0,
+          2222.0,    2214.0,    2206.0,    2198.0,    2190.0,    2182.0,
+          2174.0,    2166.0,    2158.0,    2150.0,    2142.0,    2134.0,
+          2126.0,    2118.0,    2110.0,    2102.0,    2094.0,    2086.0,
+          2078.0,    2070.0,    2062.0,    2054.0,    2046.0,    2046.0,
+          2039.0,    2032.0,    2025.0,    2018.0,    2011.0,    2004.0,
+          1997.0,    1990.0,    1983.0,    1976.0,    1969.0,    1962.0,
+          1955.0,    1948.0,    1941.0,    1934.0,    1927.0,    1920.0,
+          1913.0,    1906.0,    1899.0,    1892.0,    1885.0,    1878.0,
+          1871.0,    1864.0,    1857.0,    1850.0,    1843.0,    1836.0,
+          1829.0,    1822.0,    1815.0,    1808.0,    1801.0,    1794.0,
+          1787.0,    1780.0,    1773.0,    1766.0,    1759.0,    1752.0,
+          1745.0,    1738.0,    1731.0,    1725.0,    1719.0,    1713.0,
+          1707.0,    1701.0,    1695.0,    1689.0,    1683.0,    1677.0,
+          1671.0,    1665.0,    1659.0,    1653.0,    1647.0,    1641.0,
+          1635.0,    1629.0,    1623.0,    1617.0,    1611.0,    1605.0,
+          1599.0,    1593.0,    1587.0,    1581.0,    1575.0,    1569.0,
+          1563.0,    1557.0,    1551.0,    1545.0,    1539.0,    1533.0,
+          1527.0,    1521.0,    1515.0,    1509.0,    1503.0,    1497.0,
+          1491.0,    1485.0,    1479.0,    1473.0,    1467.0,    1461.0,
+          1455.0,    1449.0,    1443.0,    1438.0,    1433.0,    1428.0,
+          1423.0,    1418.0,    1413.0,    1408.0,    1403.0,    1398.0,
+          1393.0,    1388.0,    1383.0,    1378.0,    1373.0,    1368.0,
+          1363.0,    1358.0,    1353.0,    1348.0,    1343.0,    1338.0,
+          1333.0,    1328.0,    1323.0,    1318.0,    1313.0,    1308.0,
+          1303.0,    1298.0,    1293.0,    1288.0,    1283.0,    1278.0,
+          1273.0,    1268.0,    1263.0,    1258.0,    1253.0,    1248.0,
+          1243.0,    1238.0,    1233.0,    1228.0,    1223.0,    1218.0,
+          1213.0,    1208.0,    1203.0,    1198.0,    1193.0,    1188.0,
+          1183.0,    1178.0,    1173.0,    1168.0,    1163.0,    1158.0,
+          1153.0,    1148.0,    1143.0,    1138.0,    1133.0,    1128.0,
+          1123.0,    1118.0,    1113.0,    1108.0,    1103.0,    1098.0,
+          1093.0,    1088.0,    1083.0,    1078.0,    1073.0,    1068.0,
+          1068.0,    1063.0,    1058.0,    1053.0,    1048.0,    1043.0,
+          1038.0,    1033.0,    1028.0,    1023.0,    1018.0,    1013.0,
+          1009.0,    1005.0,    1001.0,     997.0,     993.0,     989.0,
+           985.0,     981.0,     977.0,     973.0,     969.0,     965.0,
+           961.0,     957.0,     953.0,     949.0,     945.0,     941.0,
+           937.0,     933.0,     929.0,     925.0,     921.0,     917.0,
+           913.0,     909.0,     905.0,     901.0,     897.0,     893.0,
+           889.0,     885.0,     881.0,     877.0,     873.0,     869.0,
+           865.0,     861.0,     857.0,     853.0,     849.0,     845.0,
+           841.0,     837.0,     833.0,     829.0,     825.0,     821.0,
+           817.0,     813.0,     809.0,     805.0,     801.0,     797.0,
+           793.0,     789.0,     785.0,     781.0,     777.0,     773.0,
+           769.0,     765.0,     761.0,     757.0,     753.0,     749.0,
+           745.0,     741.0,     737.0,     733.0,     729.0,     725.0,
+           721.0,     717.0,     713.0,     709.0,     705.0,     701.0,
+           697.0,     693.0,     689.0,     685.0,     681.0,     677.0,
+           673.0,     669.0,     665.0,     661.0,     657.0,     653.0,
+           649.0,     645.0,     641.0,     637.0,     633.0,     629.0,
+           625.0,     625.0,     621.0,     617.0,     613.0,     609.0,
+           605.0,     601.0,     597.0,     593.0,     589.0,     585.0,
+           581.0,     578.0,     575.0,     572.0,     569.0,     566.0,
+           563.0,     560.0,     557.0,     554.0,     551.0,     548.0,
+           545.0,     542.0,     539.0,     536.0,     533.0,     530.0,
+           527.0,     524.0,     521.0,     518.0,     515.0,     512.0,
+           509.0,     506.0,     503.0,     500.0,     497.0,     494.0,
+           491.0,     488.0,     485.0,     482.0,     479.0,     476.0,
+           473.0,     470.0,     467.0,     464.0,     461.0,     458.0,
+           455.0,     452.0,     449.0,     446.0,     443.0,     440.0,
+           437.0,     434.0,     431.0,     428.0,     425.0,     422.0,
+           419.0,     416.0,     413.0,     410.0,     407.0,     404.0,
+           401.0,     398.0,     395.0,     392.0,     389.0,     386.0,
+           383.0,     380.0,     377.0,     374.0,     371.0,     368.0,
+           365.0,     362.0,     359.0,     356.0,     353.0,     350.0,
+           347.0,     344.0,     341.0,     338.0,     335.0,     332.0,
+           329.0,     326.0,     323.0,     320.0,     317.0,     314.0,
+           311.0,     308.0,     305.0,     302.0,     299.0,     296.0,
+           293.0,     290.0,     287.0,     284.0,     281.0,     278.0,
+           275.0,     272.0,     269.0,     266.0,     263.0,     260.0,
+           257.0,     254.0,     251.0,     248.0,     245.0,     242.0,
+           239.0,     236.0,     233.0,     230.0,     227.0,     224.0,
+           221.0,     218.0,     215.0,     212.0,     209.0,     206.0,
+           203.0,     200.0,     197.0,     194.0,     191.0,     188.0,
+           185.0,     182.0,     179.0,     176.0,     173.0,     170.0,
+           167.0,     164.0,     161.0,     158.0,     155.0,     152.0,
+           149.0,     146.0,     143.0,     140.0,     137.0,     134.0,
+           131.0,     128.0,     125.0,     122.0,     119.0,     116.0,
+           113.0,     110.0,     107.0,     104.0,     104.0,     101.0,
+            98.0,      95.0,      92.0,      89.0,      86.0,      83.0,
+            80.0,      77.0,      74.0,      71.0,      68.0,      65.0,
+            62.0,      59.0,      56.0,      53.0,      50.0,      47.0,
+            44.0,      41.0,      38.0,      35.0,      32.0,      29.0,
+            26.0,      23.0,      20.0,      17.0,      14.0,      11.0,
+             8.0,       5.0,       2.0,       2.0,       2.0,       1.0,
+             0.0,       0.0,       0.0,       0.0},
+   {
+        183363.0,    8697.0,    7022.0,    6788.0,    6581.0,    2948.0,
+          2875.0,    1649.0,    1282.0,    1246.0,     752.0,     742.0,
+           605.0,     594.0,     583.0,     520.0,     509.0,     446.0,
+           404.0,     404.0,     354.0,     353.0,     353.0,     352.0,
+           352.0,     352.0,     352.0,     352.0,     331.0,     246.0,
+           174.0,     164.0,     139.0,     129.0,     118.0,     118.0,
+           118.0,     118.0,     118.0,      97.0,      97.0,      76.0,
+            65.0,      65.0,      65.0,      54.0,      44.0,      33.0,
+            33.0,      22.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,      11.0,      11.0,
+            11.0,      11.0,      11.0,      11.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0},
+   {
+      100889666.0, 8821958.0, 3087035.0, 2107202.0, 1209419.0, 1133624.0,
+       1126516.0,  901956.0,  700910.0,  571518.0,  475457.0,  474140.0,
+        405119.0,  351804.0,  350555.0,  317318.0,  291709.0,  260205.0,
+        233761.0,  233259.0,  209003.0,  192483.0,  178613.0,  165316.0,
+        164694.0,  152353.0,  151792.0,  151612.0,  140851.0,  140673.0,
+        133818.0,  125816.0,  117220.0,  110253.0,  103812.0,  103706.0,
+         98469.0,   94087.0,   90800.0,   87545.0,   87490.0,   84416.0,
+         81049.0,   80848.0,   78076.0,   74800.0,   71754.0,   68708.0,
+         66001.0,   63272.0,   60550.0,   60506.0,   59814.0,   59731.0,
+         59709.0,   57502.0,   57460.0,   55403.0,   53502.0,   53465.0,
+         53357.0,   53348.0,   52034.0,   50794.0,   49558.0,   48348.0,
+         47214.0,   46149.0,   44879.0,   43748.0,   42816.0,   42816.0,
+         41741.0,   40062.0,   39208.0,   38248.0,   37536.0,   37486.0,
+         36835.0,   36835.0,   36835.0,   36223.0,   35627.0,   35588.0,
+         34921.0,   34221.0,   33665.0,   33641.0,   32969.0,   32969.0,
+         32798.0,   32278.0,   31773.0,   31282.0,   30813.0,   30308.0,
+         29417.0,   28889.0,   28884.0,   28387.0,   28378.0,   27978.0,
+         27582.0,   27104.0,   27104.0,   27075.0,   26634.0,   26211.0,
+         26202.0,   25811.0,   25483.0,   25093.0,   24789.0,   24493.0,
+         24479.0,   24109.0,   23762.0,   23760.0,   23741.0,   23339.0,
+         23339.0,   23339.0,   23339.0,   23081.0,   22827.0,   22574.0,
+         22550.0,   22233.0,   22228.0,   21983.0,   21983.0,   21977.0,
+         21744.0,   21511.0,   21282.0,   21051.0,   20772.0,   20498.0,
+         20246.0,   20227.0,   19951.0,   19936.0,   19728.0,   19515.0,
+         19274.0,   19073.0,   18873.0,   18675.0,   18430.0,   18188.0,
+         17962.0,   17962.0,   17774.0,   17774.0,   17557.0,   17540.0,
+         17363.0,   17363.0,   17192.0,   17192.0,   16987.0,   16783.0,
+         16623.0,   16615.0,   16415.0,   16415.0,   16239.0,   16050.0,
+         15864.0,   15710.0,   15521.0,   15521.0,   15521.0,   15374.0,
+         15230.0,   15216.0,   15031.0,   14887.0,   14887.0,   14887.0,
+         14887.0,   14880.0,   14706.0,   14572.0,   14572.0,   14410.0,
+         14404.0,   14253.0,   14109.0,   13988.0,   13986.0,   13984.0,
+         13852.0,   13711.0,   13597.0,   13487.0,   13349.0,   13211.0,
+         13103.0,   12999.0,   12871.0,   12767.0,   12637.0,   12637.0,
+         12637.0,   12512.0,   12392.0,   12264.0,   12263.0,   12220.0,
+         12127.0,   12123.0,   12011.0,   11906.0,   11819.0,   11717.0,
+         11617.0,   11522.0,   11522.0,   11440.0,   11358.0,   11275.0,
+         11179.0,   11100.0,   11035.0,   10954.0,   10874.0,   10797.0,
+         10722.0,   10647.0,   10570.0,   10488.0,   10397.0,   10343.0,
+         10254.0,   10184.0,   10096.0,   10096.0,    9958.0,    9957.0,
+          9888.0,    9819.0,    9734.0,    9666.0,    9597.0,    9516.0,
+          9438.0,    9370.0,    9286.0,    9281.0,    9215.0,    9151.0,
+          9076.0,    9013.0,    8952.0,    8880.0,    8880.0,    8823.0,
+          8766.0,    8697.0,    8697.0,    8627.0,    8572.0,    8571.0,
+          8507.0,    8507.0,    8447.0,    8395.0,    8329.0,    8277.0,
+          8214.0,    8163.0,    8161.0,    8100.0,    8043.0,    7994.0,
+          7933.0,    7884.0,    7834.0,    7775.0,    7726.0,    7666.0,
+          7618.0,    7618.0,    7618.0,    7557.0,    7553.0,    7496.0,
+          7439.0,    7395.0,    7393.0,    7337.0,    7293.0,    7239.0,
+          7185.0,    7129.0,    7079.0,    7026.0,    7026.0,    7026.0,
+          7012.0,    6961.0,    6911.0,    6911.0,    6855.0,    6804.0,
+          6764.0,    6764.0,    6760.0,    6720.0,    6678.0,    6639.0,
+          6600.0,    6550.0,    6511.0,    6472.0,    6424.0,    6376.0,
+          6376.0,    6338.0,    6336.0,    6289.0,    6264.0,    6264.0,
+          6219.0,    6182.0,    6138.0,    6095.0,    6059.0,    6012.0,
+          5969.0,    5933.0,    5933.0,    5888.0,    5843.0,    5839.0,
+          5835.0,    5801.0,    5766.0,    5725.0,    5684.0,    5641.0,
+          5602.0,    5600.0,    5600.0,    5600.0,    5567.0,    5567.0,
+          5535.0,    5503.0,    5471.0,    5439.0,    5400.0,    5361.0,
+          5330.0,    5300.0,    5270.0,    5239.0,    5203.0,    5167.0,
+          5167.0,    5167.0,    5132.0,    5130.0,    5095.0,    5062.0,
+          5062.0,    5029.0,    5001.0,    4975.0,    4948.0,    4914.0,
+          4914.0,    4881.0,    4849.0,    4848.0,    4848.0,    4846.0,
+          4813.0,    4813.0,    4813.0,    4782.0,    4753.0,    4728.0,
+          4698.0,    4669.0,    4640.0,    4611.0,    4557.0,    4528.0,
+          4528.0,    4506.0,    4483.0,    4483.0,    4455.0,    4427.0,
+          4427.0,    4404.0,    4382.0,    4360.0,    4360.0,    4338.0,
+          4312.0,    4285.0,    4263.0,    4237.0,    4235.0,    4210.0,
+          4200.0,    4179.0,    4155.0,    4136.0,    4135.0,    4134.0,
+          4109.0,    4109.0,    4088.0,    4070.0,    4047.0,    4021.0,
+          4001.0,    3979.0,    3971.0,    3951.0,    3949.0,    3930.0,
+          3911.0,    3892.0,    3868.0,    3850.0,    3850.0,    3826.0,
+          3802.0,    3780.0,    3780.0,    3758.0,    3746.0,    3725.0,
+          3704.0,    3687.0,    3687.0,    3666.0,    3645.0,    3624.0,
+          3624.0,    3604.0,    3583.0,    3563.0,    3544.0,    3524.0,
+          3524.0,    3505.0,    3489.0,    3473.0,    3473.0,    3453.0,
+          3437.0,    3424.0,    3404.0,    3389.0,    3369.0,    3369.0,
+          3350.0,    3331.0,    3331.0,    3316.0,    3300.0,    3285.0,
+          3267.0,    3248.0,    3234.0,    3234.0,    3214.0,    3214.0,
+          3198.0,    3179.0,    3179.0,    3179.0,    3144.0,    3129.0,
+          3114.0,    3114.0,    3099.0,    3084.0,    3084.0,    3068.0,
+          3047.0,    3029.0,    3014.0,    2998.0,    2985.0,    2969.0,
+          2953.0,    2940.0,    2926.0,    2909.0,    2892.0,    2875.0,
+          2875.0,    2875.0,    2858.0,    2841.0,    2828.0,    2815.0,
+          2802.0,    2802.0,    2802.0,    2785.0,    2770.0,    2770.0,
+          2768.0,    2754.0,    2738.0,    2738.0,    2722.0,    2722.0,
+          2707.0,    2693.0,    2692.0,    2692.0,    2692.0,    2691.0,
+          2676.0,    2663.0,    2650.0,    2635.0,    2620.0,    2605.0,
+          2603.0,    2602.0,    2587.0,    2572.0,    2560.0,    2545.0,
+          2545.0,    2531.0,    2520.0,    2508.0,    2507.0,    2493.0,
+          2479.0,    2467.0,    2455.0,    2455.0,    2441.0,    2430.0,
+          2419.0,    2408.0,    2394.0,    2394.0,    2394.0,    2393.0,
+          2393.0,    2382.0,    2382.0,    2369.0,    2344.0,    2344.0,
+          2333.0,    2322.0,    2322.0,    2312.0,    2302.0,    2291.0,
+          2291.0,    2291.0,    2291.0,    2281.0,    2269.0,    2257.0,
+          2247.0,    2247.0,    2246.0,    2237.0,    2228.0,    2217.0,
+          2204.0,    2191.0,    2178.0,    2166.0,    2156.0,    2133.0,
+          2121.0,    2109.0,    2100.0,    2100.0,    2100.0,    2090.0,
+          2081.0,    2069.0,    2057.0,    2057.0,    2057.0,    2047.0,
+          2037.0,    2032.0,    2023.0,    2014.0,    2003.0,    2003.0,
+          2003.0,    2003.0,    1992.0,    1983.0,    1983.0,    1983.0,
+          1975.0,    1964.0,    1964.0,    1953.0,    1943.0,    1935.0,
+          1935.0,    1926.0,    1917.0,    1916.0,    1906.0,    1896.0,
+          1886.0,    1886.0,    1877.0,    1869.0,    1859.0,    1849.0,
+          1849.0,    1839.0,    1831.0,    1821.0,    1821.0,    1813.0,
+          1805.0,    1797.0,    1787.0,    1787.0,    1787.0,    1779.0,
+          1769.0,    1762.0,    1762.0,    1762.0,    1753.0,    1744.0,
+          1736.0,    1736.0,    1726.0,    1717.0,    1717.0,    1710.0,
+          1701.0,    1694.0,    1687.0,    1680.0,    1672.0,    1665.0,
+          1664.0,    1656.0,    1650.0,    1642.0,    1634.0,    1633.0,
+          1632.0,    1625.0,    1618.0,    1610.0,    1601.0,    1594.0,
+          1587.0,    1578.0,    1570.0,    1563.0,    1556.0,    1556.0,
+          1549.0,    1540.0,    1537.0,    1529.0,    1529.0,    1526.0,
+          1526.0,    1519.0,    1516.0,    1509.0,    1503.0,    1503.0,
+          1503.0,    1496.0,    1489.0,    1481.0,    1481.0,    1473.0,
+          1465.0,    1465.0,    1458.0,    1458.0,    1451.0,    1443.0,
+          1437.0,    1431.0,    1424.0,    1418.0,    1410.0,    1410.0,
+          1410.0,    1402.0,    1395.0,    1387.0,    1380.0,    1374.0,
+          1368.0,    1362.0,    1356.0,    1350.0,    1344.0,    1339.0,
+          1333.0,    1328.0,    1323.0,    1323.0,    1312.0,    1312.0,
+          1312.0,    1305.0,    1298.0,    1298.0,    1298.0,    1292.0,
+          1287.0,    1287.0,    1287.0,    1281.0,    1276.0,    1271.0,
+          1266.0,    1260.0,    1254.0,    1249.0,    1244.0,    1238.0,
+          1233.0,    1233.0,    1223.0,    1223.0,    1223.0,    1223.0,
+          1217.0,    1212.0,    1206.0,    1200.0,    1192.0,    1187.0,
+          1182.0,    1176.0,    1169.0,    1164.0,    1159.0,    1159.0,
+          1155.0,    1150.0,    1144.0,    1141.0,    1141.0,    1141.0,
+          1141.0,    1141.0,    1141.0,    1141.0,    1135.0,    1135.0,
+          1129.0,    1124.0,    1119.0,    1119.0,    1113.0,    1107.0,
+          1107.0,    1102.0,    1097.0,    1090.0,    1084.0,    1079.0,
+          1075.0,    1069.0,    1064.0,    1059.0,    1053.0,    1049.0,
+          1045.0,    1041.0,    1041.0,    1036.0,    1036.0,    1033.0,
+          1028.0,    1022.0,    1022.0,    1022.0,    1018.0,    1012.0,
+          1012.0,    1008.0,    1003.0,     998.0,     994.0,     987.0,
+           977.0,     973.0,     969.0,     964.0,     960.0,     955.0,
+           951.0,     947.0,     943.0,     943.0,     940.0,     937.0,
+           937.0,     937.0,     933.0,     933.0,     929.0,     924.0,
+           921.0,     916.0,     910.0,     905.0,     905.0,     900.0,
+           900.0,     896.0,     892.0,     886.0,     881.0,     876.0,
+           871.0,     867.0,     863.0,     859.0,     855.0,     851.0,
+           848.0,     848.0,     845.0,     841.0,     837.0,     835.0,
+           831.0,     831.0,     826.0,     822.0,     817.0,     817.0,
+           813.0,     809.0,     806.0,     802.0,     798.0,     793.0,
+           789.0,     789.0,     784.0,     784.0,     784.0,     781.0,
+           781.0,     778.0,     778.0,     778.0,     774.0,     770.0,
+           766.0,     762.0,     762.0,     759.0,     755.0,     748.0,
+           748.0,     745.0,     741.0,     738.0,     735.0,     735.0,
+           735.0,     735.0,     731.0,     731.0,     731.0,     731.0,
+           728.0,     725.0,     722.0,     719.0,     715.0,     711.0,
+           711.0,     708.0,     708.0,     705.0,     702.0,     699.0,
+           695.0,     692.0,     689.0,     686.0,     683.0,     680.0,
+           676.0,     672.0,     669.0,     665.0,     662.0,     659.0,
+           656.0,     653.0,     649.0,     646.0,     646.0,     642.0,
+           638.0,     638.0,     635.0,     635.0,     632.0,     629.0,
+           629.0,     626.0,     623.0,     620.0,     620.0,     619.0,
+           616.0,     614.0,     611.0,     608.0,     608.0,     605.0,
+           602.0,     602.0,     599.0,     596.0,     593.0,     591.0,
+           589.0,     586.0,     583.0,     580.0,     577.0,     574.0,
+           571.0,     569.0,     566.0,     563.0,     559.0,     557.0,
+           555.0,     555.0,     552.0,     550.0,     548.0,     544.0,
+           541.0,     541.0,     538.0,     538.0,     538.0,     538.0,
+           535.0,     532.0,     529.0,     525.0,     522.0,     520.0,
+           518.0,     518.0,     516.0,     513.0,     513.0,     510.0,
+           510.0,     508.0,     506.0,     504.0,     504.0,     502.0,
+           499.0,     497.0,     494.0,     492.0,     492.0,     489.0,
+           486.0,     484.0,     482.0,     479.0,     479.0,     477.0,
+           475.0,     473.0,     471.0,     469.0,     466.0,     463.0,
+           460.0,     458.0,     458.0,     456.0,     454.0,     454.0,
+           451.0,     448.0,     448.0,     446.0,     443.0,     440.0,
+           437.0,     437.0,     434.0,     431.0,     428.0,     426.0,
+           424.0,     420.0,     417.0,     413.0,     413.0,     411.0,
+           411.0,     409.0,     406.0,     403.0,     401.0,     399.0,
+           397.0,     395.0,     392.0,     392.0,     389.0,     387.0,
+           385.0,     385.0,     385.0,     382.0,     380.0,     377.0,
+           372.0,     369.0,     367.0,     367.0,     367.0,     367.0,
+           365.0,     362.0,     362.0,     359.0,     356.0,     354.0,
+           354.0,     352.0,     350.0,     348.0,     346.0,     344.0,
+           342.0,     340.0,     338.0,     338.0,     336.0,     334.0,
+           334.0,     334.0,     334.0,     332.0,     330.0,     328.0,
+           326.0,     326.0,     326.0,     322.0,     320.0,     318.0,
+           316.0,     314.0,     312.0,     312.0,     310.0,     310.0,
+           308.0,     306.0,     306.0,     304.0,     304.0,     302.0,
+           300.0,     300.0,     300.0,     298.0,     298.0,     296.0,
+           294.0,     292.0,     290.0,     288.0,     288.0,     286.0,
+           284.0,     282.0,     280.0,     280.0,     278.0,     275.0,
+           273.0,     273.0,     271.0,     271.0,     271.0,     271.0,
+           271.0,     271.0,     269.0,     269.0,     269.0,     267.0,
+           265.0,     263.0,     261.0,     261.0,     261.0,     258.0,
+           256.0,     253.0,     251.0,     249.0,     247.0,     245.0,
+           243.0,     243.0,     241.0,     239.0,     237.0,     235.0,
+           233.0,     231.0,     229.0,     227.0,     225.0,     223.0,
+           223.0,     221.0,     219.0,     217.0,     215.0,     213.0,
+           213.0,     209.0,     207.0,     207.0,     207.0,     207.0,
+           207.0,     207.0,     207.0,     207.0,     207.0,     207.0,
+           204.0,     203.0,     201.0,     200.0,     199.0,     199.0,
+           199.0,     198.0,     198.0,     196.0,     194.0,     193.0,
+           192.0,     192.0,     191.0,     191.0,     189.0,     188.0,
+           186.0,     184.0,     184.0,     182.0,     181.0,     180.0,
+           179.0,     179.0,     178.0,     176.0,     176.0,     175.0,
+           175.0,     173.0,     172.0,     170.0,     169.0,     167.0,
+           166.0,     166.0,     165.0,     164.0,     163.0,     162.0,
+           160.0,     158.0,     158.0,     156.0,     156.0,     156.0,
+           155.0,     154.0,     154.0,     153.0,     153.0,     152.0,
+           150.0,     148.0,     147.0,     145.0,     143.0,     141.0,
+           140.0,     139.0,     138.0,     136.0,     134.0,     134.0,
+           132.0,     132.0,     130.0,     130.0,     130.0,     130.0,
+           129.0,     129.0,     127.0,     126.0,     125.0,     124.0,
+           124.0,     124.0,     124.0,     124.0,     124.0,     123.0,
+           121.0,     119.0,     119.0,     117.0,     115.0,     114.0,
+           112.0,     111.0,     108.0,     108.0,     106.0,     105.0,
+           102.0,     101.0,      99.0,      97.0,      96.0,      96.0,
+            93.0,      91.0,      91.0,      90.0,      88.0,      87.0,
+            84.0,      82.0,      81.0,      81.0,      81.0,      81.0,
+            80.0,      79.0,      79.0,      78.0,      78.0,      78.0,
+            76.0,      75.0,      75.0,      75.0,      75.0,      73.0,
+            71.0,      70.0,      69.0,      68.0,      66.0,      66.0,
+            65.0,      64.0,      63.0,      62.0,      62.0,      61.0,
+            61.0,      59.0,      58.0,      58.0,      58.0,      57.0,
+            56.0,      55.0,      54.0,      53.0,      53.0,      52.0,
+            50.0,      49.0,      47.0,      45.0,      44.0,      43.0,
+            42.0,      41.0,      40.0,      40.0,      37.0,      36.0,
+            34.0,      33.0,      33.0,      32.0,      30.0,      30.0,
+            29.0,      27.0,      26.0,      25.0,      25.0,      25.0,
+            25.0,      23.0,      21.0,      20.0,      20.0,      20.0,
+            19.0,      18.0,      18.0,      16.0,      15.0,      14.0,
+            13.0,      12.0,      11.0,      10.0,       9.0,       8.0,
+             6.0,       5.0,       4.0,       2.0,       1.0,       1.0,
+             1.0,       0.0,       0.0,       0.0},
+   {
+         14436.0,    5350.0,    2335.0,    1850.0,    1380.0,    1196.0,
+          1196.0,     519.0,     501.0,     438.0,     139.0,     139.0,
+           130.0,      98.0,      98.0,      98.0,      87.0,      87.0,
+            87.0,      87.0,      77.0,      66.0,      66.0,      55.0,
+            55.0,      45.0,      45.0,      45.0,      45.0,      44.0,
+             2.0,       2.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0,       0.0,       0.0,
+             0.0,       0.0,       0.0,       0.0}};
+
+/********iau2000a_fast */
+
+void iau2000a_fast (double jd_high, double jd_low,
+
+                    double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth based on
+      the IAU 2000A nutation model, with vector instructions.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
+
+   INPUT
+   ARGUMENTS:
+      jd_high (double)
+         High-order part of TT Julian date.
+      jd_low (double)
+         Low-order part of TT Julian date.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation (luni-solar + planetary) in longitude, in radians.
+      *deps (double)
+         Nutation (luni-solar + planetary) in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, TWOPI
+      A_LS_MULT, A_LS_COEF   nutation_fast.c
+      A_PL_MULT, A_PL_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      fund_args    novas.c
+      series_ls    nutation_fast.c
+      series_pl    nutation_fast.c
+      fmod         math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'iau2000a'.  The terms are summed
+      in a different order and the sines and cosines are computed with
+      polynomials, so the result differs from 'iau2000a' by far less
+      than 1 microarcsecond.
+
+------------------------------------------------------------------------
+*/
+{
+   double t, a[5], p[14], dp, de, factor, dpsils, depsls;
+
+/*
+   Interval between fundamental epoch J2000.0 and given date.
+*/
+
+   t = ((jd_high - T0) + jd_low) / 36525.0;
+
+/*
+   ** Luni-solar nutation. **
+*/
+
+   fund_args (t, a);
+
+   series_ls (678, 678, &A_LS_MULT[0][0], &A_LS_COEF[0][0], a, t, &dp,
+      &de);
+
+   factor = 1.0e-7 * ASEC2RAD;
+   dpsils = dp * factor;
+   depsls = de * factor;
+
+/*
+   ** Planetary nutation. **
+
+   Arguments as in 'iau2000a': Delaunay arguments (MHB2000), planetary
+   longitudes (Souchay et al. 1999) and general precession.
+*/
+
+   p[0] = fmod (2.35555598 + 8328.6914269554 * t, TWOPI);
+   p[1] = fmod (6.24006013 + 628.301955 * t, TWOPI);
+   p[2] = fmod (1.627905234 + 8433.466158131 * t, TWOPI);
+   p[3] = fmod (5.198466741 + 7771.3771468121 * t, TWOPI);
+   p[4] = fmod (2.18243920 - 33.757045 * t, TWOPI);
+   p[5] = fmod (4.402608842 + 2608.7903141574 * t, TWOPI);
+   p[6] = fmod (3.176146697 + 1021.3285546211 * t, TWOPI);
+   p[7] = fmod (1.753470314 +  628.3075849991 * t, TWOPI);
+   p[8] = fmod (6.203480913 +  334.0612426700 * t, TWOPI);
+   p[9] = fmod (0.599546497 +   52.9690962641 * t, TWOPI);
+   p[10] = fmod (0.874016757 +   21.3299104960 * t, TWOPI);
+   p[11] = fmod (5.481293871 +    7.4781598567 * t, TWOPI);
+   p[12] = fmod (5.321159000 +    3.8127774000 * t, TWOPI);
+   p[13] = (0.02438175 + 0.00000538691 * t) * t;
+
+   series_pl (687, 687, &A_PL_MULT[0][0], &A_PL_COEF[0][0], p, &dp, &de);
+
+/*
+   Total: Add planetary and luni-solar components.
+*/
+
+   *dpsi = dp * factor + dpsils;
+   *deps = de * factor + depsls;
+
+   return;
+}
+
+/********iau2000b_fast */
+
+void iau2000b_fast (double jd_high, double jd_low,
+
+                    double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth based on
+      the IAU 2000B precession/nutation model, with vector
+      instructions.
+
+   REFERENCES:
+      McCarthy, D. and Luzum, B. (2003). "An Abridged Model of the
+         Precession & Nutation of the Celestial Pole," Celestial
+         Mechanics and Dynamical Astronomy, Volume 85, Issue 1,
+         Jan. 2003, p. 37. (IAU 2000B)
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      jd_high (double)
+         High-order part of TT Julian date.
+      jd_low (double)
+         Low-order part of TT Julian date.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation (luni-solar + planetary) in longitude, in radians.
+      *deps (double)
+         Nutation (luni-solar + planetary) in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, ASEC360
+      A_LS_MULT, A_LS_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      series_ls    nutation_fast.c
+      fmod         math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'iau2000b', whose 77 luni-solar
+      terms are the first 77 terms of IAU 2000A.  See note 1 of
+      'iau2000a_fast'.
+
+------------------------------------------------------------------------
+*/
+{
+   double t, a[5], dp, de, factor;
+
+/*
+   Interval between fundamental epoch J2000.0 and given date.
+*/
+
+   t = ((jd_high - T0) + jd_low) / 36525.0;
+
+/*
+   ** Luni-solar nutation. **
+
+   Fundamental (Delaunay) arguments from Simon et al. (1994), in
+   radians, as in 'iau2000b'.
+*/
+
+   a[0] = fmod (485868.249036 +
+             t * 1717915923.2178, ASEC360) * ASEC2RAD;
+   a[1] = fmod (1287104.79305 +
+             t * 129596581.0481, ASEC360) * ASEC2RAD;
+   a[2] = fmod (335779.526232 +
+             t * 1739527262.8478, ASEC360) * ASEC2RAD;
+   a[3] = fmod (1072260.70369 +
+             t * 1602961601.2090, ASEC360) * ASEC2RAD;
+   a[4] = fmod (450160.398036 -
+             t * 6962890.5431, ASEC360) * ASEC2RAD;
+
+   series_ls (77, 678, &A_LS_MULT[0][0], &A_LS_COEF[0][0], a, t, &dp,
+      &de);
+
+/*
+   Total: luni-solar terms plus the fixed planetary terms (arcsec) of
+   'iau2000b'.
+*/
+
+   factor = 1.0e-7 * ASEC2RAD;
+   *dpsi = -0.000135 * ASEC2RAD + dp * factor;
+   *deps =  0.000388 * ASEC2RAD + de * factor;
+
+   return;
+}
+
+/********nu2000k_fast */
+
+void nu2000k_fast (double jd_high, double jd_low,
+
+                   double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth with the
+      NU2000K model, with vector instructions.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
+
+   INPUT
+   ARGUMENTS:
+      jd_high (double)
+         High-order part of TT Julian date.
+      jd_low (double)
+         Low-order part of TT Julian date.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation (luni-solar + planetary) in longitude, in radians.
+      *deps (double)
+         Nutation (luni-solar + planetary) in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, TWOPI
+      K_LS_MULT, K_LS_COEF   nutation_fast.c
+      K_PL_MULT, K_PL_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      fund_args    novas.c
+      series_ls    nutation_fast.c
+      series_pl    nutation_fast.c
+      fmod         math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'nu2000k'.  See note 1 of
+      'iau2000a_fast'.
+
+------------------------------------------------------------------------
+*/
+{
+   double t, a[5], p[14], dp, de, factor, dpsils, depsls;
+   short int i;
+
+/*
+   Interval between fundamental epoch J2000.0 and given date.
+*/
+
+   t = ((jd_high - T0) + jd_low) / 36525.0;
+
+/*
+   ** Luni-solar nutation. **
+*/
+
+   fund_args (t, a);
+
+   series_ls (323, 323, &K_LS_MULT[0][0], &K_LS_COEF[0][0], a, t, &dp,
+      &de);
+
+   factor = 1.0e-7 * ASEC2RAD;
+   dpsils = dp * factor;
+   depsls = de * factor;
+
+/*
+   ** Planetary nutation. **
+
+   Arguments as in 'nu2000k': fundamental arguments, planetary
+   longitudes (Simon et al. 1994) and general precession.
+*/
+
+   for (i = 0; i < 5; i++)
+      p[i] = a[i];
+   p[5] = fmod (4.402608842461 + 2608.790314157421 * t, TWOPI);
+   p[6] = fmod (3.176146696956 + 1021.328554621099 * t, TWOPI);
+   p[7] = fmod (1.753470459496 +  628.307584999142 * t, TWOPI);
+   p[8] = fmod (6.203476112911 +  334.061242669982 * t, TWOPI);
+   p[9] = fmod (0.599547105074 +   52.969096264064 * t, TWOPI);
+   p[10] = fmod (0.874016284019 +   21.329910496032 * t, TWOPI);
+   p[11] = fmod (5.481293871537 +    7.478159856729 * t, TWOPI);
+   p[12] = fmod (5.311886286677 +    3.813303563778 * t, TWOPI);
+   p[13] = (0.024380407358 + 0.000005391235 * t) * t;
+
+   series_pl (165, 165, &K_PL_MULT[0][0], &K_PL_COEF[0][0], p, &dp, &de);
+
+/*
+   Total: Add planetary and luni-solar components.
+*/
+
+   *dpsi = dp * factor + dpsils;
+   *deps = de * factor + depsls;
+
+   return;
+}
+
+/********iau2000a_batch */
+
+void iau2000a_batch (long int n, double jd_high, const double *jd_low,
+                     short int kernel,
+
+                     double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth based on
+      the IAU 2000A nutation model for an array of dates, evaluating
+      each term for a block of dates at once.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of dates.
+      jd_high (double)
+         High-order part of the TT Julian dates, common to all dates.
+      *jd_low (double)
+         Low-order parts of the TT Julian dates ('n' values).
+      kernel (short int)
+         NUTATION_KERNEL_SCALAR or NUTATION_KERNEL_VECTOR (see
+         'set_nutation_kernel').
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation (luni-solar + planetary) in longitude, in radians
+         ('n' values).
+      *deps (double)
+         Nutation (luni-solar + planetary) in obliquity, in radians
+         ('n' values).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, TWOPI
+      A_LS_MULT, A_LS_COEF   nutation_fast.c
+      A_PL_MULT, A_PL_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      fund_args      novas.c
+      series_ls_dates nutation_fast.c
+      series_pl_dates nutation_fast.c
+      fmod           math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The dates are taken NUT_BLOCK at a time, and each term is
+      evaluated for all the dates of the block in one loop, the dates
+      being the vector lanes (see 'series_ls_dates').
+      2. With NUTATION_KERNEL_SCALAR the results are identical to those
+      of 'iau2000a' with that kernel: the terms are summed in the same
+      order, and the sines and cosines come from 'sin' and 'cos'.  With
+      NUTATION_KERNEL_VECTOR they come from the vectorized polynomial,
+      and the results differ from those of
+      'iau2000a' by far less than 1 microarcsecond.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, m, j, k;
+
+   double t[NUT_BLOCK], a[5 * NUT_BLOCK], p[14 * NUT_BLOCK], fa[5];
+   double dp[NUT_BLOCK], de[NUT_BLOCK], dp_pl[NUT_BLOCK];
+   double de_pl[NUT_BLOCK], factor, tj;
+
+   factor = 1.0e-7 * ASEC2RAD;
+
+   for (first = 0; first < n; first += NUT_BLOCK)
+   {
+      m = (n - first < NUT_BLOCK) ? n - first : NUT_BLOCK;
+
+/*
+   Arguments of each date of the block, as in 'iau2000a_fast', one row
+   per argument.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         tj = t[j] = ((jd_high - T0) + jd_low[first + j]) / 36525.0;
+
+         fund_args (tj, fa);
+         for (k = 0; k < 5; k++)
+            a[k * NUT_BLOCK + j] = fa[k];
+
+         p[j] = fmod (2.35555598 + 8328.6914269554 * tj, TWOPI);
+         p[NUT_BLOCK + j] = fmod (6.24006013 + 628.301955 * tj, TWOPI);
+         p[2 * NUT_BLOCK + j] =
+            fmod (1.627905234 + 8433.466158131 * tj, TWOPI);
+         p[3 * NUT_BLOCK + j] =
+            fmod (5.198466741 + 7771.3771468121 * tj, TWOPI);
+         p[4 * NUT_BLOCK + j] = fmod (2.18243920 - 33.757045 * tj, TWOPI);
+         p[5 * NUT_BLOCK + j] =
+            fmod (4.402608842 + 2608.7903141574 * tj, TWOPI);
+         p[6 * NUT_BLOCK + j] =
+            fmod (3.176146697 + 1021.3285546211 * tj, TWOPI);
+         p[7 * NUT_BLOCK + j] =
+            fmod (1.753470314 +  628.3075849991 * tj, TWOPI);
+         p[8 * NUT_BLOCK + j] =
+            fmod (6.203480913 +  334.0612426700 * tj, TWOPI);
+         p[9 * NUT_BLOCK + j] =
+            fmod (0.599546497 +   52.9690962641 * tj, TWOPI);
+         p[10 * NUT_BLOCK + j] =
+            fmod (0.874016757 +   21.3299104960 * tj, TWOPI);
+         p[11 * NUT_BLOCK + j] =
+            fmod (5.481293871 +    7.4781598567 * tj, TWOPI);
+         p[12 * NUT_BLOCK + j] =
+            fmod (5.321159000 +    3.8127774000 * tj, TWOPI);
+         p[13 * NUT_BLOCK + j] = (0.02438175 + 0.00000538691 * tj) * tj;
+      }
+
+      series_ls_dates (m, 678, 678, &A_LS_MULT[0][0], &A_LS_COEF[0][0], a,
+         t, kernel, dp, de);
+      series_pl_dates (m, 687, 687, &A_PL_MULT[0][0], &A_PL_COEF[0][0], p,
+         kernel, dp_pl, de_pl);
+
+/*
+   Total: Add planetary and luni-solar components.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         dpsi[first + j] = dp_pl[j] * factor + dp[j] * factor;
+         deps[first + j] = de_pl[j] * factor + de[j] * factor;
+      }
+   }
+
+   return;
+}
+
+/********iau2000b_batch */
+
+void iau2000b_batch (long int n, double jd_high, const double *jd_low,
+                     short int kernel,
+
+                     double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth based on
+      the IAU 2000B precession/nutation model for an array of dates,
+      evaluating each term for a block of dates at once.
+
+   REFERENCES:
+      McCarthy, D. and Luzum, B. (2003). "An Abridged Model of the
+         Precession & Nutation of the Celestial Pole," Celestial
+         Mechanics and Dynamical Astronomy, Volume 85, Issue 1,
+         Jan. 2003, p. 37. (IAU 2000B)
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      See function 'iau2000a_batch'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'iau2000a_batch'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, ASEC360
+      A_LS_MULT, A_LS_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      series_ls_dates nutation_fast.c
+      fmod           math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'iau2000b'.  See the notes of
+      'iau2000a_batch'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, m, j;
+
+   double t[NUT_BLOCK], a[5 * NUT_BLOCK], dp[NUT_BLOCK], de[NUT_BLOCK];
+   double factor, tj;
+
+   factor = 1.0e-7 * ASEC2RAD;
+
+   for (first = 0; first < n; first += NUT_BLOCK)
+   {
+      m = (n - first < NUT_BLOCK) ? n - first : NUT_BLOCK;
+
+/*
+   Fundamental (Delaunay) arguments of each date of the block, as in
+   'iau2000b'.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         tj = t[j] = ((jd_high - T0) + jd_low[first + j]) / 36525.0;
+
+         a[j] = fmod (485868.249036 +
+                   tj * 1717915923.2178, ASEC360) * ASEC2RAD;
+         a[NUT_BLOCK + j] = fmod (1287104.79305 +
+                   tj * 129596581.0481, ASEC360) * ASEC2RAD;
+         a[2 * NUT_BLOCK + j] = fmod (335779.526232 +
+                   tj * 1739527262.8478, ASEC360) * ASEC2RAD;
+         a[3 * NUT_BLOCK + j] = fmod (1072260.70369 +
+                   tj * 1602961601.2090, ASEC360) * ASEC2RAD;
+         a[4 * NUT_BLOCK + j] = fmod (450160.398036 -
+                   tj * 6962890.5431, ASEC360) * ASEC2RAD;
+      }
+
+      series_ls_dates (m, 77, 678, &A_LS_MULT[0][0], &A_LS_COEF[0][0], a,
+         t, kernel, dp, de);
+
+/*
+   Total: luni-solar terms plus the fixed planetary terms (arcsec) of
+   'iau2000b'.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         dpsi[first + j] = -0.000135 * ASEC2RAD + dp[j] * factor;
+         deps[first + j] =  0.000388 * ASEC2RAD + de[j] * factor;
+      }
+   }
+
+   return;
+}
+
+/********nu2000k_batch */
+
+void nu2000k_batch (long int n, double jd_high, const double *jd_low,
+                    short int kernel,
+
+                    double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth with the
+      NU2000K model for an array of dates, evaluating each term for a
+      block of dates at once.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
+
+   INPUT
+   ARGUMENTS:
+      See function 'iau2000a_batch'.
+
+   OUTPUT
+   ARGUMENTS:
+      See function 'iau2000a_batch'.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, TWOPI
+      K_LS_MULT, K_LS_COEF   nutation_fast.c
+      K_PL_MULT, K_PL_COEF   nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      fund_args      novas.c
+      series_ls_dates nutation_fast.c
+      series_pl_dates nutation_fast.c
+      fmod           math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'nu2000k'.  See the notes of
+      'iau2000a_batch'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, m, j, k;
+
+   double t[NUT_BLOCK], p[14 * NUT_BLOCK], fa[5];
+   double dp[NUT_BLOCK], de[NUT_BLOCK], dp_pl[NUT_BLOCK];
+   double de_pl[NUT_BLOCK], factor, tj;
+
+   factor = 1.0e-7 * ASEC2RAD;
+
+   for (first = 0; first < n; first += NUT_BLOCK)
+   {
+      m = (n - first < NUT_BLOCK) ? n - first : NUT_BLOCK;
+
+/*
+   Arguments of each date of the block, as in 'nu2000k_fast'; the
+   luni-solar series uses the first five rows.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         tj = t[j] = ((jd_high - T0) + jd_low[first + j]) / 36525.0;
+
+         fund_args (tj, fa);
+         for (k = 0; k < 5; k++)
+            p[k * NUT_BLOCK + j] = fa[k];
+
+         p[5 * NUT_BLOCK + j] =
+            fmod (4.402608842461 + 2608.790314157421 * tj, TWOPI);
+         p[6 * NUT_BLOCK + j] =
+            fmod (3.176146696956 + 1021.328554621099 * tj, TWOPI);
+         p[7 * NUT_BLOCK + j] =
+            fmod (1.753470459496 +  628.307584999142 * tj, TWOPI);
+         p[8 * NUT_BLOCK + j] =
+            fmod (6.203476112911 +  334.061242669982 * tj, TWOPI);
+         p[9 * NUT_BLOCK + j] =
+            fmod (0.599547105074 +   52.969096264064 * tj, TWOPI);
+         p[10 * NUT_BLOCK + j] =
+            fmod (0.874016284019 +   21.329910496032 * tj, TWOPI);
+         p[11 * NUT_BLOCK + j] =
+            fmod (5.481293871537 +    7.478159856729 * tj, TWOPI);
+         p[12 * NUT_BLOCK + j] =
+            fmod (5.311886286677 +    3.813303563778 * tj, TWOPI);
+         p[13 * NUT_BLOCK + j] =
+            (0.024380407358 + 0.000005391235 * tj) * tj;
+      }
+
+      series_ls_dates (m, 323, 323, &K_LS_MULT[0][0], &K_LS_COEF[0][0], p,
+         t, kernel, dp, de);
+      series_pl_dates (m, 165, 165, &K_PL_MULT[0][0], &K_PL_COEF[0][0], p,
+         kernel, dp_pl, de_pl);
+
+/*
+   Total: Add planetary and luni-solar components.
+*/
+
+      for (j = 0; j < m; j++)
+      {
+         dpsi[first + j] = dp_pl[j] * factor + dp[j] * factor;
+         deps[first + j] = de_pl[j] * factor + de[j] * factor;
+      }
+   }
+
+   return;
+}
+
+/********iau2000a_trunc */
+
+void iau2000a_trunc (double jd_high, double jd_low, double tolerance,
+
+                     double *dpsi, double *deps)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      To compute the forced nutation of the non-rigid Earth with the
+      IAU 2000A model truncated to a given accuracy: the terms are
+      taken in decreasing order of amplitude until the sum of the
+      amplitudes of the rest is below 'tolerance'.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+      Simon et al. (1994) Astronomy and Astrophysics 282, 663-683,
+         esp. Sections 3.4-3.5.
+
+   INPUT
+   ARGUMENTS:
+      jd_high (double)
+         High-order part of TT Julian date.
+      jd_low (double)
+         Low-order part of TT Julian date.
+      tolerance (double)
+         Largest difference allowed with the full IAU 2000A series, in
+         each of 'dpsi' and 'deps', in microarcseconds.
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation (luni-solar + planetary) in longitude, in radians.
+      *deps (double)
+         Nutation (luni-solar + planetary) in obliquity, in radians.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD, TWOPI
+      TRUNC_LS_MULT, TRUNC_LS_COEF   nutation_fast.c
+      TRUNC_PL_MULT, TRUNC_PL_COEF   nutation_fast.c
+      TRUNC_LS_COUNT, TRUNC_REST     nutation_fast.c
+
+   FUNCTIONS
+   CALLED:
+      fund_args    novas.c
+      series_ls    nutation_fast.c
+      series_pl    nutation_fast.c
+      fmod         math.h
+      fabs         math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same model and arguments as 'iau2000a'.  The bound is strict
+      (sum of absolute values), so it is reached with more terms than a
+      statistical estimate would suggest: about 85 terms for 10
+      milliarcseconds, 440 for 1 milliarcsecond and 1060 for 100
+      microarcseconds.  A tolerance of 0 uses all 1365 terms.
+      2. The selected terms are the first ones of the amplitude-sorted
+      copies of the luni-solar and planetary tables, so they are summed
+      with the same vector kernel as 'iau2000a_fast', and a tolerance
+      never costs more than the full series.  The sines and cosines
+      come from the vectorized polynomial whatever kernel is selected.
+
+------------------------------------------------------------------------
+*/
+{
+   long int lo, hi, mid, n_ls;
+
+   double t, abs_t, a[5], p[14], limit, dp, de, dp_pl, de_pl, factor;
+
+/*
+   Interval between fundamental epoch J2000.0 and given date.
+*/
+
+   t = ((jd_high - T0) + jd_low) / 36525.0;
+   abs_t = fabs (t);
+
+/*
+   Number of terms: the first position from which the rest of the
+   series is within the tolerance (the bounds never increase).
+*/
+
+   limit = 10.0 * tolerance;
+   lo = 0;
+   hi = 1365;
+   while (lo < hi)
+   {
+      mid = (lo + hi) / 2;
+      if ((TRUNC_REST[0][mid] + TRUNC_REST[1][mid] * abs_t <= limit) &&
+         (TRUNC_REST[2][mid] + TRUNC_REST[3][mid] * abs_t <= limit))
+         hi = mid;
+       else
+         lo = mid + 1;
+   }
+
+/*
+   Arguments as in 'iau2000a' (see 'iau2000a_fast').
+*/
+
+   fund_args (t, a);
+
+   p[0] = fmod (2.35555598 + 8328.6914269554 * t, TWOPI);
+   p[1] = fmod (6.24006013 + 628.301955 * t, TWOPI);
+   p[2] = fmod (1.627905234 + 8433.466158131 * t, TWOPI);
+   p[3] = fmod (5.198466741 + 7771.3771468121 * t, TWOPI);
+   p[4] = fmod (2.18243920 - 33.757045 * t, TWOPI);
+   p[5] = fmod (4.402608842 + 2608.7903141574 * t, TWOPI);
+   p[6] = fmod (3.176146697 + 1021.3285546211 * t, TWOPI);
+   p[7] = fmod (1.753470314 +  628.3075849991 * t, TWOPI);
+   p[8] = fmod (6.203480913 +  334.0612426700 * t, TWOPI);
+   p[9] = fmod (0.599546497 +   52.9690962641 * t, TWOPI);
+   p[10] = fmod (0.874016757 +   21.3299104960 * t, TWOPI);
+   p[11] = fmod (5.481293871 +    7.4781598567 * t, TWOPI);
+   p[12] = fmod (5.321159000 +    3.8127774000 * t, TWOPI);
+   p[13] = (0.02438175 + 0.00000538691 * t) * t;
+
+/*
+   Summation of the selected terms of each series.
+*/
+
+   n_ls = TRUNC_LS_COUNT[lo];
+
+   series_ls (n_ls, 678, &TRUNC_LS_MULT[0][0], &TRUNC_LS_COEF[0][0], a, t,
+      &dp, &de);
+   series_pl (lo - n_ls, 687, &TRUNC_PL_MULT[0][0], &TRUNC_PL_COEF[0][0], p,
+      &dp_pl, &de_pl);
+
+/*
+   Convert from 0.1 microarcsec units to radians.
+*/
+
+   factor = 1.0e-7 * ASEC2RAD;
+   *dpsi = (dp_pl + dp) * factor;
+   *deps = (de_pl + de) * factor;
+
+   return;
+}
+
+/********sincos_array */
+
+NUT_TARGET_CLONES
+void sincos_array (long int n, const double *x,
+
+                   double *s, double *c)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the sines and cosines of an array of
+      angles with the vectorized kernel of the nutation series, for use
+      by other series of the library (see 'solarsystem_analytic_batch').
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of angles.
+      *x (double)
+         Angles in radians, |x| < 1.0e6.
+
+   OUTPUT
+   ARGUMENTS:
+      *s (double)
+         Sines of the angles.
+      *c (double)
+         Cosines of the angles.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      sincos_block   nutation_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The results agree with 'sin' and 'cos' to a few units of
+      1.0e-16 (see 'sincos_block').
+
+------------------------------------------------------------------------
+*/
+{
+   sincos_block (n, x, s, c);
+
+   return;
+}
+
+/********mean_obliq_array */
+
+NUT_TARGET_CLONES
+void mean_obliq_array (long int n, const double *jd_tdb,
+
+                       double *mobl)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the mean obliquity of the ecliptic for an
+      array of dates, as 'mean_obliq', in a loop the compiler can
+      vectorize (see 'mean_obliq_batch' and 'e_tilt_batch').
+
+   REFERENCES:
+      Capitaine et al. (2003), Astronomy and Astrophysics 412, 567-586.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of dates.
+      *jd_tdb (double)
+         TDB Julian dates ('n' values).
+
+   OUTPUT
+   ARGUMENTS:
+      *mobl (double)
+         Mean obliquity of the ecliptic in arcseconds ('n' values).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0                 novascon.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same expression as 'mean_obliq'; the results are identical.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i;
+
+   double t;
+
+   for (i = 0; i < n; i++)
+   {
+      t = (jd_tdb[i] - T0) / 36525.0;
+
+      mobl[i] = (((( -  0.0000000434   * t
+                     -  0.000000576  ) * t
+                     +  0.00200340   ) * t
+                     -  0.0001831    ) * t
+                     - 46.836769     ) * t + 84381.406;
+   }
+
+   return;
+}
+
+/********sincos_block */
+
+static inline void sincos_block (long int n, const double *x,
+
+                                 double *s, double *c)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the sines and cosines of 'n' angles, in a
+      loop the compiler can vectorize.
+
+   REFERENCES:
+      Cody, W.J. and Waite, W. (1980). Software Manual for the
+         Elementary Functions, Prentice-Hall.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of angles.
+      *x (double)
+         Angles in radians, |x| < 1.0e6.
+
+   OUTPUT
+   ARGUMENTS:
+      *s (double)
+         Sines of the angles.
+      *c (double)
+         Cosines of the angles.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The angle is reduced to [-pi/4, pi/4] by subtracting the
+      nearest multiple of pi/2 in three parts (Cody-Waite), and the
+      sine and cosine of the remainder are computed with the minimax
+      polynomials of the fdlibm kernels.  The absolute error is a few
+      units of 1.0e-16.
+
+------------------------------------------------------------------------
+*/
+{
+   const double two_over_pi = 6.36619772367581382433e-01;
+   const double round = 6755399441055744.0;
+   const double pio2_1 = 1.57079632673412561417e+00;
+   const double pio2_2 = 6.07710050630396597660e-11;
+   const double pio2_3 = 2.02226624871116645580e-21;
+
+   long int i;
+
+   int q;
+
+   double k, r, z, sr, cr, sx, cx;
+
+   for (i = 0; i < n; i++)
+   {
+
+/*
+   Quadrant and remainder.
+*/
+
+      k = (x[i] * two_over_pi + round) - round;
+      q = (int) k;
+      r = ((x[i] - k * pio2_1) - k * pio2_2) - k * pio2_3;
+
+/*
+   Sine and cosine of the remainder.
+*/
+
+      z = r * r;
+      sr = r + r * z * (-1.66666666666666324348e-01 + z *
+         (8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 +
+         z * (2.75573137070700676789e-06 + z *
+         (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+      cr = 1.0 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z *
+         (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05 +
+         z * (-2.75573143513906633035e-07 + z *
+         (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+
+/*
+   Undo the quadrant reduction.
+*/
+
+      sx = (q & 1) ? cr : sr;
+      cx = (q & 1) ? sr : cr;
+      s[i] = (q & 2) ? -sx : sx;
+      c[i] = ((q + 1) & 2) ? -cx : cx;
+   }
+
+   return;
+}
+
+/********series_ls */
+
+NUT_TARGET_CLONES
+static void series_ls (long int n, long int ld, const signed char *mult,
+                       const double *coef, const double *a, double t,
+
+                       double *dp, double *de)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sums the first 'n' terms of a luni-solar nutation
+      series stored as a structure of arrays.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of terms to sum.
+      ld (long int)
+         Number of terms of the table (length of each row).
+      *mult (signed char)
+         5 rows of 'ld' argument multipliers (L, L', F, D, Om).
+      *coef (double)
+         6 rows of 'ld' coefficients, in 0.1 microarcseconds, as
+         'cls_t' in 'iau2000a'.
+      *a (double)
+         5 fundamental arguments, in radians.
+      t (double)
+         TDB time in Julian centuries since J2000.0.
+
+   OUTPUT
+   ARGUMENTS:
+      *dp (double)
+         Nutation in longitude, in 0.1 microarcseconds.
+      *de (double)
+         Nutation in obliquity, in 0.1 microarcseconds.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      sincos_block   nutation_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The terms are accumulated in NUT_LANES partial sums, added at
+      the end.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, len, i, j;
+
+   double arg[NUT_BLOCK], s[NUT_BLOCK], c[NUT_BLOCK];
+   double tp[NUT_BLOCK], te[NUT_BLOCK];
+   double sum_p[NUT_LANES] = {0.0}, sum_e[NUT_LANES] = {0.0};
+
+   for (first = 0; first < n; first += NUT_BLOCK)
+   {
+      len = (n - first < NUT_BLOCK) ? n - first : NUT_BLOCK;
+
+      for (i = 0; i < len; i++)
+         arg[i] = (double) mult[first + i] * a[0] +
+                  (double) mult[ld + first + i] * a[1] +
+                  (double) mult[2 * ld + first + i] * a[2] +
+                  (double) mult[3 * ld + first + i] * a[3] +
+                  (double) mult[4 * ld + first + i] * a[4];
+
+      sincos_block (len, arg, s, c);
+
+      for (i = 0; i < len; i++)
+      {
+         tp[i] = (coef[first + i] + coef[ld + first + i] * t) * s[i] +
+            coef[2 * ld + first + i] * c[i];
+         te[i] = (coef[3 * ld + first + i] + coef[4 * ld + first + i] * t) *
+            c[i] + coef[5 * ld + first + i] * s[i];
+      }
+      for (; i % NUT_LANES; i++)
+         tp[i] = te[i] = 0.0;
+
+      for (i = 0; i < len; i += NUT_LANES)
+         for (j = 0; j < NUT_LANES; j++)
+         {
+            sum_p[j] += tp[i + j];
+            sum_e[j] += te[i + j];
+         }
+   }
+
+   *dp = 0.0;
+   *de = 0.0;
+   for (j = 0; j < NUT_LANES; j++)
+   {
+      *dp += sum_p[j];
+      *de += sum_e[j];
+   }
+
+   return;
+}
+
+/********series_pl */
+
+NUT_TARGET_CLONES
+static void series_pl (long int n, long int ld, const signed char *mult,
+                       const double *coef, const double *a,
+
+                       double *dp, double *de)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sums the first 'n' terms of a planetary nutation
+      series stored as a structure of arrays.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of terms to sum.
+      ld (long int)
+         Number of terms of the table (length of each row).
+      *mult (signed char)
+         14 rows of 'ld' argument multipliers, as 'napl_t' in
+         'iau2000a'.
+      *coef (double)
+         4 rows of 'ld' coefficients, in 0.1 microarcseconds, as
+         'cpl_t' in 'iau2000a'.
+      *a (double)
+         14 arguments, in radians.
+
+   OUTPUT
+   ARGUMENTS:
+      *dp (double)
+         Nutation in longitude, in 0.1 microarcseconds.
+      *de (double)
+         Nutation in obliquity, in 0.1 microarcseconds.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      sincos_block   nutation_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See note 1 of 'series_ls'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, len, i, j, k;
+
+   double arg[NUT_BLOCK], s[NUT_BLOCK], c[NUT_BLOCK];
+   double tp[NUT_BLOCK], te[NUT_BLOCK];
+   double sum_p[NUT_LANES] = {0.0}, sum_e[NUT_LANES] = {0.0};
+
+   for (first = 0; first < n; first += NUT_BLOCK)
+   {
+      len = (n - first < NUT_BLOCK) ? n - first : NUT_BLOCK;
+
+      for (i = 0; i < len; i++)
+         arg[i] = 0.0;
+      for (k = 0; k < 14; k++)
+         for (i = 0; i < len; i++)
+            arg[i] += (double) mult[k * ld + first + i] * a[k];
+
+      sincos_block (len, arg, s, c);
+
+      for (i = 0; i < len; i++)
+      {
+         tp[i] = coef[first + i] * s[i] + coef[ld + first + i] * c[i];
+         te[i] = coef[2 * ld + first + i] * s[i] +
+            coef[3 * ld + first + i] * c[i];
+      }
+      for (; i % NUT_LANES; i++)
+         tp[i] = te[i] = 0.0;
+
+      for (i = 0; i < len; i += NUT_LANES)
+         for (j = 0; j < NUT_LANES; j++)
+         {
+            sum_p[j] += tp[i + j];
+            sum_e[j] += te[i + j];
+         }
+   }
+
+   *dp = 0.0;
+   *de = 0.0;
+   for (j = 0; j < NUT_LANES; j++)
+   {
+      *dp += sum_p[j];
+      *de += sum_e[j];
+   }
+
+   return;
+}
+
+/********series_ls_dates */
+
+NUT_TARGET_CLONES
+static void series_ls_dates (long int m, long int n, long int ld,
+                             const signed char *mult,
+                             const double *coef, const double *a,
+                             const double *t, short int kernel,
+
+                             double *dp, double *de)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sums the first 'n' terms of a luni-solar nutation
+      series for 'm' dates, evaluating each term for all the dates at
+      once.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      m (long int)
+         Number of dates, at most NUT_BLOCK.
+      n (long int)
+         Number of terms to sum.
+      ld (long int)
+         Number of terms of the table (length of each row).
+      *mult (signed char)
+         5 rows of 'ld' argument multipliers (L, L', F, D, Om).
+      *coef (double)
+         6 rows of 'ld' coefficients, in 0.1 microarcseconds, as
+         'cls_t' in 'iau2000a'.
+      *a (double)
+         5 rows of NUT_BLOCK fundamental arguments, in radians: the
+         first 'm' values of each row are those of the dates.
+      *t (double)
+         TDB times in Julian centuries since J2000.0 ('m' values).
+      kernel (short int)
+         NUTATION_KERNEL_SCALAR or NUTATION_KERNEL_VECTOR.
+
+   OUTPUT
+   ARGUMENTS:
+      *dp (double)
+         Nutation in longitude, in 0.1 microarcseconds ('m' values).
+      *de (double)
+         Nutation in obliquity, in 0.1 microarcseconds ('m' values).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      TWOPI              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sincos_block   nutation_fast.c
+      fmod           math.h
+      sin            math.h
+      cos            math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The dates are the vector lanes: the multipliers and
+      coefficients of a term are the same for all of them.  The terms
+      are summed in reverse order, one sum per date, as in 'iau2000a'.
+      2. With NUTATION_KERNEL_SCALAR the argument of each date is
+      reduced with 'fmod' and its sine and cosine come from 'sin' and
+      'cos', as in 'iau2000a', so the sums are identical; otherwise
+      they come from 'sincos_block'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i, j, k;
+
+   double arg[NUT_BLOCK], s[NUT_BLOCK], c[NUT_BLOCK], mk;
+   double c0, c1, c2, c3, c4, c5;
+
+   for (j = 0; j < m; j++)
+      dp[j] = de[j] = 0.0;
+
+   for (i = n - 1; i >= 0; i--)
+   {
+
+/*
+   Argument of the term for each date.  Null multipliers are skipped.
+*/
+
+      for (j = 0; j < m; j++)
+         arg[j] = 0.0;
+      for (k = 0; k < 5; k++)
+      {
+         if (mult[k * ld + i] == 0)
+            continue;
+         mk = (double) mult[k * ld + i];
+         for (j = 0; j < m; j++)
+            arg[j] += mk * a[k * NUT_BLOCK + j];
+      }
+
+      if (kernel == NUTATION_KERNEL_SCALAR)
+      {
+         for (j = 0; j < m; j++)
+         {
+            arg[j] = fmod (arg[j], TWOPI);
+            s[j] = sin (arg[j]);
+            c[j] = cos (arg[j]);
+         }
+      }
+       else
+      {
+         sincos_block (m, arg, s, c);
+      }
+
+/*
+   Term.
+*/
+
+      c0 = coef[i];
+      c1 = coef[ld + i];
+      c2 = coef[2 * ld + i];
+      c3 = coef[3 * ld + i];
+      c4 = coef[4 * ld + i];
+      c5 = coef[5 * ld + i];
+
+      for (j = 0; j < m; j++)
+      {
+         dp[j] += (c0 + c1 * t[j]) * s[j] + c2 * c[j];
+         de[j] += (c3 + c4 * t[j]) * c[j] + c5 * s[j];
+      }
+   }
+
+   return;
+}
+
+/********series_pl_dates */
+
+NUT_TARGET_CLONES
+static void series_pl_dates (long int m, long int n, long int ld,
+                             const signed char *mult,
+                             const double *coef, const double *a,
+                             short int kernel,
+
+                             double *dp, double *de)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sums the first 'n' terms of a planetary nutation
+      series for 'm' dates, evaluating each term for all the dates at
+      once.
+
+   REFERENCES:
+      IERS Conventions (2003), Chapter 5.
+
+   INPUT
+   ARGUMENTS:
+      m (long int)
+         Number of dates, at most NUT_BLOCK.
+      n (long int)
+         Number of terms to sum.
+      ld (long int)
+         Number of terms of the table (length of each row).
+      *mult (signed char)
+         14 rows of 'ld' argument multipliers, as 'napl_t' in
+         'iau2000a'.
+      *coef (double)
+         4 rows of 'ld' coefficients, in 0.1 microarcseconds, as
+         'cpl_t' in 'iau2000a'.
+      *a (double)
+         14 rows of NUT_BLOCK arguments, in radians: the first 'm'
+         values of each row are those of the dates.
+      kernel (short int)
+         NUTATION_KERNEL_SCALAR or NUTATION_KERNEL_VECTOR.
+
+   OUTPUT
+   ARGUMENTS:
+      *dp (double)
+         Nutation in longitude, in 0.1 microarcseconds ('m' values).
+      *de (double)
+         Nutation in obliquity, in 0.1 microarcseconds ('m' values).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      TWOPI              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sincos_block   nutation_fast.c
+      fmod           math.h
+      sin            math.h
+      cos            math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See the notes of 'series_ls_dates'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i, j, k;
+
+   double arg[NUT_BLOCK], s[NUT_BLOCK], c[NUT_BLOCK], mk;
+   double c0, c1, c2, c3;
+
+   for (j = 0; j < m; j++)
+      dp[j] = de[j] = 0.0;
+
+   for (i = n - 1; i >= 0; i--)
+   {
+      for (j = 0; j < m; j++)
+         arg[j] = 0.0;
+      for (k = 0; k < 14; k++)
+      {
+         if (mult[k * ld + i] == 0)
+            continue;
+         mk = (double) mult[k * ld + i];
+         for (j = 0; j < m; j++)
+            arg[j] += mk * a[k * NUT_BLOCK + j];
+      }
+
+      if (kernel == NUTATION_KERNEL_SCALAR)
+      {
+         for (j = 0; j < m; j++)
+         {
+            arg[j] = fmod (arg[j], TWOPI);
+            s[j] = sin (arg[j]);
+            c[j] = cos (arg[j]);
+         }
+      }
+       else
+      {
+         sincos_block (m, arg, s, c);
+      }
+
+      c0 = coef[i];
+      c1 = coef[ld + i];
+      c2 = coef[2 * ld + i];
+      c3 = coef[3 * ld + i];
+
+      for (j = 0; j < m; j++)
+      {
+         dp[j] += c0 * s[j] + c1 * c[j];
+         de[j] += c2 * s[j] + c3 * c[j];
+      }
+   }
+
+   return;
+}
@@ -0,0 +1,1235 @@
+/*
+   Naval Observatory Vector Astrometry Software (NOVAS)
+   C Edition, Version 3.1
+
+   nutation_table.c: Interpolation table of nutation and obliquity
+
+   Royal Observatory of the Spanish Navy
+*/
+
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "novas.h"
+#include "nutation.h"
+#include "novascon.h"
+
+/*
+   struct nutation_table: samples of the nutation angles, the mean
+                          obliquity and the complementary terms of the
+                          equation of the equinoxes on a regular grid.
+
+   accuracy           = 'accuracy' of the models sampled
+   source             = nutation source ('set_nutation_source')
+   kernel             = evaluation kernel of the series
+                        ('set_nutation_kernel')
+   tolerance          = truncation of the IAU 2000A series, in
+                        microarcseconds ('set_nutation_tolerance')
+   n                  = number of samples
+   jd_first           = TDB Julian date of the first sample
+   step               = interval between samples, in days
+   error              = bound of the interpolation error found when
+                        the table was made, in microarcseconds
+   val                = samples: dpsi, deps, mean obliquity and
+                        complementary terms, in arcseconds, four per
+                        epoch
+*/
+
+typedef struct
+{
+   short int accuracy;
+   short int source;
+   short int kernel;
+   double tolerance;
+   long int n;
+   double jd_first;
+   double step;
+   double error;
+   double *val;
+} nutation_table;
+
+/*
+   'NUT_TABLE' is the table in use ('val' is NULL when there is none).
+   'NUT_TABLE_ID' identifies the table files.
+*/
+
+static nutation_table NUT_TABLE = {0, 0, 0, 0.0, 0L, 0.0, 0.0, 0.0, NULL};
+
+static const char NUT_TABLE_ID[8] = {'N','O','V','A','S','N','T','2'};
+
+/*
+   Initial and smallest interval between samples, in days.
+*/
+
+#define NUT_TABLE_STEP 0.5
+#define NUT_TABLE_MIN_STEP (1.0 / 256.0)
+
+/*
+   Safety factor of the bound of the interpolation error (see
+   'nutation_table_make').
+*/
+
+#define NUT_TABLE_SAFETY 2.0
+
+static void sample (double jd_tdb, short int accuracy,
+
+                    double *v);
+
+static void interpolate (const double *val, long int i, double x,
+
+                         double *v);
+
+static double diff4_max (const double *val, const double *mid,
+                         const double *quarter, long int n, long int i);
+
+static short int write_le (FILE *file, uint64_t value, short int size);
+
+static short int read_le (FILE *file, short int size,
+
+                          uint64_t *value);
+
+static short int write_doubles (FILE *file, const double *x, long int n);
+
+static short int read_doubles (FILE *file, long int n,
+
+                               double *x);
+
+/********nutation_table_make */
+
+short int nutation_table_make (double jd_begin, double jd_end,
+                               short int accuracy, double tolerance,
+
+                               double *error)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function samples the nutation angles, the mean obliquity
+      and the complementary terms of the equation of the equinoxes
+      over a span of dates and makes the resulting table the one used
+      by 'e_tilt'.  The interval between samples is halved until the
+      bound of the interpolation error is within 'tolerance'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_begin (double)
+         First TDB Julian date of the span.
+      jd_end (double)
+         Last TDB Julian date of the span.
+      accuracy (short int)
+         Selection for accuracy of the models sampled
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      tolerance (double)
+         Largest interpolation error allowed, in microarcseconds.
+
+   OUTPUT
+   ARGUMENTS:
+      *error (double)
+         Bound of the interpolation error, in microarcseconds.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid span, accuracy or tolerance.
+          = 2 ... Memory allocation error.
+          = 3 ... Tolerance not reached with the smallest interval
+                  between samples; the previous table is kept.
+
+   GLOBALS
+   USED:
+      NUT_TABLE          nutation_table.c
+
+   FUNCTIONS
+   CALLED:
+      sample             nutation_table.c
+      interpolate        nutation_table.c
+      diff4_max          nutation_table.c
+      nutation_table_free nutation_table.c
+      get_nutation_source novas.c
+      get_nutation_tolerance novas.c
+      get_nutation_kernel nutation.c
+      ceil               math.h
+      fabs               math.h
+      malloc             stdlib.h
+      free               stdlib.h
+      memmove            string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The models are those selected when the table is made (see
+      'nutation_angles', 'set_nutation_source',
+      'set_nutation_tolerance' and 'set_nutation_kernel'); they are
+      kept with the table, which is not used once any of them is
+      changed.  The celestial pole offsets of 'cel_pole' are applied
+      by 'e_tilt' afterwards.
+      2. Values are interpolated with a cubic through the four nearest
+      samples, at h * (i - 1) to h * (i + 2) for a date in interval i.
+      Its error at fraction x of the interval is
+      f''''(z) h^4 (x + 1) x (x - 1) (x - 2) / 24 for some z between
+      the outer samples, at most (3/128) h^4 max|f''''|.  The models
+      are also evaluated at one quarter, one half and three quarters
+      of every interval, and the fourth differences of these values,
+      spaced h / 4, give h^4 f'''' = 256 times the fourth difference.
+      The bound of an interval is NUT_TABLE_SAFETY (2) times
+      (3/128) * 256 times the largest fourth difference over the
+      three intervals of its samples.  The factor covers the
+      smoothing of the differences and the peaks of f'''' between
+      them: the shortest periods of the series, a few days, span
+      dozens of values even at the initial interval.  'error' is
+      the largest bound, and at least the largest difference found
+      between the models and the interpolated values at the same
+      points.  When the interval is halved, the middle values become
+      the new samples and the quarter values the new middle values,
+      so nothing is computed twice.
+      3. With IAU 2000A, an interval of 0.5 days gives a bound of
+      about 84 microarcseconds (largest error found about 41), and
+      each halving divides it by about 16 (0.33 microarcseconds at
+      0.125 days, 32 bytes per sample).
+
+------------------------------------------------------------------------
+*/
+{
+   long int n, i, j, k;
+
+   double step, err, x, v[4], d4, d_prev, d_cur, d_next, *val, *mid,
+      *quarter, *val_new;
+
+   const double frac[3] = {0.25, 0.5, 0.75};
+
+   *error = 0.0;
+
+   if ((jd_end <= jd_begin) || (accuracy < 0) || (accuracy > 1) ||
+      (tolerance <= 0.0))
+      return 1;
+
+/*
+   Samples from one interval before the span to two after it, so that
+   every date of the span has two samples on each side.
+*/
+
+   step = NUT_TABLE_STEP;
+   n = (long int) ceil ((jd_end - jd_begin) / step) + 4L;
+
+   if ((val = (double *) malloc (4 * n * sizeof (double))) == NULL)
+      return 2;
+
+   if ((mid = (double *) malloc (4 * (n - 1) * sizeof (double))) == NULL)
+   {
+      free (val);
+      return 2;
+   }
+
+   for (i = 0; i < n; i++)
+      sample (jd_begin + (double) (i - 1) * step, accuracy, &val[4 * i]);
+   for (i = 0; i < n - 1; i++)
+      sample (jd_begin + ((double) (i - 1) + 0.5) * step, accuracy,
+         &mid[4 * i]);
+
+   for ( ; ; )
+   {
+
+/*
+   Evaluate the models at one and three quarters of every interval
+   ('quarter' holds both, eight values per interval).  Then, where
+   the values can be interpolated, bound the error from the fourth
+   differences and compare the middle and quarter values with the
+   interpolated values.
+*/
+
+      if ((quarter = (double *) malloc (8 * (n - 1) * sizeof (double)))
+         == NULL)
+      {
+         free (mid);
+         free (val);
+         return 2;
+      }
+
+      for (i = 0; i < n - 1; i++)
+      {
+         sample (jd_begin + ((double) (i - 1) + 0.25) * step, accuracy,
+            &quarter[8 * i]);
+         sample (jd_begin + ((double) (i - 1) + 0.75) * step, accuracy,
+            &quarter[8 * i + 4]);
+      }
+
+      err = 0.0;
+      d_prev = diff4_max (val, mid, quarter, n, 0L);
+      d_cur = diff4_max (val, mid, quarter, n, 1L);
+      for (i = 1; i < n - 2; i++)
+      {
+         d_next = diff4_max (val, mid, quarter, n, i + 1);
+
+         d4 = (d_prev > d_cur) ? d_prev : d_cur;
+         if (d_next > d4)
+            d4 = d_next;
+         d_prev = d_cur;
+         d_cur = d_next;
+
+         x = NUT_TABLE_SAFETY * (3.0 / 128.0) * 256.0 * d4 * 1.0e6;
+         if (x > err)
+            err = x;
+
+         for (k = 0; k < 3; k++)
+         {
+            interpolate (val, i, frac[k], v);
+            for (j = 0; j < 4; j++)
+            {
+               x = (k == 1) ? mid[4 * i + j] :
+                  quarter[8 * i + 2 * k + j];
+               x = fabs (v[j] - x) * 1.0e6;
+               if (x > err)
+                  err = x;
+            }
+         }
+      }
+
+      if (err <= tolerance)
+      {
+         free (quarter);
+         free (mid);
+         break;
+      }
+
+      if (step / 2.0 < NUT_TABLE_MIN_STEP)
+      {
+         free (quarter);
+         free (mid);
+         free (val);
+         *error = err;
+         return 3;
+      }
+
+/*
+   Halve the interval: the middle values become the odd samples, and
+   the quarter values the middle values of the new intervals.
+*/
+
+      val_new = (double *) malloc (4 * (2 * n - 1) * sizeof (double));
+      if (val_new == NULL)
+      {
+         free (quarter);
+         free (mid);
+         free (val);
+         return 2;
+      }
+
+      for (i = 0; i < n; i++)
+      {
+         for (j = 0; j < 4; j++)
+         {
+            val_new[8 * i + j] = val[4 * i + j];
+            if (i < n - 1)
+               val_new[8 * i + 4 + j] = mid[4 * i + j];
+         }
+      }
+
+      free (mid);
+      free (val);
+      val = val_new;
+      mid = quarter;
+      n = 2 * n - 1;
+      step /= 2.0;
+
+/*
+   Drop the first sample, two (new) intervals before the span, and
+   the middle value of the first interval.
+*/
+
+      memmove (val, &val[4], 4 * (n - 1) * sizeof (double));
+      memmove (mid, &mid[4], 4 * (n - 2) * sizeof (double));
+      n--;
+   }
+
+   nutation_table_free ();
+
+   NUT_TABLE.accuracy = accuracy;
+   NUT_TABLE.source = get_nutation_source ();
+   NUT_TABLE.kernel = get_nutation_kernel ();
+   NUT_TABLE.tolerance = get_nutation_tolerance ();
+   NUT_TABLE.n = n;
+   NUT_TABLE.jd_first = jd_begin - step;
+   NUT_TABLE.step = step;
+   NUT_TABLE.error = err;
+   NUT_TABLE.val = val;
+
+   *error = err;
+
+   return 0;
+}
+
+/********nutation_table_save */
+
+short int nutation_table_save (const char *file_name)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function writes the table in use to a binary file, to be
+      read back with 'nutation_table_load'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file_name (char)
+         Name of the file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... No table in use.
+          = 2 ... File could not be created.
+          = 3 ... Write error.
+
+   GLOBALS
+   USED:
+      NUT_TABLE          nutation_table.c
+      NUT_TABLE_ID       nutation_table.c
+
+   FUNCTIONS
+   CALLED:
+      write_le           nutation_table.c
+      write_doubles      nutation_table.c
+      fopen              stdio.h
+      fwrite             stdio.h
+      fclose             stdio.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The file holds the identifier "NOVASNT2", the accuracy, the
+      nutation source and the kernel (32-bit integers), the number of
+      samples (64-bit integer), the nutation tolerance, the first date,
+      the interval, the error and the samples (IEEE 754 doubles).  All
+      numbers are little-endian, so the file can be read on any
+      machine.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   FILE *file;
+
+   if (NUT_TABLE.val == NULL)
+      return 1;
+
+   if ((file = fopen (file_name, "wb")) == NULL)
+      return 2;
+
+   if ((fwrite (NUT_TABLE_ID, sizeof NUT_TABLE_ID, 1, file) != 1) ||
+      write_le (file, (uint64_t) NUT_TABLE.accuracy, 4) ||
+      write_le (file, (uint64_t) NUT_TABLE.source, 4) ||
+      write_le (file, (uint64_t) NUT_TABLE.kernel, 4) ||
+      write_le (file, (uint64_t) NUT_TABLE.n, 8) ||
+      write_doubles (file, &NUT_TABLE.tolerance, 1L) ||
+      write_doubles (file, &NUT_TABLE.jd_first, 1L) ||
+      write_doubles (file, &NUT_TABLE.step, 1L) ||
+      write_doubles (file, &NUT_TABLE.error, 1L) ||
+      write_doubles (file, NUT_TABLE.val, 4 * NUT_TABLE.n))
+      error = 3;
+
+   if (fclose (file) != 0)
+      error = 3;
+
+   return error;
+}
+
+/********nutation_table_load */
+
+short int nutation_table_load (const char *file_name)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function reads a table written by 'nutation_table_save' and
+      makes it the one used by 'e_tilt'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file_name (char)
+         Name of the file.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... File could not be opened.
+          = 2 ... Not a table file, inconsistent header, or read
+                  error; the previous table is kept.
+          = 3 ... Memory allocation error; the previous table is kept.
+
+   GLOBALS
+   USED:
+      NUT_TABLE          nutation_table.c
+      NUT_TABLE_ID       nutation_table.c
+
+   FUNCTIONS
+   CALLED:
+      nutation_table_free nutation_table.c
+      read_le            nutation_table.c
+      read_doubles       nutation_table.c
+      fopen              stdio.h
+      fread              stdio.h
+      fseek              stdio.h
+      ftell              stdio.h
+      fclose             stdio.h
+      memcmp             string.h
+      malloc             stdlib.h
+      free               stdlib.h
+      fabs               math.h
+      frexp              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The header is checked before anything is allocated: the
+      settings must be valid, the interval a power-of-two fraction of
+      NUT_TABLE_STEP not below NUT_TABLE_MIN_STEP, the error and the
+      tolerance non-negative, the first and last dates of the table
+      ordinary Julian dates, and the rest of the file exactly the
+      samples announced.
+
+------------------------------------------------------------------------
+*/
+{
+   char id[8];
+
+   int exponent;
+
+   long int start, end;
+
+   uint64_t accuracy, source, kernel, n;
+
+   double jd_last;
+
+   nutation_table table;
+
+   FILE *file;
+
+   if ((file = fopen (file_name, "rb")) == NULL)
+      return 1;
+
+   if ((fread (id, sizeof id, 1, file) != 1) ||
+      (memcmp (id, NUT_TABLE_ID, sizeof id) != 0) ||
+      read_le (file, 4, &accuracy) || read_le (file, 4, &source) ||
+      read_le (file, 4, &kernel) || read_le (file, 8, &n) ||
+      read_doubles (file, 1L, &table.tolerance) ||
+      read_doubles (file, 1L, &table.jd_first) ||
+      read_doubles (file, 1L, &table.step) ||
+      read_doubles (file, 1L, &table.error) ||
+      (accuracy > 1) || (source > 1) || (kernel > 2) || (n < 4) ||
+      (n > (uint64_t) LONG_MAX / 4) || (table.step <= 0.0))
+   {
+      fclose (file);
+      return 2;
+   }
+
+   table.accuracy = (short int) accuracy;
+   table.source = (short int) source;
+   table.kernel = (short int) kernel;
+   table.n = (long int) n;
+
+/*
+   Check that the dates make sense and that the samples announced are
+   all in the file (and nothing more) before allocating them.
+*/
+
+   jd_last = table.jd_first + table.step * (double) (table.n - 1);
+
+   if ((table.step < NUT_TABLE_MIN_STEP) ||
+      (table.step > NUT_TABLE_STEP) ||
+      (frexp (table.step / NUT_TABLE_STEP, &exponent) != 0.5) ||
+      !(fabs (table.jd_first) < 1.0e8) || !(fabs (jd_last) < 1.0e8) ||
+      !(table.tolerance >= 0.0) || !(table.error >= 0.0) ||
+      ((start = ftell (file)) < 0L) ||
+      (fseek (file, 0L, SEEK_END) != 0) ||
+      ((end = ftell (file)) < 0L) ||
+      (fseek (file, start, SEEK_SET) != 0) ||
+      ((end - start) % 32L != 0L) || ((end - start) / 32L != table.n))
+   {
+      fclose (file);
+      return 2;
+   }
+
+   if ((table.val = (double *) malloc (4 * table.n * sizeof (double)))
+      == NULL)
+   {
+      fclose (file);
+      return 3;
+   }
+
+   if (read_doubles (file, 4 * table.n, table.val))
+   {
+      free (table.val);
+      fclose (file);
+      return 2;
+   }
+
+   fclose (file);
+
+   nutation_table_free ();
+   NUT_TABLE = table;
+
+   return 0;
+}
+
+/********nutation_table_free */
+
+void nutation_table_free (void)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function releases the table in use, if any; 'e_tilt' then
+      evaluates the models again.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      NUT_TABLE          nutation_table.c
+
+   FUNCTIONS
+   CALLED:
+      free               stdlib.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   free (NUT_TABLE.val);
+
+   NUT_TABLE.val = NULL;
+   NUT_TABLE.n = 0L;
+
+   return;
+}
+
+/********nutation_table_eval */
+
+short int nutation_table_eval (double jd_tdb, short int accuracy,
+
+                               double *dpsi, double *deps, double *mobl,
+                               double *c_terms)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function interpolates the table in use at a given date.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      *dpsi (double)
+         Nutation in longitude in arcseconds.
+      *deps (double)
+         Nutation in obliquity in arcseconds.
+      *mobl (double)
+         Mean obliquity of the ecliptic in arcseconds.
+      *c_terms (double)
+         Complementary terms of the equation of the equinoxes in
+         arcseconds.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... No table in use, table made with another
+                  'accuracy' or other nutation settings, or date
+                  outside the table.
+
+   GLOBALS
+   USED:
+      NUT_TABLE          nutation_table.c
+
+   FUNCTIONS
+   CALLED:
+      interpolate        nutation_table.c
+      get_nutation_source novas.c
+      get_nutation_tolerance novas.c
+      get_nutation_kernel nutation.c
+      floor              math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Used by 'e_tilt'; the outputs are untouched when 1 is
+      returned.
+      2. The table is bypassed when the nutation source, tolerance or
+      kernel differ from those it was made with, so that it never
+      stands in for other models than the ones selected.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i;
+
+   double x, v[4];
+
+   if ((NUT_TABLE.val == NULL) || (accuracy != NUT_TABLE.accuracy) ||
+      (NUT_TABLE.source != get_nutation_source ()) ||
+      (NUT_TABLE.kernel != get_nutation_kernel ()) ||
+      (NUT_TABLE.tolerance != get_nutation_tolerance ()))
+      return 1;
+
+   x = (jd_tdb - NUT_TABLE.jd_first) / NUT_TABLE.step;
+   if ((x < 1.0) || (x > (double) (NUT_TABLE.n - 2)))
+      return 1;
+
+   i = (long int) floor (x);
+   if (i > NUT_TABLE.n - 3)
+      i = NUT_TABLE.n - 3;
+
+   interpolate (NUT_TABLE.val, i, x - (double) i, v);
+
+   *dpsi = v[0];
+   *deps = v[1];
+   *mobl = v[2];
+   *c_terms = v[3];
+
+   return 0;
+}
+
+/********sample */
+
+static void sample (double jd_tdb, short int accuracy,
+
+                    double *v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function evaluates the quantities kept in the table at one
+      date.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      jd_tdb (double)
+         TDB Julian date.
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      *v (double)
+         dpsi, deps, mean obliquity and complementary terms of the
+         equation of the equinoxes, in arcseconds.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, ASEC2RAD       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      nutation_angles    novas.c
+      mean_obliq         novas.c
+      ee_ct              novas.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same quantities and units as in 'e_tilt'.
+
+------------------------------------------------------------------------
+*/
+{
+   nutation_angles ((jd_tdb - T0) / 36525.0, accuracy, &v[0], &v[1]);
+   v[2] = mean_obliq (jd_tdb);
+   v[3] = ee_ct (jd_tdb, 0.0, accuracy) / ASEC2RAD;
+
+   return;
+}
+
+/********interpolate */
+
+static void interpolate (const double *val, long int i, double x,
+
+                         double *v)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function interpolates the four quantities of a table with a
+      cubic through samples i-1 to i+2.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *val (double)
+         Samples, four per epoch.
+      i (long int)
+         Sample at the start of the interval.
+      x (double)
+         Fraction of the interval, 0 to 1.
+
+   OUTPUT
+   ARGUMENTS:
+      *v (double)
+         Interpolated quantities.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Lagrange weights for nodes -1, 0, 1 and 2.
+
+------------------------------------------------------------------------
+*/
+{
+   long int j;
+
+   double w0, w1, w2, w3;
+   const double *p = &val[4 * (i - 1)];
+
+   w0 = -x * (x - 1.0) * (x - 2.0) / 6.0;
+   w1 = (x + 1.0) * (x - 1.0) * (x - 2.0) / 2.0;
+   w2 = -(x + 1.0) * x * (x - 2.0) / 2.0;
+   w3 = (x + 1.0) * x * (x - 1.0) / 6.0;
+
+   for (j = 0; j < 4; j++)
+      v[j] = w0 * p[j] + w1 * p[4 + j] + w2 * p[8 + j] + w3 * p[12 + j];
+
+   return;
+}
+
+/********diff4_max */
+
+static double diff4_max (const double *val, const double *mid,
+                         const double *quarter, long int n, long int i)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the largest absolute fourth difference of
+      the four quantities of a table, sampled every quarter of the
+      interval, over the differences that start in a given interval.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *val (double)
+         Samples, four per epoch ('n' epochs).
+      *mid (double)
+         Values at the middle of each interval, four per interval.
+      *quarter (double)
+         Values at one and three quarters of each interval, eight per
+         interval.
+      n (long int)
+         Number of samples.
+      i (long int)
+         Interval.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (double)
+         Largest absolute fourth difference, in the units of the
+         table.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      fabs               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Value m of the quarter-interval sequence is sample m / 4, the
+      first quarter value, the middle value or the third quarter value
+      of interval m / 4 as m % 4 is 0, 1, 2 or 3.  Differences that
+      would go past the last sample are skipped.
+
+------------------------------------------------------------------------
+*/
+{
+   long int m, k, j, q;
+
+   double y[5], d, dmax = 0.0;
+
+   for (m = 4 * i; (m < 4 * i + 4) && (m + 4 <= 4 * (n - 1)); m++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         for (k = 0; k < 5; k++)
+         {
+            q = (m + k) / 4;
+            switch ((m + k) % 4)
+            {
+               case (0):
+                  y[k] = val[4 * q + j];
+                  break;
+               case (1):
+                  y[k] = quarter[8 * q + j];
+                  break;
+               case (2):
+                  y[k] = mid[4 * q + j];
+                  break;
+               default:
+                  y[k] = quarter[8 * q + 4 + j];
+                  break;
+            }
+         }
+
+         d = fabs (y[0] - 4.0 * y[1] + 6.0 * y[2] - 4.0 * y[3] + y[4]);
+         if (d > dmax)
+            dmax = d;
+      }
+   }
+
+   return dmax;
+}
+
+/********write_le */
+
+static short int write_le (FILE *file, uint64_t value, short int size)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function writes an unsigned integer to a file as 'size'
+      little-endian bytes.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file (FILE)
+         File open for writing.
+      value (uint64_t)
+         Value to write.
+      size (short int)
+         Number of bytes, 1 to 8.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Write error.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      fwrite             stdio.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   unsigned char b[8];
+
+   for (i = 0; i < size; i++)
+      b[i] = (unsigned char) ((value >> (8 * i)) & 0xff);
+
+   return (fwrite (b, (size_t) size, 1, file) != 1);
+}
+
+/********read_le */
+
+static short int read_le (FILE *file, short int size,
+
+                          uint64_t *value)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function reads an unsigned integer stored in a file as
+      'size' little-endian bytes.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file (FILE)
+         File open for reading.
+      size (short int)
+         Number of bytes, 1 to 8.
+
+   OUTPUT
+   ARGUMENTS:
+      *value (uint64_t)
+         Value read.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Read error.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      fread              stdio.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   unsigned char b[8];
+
+   if (fread (b, (size_t) size, 1, file) != 1)
+      return 1;
+
+   *value = 0;
+   for (i = size - 1; i >= 0; i--)
+      *value = (*value << 8) | b[i];
+
+   return 0;
+}
+
+/********write_doubles */
+
+static short int write_doubles (FILE *file, const double *x, long int n)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function writes doubles to a file as little-endian IEEE 754
+      numbers.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file (FILE)
+         File open for writing.
+      *x (double)
+         Values to write.
+      n (long int)
+         Number of values.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Write error.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      write_le           nutation_table.c
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. 'double' is taken to be the IEEE 754 binary64 format, as in
+      the binary JPL ephemeris files.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i;
+
+   uint64_t bits;
+
+   for (i = 0; i < n; i++)
+   {
+      memcpy (&bits, &x[i], sizeof bits);
+      if (write_le (file, bits, 8))
+         return 1;
+   }
+
+   return 0;
+}
+
+/********read_doubles */
+
+static short int read_doubles (FILE *file, long int n,
+
+                               double *x)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function reads doubles stored in a file as little-endian
+      IEEE 754 numbers.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      *file (FILE)
+         File open for reading.
+      n (long int)
+         Number of values.
+
+   OUTPUT
+   ARGUMENTS:
+      *x (double)
+         Values read.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Read error.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      read_le            nutation_table.c
+      memcpy             string.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See function 'write_doubles'.
+
+------------------------------------------------------------------------
+*/
+{
+   long int i;
+
+   uint64_t bits;
+
+   for (i = 0; i < n; i++)
+   {
+      if (read_le (file, 8, &bits))
+         return 1;
+      memcpy (&x[i], &bits, sizeof bits);
+   }
+
+   return 0;
+}
@@ -0,0 +1,340 @@
+/*
+   Naval Observatory Vector Astrometry Software (NOVAS)
+   C Edition, Version 3.1
+
+   parallel.cpp: Thread pool for the batch functions
+
+   Royal Observatory of the Spanish Navy
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "parallel.h"
+
+namespace
+{
+
+// Smallest number of items given to a thread: below this, waking the thread costs more than
+// the work it takes away from the calling thread.
+constexpr long int kMinItemsPerThread = 64;
+
+// Work split in 'slots' parts, run by 'run(slot, data)'. Slot 0 is kept by the calling thread;
+// the others are claimed in order, 'next' being the first one not claimed, by the pool threads
+// or by the calling thread. 'running' counts the slots being run by pool threads.
+struct Batch
+{
+    void (*run)(long int slot, void *data) = nullptr;
+    void *data = nullptr;
+    long int slots = 1;
+    long int next = 1;
+    long int running = 0;
+    std::condition_variable done;
+};
+
+// Threads kept from one call to the next, so that a batch only wakes them. They are started on
+// demand, never more than the largest number of slots asked for minus one, and joined when the
+// library is unloaded. A batch never waits for a free thread: the calling thread runs the slots
+// that no pool thread has claimed, so nested or concurrent batches always make progress.
+class ThreadPool
+{
+public:
+    static ThreadPool& instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        work_.notify_all();
+
+        for (auto& thread : threads_)
+            thread.join();
+    }
+
+    // Runs all the slots of 'batch' and returns when they are done. If threads cannot be started
+    // or the batch cannot be queued, the calling thread runs the slots left.
+    void run(Batch& batch)
+    {
+        bool queued = false;
+
+        if (batch.slots > 1)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            try
+            {
+                while (static_cast<long int>(threads_.size()) < batch.slots - 1)
+                    threads_.emplace_back(&ThreadPool::work, this);
+            }
+            catch (const std::system_error&)
+            {
+            }
+            catch (const std::bad_alloc&)
+            {
+            }
+
+            try
+            {
+                if (!threads_.empty())
+                {
+                    queue_.push_back(&batch);
+                    queued = true;
+                }
+            }
+            catch (const std::bad_alloc&)
+            {
+            }
+        }
+
+        if (queued)
+            work_.notify_all();
+
+        batch.run(0, batch.data);
+
+        for (;;)
+        {
+            long int slot;
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (batch.next >= batch.slots)
+                    break;
+                slot = claim(batch);
+            }
+
+            batch.run(slot, batch.data);
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        batch.done.wait(lock, [&batch] { return batch.running == 0; });
+    }
+
+private:
+    ThreadPool() = default;
+
+    // Claims the next slot of 'batch', taking the batch off the queue with its last slot. The
+    // mutex must be held.
+    long int claim(Batch& batch)
+    {
+        const long int slot = batch.next++;
+
+        if (batch.next >= batch.slots)
+        {
+            auto it = std::find(queue_.begin(), queue_.end(), &batch);
+            if (it != queue_.end())
+                queue_.erase(it);
+        }
+
+        return slot;
+    }
+
+    // Loop of a pool thread: runs slots of the queued batches until the pool is destroyed.
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        for (;;)
+        {
+            work_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+                return;
+
+            Batch& batch = *queue_.front();
+            const long int slot = claim(batch);
+            batch.running++;
+
+            lock.unlock();
+            batch.run(slot, batch.data);
+            lock.lock();
+
+            if (--batch.running == 0)
+                batch.done.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable work_;
+    std::deque<Batch*> queue_;
+    std::vector<std::thread> threads_;
+    bool stop_ = false;
+};
+
+// Data of a batch of 'novas_parallel_for'.
+struct RangeBatch
+{
+    long int n;
+    long int count;
+    novas_range_fn fn;
+    void *arg;
+};
+
+// Slot of a batch of 'novas_parallel_for': its contiguous range of items.
+void run_range(long int slot, void *data)
+{
+    const RangeBatch& range = *static_cast<const RangeBatch*>(data);
+
+    range.fn(range.n * slot / range.count, range.n * (slot + 1) / range.count, range.arg);
+}
+
+// Tasks not yet started of one worker, 'next' to 'end' - 1. The owner takes them from the front;
+// the other workers steal the back half when their own range is empty.
+struct TaskRange
+{
+    std::mutex mutex;
+    long int next = 0;
+    long int end = 0;
+};
+
+// Next task for 'worker', from its own range or stolen from another worker; -1 when no task is
+// left in any range.
+long int next_task(std::vector<TaskRange>& ranges, short int worker)
+{
+    const long int count = static_cast<long int>(ranges.size());
+    TaskRange& own = ranges[worker];
+
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.next < own.end)
+            return own.next++;
+    }
+
+    for (long int k = 1; k < count; k++)
+    {
+        TaskRange& victim = ranges[(worker + k) % count];
+        std::scoped_lock lock(own.mutex, victim.mutex);
+
+        if (victim.next < victim.end)
+        {
+            const long int first = victim.end - (victim.end - victim.next + 1) / 2;
+            own.next = first + 1;
+            own.end = victim.end;
+            victim.end = first;
+            return first;
+        }
+    }
+
+    return -1;
+}
+
+// Data of a batch of 'novas_parallel_tasks'.
+struct TaskBatch
+{
+    std::vector<TaskRange>* ranges;
+    novas_task_fn fn;
+    void *arg;
+};
+
+// Slot of a batch of 'novas_parallel_tasks', that is, the work of one worker: its tasks, then
+// those it can steal, until none is left.
+void run_tasks(long int slot, void *data)
+{
+    const TaskBatch& tasks = *static_cast<const TaskBatch*>(data);
+    const short int worker = static_cast<short int>(slot);
+    long int task;
+
+    while ((task = next_task(*tasks.ranges, worker)) >= 0)
+        tasks.fn(task, worker, tasks.arg);
+}
+
+}
+
+// Number of threads to use for 'n' items when 'n_threads' are requested (0 = one per hardware
+// thread). Never more than one thread per kMinItemsPerThread items, and at least one.
+short int novas_thread_count(short int n_threads, long int n)
+{
+    long int count = n_threads;
+
+    if (count <= 0)
+        count = static_cast<long int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    count = std::min(count, std::max(1L, n / kMinItemsPerThread));
+
+    return static_cast<short int>(std::min(count, 32767L));
+}
+
+// Runs 'fn' over the items 0 to n - 1, split in contiguous ranges of about the same size, one per
+// thread, on the threads of the pool. The calling thread takes the first range, and any range no
+// pool thread has taken (for instance when a thread cannot be started), so the work is always
+// completed. The ranges depend only on 'n' and the thread count, never on timing.
+void novas_parallel_for(long int n, short int n_threads, novas_range_fn fn, void *arg)
+{
+    if (n <= 0)
+        return;
+
+    RangeBatch range{n, novas_thread_count(n_threads, n), fn, arg};
+    Batch batch;
+
+    batch.run = run_range;
+    batch.data = &range;
+    batch.slots = range.count;
+
+    ThreadPool::instance().run(batch);
+}
+
+// Number of workers for 'n_tasks' tasks when 'n_threads' are requested (0 = one per hardware
+// thread). The tasks are meant to be heavy, so a worker needs only one task; at least one.
+short int novas_worker_count(short int n_threads, long int n_tasks)
+{
+    long int count = n_threads;
+
+    if (count <= 0)
+        count = static_cast<long int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    count = std::min(count, std::max(1L, n_tasks));
+
+    return static_cast<short int>(std::min(count, 32767L));
+}
+
+// Runs 'fn' over the tasks 0 to n_tasks - 1 with 'n_workers' workers (see 'novas_worker_count')
+// on the threads of the pool, worker 0 being the calling thread. Each worker starts with a
+// contiguous range of tasks, done in increasing order, and steals half of the remaining range of
+// another worker when its own is empty, so tasks of uneven cost are balanced. Which worker does a
+// task depends on timing, but every task is done exactly once, and each worker by one thread; a
+// worker no pool thread has taken is run by the calling thread. If the ranges cannot be
+// allocated, worker 0 does all the tasks.
+void novas_parallel_tasks(long int n_tasks, short int n_workers, novas_task_fn fn, void *arg)
+{
+    if (n_tasks <= 0)
+        return;
+
+    const long int count = std::max(1L, static_cast<long int>(n_workers));
+    std::vector<TaskRange> ranges;
+
+    try
+    {
+        ranges = std::vector<TaskRange>(static_cast<std::size_t>(count));
+    }
+    catch (const std::bad_alloc&)
+    {
+        for (long int task = 0; task < n_tasks; task++)
+            fn(task, 0, arg);
+        return;
+    }
+
+    for (long int k = 0; k < count; k++)
+    {
+        ranges[k].next = n_tasks * k / count;
+        ranges[k].end = n_tasks * (k + 1) / count;
+    }
+
+    TaskBatch tasks{&ranges, fn, arg};
+    Batch batch;
+
+    batch.run = run_tasks;
+    batch.data = &tasks;
+    batch.slots = count;
+
+    ThreadPool::instance().run(batch);
+}
@@ -0,0 +1,901 @@
+/*
+   Naval Observatory Vector Astrometry Software (NOVAS)
+   C Edition, Version 3.1
+
+   place_fast.c: Fast evaluation of star places
+
+   Royal Observatory of the Spanish Navy.
+*/
+
+#include <math.h>
+#include <stddef.h>
+
+#include "novas.h"
+#include "novascon.h"
+#include "nutation.h"
+#include "parallel.h"
+
+/*
+   The stars of a catalog are reduced in blocks: each step of
+   'frame_place' is a loop over the stars of the block, on arrays of
+   coordinates (structures of arrays), so that the loops are compiled
+   with vector instructions.  As in nutation_fast.c, with GCC on x86-64
+   Linux the kernel is compiled for AVX-512, AVX2 and the baseline
+   SSE2, and the loader picks the best one for the CPU.
+*/
+
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__)
+   #define PLACE_TARGET_CLONES \
+      __attribute__((target_clones("avx512f","avx2","default")))
+#else
+   #define PLACE_TARGET_CLONES
+#endif
+
+/*
+   Number of stars reduced together.
+*/
+
+#define PLACE_BLOCK 64
+
+/*
+   struct place_batch: arguments of 'frame_place_batch' shared by the
+                       threads, and the quantities of the frame used by
+                       every star.
+
+   frame              = frame of the date and observer
+   stars              = catalog
+   gammai             = inverse of the Lorentz factor of the observer
+   coslimb            = cosine of the zenith distance below which the
+                        deflection by the Earth is included
+   rel                = relativistic factor of the observer, as in
+                        'rad_vel'
+   ra, dec, rv        = output arrays ('rv' may be NULL)
+*/
+
+typedef struct
+{
+   const novas_frame *frame;
+   const star_table *stars;
+   double gammai;
+   double coslimb;
+   double rel;
+   double *ra;
+   double *dec;
+   double *rv;
+} place_batch;
+
+/*
+   Prototypes of the functions private to this file.
+*/
+
+static void batch_place (long int begin, long int end, void *arg);
+
+static void place_block (const place_batch *data, long int first,
+                         long int m);
+
+static inline void deflect_block (long int m, const double *pob,
+                                  const double *bx, const double *by,
+                                  const double *bz, const double *use,
+                                  double rmass,
+
+                                  double *px, double *py, double *pz);
+
+/********frame_place_batch */
+
+short int frame_place_batch (novas_frame *frame, long int n,
+                             star_table *stars, short int n_threads,
+
+                             double *ra, double *dec, double *rv)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the places of the 'n' stars of a catalog
+      in a frame made with 'make_frame', splitting the stars among
+      several threads.
+
+   REFERENCES:
+      See function 'place'.
+
+   INPUT
+   ARGUMENTS:
+      *frame (struct novas_frame)
+         Frame of the date and observer (not modified).
+      n (long int)
+         Number of stars.
+      *stars (struct star_table)
+         Catalog data of the stars in the ICRS, one array per
+         quantity (defined in novas.h).
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+
+   OUTPUT
+   ARGUMENTS:
+      *ra (double)
+         Right ascensions of the stars in hours, as 'ra' of the output
+         of 'frame_place' ('n' values).
+      *dec (double)
+         Declinations of the stars in degrees ('n' values).
+      *rv (double)
+         Radial velocities of the stars in km/s ('n' values).  May be
+         NULL if they are not wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...Everything OK.
+         1...'n' < 0.
+
+   GLOBALS
+   USED:
+      C_AUDAY, TWOPI     novascon.c
+      ERAD, AU, C        novascon.c
+      GE, GS             novascon.c
+
+   FUNCTIONS
+   CALLED:
+      batch_place        place_fast.c
+      novas_parallel_for parallel.cpp
+      sqrt               math.h
+      asin               math.h
+      cos                math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The results agree with those of 'frame_place' to a few
+      nanoarcseconds.  The sines and cosines of the catalog positions
+      come from 'sincos_array'; the right ascension and declination
+      are still formed star by star with 'vector2radec'.
+      2. The function keeps no static data, so that it can run in
+      several threads at once with the same frame.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   double vemag, beta, disobs, rade, aprad, toms, vo2, r, phigeo,
+      phisun, c2;
+
+   place_batch data;
+
+   if (n < 0)
+      return (error = 1);
+
+/*
+   Aberration: velocity of the observer in units of the speed of light.
+*/
+
+   vemag = sqrt (frame->vob[0] * frame->vob[0] +
+                 frame->vob[1] * frame->vob[1] +
+                 frame->vob[2] * frame->vob[2]);
+   beta = vemag / C_AUDAY;
+   data.gammai = sqrt (1.0 - beta * beta);
+
+/*
+   Deflection by the Earth: 'limb_angle' gives a nadir angle of at
+   least 0.8 times the apparent radius of the limb ('aprad') when the
+   zenith distance is at most pi - 0.8 * aprad.
+*/
+
+   disobs = sqrt (frame->pog[0] * frame->pog[0] +
+                  frame->pog[1] * frame->pog[1] +
+                  frame->pog[2] * frame->pog[2]);
+   rade = ERAD / AU;
+
+   if (disobs >= rade)
+      aprad = asin (rade / disobs);
+    else
+      aprad = TWOPI / 4.0;
+
+   data.coslimb = cos (TWOPI / 2.0 - 0.8 * aprad);
+
+/*
+   Relativistic factor of the observer for the radial velocity (see
+   'rad_vel').
+*/
+
+   c2 = C * C;
+   toms = AU / 86400.0;
+   vo2 = vemag * vemag * toms * toms;
+
+   r = frame->d_obs_geo * AU;
+   phigeo = (r > 1.0e6) ? GE / r : 0.0;
+
+   r = frame->d_obs_sun * AU;
+   phisun = (r > 1.0e8) ? GS / r : 0.0;
+
+   if ((frame->d_obs_geo != 0.0) || (frame->d_obs_sun != 0.0))
+      data.rel = 1.0 - (phigeo + phisun) / c2 - 0.5 * vo2 / c2;
+    else
+      data.rel = 1.0 - 1.550e-8;
+
+   data.frame = frame;
+   data.stars = stars;
+   data.ra = ra;
+   data.dec = dec;
+   data.rv = rv;
+
+   novas_parallel_for (n, n_threads, batch_place, &data);
+
+   return (error);
+}
+
+/********app_star_batch */
+
+short int app_star_batch (double jd_tt, long int n, star_table *stars,
+                          short int accuracy, short int n_threads,
+
+                          double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the apparent places of the 'n' stars of a catalog, as
+      'app_star' for each of them.
+
+   REFERENCES:
+      See function 'app_star'.
+
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date for apparent place.
+      n (long int)
+         Number of stars.
+      *stars (struct star_table)
+         Catalog data of the stars in the ICRS (defined in novas.h).
+      accuracy (short int)
+         Code specifying the relative accuracy of the output position.
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+
+   OUTPUT
+   ARGUMENTS:
+      *ra (double)
+         Apparent right ascensions in hours, referred to true equator
+         and equinox of date 'jd_tt' ('n' values).
+      *dec (double)
+         Apparent declinations in degrees, referred to true equator
+         and equinox of date 'jd_tt' ('n' values).
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...Everything OK.
+         1...'n' < 0.
+         > 20...Error from function 'make_frame'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      make_observer_at_geocenter novas.c
+      make_frame                 novas.c
+      frame_place_batch          place_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The frame is made with the default context, so the function
+      must not run at the same time as the classic NOVAS functions.
+      From several threads, make a frame with 'make_frame_ctx' and call
+      'frame_place_batch'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   observer location;
+
+   novas_frame frame;
+
+   if (n < 0)
+      return (error = 1);
+
+   make_observer_at_geocenter (&location);
+
+   if ((error = make_frame (jd_tt,0.0,&location,1,accuracy,
+      &frame)) != 0)
+      return (error += 20);
+
+   error = frame_place_batch (&frame,n,stars,n_threads, ra,dec,NULL);
+
+   return (error);
+}
+
+/********topo_star_batch */
+
+short int topo_star_batch (double jd_tt, double delta_t, long int n,
+                           star_table *stars, on_surface *position,
+                           short int accuracy, short int n_threads,
+
+                           double *ra, double *dec)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the topocentric places of the 'n' stars of a catalog,
+      as 'topo_star' for each of them.
+
+   REFERENCES:
+      See function 'topo_star'.
+
+   INPUT
+   ARGUMENTS:
+      jd_tt (double)
+         TT Julian date for topocentric place.
+      delta_t (double)
+         Difference TT-UT1 at 'jd_tt', in seconds of time.
+      n (long int)
+         Number of stars.
+      *stars (struct star_table)
+         Catalog data of the stars in the ICRS (defined in novas.h).
+      *position (struct on_surface)
+         Position of the observer (defined in novas.h).
+      accuracy (short int)
+         Code specifying the relative accuracy of the output position.
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+
+   OUTPUT
+   ARGUMENTS:
+      *ra (double)
+         Topocentric right ascensions in hours, referred to true
+         equator and equinox of date 'jd_tt' ('n' values).
+      *dec (double)
+         Topocentric declinations in degrees, referred to true equator
+         and equinox of date 'jd_tt' ('n' values).
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...Everything OK.
+         1...'n' < 0.
+         > 20...Error from function 'make_frame'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      make_observer      novas.c
+      make_frame         novas.c
+      frame_place_batch  place_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See note 1 of 'app_star_batch'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   in_space dummy;
+
+   observer location;
+
+   novas_frame frame;
+
+   if (n < 0)
+      return (error = 1);
+
+   dummy.sc_pos[0] = dummy.sc_pos[1] = dummy.sc_pos[2] = 0.0;
+   dummy.sc_vel[0] = dummy.sc_vel[1] = dummy.sc_vel[2] = 0.0;
+
+   if ((error = make_observer (1,position,&dummy, &location)) != 0)
+      return (error = 1);
+
+   if ((error = make_frame (jd_tt,delta_t,&location,1,accuracy,
+      &frame)) != 0)
+      return (error += 20);
+
+   error = frame_place_batch (&frame,n,stars,n_threads, ra,dec,NULL);
+
+   return (error);
+}
+
+/********batch_place */
+
+static void batch_place (long int begin, long int end, void *arg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Work of one thread of 'frame_place_batch'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      begin (long int)
+         First star of the range.
+      end (long int)
+         One past the last star of the range.
+      *arg (void)
+         Data of the batch ('place_batch').
+
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      place_block        place_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   long int first, m;
+
+   const place_batch *data = (const place_batch *) arg;
+
+   for (first = begin; first < end; first += PLACE_BLOCK)
+   {
+      m = end - first;
+      if (m > PLACE_BLOCK)
+         m = PLACE_BLOCK;
+
+      place_block (data, first, m);
+   }
+
+   return;
+}
+
+/********place_block */
+
+PLACE_TARGET_CLONES
+static void place_block (const place_batch *data, long int first,
+                         long int m)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function computes the places of the stars 'first' to
+      'first' + 'm' - 1 of a batch, with the steps of 'frame_place'.
+
+   REFERENCES:
+      See function 'place'.
+
+   INPUT
+   ARGUMENTS:
+      *data (struct place_batch)
+         Data of the batch.
+      first (long int)
+         First star of the block.
+      m (long int)
+         Number of stars, at most PLACE_BLOCK (nothing is done if it
+         is not positive).
+
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      T0, C_AUDAY        novascon.c
+      ASEC2RAD, DEG2RAD  novascon.c
+      AU_KM, AU, C       novascon.c
+      RMASS              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sincos_array       nutation_fast.c
+      deflect_block      place_fast.c
+      vector2radec       novas.c
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. 'starvectors', 'd_light', 'proper_motion', 'bary2obs',
+      'grav_vec', 'aberration' and the star part of 'rad_vel' are
+      written out as loops over the block.  'limb_angle' is replaced by
+      a comparison of the cosine of the zenith distance with
+      'coslimb'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int b;
+
+   long int i;
+
+   double arg[3 * PLACE_BLOCK], s[3 * PLACE_BLOCK], c[3 * PLACE_BLOCK],
+      vx[PLACE_BLOCK], vy[PLACE_BLOCK], vz[PLACE_BLOCK],
+      px[PLACE_BLOCK], py[PLACE_BLOCK], pz[PLACE_BLOCK],
+      qx[PLACE_BLOCK], qy[PLACE_BLOCK], qz[PLACE_BLOCK],
+      bx[PLACE_BLOCK], by[PLACE_BLOCK], bz[PLACE_BLOCK],
+      tl[PLACE_BLOCK], use[PLACE_BLOCK], pos[3];
+   double dist, paralx, k, pmr, pmd, rvl, dis, dt, x, tlt, dlt, toms,
+      uk0, uk1, uk2, zc, zb1, kvobs, y, z, p, q, r;
+
+   const novas_frame *frame = data->frame;
+
+   const double *ra = data->stars->ra + first;
+   const double *dec = data->stars->dec + first;
+   const double *pmra = data->stars->promora + first;
+   const double *pmdec = data->stars->promodec + first;
+   const double *par = data->stars->parallax + first;
+   const double *rvel = data->stars->radialvelocity + first;
+
+/*
+   An empty block has nothing to compute, and 'arg' is left unset.
+*/
+
+   if (m <= 0)
+      return;
+
+/*
+   Sines and cosines of the right ascensions, declinations and
+   parallaxes (a parallax that is unknown or zero is set to 1e-6
+   milliarcsecond, as in 'starvectors').
+*/
+
+   for (i = 0; i < m; i++)
+   {
+      paralx = par[i];
+      paralx = (paralx <= 0.0) ? 1.0e-6 : paralx;
+      arg[i] = ra[i] * 15.0 * DEG2RAD;
+      arg[m + i] = dec[i] * DEG2RAD;
+      arg[2 * m + i] = paralx * 1.0e-3 * ASEC2RAD;
+   }
+
+   sincos_array (3 * m, arg, s, c);
+
+/*
+   'starvectors': position and space motion of the stars.
+*/
+
+   for (i = 0; i < m; i++)
+   {
+      paralx = par[i];
+      paralx = (paralx <= 0.0) ? 1.0e-6 : paralx;
+      dist = 1.0 / s[2 * m + i];
+
+      px[i] = dist * c[m + i] * c[i];
+      py[i] = dist * c[m + i] * s[i];
+      pz[i] = dist * s[m + i];
+
+      k = 1.0 / (1.0 - rvel[i] / C * 1000.0);
+      pmr = pmra[i] / (paralx * 365.25) * k;
+      pmd = pmdec[i] / (paralx * 365.25) * k;
+      rvl = rvel[i] * 86400.0 / AU_KM * k;
+
+      vx[i] = - pmr * s[i] - pmd * s[m + i] * c[i] +
+         rvl * c[m + i] * c[i];
+      vy[i] =   pmr * c[i] - pmd * s[m + i] * s[i] +
+         rvl * c[m + i] * s[i];
+      vz[i] =   pmd * c[m + i] + rvl * s[m + i];
+   }
+
+/*
+   'd_light', 'proper_motion' and 'bary2obs': positions of the stars
+   at the time the light reaches the solar system barycenter, with
+   respect to the observer, and light times.
+*/
+
+   for (i = 0; i < m; i++)
+   {
+      dis = sqrt (px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i]);
+      dt = (frame->pob[0] * (px[i] / dis) +
+            frame->pob[1] * (py[i] / dis) +
+            frame->pob[2] * (pz[i] / dis)) / C_AUDAY;
+      dt = (frame->jd_tdb + dt) - T0;
+
+      px[i] = px[i] + vx[i] * dt - frame->pob[0];
+      py[i] = py[i] + vy[i] * dt - frame->pob[1];
+      pz[i] = pz[i] + vz[i] * dt - frame->pob[2];
+
+      tl[i] = sqrt (px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i]) /
+         C_AUDAY;
+   }
+
+/*
+   Radial velocities ('rad_vel' for stars, with the relativistic factor
+   of the observer from the batch).
+*/
+
+   if (data->rv != NULL)
+   {
+      toms = AU / 86400.0;
+
+      for (i = 0; i < m; i++)
+      {
+         dis = sqrt (px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i]);
+         uk0 = px[i] / dis;
+         uk1 = py[i] / dis;
+         uk2 = pz[i] / dis;
+
+         zc = vx[i] * (uk0 - c[m + i] * c[i]) +
+            vy[i] * (uk1 - c[m + i] * s[i]) + vz[i] * (uk2 - s[m + i]);
+         paralx = par[i];
+         zc = (paralx <= 0.0) ? 0.0 : zc;
+         zc = rvel[i] * 1.0e3 + zc * toms;
+         zb1 = 1.0 + zc / C;
+
+         kvobs = (uk0 * frame->vob[0] + uk1 * frame->vob[1] +
+            uk2 * frame->vob[2]) * toms;
+
+         data->rv[first + i] = (zb1 * data->rel / (1.0 + kvobs / C) -
+            1.0) * C / 1000.0;
+      }
+   }
+
+/*
+   Gravitational deflection of light and aberration, except for
+   astrometric place.
+*/
+
+   for (i = 0; i < m; i++)
+   {
+      qx[i] = px[i];
+      qy[i] = py[i];
+      qz[i] = pz[i];
+   }
+
+   if (frame->coord_sys != 3)
+   {
+
+/*
+   Deflecting bodies, each at the time the light passed closest to it
+   (see 'frame_place').
+*/
+
+      for (i = 0; i < m; i++)
+         use[i] = 1.0;
+
+      for (b = 0; b < frame->nbodies; b++)
+      {
+         for (i = 0; i < m; i++)
+         {
+            dis = sqrt (qx[i] * qx[i] + qy[i] * qy[i] + qz[i] * qz[i]);
+            dlt = (frame->pbodyo[b][0] * (qx[i] / dis) +
+                   frame->pbodyo[b][1] * (qy[i] / dis) +
+                   frame->pbodyo[b][2] * (qz[i] / dis)) / C_AUDAY;
+            tlt = tl[i];
+
+            dt = (dlt > 0.0) ? -dlt : 0.0;
+            dt = (tlt < dlt) ? -tlt : dt;
+
+            bx[i] = frame->pbody[b][0] + frame->vbody[b][0] * dt;
+            by[i] = frame->pbody[b][1] + frame->vbody[b][1] * dt;
+            bz[i] = frame->pbody[b][2] + frame->vbody[b][2] * dt;
+         }
+
+         deflect_block (m,frame->pob,bx,by,bz,use,
+            RMASS[frame->body_num[b]], qx,qy,qz);
+      }
+
+/*
+   The Earth, for an observer away from the geocenter, unless the star
+   is near or beyond the limb ('limb_angle').
+*/
+
+      if (frame->loc == 1)
+      {
+         x = sqrt (frame->pog[0] * frame->pog[0] +
+                   frame->pog[1] * frame->pog[1] +
+                   frame->pog[2] * frame->pog[2]);
+
+         for (i = 0; i < m; i++)
+         {
+            dis = sqrt (px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i]);
+            y = (px[i] * frame->pog[0] + py[i] * frame->pog[1] +
+               pz[i] * frame->pog[2]) / (dis * x);
+
+            use[i] = (y >= data->coslimb) ? 1.0 : 0.0;
+            bx[i] = frame->peb[0];
+            by[i] = frame->peb[1];
+            bz[i] = frame->peb[2];
+         }
+
+         deflect_block (m,frame->pob,bx,by,bz,use,RMASS[3], qx,qy,qz);
+      }
+
+/*
+   'aberration', with the light times of 'bary2obs'.
+*/
+
+      for (i = 0; i < m; i++)
+      {
+         x = (qx[i] * frame->vob[0] + qy[i] * frame->vob[1] +
+            qz[i] * frame->vob[2]) / (tl[i] * C_AUDAY);
+         p = x / C_AUDAY;
+         q = (1.0 + p / (1.0 + data->gammai)) * tl[i];
+         r = 1.0 + p;
+
+         x = (data->gammai * qx[i] + q * frame->vob[0]) / r;
+         y = (data->gammai * qy[i] + q * frame->vob[1]) / r;
+         z = (data->gammai * qz[i] + q * frame->vob[2]) / r;
+
+         qx[i] = x;
+         qy[i] = y;
+         qz[i] = z;
+      }
+   }
+
+/*
+   Rotate to the output system, and form the spherical coordinates.
+*/
+
+   for (i = 0; i < m; i++)
+   {
+      x = frame->rot[0][0] * qx[i] + frame->rot[0][1] * qy[i] +
+          frame->rot[0][2] * qz[i];
+      y = frame->rot[1][0] * qx[i] + frame->rot[1][1] * qy[i] +
+          frame->rot[1][2] * qz[i];
+      z = frame->rot[2][0] * qx[i] + frame->rot[2][1] * qy[i] +
+          frame->rot[2][2] * qz[i];
+
+      qx[i] = x;
+      qy[i] = y;
+      qz[i] = z;
+   }
+
+   for (i = 0; i < m; i++)
+   {
+      pos[0] = qx[i];
+      pos[1] = qy[i];
+      pos[2] = qz[i];
+
+      vector2radec (pos, &data->ra[first + i],&data->dec[first + i]);
+   }
+
+   return;
+}
+
+/********deflect_block */
+
+static inline void deflect_block (long int m, const double *pob,
+                                  const double *bx, const double *by,
+                                  const double *bz, const double *use,
+                                  double rmass,
+
+                                  double *px, double *py, double *pz)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function corrects the positions of 'm' stars for the
+      deflection of light by one body, as 'grav_vec' for each of them.
+
+   REFERENCES:
+      See function 'grav_vec'.
+
+   INPUT
+   ARGUMENTS:
+      m (long int)
+         Number of stars.
+      pob[3] (double)
+         Barycentric position of the observer (AU).
+      *bx, *by, *bz (double)
+         Barycentric positions of the deflecting body for each star
+         (AU), one array per component.
+      *use (double)
+         1.0 for the stars to be corrected, 0.0 for the others.
+      rmass (double)
+         Reciprocal mass of the deflecting body in solar mass units.
+
+   OUTPUT
+   ARGUMENTS:
+      *px, *py, *pz (double)
+         Positions of the stars with respect to the observer (AU), one
+         array per component; replaced by the deflected positions.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      C, AU, GS          novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sqrt               math.h
+      fabs               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The position is left unchanged when the star and the body are
+      in the same direction, as in 'grav_vec'.
+
+------------------------------------------------------------------------
+*/
+{
+   short int keep;
+
+   long int i;
+
+   double pq0, pq1, pq2, pe0, pe1, pe2, pmag, emag, qmag, phat0, phat1,
+      phat2, ehat0, ehat1, ehat2, qhat0, qhat1, qhat2, pdotq, edotp,
+      qdote, fac1, fac2, x, y, z;
+
+   for (i = 0; i < m; i++)
+   {
+      pq0 = pob[0] + px[i] - bx[i];
+      pq1 = pob[1] + py[i] - by[i];
+      pq2 = pob[2] + pz[i] - bz[i];
+
+      pe0 = pob[0] - bx[i];
+      pe1 = pob[1] - by[i];
+      pe2 = pob[2] - bz[i];
+
+      pmag = sqrt (px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i]);
+      emag = sqrt (pe0 * pe0 + pe1 * pe1 + pe2 * pe2);
+      qmag = sqrt (pq0 * pq0 + pq1 * pq1 + pq2 * pq2);
+
+      phat0 = px[i] / pmag;
+      phat1 = py[i] / pmag;
+      phat2 = pz[i] / pmag;
+      ehat0 = pe0 / emag;
+      ehat1 = pe1 / emag;
+      ehat2 = pe2 / emag;
+      qhat0 = pq0 / qmag;
+      qhat1 = pq1 / qmag;
+      qhat2 = pq2 / qmag;
+
+      pdotq = phat0 * qhat0 + phat1 * qhat1 + phat2 * qhat2;
+      edotp = ehat0 * phat0 + ehat1 * phat1 + ehat2 * phat2;
+      qdote = qhat0 * ehat0 + qhat1 * ehat1 + qhat2 * ehat2;
+
+      fac1 = 2.0 * GS / (C * C * emag * AU * rmass);
+      fac2 = 1.0 + qdote;
+
+      x = phat0 + fac1 * (pdotq * ehat0 - edotp * qhat0) / fac2;
+      y = phat1 + fac1 * (pdotq * ehat1 - edotp * qhat1) / fac2;
+      z = phat2 + fac1 * (pdotq * ehat2 - edotp * qhat2) / fac2;
+
+      keep = (use[i] == 0.0) | (fabs (edotp) > 0.99999999999);
+
+      px[i] = keep ? px[i] : x * pmag;
+      py[i] = keep ? py[i] : y * pmag;
+      pz[i] = keep ? pz[i] : z * pmag;
+   }
+
+   return;
+}
@@ -13,13 +13,17 @@
 #include <stdlib.h>
 
 /*
-   Function prototype.
+   Function prototypes.
 */
 
    double *readeph (int mp, char *name, double jd,
 
                     int *error );
 
+   int readeph_pv (int mp, char *name, double jd,
+
+                   double *pv);
+
 
 /********readeph */
 
@@ -56,7 +60,7 @@ double *readeph (int mp, char *name, double jd,
    VALUE:
       (double *)
          Pointer to the 6-element 'pv' array, with all elements set to
-         zero.
+         zero, or NULL if it cannot be allocated.
 
    GLOBALS
    USED:
@@ -64,6 +68,7 @@ double *readeph (int mp, char *name, double jd,
 
    FUNCTIONS
    CALLED:
+      readeph_pv  readeph0.c
       malloc      stdlib.c
 
    VER./DATE/
@@ -75,20 +80,88 @@ double *readeph (int mp, char *name, double jd,
                                 9 on return.  Basic code courtesy JLH.
       V1.3/09-10/WKP (USNO/AA): Added references to parameters to
                                 silence compiler warnings.
+      V1.4/10-26/ROA:           Wrapper around 'readeph_pv'.
 
    NOTES:
       1.  This dummy function is not intended to be called.  It merely
       serves as a stub for the "real" 'readeph' when NOVAS-C is used
       without the minor planet ephemerides.  If this function is
       called, an error of 9 will be returned.
+      2.  The caller must free the returned array.  Use 'readeph_pv' to
+      avoid the allocation.
 
 ------------------------------------------------------------------------
 */
 {
-   int i;
-
    double *pv;
 
+   pv = (double *) malloc (6L * sizeof (double));
+   if (pv == NULL)
+      return pv;
+
+   *error = readeph_pv (mp, name, jd, pv);
+
+   return pv;
+}
+
+/********readeph_pv */
+
+int readeph_pv (int mp, char *name, double jd,
+
+                double *pv)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This is a dummy version of function 'readeph_pv', the version of
+      'readeph' that writes into an array supplied by the caller.  It
+      serves as a stub for the "real" minor planet ephemerides.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      mp (int)
+         The number of the asteroid for which the position in desired.
+      name (char*)
+         The name of the asteroid.
+      jd (double)
+         The Julian date on which to find the position and velocity.
+
+   OUTPUT
+   ARGUMENTS:
+      pv[6] (double)
+         Heliocentric position (AU) and velocity (AU/day) of the
+         asteroid; all elements set to zero.
+
+   RETURNED
+   VALUE:
+      (int)
+         Error code; always 9 (see note of 'readeph').
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA:           Moved out of 'readeph' V1.3.
+
+   NOTES:
+      1.  A "real" minor planet ephemeris must provide both functions;
+      'ephemeris' only calls 'readeph_pv', so no memory is allocated
+      on its minor planet path.
+
+------------------------------------------------------------------------
+*/
+{
+   int i;
+
 /*
    The following three lines do nothing and are just here to prevent "unreferenced
    formal parameter" compiler warnings.
@@ -98,12 +171,8 @@ double *readeph (int mp, char *name, double jd,
    name = name;
    jd = jd;
 
-   pv = (double *) malloc (6L * sizeof (double));
-
    for (i = 0; i < 6; i++)
       pv[i] = 0.0;
 
-   *error = 9;
-
-   return pv;
+   return 9;
 }
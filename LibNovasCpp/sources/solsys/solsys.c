@@ -0,0 +1,855 @@
+/*
+  Naval Observatory Vector Astrometry Software (NOVAS)
+  C Edition, Version 3.1
+
+  solsys.c: Run-time selection of the solar system ephemeris
+
+  Royal Observatory of the Spanish Navy
+*/
+
+#include <stddef.h>
+
+#include "novas.h"
+#include "solarsystem.h"
+
+static short int jpl_low (void *state, double tjd[2], short int body,
+                          short int origin,
+
+                          double *position, double *velocity);
+
+static short int jpl_high (void *state, double tjd[2], short int body,
+                           short int origin,
+
+                           double *position, double *velocity);
+
+static short int analytic_low (void *state, double tjd[2], short int body,
+                               short int origin,
+
+                               double *position, double *velocity);
+
+static short int analytic_high (void *state, double tjd[2],
+                                short int body, short int origin,
+
+                                double *position, double *velocity);
+
+#ifdef NOVAS_SOLSYS2
+static short int fortran_low (void *state, double tjd[2], short int body,
+                              short int origin,
+
+                              double *position, double *velocity);
+
+static short int fortran_high (void *state, double tjd[2], short int body,
+                               short int origin,
+
+                               double *position, double *velocity);
+#endif
+
+/*
+   'SOLSYS' holds the registered backends, indexed by identifier
+   ('low' is NULL for free entries).  'SOLSYS_SELECTED' holds the
+   backend used by 'solarsystem_hp' (full accuracy, element 0) and
+   'solarsystem' (reduced accuracy, element 1).  See function
+   'set_solsys_backend' for more details.
+*/
+
+static solsys_backend SOLSYS[SOLSYS_MAX_BACKENDS] = {
+   {NULL, NULL, NULL, NULL},
+   {"JPL ephemeris (eph_manager)", jpl_low, jpl_high, NULL},
+#ifdef NOVAS_SOLSYS2
+   {"JPL ephemeris (jplint.f)", fortran_low, fortran_high, NULL},
+#else
+   {NULL, NULL, NULL, NULL},
+#endif
+   {"Sun-Earth analytic theory", analytic_low, analytic_high, NULL}};
+
+static short int SOLSYS_SELECTED[2] = {SOLSYS_ANALYTIC, SOLSYS_ANALYTIC};
+
+/********solarsystem */
+
+short int solarsystem (double tjd, short int body, short int origin,
+
+                       double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Provides the position and velocity of a solar system body from
+      the backend selected for reduced accuracy.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      tjd (double)
+         Julian date of the desired time, on the TDB time scale.
+      body (short int)
+         Body identification number for the solar system object of
+         interest;Mercury = 1, ..., Pluto= 9, Sun= 10, Moon = 11.
+      origin (short int)
+         Origin code
+            = 0 ... solar system barycenter
+            = 1 ... center of mass of the Sun
+            = 2 ... center of Earth
+
+   OUTPUT
+   ARGUMENTS:
+      position[3] (double)
+         Position vector of 'body' at tjd; equatorial rectangular
+         coordinates in AU referred to the ICRS.
+      velocity[3] (double)
+         Velocity vector of 'body' at tjd; equatorial rectangular
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0    ... Everything OK.
+         n    ... Error code from the backend.
+
+   GLOBALS
+   USED:
+      SOLSYS, SOLSYS_SELECTED   solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Until 'set_solsys_backend' is called this is the analytic
+      theory of solsys3.c, as in the default build of earlier versions.
+
+------------------------------------------------------------------------
+*/
+{
+   solsys_backend *backend = &SOLSYS[SOLSYS_SELECTED[1]];
+
+   double jd[2];
+
+   jd[0] = tjd;
+   jd[1] = 0.0;
+
+   return backend->low (backend->state, jd,body,origin, position,velocity);
+}
+
+/********solarsystem_hp */
+
+short int solarsystem_hp (double tjd[2], short int body,
+                          short int origin,
+
+                          double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Provides the position and velocity of a solar system body from
+      the backend selected for full accuracy.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      tjd[2] (double)
+         Two-element array containing the Julian date, which may be
+         split any way (although the first element is usually the
+         "integer" part, and the second element is the "fractional"
+         part).  Julian date is on the TDB or "T_eph" time scale.
+      body (short int)
+         Body identification number for the solar system object of
+         interest;Mercury = 1, ..., Pluto= 9, Sun= 10, Moon = 11.
+      origin (short int)
+         Origin code
+            = 0 ... solar system barycenter
+            = 1 ... center of mass of the Sun
+            = 2 ... center of Earth
+
+   OUTPUT
+   ARGUMENTS:
+      position[3] (double)
+         Position vector of 'body' at 'tjd'; equatorial rectangular
+         coordinates in AU referred to the ICRS.
+      velocity[3] (double)
+         Velocity vector of 'body' at 'tjd'; equatorial rectangular
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0    ... Everything OK.
+         n    ... Error code from the backend.
+
+   GLOBALS
+   USED:
+      SOLSYS, SOLSYS_SELECTED   solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See note 1 of 'solarsystem'.
+
+------------------------------------------------------------------------
+*/
+{
+   solsys_backend *backend = &SOLSYS[SOLSYS_SELECTED[0]];
+
+   return backend->high (backend->state, tjd,body,origin,
+      position,velocity);
+}
+
+/********solarsystem_backend */
+
+short int solarsystem_backend (short int backend, short int accuracy,
+                               double tjd[2], short int body,
+                               short int origin,
+
+                               double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Provides the position and velocity of a solar system body from a
+      given backend, whatever the selection of 'set_solsys_backend'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      backend (short int)
+         Identifier of the backend (SOLSYS_JPL, SOLSYS_ANALYTIC, ...).
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy ('high' function of the backend)
+            = 1 ... reduced accuracy ('low' function of the backend)
+      tjd[2] (double)
+         TDB Julian date, split as in 'solarsystem_hp'.
+      body (short int)
+         Body identification number (see 'solarsystem').
+      origin (short int)
+         Origin code (see 'solarsystem').
+
+   OUTPUT
+   ARGUMENTS:
+      position[3] (double)
+         Position vector of 'body', in AU referred to the ICRS.
+      velocity[3] (double)
+         Velocity vector of 'body', in AU/day referred to the ICRS.
+         May be NULL if only the position is wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0    ... Everything OK.
+         n    ... Error code from the backend.
+         99   ... Invalid 'backend' or 'accuracy'.
+
+   GLOBALS
+   USED:
+      SOLSYS             solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Lets a caller keep its own choice of backend (for example a
+      cheap one for previews and the JPL file for pointing) without
+      changing the selection used by the rest of the library.
+
+------------------------------------------------------------------------
+*/
+{
+   solsys_backend *b;
+
+   if ((backend < 1) || (backend >= SOLSYS_MAX_BACKENDS) ||
+      (SOLSYS[backend].low == NULL) || (accuracy < 0) || (accuracy > 1))
+      return 99;
+
+   b = &SOLSYS[backend];
+
+   if (accuracy == 0)
+      return b->high (b->state, tjd,body,origin, position,velocity);
+    else
+      return b->low (b->state, tjd,body,origin, position,velocity);
+}
+
+/********register_solsys_backend */
+
+short int register_solsys_backend (short int backend,
+                                   const solsys_backend *functions)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function adds a solar system backend, or replaces one.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      backend (short int)
+         Identifier, 1 to SOLSYS_MAX_BACKENDS - 1.
+      *functions (solsys_backend)
+         Name, functions and state of the backend (copied).
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'backend'.
+          = 2 ... 'low' or 'high' is NULL.
+
+   GLOBALS
+   USED:
+      SOLSYS             solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Backends are meant to be registered and selected at start-up;
+      these functions must not be called while other threads compute
+      positions.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((backend < 1) || (backend >= SOLSYS_MAX_BACKENDS))
+      return 1;
+
+   if ((functions->low == NULL) || (functions->high == NULL))
+      return 2;
+
+   SOLSYS[backend] = *functions;
+
+   return 0;
+}
+
+/********set_solsys_state */
+
+short int set_solsys_state (short int backend, void *state)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function sets the state pointer passed to the functions of
+      a backend.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      backend (short int)
+         Identifier of a registered backend.
+      *state (void)
+         New state; for SOLSYS_JPL, an 'ephem_handle' opened with
+         'ephem_open_r', or NULL for the file of 'ephem_open'.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid or unregistered 'backend'.
+
+   GLOBALS
+   USED:
+      SOLSYS             solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. See note 1 of 'register_solsys_backend'.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((backend < 1) || (backend >= SOLSYS_MAX_BACKENDS) ||
+      (SOLSYS[backend].low == NULL))
+      return 1;
+
+   SOLSYS[backend].state = state;
+
+   return 0;
+}
+
+/********set_solsys_backend */
+
+short int set_solsys_backend (short int accuracy, short int backend)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function selects the solar system backend used for one
+      accuracy level, i.e. by 'solarsystem_hp' (full accuracy) or
+      'solarsystem' (reduced accuracy), and so by 'ephemeris' and all
+      the place functions.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+      backend (short int)
+         Identifier of a registered backend.
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+          = 0 ... Everything OK.
+          = 1 ... Invalid value of 'accuracy'.
+          = 2 ... Invalid or unregistered 'backend'.
+
+   GLOBALS
+   USED:
+      SOLSYS, SOLSYS_SELECTED   solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. For example, set_solsys_backend (0, SOLSYS_JPL) and
+      set_solsys_backend (1, SOLSYS_ANALYTIC) give JPL positions to
+      full-accuracy calls and the file-free theory to reduced-accuracy
+      ones in the same process.
+      2. See note 1 of 'register_solsys_backend'.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((accuracy < 0) || (accuracy > 1))
+      return 1;
+
+   if ((backend < 1) || (backend >= SOLSYS_MAX_BACKENDS) ||
+      (SOLSYS[backend].low == NULL))
+      return 2;
+
+   SOLSYS_SELECTED[accuracy] = backend;
+
+   return 0;
+}
+
+/********get_solsys_backend */
+
+short int get_solsys_backend (short int accuracy)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      This function returns the solar system backend selected for one
+      accuracy level.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      accuracy (short int)
+         Selection for accuracy
+            = 0 ... full accuracy
+            = 1 ... reduced accuracy
+
+   OUTPUT
+   ARGUMENTS:
+      None.
+
+   RETURNED
+   VALUE:
+      (short int)
+         Identifier of the backend, or 0 if 'accuracy' is invalid.
+
+   GLOBALS
+   USED:
+      SOLSYS_SELECTED    solsys.c
+
+   FUNCTIONS
+   CALLED:
+      None.
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   if ((accuracy < 0) || (accuracy > 1))
+      return 0;
+
+   return SOLSYS_SELECTED[accuracy];
+}
+
+/********jpl_low */
+
+static short int jpl_low (void *state, double tjd[2], short int body,
+                          short int origin,
+
+                          double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Reduced-accuracy function of SOLSYS_JPL: 'solarsystem_jpl' on the
+      default file, 'solarsystem_hp_jpl' on the handle in 'state'
+      otherwise.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_jpl' or 'solarsystem_hp_jpl'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_jpl    solsys1.c
+      solarsystem_hp_jpl solsys1.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   double jd[2];
+
+   if (state == NULL)
+      return solarsystem_jpl (tjd[0] + tjd[1],body,origin,
+         position,velocity);
+
+   jd[0] = tjd[0] + tjd[1];
+   jd[1] = 0.0;
+
+   return solarsystem_hp_jpl ((ephem_handle *) state, jd,body,origin,
+      position,velocity);
+}
+
+/********jpl_high */
+
+static short int jpl_high (void *state, double tjd[2], short int body,
+                           short int origin,
+
+                           double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Full-accuracy function of SOLSYS_JPL.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_hp_jpl'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_hp_jpl solsys1.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   return solarsystem_hp_jpl ((ephem_handle *) state, tjd,body,origin,
+      position,velocity);
+}
+
+/********analytic_low */
+
+static short int analytic_low (void *state, double tjd[2], short int body,
+                               short int origin,
+
+                               double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Reduced-accuracy function of SOLSYS_ANALYTIC.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h); 'state' is not used.
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_analytic'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_analytic solsys3.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   (void) state;
+
+   return solarsystem_analytic (tjd[0] + tjd[1],body,origin,
+      position,velocity);
+}
+
+/********analytic_high */
+
+static short int analytic_high (void *state, double tjd[2],
+                                short int body, short int origin,
+
+                                double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Full-accuracy function of SOLSYS_ANALYTIC.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h); 'state' is not used.
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_hp_analytic'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_hp_analytic solsys3.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   (void) state;
+
+   return solarsystem_hp_analytic (tjd,body,origin, position,velocity);
+}
+
+#ifdef NOVAS_SOLSYS2
+
+/********fortran_low */
+
+static short int fortran_low (void *state, double tjd[2], short int body,
+                              short int origin,
+
+                              double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Reduced-accuracy function of SOLSYS_FORTRAN.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h); 'state' is not used.
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_fortran'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_fortran solsys2.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   (void) state;
+
+   return solarsystem_fortran (tjd[0] + tjd[1],body,origin,
+      position,velocity);
+}
+
+/********fortran_high */
+
+static short int fortran_high (void *state, double tjd[2], short int body,
+                               short int origin,
+
+                               double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Full-accuracy function of SOLSYS_FORTRAN.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h); 'state' is not used.
+
+   OUTPUT
+   ARGUMENTS:
+      As 'solsys_function' (solarsystem.h).
+
+   RETURNED
+   VALUE:
+      (short int)
+         Error code of 'solarsystem_hp_fortran'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      solarsystem_hp_fortran solsys2.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   (void) state;
+
+   return solarsystem_hp_fortran (tjd,body,origin, position,velocity);
+}
+
+#endif
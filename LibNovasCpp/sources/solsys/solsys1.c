@@ -15,13 +15,14 @@
 
 #include "novas.h"
 #include "eph_manager.h"
+#include "solarsystem.h"
 
 
-/********solarsystem */
+/********solarsystem_jpl */
 
-short int solarsystem (double tjd, short int body, short int origin,
+short int solarsystem_jpl (double tjd, short int body, short int origin,
 
-                       double *position, double *velocity)
+                           double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -56,7 +57,8 @@ short int solarsystem (double tjd, short int body, short int origin,
          coordinates in AU referred to the ICRS.
       velocity[3] (double)
          Velocity vector of 'body' at tjd; equatorial rectangular
-         system referred to the ICRS, in AU/day.
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
 
    RETURNED
    VALUE:
@@ -87,6 +89,10 @@ short int solarsystem (double tjd, short int body, short int origin,
                                 consistency with other documentation.
       V2.6/02-11/WKP (USNO/AA): More minor prolog changes for
                                 consistency among all solsysn.c files.
+      V2.7/10-26/ROA:           Position only if 'velocity' is NULL.
+      V2.8/10-26/ROA:           Renamed from 'solarsystem', which now
+                                selects a backend at run time (see
+                                'set_solsys_backend').
 
 
    NOTES:
@@ -100,7 +106,7 @@ short int solarsystem (double tjd, short int body, short int origin,
       3. This function places the entire Julian date in the first
          element of the input time to 'planet_ephemeris'. This is
          adequate for all but the highest precision applications.  For
-         highest precision, use function 'solarsystem_hp' in file
+         highest precision, use function 'solarsystem_hp_jpl' in file
          'solsys1.c'.
       4. Function 'planet_ephemeris' is a C rewrite of the JPL Fortran
          subroutine 'pleph'.
@@ -162,12 +168,12 @@ short int solarsystem (double tjd, short int body, short int origin,
    return 0;
 }
 
-/********solarsystem_hp */
+/********solarsystem_hp_jpl */
 
-short int solarsystem_hp (double tjd[2], short int body,
-                          short int origin,
+short int solarsystem_hp_jpl (ephem_handle *eph, double tjd[2],
+                              short int body, short int origin,
 
-                          double *position, double *velocity)
+                              double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -184,6 +190,9 @@ short int solarsystem_hp (double tjd[2], short int body,
 
    INPUT
    ARGUMENTS:
+      *eph (ephem_handle)
+         Ephemeris file opened with 'ephem_open_r', or NULL for the
+         file opened with 'ephem_open'.
       tjd[2] (double)
          Two-element array containing the Julian date, which may be
          split any way (although the first element is usually the
@@ -205,7 +214,8 @@ short int solarsystem_hp (double tjd[2], short int body,
          coordinates in AU referred to the ICRS.
       velocity[3] (double)
          Velocity vector of 'body' at tjd; equatorial rectangular
-         system referred to the ICRS, in AU/day.
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
 
    RETURNED
    VALUE:
@@ -218,6 +228,7 @@ short int solarsystem_hp (double tjd[2], short int body,
    FUNCTIONS
    CALLED:
       planet_ephemeris          eph_manager.h
+      planet_ephemeris_r        eph_manager.h
 
    VER./DATE/
    PROGRAMMER:
@@ -232,6 +243,9 @@ short int solarsystem_hp (double tjd[2], short int body,
                                 consistency with other documentation.
       V1.4/02-11/WKP (USNO/AA): More minor prolog changes for
                                 consistency among all solsysn.c files.
+      V1.5/10-26/ROA:           Position only if 'velocity' is NULL.
+      V1.6/10-26/ROA:           Renamed from 'solarsystem_hp'; added
+                                'eph'.
 
 
    NOTES:
@@ -244,7 +258,7 @@ short int solarsystem_hp (double tjd[2], short int body,
          function.
       3. This function supports the "split" Julian date feature of
          function 'planet_ephemeris' for highest precision.  For
-         usual applications, use function 'solarsystem' in file
+         usual applications, use function 'solarsystem_jpl' in file
          'solsys1.c'.
       4. Function 'planet_ephemeris' is a C rewrite of the JPL Fortran
          subroutine 'pleph'.
@@ -295,7 +309,10 @@ short int solarsystem_hp (double tjd[2], short int body,
    between two double-precision elements for highest precision.
 */
 
-   planet_ephemeris (tjd,target,center, position,velocity);
+   if (eph == NULL)
+      planet_ephemeris (tjd,target,center, position,velocity);
+    else
+      planet_ephemeris_r (eph,tjd,target,center, position,velocity);
 
    return 0;
 }
@@ -13,6 +13,7 @@
 #ifndef _NOVAS_
    #include "novas.h"
 #endif
+#include "solarsystem.h"
 
 /*
    Dummy function prototype for Fortran subroutine 'jplint'.
@@ -29,11 +30,12 @@ void jplihp_ (double *jed, long int *targ, long int *cent,
 
 
 
-/********solarsystem */
+/********solarsystem_fortran */
 
-short int solarsystem (double tjd, short int body, short int origin,
+short int solarsystem_fortran (double tjd, short int body,
+                               short int origin,
 
-                       double *position, double *velocity)
+                               double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -67,7 +69,8 @@ short int solarsystem (double tjd, short int body, short int origin,
          coordinates in AU referred to the ICRS.
       velocity[3] (double)
          Velocity vector of 'body' at tjd; equatorial rectangular
-         system referred to the ICRS, in AU/day.
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
 
    RETURNED
    VALUE:
@@ -97,6 +100,8 @@ short int solarsystem (double tjd, short int body, short int origin,
                                 consistency with other documentation.
       V1.4/02-11/WKP (USNO/AA): More minor prolog changes for
                                 consistency among all solsysn.c files.
+      V1.5/10-26/ROA:           Accept a NULL 'velocity'.
+      V1.6/10-26/ROA:           Renamed (see 'set_solsys_backend').
 
 
    NOTES:
@@ -167,18 +172,19 @@ short int solarsystem (double tjd, short int body, short int origin,
    for (i = 0; i < 3; i++)
    {
       position[i] = posvel[i];
-      velocity[i] = posvel[i+3];
+      if (velocity)
+         velocity[i] = posvel[i+3];
    }
 
    return 0;
 }
 
-/********solarsystem_hp */
+/********solarsystem_hp_fortran */
 
-short int solarsystem_hp (double tjd[2], short int body,
-                          short int origin,
+short int solarsystem_hp_fortran (double tjd[2], short int body,
+                                  short int origin,
 
-                          double *position, double *velocity)
+                                  double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -215,7 +221,8 @@ short int solarsystem_hp (double tjd[2], short int body,
          coordinates in AU referred to the ICRS.
       velocity[3] (double)
          Velocity vector of 'body' at tjd; equatorial rectangular
-         system referred to the ICRS, in AU/day.
+         system referred to the ICRS, in AU/day.  May be NULL if only
+         the position is wanted.
 
    RETURNED
    VALUE:
@@ -245,6 +252,8 @@ short int solarsystem_hp (double tjd[2], short int body,
                                 consistency with other documentation.
       V1.4/02-11/WKP (USNO/AA): More minor prolog changes for
                                 consistency among all solsysn.c files.
+      V1.5/10-26/ROA:           Accept a NULL 'velocity'.
+      V1.6/10-26/ROA:           Renamed (see 'set_solsys_backend').
 
 
    NOTES:
@@ -257,7 +266,7 @@ short int solarsystem_hp (double tjd[2], short int body,
          'jplihp' rather than in this function.
       2. This function supports the "split" Julian date feature of
          JPL subroutine 'dpleph' for highest precision.  For
-         usual applications, use function 'solarsystem' in file
+         usual applications, use function 'solarsystem_fortran' in file
          'solsys2.c'.
 
 ------------------------------------------------------------------------
@@ -320,7 +329,8 @@ short int solarsystem_hp (double tjd[2], short int body,
    for (i = 0; i < 3; i++)
    {
       position[i] = posvel[i];
-      velocity[i] = posvel[i+3];
+      if (velocity)
+         velocity[i] = posvel[i+3];
    }
 
    return 0;
@@ -11,25 +11,165 @@
 */
 
 #include <math.h>
+#include <stddef.h>
 
 #include "novas.h"
 #include "novascon.h"
+#include "nutation.h"
+#include "parallel.h"
+#include "solarsystem.h"
 
 /*
-   Additional function prototype.
+   Number of epochs evaluated together by 'solarsystem_analytic_batch'.
+*/
+
+#define SOLSYS3_BLOCK 64
+
+/*
+   The arrays below contain masses and orbital elements for the four
+   largest planets -- Jupiter, Saturn, Uranus, and Neptune --  (see
+   Explanatory Supplement (1992), p. 316) with angles in radians.  These
+   data are used for barycenter computations only.
+*/
+
+static const double pm[4] = {1047.349, 3497.898, 22903.0, 19412.2};
+static const double pa[4] = {5.203363, 9.537070, 19.191264, 30.068963};
+static const double pe[4] = {0.048393, 0.054151, 0.047168, 0.008586};
+static const double pj[4] = {0.022782, 0.043362, 0.013437, 0.030878};
+static const double po[4] = {1.755036, 1.984702, 1.295556, 2.298977};
+static const double pw[4] = {0.257503, 1.613242, 2.983889, 0.784898};
+static const double pl[4] = {0.600470, 0.871693, 5.466933, 5.321160};
+static const double pn[4] = {1.450138e-3, 5.841727e-4, 2.047497e-4,
+                             1.043891e-4};
+
+/*
+   'obl' is the obliquity of ecliptic at epoch J2000.0 in degrees.
+*/
+
+static const double obl = 23.4392794444;
+
+/*
+   Series of the longitude and distance of the Sun (see 'sun_eph').
+*/
+
+struct sun_con
+{
+double l;
+double r;
+double alpha;
+double nu;
+};
+
+static const struct sun_con con[50] =
+   {{403406.0,      0.0, 4.721964,     1.621043},
+    {195207.0, -97597.0, 5.937458, 62830.348067},
+    {119433.0, -59715.0, 1.115589, 62830.821524},
+    {112392.0, -56188.0, 5.781616, 62829.634302},
+    {  3891.0,  -1556.0, 5.5474  , 125660.5691 },
+    {  2819.0,  -1126.0, 1.5120  , 125660.9845 },
+    {  1721.0,   -861.0, 4.1897  ,  62832.4766 },
+    {     0.0,    941.0, 1.163   ,      0.813  },
+    {   660.0,   -264.0, 5.415   , 125659.310  },
+    {   350.0,   -163.0, 4.315   ,  57533.850  },
+    {   334.0,      0.0, 4.553   ,    -33.931  },
+    {   314.0,    309.0, 5.198   , 777137.715  },
+    {   268.0,   -158.0, 5.989   ,  78604.191  },
+    {   242.0,      0.0, 2.911   ,      5.412  },
+    {   234.0,    -54.0, 1.423   ,  39302.098  },
+    {   158.0,      0.0, 0.061   ,    -34.861  },
+    {   132.0,    -93.0, 2.317   , 115067.698  },
+    {   129.0,    -20.0, 3.193   ,  15774.337  },
+    {   114.0,      0.0, 2.828   ,   5296.670  },
+    {    99.0,    -47.0, 0.52    ,  58849.27   },
+    {    93.0,      0.0, 4.65    ,   5296.11   },
+    {    86.0,      0.0, 4.35    ,  -3980.70   },
+    {    78.0,    -33.0, 2.75    ,  52237.69   },
+    {    72.0,    -32.0, 4.50    ,  55076.47   },
+    {    68.0,      0.0, 3.23    ,    261.08   },
+    {    64.0,    -10.0, 1.22    ,  15773.85   },
+    {    46.0,    -16.0, 0.14    ,  188491.03  },
+    {    38.0,      0.0, 3.44    ,   -7756.55  },
+    {    37.0,      0.0, 4.37    ,     264.89  },
+    {    32.0,    -24.0, 1.14    ,  117906.27  },
+    {    29.0,    -13.0, 2.84    ,   55075.75  },
+    {    28.0,      0.0, 5.96    ,   -7961.39  },
+    {    27.0,     -9.0, 5.09    ,  188489.81  },
+    {    27.0,      0.0, 1.72    ,    2132.19  },
+    {    25.0,    -17.0, 2.56    ,  109771.03  },
+    {    24.0,    -11.0, 1.92    ,   54868.56  },
+    {    21.0,      0.0, 0.09    ,   25443.93  },
+    {    21.0,     31.0, 5.98    ,  -55731.43  },
+    {    20.0,    -10.0, 4.03    ,   60697.74  },
+    {    18.0,      0.0, 4.27    ,    2132.79  },
+    {    17.0,    -12.0, 0.79    ,  109771.63  },
+    {    14.0,      0.0, 4.24    ,   -7752.82  },
+    {    13.0,     -5.0, 2.01    ,  188491.91  },
+    {    13.0,      0.0, 2.65    ,     207.81  },
+    {    13.0,      0.0, 4.98    ,   29424.63  },
+    {    12.0,      0.0, 0.93    ,      -7.99  },
+    {    10.0,      0.0, 2.21    ,   46941.14  },
+    {    10.0,      0.0, 3.59    ,     -68.29  },
+    {    10.0,      0.0, 1.50    ,   21463.25  },
+    {    10.0,     -9.0, 2.55    ,  157208.40  }};
+
+/*
+   struct giant_planets: constants of the barycenter computation.
+
+   tmass              = mass of the Sun plus planets, in solar masses
+   a, b               = p and q vectors of the orbit of each planet
+                        scaled by its semi-axes (AU)
+*/
+
+typedef struct
+{
+   double tmass;
+   double a[3][4];
+   double b[3][4];
+} giant_planets;
+
+/*
+   struct analytic_batch: arguments of 'solarsystem_analytic_batch'
+   shared by the threads.
+*/
+
+typedef struct
+{
+   const double *tjd;
+   short int body;
+   short int origin;
+   const giant_planets *planets;
+   double *position;
+   double *velocity;
+} analytic_batch;
+
+/*
+   Additional function prototypes.
 */
 
 void sun_eph (double jd,
 
               double *ra, double *dec, double *dis);
 
+static void planet_constants (giant_planets *planets);
+
+static void barycenter (double tjd, const giant_planets *planets,
+
+                        double *pbary, double *vbary);
+
+static void earth_block (long int n, const double *jd,
 
+                         double *x, double *y, double *z);
 
-/********solarsystem */
+static void batch_analytic (long int begin, long int end, void *arg);
 
-short int solarsystem (double tjd, short int body, short int origin,
 
-                       double *position, double *velocity)
+
+/********solarsystem_analytic */
+
+short int solarsystem_analytic (double tjd, short int body,
+                                short int origin,
+
+                                double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -66,7 +206,7 @@ short int solarsystem (double tjd, short int body, short int origin,
       velocity[3] (double)
          Velocity vector of 'body' at 'tjd'; equatorial rectangular
          system referred to the mean equator and equinox of J2000.0,
-         in AU/Day.
+         in AU/Day.  May be NULL if only the position is wanted.
 
    RETURNED
    VALUE:
@@ -82,12 +222,11 @@ short int solarsystem (double tjd, short int body, short int origin,
    FUNCTIONS
    CALLED:
       sun_eph          solsys3.c
+      planet_constants solsys3.c
+      barycenter       solsys3.c
       radec2vector     novas.c
       precession       novas.c
-      sin              math.h
-      cos              math.h
       fabs             math.h
-      fmod             math.h
 
    VER./DATE/
    PROGRAMMER:
@@ -100,11 +239,20 @@ short int solarsystem (double tjd, short int body, short int origin,
       V1.4/11-09/JAB (USNO/AA) Update barycenter computation.
       V1.5/02-11/JLB (USNO/AA) Reformatted description of origin for 
                                consistency with other documentation.
+      V1.6/10-26/ROA           Position only if 'velocity' is NULL,
+                               skipping the numerical differentiation.
+      V1.7/10-26/ROA           Renamed from 'solarsystem', which now
+                               selects a backend at run time (see
+                               'set_solsys_backend').
+      V1.8/10-26/ROA           Constants and barycenter moved to
+                               'planet_constants' and 'barycenter'.
 
 
    NOTES:
       1. This function is the "C" version of Fortran NOVAS routine
       'solsys' version 3.
+      2. The static variables make this function unsafe to call from
+      several threads at once; use 'solarsystem_analytic_batch' there.
 
 ------------------------------------------------------------------------
 */
@@ -112,80 +260,19 @@ short int solarsystem (double tjd, short int body, short int origin,
    short int ierr = 0;
    short int i;
 
-/*
-   The arrays below contain masses and orbital elements for the four
-   largest planets -- Jupiter, Saturn, Uranus, and Neptune --  (see
-   Explanatory Supplement (1992), p. 316) with angles in radians.  These
-   data are used for barycenter computations only.
-*/
-
-   static const double pm[4] = {1047.349, 3497.898, 22903.0, 19412.2};
-   static const double pa[4] = {5.203363, 9.537070, 19.191264, 30.068963};
-   static const double pe[4] = {0.048393, 0.054151, 0.047168, 0.008586};
-   static const double pj[4] = {0.022782, 0.043362, 0.013437, 0.030878};
-   static const double po[4] = {1.755036, 1.984702, 1.295556, 2.298977};
-   static const double pw[4] = {0.257503, 1.613242, 2.983889, 0.784898};
-   static const double pl[4] = {0.600470, 0.871693, 5.466933, 5.321160};
-   static const double pn[4] = {1.450138e-3, 5.841727e-4, 2.047497e-4,
-                                1.043891e-4};
-
-/*
-   'obl' is the obliquity of ecliptic at epoch J2000.0 in degrees.
-*/
-
-   static const double obl = 23.4392794444;
-
    static double tlast = 0.0;
-   static double tmass, a[3][4], b[3][4], pbary[3], vbary[3];
+   static double pbary[3], vbary[3];
+   static giant_planets planets;
 
-   double oblr, se, ce, si, ci, sn, cn, sw, cw, p1, p2, p3, q1, q2, q3,
-      roote, qjd, ras, decs, diss, pos1[3], p[3][3], e, mlon, ma, u,
-      sinu, cosu, anr, pplan[3], vplan[3], f;
+   double qjd, ras, decs, diss, pos1[3], p[3][3];
 
 /*
    Initialize constants.
-   Initial value of 'tmass' is mass of Sun plus four inner planets.
 */
 
    if (tlast < 1.0)
    {
-      tmass = 1.0 + 5.977e-6;
-      oblr = obl * TWOPI / 360.0;
-      se = sin (oblr);
-      ce = cos (oblr);
-
-      for (i = 0; i < 4; i++)
-      {
-         tmass += 1.0 / pm[i];
-/*
-   Compute sine and cosine of orbital angles.
-*/
-         si = sin (pj[i]);
-         ci = cos (pj[i]);
-         sn = sin (po[i]);
-         cn = cos (po[i]);
-         sw = sin (pw[i] - po[i]);
-         cw = cos (pw[i] - po[i]);
-/*
-   Compute p and q vectors (see Brouwer & Clemence (1961), Methods of
-   Celestial Mechanics, pp. 35-36.)
-*/
-
-         p1 =   cw * cn - sw * sn * ci;
-         p2 = ( cw * sn + sw * cn * ci) * ce - sw * si * se;
-         p3 = ( cw * sn + sw * cn * ci) * se + sw * si * ce;
-         q1 =  -sw * cn - cw * sn * ci;
-         q2 = (-sw * sn + cw * cn * ci) * ce - cw * si * se;
-         q3 = (-sw * sn + cw * cn * ci) * se + cw * si * ce;
-         roote = sqrt (1.0 - pe[i] * pe[i]);
-         a[0][i] = pa[i] * p1;
-         a[1][i] = pa[i] * p2;
-         a[2][i] = pa[i] * p3;
-         b[0][i] = pa[i] * roote * q1;
-         b[1][i] = pa[i] * roote * q2;
-         b[2][i] = pa[i] * roote * q3;
-      }
-
+      planet_constants (&planets);
       tlast = 1.0;
    }
 
@@ -204,12 +291,21 @@ short int solarsystem (double tjd, short int body, short int origin,
    if ((body == 0) || (body == 1) || (body == 10))        /* Sun */
    {
       for (i = 0; i < 3; i++)
-         position[i] = velocity[i] = 0.0;
+      {
+         position[i] = 0.0;
+         if (velocity)
+            velocity[i] = 0.0;
+      }
    }
 
     else if ((body == 2) || (body == 3))                  /* Earth */
     {
-      for (i = 0; i < 3; i++)
+
+/*
+   Without 'velocity' only the middle epoch is needed.
+*/
+
+      for (i = (velocity ? 0 : 1); i < (velocity ? 3 : 2); i++)
       {
          qjd = tjd + (double) (i - 1) * 0.1;
          sun_eph (qjd, &ras,&decs,&diss);
@@ -222,7 +318,8 @@ short int solarsystem (double tjd, short int body, short int origin,
       for (i = 0; i < 3; i++)
       {
          position[i] = p[1][i];
-         velocity[i] = (p[2][i] - p[0][i]) / 0.2;
+         if (velocity)
+            velocity[i] = (p[2][i] - p[0][i]) / 0.2;
       }
     }
 
@@ -240,65 +337,15 @@ short int solarsystem (double tjd, short int body, short int origin,
    {
       if (fabs (tjd - tlast) >= 1.0e-06)
       {
-         for (i = 0; i < 3; i++)
-            pbary[i] = vbary[i] = 0.0;
-
-/*
-   The following loop cycles once for each of the four planets.
-*/
-
-         for (i = 0; i < 4; i++)
-         {
-
-/*
-   Compute mean longitude, mean anomaly, and eccentric anomaly.
-*/
-
-            e = pe[i];
-            mlon = pl[i] + pn[i] * (tjd - T0);
-            ma = fmod ((mlon - pw[i]), TWOPI);
-            u = ma + e * sin (ma) + 0.5 * e * e * sin (2.0 * ma);
-            sinu = sin (u);
-            cosu = cos (u);
-
-/*
-   Compute velocity factor.
-*/
-
-            anr = pn[i] / (1.0 - e * cosu);
-
-/*
-   Compute planet's position and velocity wrt eq & eq J2000.
-*/
-
-            pplan[0] = a[0][i] * (cosu - e) + b[0][i] * sinu;
-            pplan[1] = a[1][i] * (cosu - e) + b[1][i] * sinu;
-            pplan[2] = a[2][i] * (cosu - e) + b[2][i] * sinu;
-            vplan[0] = anr * (-a[0][i] * sinu + b[0][i] * cosu);
-            vplan[1] = anr * (-a[1][i] * sinu + b[1][i] * cosu);
-            vplan[2] = anr * (-a[2][i] * sinu + b[2][i] * cosu);
-
-/*
-   Compute mass factor and add in to total displacement.
-*/
-
-            f = 1.0 / (pm[i] * tmass);
-
-            pbary[0] += pplan[0] * f;
-            pbary[1] += pplan[1] * f;
-            pbary[2] += pplan[2] * f;
-            vbary[0] += vplan[0] * f;
-            vbary[1] += vplan[1] * f;
-            vbary[2] += vplan[2] * f;
-         }
-
+         barycenter (tjd, &planets, pbary, vbary);
          tlast = tjd;
       }
 
       for (i = 0; i < 3; i++)
       {
          position[i] -= pbary[i];
-         velocity[i] -= vbary[i];
+         if (velocity)
+            velocity[i] -= vbary[i];
       }
    }
 
@@ -306,12 +353,12 @@ short int solarsystem (double tjd, short int body, short int origin,
 }
 
 
-/********solarsystem_hp */
+/********solarsystem_hp_analytic */
 
-short int solarsystem_hp (double tjd[2], short int body,
-                          short int origin,
+short int solarsystem_hp_analytic (double tjd[2], short int body,
+                                   short int origin,
 
-                          double *position, double *velocity)
+                                   double *position, double *velocity)
 /*
 ------------------------------------------------------------------------
 
@@ -348,7 +395,7 @@ short int solarsystem_hp (double tjd[2], short int body,
       velocity[3] (double)
          Velocity vector of 'body' at 'tjd'; equatorial rectangular
          system referred to the mean equator and equinox of J2000.0,
-         in AU/Day.
+         in AU/Day.  May be NULL if only the position is wanted.
 
    RETURNED
    VALUE:
@@ -356,7 +403,7 @@ short int solarsystem_hp (double tjd[2], short int body,
          0...Everything OK.
          1...Input Julian date ('tjd') out of range.
          2...Invalid value of 'body'.
-         3...This version of 'solarsystem' not valid for use with
+         3...This version of 'solarsystem_hp' not valid for use with
              NOVAS-C.
 
    GLOBALS
@@ -365,7 +412,7 @@ short int solarsystem_hp (double tjd[2], short int body,
 
    FUNCTIONS
    CALLED:
-      solarsystem   (solsys3.c)
+      solarsystem_analytic (solsys3.c)
 
    VER./DATE/
    PROGRAMMER:
@@ -375,15 +422,17 @@ short int solarsystem_hp (double tjd[2], short int body,
       v1.2/07-10/JLB (USNO/AA) Revised note 3 per Help desk msg
       V1.3/02-11/JLB (USNO/AA) Reformatted description of origin for 
                                consistency with other documentation.
+      V1.4/10-26/ROA           Accept a NULL 'velocity'.
+      V1.5/10-26/ROA           Renamed from 'solarsystem_hp'.
 
 
    NOTES:
-      1. Function 'solarsystem' in file 'solsys3.c' provides the
+      1. Function 'solarsystem_analytic' in file 'solsys3.c' provides the
       position and velocity of the Earth and Sun by evaluating a
       low-precison, closed-form theory without reference to an
       external file.  NOVAS-C does not provide a high-precision
       counterpart of this function that works without requiring an
-      external file.  Thus, this function ('solarsystem_hp') is
+      external file.  Thus, this function ('solarsystem_hp_analytic') is
       essentially a dummy function that acts according to the value
       of variable 'action', which is set below.
       2. If 'action' = 1 (the default), this function returns an error
@@ -391,14 +440,13 @@ short int solarsystem_hp (double tjd[2], short int body,
       high-precision position and velocity of the Earth and Sun.
       This is the appropriate action.
       3. If 'action' = 2, this function simply calls function
-      'solarsystem' and returns the low-precision position and
+      'solarsystem_analytic' and returns the low-precision position and
       velocity.  An error code of '0' (no error) is also returned.
       This action may be useful for code testing purposes, but is
       not appropriate or recommended for normal use of NOVAS-C.
       To access this option, the code must be changed manually
       to set 'action' = 2.
-      4. Use alternate versions of 'solarsystem' (located in the
-      various 'solsysn.c' files, where n is an integer) when
+      4. Select another backend (see 'set_solsys_backend') when
       highest precision is needed.
 
 ------------------------------------------------------------------------
@@ -420,7 +468,8 @@ short int solarsystem_hp (double tjd[2], short int body,
    {
       case 2:   /* Return low-precision position and velocity */
          jd = tjd[0] + tjd[1];
-         if ((error = solarsystem (jd,body,origin, p,v)) != 0)
+         if ((error = solarsystem_analytic (jd,body,origin, p,
+            velocity ? v : NULL)) != 0)
          {
             return (error);
          }
@@ -429,7 +478,8 @@ short int solarsystem_hp (double tjd[2], short int body,
             for (i = 0; i < 3; i++)
             {
                position[i] = p[i];
-               velocity[i] = v[i];
+               if (velocity)
+                  velocity[i] = v[i];
             }
          }
          break;
@@ -442,6 +492,124 @@ short int solarsystem_hp (double tjd[2], short int body,
    return (error);
 }
 
+/********solarsystem_analytic_batch */
+
+short int solarsystem_analytic_batch (long int n, const double *tjd,
+                                      short int body, short int origin,
+                                      short int n_threads,
+
+                                      double *position, double *velocity)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Provides the positions and velocities of the Earth or the Sun at
+      an array of epochs, with the closed-form theory of
+      'solarsystem_analytic', splitting the epochs among several
+      threads.
+
+   REFERENCES:
+      Bretagnon, P. and Simon, J.L. (1986).  Planetary Programs and
+         Tables from -4000 to + 2800. (Richmond, VA: Willmann-Bell).
+      Capitaine, N. et al. (2003), Astronomy And Astrophysics 412,
+         pp. 567-586.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of epochs.
+      *tjd (double)
+         TDB Julian dates ('n' values).
+      body (short int)
+         Body identification number.
+         Set 'body' = 0 or 'body' = 1 or 'body' = 10 for the Sun.
+         Set 'body' = 2 or 'body' = 3 for the Earth.
+      origin (short int)
+         Origin code
+            = 0 ... solar system barycenter
+            = 1 ... center of mass of the Sun
+      n_threads (short int)
+         Number of threads (0 = one per hardware thread).
+
+   OUTPUT
+   ARGUMENTS:
+      *position (double)
+         Position vectors of 'body', 'n' times 3 values: the vector of
+         epoch 'i' is position[3 * i] to position[3 * i + 2].  Units
+         and frame as in 'solarsystem_analytic'.
+      *velocity (double)
+         Velocity vectors of 'body', stored as 'position'.  May be NULL
+         if only the positions are wanted.
+
+   RETURNED
+   VALUE:
+      (short int)
+         0...Everything OK.
+         1...An input Julian date out of range, or 'n' < 0.
+         2...Invalid value of 'body'.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      planet_constants   solsys3.c
+      batch_analytic     solsys3.c
+      novas_parallel_for parallel.cpp
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. The results agree with those of 'solarsystem_analytic' to the
+      rounding errors (about 1.0e-13 AU): the series of the Sun and the
+      precession angles are evaluated for blocks of epochs with the
+      vectorized sines and cosines of 'sincos_array', and the right
+      ascension and declination of 'sun_eph' are not formed.
+      2. The function keeps no static data, so that it can run in
+      several threads at once, and at the same time as
+      'solarsystem_analytic'.
+      3. Nothing is computed if one of the dates is out of range.
+
+------------------------------------------------------------------------
+*/
+{
+   short int error = 0;
+
+   long int i;
+
+   giant_planets planets;
+   analytic_batch data;
+
+   if (n < 0)
+      return (error = 1);
+
+   for (i = 0; i < n; i++)
+   {
+      if ((tjd[i] < 2340000.5) || (tjd[i] > 2560000.5))
+         return (error = 1);
+   }
+
+   if ((body != 0) && (body != 1) && (body != 10) && (body != 2) &&
+      (body != 3))
+      return (error = 2);
+
+   planet_constants (&planets);
+
+   data.tjd = tjd;
+   data.body = body;
+   data.origin = origin;
+   data.planets = &planets;
+   data.position = position;
+   data.velocity = velocity;
+
+   novas_parallel_for (n, n_threads, batch_analytic, &data);
+
+   return (error);
+}
+
 /********sun_eph */
 
 void sun_eph (double jd,
@@ -520,66 +688,6 @@ void sun_eph (double jd,
    const double factor = 1.0e-07;
    double u, arg, lon, lat, t, emean, sin_lon;
 
-   struct sun_con
-   {
-   double l;
-   double r;
-   double alpha;
-   double nu;
-   };
-
-   static const struct sun_con con[50] =
-      {{403406.0,      0.0, 4.721964,     1.621043},
-       {195207.0, -97597.0, 5.937458, 62830.348067},
-       {119433.0, -59715.0, 1.115589, 62830.821524},
-       {112392.0, -56188.0, 5.781616, 62829.634302},
-       {  3891.0,  -1556.0, 5.5474  , 125660.5691 },
-       {  2819.0,  -1126.0, 1.5120  , 125660.9845 },
-       {  1721.0,   -861.0, 4.1897  ,  62832.4766 },
-       {     0.0,    941.0, 1.163   ,      0.813  },
-       {   660.0,   -264.0, 5.415   , 125659.310  },
-       {   350.0,   -163.0, 4.315   ,  57533.850  },
-       {   334.0,      0.0, 4.553   ,    -33.931  },
-       {   314.0,    309.0, 5.198   , 777137.715  },
-       {   268.0,   -158.0, 5.989   ,  78604.191  },
-       {   242.0,      0.0, 2.911   ,      5.412  },
-       {   234.0,    -54.0, 1.423   ,  39302.098  },
-       {   158.0,      0.0, 0.061   ,    -34.861  },
-       {   132.0,    -93.0, 2.317   , 115067.698  },
-       {   129.0,    -20.0, 3.193   ,  15774.337  },
-       {   114.0,      0.0, 2.828   ,   5296.670  },
-       {    99.0,    -47.0, 0.52    ,  58849.27   },
-       {    93.0,      0.0, 4.65    ,   5296.11   },
-       {    86.0,      0.0, 4.35    ,  -3980.70   },
-       {    78.0,    -33.0, 2.75    ,  52237.69   },
-       {    72.0,    -32.0, 4.50    ,  55076.47   },
-       {    68.0,      0.0, 3.23    ,    261.08   },
-       {    64.0,    -10.0, 1.22    ,  15773.85   },
-       {    46.0,    -16.0, 0.14    ,  188491.03  },
-       {    38.0,      0.0, 3.44    ,   -7756.55  },
-       {    37.0,      0.0, 4.37    ,     264.89  },
-       {    32.0,    -24.0, 1.14    ,  117906.27  },
-       {    29.0,    -13.0, 2.84    ,   55075.75  },
-       {    28.0,      0.0, 5.96    ,   -7961.39  },
-       {    27.0,     -9.0, 5.09    ,  188489.81  },
-       {    27.0,      0.0, 1.72    ,    2132.19  },
-       {    25.0,    -17.0, 2.56    ,  109771.03  },
-       {    24.0,    -11.0, 1.92    ,   54868.56  },
-       {    21.0,      0.0, 0.09    ,   25443.93  },
-       {    21.0,     31.0, 5.98    ,  -55731.43  },
-       {    20.0,    -10.0, 4.03    ,   60697.74  },
-       {    18.0,      0.0, 4.27    ,    2132.79  },
-       {    17.0,    -12.0, 0.79    ,  109771.63  },
-       {    14.0,      0.0, 4.24    ,   -7752.82  },
-       {    13.0,     -5.0, 2.01    ,  188491.91  },
-       {    13.0,      0.0, 2.65    ,     207.81  },
-       {    13.0,      0.0, 4.98    ,   29424.63  },
-       {    12.0,      0.0, 0.93    ,      -7.99  },
-       {    10.0,      0.0, 2.21    ,   46941.14  },
-       {    10.0,      0.0, 3.59    ,     -68.29  },
-       {    10.0,      0.0, 1.50    ,   21463.25  },
-       {    10.0,     -9.0, 2.55    ,  157208.40  }};
-
 /*
    Define the time units 'u', measured in units of 10000 Julian years
    from J2000.0, and 't', measured in Julian centuries from J2000.0.
@@ -639,3 +747,538 @@ void sun_eph (double jd,
 
    return;
 }
+
+/********planet_constants */
+
+static void planet_constants (giant_planets *planets)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the constants of the barycenter computation of
+      'solarsystem_analytic' from the masses and orbital elements of
+      the four largest planets.
+
+   REFERENCES:
+      Brouwer, D. and Clemence, G. M. (1961), Methods of Celestial
+         Mechanics, pp. 35-36.
+
+   INPUT
+   ARGUMENTS:
+      None.
+
+   OUTPUT
+   ARGUMENTS:
+      *planets (giant_planets)
+         Total mass and scaled p and q vectors of the planets.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      pm, pa, pe, pj     solsys3.c
+      po, pw, obl        solsys3.c
+      TWOPI              novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sin                math.h
+      cos                math.h
+      sqrt               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA     Moved from 'solarsystem_analytic'.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   double oblr, se, ce, si, ci, sn, cn, sw, cw, p1, p2, p3, q1, q2, q3,
+      roote;
+
+/*
+   Initial value of 'tmass' is mass of Sun plus four inner planets.
+*/
+
+   planets->tmass = 1.0 + 5.977e-6;
+   oblr = obl * TWOPI / 360.0;
+   se = sin (oblr);
+   ce = cos (oblr);
+
+   for (i = 0; i < 4; i++)
+   {
+      planets->tmass += 1.0 / pm[i];
+
+/*
+   Compute sine and cosine of orbital angles.
+*/
+
+      si = sin (pj[i]);
+      ci = cos (pj[i]);
+      sn = sin (po[i]);
+      cn = cos (po[i]);
+      sw = sin (pw[i] - po[i]);
+      cw = cos (pw[i] - po[i]);
+
+/*
+   Compute p and q vectors (see Brouwer & Clemence (1961), Methods of
+   Celestial Mechanics, pp. 35-36.)
+*/
+
+      p1 =   cw * cn - sw * sn * ci;
+      p2 = ( cw * sn + sw * cn * ci) * ce - sw * si * se;
+      p3 = ( cw * sn + sw * cn * ci) * se + sw * si * ce;
+      q1 =  -sw * cn - cw * sn * ci;
+      q2 = (-sw * sn + cw * cn * ci) * ce - cw * si * se;
+      q3 = (-sw * sn + cw * cn * ci) * se + cw * si * ce;
+      roote = sqrt (1.0 - pe[i] * pe[i]);
+      planets->a[0][i] = pa[i] * p1;
+      planets->a[1][i] = pa[i] * p2;
+      planets->a[2][i] = pa[i] * p3;
+      planets->b[0][i] = pa[i] * roote * q1;
+      planets->b[1][i] = pa[i] * roote * q2;
+      planets->b[2][i] = pa[i] * roote * q3;
+   }
+
+   return;
+}
+
+/********barycenter */
+
+static void barycenter (double tjd, const giant_planets *planets,
+
+                        double *pbary, double *vbary)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the position and velocity of the Sun with respect to
+      the solar system barycenter, from Keplerian approximations of the
+      orbits of the four largest planets.
+
+   REFERENCES:
+      Explanatory Supplement to The Astronomical Almanac (1992), p. 316.
+
+   INPUT
+   ARGUMENTS:
+      tjd (double)
+         TDB Julian date.
+      *planets (giant_planets)
+         Constants from 'planet_constants'.
+
+   OUTPUT
+   ARGUMENTS:
+      pbary[3] (double)
+         Barycentric position of the Sun, with the sign changed (AU),
+         referred to the mean equator and equinox of J2000.0.
+      vbary[3] (double)
+         Barycentric velocity of the Sun, with the sign changed
+         (AU/day).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      pm, pe, pw, pl, pn solsys3.c
+      T0, TWOPI          novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sin                math.h
+      cos                math.h
+      fmod               math.h
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA     Moved from 'solarsystem_analytic'.
+
+   NOTES:
+      None.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   double e, mlon, ma, u, sinu, cosu, anr, pplan[3], vplan[3], f;
+
+   for (i = 0; i < 3; i++)
+      pbary[i] = vbary[i] = 0.0;
+
+/*
+   The following loop cycles once for each of the four planets.
+*/
+
+   for (i = 0; i < 4; i++)
+   {
+
+/*
+   Compute mean longitude, mean anomaly, and eccentric anomaly.
+*/
+
+      e = pe[i];
+      mlon = pl[i] + pn[i] * (tjd - T0);
+      ma = fmod ((mlon - pw[i]), TWOPI);
+      u = ma + e * sin (ma) + 0.5 * e * e * sin (2.0 * ma);
+      sinu = sin (u);
+      cosu = cos (u);
+
+/*
+   Compute velocity factor.
+*/
+
+      anr = pn[i] / (1.0 - e * cosu);
+
+/*
+   Compute planet's position and velocity wrt eq & eq J2000.
+*/
+
+      pplan[0] = planets->a[0][i] * (cosu - e) + planets->b[0][i] * sinu;
+      pplan[1] = planets->a[1][i] * (cosu - e) + planets->b[1][i] * sinu;
+      pplan[2] = planets->a[2][i] * (cosu - e) + planets->b[2][i] * sinu;
+      vplan[0] = anr * (-planets->a[0][i] * sinu +
+         planets->b[0][i] * cosu);
+      vplan[1] = anr * (-planets->a[1][i] * sinu +
+         planets->b[1][i] * cosu);
+      vplan[2] = anr * (-planets->a[2][i] * sinu +
+         planets->b[2][i] * cosu);
+
+/*
+   Compute mass factor and add in to total displacement.
+*/
+
+      f = 1.0 / (pm[i] * planets->tmass);
+
+      pbary[0] += pplan[0] * f;
+      pbary[1] += pplan[1] * f;
+      pbary[2] += pplan[2] * f;
+      vbary[0] += vplan[0] * f;
+      vbary[1] += vplan[1] * f;
+      vbary[2] += vplan[2] * f;
+   }
+
+   return;
+}
+
+/********earth_block */
+
+static void earth_block (long int n, const double *jd,
+
+                         double *x, double *y, double *z)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Computes the heliocentric position of the Earth at up to
+      SOLSYS3_BLOCK epochs, as 'sun_eph', 'radec2vector' and
+      'precession' do in 'solarsystem_analytic'.
+
+   REFERENCES:
+      Bretagnon, P. and Simon, J.L. (1986).  Planetary Programs and
+         Tables from -4000 to + 2800. (Richmond, VA: Willmann-Bell).
+      Capitaine, N. et al. (2003), Astronomy And Astrophysics 412,
+         pp. 567-586.
+
+   INPUT
+   ARGUMENTS:
+      n (long int)
+         Number of epochs (at most SOLSYS3_BLOCK).
+      *jd (double)
+         TDB Julian dates.
+
+   OUTPUT
+   ARGUMENTS:
+      *x, *y, *z (double)
+         Heliocentric equatorial rectangular coordinates of the Earth
+         in AU, referred to the mean equator and equinox of J2000.0.
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      con                solsys3.c
+      T0, ASEC2RAD       novascon.c
+
+   FUNCTIONS
+   CALLED:
+      sincos_array       nutation_fast.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Each term of the series is evaluated for all the epochs of the
+      block in one call of 'sincos_array'.
+      2. The unit vector of the Sun is formed from the sine and cosine
+      of its longitude and of the obliquity; it is the vector of
+      'radec2vector' without the round trip through right ascension
+      and declination.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i;
+
+   long int j;
+
+   const double factor = 1.0e-07;
+   const double eps0 = 84381.406 * ASEC2RAD;
+
+   double u[SOLSYS3_BLOCK], t[SOLSYS3_BLOCK], dis[SOLSYS3_BLOCK],
+      sum_lon[SOLSYS3_BLOCK], sum_r[SOLSYS3_BLOCK],
+      arg[3 * SOLSYS3_BLOCK], s[3 * SOLSYS3_BLOCK], c[3 * SOLSYS3_BLOCK];
+   double sa, ca, sb, cb, sc, cc, sd, cd, xx, yx, zx, xy, yy, zy, xz, yz,
+      zz, pos1[3];
+
+/*
+   Time units of 'sun_eph' and of 'precession'.
+*/
+
+   for (j = 0; j < n; j++)
+   {
+      u[j] = (jd[j] - T0) / 3652500.0;
+      t[j] = u[j] * 100.0;
+      sum_lon[j] = 0.0;
+      sum_r[j] = 0.0;
+   }
+
+/*
+   Longitude and distance terms of the series.
+*/
+
+   for (i = 0; i < 50; i++)
+   {
+      for (j = 0; j < n; j++)
+         arg[j] = con[i].alpha + con[i].nu * u[j];
+
+      sincos_array (n, arg, s, c);
+
+      for (j = 0; j < n; j++)
+      {
+         sum_lon[j] += con[i].l * s[j];
+         sum_r[j] += con[i].r * c[j];
+      }
+   }
+
+/*
+   Longitude with the linear correction to DE405, and the mean
+   obliquity of the ecliptic, of date.
+*/
+
+   for (j = 0; j < n; j++)
+   {
+      arg[j] = 4.9353929 + 62833.1961680 * u[j] + factor * sum_lon[j];
+      arg[j] += ((-0.1371679461 - 0.2918293271 * t[j]) * ASEC2RAD);
+      arg[n + j] = (84381.406 + (-46.836769 +
+         (-0.0001831 + 0.00200340 * t[j]) * t[j]) * t[j]) * ASEC2RAD;
+      dis[j] = 1.0001026 + factor * sum_r[j];
+   }
+
+   sincos_array (2 * n, arg, s, c);
+
+/*
+   Geocentric position of the Sun, mean equator and equinox of date.
+*/
+
+   for (j = 0; j < n; j++)
+   {
+      x[j] = dis[j] * c[j];
+      y[j] = dis[j] * c[n + j] * s[j];
+      z[j] = dis[j] * s[n + j] * s[j];
+   }
+
+/*
+   Precession angles psi_a, omega_a, and chi_a of 'precession', for
+   the rotation from epoch to J2000.0.
+*/
+
+   for (j = 0; j < n; j++)
+   {
+      t[j] = -((T0 - jd[j]) / 36525.0);
+
+      arg[j] = ((((-    0.0000000951  * t[j]
+                   +    0.000132851 ) * t[j]
+                   -    0.00114045  ) * t[j]
+                   -    1.0790069   ) * t[j]
+                   + 5038.481507    ) * t[j] * ASEC2RAD;
+
+      arg[n + j] = (((((+    0.0000003337  * t[j]
+                        -    0.000000467 ) * t[j]
+                        -    0.00772503  ) * t[j]
+                        +    0.0512623   ) * t[j]
+                        -    0.025754    ) * t[j] + 84381.406) * ASEC2RAD;
+
+      arg[2 * n + j] = ((((-    0.0000000560  * t[j]
+                           +    0.000170663 ) * t[j]
+                           -    0.00121197  ) * t[j]
+                           -    2.3814292   ) * t[j]
+                           +   10.556403    ) * t[j] * ASEC2RAD;
+   }
+
+   sincos_array (3 * n, arg, s, c);
+
+   sa = sin (eps0);
+   ca = cos (eps0);
+
+/*
+   Rotate to J2000.0, with the matrix of 'precession', and change the
+   sign, from the Sun to the Earth.
+*/
+
+   for (j = 0; j < n; j++)
+   {
+      sb = -s[j];
+      cb = c[j];
+      sc = -s[n + j];
+      cc = c[n + j];
+      sd = s[2 * n + j];
+      cd = c[2 * n + j];
+
+      xx =  cd * cb - sb * sd * cc;
+      yx =  cd * sb * ca + sd * cc * cb * ca - sa * sd * sc;
+      zx =  cd * sb * sa + sd * cc * cb * sa + ca * sd * sc;
+      xy = -sd * cb - sb * cd * cc;
+      yy = -sd * sb * ca + cd * cc * cb * ca - sa * cd * sc;
+      zy = -sd * sb * sa + cd * cc * cb * sa + ca * cd * sc;
+      xz =  sb * sc;
+      yz = -sc * cb * ca - sa * cc;
+      zz = -sc * cb * sa + cc * ca;
+
+      pos1[0] = x[j];
+      pos1[1] = y[j];
+      pos1[2] = z[j];
+
+      x[j] = -(xx * pos1[0] + xy * pos1[1] + xz * pos1[2]);
+      y[j] = -(yx * pos1[0] + yy * pos1[1] + yz * pos1[2]);
+      z[j] = -(zx * pos1[0] + zy * pos1[1] + zz * pos1[2]);
+   }
+
+   return;
+}
+
+/********batch_analytic */
+
+static void batch_analytic (long int begin, long int end, void *arg)
+/*
+------------------------------------------------------------------------
+
+   PURPOSE:
+      Work of one thread of 'solarsystem_analytic_batch'.
+
+   REFERENCES:
+      None.
+
+   INPUT
+   ARGUMENTS:
+      begin (long int)
+         First epoch of the range.
+      end (long int)
+         One past the last epoch of the range.
+      *arg (void)
+         Data of the batch ('analytic_batch').
+
+   OUTPUT
+   ARGUMENTS:
+      None (results written to the arrays of the batch).
+
+   RETURNED
+   VALUE:
+      None.
+
+   GLOBALS
+   USED:
+      None.
+
+   FUNCTIONS
+   CALLED:
+      earth_block        solsys3.c
+      barycenter         solsys3.c
+
+   VER./DATE/
+   PROGRAMMER:
+      V1.0/10-26/ROA
+
+   NOTES:
+      1. Same steps as 'solarsystem_analytic', for blocks of
+      SOLSYS3_BLOCK epochs.  The velocity of the Earth comes from the
+      positions 0.1 day before and after each epoch.
+
+------------------------------------------------------------------------
+*/
+{
+   short int i, k, earth;
+
+   long int j, m, first;
+
+   double qjd[SOLSYS3_BLOCK], p[3][3][SOLSYS3_BLOCK], pbary[3], vbary[3];
+   double *pos, *vel;
+
+   analytic_batch *data = (analytic_batch *) arg;
+
+   earth = (data->body == 2) || (data->body == 3);
+
+   for (first = begin; first < end; first += SOLSYS3_BLOCK)
+   {
+      m = end - first;
+      if (m > SOLSYS3_BLOCK)
+         m = SOLSYS3_BLOCK;
+
+/*
+   Heliocentric position of the Earth at the epochs of the block, and
+   0.1 day before and after them for the velocity.
+*/
+
+      if (earth)
+      {
+         for (i = (data->velocity ? 0 : 1);
+            i < (data->velocity ? 3 : 2); i++)
+         {
+            for (j = 0; j < m; j++)
+               qjd[j] = data->tjd[first + j] + (double) (i - 1) * 0.1;
+            earth_block (m, qjd, p[i][0],p[i][1],p[i][2]);
+         }
+      }
+
+      for (j = 0; j < m; j++)
+      {
+         pos = data->position + 3 * (first + j);
+         vel = data->velocity ? data->velocity + 3 * (first + j) : NULL;
+
+         for (k = 0; k < 3; k++)
+         {
+            pos[k] = earth ? p[1][k][j] : 0.0;
+            if (vel)
+               vel[k] = earth ? (p[2][k][j] - p[0][k][j]) / 0.2 : 0.0;
+         }
+
+/*
+   Move the origin to the solar system barycenter.
+*/
+
+         if (data->origin == 0)
+         {
+            barycenter (data->tjd[first + j], data->planets, pbary,vbary);
+            for (k = 0; k < 3; k++)
+            {
+               pos[k] -= pbary[k];
+               if (vel)
+                  vel[k] -= vbary[k];
+            }
+         }
+      }
+   }
+
+   return;
+}
@@ -0,0 +1,507 @@
+/*
+  NOVAS Util: convert the JPL ASCII ephemeris files to the binary file read by 'ephem_open'.
+
+  Native replacement of the JPL Fortran program 'fortran/asc2eph.f' (with NRECL = 4). The ASCII
+  header and data files are streamed in chunks, and the coefficient blocks of each chunk are parsed
+  in parallel. The output has the layout written by 'asc2eph': record 1 with the title, constant
+  names, time span and coefficient pointers, record 2 with the constant values, and one record per
+  coefficient block, each record being NCOEFF doubles long.
+
+  Usage:
+
+      Util_AsciiToEphemeris [-b jd_begin] [-e jd_end] [-j threads] output header.XXX ascpYYYY.XXX ...
+
+  The data files must be given in time order. Blocks wholly before 'jd_begin' or starting at or
+  after 'jd_end' are skipped, and blocks repeated at the boundary of two consecutive data files are
+  written once.
+
+  Royal Observatory of the Spanish Navy.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Limits of the binary header written by 'asc2eph'.
+constexpr std::size_t kTitleLines = 3;
+constexpr std::size_t kTitleLength = 84;
+constexpr std::size_t kNameLength = 6;
+constexpr std::size_t kOldMaxConstants = 400;
+
+// Bytes of the data files read at once.
+constexpr std::size_t kChunkBytes = std::size_t(32) << 20;
+
+struct EphemerisHeader
+{
+    int ksize = 0;
+    std::string title[kTitleLines];
+    double ss[3] = {0.0, 0.0, 0.0};
+    std::vector<std::string> names;
+    std::vector<double> values;
+    int ipt[12][3] = {};
+    int lpt[3] = {};
+    int rpt[3] = {};
+    int tpt[3] = {};
+};
+
+struct Options
+{
+    double jd_begin = -99999999.0;
+    double jd_end = 99999999.0;
+    unsigned threads = 0;
+    std::string output;
+    std::string header;
+    std::vector<std::string> data;
+};
+
+bool isBlank(const std::string& line)
+{
+    return std::all_of(line.begin(), line.end(), [](unsigned char c){return std::isspace(c);});
+}
+
+// Parses the next number of a Fortran list (blanks or commas as separators, 'D' or 'E' exponent).
+// Returns false if there is no number before 'end'.
+bool nextDouble(const char*& p, const char* end, double& value)
+{
+    char token[64];
+    std::size_t n = 0;
+
+    while (p < end && (std::isspace(static_cast<unsigned char>(*p)) || *p == ','))
+        p++;
+    while (p < end && !std::isspace(static_cast<unsigned char>(*p)) && *p != ',')
+    {
+        if (n < sizeof(token) - 1)
+            token[n++] = (*p == 'D' || *p == 'd') ? 'E' : *p;
+        p++;
+    }
+    if (n == 0)
+        return false;
+    token[n] = '\0';
+
+    char* last;
+    value = std::strtod(token, &last);
+    return *last == '\0';
+}
+
+// Reads the next header line that is not blank.
+bool nextLine(std::ifstream& in, std::string& line)
+{
+    while (std::getline(in, line))
+        if (!isBlank(line))
+            return true;
+    return false;
+}
+
+// Reads group 'group' of the header: its 'GROUP   nnnn' line.
+bool expectGroup(std::ifstream& in, const std::string& group)
+{
+    std::string line;
+    if (!nextLine(in, line) || line.compare(0, 12, "GROUP   " + group) != 0)
+    {
+        std::cerr<<"Error: header group "<<group<<" not found."<<std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool parseHeader(const std::string& path, EphemerisHeader& hdr)
+{
+    std::ifstream in(path);
+    std::string line;
+
+    if (!in)
+    {
+        std::cerr<<"Error: unable to open the header file "<<path<<std::endl;
+        return false;
+    }
+
+    // KSIZE, the record size in 4-byte words.
+    if (!nextLine(in, line) || line.size() < 12 || (hdr.ksize = std::atoi(line.substr(6, 6).c_str())) <= 0)
+    {
+        std::cerr<<"Error: KSIZE not found in the header."<<std::endl;
+        return false;
+    }
+
+    // Title (GROUP 1010).
+    if (!expectGroup(in, "1010"))
+        return false;
+    for (auto& title : hdr.title)
+    {
+        if (!nextLine(in, title))
+            return false;
+        title.resize(kTitleLength, ' ');
+    }
+
+    // Time span (GROUP 1030).
+    if (!expectGroup(in, "1030") || !nextLine(in, line))
+        return false;
+    const char* p = line.c_str();
+    for (double& ss : hdr.ss)
+        if (!nextDouble(p, line.c_str() + line.size(), ss))
+            return false;
+
+    // Names of the constants (GROUP 1040).
+    if (!expectGroup(in, "1040") || !nextLine(in, line))
+        return false;
+    std::size_t ncon = static_cast<std::size_t>(std::atoi(line.c_str()));
+    while (hdr.names.size() < ncon && nextLine(in, line))
+    {
+        for (std::size_t i = 0; i < line.size(); i += 8)
+        {
+            std::string field = line.substr(i, 8);
+            field.erase(0, field.find_first_not_of(' '));
+            field.erase(field.find_last_not_of(' ') + 1);
+            if (!field.empty() && hdr.names.size() < ncon)
+                hdr.names.push_back(field.substr(0, kNameLength));
+        }
+    }
+
+    // Values of the constants (GROUP 1041).
+    if (!expectGroup(in, "1041") || !nextLine(in, line))
+        return false;
+    std::size_t nval = static_cast<std::size_t>(std::atoi(line.c_str()));
+    while (hdr.values.size() < nval && nextLine(in, line))
+    {
+        const char* q = line.c_str();
+        double value;
+        while (hdr.values.size() < nval && nextDouble(q, line.c_str() + line.size(), value))
+            hdr.values.push_back(value);
+    }
+    if (hdr.names.size() != ncon || hdr.values.size() != nval || ncon != nval)
+    {
+        std::cerr<<"Error: bad constant names or values in the header."<<std::endl;
+        return false;
+    }
+
+    // Coefficient pointers (GROUP 1050): IPT, then LPT and, in newer files, RPT and TPT.
+    if (!expectGroup(in, "1050"))
+        return false;
+    for (int i = 0; i < 3; i++)
+    {
+        if (!nextLine(in, line))
+            return false;
+        int row[15] = {};
+        const char* q = line.c_str();
+        double value;
+        for (int j = 0; j < 15 && nextDouble(q, line.c_str() + line.size(), value); j++)
+            row[j] = static_cast<int>(value);
+        for (int j = 0; j < 12; j++)
+            hdr.ipt[j][i] = row[j];
+        hdr.lpt[i] = row[12];
+        hdr.rpt[i] = row[13];
+        hdr.tpt[i] = row[14];
+    }
+
+    return true;
+}
+
+double constant(const EphemerisHeader& hdr, const char* name)
+{
+    for (std::size_t i = 0; i < hdr.names.size(); i++)
+        if (hdr.names[i] == name)
+            return hdr.values[i];
+    return 0.0;
+}
+
+template <typename T>
+void put(std::vector<char>& record, std::size_t& offset, const T* data, std::size_t count)
+{
+    std::size_t bytes = sizeof(T) * count;
+    if (offset + bytes <= record.size())
+        std::memcpy(record.data() + offset, data, bytes);
+    offset += bytes;
+}
+
+// Builds records 1 and 2 as written by 'asc2eph'.
+bool buildHeaderRecords(const EphemerisHeader& hdr, std::size_t record_length,
+                        std::vector<char>& rec1, std::vector<char>& rec2)
+{
+    std::size_t offset = 0;
+    std::size_t ncon = hdr.names.size();
+    auto name = [&hdr](std::size_t i)
+    {
+        std::string n = i < hdr.names.size() ? hdr.names[i] : std::string();
+        n.resize(kNameLength, ' ');
+        return n;
+    };
+
+    rec1.assign(record_length, 0);
+    for (const auto& title : hdr.title)
+        put(rec1, offset, title.data(), kTitleLength);
+    for (std::size_t i = 0; i < kOldMaxConstants; i++)
+        put(rec1, offset, name(i).data(), kNameLength);
+    put(rec1, offset, hdr.ss, 3);
+    int ncon_int = static_cast<int>(ncon);
+    put(rec1, offset, &ncon_int, 1);
+    double au = constant(hdr, "AU");
+    double emrat = constant(hdr, "EMRAT");
+    int numde = static_cast<int>(constant(hdr, "DENUM"));
+    put(rec1, offset, &au, 1);
+    put(rec1, offset, &emrat, 1);
+    put(rec1, offset, &hdr.ipt[0][0], 36);
+    put(rec1, offset, &numde, 1);
+    put(rec1, offset, hdr.lpt, 3);
+    for (std::size_t i = kOldMaxConstants; i < ncon; i++)
+        put(rec1, offset, name(i).data(), kNameLength);
+    put(rec1, offset, hdr.rpt, 3);
+    put(rec1, offset, hdr.tpt, 3);
+
+    std::size_t offset2 = 0;
+    std::vector<double> values(hdr.values);
+    values.resize(std::max(ncon, kOldMaxConstants), 0.0);
+    rec2.assign(record_length, 0);
+    put(rec2, offset2, values.data(), values.size());
+
+    if (offset > record_length || offset2 > record_length)
+    {
+        std::cerr<<"Error: the header does not fit in a record of "<<record_length<<" bytes."<<std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Parses the coefficient blocks starting at 'starts' into 'coeffs' (ncoeff values per block).
+// A block is the line 'NRW NCOEFF' followed by NCOEFF numbers.
+void parseBlocks(const char* text, const std::vector<std::size_t>& starts, std::size_t first,
+                 std::size_t last, std::size_t end, std::size_t ncoeff, std::vector<double>& coeffs,
+                 std::vector<char>& ok)
+{
+    for (std::size_t b = first; b < last; b++)
+    {
+        const char* p = text + starts[b];
+        const char* stop = text + (b + 1 < starts.size() ? starts[b + 1] : end);
+        double* out = &coeffs[b * ncoeff];
+        double nrw, n;
+
+        ok[b] = nextDouble(p, stop, nrw) && nextDouble(p, stop, n) &&
+                static_cast<std::size_t>(n) == ncoeff;
+        for (std::size_t i = 0; ok[b] && i < ncoeff; i++)
+            ok[b] = nextDouble(p, stop, out[i]);
+    }
+}
+
+// Offsets of the lines of 'text' holding only two integers (block headers).
+void findBlocks(const std::string& text, std::vector<std::size_t>& starts)
+{
+    std::size_t pos = 0;
+
+    starts.clear();
+    while (pos < text.size())
+    {
+        std::size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos)
+            eol = text.size();
+
+        bool digits = false, other = false;
+        int tokens = 0;
+        bool in_token = false;
+        for (std::size_t i = pos; i < eol; i++)
+        {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+            if (std::isspace(c))
+                in_token = false;
+            else
+            {
+                if (!in_token)
+                    tokens++;
+                in_token = true;
+                if (std::isdigit(c))
+                    digits = true;
+                else
+                    other = true;
+            }
+        }
+        if (digits && !other && tokens == 2)
+            starts.push_back(pos);
+
+        pos = eol + 1;
+    }
+}
+
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-b" || arg == "-e" || arg == "-j") && i + 1 < argc)
+        {
+            const char* value = argv[++i];
+            if (arg == "-b")
+                opt.jd_begin = std::atof(value);
+            else if (arg == "-e")
+                opt.jd_end = std::atof(value);
+            else
+                opt.threads = static_cast<unsigned>(std::atoi(value));
+        }
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() < 3)
+        return false;
+    opt.output = files[0];
+    opt.header = files[1];
+    opt.data.assign(files.begin() + 2, files.end());
+    return true;
+}
+
+} // END ANONYMOUS NAMESPACE.
+
+int main(int argc, char *argv[])
+{
+    // Util initial log.
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+    std::cout<<"  NOVAS Util: ASCII to binary JPL ephemeris"<<std::endl;
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+
+    Options opt;
+    if (!parseOptions(argc, argv, opt))
+    {
+        std::cerr<<"Usage: "<<argv[0]<<" [-b jd_begin] [-e jd_end] [-j threads] "
+                 <<"output header.XXX ascpYYYY.XXX ..."<<std::endl;
+        return 1;
+    }
+    if (opt.threads == 0)
+        opt.threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Read the header.
+    EphemerisHeader hdr;
+    if (!parseHeader(opt.header, hdr))
+        return 1;
+
+    const std::size_t ncoeff = static_cast<std::size_t>(hdr.ksize) / 2;
+    const std::size_t record_length = ncoeff * sizeof(double);
+    std::cout<<"DE number:     "<<constant(hdr, "DENUM")<<std::endl;
+    std::cout<<"Coefficients:  "<<ncoeff<<" ("<<record_length<<" bytes per record)"<<std::endl;
+    std::cout<<"Threads:       "<<opt.threads<<std::endl;
+
+    // Open the output, leaving room for the two header records.
+    std::ofstream out(opt.output, std::ios::binary | std::ios::trunc);
+    std::vector<char> rec1, rec2;
+    if (!out || !buildHeaderRecords(hdr, record_length, rec1, rec2))
+    {
+        std::cerr<<"Error: unable to create "<<opt.output<<std::endl;
+        return 1;
+    }
+    out.write(rec1.data(), static_cast<std::streamsize>(record_length));
+    out.write(rec2.data(), static_cast<std::streamsize>(record_length));
+
+    // Stream the data files.
+    std::size_t nrout = 0;
+    double db2z = 0.0;
+    std::vector<std::size_t> starts;
+    std::vector<double> coeffs;
+    std::vector<char> ok;
+
+    for (const auto& path : opt.data)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            std::cerr<<"Error: unable to open the data file "<<path<<std::endl;
+            return 1;
+        }
+
+        std::string text;
+        bool eof = false;
+        while (!eof)
+        {
+            // Append the next chunk to the incomplete block left by the previous one.
+            std::size_t kept = text.size();
+            text.resize(kept + kChunkBytes);
+            in.read(&text[kept], static_cast<std::streamsize>(kChunkBytes));
+            text.resize(kept + static_cast<std::size_t>(in.gcount()));
+            eof = !in;
+
+            // Only the blocks followed by another block are complete, except at the end of file.
+            findBlocks(text, starts);
+            std::size_t end = text.size();
+            if (!eof && !starts.empty())
+            {
+                end = starts.back();
+                starts.pop_back();
+            }
+            std::size_t nblocks = starts.size();
+
+            // Parse the blocks in parallel.
+            coeffs.resize(nblocks * ncoeff);
+            ok.assign(nblocks, 0);
+            std::vector<std::thread> workers;
+            std::size_t per_thread = (nblocks + opt.threads - 1) / opt.threads;
+            for (std::size_t first = 0; first < nblocks; first += per_thread)
+            {
+                std::size_t last = std::min(nblocks, first + per_thread);
+                workers.emplace_back(parseBlocks, text.data(), std::cref(starts), first, last, end,
+                                     ncoeff, std::ref(coeffs), std::ref(ok));
+            }
+            for (auto& worker : workers)
+                worker.join();
+
+            // Write the blocks in order, as 'asc2eph' does.
+            for (std::size_t b = 0; b < nblocks; b++)
+            {
+                const double* db = &coeffs[b * ncoeff];
+                if (!ok[b])
+                {
+                    std::cerr<<"Error: bad coefficient block in "<<path<<std::endl;
+                    return 1;
+                }
+                if (db[1] < opt.jd_begin || db[0] >= opt.jd_end || (nrout && db[0] < db2z))
+                    continue;
+                if (nrout && db[0] != db2z)
+                {
+                    std::cerr<<"Error: records do not overlap or abut at JED "<<db[0]<<std::endl;
+                    return 1;
+                }
+
+                out.write(reinterpret_cast<const char*>(db), static_cast<std::streamsize>(record_length));
+                if (!out)
+                {
+                    std::cerr<<"Error: unable to write "<<opt.output<<std::endl;
+                    return 1;
+                }
+
+                if (nrout++ == 0)
+                {
+                    hdr.ss[0] = db[0];
+                    hdr.ss[2] = db[1] - db[0];
+                }
+                hdr.ss[1] = db2z = db[1];
+            }
+
+            text.erase(0, end);
+        }
+    }
+
+    if (nrout == 0)
+    {
+        std::cerr<<"Error: no records in the requested span."<<std::endl;
+        return 1;
+    }
+
+    // Write the header records with the span actually written.
+    buildHeaderRecords(hdr, record_length, rec1, rec2);
+    out.seekp(0);
+    out.write(rec1.data(), static_cast<std::streamsize>(record_length));
+    out.close();
+    if (!out)
+    {
+        std::cerr<<"Error: unable to write "<<opt.output<<std::endl;
+        return 1;
+    }
+
+    std::printf("%zu EPHEMERIS RECORDS WRITTEN.  JED %.2f TO %.2f\n", nrout, hdr.ss[0], hdr.ss[1]);
+    return 0;
+}
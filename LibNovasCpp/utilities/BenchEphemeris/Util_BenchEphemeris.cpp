@@ -0,0 +1,176 @@
+/*
+  NOVAS Util: time the specialized Chebyshev kernels of 'eph_manager' against the generic evaluator.
+
+  The same random epochs are evaluated with 'state_r' for every body on the file, first with the
+  degree-specialized kernels selected by 'ephem_open_r' and then with the generic 'chebyshev' (see
+  'ephem_set_kernels_r'). Each pass is repeated several times and the best time is kept. The file is
+  memory mapped and the epochs are sorted, so the times measure the interpolation and not the reads.
+
+  The check fails (exit code 1) if both paths do not give the same positions and velocities, or if
+  the specialized kernels are not faster than the generic path.
+
+  Usage:
+
+      Util_BenchEphemeris [-n epochs] [-r repeats] ephemeris
+
+  Royal Observatory of the Spanish Navy.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LibNovasCpp/eph_manager.h"
+
+namespace
+{
+
+struct Options
+{
+    long epochs = 200000;
+    int repeats = 5;
+    std::string input;
+};
+
+struct Pass
+{
+    double seconds = 0.0;
+    std::vector<double> pos;
+    std::vector<double> vel;
+};
+
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            opt.epochs = std::atol(argv[++i]);
+        else if (std::strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+            opt.repeats = std::atoi(argv[++i]);
+        else if (argv[i][0] != '-' && opt.input.empty())
+            opt.input = argv[i];
+        else
+            return false;
+    }
+    return !opt.input.empty() && opt.epochs > 0 && opt.repeats > 0;
+}
+
+// Evaluates all the bodies on all the epochs and keeps the best of 'repeats' runs.
+bool runPass(ephem_handle* eph, const std::vector<double>& epochs, const std::vector<short>& bodies,
+             int repeats, Pass& pass)
+{
+    const std::size_t n = epochs.size() * bodies.size() * 3;
+    pass.pos.assign(n, 0.0);
+    pass.vel.assign(n, 0.0);
+    pass.seconds = HUGE_VAL;
+
+    for (int r = 0; r < repeats; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::size_t k = 0;
+        for (double jd : epochs)
+        {
+            double jed[2] = {jd, 0.0};
+            for (short body : bodies)
+            {
+                if (state_r(eph, jed, body, &pass.pos[k], &pass.vel[k]) != 0)
+                    return false;
+                k += 3;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        pass.seconds = std::min(pass.seconds, elapsed.count());
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    // Util initial log.
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+    std::cout<<"  NOVAS Util: Chebyshev kernels of the JPL ephemeris"<<std::endl;
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+
+    Options opt;
+    if (!parseOptions(argc, argv, opt))
+    {
+        std::cerr<<"Usage: "<<argv[0]<<" [-n epochs] [-r repeats] ephemeris"<<std::endl;
+        return 1;
+    }
+
+    ephem_handle* eph;
+    double jd_begin, jd_end;
+    short de_number;
+    if (short error = ephem_open_r(&opt.input[0], EPH_MODE_MMAP, &eph, &jd_begin, &jd_end, &de_number))
+    {
+        std::cerr<<"Error "<<error<<": unable to open "<<opt.input<<std::endl;
+        return 1;
+    }
+
+    // The bodies on the file ('state_r' returns 3 for those left out by 'Util_SubsetEphemeris').
+    std::vector<short> bodies;
+    for (short body = 0; body < 11; body++)
+    {
+        double jed[2] = {0.5 * (jd_begin + jd_end), 0.0}, pos[3], vel[3];
+        if (state_r(eph, jed, body, pos, vel) == 0)
+            bodies.push_back(body);
+    }
+
+    // Random epochs inside the span of the file, with a fixed seed so that the runs repeat. They are
+    // sorted so that the changes of record do not hide the cost of the interpolation.
+    std::mt19937_64 engine(20260101);
+    std::uniform_real_distribution<double> span(jd_begin + 1.0, jd_end - 1.0);
+    std::vector<double> epochs(static_cast<std::size_t>(opt.epochs));
+    for (double& jd : epochs)
+        jd = span(engine);
+    std::sort(epochs.begin(), epochs.end());
+
+    std::cout<<"File: DE"<<de_number<<", "<<bodies.size()<<" bodies, "<<opt.epochs<<" epochs, best of "
+             <<opt.repeats<<std::endl;
+
+    Pass kernels, generic;
+    ephem_set_kernels_r(eph, 1);
+    bool ok = runPass(eph, epochs, bodies, opt.repeats, kernels);
+    ephem_set_kernels_r(eph, 0);
+    ok = ok && runPass(eph, epochs, bodies, opt.repeats, generic);
+    ephem_close_r(eph);
+    if (!ok)
+    {
+        std::cerr<<"Error: unable to interpolate the ephemeris"<<std::endl;
+        return 1;
+    }
+
+    double max_diff = 0.0;
+    for (std::size_t i = 0; i < kernels.pos.size(); i++)
+    {
+        max_diff = std::max(max_diff, std::fabs(kernels.pos[i] - generic.pos[i]));
+        max_diff = std::max(max_diff, std::fabs(kernels.vel[i] - generic.vel[i]));
+    }
+
+    const double evaluations = static_cast<double>(epochs.size() * bodies.size());
+    std::cout<<"Specialized kernels: "<<kernels.seconds<<" s ("<<1e9 * kernels.seconds / evaluations
+             <<" ns/body)"<<std::endl;
+    std::cout<<"Generic chebyshev:   "<<generic.seconds<<" s ("<<1e9 * generic.seconds / evaluations
+             <<" ns/body)"<<std::endl;
+    std::cout<<"Speedup: "<<generic.seconds / kernels.seconds<<", max difference: "<<max_diff<<std::endl;
+
+    if (max_diff != 0.0)
+    {
+        std::cerr<<"Error: the specialized kernels do not match the generic path"<<std::endl;
+        return 1;
+    }
+    if (kernels.seconds >= generic.seconds)
+    {
+        std::cerr<<"Error: the specialized kernels are not faster than the generic path"<<std::endl;
+        return 1;
+    }
+    return 0;
+}
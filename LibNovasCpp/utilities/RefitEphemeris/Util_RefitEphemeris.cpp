@@ -0,0 +1,469 @@
+/*
+  NOVAS Util: write a lower precision binary JPL ephemeris for the reduced accuracy modes.
+
+  Each series keeps the fewest Chebyshev coefficients per component whose worst-case error over the
+  whole file stays within the requested tolerance. The bound used is the sum of the absolute values
+  of the coefficients dropped (|T_k| <= 1) plus, with '-f', the rounding error of the coefficients
+  stored as floats. Velocities are not bounded: they lose more than the positions, roughly k^2 times
+  each dropped coefficient.
+
+  Without '-f' the output is a plain reduced file, like the ones of 'Util_SubsetEphemeris'. With
+  '-f' it is a compact file: the dates and the first EPH_F32_LEADING coefficients of each component
+  are kept as doubles and the rest as floats, and a constant named EPH_F32_NAME in the header tells
+  'ephem_open' to expand the records as they are read (see notes of 'ephem_open_mode').
+
+  Usage:
+
+      Util_RefitEphemeris [-t km] [-a tolerance] [-f] input output
+
+  '-t' is the tolerance of the bodies (series 0 to 10 of 'Util_SubsetEphemeris') in kilometers, and
+  '-a' the tolerance of the other series in their own units (radians for nutations and librations,
+  radians/day for the lunar mantle and seconds for TT-TDB). A series without tolerance keeps all its
+  coefficients. For example, 1 km for the bodies with float storage:
+
+      Util_RefitEphemeris -t 1 -f de440.bin de440_1km.bin
+
+  The worst-case error of each series is written in kilometers, and as an angle seen from 1 AU
+  (from the distance of the Moon for the geocentric Moon).
+
+  Royal Observatory of the Spanish Navy.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "LibNovasCpp/eph_manager.h"
+
+namespace
+{
+
+// Series of the header record: IPT (12), LPT, RPT and TPT.
+constexpr int kSeries = 15;
+
+// Byte offsets of the header record fields (see 'ephem_open').
+constexpr std::size_t kOffsetNames = 252;
+constexpr std::size_t kOffsetSpan = 252 + 2400;
+constexpr std::size_t kOffsetNcon = kOffsetSpan + 24;
+constexpr std::size_t kOffsetAu = kOffsetNcon + 4;
+constexpr std::size_t kOffsetIpt = kOffsetNcon + 4 + 16;
+constexpr std::size_t kOffsetDenum = kOffsetIpt + 144;
+constexpr std::size_t kOffsetLpt = kOffsetDenum + 4;
+constexpr std::size_t kHeaderBytes = kOffsetLpt + 12 + 24;
+
+// Fewest coefficients kept per component (the specialized kernels of 'eph_manager.c' need 3).
+constexpr int kMinCoefficients = 3;
+
+// Mean distance of the Moon, km, and milliarcseconds per radian.
+constexpr double kMoonDistance = 384400.0;
+constexpr double kMasPerRadian = 206264806.247;
+
+const char* const kSeriesName[kSeries] =
+{
+    "Mercury", "Venus", "EM barycenter", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune", "Pluto",
+    "Moon (geocentric)", "Sun", "Nutations", "Librations", "Lunar mantle", "TT-TDB"
+};
+
+struct Layout
+{
+    int pointer[kSeries][3] = {};
+    long record_words = 0;
+};
+
+struct Options
+{
+    double body_tolerance = -1.0;
+    double other_tolerance = -1.0;
+    bool f32 = false;
+    std::string input;
+    std::string output;
+};
+
+int components(int series)
+{
+    return series == 11 ? 2 : (series == 14 ? 1 : 3);
+}
+
+// Position of the last coefficient of a series, or 0 if it is not on the file (as 'ephem_open').
+long seriesEnd(const int* pointer, int series)
+{
+    if (pointer[0] < 3 || pointer[1] < 1 || pointer[1] > 18 || pointer[2] < 1 || pointer[2] > 64)
+        return 0;
+    return pointer[0] - 1L + static_cast<long>(pointer[1]) * pointer[2] * components(series);
+}
+
+// Offset of the RPT and TPT pointers, after the names of the constants beyond the 400th.
+std::size_t extraPointersOffset(int ncon)
+{
+    return kOffsetLpt + 12 + (ncon > 400 ? static_cast<std::size_t>(ncon - 400) * 6 : 0);
+}
+
+// Doubles of the header records: the first holds the names and the pointers, the second the values
+// of the 'ncon' constants, so neither is truncated.
+long headerWords(int ncon)
+{
+    return std::max(static_cast<long>(extraPointersOffset(ncon) + 24 + 7) / 8, static_cast<long>(ncon));
+}
+
+// Offset of the name of constant 'i' in the header record.
+std::size_t nameOffset(int i)
+{
+    return i < 400 ? kOffsetNames + static_cast<std::size_t>(i) * 6 : kOffsetLpt + 12 + (i - 400) * 6;
+}
+
+// Reads the pointers and the record length of a file, as 'ephem_open' does.
+bool readLayout(const std::vector<char>& header, Layout& layout)
+{
+    int ncon, denum;
+    std::memcpy(&ncon, &header[kOffsetNcon], sizeof ncon);
+    std::memcpy(&denum, &header[kOffsetDenum], sizeof denum);
+
+    for (int i = 0; i < 12; i++)
+        std::memcpy(layout.pointer[i], &header[kOffsetIpt + 12 * i], 12);
+    std::memcpy(layout.pointer[12], &header[kOffsetLpt], 12);
+    std::size_t offset = extraPointersOffset(ncon);
+    if (offset + 24 <= header.size())
+    {
+        std::memcpy(layout.pointer[13], &header[offset], 12);
+        std::memcpy(layout.pointer[14], &header[offset + 12], 12);
+    }
+
+    long words = 0;
+    for (int i = 0; i < kSeries; i++)
+    {
+        if (seriesEnd(layout.pointer[i], i) == 0)
+            std::fill(layout.pointer[i], layout.pointer[i] + 3, 0);
+        words = std::max(words, seriesEnd(layout.pointer[i], i));
+    }
+    if (words > 0)
+        words = std::max(words, headerWords(ncon));
+
+    long table = 0;
+    switch (denum)
+    {
+        case 200: table = 826; break;
+        case 403: case 405: case 421: table = 1018; break;
+        case 404: case 406: table = 728; break;
+        default: break;
+    }
+    layout.record_words = (words > 0 && (table == 0 || words < table)) ? words : table;
+    return layout.record_words > 0;
+}
+
+bool isCompact(const std::vector<char>& header, int ncon)
+{
+    for (int i = 0; i < ncon; i++)
+        if (nameOffset(i) + 6 <= header.size() &&
+            std::strncmp(&header[nameOffset(i)], EPH_F32_NAME, 6) == 0)
+            return true;
+    return false;
+}
+
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-t" || arg == "-a") && i + 1 < argc)
+        {
+            double value = std::atof(argv[++i]);
+            if (value <= 0.0)
+                return false;
+            (arg == "-t" ? opt.body_tolerance : opt.other_tolerance) = value;
+        }
+        else if (arg == "-f")
+            opt.f32 = true;
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() != 2)
+        return false;
+    opt.input = files[0];
+    opt.output = files[1];
+    return true;
+}
+
+// Rounding error of a coefficient stored as float.
+double floatError(double c)
+{
+    return std::fabs(c - static_cast<double>(static_cast<float>(c)));
+}
+
+// Updates the worst-case error of a series for every count of coefficients with one record:
+// worst[n] is the bound when 'n' coefficients per component are kept.
+void updateWorst(const double* record, const int* pointer, int series, bool f32, std::vector<double>& worst)
+{
+    const int ncf = pointer[1];
+    const int ncomp = components(series);
+    std::vector<double> tail(static_cast<std::size_t>(ncf) + 1), rounding(static_cast<std::size_t>(ncf) + 1);
+    std::vector<double> sum(static_cast<std::size_t>(ncf) + 1);
+
+    for (int sub = 0; sub < pointer[2]; sub++)
+    {
+        std::fill(sum.begin(), sum.end(), 0.0);
+        for (int c = 0; c < ncomp; c++)
+        {
+            const double* coef = record + pointer[0] - 1 + static_cast<long>(ncf) * (c + ncomp * sub);
+
+            tail[static_cast<std::size_t>(ncf)] = 0.0;
+            for (int k = ncf - 1; k >= 0; k--)
+                tail[static_cast<std::size_t>(k)] = tail[static_cast<std::size_t>(k) + 1] + std::fabs(coef[k]);
+
+            rounding[0] = 0.0;
+            for (int k = 0; k < ncf; k++)
+                rounding[static_cast<std::size_t>(k) + 1] = rounding[static_cast<std::size_t>(k)] +
+                    ((f32 && k >= EPH_F32_LEADING) ? floatError(coef[k]) : 0.0);
+
+            for (int n = 0; n <= ncf; n++)
+            {
+                double e = tail[static_cast<std::size_t>(n)] + rounding[static_cast<std::size_t>(n)];
+                sum[static_cast<std::size_t>(n)] += e * e;
+            }
+        }
+        for (int n = 0; n <= ncf; n++)
+            worst[static_cast<std::size_t>(n)] = std::max(worst[static_cast<std::size_t>(n)],
+                                                           std::sqrt(sum[static_cast<std::size_t>(n)]));
+    }
+}
+
+// Storage class of each double of a record in memory, as 'compact_layout' in 'eph_manager.c':
+// 0 = double, 1 = float, 2 = not stored.
+std::vector<unsigned char> storageClasses(const Layout& layout)
+{
+    std::vector<unsigned char> classes(static_cast<std::size_t>(layout.record_words), 2);
+    classes[0] = classes[1] = 0;
+    for (int i = 0; i < kSeries; i++)
+    {
+        long end = seriesEnd(layout.pointer[i], i);
+        if (end == 0)
+            continue;
+        for (long k = 0; k < end - layout.pointer[i][0] + 1; k++)
+            classes[static_cast<std::size_t>(layout.pointer[i][0] - 1 + k)] =
+                (k % layout.pointer[i][1] < EPH_F32_LEADING) ? 0 : 1;
+    }
+    return classes;
+}
+
+} // END ANONYMOUS NAMESPACE.
+
+int main(int argc, char *argv[])
+{
+    // Util initial log.
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+    std::cout<<"  NOVAS Util: refit of a binary JPL ephemeris"<<std::endl;
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+
+    Options opt;
+    if (!parseOptions(argc, argv, opt))
+    {
+        std::cerr<<"Usage: "<<argv[0]<<" [-t km] [-a tolerance] [-f] input output"<<std::endl;
+        return 1;
+    }
+
+    // Read the header record of the input. The extra names and pointers of newer files may follow
+    // the fixed part, so read the first record, whatever its length, in two steps.
+    std::ifstream in(opt.input, std::ios::binary);
+    std::vector<char> header(kHeaderBytes);
+    if (!in || !in.read(header.data(), static_cast<std::streamsize>(header.size())))
+    {
+        std::cerr<<"Error: unable to read the header of "<<opt.input<<std::endl;
+        return 1;
+    }
+    int ncon;
+    std::memcpy(&ncon, &header[kOffsetNcon], sizeof ncon);
+    header.resize(extraPointersOffset(ncon) + 24);
+    in.read(&header[kHeaderBytes], static_cast<std::streamsize>(header.size() - kHeaderBytes));
+
+    Layout source;
+    if (!readLayout(header, source))
+    {
+        std::cerr<<"Error: unable to find the record length of "<<opt.input<<std::endl;
+        return 1;
+    }
+    if (isCompact(header, ncon))
+    {
+        std::cerr<<"Error: "<<opt.input<<" is already a compact file."<<std::endl;
+        return 1;
+    }
+
+    double au;
+    std::memcpy(&au, &header[kOffsetAu], sizeof au);
+
+    const std::size_t in_length = static_cast<std::size_t>(source.record_words) * sizeof(double);
+    std::vector<char> rec1(in_length), rec2(in_length);
+    in.seekg(0);
+    if (!in.read(rec1.data(), static_cast<std::streamsize>(in_length)) ||
+        !in.read(rec2.data(), static_cast<std::streamsize>(in_length)))
+    {
+        std::cerr<<"Error: unable to read the header records of "<<opt.input<<std::endl;
+        return 1;
+    }
+
+    // First pass: worst-case error of each series for every count of coefficients.
+    std::vector<std::vector<double>> worst(kSeries);
+    for (int i = 0; i < kSeries; i++)
+        if (source.pointer[i][0] != 0)
+            worst[static_cast<std::size_t>(i)].assign(static_cast<std::size_t>(source.pointer[i][1]) + 1, 0.0);
+
+    std::vector<double> record(static_cast<std::size_t>(source.record_words));
+    std::size_t nrin = 0;
+    while (in.read(reinterpret_cast<char*>(record.data()), static_cast<std::streamsize>(in_length)))
+    {
+        for (int i = 0; i < kSeries; i++)
+            if (source.pointer[i][0] != 0)
+                updateWorst(record.data(), source.pointer[i], i, opt.f32, worst[static_cast<std::size_t>(i)]);
+        nrin++;
+    }
+    if (nrin == 0)
+    {
+        std::cerr<<"Error: no records on "<<opt.input<<std::endl;
+        return 1;
+    }
+
+    // Pick the count of each series and pack the series after the two dates of each record.
+    Layout target;
+    int ncf[kSeries] = {};
+    long next = 3;
+    std::printf("%-18s %9s %14s %14s\n", "Series", "Coeffs", "Error", "mas");
+    for (int i = 0; i < kSeries; i++)
+    {
+        if (source.pointer[i][0] == 0)
+            continue;
+
+        const std::vector<double>& w = worst[static_cast<std::size_t>(i)];
+        const int full = source.pointer[i][1];
+        const double tolerance = i <= 10 ? opt.body_tolerance : opt.other_tolerance;
+        ncf[i] = full;
+        if (tolerance > 0.0)
+            for (int n = std::min(kMinCoefficients, full); n < full; n++)
+                if (w[static_cast<std::size_t>(n)] <= tolerance)
+                {
+                    ncf[i] = n;
+                    break;
+                }
+
+        target.pointer[i][0] = static_cast<int>(next);
+        target.pointer[i][1] = ncf[i];
+        target.pointer[i][2] = source.pointer[i][2];
+        next += static_cast<long>(ncf[i]) * source.pointer[i][2] * components(i);
+
+        const double error = w[static_cast<std::size_t>(ncf[i])];
+        char coeffs[16];
+        std::snprintf(coeffs, sizeof coeffs, "%d -> %d", full, ncf[i]);
+        if (i <= 10)
+            std::printf("%-18s %9s %11.3e km %14.3f%s\n", kSeriesName[i], coeffs, error,
+                        error / (i == 9 ? kMoonDistance : au) * kMasPerRadian,
+                        tolerance > 0.0 && error > tolerance ? "  (tolerance not met)" : "");
+        else
+            std::printf("%-18s %9s %14.3e %14s%s\n", kSeriesName[i], coeffs, error, "",
+                        tolerance > 0.0 && error > tolerance ? "  (tolerance not met)" : "");
+    }
+
+    // The marker of compact files is one more constant.
+    const int ncon_out = opt.f32 ? ncon + 1 : ncon;
+    target.record_words = std::max(next - 1, headerWords(ncon_out));
+
+    std::vector<unsigned char> classes;
+    std::size_t out_length = static_cast<std::size_t>(target.record_words) * sizeof(double);
+    std::size_t n_doubles = 0;
+    if (opt.f32)
+    {
+        classes = storageClasses(target);
+        n_doubles = static_cast<std::size_t>(std::count(classes.begin(), classes.end(), 0));
+        std::size_t n_floats = static_cast<std::size_t>(std::count(classes.begin(), classes.end(), 1));
+        out_length = std::max(8 * (n_doubles + (n_floats + 1) / 2),
+                              static_cast<std::size_t>(headerWords(ncon_out)) * 8);
+    }
+    std::cout<<"Record length: "<<in_length<<" -> "<<out_length<<" bytes"<<std::endl;
+
+    // Second pass: write the refitted records.
+    std::ofstream out(opt.output, std::ios::binary | std::ios::trunc);
+    std::vector<char> zeros(out_length, 0);
+    out.write(zeros.data(), static_cast<std::streamsize>(out_length));
+    out.write(zeros.data(), static_cast<std::streamsize>(out_length));
+
+    in.clear();
+    in.seekg(static_cast<std::streamoff>(2 * in_length));
+    std::vector<double> refit(static_cast<std::size_t>(target.record_words));
+    std::vector<char> packed(out_length);
+    std::size_t nrout = 0;
+
+    while (in.read(reinterpret_cast<char*>(record.data()), static_cast<std::streamsize>(in_length)))
+    {
+        std::fill(refit.begin(), refit.end(), 0.0);
+        refit[0] = record[0];
+        refit[1] = record[1];
+        for (int i = 0; i < kSeries; i++)
+        {
+            if (target.pointer[i][0] == 0)
+                continue;
+            const int blocks = source.pointer[i][2] * components(i);
+            for (int b = 0; b < blocks; b++)
+                std::copy_n(&record[static_cast<std::size_t>(source.pointer[i][0] - 1 + b * source.pointer[i][1])],
+                            ncf[i], &refit[static_cast<std::size_t>(target.pointer[i][0] - 1 + b * ncf[i])]);
+        }
+
+        if (opt.f32)
+        {
+            // The doubles in memory order, then the floats in memory order.
+            std::fill(packed.begin(), packed.end(), 0);
+            std::size_t nd = 0, nf = 0;
+            for (std::size_t k = 0; k < refit.size(); k++)
+            {
+                if (classes[k] == 0)
+                    std::memcpy(&packed[8 * nd++], &refit[k], sizeof(double));
+                else if (classes[k] == 1)
+                {
+                    float value = static_cast<float>(refit[k]);
+                    std::memcpy(&packed[8 * n_doubles + 4 * nf++], &value, sizeof value);
+                }
+            }
+            out.write(packed.data(), static_cast<std::streamsize>(out_length));
+        }
+        else
+            out.write(reinterpret_cast<const char*>(refit.data()), static_cast<std::streamsize>(out_length));
+        nrout++;
+    }
+
+    // Rewrite the header records: new pointers and the marker of compact files, padded to the new
+    // length.
+    rec1.resize(std::max(rec1.size(), extraPointersOffset(ncon_out) + 24), 0);
+    if (opt.f32)
+    {
+        std::memcpy(&rec1[nameOffset(ncon)], EPH_F32_NAME, 6);
+        std::memcpy(&rec1[kOffsetNcon], &ncon_out, sizeof ncon_out);
+        double leading = EPH_F32_LEADING;
+        if (static_cast<std::size_t>(ncon + 1) * sizeof(double) <= rec2.size())
+            std::memcpy(&rec2[static_cast<std::size_t>(ncon) * sizeof(double)], &leading, sizeof leading);
+    }
+    for (int i = 0; i < 12; i++)
+        std::memcpy(&rec1[kOffsetIpt + 12 * i], target.pointer[i], 12);
+    std::memcpy(&rec1[kOffsetLpt], target.pointer[12], 12);
+    std::size_t offset = extraPointersOffset(ncon_out);
+    std::memcpy(&rec1[offset], target.pointer[13], 12);
+    std::memcpy(&rec1[offset + 12], target.pointer[14], 12);
+    rec1.resize(out_length, 0);
+    rec2.resize(out_length, 0);
+
+    out.seekp(0);
+    out.write(rec1.data(), static_cast<std::streamsize>(out_length));
+    out.write(rec2.data(), static_cast<std::streamsize>(out_length));
+    out.close();
+    if (!out)
+    {
+        std::cerr<<"Error: unable to write "<<opt.output<<std::endl;
+        return 1;
+    }
+
+    std::printf("%zu EPHEMERIS RECORDS WRITTEN.\n", nrout);
+    return 0;
+}
@@ -0,0 +1,310 @@
+/*
+  NOVAS Util: write a reduced binary JPL ephemeris with only some series and a time span.
+
+  The output keeps the layout read by 'ephem_open' and 'state': the kept series are packed one after
+  the other in each record, their pointers are rewritten in the header, the pointers of the series
+  left out are zeroed, and the span of the header is the span of the records kept. 'state' returns
+  error 3 for a body left out. Records are never shorter than the header records, so all the
+  constants are kept.
+
+  Usage:
+
+      Util_SubsetEphemeris [-b jd_begin] [-e jd_end] [-s series] input output
+
+  'series' is a comma separated list of series numbers: 0 to 10 for the bodies of 'state' (0 =
+  Mercury, ..., 2 = Earth-Moon barycenter, ..., 9 = geocentric Moon, 10 = Sun), 11 for nutations,
+  12 for librations, 13 for the lunar mantle angular velocity and 14 for TT-TDB. By default all the
+  series on the input file are kept. For example, Sun, Earth-Moon barycenter and Moon for 2020-2040:
+
+      Util_SubsetEphemeris -b 2458849.5 -e 2466154.5 -s 2,9,10 de440.bin de440_controller.bin
+
+  Royal Observatory of the Spanish Navy.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Series of the header record: IPT (12), LPT, RPT and TPT.
+constexpr int kSeries = 15;
+
+// Byte offsets of the header record fields (see 'ephem_open').
+constexpr std::size_t kOffsetSpan = 252 + 2400;
+constexpr std::size_t kOffsetNcon = kOffsetSpan + 24;
+constexpr std::size_t kOffsetIpt = kOffsetNcon + 4 + 16;
+constexpr std::size_t kOffsetDenum = kOffsetIpt + 144;
+constexpr std::size_t kOffsetLpt = kOffsetDenum + 4;
+constexpr std::size_t kHeaderBytes = kOffsetLpt + 12 + 24;
+
+struct Layout
+{
+    int pointer[kSeries][3] = {};
+    long record_words = 0;
+};
+
+struct Options
+{
+    double jd_begin = -99999999.0;
+    double jd_end = 99999999.0;
+    std::vector<bool> keep = std::vector<bool>(kSeries, true);
+    std::string input;
+    std::string output;
+};
+
+int components(int series)
+{
+    return series == 11 ? 2 : (series == 14 ? 1 : 3);
+}
+
+// Position of the last coefficient of a series, or 0 if it is not on the file (as 'ephem_open').
+long seriesEnd(const int* pointer, int series)
+{
+    if (pointer[0] < 3 || pointer[1] < 1 || pointer[1] > 18 || pointer[2] < 1 || pointer[2] > 64)
+        return 0;
+    return pointer[0] - 1L + static_cast<long>(pointer[1]) * pointer[2] * components(series);
+}
+
+// Offset of the RPT and TPT pointers, after the names of the constants beyond the 400th.
+std::size_t extraPointersOffset(int ncon)
+{
+    return kOffsetLpt + 12 + (ncon > 400 ? static_cast<std::size_t>(ncon - 400) * 6 : 0);
+}
+
+// Doubles of the header records: the first holds the names and the pointers, the second the values
+// of the 'ncon' constants, so neither is truncated.
+long headerWords(int ncon)
+{
+    return std::max(static_cast<long>(extraPointersOffset(ncon) + 24 + 7) / 8, static_cast<long>(ncon));
+}
+
+// Reads the pointers and the record length of a file, as 'ephem_open' does.
+bool readLayout(const std::vector<char>& header, Layout& layout)
+{
+    int ncon, denum;
+    std::memcpy(&ncon, &header[kOffsetNcon], sizeof ncon);
+    std::memcpy(&denum, &header[kOffsetDenum], sizeof denum);
+
+    for (int i = 0; i < 12; i++)
+        std::memcpy(layout.pointer[i], &header[kOffsetIpt + 12 * i], 12);
+    std::memcpy(layout.pointer[12], &header[kOffsetLpt], 12);
+    std::size_t offset = extraPointersOffset(ncon);
+    if (offset + 24 <= header.size())
+    {
+        std::memcpy(layout.pointer[13], &header[offset], 12);
+        std::memcpy(layout.pointer[14], &header[offset + 12], 12);
+    }
+
+    long words = 0;
+    for (int i = 0; i < kSeries; i++)
+    {
+        if (seriesEnd(layout.pointer[i], i) == 0)
+            std::fill(layout.pointer[i], layout.pointer[i] + 3, 0);
+        words = std::max(words, seriesEnd(layout.pointer[i], i));
+    }
+    if (words > 0)
+        words = std::max(words, headerWords(ncon));
+
+    long table = 0;
+    switch (denum)
+    {
+        case 200: table = 826; break;
+        case 403: case 405: case 421: table = 1018; break;
+        case 404: case 406: table = 728; break;
+        default: break;
+    }
+    layout.record_words = (words > 0 && (table == 0 || words < table)) ? words : table;
+    return layout.record_words > 0;
+}
+
+bool parseSeries(const std::string& list, std::vector<bool>& keep)
+{
+    std::stringstream stream(list);
+    std::string item;
+
+    keep.assign(kSeries, false);
+    while (std::getline(stream, item, ','))
+    {
+        char* last;
+        long series = std::strtol(item.c_str(), &last, 10);
+        if (item.empty() || *last != '\0' || series < 0 || series >= kSeries)
+            return false;
+        keep[static_cast<std::size_t>(series)] = true;
+    }
+    return true;
+}
+
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if ((arg == "-b" || arg == "-e" || arg == "-s") && i + 1 < argc)
+        {
+            const char* value = argv[++i];
+            if (arg == "-b")
+                opt.jd_begin = std::atof(value);
+            else if (arg == "-e")
+                opt.jd_end = std::atof(value);
+            else if (!parseSeries(value, opt.keep))
+                return false;
+        }
+        else
+            files.push_back(arg);
+    }
+
+    if (files.size() != 2)
+        return false;
+    opt.input = files[0];
+    opt.output = files[1];
+    return true;
+}
+
+} // END ANONYMOUS NAMESPACE.
+
+int main(int argc, char *argv[])
+{
+    // Util initial log.
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+    std::cout<<"  NOVAS Util: subset of a binary JPL ephemeris"<<std::endl;
+    std::cout<<"-----------------------------------------------------------"<<std::endl;
+
+    Options opt;
+    if (!parseOptions(argc, argv, opt))
+    {
+        std::cerr<<"Usage: "<<argv[0]<<" [-b jd_begin] [-e jd_end] [-s series] input output"<<std::endl;
+        return 1;
+    }
+
+    // Read the header record of the input. The extra names and pointers of newer files may follow
+    // the fixed part, so read the first record, whatever its length, in two steps.
+    std::ifstream in(opt.input, std::ios::binary);
+    std::vector<char> header(kHeaderBytes);
+    if (!in || !in.read(header.data(), static_cast<std::streamsize>(header.size())))
+    {
+        std::cerr<<"Error: unable to read the header of "<<opt.input<<std::endl;
+        return 1;
+    }
+    int ncon;
+    std::memcpy(&ncon, &header[kOffsetNcon], sizeof ncon);
+    header.resize(extraPointersOffset(ncon) + 24);
+    in.read(&header[kHeaderBytes], static_cast<std::streamsize>(header.size() - kHeaderBytes));
+
+    Layout source;
+    if (!readLayout(header, source))
+    {
+        std::cerr<<"Error: unable to find the record length of "<<opt.input<<std::endl;
+        return 1;
+    }
+
+    // Pack the kept series after the two dates of each record.
+    Layout target;
+    long next = 3;
+    for (int i = 0; i < kSeries; i++)
+    {
+        long end = seriesEnd(source.pointer[i], i);
+        if (!opt.keep[static_cast<std::size_t>(i)] || end == 0)
+            continue;
+        target.pointer[i][0] = static_cast<int>(next);
+        target.pointer[i][1] = source.pointer[i][1];
+        target.pointer[i][2] = source.pointer[i][2];
+        next += end - source.pointer[i][0] + 1;
+    }
+    if (next == 3)
+    {
+        std::cerr<<"Error: none of the requested series is on "<<opt.input<<std::endl;
+        return 1;
+    }
+    target.record_words = std::max(next - 1, headerWords(ncon));
+
+    const std::size_t in_length = static_cast<std::size_t>(source.record_words) * sizeof(double);
+    const std::size_t out_length = static_cast<std::size_t>(target.record_words) * sizeof(double);
+    std::cout<<"Record length: "<<in_length<<" -> "<<out_length<<" bytes"<<std::endl;
+
+    // Records 1 and 2 of the input, and room for them in the output.
+    std::vector<char> rec1(in_length), rec2(in_length);
+    in.seekg(0);
+    if (!in.read(rec1.data(), static_cast<std::streamsize>(in_length)) ||
+        !in.read(rec2.data(), static_cast<std::streamsize>(in_length)))
+    {
+        std::cerr<<"Error: unable to read the header records of "<<opt.input<<std::endl;
+        return 1;
+    }
+
+    std::ofstream out(opt.output, std::ios::binary | std::ios::trunc);
+    std::vector<char> zeros(out_length, 0);
+    out.write(zeros.data(), static_cast<std::streamsize>(out_length));
+    out.write(zeros.data(), static_cast<std::streamsize>(out_length));
+
+    // Copy the kept series of the records overlapping the span.
+    std::vector<double> record(static_cast<std::size_t>(source.record_words));
+    std::vector<double> reduced(static_cast<std::size_t>(target.record_words));
+    double ss[3] = {0.0, 0.0, 0.0};
+    std::size_t nrout = 0;
+
+    while (in.read(reinterpret_cast<char*>(record.data()), static_cast<std::streamsize>(in_length)))
+    {
+        if (record[1] <= opt.jd_begin || record[0] >= opt.jd_end)
+            continue;
+
+        std::fill(reduced.begin(), reduced.end(), 0.0);
+        reduced[0] = record[0];
+        reduced[1] = record[1];
+        for (int i = 0; i < kSeries; i++)
+        {
+            if (target.pointer[i][0] == 0)
+                continue;
+            long count = seriesEnd(source.pointer[i], i) - source.pointer[i][0] + 1;
+            std::copy_n(&record[static_cast<std::size_t>(source.pointer[i][0] - 1)], count,
+                        &reduced[static_cast<std::size_t>(target.pointer[i][0] - 1)]);
+        }
+        out.write(reinterpret_cast<const char*>(reduced.data()), static_cast<std::streamsize>(out_length));
+
+        if (nrout++ == 0)
+        {
+            ss[0] = record[0];
+            ss[2] = record[1] - record[0];
+        }
+        ss[1] = record[1];
+    }
+
+    if (nrout == 0)
+    {
+        std::cerr<<"Error: no records in the requested span."<<std::endl;
+        return 1;
+    }
+
+    // Rewrite the header records: new span and pointers, padded to the new length.
+    std::memcpy(&rec1[kOffsetSpan], ss, sizeof ss);
+    for (int i = 0; i < 12; i++)
+        std::memcpy(&rec1[kOffsetIpt + 12 * i], target.pointer[i], 12);
+    std::memcpy(&rec1[kOffsetLpt], target.pointer[12], 12);
+    std::size_t offset = extraPointersOffset(ncon);
+    std::memcpy(&rec1[offset], target.pointer[13], 12);
+    std::memcpy(&rec1[offset + 12], target.pointer[14], 12);
+    rec1.resize(out_length, 0);
+    rec2.resize(out_length, 0);
+
+    out.seekp(0);
+    out.write(rec1.data(), static_cast<std::streamsize>(out_length));
+    out.write(rec2.data(), static_cast<std::streamsize>(out_length));
+    out.close();
+    if (!out)
+    {
+        std::cerr<<"Error: unable to write "<<opt.output<<std::endl;
+        return 1;
+    }
+
+    std::printf("%zu EPHEMERIS RECORDS WRITTEN.  JED %.2f TO %.2f\n", nrout, ss[0], ss[1]);
+    return 0;
+}